@@ -0,0 +1,286 @@
+#include "batch.hpp"
+
+#include <print>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <wren/foundation/memory/align.hpp>
+#include <wren/platform/mapped_file.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/features.hpp>
+#include <wren/rhi/transfer/readback_queue.hpp>
+#include <wren/rhi/transfer/work_distributor.hpp>
+
+
+namespace wren::renderer {
+
+namespace {
+
+constexpr auto          k_format      = rhi::TextureFormat::RGBA8_UNorm;
+constexpr std::uint32_t k_texel_bytes = 4;
+
+/// One render target of the ring and the CPU copy of the last frame read
+/// back from it.
+struct Slot {
+  rhi::TextureHandle          target;
+  bool                        used = false;  // rendered to before; its contents are discarded on reuse
+  rhi::SyncPoint              copied;        // the flush that reads the target back
+  std::uint32_t               frame = 0;     // frame held in `pixels`
+  std::vector<std::byte>      pixels;        // tightly packed RGBA8 rows
+  std::vector<std::byte>      file;          // PPM header + RGB, built by the writer
+  foundation::jobs::JobHandle write;
+};
+
+struct Counters {
+  std::atomic<std::uint32_t> written{0};
+  std::atomic<std::uint32_t> failed{0};
+};
+
+/// Converts the slot's pixels to a binary PPM and writes it. Runs on a worker.
+void write_frame(Slot& slot, const BatchOptions& options, Counters& counters) noexcept {
+  try {
+    const auto header = std::format("P6\n{} {}\n255\n", options.width, options.height);
+    const std::size_t texels = std::size_t{options.width} * options.height;
+    slot.file.resize(header.size() + texels * 3);
+    std::memcpy(slot.file.data(), header.data(), header.size());
+    std::byte* rgb = slot.file.data() + header.size();
+    for (std::size_t i = 0; i < texels; ++i)
+      std::memcpy(rgb + i * 3, slot.pixels.data() + i * k_texel_bytes, 3);
+
+    const auto path = options.output / std::format("frame_{:06}.ppm", slot.frame);
+    if (const auto error = platform::write_file_atomic(path, slot.file)) {
+      std::print(std::cerr, "Failed to write {}: {}\n", path.string(), error.message());
+      counters.failed.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    counters.written.fetch_add(1, std::memory_order_relaxed);
+  } catch (const std::exception&) {
+    counters.failed.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+/// Clears the target to a colour that drifts from frame to frame, so the
+/// files of a sequence differ until there is a scene to render.
+auto record_frame(rhi::BackendDevice& device, Slot& slot, std::uint32_t frame, const BatchOptions& options)
+    -> std::expected<rhi::SyncPoint, rhi::Status> {
+  using rhi::TextureUsage;
+
+  auto list = device.begin_command_list();
+  if (!list) {
+    return std::unexpected{list.error()};
+  }
+
+  // The readback left the previous frame in ColorAttachment; it is never
+  // read again, but the copy must finish before the clear overwrites it.
+  const rhi::TextureBarrier to_target{
+      .texture  = slot.target,
+      .oldUsage = slot.used ? TextureUsage::ColorAttachment : TextureUsage::None,
+      .newUsage = TextureUsage::ColorAttachment,
+      .discard  = true,
+  };
+  list->barriers({&to_target, 1});
+
+  const float t = static_cast<float>(frame % 256) / 255.0f;
+  const rhi::ColorAttachment color{
+      .texture    = slot.target,
+      .load       = rhi::LoadOp::Clear,
+      .store      = rhi::StoreOp::Store,
+      .clearColor = {t, 0.05f, 1.0f - t, 1.0f},
+  };
+  list->begin_rendering({
+      .colorAttachments     = &color,
+      .colorAttachmentCount = 1,
+      .width                = options.width,
+      .height               = options.height,
+  });
+  list->end_rendering();
+
+  if (const auto status = list->end(); status != rhi::Status::Ok) {
+    return std::unexpected{status};
+  }
+  const auto handle = list->handle();
+  return device.submit({&handle, 1});
+}
+
+/// Renders frames claimed from @p work on @p device until none are left.
+/// Runs on the device's own thread; returns how long it took in @p elapsed.
+auto render_frames(rhi::BackendDevice& device, std::uint32_t index, rhi::WorkDistributor& work,
+                   foundation::jobs::JobSystem& jobs, const BatchOptions& options, Counters& counters,
+                   double& elapsed) -> rhi::Status {
+  using foundation::memory::align_up;
+
+  const bool write = !options.output.empty();
+  const std::uint64_t row_pitch = align_up(std::uint64_t{options.width} * k_texel_bytes,
+                                           rhi::k_readback_row_alignment);
+  const std::uint64_t frame_bytes = row_pitch * options.height;
+
+  // --- Render targets ---------------------------------------------------------
+  std::vector<Slot> slots(options.framesInFlight);
+  const auto destroy_targets = [&device, &slots] {
+    for (const auto& slot : slots)
+      if (slot.target)
+        device.destroy_texture(slot.target);
+  };
+  for (auto& slot : slots) {
+    auto target = device.create_texture({
+        .format    = k_format,
+        .usage     = rhi::TextureUsage::ColorAttachment | rhi::TextureUsage::TransferSrc,
+        .width     = options.width,
+        .height    = options.height,
+        .debugName = "batch target",
+    });
+    if (!target) {
+      std::print(std::cerr, "Failed to create a {}x{} render target on GPU {}: {}\n",
+                 options.width, options.height, index, rhi::to_string(target.error()));
+      destroy_targets();
+      return target.error();
+    }
+    slot.target = *target;
+    slot.pixels.resize(std::size_t{options.width} * options.height * k_texel_bytes);
+  }
+
+  // One frame per slot is in the ring at most; the extra one absorbs the
+  // ring's own alignment.
+  auto readbacks = rhi::ReadbackQueue::create(device, {
+      .ringBytes = align_up((slots.size() + 1) * frame_bytes, 256),
+  });
+  if (!readbacks) {
+    std::print(std::cerr, "Failed to create the readback queue on GPU {}: {}\n",
+               index, rhi::to_string(readbacks.error()));
+    destroy_targets();
+    return readbacks.error();
+  }
+
+  // --- Frames -----------------------------------------------------------------
+  // Each frame reuses the slot of this device's framesInFlight-th frame
+  // before it: that frame's copy has to be done on the GPU and its file
+  // written before the pixels are overwritten. Everything newer stays in
+  // flight. Frame numbers come from the distributor, slots from the count
+  // of frames this device has rendered.
+  rhi::Status failure = rhi::Status::Ok;
+  std::size_t next_slot = 0;
+  const auto start = std::chrono::steady_clock::now();
+  while (failure == rhi::Status::Ok) {
+    const auto claimed = work.claim(index);
+    if (!claimed) {
+      break;
+    }
+    const auto frame = static_cast<std::uint32_t>(*claimed);
+    auto& slot = slots[next_slot++ % slots.size()];
+    if (slot.used) {
+      if (const auto status = device.wait(slot.copied); status != rhi::Status::Ok) {
+        failure = status;
+        break;
+      }
+      readbacks->poll();
+      jobs.wait(slot.write);
+    }
+
+    if (const auto status = device.begin_frame(); status != rhi::Status::Ok) {
+      failure = status;
+      break;
+    }
+    auto rendered = record_frame(device, slot, frame, options);
+    auto status = rendered ? rhi::Status::Ok : rendered.error();
+    if (status == rhi::Status::Ok) {
+      status = readbacks->enqueue(rhi::TextureReadback{
+          .texture = slot.target,
+          .format  = k_format,
+          .usage   = rhi::TextureUsage::ColorAttachment,
+          .width   = options.width,
+          .height  = options.height,
+          .onReady = [&slot, &jobs, &options, &counters, frame, write](const rhi::ReadbackResult& r) {
+            const std::size_t row_bytes = std::size_t{r.width} * k_texel_bytes;
+            for (std::uint32_t y = 0; y < r.height; ++y)
+              std::memcpy(slot.pixels.data() + y * row_bytes, r.data.data() + y * r.rowPitch, row_bytes);
+            slot.frame = frame;
+            if (!write)
+              return;
+            try {
+              slot.write = jobs.spawn([&slot, &options, &counters] { write_frame(slot, options, counters); });
+            } catch (const std::exception&) {
+              write_frame(slot, options, counters);  // no job to spare: write it here
+            }
+          },
+      });
+    }
+    if (status == rhi::Status::Ok) {
+      auto flushed = readbacks->flush({&*rendered, 1});
+      status = flushed ? rhi::Status::Ok : flushed.error();
+      slot.copied = flushed.value_or(rhi::SyncPoint{});
+    }
+    failure = status;
+    slot.used = true;
+    if (const auto end = device.end_frame(); end != rhi::Status::Ok && failure == rhi::Status::Ok) {
+      failure = end;
+    }
+
+    // Frames that finished meanwhile go to the writers now rather than when
+    // their slot comes round again.
+    readbacks->poll();
+  }
+
+  // --- Drain --------------------------------------------------------------------
+  if (const auto status = readbacks->wait_idle(); status != rhi::Status::Ok && failure == rhi::Status::Ok) {
+    failure = status;
+  }
+  for (const auto& slot : slots)
+    jobs.wait(slot.write);
+  elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  destroy_targets();
+  return failure;
+}
+
+} // namespace
+
+
+auto run_batch(std::span<const BatchDevice> devices, foundation::jobs::JobSystem& jobs,
+               const BatchOptions& options) -> int {
+  std::vector<rhi::BackendDevice*> handles;
+  for (const auto& d : devices)
+    handles.push_back(d.device);
+
+  // Each device renders on a thread of its own; the main thread only waits.
+  rhi::WorkDistributor work{options.frames};
+  Counters counters;
+  std::vector<double> elapsed(devices.size(), 0.0);
+  const auto start = std::chrono::steady_clock::now();
+  const auto failure = work.run(handles, [&](std::uint32_t index, rhi::BackendDevice& device) {
+    return render_frames(device, index, work, jobs, options, counters, elapsed[index]);
+  });
+  const std::chrono::duration<double> total = std::chrono::steady_clock::now() - start;
+
+  if (failure != rhi::Status::Ok) {
+    std::print(std::cerr, "Batch failed: {}\n", rhi::to_string(failure));
+    return 1;
+  }
+  const auto rate = [](double frames, double seconds) { return seconds > 0.0 ? frames / seconds : 0.0; };
+  const double seconds = total.count();
+  if (devices.size() == 1) {
+    std::print("Batch: {} frames of {}x{} in {:.3f} s, {:.1f} frames/s on {}\n",
+               options.frames, options.width, options.height, seconds,
+               rate(options.frames, seconds), devices.front().adapterName);
+  } else {
+    std::print("Batch: {} frames of {}x{} in {:.3f} s, {:.1f} frames/s on {} GPUs\n",
+               options.frames, options.width, options.height, seconds,
+               rate(options.frames, seconds), devices.size());
+    for (std::uint32_t i = 0; i < devices.size(); ++i) {
+      const auto frames = work.claimed(i);
+      std::print("  GPU {:<8}: {} frames, {:.1f} frames/s on {}\n",
+                 i, frames, rate(static_cast<double>(frames), elapsed[i]), devices[i].adapterName);
+    }
+  }
+  if (!options.output.empty()) {
+    std::print("  Written     : {} files to {}\n", counters.written.load(), options.output.string());
+  }
+  return counters.failed.load() == 0 ? 0 : 1;
+}
+
+} // namespace wren::renderer
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+#include <wren/foundation/jobs/job_system.hpp>
+#include <wren/rhi/loader.hpp>
+
+namespace wren::renderer {
+
+/// Off-screen batch rendering for unattended render-farm nodes.
+///
+/// Renders `frames` frames into a ring of `framesInFlight` render targets.
+/// Every frame is copied back through a ReadbackQueue and, with an output
+/// directory, written to disk as a binary PPM on the job system. The CPU
+/// records frame N while the GPU renders the frames before it and the
+/// workers write older ones, so the throughput reported is the GPU's.
+/// With several devices each has a ring of its own and a thread to drive
+/// it, and the frames are shared out through a WorkDistributor: a faster
+/// GPU renders more of them.
+struct BatchOptions {
+  std::uint32_t         frames         = 0;     ///< Frames to render.
+  std::uint32_t         width          = 1920;
+  std::uint32_t         height         = 1080;
+  std::uint32_t         framesInFlight = 3;     ///< Render targets in the ring; 1..8.
+  std::filesystem::path output;                 ///< frame_NNNNNN.ppm goes here; empty writes nothing.
+};
+
+/// A device to render on and the adapter it runs on, for the report.
+struct BatchDevice {
+  rhi::BackendDevice* device      = nullptr;
+  const char*         adapterName = "";
+};
+
+/// Runs the batch on @p devices and prints frames per second, in total and,
+/// for several devices, per adapter. Returns the process exit code.
+[[nodiscard]] auto run_batch(std::span<const BatchDevice> devices, foundation::jobs::JobSystem& jobs,
+                             const BatchOptions& options) -> int;
+
+} // namespace wren::renderer
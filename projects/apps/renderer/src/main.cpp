@@ -1,38 +1,227 @@
 #include <print>
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
 #include <exception>
+#include <expected>
+#include <format>
+#include <fstream>
 #include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 #include <wren/version.hpp>
+#include <wren/platform/events.hpp>
+#include <wren/platform/frame_pacer.hpp>
+#include <wren/platform/thread.hpp>
 #include <wren/platform/window.hpp>
+#include <wren/foundation/diag/profiler.hpp>
+#include <wren/foundation/jobs/job_system.hpp>
 #include <wren/foundation/utility/scope_exit.hpp>
 #include <wren/rhi/loader.hpp>
 #include <wren/rhi/api/enums.hpp>
 #include <wren/rhi/api/features.hpp>
+#include <wren/rhi/api/swapchain.hpp>
+
+#include "batch.hpp"
+
+namespace {
+
+constexpr int k_key_escape = 256;  // GLFW_KEY_ESCAPE
+
+/// How long an idle loop sleeps in the event loop before checking again.
+constexpr std::chrono::duration<double> k_idle_timeout{0.25};
+
+auto to_native_window(const wren::platform::native_window_handle& handle) -> wren::rhi::NativeWindow {
+  using wren::platform::window_system;
+  using wren::rhi::WindowSystem;
+  switch (handle.system) {
+    case window_system::win32:   return {WindowSystem::Win32,   handle.display, handle.window};
+    case window_system::x11:     return {WindowSystem::Xlib,    handle.display, handle.window};
+    case window_system::wayland: return {WindowSystem::Wayland, handle.display, handle.window};
+    default:                     return {};
+  }
+}
+
+constexpr std::string_view k_usage =
+    "Usage: wren.renderer [options]\n"
+    "  --backend vulkan|opengl  Graphics backend; asked for interactively when omitted\n"
+    "  --adapter N|all          Adapter index (default 0); all splits a batch over every adapter\n"
+    "  --batch FRAMES           Render FRAMES frames off-screen, without a window, and exit\n"
+    "  --size WxH               Batch frame size (default 1920x1080)\n"
+    "  --frames-in-flight N     Batch frames in flight, 1-8 (default 3)\n"
+    "  --output DIR             Write batch frames to DIR as frame_NNNNNN.ppm\n";
+
+struct Options {
+  std::optional<wren::rhi::Backend>           backend;
+  std::uint32_t                               adapter = 0;
+  bool                                        all_adapters = false;  // --adapter all
+  std::optional<wren::renderer::BatchOptions> batch;  // --batch was given
+  bool                                        help = false;
+};
+
+auto parse_uint(std::string_view text, std::uint32_t& out) -> bool {
+  const auto* end = text.data() + text.size();
+  const auto [ptr, ec] = std::from_chars(text.data(), end, out);
+  return ec == std::errc{} && ptr == end;
+}
+
+/// Parses the command line; an error names the offending argument.
+auto parse_options(int argc, char* argv[]) -> std::expected<Options, std::string> {
+  Options options;
+  wren::renderer::BatchOptions batch;
+  std::optional<std::uint32_t> frames;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if (arg == "--help" || arg == "-h") {
+      options.help = true;
+      continue;
+    }
+    if (i + 1 >= argc) {
+      return std::unexpected{std::format("'{}' needs a value", arg)};
+    }
+    const std::string_view value = argv[++i];
+    const auto invalid = [&] { return std::unexpected{std::format("invalid value '{}' for {}", value, arg)}; };
+
+    if (arg == "--backend") {
+      if (value == "vulkan")      options.backend = wren::rhi::Backend::Vulkan;
+      else if (value == "opengl") options.backend = wren::rhi::Backend::OpenGL;
+      else                        return invalid();
+    } else if (arg == "--adapter") {
+      if (value == "all")                          options.all_adapters = true;
+      else if (!parse_uint(value, options.adapter)) return invalid();
+    } else if (arg == "--batch") {
+      if (!parse_uint(value, frames.emplace())) return invalid();
+    } else if (arg == "--size") {
+      const auto x = value.find('x');
+      if (x == std::string_view::npos || !parse_uint(value.substr(0, x), batch.width) ||
+          !parse_uint(value.substr(x + 1), batch.height) || batch.width == 0 || batch.height == 0)
+        return invalid();
+    } else if (arg == "--frames-in-flight") {
+      if (!parse_uint(value, batch.framesInFlight) || batch.framesInFlight < 1 || batch.framesInFlight > 8)
+        return invalid();
+    } else if (arg == "--output") {
+      batch.output = value;
+    } else {
+      return std::unexpected{std::format("unknown option '{}'", arg)};
+    }
+  }
+  if (frames) {
+    batch.frames  = *frames;
+    options.batch = batch;
+  } else if (options.all_adapters) {
+    return std::unexpected{std::string{"'--adapter all' needs --batch"}};
+  }
+  return options;
+}
+
+/// Clears the swapchain image: it is the whole frame until there is a scene.
+auto record_frame(wren::rhi::BackendDevice& device, const wren::rhi::SwapchainImage& image,
+                  const wren::rhi::SwapchainInfo& info) -> wren::rhi::Status {
+  using wren::rhi::TextureUsage;
+
+  auto list = device.begin_command_list();
+  if (!list) {
+    return list.error();
+  }
+
+  // The previous frame's contents are never read back.
+  const wren::rhi::TextureBarrier to_target{
+      .texture  = image.texture,
+      .oldUsage = TextureUsage::None,
+      .newUsage = TextureUsage::ColorAttachment,
+  };
+  list->barriers({&to_target, 1});
+
+  const wren::rhi::ColorAttachment color{
+      .texture    = image.texture,
+      .load       = wren::rhi::LoadOp::Clear,
+      .store      = wren::rhi::StoreOp::Store,
+      .clearColor = {0.05f, 0.05f, 0.08f, 1.0f},
+  };
+  list->begin_rendering({
+      .colorAttachments     = &color,
+      .colorAttachmentCount = 1,
+      .width                = info.width,
+      .height               = info.height,
+  });
+  list->end_rendering();
+
+  const wren::rhi::TextureBarrier to_present{
+      .texture  = image.texture,
+      .oldUsage = TextureUsage::ColorAttachment,
+      .newUsage = TextureUsage::Present,
+  };
+  list->barriers({&to_present, 1});
+
+  if (const auto status = list->end(); status != wren::rhi::Status::Ok) {
+    return status;
+  }
+  const auto handle = list->handle();
+  const auto submitted = device.submit({&handle, 1}, {&image.ready, 1});
+  return submitted ? wren::rhi::Status::Ok : submitted.error();
+}
+
+} // namespace
 
 
 auto main(int argc, char *argv[]) -> int {
   try {
-    (void)argc;
-    (void)argv;
+    const auto options = parse_options(argc, argv);
+    if (!options) {
+      std::print(std::cerr, "{}\n{}", options.error(), k_usage);
+      return 1;
+    }
+    if (options->help) {
+      std::print("{}", k_usage);
+      return 0;
+    }
 
     std::print("Wren Version: {}\n", WREN_VERSION_STRING);
 
+    // --- Job system ---------------------------------------------------------
+    // The main thread is participant 0; workers take one logical core each.
+    const auto core_count = wren::platform::logical_core_count();
+    wren::platform::set_current_thread_name("wren-main");
+    WREN_PROFILE_THREAD("wren-main");
+    wren::platform::set_current_thread_affinity(0);
+
+    wren::foundation::jobs::JobSystem jobs{{
+        .worker_count    = core_count > 1 ? core_count - 1 : 1,
+        .on_worker_start = [core_count](std::uint32_t index) {
+            const auto name = std::format("wren-worker-{}", index);
+            wren::platform::set_current_thread_name(name);
+            WREN_PROFILE_THREAD(name);
+            if (index < core_count) {
+                wren::platform::set_current_thread_affinity(index);
+            }
+        },
+    }};
+    std::print("Job system: {} threads\n", jobs.thread_count());
+
     // --- Backend selection --------------------------------------------------
-    std::print("Select a graphics backend:\n");
-    std::print("  1 = Vulkan\n");
-    std::print("  2 = OpenGL\n");
-    std::print("> ");
-
-    int choice{};
-    std::cin >> choice;
-
-    wren::rhi::Backend selected{};
-    switch (choice) {
-      case 1:  selected = wren::rhi::Backend::Vulkan; break;
-      case 2:  selected = wren::rhi::Backend::OpenGL; break;
-      default:
-        std::print(std::cerr, "Invalid selection '{}'. Expected 1 or 2.\n", choice);
-        return 1;
+    // A batch never waits for a person: without --backend it uses Vulkan.
+    wren::rhi::Backend selected = options->backend.value_or(wren::rhi::Backend::Vulkan);
+    if (!options->backend && !options->batch) {
+      std::print("Select a graphics backend:\n");
+      std::print("  1 = Vulkan\n");
+      std::print("  2 = OpenGL\n");
+      std::print("> ");
+
+      int choice{};
+      std::cin >> choice;
+
+      switch (choice) {
+        case 1:  selected = wren::rhi::Backend::Vulkan; break;
+        case 2:  selected = wren::rhi::Backend::OpenGL; break;
+        default:
+          std::print(std::cerr, "Invalid selection '{}'. Expected 1 or 2.\n", choice);
+          return 1;
+      }
     }
 
     // --- Load backend DLL ---------------------------------------------------
@@ -54,21 +243,69 @@ auto main(int argc, char *argv[]) -> int {
     constexpr auto k_device_flags = wren::rhi::DeviceFlag::Debug;
 #endif
 
-    const wren::rhi::DeviceDesc desc{
-        .flags = k_device_flags,
+    // A batch runs headless on an instance of its own, which also names the
+    // adapters the throughput is reported for. With --adapter all it gets a
+    // device per adapter and shares the frames out between them.
+    std::optional<wren::rhi::BackendInstance> instance;
+    std::vector<std::uint32_t> adapter_indices{options->adapter};
+    std::vector<std::string> adapter_names;
+    if (options->batch) {
+      auto instance_result = backend.create_instance({
+          .applicationName          = "wren.renderer",
+          .debug                    = wren::rhi::has_any(k_device_flags, wren::rhi::DeviceFlag::Debug),
+          .headless                 = true,
+          .capabilityCacheDirectory = "cache",
+      });
+      if (!instance_result) {
+        std::print(std::cerr, "Failed to create instance: {}\n", instance_result.error());
+        return 1;
+      }
+      instance.emplace(std::move(*instance_result));
+      const auto adapters = instance->adapters();
+      if (options->all_adapters) {
+        adapter_indices.clear();
+        for (const auto& adapter : adapters)
+          adapter_indices.push_back(adapter.index);
+      }
+      if (adapter_indices.empty() || adapter_indices.front() >= adapters.size()) {
+        std::print(std::cerr, "Adapter {} does not exist; {} found.\n", options->adapter, adapters.size());
+        return 1;
+      }
+      for (const auto index : adapter_indices)
+        adapter_names.emplace_back(adapters[index].name);
+    }
+
+    const auto device_desc = [&](std::uint32_t adapter) {
+      return wren::rhi::DeviceDesc{
+          .preferredAdapterIndex    = adapter,
+          .flags                    = options->batch ? k_device_flags | wren::rhi::DeviceFlag::Headless : k_device_flags,
+          .featureRequest           = {.preferred = options->batch ? wren::rhi::Feature::None
+                                                                   : wren::rhi::Feature::Presentation},
+          .framesInFlight           = options->batch ? std::min(options->batch->framesInFlight, 3u) : 2u,
+          .pipelineCacheDirectory   = "cache",
+          .capabilityCacheDirectory = "cache",
+          .jobSystem                = &jobs,
+      };
     };
 
-    auto dev_result = backend.create_device(desc);
-    if (!dev_result) {
-      std::print(std::cerr, "Failed to create device: {}\n", dev_result.error());
-      return 1;
+    std::vector<wren::rhi::BackendDevice> devices;
+    devices.reserve(adapter_indices.size());
+    for (const auto adapter : adapter_indices) {
+      const auto desc = device_desc(adapter);
+      auto dev_result = instance ? instance->create_device(desc) : backend.create_device(desc);
+      if (!dev_result) {
+        std::print(std::cerr, "Failed to create device on adapter {}: {}\n", adapter, dev_result.error());
+        return 1;
+      }
+      devices.push_back(std::move(*dev_result));
     }
 
-    auto& device = *dev_result;
+    auto& device = devices.front();
 
     // --- Print capabilities -------------------------------------------------
     const auto& caps = device.capabilities();
-    std::print("Device created successfully.\n");
+    std::print("Device created successfully{}.\n",
+               devices.size() > 1 ? std::format(" on {} adapters", devices.size()) : std::string{});
     std::print("  API version : {}.{}\n", caps.apiVersionMajor, caps.apiVersionMinor);
     std::print("  Backend     : {}\n",    wren::rhi::to_string(caps.backend));
     std::print("  Max 2D tex  : {}px\n",  caps.limits.maxImageDimension2D);
@@ -77,14 +314,137 @@ auto main(int argc, char *argv[]) -> int {
     std::print("  UBO align   : {} bytes\n", caps.limits.uniformBufferAlignment);
     std::print("  SSBO align  : {} bytes\n", caps.limits.storageBufferAlignment);
 
-    // --- Window + main loop -------------------------------------------------
+    const auto pipeline_cache = device.pipeline_cache_stats();
+    if (pipeline_cache.loaded)
+      std::print("  Pipelines   : {} bytes cached\n", pipeline_cache.loadedBytes);
+    else if (pipeline_cache.enabled)
+      std::print("  Pipelines   : cold cache\n");
+
+    // --- Batch ----------------------------------------------------------------
+    if (options->batch) {
+      std::vector<wren::renderer::BatchDevice> batch_devices;
+      for (std::size_t i = 0; i < devices.size(); ++i)
+        batch_devices.push_back({.device = &devices[i], .adapterName = adapter_names[i].c_str()});
+      return wren::renderer::run_batch(batch_devices, jobs, *options->batch);
+    }
+
+    // --- Window + swapchain -------------------------------------------------
     wren::platform::window::init_system();
     const wren::foundation::utility::scope_exit glfw_init_guard{wren::platform::window::deinit_system};
 
     wren::platform::window window{800, 600, "Renderer"};
-    while (window.should_close() == false) {
+    const auto framebuffer = window.framebuffer_size();
+
+    // Mailbox for the lowest latency without tearing, and one frame queued
+    // for display at most.
+    auto swapchain_result = device.create_swapchain({
+        .window          = to_native_window(window.native_handle()),
+        .width           = framebuffer.width,
+        .height          = framebuffer.height,
+        .presentMode     = wren::rhi::PresentMode::Mailbox,
+        .maxFrameLatency = 1,
+        .debugName       = "main swapchain",
+    });
+    if (!swapchain_result) {
+      std::print(std::cerr, "Failed to create swapchain: {}\n", swapchain_result.error());
+      return 1;
+    }
+    auto& swapchain = *swapchain_result;
+
+    const auto swapchain_info = swapchain.info();
+    std::print("  Swapchain   : {} images, present wait {}\n",
+               swapchain_info.imageCount, swapchain_info.presentWait ? "on" : "off");
+
+    // --- Input thread -------------------------------------------------------
+    // GLFW only pumps events on the main thread; this thread drains what it
+    // received, so handling input never waits on a frame. Any batch marks the
+    // frame dirty and wakes the main thread out of its idle wait.
+    std::atomic<bool> dirty{true};
+    std::jthread input_thread{[&window, &dirty] {
+      wren::platform::set_current_thread_name("wren-input");
+      WREN_PROFILE_THREAD("wren-input");
+
+      auto& queue = window.events();
+      std::vector<wren::platform::event> batch;
+      while (!queue.closed()) {
+        batch.clear();
+        if (queue.wait_drain(batch, std::chrono::milliseconds{100}) == 0)
+          continue;
+        for (const auto& e : batch) {
+          if (e.type == wren::platform::event_type::key && e.code == k_key_escape && e.action == 1)
+            window.request_close();
+        }
+        dirty.store(true, std::memory_order_release);
+        wren::platform::window::post_empty_event();
+      }
+    }};
+    // Declared after the thread so it runs first: closing the queue lets the
+    // thread finish before jthread joins it.
+    const wren::foundation::utility::scope_exit input_guard{[&window] { window.events().close(); }};
+
+    // --- Main loop ----------------------------------------------------------
+    // FIFO already blocks on the display; the other modes would render as
+    // fast as the GPU allows, so they are capped at the refresh rate.
+    const bool blocking_present = swapchain_info.presentMode == wren::rhi::PresentMode::Fifo ||
+                                  swapchain_info.presentMode == wren::rhi::PresentMode::FifoRelaxed;
+    wren::platform::frame_pacer pacer{blocking_present ? 0.0 : window.refresh_rate()};
+
+    bool out_of_date = false;
+    while (!window.should_close()) {
+      WREN_PROFILE_FRAME();
+
+      // Pace first, then sample input: the frame starts as late as the
+      // display allows, so the input it shows is as fresh as possible.
+      (void)swapchain.wait_for_present();
+      (void)pacer.wait();
       window.poll_events();
+
+      // Nothing changed: sleep in the event loop rather than redraw the same
+      // frame. An idle viewer then costs next to no CPU.
+      if (!out_of_date && !dirty.exchange(false, std::memory_order_acquire)) {
+        window.wait_events_timeout(k_idle_timeout);
+        pacer.reset();
+        continue;
+      }
+
+      if (out_of_date) {
+        const auto size = window.framebuffer_size();
+        if (swapchain.resize(size.width, size.height) != wren::rhi::Status::Ok) {
+          window.wait_events_timeout(k_idle_timeout);  // minimised; wait to be restored
+          continue;
+        }
+        out_of_date = false;
+      }
+
+      if (const auto status = device.begin_frame(); status != wren::rhi::Status::Ok) {
+        std::print(std::cerr, "begin_frame failed: {}\n", wren::rhi::to_string(status));
+        return 1;
+      }
+      auto image = swapchain.acquire();
+      auto status = image ? record_frame(device, *image, swapchain.info()) : image.error();
+      if (const auto end = device.end_frame(); end != wren::rhi::Status::Ok) {
+        std::print(std::cerr, "end_frame failed: {}\n", wren::rhi::to_string(end));
+        return 1;
+      }
+      if (image) {
+        const auto presented = swapchain.present();
+        status = status == wren::rhi::Status::Ok ? presented : status;
+      }
+
+      if (status == wren::rhi::Status::OutOfDate) {
+        out_of_date = true;
+      } else if (status != wren::rhi::Status::Ok) {
+        std::print(std::cerr, "Frame failed: {}\n", wren::rhi::to_string(status));
+        return 1;
+      }
     }
+
+#if WREN_PROFILER_ENABLED
+    // Open in ui.perfetto.dev or chrome://tracing.
+    std::ofstream trace{"wren_trace.json"};
+    if (!wren::foundation::diag::write_chrome_trace(trace))
+      std::print(std::cerr, "Failed to write wren_trace.json\n");
+#endif
   } catch (const std::exception &e) {
     std::print(std::cerr, "Critical Error: {}\n", e.what());
     return 1;
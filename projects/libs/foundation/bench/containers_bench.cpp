@@ -0,0 +1,148 @@
+// SlotMap churn and lookups, WorkStealingDeque owner and thief paths.
+
+#include <wren/foundation/containers/handle.hpp>
+#include <wren/foundation/containers/slot_map.hpp>
+#include <wren/foundation/containers/work_stealing_deque.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace wren::foundation::containers;
+
+struct BenchTag;
+using BenchHandle = Handle<BenchTag>;
+
+struct Transform {
+    float position[3];
+    float rotation[4];
+};
+
+using Map = SlotMap<BenchHandle, Transform, std::uint32_t>;
+
+[[nodiscard]] std::vector<BenchHandle> fill(Map& map, std::size_t count) {
+    std::vector<BenchHandle> handles;
+    handles.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        handles.push_back(map.insert(Transform{}, static_cast<std::uint32_t>(i)));
+    }
+    return handles;
+}
+
+// -------------------------------------------------------------------------------------------------
+// SlotMap
+// -------------------------------------------------------------------------------------------------
+void BM_SlotMapInsertErase(benchmark::State& state) {
+    auto const count = static_cast<std::size_t>(state.range(0));
+    Map map;
+    map.reserve(count);
+    auto handles = fill(map, count);
+
+    std::mt19937 rng{1};
+    std::uniform_int_distribution<std::size_t> pick{0, count - 1};
+    for (auto _ : state) {
+        std::size_t const i = pick(rng);
+        map.erase(handles[i]);
+        handles[i] = map.insert(Transform{}, static_cast<std::uint32_t>(i));
+        benchmark::DoNotOptimize(handles[i]);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_SlotMapInsertErase)->RangeMultiplier(16)->Range(256, 1 << 18);
+
+void BM_SlotMapLookup(benchmark::State& state) {
+    auto const count = static_cast<std::size_t>(state.range(0));
+    Map map;
+    map.reserve(count);
+    auto handles = fill(map, count);
+    std::shuffle(handles.begin(), handles.end(), std::mt19937{2});
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.get<1>(handles[i]));
+        i = i + 1 == count ? 0 : i + 1;
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_SlotMapLookup)->RangeMultiplier(16)->Range(256, 1 << 18);
+
+void BM_SlotMapColumnScan(benchmark::State& state) {
+    auto const count = static_cast<std::size_t>(state.range(0));
+    Map map;
+    map.reserve(count);
+    (void)fill(map, count);
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (std::uint32_t v : map.column<1>()) {
+            sum += v;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(count));
+}
+BENCHMARK(BM_SlotMapColumnScan)->RangeMultiplier(16)->Range(256, 1 << 18);
+
+// -------------------------------------------------------------------------------------------------
+// WorkStealingDeque
+// -------------------------------------------------------------------------------------------------
+void BM_DequePushPop(benchmark::State& state) {
+    WorkStealingDeque<std::uint32_t> deque{4096};
+    for (auto _ : state) {
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            (void)deque.push(i);
+        }
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            benchmark::DoNotOptimize(deque.pop());
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * 256));
+}
+BENCHMARK(BM_DequePushPop);
+
+/// Owner pushes and pops while range(0) thieves steal from the other end.
+void BM_DequeContendedSteal(benchmark::State& state) {
+    auto const thief_count = static_cast<std::size_t>(state.range(0));
+    WorkStealingDeque<std::uint32_t> deque{4096};
+    std::atomic<bool>                stop{false};
+    std::atomic<std::uint64_t>       stolen{0};
+
+    std::vector<std::thread> thieves;
+    for (std::size_t t = 0; t < thief_count; ++t) {
+        thieves.emplace_back([&] {
+            std::uint64_t local = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (deque.steal()) {
+                    ++local;
+                }
+            }
+            stolen.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+
+    for (auto _ : state) {
+        for (std::uint32_t i = 0; i < 64; ++i) {
+            (void)deque.push(i);
+        }
+        while (deque.pop()) {
+        }
+    }
+
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& t : thieves) {
+        t.join();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * 64));
+    state.counters["stolen"] = benchmark::Counter(static_cast<double>(stolen.load()),
+                                                  benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_DequeContendedSteal)->ArgName("thieves")->Arg(1)->Arg(3)->Arg(7)->UseRealTime();
+
+} // anonymous namespace
@@ -0,0 +1,61 @@
+// Cost of a profiler zone and a frame mark on the calling thread.
+
+#include <wren/foundation/diag/profiler.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+
+namespace {
+
+namespace diag = wren::foundation::diag;
+
+/// Uses diag::Zone directly so the numbers exist with WREN_ENABLE_PROFILER off.
+void BM_ProfilerZone(benchmark::State& state) {
+    diag::set_enabled(true);
+    for (auto _ : state) {
+        diag::Zone const zone{"bench"};
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ProfilerZone)->ThreadRange(1, 8);
+
+/// A zone while recording is paused: the price of leaving zones compiled in.
+void BM_ProfilerZonePaused(benchmark::State& state) {
+    diag::set_enabled(false);
+    for (auto _ : state) {
+        diag::Zone const zone{"bench"};
+        benchmark::ClobberMemory();
+    }
+    diag::set_enabled(true);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ProfilerZonePaused);
+
+void BM_ProfilerFrameMark(benchmark::State& state) {
+    for (auto _ : state) {
+        diag::frame_mark();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_ProfilerFrameMark);
+
+/// Export of one full thread ring (diag::k_thread_events zones).
+void BM_ProfilerExport(benchmark::State& state) {
+    diag::clear();
+    for (std::uint32_t i = 0; i < diag::k_thread_events; ++i) {
+        diag::Zone const zone{"bench"};
+    }
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        std::ostringstream out;
+        benchmark::DoNotOptimize(diag::write_chrome_trace(out));
+        bytes = out.str().size();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<benchmark::IterationCount>(bytes));
+    diag::clear();
+}
+BENCHMARK(BM_ProfilerExport)->Unit(benchmark::kMillisecond);
+
+} // anonymous namespace
@@ -0,0 +1,97 @@
+// Scheduling overhead of the job system: spawn + wait, dependency chains and
+// parallel_for fan-out.
+
+#include <wren/foundation/jobs/job_system.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace wren::foundation::jobs;
+
+/// One system for the whole run; creating and joining workers per benchmark
+/// would dominate the small ones. @p threads counts the caller, so it is >= 2.
+[[nodiscard]] JobSystem& job_system(std::uint32_t threads) {
+    static std::unique_ptr<JobSystem> system;
+    if (!system || system->thread_count() != threads) {
+        system.reset();
+        system = std::make_unique<JobSystem>(JobSystemDesc{.worker_count = threads - 1});
+    }
+    return *system;
+}
+
+void BM_JobSpawnWait(benchmark::State& state) {
+    JobSystem& jobs = job_system(static_cast<std::uint32_t>(state.range(0)));
+    std::atomic<std::uint32_t> counter{0};
+    for (auto _ : state) {
+        JobHandle h = jobs.spawn([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+        jobs.wait(h);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_JobSpawnWait)->ArgName("threads")->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+/// 1024 children of one root: the fan-out of a frame's worth of small jobs.
+void BM_JobFanOut(benchmark::State& state) {
+    JobSystem& jobs = job_system(static_cast<std::uint32_t>(state.range(0)));
+    std::atomic<std::uint32_t> counter{0};
+    for (auto _ : state) {
+        JobHandle root = jobs.create([&] {
+            JobHandle const self = JobSystem::current_job();
+            for (std::uint32_t i = 0; i < 1024; ++i) {
+                jobs.run(jobs.create_child(self, [&counter] {
+                    counter.fetch_add(1, std::memory_order_relaxed);
+                }));
+            }
+        });
+        jobs.run(root);
+        jobs.wait(root);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * 1024));
+}
+BENCHMARK(BM_JobFanOut)->ArgName("threads")->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+/// Serial chain of continuations: pure dependency-release latency.
+void BM_JobContinuationChain(benchmark::State& state) {
+    JobSystem& jobs = job_system(4);
+    constexpr std::uint32_t k_length = 256;
+    std::vector<JobHandle> chain(k_length);
+    for (auto _ : state) {
+        for (auto& h : chain) {
+            h = jobs.create([] {});
+        }
+        for (std::uint32_t i = 1; i < k_length; ++i) {
+            jobs.add_continuation(chain[i - 1], chain[i]);
+        }
+        for (auto& h : chain) {
+            jobs.run(h);
+        }
+        jobs.wait(chain.back());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * k_length));
+}
+BENCHMARK(BM_JobContinuationChain)->UseRealTime();
+
+void BM_ParallelFor(benchmark::State& state) {
+    JobSystem& jobs = job_system(static_cast<std::uint32_t>(state.range(0)));
+    std::vector<float> values(1u << 20, 1.0f);
+    for (auto _ : state) {
+        jobs.parallel_for(0, static_cast<std::uint32_t>(values.size()), 0,
+                          [&](std::uint32_t first, std::uint32_t last) {
+                              for (std::uint32_t i = first; i < last; ++i) {
+                                  values[i] = values[i] * 1.0001f + 0.5f;
+                              }
+                          });
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<benchmark::IterationCount>(values.size() * sizeof(float)));
+}
+BENCHMARK(BM_ParallelFor)->ArgName("threads")->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+} // anonymous namespace
@@ -0,0 +1,157 @@
+// Allocation cost of the foundation allocators against the general-purpose
+// heap they replace on hot paths.
+
+#include <wren/foundation/memory/linear_arena.hpp>
+#include <wren/foundation/memory/memory_resource.hpp>
+#include <wren/foundation/memory/ring_allocator.hpp>
+#include <wren/foundation/memory/tlsf_allocator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace wren::foundation::memory;
+
+constexpr std::size_t k_batch = 1024; ///< Allocations per reset / free round.
+
+/// Allocation sizes with the spread of per-frame payloads (16 B – 4 KiB).
+[[nodiscard]] std::vector<std::uint32_t> payload_sizes(std::size_t count) {
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<std::uint32_t> log2{4, 12};
+    std::vector<std::uint32_t> sizes(count);
+    for (auto& s : sizes) {
+        s = 1u << log2(rng);
+    }
+    return sizes;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Baseline
+// -------------------------------------------------------------------------------------------------
+void BM_GlobalNewDelete(benchmark::State& state) {
+    auto const sizes = payload_sizes(k_batch);
+    std::vector<void*> blocks(k_batch);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < k_batch; ++i) {
+            blocks[i] = ::operator new(sizes[i]);
+        }
+        benchmark::DoNotOptimize(blocks.data());
+        for (void* p : blocks) {
+            ::operator delete(p);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(k_batch));
+}
+BENCHMARK(BM_GlobalNewDelete);
+
+// -------------------------------------------------------------------------------------------------
+// LinearArena / FrameArena
+// -------------------------------------------------------------------------------------------------
+void BM_LinearArenaAllocate(benchmark::State& state) {
+    auto const sizes = payload_sizes(k_batch);
+    LinearArena arena{8u << 20};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < k_batch; ++i) {
+            benchmark::DoNotOptimize(arena.allocate(sizes[i], 16));
+        }
+        arena.reset();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(k_batch));
+}
+BENCHMARK(BM_LinearArenaAllocate);
+
+void BM_FrameArenaFrame(benchmark::State& state) {
+    auto const sizes = payload_sizes(k_batch);
+    FrameArena arena{8u << 20, 3};
+    for (auto _ : state) {
+        arena.begin_frame();
+        for (std::size_t i = 0; i < k_batch; ++i) {
+            benchmark::DoNotOptimize(arena.allocate(sizes[i], 16));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(k_batch));
+}
+BENCHMARK(BM_FrameArenaFrame);
+
+/// std::pmr::vector growth: the arena through ArenaResource against the default resource.
+void BM_PmrVectorGrowth(benchmark::State& state) {
+    bool const use_arena = state.range(0) != 0;
+    LinearArena arena{16u << 20};
+    ArenaResource resource{arena};
+    std::pmr::memory_resource* upstream = use_arena ? &resource : std::pmr::get_default_resource();
+    for (auto _ : state) {
+        std::pmr::vector<std::uint64_t> values{upstream};
+        for (std::uint64_t i = 0; i < 4096; ++i) {
+            values.push_back(i);
+        }
+        benchmark::DoNotOptimize(values.data());
+        values = std::pmr::vector<std::uint64_t>{upstream};
+        arena.reset();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * 4096));
+}
+BENCHMARK(BM_PmrVectorGrowth)->ArgName("arena")->Arg(0)->Arg(1);
+
+// -------------------------------------------------------------------------------------------------
+// RingAllocator — reserve from several producers, retire from one consumer.
+// -------------------------------------------------------------------------------------------------
+void BM_RingAllocatorAllocate(benchmark::State& state) {
+    static RingAllocator* ring = nullptr;
+    if (state.thread_index() == 0) {
+        ring = new RingAllocator{64u << 20};
+    }
+    auto const sizes = payload_sizes(k_batch);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < k_batch; ++i) {
+            auto a = ring->allocate(sizes[i], 16);
+            if (!a && state.thread_index() == 0) {
+                ring->release(ring->head()); // consumer: everything before is retired
+            }
+            benchmark::DoNotOptimize(a);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(k_batch));
+    if (state.thread_index() == 0) {
+        delete ring;
+        ring = nullptr;
+    }
+}
+BENCHMARK(BM_RingAllocatorAllocate)->ThreadRange(1, 8)->UseRealTime();
+
+// -------------------------------------------------------------------------------------------------
+// TlsfAllocator — random allocate / free interleaving, the GPU sub-allocation pattern.
+// -------------------------------------------------------------------------------------------------
+void BM_TlsfAllocateFree(benchmark::State& state) {
+    auto const live   = static_cast<std::size_t>(state.range(0));
+    auto const sizes  = payload_sizes(k_batch);
+    TlsfAllocator tlsf{1ull << 32};
+
+    std::vector<TlsfAllocator::Allocation> slots;
+    slots.reserve(live);
+    for (std::size_t i = 0; i < live; ++i) {
+        slots.push_back(*tlsf.allocate(sizes[i % k_batch] * 64, 256));
+    }
+
+    std::mt19937 rng{7};
+    std::uniform_int_distribution<std::size_t> pick{0, live - 1};
+    std::size_t n = 0;
+    for (auto _ : state) {
+        std::size_t const i = pick(rng);
+        tlsf.free(slots[i]);
+        auto a = tlsf.allocate(sizes[n++ % k_batch] * 64, 256);
+        benchmark::DoNotOptimize(a);
+        slots[i] = *a;
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    state.counters["fragments"] = static_cast<double>(tlsf.allocation_count());
+}
+BENCHMARK(BM_TlsfAllocateFree)->ArgName("live")->RangeMultiplier(8)->Range(64, 32768);
+
+} // anonymous namespace
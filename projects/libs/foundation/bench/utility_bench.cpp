@@ -0,0 +1,78 @@
+// Flag operators of enum_utils.hpp. They should compile to the same code as
+// the raw integer operations; the Raw variant is the reference.
+
+#include <wren/foundation/utility/enum_utils.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace bench {
+
+enum class Flags : std::uint64_t {
+    None = 0,
+    A    = 1ull << 0,
+    B    = 1ull << 7,
+    C    = 1ull << 33,
+    D    = 1ull << 63,
+};
+
+} // namespace bench
+
+namespace wren::foundation {
+template<> struct enable_flags<bench::Flags> : std::true_type {};
+} // namespace wren::foundation
+
+namespace {
+
+using wren::foundation::operator|;
+using wren::foundation::operator&;
+using wren::foundation::operator|=;
+using wren::foundation::operator&=;
+using wren::foundation::underlying;
+
+[[nodiscard]] std::vector<std::uint64_t> random_masks() {
+    std::mt19937_64 rng{3};
+    std::vector<std::uint64_t> masks(4096);
+    for (auto& m : masks) {
+        m = rng();
+    }
+    return masks;
+}
+
+void BM_EnumFlagsCombineTest(benchmark::State& state) {
+    auto const masks = random_masks();
+    for (auto _ : state) {
+        std::uint32_t hits = 0;
+        for (std::uint64_t m : masks) {
+            auto flags = static_cast<bench::Flags>(m);
+            flags |= bench::Flags::A;
+            flags &= bench::Flags::A | bench::Flags::C | bench::Flags::D;
+            hits += underlying(flags & bench::Flags::C) != 0;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(masks.size()));
+}
+BENCHMARK(BM_EnumFlagsCombineTest);
+
+void BM_EnumFlagsCombineTestRaw(benchmark::State& state) {
+    auto const masks = random_masks();
+    constexpr std::uint64_t a = 1ull << 0, c = 1ull << 33, d = 1ull << 63;
+    for (auto _ : state) {
+        std::uint32_t hits = 0;
+        for (std::uint64_t m : masks) {
+            m |= a;
+            m &= a | c | d;
+            hits += (m & c) != 0;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(masks.size()));
+}
+BENCHMARK(BM_EnumFlagsCombineTestRaw);
+
+} // anonymous namespace
@@ -0,0 +1,58 @@
+#ifndef WREN_FOUNDATION_CONTAINERS_HANDLE_HPP
+#define WREN_FOUNDATION_CONTAINERS_HANDLE_HPP
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace wren::foundation::containers {
+
+/// Generational 32-bit handle.
+///
+/// Layout: `[ generation : 12 | index : 20 ]`. The index addresses a slot in a
+/// SlotMap; the slot's generation is bumped every time it is freed, so a stale
+/// handle to a recycled slot fails lookup instead of aliasing the new occupant.
+/// Generations start at 1, which keeps the all-zero value free to mean "null".
+///
+/// @tparam Tag Phantom type that keeps handles from different pools distinct
+///             (a TextureHandle cannot be passed where a BufferHandle is
+///             expected).
+///
+/// Trivially copyable and standard-layout, so it can cross the C ABI and be
+/// passed in bulk arrays.
+template<typename Tag>
+struct Handle {
+    static constexpr std::uint32_t k_index_bits      = 20;
+    static constexpr std::uint32_t k_generation_bits = 32 - k_index_bits;
+    static constexpr std::uint32_t k_index_mask      = (1u << k_index_bits) - 1;
+    static constexpr std::uint32_t k_generation_mask = (1u << k_generation_bits) - 1;
+    static constexpr std::uint32_t k_max_slots       = 1u << k_index_bits;
+
+    std::uint32_t value = 0;
+
+    [[nodiscard]] static constexpr Handle make(std::uint32_t index, std::uint32_t generation) noexcept {
+        return Handle{((generation & k_generation_mask) << k_index_bits) | (index & k_index_mask)};
+    }
+
+    [[nodiscard]] constexpr std::uint32_t index()      const noexcept { return value & k_index_mask; }
+    [[nodiscard]] constexpr std::uint32_t generation() const noexcept { return value >> k_index_bits; }
+
+    /// `false` for the null handle. Does not imply the handle is still live.
+    [[nodiscard]] constexpr bool is_valid() const noexcept { return value != 0; }
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return is_valid(); }
+
+    friend constexpr bool operator==(Handle, Handle) noexcept  = default;
+    friend constexpr auto operator<=>(Handle, Handle) noexcept = default;
+};
+
+} // namespace wren::foundation::containers
+
+template<typename Tag>
+struct std::hash<wren::foundation::containers::Handle<Tag>> {
+    [[nodiscard]] std::size_t operator()(wren::foundation::containers::Handle<Tag> h) const noexcept {
+        return std::hash<std::uint32_t>{}(h.value);
+    }
+};
+
+#endif // WREN_FOUNDATION_CONTAINERS_HANDLE_HPP
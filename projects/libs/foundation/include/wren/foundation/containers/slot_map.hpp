@@ -0,0 +1,226 @@
+#ifndef WREN_FOUNDATION_CONTAINERS_SLOT_MAP_HPP
+#define WREN_FOUNDATION_CONTAINERS_SLOT_MAP_HPP
+
+// -------------------------------------------------------------------------------------------------
+// Generational slot map with structure-of-arrays storage.
+//
+//   slots_    — sparse, indexed by Handle::index(). Each slot stores the
+//               current generation and either the element's dense index (live)
+//               or the next slot in the free list (free).
+//   handles_  — dense, handles_[d] is the handle owning dense element d.
+//   columns_  — one dense std::vector per element type. Iterating a column
+//               walks contiguous memory with no holes, so per-frame passes over
+//               e.g. every live buffer touch only the fields they need.
+//
+// Insert, erase and lookup are O(1). Erase swap-removes from the dense arrays,
+// so dense order is not stable across erasures. Freed slots are recycled FIFO
+// to spread generation bumps over every slot, which pushes the 12-bit
+// generation wrap (and the ABA window it opens) as far out as possible.
+//
+// Not thread-safe; callers that share a map across threads provide their own
+// locking.
+// -------------------------------------------------------------------------------------------------
+
+#include <wren/foundation/containers/handle.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace wren::foundation::containers {
+
+template<typename H, typename... Ts>
+    requires (sizeof...(Ts) > 0)
+          && (std::is_nothrow_move_constructible_v<Ts> && ...)
+          && (std::is_nothrow_move_assignable_v<Ts> && ...)
+class SlotMap {
+public:
+    using handle_type = H;
+
+    template<std::size_t I>
+    using column_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+    static constexpr std::size_t k_column_count = sizeof...(Ts);
+
+    SlotMap() = default;
+
+    /// Pre-allocates room for @p count live elements.
+    void reserve(std::size_t count) {
+        slots_.reserve(count);
+        handles_.reserve(count);
+        std::apply([count](auto&... column) { (column.reserve(count), ...); }, columns_);
+    }
+
+    /// Inserts one value per column and returns its handle, or the null handle
+    /// when every addressable slot is live. If allocation throws, the map is
+    /// left unchanged.
+    [[nodiscard]] H insert(Ts... values) {
+        if (free_head_ == k_none && slots_.size() >= H::k_max_slots) {
+            return H{};
+        }
+        grow_for_insert();
+
+        // Nothing below can throw.
+        std::uint32_t index;
+        if (free_head_ != k_none) {
+            index      = free_head_;
+            free_head_ = slots_[index].dense;
+            if (free_head_ == k_none) {
+                free_tail_ = k_none;
+            }
+        } else {
+            index = static_cast<std::uint32_t>(slots_.size());
+            slots_.push_back(Slot{k_none, 1});
+        }
+
+        Slot& slot = slots_[index];
+        slot.dense = static_cast<std::uint32_t>(handles_.size());
+
+        H const handle = H::make(index, slot.generation);
+        handles_.push_back(handle);
+        push_columns(std::index_sequence_for<Ts...>{}, std::move(values)...);
+        return handle;
+    }
+
+    /// Removes the element referenced by @p handle. Returns `false` for the
+    /// null handle and for stale handles.
+    bool erase(H handle) noexcept {
+        auto const dense = dense_index(handle);
+        if (!dense) {
+            return false;
+        }
+        remove_at(handle, *dense);
+        return true;
+    }
+
+    /// Removes the element referenced by @p handle and returns its values.
+    [[nodiscard]] std::optional<std::tuple<Ts...>> extract(H handle) noexcept {
+        auto const dense = dense_index(handle);
+        if (!dense) {
+            return std::nullopt;
+        }
+        std::optional<std::tuple<Ts...>> out{std::apply(
+            [d = *dense](auto&... column) { return std::tuple<Ts...>{std::move(column[d])...}; },
+            columns_)};
+        remove_at(handle, *dense);
+        return out;
+    }
+
+    /// Returns `true` if @p handle refers to a live element.
+    [[nodiscard]] bool contains(H handle) const noexcept { return dense_index(handle).has_value(); }
+
+    /// Column @p I of the element referenced by @p handle, or nullptr when the
+    /// handle is null or stale. Invalidated by any insert or erase.
+    template<std::size_t I = 0>
+    [[nodiscard]] column_type<I>* get(H handle) noexcept {
+        auto const dense = dense_index(handle);
+        return dense ? &std::get<I>(columns_)[*dense] : nullptr;
+    }
+
+    template<std::size_t I = 0>
+    [[nodiscard]] column_type<I> const* get(H handle) const noexcept {
+        auto const dense = dense_index(handle);
+        return dense ? &std::get<I>(columns_)[*dense] : nullptr;
+    }
+
+    /// Position of @p handle's element in the dense arrays.
+    [[nodiscard]] std::optional<std::uint32_t> dense_index(H handle) const noexcept {
+        if (!handle || handle.index() >= slots_.size()) {
+            return std::nullopt;
+        }
+        std::uint32_t const dense = slots_[handle.index()].dense;
+        // A free slot's `dense` is a free-list link, so compare against the
+        // owning handle rather than trusting the generation alone.
+        if (dense >= handles_.size() || handles_[dense] != handle) {
+            return std::nullopt;
+        }
+        return dense;
+    }
+
+    /// Dense view of column @p I. Element d belongs to handles()[d].
+    template<std::size_t I = 0>
+    [[nodiscard]] std::span<column_type<I>> column() noexcept { return std::get<I>(columns_); }
+
+    template<std::size_t I = 0>
+    [[nodiscard]] std::span<column_type<I> const> column() const noexcept { return std::get<I>(columns_); }
+
+    /// Dense view of the handles of every live element.
+    [[nodiscard]] std::span<H const> handles() const noexcept { return handles_; }
+
+    [[nodiscard]] std::size_t size()  const noexcept { return handles_.size(); }
+    [[nodiscard]] bool        empty() const noexcept { return handles_.empty(); }
+
+    /// Removes every element. Outstanding handles become stale.
+    void clear() noexcept {
+        while (!handles_.empty()) {
+            remove_at(handles_.back(), static_cast<std::uint32_t>(handles_.size() - 1));
+        }
+    }
+
+private:
+    static constexpr std::uint32_t k_none = ~std::uint32_t{0};
+
+    struct Slot {
+        std::uint32_t dense;      ///< Dense index when live; next free slot when free.
+        std::uint32_t generation; ///< Never 0.
+    };
+
+    void grow_for_insert() {
+        auto const grow = [](auto& v) {
+            if (v.size() == v.capacity()) {
+                v.reserve(v.empty() ? 16 : v.size() * 2);
+            }
+        };
+        if (free_head_ == k_none) {
+            grow(slots_);
+        }
+        grow(handles_);
+        std::apply([&grow](auto&... column) { (grow(column), ...); }, columns_);
+    }
+
+    template<std::size_t... Is>
+    void push_columns(std::index_sequence<Is...>, Ts&&... values) noexcept {
+        (std::get<Is>(columns_).push_back(std::move(values)), ...);
+    }
+
+    void remove_at(H handle, std::uint32_t dense) noexcept {
+        auto const last = static_cast<std::uint32_t>(handles_.size() - 1);
+        if (dense != last) {
+            H const moved = handles_[last];
+            handles_[dense] = moved;
+            slots_[moved.index()].dense = dense;
+            std::apply([dense, last](auto&... column) { ((column[dense] = std::move(column[last])), ...); },
+                       columns_);
+        }
+        handles_.pop_back();
+        std::apply([](auto&... column) { (column.pop_back(), ...); }, columns_);
+
+        std::uint32_t const index = handle.index();
+        Slot& slot      = slots_[index];
+        std::uint32_t const next = (slot.generation + 1) & H::k_generation_mask;
+        slot.generation = next == 0 ? 1 : next;
+        slot.dense      = k_none;
+        if (free_tail_ == k_none) {
+            free_head_ = index;
+        } else {
+            slots_[free_tail_].dense = index;
+        }
+        free_tail_ = index;
+    }
+
+    std::vector<Slot>              slots_;
+    std::vector<H>                 handles_;
+    std::tuple<std::vector<Ts>...> columns_;
+    std::uint32_t                  free_head_ = k_none;
+    std::uint32_t                  free_tail_ = k_none;
+};
+
+} // namespace wren::foundation::containers
+
+#endif // WREN_FOUNDATION_CONTAINERS_SLOT_MAP_HPP
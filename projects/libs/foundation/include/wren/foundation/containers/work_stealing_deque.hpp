@@ -0,0 +1,130 @@
+#ifndef WREN_FOUNDATION_CONTAINERS_WORK_STEALING_DEQUE_HPP
+#define WREN_FOUNDATION_CONTAINERS_WORK_STEALING_DEQUE_HPP
+
+// -------------------------------------------------------------------------------------------------
+// Fixed-capacity Chase-Lev work-stealing deque.
+//
+// One owner thread pushes and pops at the bottom (LIFO, cache-warm); any
+// number of thief threads steal from the top (FIFO, oldest and usually
+// largest work first). Only the single-element race between pop() and
+// steal() needs a CAS; every other operation is a plain load/store.
+//
+// The ring does not grow: push() reports failure when it is full and the
+// caller decides what to do (a job system runs the item inline).
+//
+// Memory orderings follow Lê, Pop, Cohen & Zappa Nardelli,
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+// -------------------------------------------------------------------------------------------------
+
+#include <wren/foundation/memory/align.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace wren::foundation::containers {
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+class WorkStealingDeque {
+public:
+    /// @p capacity must be a power of two.
+    explicit WorkStealingDeque(std::size_t capacity)
+        : slots_{std::make_unique<std::atomic<T>[]>(capacity)}
+        , mask_{static_cast<std::int64_t>(capacity) - 1}
+    {
+        assert(memory::is_power_of_two(capacity));
+    }
+
+    WorkStealingDeque(WorkStealingDeque const&)            = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque const&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&)                 = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&)      = delete;
+    ~WorkStealingDeque()                                   = default;
+
+    /// Owner only. Returns `false` when the deque is full.
+    [[nodiscard]] bool push(T item) noexcept {
+        std::int64_t const b = bottom_.load(std::memory_order_relaxed);
+        std::int64_t const t = top_.load(std::memory_order_acquire);
+        if (b - t > mask_) {
+            return false;
+        }
+        slots_[static_cast<std::size_t>(b & mask_)].store(item, std::memory_order_relaxed);
+        // Release store instead of the paper's release fence + relaxed store:
+        // same cost on x86/ARMv8 and visible to race detectors.
+        bottom_.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Owner only. Takes the most recently pushed item.
+    [[nodiscard]] std::optional<T> pop() noexcept {
+        std::int64_t const b = bottom_.load(std::memory_order_relaxed) - 1;
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top_.load(std::memory_order_relaxed);
+
+        if (t > b) { // empty
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        T item = slots_[static_cast<std::size_t>(b & mask_)].load(std::memory_order_relaxed);
+        if (t == b) {
+            // Last element: race the thieves for it.
+            bool const won = top_.compare_exchange_strong(t, t + 1,
+                                                          std::memory_order_seq_cst,
+                                                          std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            if (!won) {
+                return std::nullopt;
+            }
+        }
+        return item;
+    }
+
+    /// Any thread. Takes the oldest item; std::nullopt when empty or when
+    /// another thread won the race for it.
+    [[nodiscard]] std::optional<T> steal() noexcept {
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t const b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) {
+            return std::nullopt;
+        }
+
+        T item = slots_[static_cast<std::size_t>(t & mask_)].load(std::memory_order_relaxed);
+        if (!top_.compare_exchange_strong(t, t + 1,
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+            return std::nullopt;
+        }
+        return item;
+    }
+
+    /// Snapshot of the element count; exact only when no thread is operating.
+    [[nodiscard]] std::size_t size_approx() const noexcept {
+        std::int64_t const b = bottom_.load(std::memory_order_relaxed);
+        std::int64_t const t = top_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<std::size_t>(b - t) : 0;
+    }
+
+    [[nodiscard]] bool empty_approx() const noexcept { return size_approx() == 0; }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return static_cast<std::size_t>(mask_ + 1); }
+
+private:
+    // Thieves CAS top_; the owner writes bottom_. Separate lines avoid
+    // false sharing between the two ends.
+    alignas(64) std::atomic<std::int64_t> top_{0};
+    alignas(64) std::atomic<std::int64_t> bottom_{0};
+    std::unique_ptr<std::atomic<T>[]>     slots_;
+    std::int64_t                          mask_;
+};
+
+} // namespace wren::foundation::containers
+
+#endif // WREN_FOUNDATION_CONTAINERS_WORK_STEALING_DEQUE_HPP
@@ -0,0 +1,171 @@
+#ifndef WREN_FOUNDATION_DIAG_PROFILER_HPP
+#define WREN_FOUNDATION_DIAG_PROFILER_HPP
+
+// -------------------------------------------------------------------------------------------------
+// CPU profiler.
+//
+// Scoped zones record into a buffer owned by the calling thread: one ring of
+// fixed capacity per thread, written without locks or allocation once the
+// thread's first zone has attached it. Rings overwrite their oldest events,
+// so a trace always holds the most recent few seconds of every thread.
+//
+//     void update() {
+//         WREN_PROFILE_ZONE("update");
+//         ...
+//     }
+//     WREN_PROFILE_FRAME();  // once per frame, on the frame thread
+//
+// A zone reads the CPU's timestamp counter when it opens and when it closes
+// and writes one event; the counter is converted to steady_clock nanoseconds
+// at export. Only the pointer of a zone or frame name is stored: names must
+// stay valid until the trace is written (string literals, __func__) — which
+// excludes literals of a module that is unloaded before then.
+//
+// Timelines that are timed elsewhere — the GPU profiling regions of the RHI,
+// which arrive framesInFlight frames late — are added as tracks with
+// add_track_span(), in steady_clock nanoseconds, and land in the same trace.
+//
+// write_chrome_trace() exports everything recorded since the last clear() as
+// Chrome trace-event JSON, which chrome://tracing and ui.perfetto.dev both
+// open.
+//
+// The WREN_PROFILE_* macros compile to nothing unless WREN_PROFILER_ENABLED
+// is defined to 1 (CMake option WREN_ENABLE_PROFILER); the functions below
+// stay available either way.
+// -------------------------------------------------------------------------------------------------
+
+#include <wren/foundation/diag/export.hpp>
+#include <wren/foundation/system/platform.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+
+#if defined(WREN_ARCH_X86_64) || defined(WREN_ARCH_X86)
+#   ifdef WREN_COMPILER_MSVC_ABI
+#       include <intrin.h>
+#   else
+#       include <x86intrin.h>
+#   endif
+#endif
+
+namespace wren::foundation::diag {
+
+/// Events kept per thread; older ones are overwritten.
+inline constexpr std::uint32_t k_thread_events     = 1u << 16;
+/// Spans kept across all tracks added with add_track_span().
+inline constexpr std::uint32_t k_track_spans       = 1u << 16;
+/// Bytes kept of thread, track and span names, terminator included.
+inline constexpr std::uint32_t k_max_diag_name     = 48;
+
+namespace detail {
+
+#if defined(WREN_ARCH_X86_64) || defined(WREN_ARCH_X86)
+inline constexpr bool k_ticks_are_ns = false;
+
+/// Invariant TSC: constant rate, synchronised across cores on every CPU the
+/// engine targets. Reading it costs a fraction of a steady_clock call.
+[[nodiscard]] inline std::uint64_t read_ticks() noexcept { return __rdtsc(); }
+#else
+inline constexpr bool k_ticks_are_ns = true;
+
+[[nodiscard]] inline std::uint64_t read_ticks() noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+#endif
+
+WREN_FOUNDATION_DIAG_EXPORT void record_zone(const char* name, std::uint64_t begin,
+                                             std::uint64_t end) noexcept;
+
+} // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// Zone — RAII scope measured on the calling thread's timeline.
+// -------------------------------------------------------------------------------------------------
+class Zone {
+public:
+    explicit Zone(const char* name) noexcept : name_{name}, begin_{detail::read_ticks()} {}
+    ~Zone() { detail::record_zone(name_, begin_, detail::read_ticks()); }
+
+    Zone(Zone const&)            = delete;
+    Zone& operator=(Zone const&) = delete;
+
+private:
+    const char*   name_;
+    std::uint64_t begin_;
+};
+
+// -------------------------------------------------------------------------------------------------
+// Recording
+// -------------------------------------------------------------------------------------------------
+
+/// Pauses or resumes recording in every thread; zones that close while
+/// paused are dropped. Recording starts enabled.
+WREN_FOUNDATION_DIAG_EXPORT void set_enabled(bool enabled) noexcept;
+[[nodiscard]] WREN_FOUNDATION_DIAG_EXPORT bool is_enabled() noexcept;
+
+/// Names the calling thread's timeline (copied, truncated to
+/// k_max_diag_name). Unnamed threads appear as "Thread <n>".
+WREN_FOUNDATION_DIAG_EXPORT void set_thread_name(std::string_view name) noexcept;
+
+/// Marks the start of a frame. The trace shows each mark as an instant and
+/// the time between consecutive marks of one name as a span on a "Frames"
+/// track.
+WREN_FOUNDATION_DIAG_EXPORT void frame_mark(const char* name = "Frame") noexcept;
+
+inline constexpr std::uint32_t k_invalid_track = UINT32_MAX;
+
+/// Adds a timeline named @p name (copied) and returns its id; a name that
+/// already has a track returns the existing one. k_invalid_track when out of
+/// memory. Thread-safe.
+[[nodiscard]] WREN_FOUNDATION_DIAG_EXPORT std::uint32_t add_track(std::string_view name) noexcept;
+
+/// Appends a span to @p track; spans of one track nest by their times. Times
+/// are steady_clock nanoseconds (time_since_epoch). Thread-safe; takes a
+/// lock, so meant for batches imported once per frame rather than hot code.
+/// Spans of k_invalid_track are ignored.
+WREN_FOUNDATION_DIAG_EXPORT void add_track_span(std::uint32_t track, std::string_view name,
+                                                std::uint64_t begin_ns, std::uint64_t end_ns) noexcept;
+
+/// Current time on the clock track spans are given in.
+[[nodiscard]] inline std::uint64_t now_ns() noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// -------------------------------------------------------------------------------------------------
+// Export
+// -------------------------------------------------------------------------------------------------
+
+/// Drops everything recorded so far; threads and tracks keep their names.
+WREN_FOUNDATION_DIAG_EXPORT void clear() noexcept;
+
+/// Writes Chrome trace-event JSON of every event still in the buffers.
+/// Threads may keep recording meanwhile; events they overwrite during the
+/// copy are left out. Returns false when the stream failed.
+WREN_FOUNDATION_DIAG_EXPORT bool write_chrome_trace(std::ostream& out);
+
+} // namespace wren::foundation::diag
+
+// -------------------------------------------------------------------------------------------------
+// Macros
+// -------------------------------------------------------------------------------------------------
+#define WREN_DIAG_CONCAT_IMPL(a, b) a##b
+#define WREN_DIAG_CONCAT(a, b)      WREN_DIAG_CONCAT_IMPL(a, b)
+
+#if defined(WREN_PROFILER_ENABLED) && WREN_PROFILER_ENABLED
+#   define WREN_PROFILE_ZONE(name) \
+        ::wren::foundation::diag::Zone const WREN_DIAG_CONCAT(wren_profile_zone_, __COUNTER__){name}
+#   define WREN_PROFILE_FUNCTION()    WREN_PROFILE_ZONE(__func__)
+#   define WREN_PROFILE_FRAME(...)    ::wren::foundation::diag::frame_mark(__VA_ARGS__)
+#   define WREN_PROFILE_THREAD(name)  ::wren::foundation::diag::set_thread_name(name)
+#else
+#   define WREN_PROFILE_ZONE(name)    static_cast<void>(0)
+#   define WREN_PROFILE_FUNCTION()    static_cast<void>(0)
+#   define WREN_PROFILE_FRAME(...)    static_cast<void>(0)
+#   define WREN_PROFILE_THREAD(name)  static_cast<void>(0)
+#endif
+
+#endif // WREN_FOUNDATION_DIAG_PROFILER_HPP
@@ -0,0 +1,256 @@
+#ifndef WREN_FOUNDATION_JOBS_JOB_SYSTEM_HPP
+#define WREN_FOUNDATION_JOBS_JOB_SYSTEM_HPP
+
+// -------------------------------------------------------------------------------------------------
+// Work-stealing job system.
+//
+// Every participating thread owns a Chase-Lev deque. Jobs spawned from a
+// participant go to its own deque; idle participants steal from the others.
+// Threads that do not belong to the system (I/O, platform callbacks) submit
+// through a shared injection queue.
+//
+// The thread that constructs the JobSystem becomes participant 0 and runs
+// jobs from inside wait(); thread_count() - 1 background workers are started.
+//
+// Dependencies are continuation-style, no fibers:
+//   - children:      a job created with create_child(parent, ...) keeps its
+//                    parent unfinished until the child finishes, so waiting
+//                    on the parent waits for the whole tree.
+//   - continuations: add_continuation(a, b) holds b back until a finishes.
+//                    A job with several ancestors starts when the last one
+//                    finishes.
+// wait() executes other jobs while it blocks, so a blocking wait inside a
+// job is legal, but it nests on the stack; prefer continuations on deep
+// dependency chains.
+//
+// Jobs must not throw; an escaping exception terminates the program.
+// Every job returned by create() / create_child() must eventually be passed
+// to run().
+// -------------------------------------------------------------------------------------------------
+
+#include <wren/foundation/jobs/export.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace wren::foundation::jobs {
+
+class JobSystem;
+
+namespace detail {
+
+inline constexpr std::size_t   k_job_payload_size    = 64;
+inline constexpr std::uint32_t k_max_continuations   = 8;
+
+/// Pooled job record. Owned by its JobSystem; reached through JobHandle.
+struct alignas(64) Job {
+    void (*invoke)(Job&) noexcept = nullptr; ///< Runs then destroys the payload.
+    JobSystem* owner              = nullptr;
+    Job*       parent             = nullptr;
+    Job*       next_free          = nullptr;
+
+    std::atomic<std::int32_t>  unfinished{0};          ///< 1 (self) + unfinished children.
+    std::atomic<std::int32_t>  dependencies{0};        ///< Unfinished ancestors + 1 until run().
+    std::atomic<std::int32_t>  refs{0};                ///< Handles + 1 while in flight.
+    std::atomic<std::uint32_t> continuation_count{0};
+    Job*                       continuations[k_max_continuations]{};
+
+    alignas(std::max_align_t) std::byte payload[k_job_payload_size];
+};
+
+} // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// JobHandle — counted reference to a job. Copying is one atomic increment.
+// -------------------------------------------------------------------------------------------------
+class WREN_FOUNDATION_JOBS_EXPORT JobHandle {
+public:
+    JobHandle() noexcept = default;
+    JobHandle(JobHandle const& other) noexcept;
+    JobHandle(JobHandle&& other) noexcept : job_{std::exchange(other.job_, nullptr)} {}
+    JobHandle& operator=(JobHandle const& other) noexcept;
+    JobHandle& operator=(JobHandle&& other) noexcept;
+    ~JobHandle();
+
+    [[nodiscard]] bool is_valid() const noexcept { return job_ != nullptr; }
+    [[nodiscard]] explicit operator bool() const noexcept { return is_valid(); }
+
+    /// `true` once the job's function has returned and all of its children
+    /// have finished. A null handle counts as done.
+    [[nodiscard]] bool is_done() const noexcept {
+        return !job_ || job_->unfinished.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    friend class JobSystem;
+    explicit JobHandle(detail::Job* adopted) noexcept : job_{adopted} {}
+
+    detail::Job* job_ = nullptr;
+};
+
+// -------------------------------------------------------------------------------------------------
+// JobSystemDesc
+// -------------------------------------------------------------------------------------------------
+struct JobSystemDesc {
+    /// Background worker threads. 0 selects hardware_concurrency() - 1.
+    std::uint32_t worker_count = 0;
+
+    /// Per-thread deque capacity; rounded up to a power of two. A spawn that
+    /// finds its deque full runs the job inline.
+    std::uint32_t queue_capacity = 4096;
+
+    /// Called on each worker thread before it takes its first job, with the
+    /// worker's participant index (1..thread_count()-1). Use it to name the
+    /// thread and pin it to a core (see wren/platform/thread.hpp); foundation
+    /// itself does not touch OS thread APIs.
+    std::function<void(std::uint32_t)> on_worker_start = {};
+
+    /// Called on each worker thread right before it exits.
+    std::function<void(std::uint32_t)> on_worker_stop = {};
+};
+
+// -------------------------------------------------------------------------------------------------
+// JobSystem
+// -------------------------------------------------------------------------------------------------
+class WREN_FOUNDATION_JOBS_EXPORT JobSystem {
+public:
+    explicit JobSystem(JobSystemDesc desc = {});
+
+    /// Runs every job still in flight to completion, then joins the workers.
+    /// Must be called on the constructing thread.
+    ~JobSystem();
+
+    JobSystem(JobSystem const&)            = delete;
+    JobSystem& operator=(JobSystem const&) = delete;
+    JobSystem(JobSystem&&)                 = delete;
+    JobSystem& operator=(JobSystem&&)      = delete;
+
+    // -----------------------------------------------------------------
+    // Creation & scheduling
+    // -----------------------------------------------------------------
+
+    /// Creates a job that runs @p fn once scheduled with run(). The callable
+    /// is stored inline and must fit in detail::k_job_payload_size bytes
+    /// (capture large state by reference or pointer).
+    template<typename F>
+        requires std::invocable<std::decay_t<F>&>
+    [[nodiscard]] JobHandle create(F&& fn) {
+        return create_child(JobHandle{}, std::forward<F>(fn));
+    }
+
+    /// Like create(), but @p parent does not finish until this job has.
+    /// @p parent must not have finished yet (typically it is current_job()).
+    template<typename F>
+        requires std::invocable<std::decay_t<F>&>
+    [[nodiscard]] JobHandle create_child(JobHandle const& parent, F&& fn) {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= detail::k_job_payload_size,
+                      "job callable too large; capture by reference or box the state");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t));
+
+        detail::Job* job = allocate_job(parent.job_);
+        try {
+            ::new (static_cast<void*>(job->payload)) Fn(std::forward<F>(fn));
+        } catch (...) {
+            discard_job(job);
+            throw;
+        }
+        job->invoke = [](detail::Job& j) noexcept {
+            Fn& f = *std::launder(reinterpret_cast<Fn*>(j.payload));
+            f();
+            f.~Fn();
+        };
+        return JobHandle{job};
+    }
+
+    /// Makes @p continuation wait for @p ancestor. Both must have been
+    /// created but @p ancestor not yet run; at most
+    /// detail::k_max_continuations continuations per ancestor.
+    void add_continuation(JobHandle const& ancestor, JobHandle const& continuation) noexcept;
+
+    /// Releases @p job for execution. It starts as soon as all of its
+    /// ancestors have finished.
+    void run(JobHandle const& job) noexcept;
+
+    /// create() + run().
+    template<typename F>
+        requires std::invocable<std::decay_t<F>&>
+    JobHandle spawn(F&& fn) {
+        JobHandle h = create(std::forward<F>(fn));
+        run(h);
+        return h;
+    }
+
+    /// Blocks until @p job is done, executing other jobs in the meantime.
+    void wait(JobHandle const& job) noexcept;
+
+    /// Calls `fn(first, last)` over disjoint sub-ranges covering
+    /// [@p begin, @p end) in parallel and returns when all have run.
+    /// Ranges are split in halves down to @p grain elements; 0 picks a grain
+    /// that yields roughly four chunks per thread.
+    template<typename F>
+        requires std::invocable<F&, std::uint32_t, std::uint32_t>
+    void parallel_for(std::uint32_t begin, std::uint32_t end, std::uint32_t grain, F&& fn) {
+        if (begin >= end) {
+            return;
+        }
+        if (grain == 0) {
+            grain = std::max<std::uint32_t>(1, (end - begin) / (thread_count() * 4));
+        }
+        if (end - begin <= grain) {
+            fn(begin, end);
+            return;
+        }
+        JobHandle root = create([this, &fn, begin, end, grain] { split(begin, end, grain, fn); });
+        run(root);
+        wait(root);
+    }
+
+    // -----------------------------------------------------------------
+    // Queries
+    // -----------------------------------------------------------------
+
+    /// Participants: background workers + the constructing thread.
+    [[nodiscard]] std::uint32_t thread_count() const noexcept;
+
+    /// Participant index of the calling thread, or std::nullopt when the
+    /// thread does not belong to this system.
+    [[nodiscard]] std::optional<std::uint32_t> thread_index() const noexcept;
+
+    /// The job executing on the calling thread, or a null handle.
+    [[nodiscard]] static JobHandle current_job() noexcept;
+
+private:
+    friend class JobHandle;
+
+    template<typename F>
+    void split(std::uint32_t begin, std::uint32_t end, std::uint32_t grain, F& fn) {
+        JobHandle const self = current_job();
+        while (end - begin > grain) {
+            std::uint32_t const mid = begin + (end - begin) / 2;
+            run(create_child(self, [this, &fn, mid, end, grain] { split(mid, end, grain, fn); }));
+            end = mid;
+        }
+        fn(begin, end);
+    }
+
+    [[nodiscard]] detail::Job* allocate_job(detail::Job* parent);
+    void discard_job(detail::Job* job) noexcept;
+    void release_job(detail::Job* job) noexcept;
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace wren::foundation::jobs
+
+#endif // WREN_FOUNDATION_JOBS_JOB_SYSTEM_HPP
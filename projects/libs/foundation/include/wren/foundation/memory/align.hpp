@@ -0,0 +1,29 @@
+#ifndef WREN_FOUNDATION_MEMORY_ALIGN_HPP
+#define WREN_FOUNDATION_MEMORY_ALIGN_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace wren::foundation::memory {
+
+/// Returns `true` if @p value is a non-zero power of two.
+[[nodiscard]] constexpr bool is_power_of_two(std::uint64_t value) noexcept {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+/// Rounds @p value up to the next multiple of @p alignment.
+/// @p alignment must be a power of two.
+[[nodiscard]] constexpr std::uint64_t align_up(std::uint64_t value, std::uint64_t alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+/// Rounds @p ptr up to the next address that is a multiple of @p alignment.
+/// @p alignment must be a power of two.
+[[nodiscard]] inline void* align_up(void* ptr, std::size_t alignment) noexcept {
+    auto const addr = reinterpret_cast<std::uintptr_t>(ptr);
+    return reinterpret_cast<void*>((addr + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1));
+}
+
+} // namespace wren::foundation::memory
+
+#endif // WREN_FOUNDATION_MEMORY_ALIGN_HPP
@@ -0,0 +1,216 @@
+#ifndef WREN_FOUNDATION_MEMORY_LINEAR_ARENA_HPP
+#define WREN_FOUNDATION_MEMORY_LINEAR_ARENA_HPP
+
+// -------------------------------------------------------------------------------------------------
+// Bump-pointer allocators for short-lived (per-frame) data.
+//
+//   LinearArena — a single contiguous block; allocation is a pointer bump,
+//                 individual frees are no-ops, reset() reclaims everything.
+//   FrameArena  — N equally sized LinearArena slices rotated once per frame.
+//                 Memory handed out during frame F stays valid until frame
+//                 F + N begins, which is what GPU-visible per-frame data
+//                 (uniforms, command payloads) needs with N frames in flight.
+//
+// Neither type is thread-safe. Give each recording thread its own arena or
+// use RingAllocator (ring_allocator.hpp) when several producers share a pool.
+// -------------------------------------------------------------------------------------------------
+
+#include <wren/foundation/memory/align.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace wren::foundation::memory {
+
+// -------------------------------------------------------------------------------------------------
+// LinearArena
+// -------------------------------------------------------------------------------------------------
+class LinearArena {
+public:
+    /// Opaque rewind point returned by mark().
+    using Marker = std::size_t;
+
+    /// Allocates a @p capacity byte block from @p upstream and owns it.
+    explicit LinearArena(std::size_t capacity,
+                         std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : upstream_{upstream}
+        , base_{static_cast<std::byte*>(upstream->allocate(capacity, alignof(std::max_align_t)))}
+        , capacity_{capacity}
+    {}
+
+    /// Borrows caller-provided storage. The storage must outlive the arena.
+    explicit LinearArena(std::span<std::byte> storage) noexcept
+        : base_{storage.data()}
+        , capacity_{storage.size()}
+    {}
+
+    LinearArena(LinearArena&& other) noexcept
+        : upstream_{std::exchange(other.upstream_, nullptr)}
+        , base_{std::exchange(other.base_, nullptr)}
+        , capacity_{std::exchange(other.capacity_, 0)}
+        , offset_{std::exchange(other.offset_, 0)}
+    {}
+
+    LinearArena& operator=(LinearArena&& other) noexcept {
+        if (this != &other) {
+            release_storage();
+            upstream_ = std::exchange(other.upstream_, nullptr);
+            base_     = std::exchange(other.base_, nullptr);
+            capacity_ = std::exchange(other.capacity_, 0);
+            offset_   = std::exchange(other.offset_, 0);
+        }
+        return *this;
+    }
+
+    LinearArena(LinearArena const&)            = delete;
+    LinearArena& operator=(LinearArena const&) = delete;
+
+    ~LinearArena() { release_storage(); }
+
+    /// Returns @p size bytes aligned to @p alignment, or nullptr when the
+    /// arena is exhausted. @p alignment must be a power of two.
+    [[nodiscard]] void* allocate(std::size_t size,
+                                 std::size_t alignment = alignof(std::max_align_t)) noexcept {
+        assert(is_power_of_two(alignment));
+        auto const addr  = reinterpret_cast<std::uintptr_t>(base_);
+        auto const start = static_cast<std::size_t>(align_up(addr + offset_, alignment) - addr);
+        if (start > capacity_ || size > capacity_ - start) {
+            return nullptr;
+        }
+        offset_ = start + size;
+        return base_ + start;
+    }
+
+    /// Allocates uninitialised storage for @p count objects of type T.
+    template<typename T>
+    [[nodiscard]] T* allocate_array(std::size_t count) noexcept {
+        if (count > capacity_ / sizeof(T)) {
+            return nullptr;
+        }
+        return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /// Constructs a T in arena memory. The destructor is never run, so T
+    /// must be trivially destructible.
+    template<typename T, typename... Args>
+        requires std::is_trivially_destructible_v<T>
+    [[nodiscard]] T* create(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        void* p = allocate(sizeof(T), alignof(T));
+        return p ? ::new (p) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    /// Reclaims every allocation. O(1).
+    void reset() noexcept { offset_ = 0; }
+
+    /// Current fill level; pass to rewind() to free everything allocated since.
+    [[nodiscard]] Marker mark() const noexcept { return offset_; }
+
+    /// Frees all allocations made after @p marker was taken.
+    void rewind(Marker marker) noexcept {
+        assert(marker <= offset_);
+        offset_ = marker;
+    }
+
+    [[nodiscard]] std::size_t capacity()  const noexcept { return capacity_; }
+    [[nodiscard]] std::size_t used()      const noexcept { return offset_; }
+    [[nodiscard]] std::size_t remaining() const noexcept { return capacity_ - offset_; }
+
+    /// Start of the underlying block.
+    [[nodiscard]] std::byte* data() const noexcept { return base_; }
+
+    /// Returns `true` if @p ptr points into this arena's block.
+    [[nodiscard]] bool owns(void const* ptr) const noexcept {
+        auto const* p = static_cast<std::byte const*>(ptr);
+        return p >= base_ && p < base_ + capacity_;
+    }
+
+private:
+    void release_storage() noexcept {
+        if (upstream_ && base_) {
+            upstream_->deallocate(base_, capacity_, alignof(std::max_align_t));
+        }
+        base_ = nullptr;
+    }
+
+    std::pmr::memory_resource* upstream_ = nullptr; ///< Non-null only when the block is owned.
+    std::byte*                 base_     = nullptr;
+    std::size_t                capacity_ = 0;
+    std::size_t                offset_   = 0;
+};
+
+// -------------------------------------------------------------------------------------------------
+// FrameArena
+// -------------------------------------------------------------------------------------------------
+class FrameArena {
+public:
+    /// Carves @p frame_count slices of @p bytes_per_frame from a single block
+    /// allocated from @p upstream.
+    FrameArena(std::size_t bytes_per_frame,
+               std::uint32_t frame_count,
+               std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : block_{bytes_per_frame * frame_count, upstream}
+        , frame_capacity_{bytes_per_frame}
+        , frame_count_{frame_count}
+    {
+        assert(frame_count > 0);
+        select_slice();
+    }
+
+    FrameArena(FrameArena&&) noexcept            = default;
+    FrameArena& operator=(FrameArena&&) noexcept = default;
+    FrameArena(FrameArena const&)                = delete;
+    FrameArena& operator=(FrameArena const&)     = delete;
+    ~FrameArena()                                = default;
+
+    /// Allocates from the current frame's slice; nullptr when it is full.
+    [[nodiscard]] void* allocate(std::size_t size,
+                                 std::size_t alignment = alignof(std::max_align_t)) noexcept {
+        return current_.allocate(size, alignment);
+    }
+
+    template<typename T>
+    [[nodiscard]] T* allocate_array(std::size_t count) noexcept {
+        return current_.allocate_array<T>(count);
+    }
+
+    /// Advances to the next slice and resets it. O(1).
+    ///
+    /// The caller guarantees that the work which consumed the slice being
+    /// recycled (allocated frame_count() frames ago) has completed.
+    void begin_frame() noexcept {
+        frame_index_ = (frame_index_ + 1) % frame_count_;
+        select_slice();
+    }
+
+    [[nodiscard]] std::uint32_t frame_index()    const noexcept { return frame_index_; }
+    [[nodiscard]] std::uint32_t frame_count()    const noexcept { return frame_count_; }
+    [[nodiscard]] std::size_t   frame_capacity() const noexcept { return frame_capacity_; }
+    [[nodiscard]] std::size_t   used()           const noexcept { return current_.used(); }
+
+    /// The arena backing the current frame. Reset on the next begin_frame().
+    [[nodiscard]] LinearArena& current() noexcept { return current_; }
+
+private:
+    void select_slice() noexcept {
+        // block_ is never allocated from directly; it only owns the storage
+        // that the per-frame views are carved out of.
+        current_ = LinearArena{std::span<std::byte>{
+            block_.data() + (frame_capacity_ * frame_index_), frame_capacity_}};
+    }
+
+    LinearArena   block_;
+    LinearArena   current_{std::span<std::byte>{}};
+    std::size_t   frame_capacity_ = 0;
+    std::uint32_t frame_count_    = 0;
+    std::uint32_t frame_index_    = 0;
+};
+
+} // namespace wren::foundation::memory
+
+#endif // WREN_FOUNDATION_MEMORY_LINEAR_ARENA_HPP
@@ -0,0 +1,66 @@
+#ifndef WREN_FOUNDATION_MEMORY_MEMORY_RESOURCE_HPP
+#define WREN_FOUNDATION_MEMORY_MEMORY_RESOURCE_HPP
+
+// -------------------------------------------------------------------------------------------------
+// std::pmr adapters for the foundation allocators.
+//
+//   FrameArena           frame{64 * 1024, 3};
+//   ArenaResource        resource{frame};
+//   std::pmr::vector<T>  items{&resource};   // no malloc on the hot path
+//
+// deallocate() is a no-op: memory comes back when the arena is reset / the
+// frame slot is recycled / the ring tail is released. Containers therefore
+// must not outlive that point. Exhaustion throws std::bad_alloc, as the
+// memory_resource contract requires; size arenas for the worst frame.
+// -------------------------------------------------------------------------------------------------
+
+#include <wren/foundation/memory/linear_arena.hpp>
+#include <wren/foundation/memory/ring_allocator.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+namespace wren::foundation::memory {
+
+/// Any allocator exposing `void* allocate(size, alignment) noexcept` that
+/// returns nullptr on exhaustion and frees in bulk.
+template<typename A>
+concept BumpAllocator = requires(A& a, std::size_t n) {
+    { a.allocate(n, n) } noexcept -> std::same_as<void*>;
+};
+
+/// Presents a BumpAllocator (LinearArena, FrameArena, RingBuffer) as a
+/// std::pmr::memory_resource. Does not own the allocator.
+template<BumpAllocator A>
+class ArenaResource final : public std::pmr::memory_resource {
+public:
+    explicit ArenaResource(A& allocator) noexcept : allocator_{&allocator} {}
+
+    [[nodiscard]] A& allocator() const noexcept { return *allocator_; }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        void* p = allocator_->allocate(bytes, alignment);
+        if (!p) {
+            throw std::bad_alloc{};
+        }
+        return p;
+    }
+
+    void do_deallocate(void* /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/) override {}
+
+    [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override {
+        return this == &other;
+    }
+
+    A* allocator_;
+};
+
+template<BumpAllocator A>
+ArenaResource(A&) -> ArenaResource<A>;
+
+} // namespace wren::foundation::memory
+
+#endif // WREN_FOUNDATION_MEMORY_MEMORY_RESOURCE_HPP
@@ -0,0 +1,172 @@
+#ifndef WREN_FOUNDATION_MEMORY_RING_ALLOCATOR_HPP
+#define WREN_FOUNDATION_MEMORY_RING_ALLOCATOR_HPP
+
+// -------------------------------------------------------------------------------------------------
+// Lock-free multi-producer ring allocation.
+//
+//   RingAllocator — hands out [offset, offset + size) ranges of a fixed
+//                   capacity ring. It never touches memory itself, so the same
+//                   type sub-allocates CPU storage (RingBuffer below) and
+//                   GPU-visible staging buffers (offsets into a VkBuffer).
+//   RingBuffer    — RingAllocator + owned byte storage; returns pointers.
+//
+// Positions are monotonically increasing 64-bit byte counters; the physical
+// offset is `position % capacity`. Producers reserve with a CAS on `head`.
+// A single consumer (typically the frame loop, once a fence or timeline value
+// says the GPU is done) retires ranges in order by advancing `tail` to a
+// position previously returned from head() or Allocation::end.
+//
+// An allocation never straddles the end of the ring: when the request does not
+// fit before the wrap point the padding up to the wrap is skipped and is
+// reclaimed along with the allocation itself.
+// -------------------------------------------------------------------------------------------------
+
+#include <wren/foundation/memory/align.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <utility>
+
+namespace wren::foundation::memory {
+
+// -------------------------------------------------------------------------------------------------
+// RingAllocator
+// -------------------------------------------------------------------------------------------------
+class RingAllocator {
+public:
+    /// A reserved range. Pass `end` to release() once the consumer is done.
+    struct Allocation {
+        std::uint64_t offset; ///< Byte offset into the ring storage.
+        std::uint64_t size;   ///< Requested size in bytes.
+        std::uint64_t end;    ///< Monotonic position just past this allocation.
+    };
+
+    /// @p capacity is the ring size in bytes. Alignments passed to allocate()
+    /// must divide it (any power of two up to the capacity's largest
+    /// power-of-two factor).
+    explicit RingAllocator(std::uint64_t capacity) noexcept
+        : capacity_{capacity}
+    {
+        assert(capacity > 0);
+    }
+
+    RingAllocator(RingAllocator const&)            = delete;
+    RingAllocator& operator=(RingAllocator const&) = delete;
+    RingAllocator(RingAllocator&&)                 = delete;
+    RingAllocator& operator=(RingAllocator&&)      = delete;
+    ~RingAllocator()                               = default;
+
+    /// Reserves @p size bytes. Safe to call concurrently from any thread.
+    /// Returns std::nullopt when the ring does not currently have room.
+    [[nodiscard]] std::optional<Allocation> allocate(std::uint64_t size,
+                                                     std::uint64_t alignment = 16) noexcept {
+        assert(is_power_of_two(alignment));
+        assert(capacity_ % alignment == 0);
+        if (size == 0 || size > capacity_) {
+            return std::nullopt;
+        }
+
+        std::uint64_t head = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            std::uint64_t start = align_up(head, alignment);
+            std::uint64_t const offset = start % capacity_;
+            if (offset + size > capacity_) {
+                start += capacity_ - offset; // skip the tail end of this lap
+            }
+            std::uint64_t const end = start + size;
+            if (end - tail_.load(std::memory_order_acquire) > capacity_) {
+                return std::nullopt;
+            }
+            if (head_.compare_exchange_weak(head, end,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_relaxed)) {
+                return Allocation{start % capacity_, size, end};
+            }
+        }
+    }
+
+    /// Retires every allocation whose end is <= @p position.
+    /// Single consumer; positions must be passed in non-decreasing order.
+    void release(std::uint64_t position) noexcept {
+        assert(position >= tail_.load(std::memory_order_relaxed));
+        assert(position <= head_.load(std::memory_order_relaxed));
+        tail_.store(position, std::memory_order_release);
+    }
+
+    /// Position at which the next allocation will begin. Record it at a sync
+    /// point (e.g. frame submit) and release() it once that work completes.
+    [[nodiscard]] std::uint64_t head() const noexcept {
+        return head_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::uint64_t tail() const noexcept {
+        return tail_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::uint64_t capacity() const noexcept { return capacity_; }
+
+    /// Bytes currently reserved (including wrap padding). Approximate while
+    /// producers are active.
+    [[nodiscard]] std::uint64_t used() const noexcept { return head() - tail(); }
+
+private:
+    // Producers hammer head_; the consumer owns tail_. Keep them on separate
+    // cache lines so release() does not bounce the producers' line.
+    alignas(64) std::atomic<std::uint64_t> head_{0};
+    alignas(64) std::atomic<std::uint64_t> tail_{0};
+    std::uint64_t                          capacity_;
+};
+
+// -------------------------------------------------------------------------------------------------
+// RingBuffer — RingAllocator over owned CPU memory.
+// -------------------------------------------------------------------------------------------------
+class RingBuffer {
+public:
+    explicit RingBuffer(std::size_t capacity,
+                        std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : ring_{capacity}
+        , upstream_{upstream}
+        , base_{static_cast<std::byte*>(upstream->allocate(capacity, k_base_alignment))}
+    {}
+
+    RingBuffer(RingBuffer const&)            = delete;
+    RingBuffer& operator=(RingBuffer const&) = delete;
+    RingBuffer(RingBuffer&&)                 = delete;
+    RingBuffer& operator=(RingBuffer&&)      = delete;
+
+    ~RingBuffer() {
+        upstream_->deallocate(base_, static_cast<std::size_t>(ring_.capacity()), k_base_alignment);
+    }
+
+    /// Thread-safe. Returns nullptr when the ring is full.
+    /// @p alignment must not exceed 64 (the alignment of the storage block).
+    [[nodiscard]] void* allocate(std::size_t size,
+                                 std::size_t alignment = alignof(std::max_align_t)) noexcept {
+        assert(alignment <= k_base_alignment);
+        auto const a = ring_.allocate(size, alignment);
+        return a ? base_ + a->offset : nullptr;
+    }
+
+    /// See RingAllocator::head() / release().
+    [[nodiscard]] std::uint64_t head() const noexcept { return ring_.head(); }
+    void release(std::uint64_t position) noexcept     { ring_.release(position); }
+
+    [[nodiscard]] RingAllocator&       allocator() noexcept       { return ring_; }
+    [[nodiscard]] RingAllocator const& allocator() const noexcept { return ring_; }
+    [[nodiscard]] std::byte*           data() const noexcept      { return base_; }
+
+private:
+    static constexpr std::size_t k_base_alignment = 64;
+
+    RingAllocator              ring_;
+    std::pmr::memory_resource* upstream_;
+    std::byte*                 base_;
+};
+
+} // namespace wren::foundation::memory
+
+#endif // WREN_FOUNDATION_MEMORY_RING_ALLOCATOR_HPP
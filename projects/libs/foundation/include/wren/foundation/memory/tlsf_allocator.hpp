@@ -0,0 +1,310 @@
+#ifndef WREN_FOUNDATION_MEMORY_TLSF_ALLOCATOR_HPP
+#define WREN_FOUNDATION_MEMORY_TLSF_ALLOCATOR_HPP
+
+// -------------------------------------------------------------------------------------------------
+// Two-level segregated fit (TLSF) offset allocation.
+//
+//   TlsfAllocator — hands out aligned [offset, offset + size) ranges of a
+//                   fixed capacity range and takes them back in any order.
+//                   Like RingAllocator it never touches memory itself; the
+//                   typical client sub-allocates one large GPU memory block.
+//
+// Free ranges are kept in 8 size classes per power of two, found through two
+// bitmaps, so allocate() and free() are O(1) regardless of how many ranges
+// exist, and neighbouring free ranges are merged immediately. The worst-case
+// waste of the class rounding is 1/8 of a request.
+//
+// Reference: M. Masmano et al., "TLSF: a New Dynamic Memory Allocator for
+// Real-Time Systems" (ECRTS 2004).
+//
+// Not thread-safe; the owner serialises access.
+// -------------------------------------------------------------------------------------------------
+
+#include <wren/foundation/memory/align.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <vector>
+
+namespace wren::foundation::memory {
+
+class TlsfAllocator {
+public:
+    /// A reserved range. Pass `node` back to free().
+    struct Allocation {
+        std::uint64_t offset; ///< Byte offset into the managed range.
+        std::uint64_t size;   ///< Requested size in bytes.
+        std::uint32_t node;   ///< Allocator-internal id of the range.
+    };
+
+    /// Manages [0, @p capacity). Throws std::bad_alloc.
+    explicit TlsfAllocator(std::uint64_t capacity)
+        : capacity_{capacity}
+    {
+        assert(capacity > 0 && capacity < (1ull << 63));
+        heads_.fill(k_null);
+        nodes_.reserve(16);
+        spare_.reserve(16);
+        nodes_.push_back(Node{.size = capacity});
+        insert_free(0);
+    }
+
+    /// Reserves @p size bytes at a multiple of @p alignment (a power of two).
+    /// Returns std::nullopt when no free range is large enough.
+    [[nodiscard]] std::optional<Allocation> allocate(std::uint64_t size,
+                                                     std::uint64_t alignment = 1) noexcept {
+        assert(is_power_of_two(alignment));
+        if (size == 0 || size > capacity_ || !reserve_spare()) {
+            return std::nullopt;
+        }
+
+        auto const fits = [&](std::uint32_t i) noexcept {
+            Node const& n = nodes_[i];
+            return align_up(n.offset, alignment) + size <= n.offset + n.size;
+        };
+
+        // Any range in the first class found is large enough for size; the
+        // alignment padding may still push it over, so retry with a request
+        // that covers the worst-case padding.
+        std::uint32_t index = find_free(size);
+        if (index != k_null && !fits(index)) {
+            index = size + (alignment - 1) <= capacity_ ? find_free(size + (alignment - 1)) : k_null;
+        }
+        if (index == k_null) {
+            return std::nullopt;
+        }
+
+        remove_free(index);
+        std::uint64_t const start = align_up(nodes_[index].offset, alignment);
+
+        // Leading padding and trailing remainder go back as free ranges. The
+        // physical neighbours of a free range are always in use, so neither
+        // needs merging.
+        if (start > nodes_[index].offset) {
+            std::uint32_t const front = take_spare();
+            nodes_[front] = Node{
+                .offset    = nodes_[index].offset,
+                .size      = start - nodes_[index].offset,
+                .prev_phys = nodes_[index].prev_phys,
+                .next_phys = index,
+            };
+            if (nodes_[front].prev_phys != k_null) {
+                nodes_[nodes_[front].prev_phys].next_phys = front;
+            }
+            nodes_[index].prev_phys = front;
+            nodes_[index].size     -= nodes_[front].size;
+            nodes_[index].offset    = start;
+            insert_free(front);
+        }
+        if (nodes_[index].size > size) {
+            std::uint32_t const back = take_spare();
+            nodes_[back] = Node{
+                .offset    = start + size,
+                .size      = nodes_[index].size - size,
+                .prev_phys = index,
+                .next_phys = nodes_[index].next_phys,
+            };
+            if (nodes_[back].next_phys != k_null) {
+                nodes_[nodes_[back].next_phys].prev_phys = back;
+            }
+            nodes_[index].next_phys = back;
+            nodes_[index].size      = size;
+            insert_free(back);
+        }
+
+        nodes_[index].used = true;
+        used_ += size;
+        ++count_;
+        return Allocation{start, size, index};
+    }
+
+    /// Returns the range of a previous allocate() and merges it with free neighbours.
+    void free(std::uint32_t node) noexcept {
+        assert(node < nodes_.size() && nodes_[node].used);
+        Node& n = nodes_[node];
+        n.used  = false;
+        used_  -= n.size;
+        --count_;
+
+        if (std::uint32_t const prev = n.prev_phys; prev != k_null && !nodes_[prev].used) {
+            remove_free(prev);
+            n.offset    = nodes_[prev].offset;
+            n.size     += nodes_[prev].size;
+            n.prev_phys = nodes_[prev].prev_phys;
+            if (n.prev_phys != k_null) {
+                nodes_[n.prev_phys].next_phys = node;
+            }
+            recycle(prev);
+        }
+        if (std::uint32_t const next = n.next_phys; next != k_null && !nodes_[next].used) {
+            remove_free(next);
+            n.size     += nodes_[next].size;
+            n.next_phys = nodes_[next].next_phys;
+            if (n.next_phys != k_null) {
+                nodes_[n.next_phys].prev_phys = node;
+            }
+            recycle(next);
+        }
+        insert_free(node);
+    }
+
+    void free(Allocation const& allocation) noexcept { free(allocation.node); }
+
+    [[nodiscard]] std::uint64_t capacity() const noexcept { return capacity_; }
+
+    /// Bytes handed out, excluding alignment padding.
+    [[nodiscard]] std::uint64_t used() const noexcept { return used_; }
+
+    [[nodiscard]] std::uint32_t allocation_count() const noexcept { return count_; }
+    [[nodiscard]] bool          empty() const noexcept { return count_ == 0; }
+
+    /// Size of the largest free range; an aligned request up to this size may
+    /// still fail.
+    [[nodiscard]] std::uint64_t largest_free_range() const noexcept {
+        if (fl_bitmap_ == 0) {
+            return 0;
+        }
+        auto const fl = static_cast<unsigned>(63 - std::countl_zero(fl_bitmap_));
+        auto const sl = static_cast<unsigned>(std::bit_width(sl_bitmap_[fl]) - 1);
+        std::uint64_t largest = 0;
+        for (std::uint32_t i = heads_[fl * k_sl_count + sl]; i != k_null; i = nodes_[i].next_free) {
+            largest = std::max(largest, nodes_[i].size);
+        }
+        return largest;
+    }
+
+private:
+    static constexpr std::uint32_t k_null      = UINT32_MAX;
+    static constexpr unsigned      k_sl_bits   = 3;
+    static constexpr unsigned      k_sl_count  = 1u << k_sl_bits;
+    static constexpr unsigned      k_fl_count  = 64 - k_sl_bits + 1;
+
+    struct Node {
+        std::uint64_t offset    = 0;
+        std::uint64_t size      = 0;
+        std::uint32_t prev_phys = k_null;  // neighbours by address
+        std::uint32_t next_phys = k_null;
+        std::uint32_t prev_free = k_null;  // size-class list, free ranges only
+        std::uint32_t next_free = k_null;
+        bool          used      = false;
+    };
+
+    struct Bin {
+        unsigned fl;
+        unsigned sl;
+    };
+
+    /// Class whose ranges all start at or below @p size: sizes below 8 map
+    /// one to one, above that the top bit picks the first level and the three
+    /// bits after it the second.
+    [[nodiscard]] static constexpr Bin bin_of(std::uint64_t size) noexcept {
+        if (size < k_sl_count) {
+            return {0, static_cast<unsigned>(size)};
+        }
+        auto const fl = static_cast<unsigned>(std::bit_width(size)) - k_sl_bits;
+        return {fl, static_cast<unsigned>(size >> (fl - 1)) & (k_sl_count - 1)};
+    }
+
+    /// First free range of a class that holds only ranges >= @p size.
+    [[nodiscard]] std::uint32_t find_free(std::uint64_t size) const noexcept {
+        if (size >= k_sl_count) {
+            auto const fl = static_cast<unsigned>(std::bit_width(size)) - k_sl_bits;
+            size += (1ull << (fl - 1)) - 1;  // round up to the next class boundary
+        }
+        auto [fl, sl] = bin_of(size);
+        if (fl >= k_fl_count) {
+            return k_null;
+        }
+
+        unsigned sl_map = sl_bitmap_[fl] & (~0u << sl);
+        if (sl_map == 0) {
+            std::uint64_t const fl_map = fl + 1 < 64 ? fl_bitmap_ & (~0ull << (fl + 1)) : 0;
+            if (fl_map == 0) {
+                return k_null;
+            }
+            fl     = static_cast<unsigned>(std::countr_zero(fl_map));
+            sl_map = sl_bitmap_[fl];
+        }
+        sl = static_cast<unsigned>(std::countr_zero(sl_map));
+        return heads_[fl * k_sl_count + sl];
+    }
+
+    void insert_free(std::uint32_t index) noexcept {
+        auto const [fl, sl] = bin_of(nodes_[index].size);
+        std::uint32_t& head = heads_[fl * k_sl_count + sl];
+        nodes_[index].prev_free = k_null;
+        nodes_[index].next_free = head;
+        if (head != k_null) {
+            nodes_[head].prev_free = index;
+        }
+        head = index;
+        sl_bitmap_[fl] |= static_cast<std::uint8_t>(1u << sl);
+        fl_bitmap_     |= 1ull << fl;
+    }
+
+    void remove_free(std::uint32_t index) noexcept {
+        Node& n = nodes_[index];
+        if (n.prev_free != k_null) {
+            nodes_[n.prev_free].next_free = n.next_free;
+        } else {
+            auto const [fl, sl] = bin_of(n.size);
+            heads_[fl * k_sl_count + sl] = n.next_free;
+            if (n.next_free == k_null) {
+                sl_bitmap_[fl] &= static_cast<std::uint8_t>(~(1u << sl));
+                if (sl_bitmap_[fl] == 0) {
+                    fl_bitmap_ &= ~(1ull << fl);
+                }
+            }
+        }
+        if (n.next_free != k_null) {
+            nodes_[n.next_free].prev_free = n.prev_free;
+        }
+        n.prev_free = k_null;
+        n.next_free = k_null;
+    }
+
+    /// An allocation splits at most one range into three, so two spare nodes
+    /// make the rest of allocate() allocation-free.
+    [[nodiscard]] bool reserve_spare() noexcept {
+        try {
+            while (spare_.size() < 2) {
+                // Capacity for every node first, so recycle() never allocates.
+                spare_.reserve(nodes_.size() + 1);
+                nodes_.emplace_back();
+                spare_.push_back(static_cast<std::uint32_t>(nodes_.size() - 1));
+            }
+        } catch (std::bad_alloc const&) {
+            return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] std::uint32_t take_spare() noexcept {
+        std::uint32_t const index = spare_.back();
+        spare_.pop_back();
+        return index;
+    }
+
+    void recycle(std::uint32_t index) noexcept {
+        nodes_[index] = Node{};
+        spare_.push_back(index);
+    }
+
+    std::uint64_t                                  capacity_;
+    std::uint64_t                                  used_  = 0;
+    std::uint32_t                                  count_ = 0;
+    std::uint64_t                                  fl_bitmap_ = 0;
+    std::array<std::uint8_t, k_fl_count>           sl_bitmap_{};
+    std::array<std::uint32_t, k_fl_count * k_sl_count> heads_{};
+    std::vector<Node>                              nodes_;
+    std::vector<std::uint32_t>                     spare_;  // recycled node ids
+};
+
+} // namespace wren::foundation::memory
+
+#endif // WREN_FOUNDATION_MEMORY_TLSF_ALLOCATOR_HPP
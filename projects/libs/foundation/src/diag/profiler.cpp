@@ -0,0 +1,500 @@
+#include <wren/foundation/diag/profiler.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace wren::foundation::diag {
+
+namespace {
+
+constexpr std::uint64_t k_instant = 0; ///< Event::end of a frame mark.
+
+static_assert((k_thread_events & (k_thread_events - 1)) == 0, "ring capacity must be a power of two");
+static_assert((k_track_spans & (k_track_spans - 1)) == 0, "ring capacity must be a power of two");
+
+// Fields are relaxed atomics so the exporter may read a slot while its owner
+// overwrites it; the ring's counters tell it which copies to keep.
+struct Event {
+    std::atomic<const char*>   name{nullptr};
+    std::atomic<std::uint64_t> begin{0};
+    std::atomic<std::uint64_t> end{0};
+};
+
+/// A thread that wrote into a buffer, from event index `first` on.
+struct ThreadOwner {
+    std::uint64_t first = 0;
+    std::uint32_t id    = 0;
+    bool          named = false;
+    char          name[k_max_diag_name]{};
+};
+
+// Single-writer ring. The owner publishes `begun` before it overwrites a slot
+// and `head` after, so a reader that finds `begun` past a slot's index plus
+// the capacity knows its copy of that slot may be torn.
+//
+// A buffer outlives its thread and passes to the next thread that attaches;
+// `owners` keeps the earlier threads' events attributed to them until they
+// are overwritten.
+struct alignas(64) ThreadBuffer {
+    std::atomic<std::uint64_t> head{0};
+    std::atomic<std::uint64_t> begun{0};
+    std::unique_ptr<Event[]>   events;
+
+    // Guarded by Registry::mutex.
+    std::vector<ThreadOwner> owners;  // ascending `first`; back() is the current thread
+    bool                     retired = false;
+};
+
+struct TrackSpan {
+    std::uint32_t track = 0;
+    std::uint64_t begin = 0;
+    std::uint64_t end   = 0;
+    char          name[k_max_diag_name]{};
+};
+
+struct Registry {
+    std::mutex                                 mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> threads;
+    std::uint32_t                              next_thread_id = 1; // tid 0 is the "Frames" track
+
+    std::vector<std::array<char, k_max_diag_name>> tracks;
+    std::unique_ptr<TrackSpan[]>                   spans;
+    std::uint64_t                                  span_head = 0;
+
+    // Clock correlation: ticks are mapped to steady_clock nanoseconds through
+    // this pair and a second reading taken at export.
+    std::uint64_t origin_ticks = detail::read_ticks();
+    std::uint64_t origin_ns    = detail::k_ticks_are_ns ? origin_ticks : now_ns();
+
+    std::atomic<std::uint64_t> cleared_ticks{0};
+};
+
+std::atomic<bool> g_enabled{true};
+
+// Deliberately leaked: threads that outlive static destruction may still
+// close zones.
+[[nodiscard]] Registry& registry() noexcept {
+    static Registry* const r = new Registry{};
+    return *r;
+}
+
+// Fast-path pointer; trivially destructible so reading it needs no TLS guard.
+thread_local ThreadBuffer* t_buffer = nullptr;
+
+// Set once the thread has handed its buffer back; zones closed by later
+// thread_local destructors are dropped.
+thread_local bool t_exited = false;
+
+// Hands the buffer back when the thread exits. Only touched on attach.
+struct ThreadBinding {
+    ThreadBuffer* buffer = nullptr;
+
+    ~ThreadBinding() {
+        if (buffer) {
+            std::lock_guard lock{registry().mutex};
+            buffer->retired = true;
+        }
+        t_buffer = nullptr;
+        t_exited = true;
+    }
+};
+
+thread_local ThreadBinding t_binding;
+
+void copy_name(char (&dst)[k_max_diag_name], std::string_view src) noexcept {
+    std::size_t const n = std::min<std::size_t>(src.size(), k_max_diag_name - 1);
+    std::memcpy(dst, src.data(), n);
+    dst[n] = '\0';
+}
+
+/// Buffer of the calling thread, attaching one on first use: a buffer whose
+/// thread has exited when there is one, a new one otherwise. nullptr when out
+/// of memory.
+[[nodiscard]] ThreadBuffer* attach_thread() noexcept {
+    if (t_buffer || t_exited) {
+        return t_buffer;
+    }
+
+    Registry& r = registry();
+    std::lock_guard lock{r.mutex};
+
+    ThreadBuffer* buffer = nullptr;
+    for (auto& b : r.threads) {
+        if (b->retired) {
+            buffer = b.get();
+            break;
+        }
+    }
+    try {
+        if (!buffer) {
+            auto fresh    = std::make_unique<ThreadBuffer>();
+            fresh->events = std::make_unique<Event[]>(k_thread_events);
+            r.threads.push_back(std::move(fresh));
+            buffer = r.threads.back().get();
+        }
+
+        // Forget owners whose events have all been overwritten.
+        std::uint64_t const head = buffer->head.load(std::memory_order_relaxed);
+        std::uint64_t const kept = head > k_thread_events ? head - k_thread_events : 0;
+        auto& owners = buffer->owners;
+        while (owners.size() > 1 && owners[1].first <= kept) {
+            owners.erase(owners.begin());
+        }
+        if (!owners.empty() && owners.back().first == head) {
+            owners.pop_back(); // the previous thread recorded nothing
+        }
+        owners.push_back(ThreadOwner{.first = head, .id = r.next_thread_id++});
+    } catch (std::bad_alloc const&) {
+        return nullptr;
+    }
+    buffer->retired = false;
+
+    t_binding.buffer = buffer;
+    t_buffer         = buffer;
+    return buffer;
+}
+
+void push(ThreadBuffer& buffer, const char* name, std::uint64_t begin, std::uint64_t end) noexcept {
+    std::uint64_t const index = buffer.head.load(std::memory_order_relaxed);
+    buffer.begun.store(index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Event& e = buffer.events[index & (k_thread_events - 1)];
+    e.name.store(name, std::memory_order_relaxed);
+    e.begin.store(begin, std::memory_order_relaxed);
+    e.end.store(end, std::memory_order_relaxed);
+    buffer.head.store(index + 1, std::memory_order_release);
+}
+
+// -----------------------------------------------------------------
+// Export helpers
+// -----------------------------------------------------------------
+
+struct CopiedEvent {
+    const char*   name;
+    std::uint64_t begin; // ticks
+    std::uint64_t end;   // ticks; k_instant for frame marks
+    std::uint32_t tid;
+};
+
+struct CopiedThread {
+    std::uint32_t id;
+    char          name[k_max_diag_name];
+};
+
+/// Maps ticks to nanoseconds after origin_ns. On the TSC path the rate comes
+/// from the whole interval since the registry was created.
+struct TickConverter {
+    std::uint64_t origin_ticks = 0;
+    double        ns_per_tick  = 1.0;
+
+    [[nodiscard]] std::int64_t operator()(std::uint64_t ticks) const noexcept {
+        auto const delta = static_cast<std::int64_t>(ticks - origin_ticks);
+        return static_cast<std::int64_t>(static_cast<double>(delta) * ns_per_tick);
+    }
+};
+
+void write_escaped(std::ostream& out, std::string_view text) {
+    out << '"';
+    for (char const c : text) {
+        switch (c) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n";  break;
+            case '\t': out << "\\t";  break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    constexpr char k_hex[] = "0123456789abcdef";
+                    out << "\\u00" << k_hex[(c >> 4) & 0xF] << k_hex[c & 0xF];
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+/// Microseconds with nanosecond decimals, the unit of "ts" and "dur".
+void write_us(std::ostream& out, std::int64_t ns) {
+    if (ns < 0) {
+        out << '-';
+        ns = -ns;
+    }
+    char buf[24];
+    auto const whole = std::to_chars(buf, buf + sizeof(buf), ns / 1000).ptr;
+    out.write(buf, whole - buf);
+
+    auto const frac = static_cast<int>(ns % 1000);
+    char const decimals[4] = {'.', static_cast<char>('0' + frac / 100),
+                              static_cast<char>('0' + frac / 10 % 10),
+                              static_cast<char>('0' + frac % 10)};
+    out.write(decimals, 4);
+}
+
+void write_metadata(std::ostream& out, bool& first, std::string_view kind, std::uint32_t pid,
+                    std::uint32_t tid, std::string_view name) {
+    out << (first ? "\n" : ",\n") << R"({"ph":"M","name":")" << kind << R"(","pid":)" << pid
+        << R"(,"tid":)" << tid << R"(,"args":{"name":)";
+    write_escaped(out, name);
+    out << "}}";
+    first = false;
+}
+
+void write_span(std::ostream& out, bool& first, std::string_view name, std::uint32_t pid,
+                std::uint32_t tid, std::int64_t begin_ns, std::int64_t end_ns) {
+    out << (first ? "\n" : ",\n") << R"({"ph":"X","name":)";
+    write_escaped(out, name);
+    out << R"(,"pid":)" << pid << R"(,"tid":)" << tid << R"(,"ts":)";
+    write_us(out, begin_ns);
+    out << R"(,"dur":)";
+    write_us(out, std::max<std::int64_t>(end_ns - begin_ns, 0));
+    out << '}';
+    first = false;
+}
+
+constexpr std::uint32_t k_cpu_pid = 1;
+constexpr std::uint32_t k_gpu_pid = 2; ///< Tracks added with add_track(); tid is the track id + 1.
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Recording
+// -------------------------------------------------------------------------------------------------
+void detail::record_zone(const char* name, std::uint64_t begin, std::uint64_t end) noexcept {
+    if (!g_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if (ThreadBuffer* buffer = t_buffer ? t_buffer : attach_thread()) {
+        push(*buffer, name, begin, end);
+    }
+}
+
+void set_enabled(bool enabled) noexcept {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool is_enabled() noexcept {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void set_thread_name(std::string_view name) noexcept {
+    ThreadBuffer* buffer = attach_thread();
+    if (!buffer) {
+        return;
+    }
+    std::lock_guard lock{registry().mutex};
+    ThreadOwner& owner = buffer->owners.back();
+    copy_name(owner.name, name);
+    owner.named = true;
+}
+
+void frame_mark(const char* name) noexcept {
+    if (!g_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if (ThreadBuffer* buffer = t_buffer ? t_buffer : attach_thread()) {
+        push(*buffer, name, detail::read_ticks(), k_instant);
+    }
+}
+
+std::uint32_t add_track(std::string_view name) noexcept {
+    Registry& r = registry();
+    std::lock_guard lock{r.mutex};
+
+    std::array<char, k_max_diag_name> key{};
+    std::memcpy(key.data(), name.data(), std::min<std::size_t>(name.size(), k_max_diag_name - 1));
+    for (std::size_t i = 0; i < r.tracks.size(); ++i) {
+        if (r.tracks[i] == key) {
+            return static_cast<std::uint32_t>(i);
+        }
+    }
+    try {
+        r.tracks.push_back(key);
+    } catch (std::bad_alloc const&) {
+        return k_invalid_track;
+    }
+    return static_cast<std::uint32_t>(r.tracks.size() - 1);
+}
+
+void add_track_span(std::uint32_t track, std::string_view name,
+                    std::uint64_t begin_ns, std::uint64_t end_ns) noexcept {
+    if (track == k_invalid_track || !g_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    Registry& r = registry();
+    std::lock_guard lock{r.mutex};
+    if (!r.spans) {
+        r.spans.reset(new (std::nothrow) TrackSpan[k_track_spans]);
+        if (!r.spans) {
+            return;
+        }
+    }
+    TrackSpan& span = r.spans[r.span_head++ & (k_track_spans - 1)];
+    span.track = track;
+    span.begin = begin_ns;
+    span.end   = end_ns;
+    copy_name(span.name, name);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Export
+// -------------------------------------------------------------------------------------------------
+void clear() noexcept {
+    Registry& r = registry();
+    std::lock_guard lock{r.mutex};
+    r.cleared_ticks.store(detail::read_ticks(), std::memory_order_relaxed);
+    r.span_head = 0;
+}
+
+bool write_chrome_trace(std::ostream& out) {
+    Registry& r = registry();
+
+    std::vector<CopiedEvent>                       events;
+    std::vector<CopiedThread>                      threads;
+    std::vector<TrackSpan>                         spans;
+    std::vector<std::array<char, k_max_diag_name>> tracks;
+    TickConverter                                  convert;
+    std::uint64_t                                  cleared_ticks = 0;
+    std::uint64_t                                  clear_ns      = 0;
+
+    {
+        std::lock_guard lock{r.mutex};
+
+        convert.origin_ticks = r.origin_ticks;
+        if constexpr (!detail::k_ticks_are_ns) {
+            std::uint64_t const ticks = detail::read_ticks();
+            std::uint64_t const ns    = now_ns();
+            if (ticks > r.origin_ticks && ns > r.origin_ns) {
+                convert.ns_per_tick = static_cast<double>(ns - r.origin_ns) /
+                                      static_cast<double>(ticks - r.origin_ticks);
+            }
+        }
+        cleared_ticks = r.cleared_ticks.load(std::memory_order_relaxed);
+        if (cleared_ticks != 0) {
+            clear_ns = static_cast<std::uint64_t>(std::max<std::int64_t>(convert(cleared_ticks), 0));
+        }
+
+        for (auto const& b : r.threads) {
+            for (ThreadOwner const& owner : b->owners) {
+                CopiedThread& t = threads.emplace_back(CopiedThread{owner.id, {}});
+                if (owner.named) {
+                    std::memcpy(t.name, owner.name, k_max_diag_name);
+                } else {
+                    std::string_view const prefix = "Thread ";
+                    char id[12];
+                    auto const end = std::to_chars(id, id + sizeof(id), owner.id).ptr;
+                    std::memcpy(t.name, prefix.data(), prefix.size());
+                    std::memcpy(t.name + prefix.size(), id, static_cast<std::size_t>(end - id));
+                    t.name[prefix.size() + static_cast<std::size_t>(end - id)] = '\0';
+                }
+            }
+
+            std::uint64_t const head  = b->head.load(std::memory_order_acquire);
+            std::uint64_t const first = head > k_thread_events ? head - k_thread_events : 0;
+            std::size_t const   start = events.size();
+            std::size_t         owner = 0;
+            for (std::uint64_t i = first; i < head; ++i) {
+                while (owner + 1 < b->owners.size() && b->owners[owner + 1].first <= i) {
+                    ++owner;
+                }
+                Event const& e = b->events[i & (k_thread_events - 1)];
+                events.push_back({e.name.load(std::memory_order_relaxed),
+                                  e.begin.load(std::memory_order_relaxed),
+                                  e.end.load(std::memory_order_relaxed), b->owners[owner].id});
+            }
+
+            // Drop the slots the owner started overwriting while we copied.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            std::uint64_t const begun = b->begun.load(std::memory_order_relaxed);
+            if (begun > first + k_thread_events) {
+                auto const torn = std::min<std::uint64_t>(begun - first - k_thread_events, head - first);
+                events.erase(events.begin() + static_cast<std::ptrdiff_t>(start),
+                             events.begin() + static_cast<std::ptrdiff_t>(start + torn));
+            }
+        }
+
+        tracks = r.tracks;
+        if (r.spans) {
+            std::uint64_t const first = r.span_head > k_track_spans ? r.span_head - k_track_spans : 0;
+            for (std::uint64_t i = first; i < r.span_head; ++i) {
+                spans.push_back(r.spans[i & (k_track_spans - 1)]);
+            }
+        }
+    }
+
+    std::uint64_t const origin_ns = r.origin_ns;
+
+    out << R"({"displayTimeUnit":"ns","traceEvents":[)";
+    bool first = true;
+
+    write_metadata(out, first, "process_name", k_cpu_pid, 0, "CPU");
+    write_metadata(out, first, "thread_name", k_cpu_pid, 0, "Frames");
+    for (CopiedThread const& t : threads) {
+        write_metadata(out, first, "thread_name", k_cpu_pid, t.id, t.name);
+    }
+    if (!tracks.empty()) {
+        write_metadata(out, first, "process_name", k_gpu_pid, 0, "GPU");
+        for (std::size_t i = 0; i < tracks.size(); ++i) {
+            write_metadata(out, first, "thread_name", k_gpu_pid, static_cast<std::uint32_t>(i + 1),
+                           tracks[i].data());
+        }
+    }
+
+    // Zones and frame marks. Marks are also collected to draw the frames.
+    std::vector<CopiedEvent> marks;
+    for (CopiedEvent const& e : events) {
+        if (!e.name) {
+            continue;
+        }
+        if (e.end == k_instant) {
+            if (e.begin < cleared_ticks) {
+                continue;
+            }
+            out << (first ? "\n" : ",\n") << R"({"ph":"i","s":"g","name":)";
+            write_escaped(out, e.name);
+            out << R"(,"pid":)" << k_cpu_pid << R"(,"tid":)" << e.tid << R"(,"ts":)";
+            write_us(out, convert(e.begin));
+            out << '}';
+            first = false;
+            marks.push_back(e);
+        } else if (e.end >= cleared_ticks) {
+            write_span(out, first, e.name, k_cpu_pid, e.tid, convert(e.begin), convert(e.end));
+        }
+    }
+
+    std::ranges::stable_sort(marks, [](CopiedEvent const& a, CopiedEvent const& b) {
+        int const order = std::strcmp(a.name, b.name);
+        return order != 0 ? order < 0 : a.begin < b.begin;
+    });
+    for (std::size_t i = 0; i + 1 < marks.size(); ++i) {
+        if (std::strcmp(marks[i].name, marks[i + 1].name) == 0) {
+            write_span(out, first, marks[i].name, k_cpu_pid, 0,
+                       convert(marks[i].begin), convert(marks[i + 1].begin));
+        }
+    }
+
+    // Imported tracks are already in steady_clock nanoseconds.
+    for (TrackSpan const& s : spans) {
+        if (s.track >= tracks.size() || s.end < clear_ns + origin_ns) {
+            continue;
+        }
+        write_span(out, first, s.name, k_gpu_pid, s.track + 1,
+                   static_cast<std::int64_t>(s.begin - origin_ns),
+                   static_cast<std::int64_t>(s.end - origin_ns));
+    }
+
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+} // namespace wren::foundation::diag
@@ -0,0 +1,487 @@
+#include <wren/foundation/jobs/job_system.hpp>
+
+#include <wren/foundation/containers/work_stealing_deque.hpp>
+#include <wren/foundation/diag/profiler.hpp>
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <charconv>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace wren::foundation::jobs {
+
+using detail::Job;
+
+namespace {
+
+constexpr std::uint32_t k_chunk_jobs       = 64;  ///< Jobs allocated per upstream request.
+constexpr std::uint32_t k_local_free_limit = 256; ///< Spill threshold of a thread's free list.
+constexpr std::uint32_t k_idle_spins       = 64;  ///< Failed searches before a worker sleeps.
+
+// Per-thread participation record. One thread belongs to at most one system.
+// `system` identifies the owning JobSystem::Impl; it is only compared.
+struct ThreadContext {
+    void const*      system  = nullptr;
+    std::uint32_t    index   = 0;
+    Job*             current = nullptr;
+    std::uint64_t    rng     = 0x9E3779B97F4A7C15ull;
+};
+
+thread_local ThreadContext t_context;
+
+[[nodiscard]] std::uint32_t next_random(ThreadContext& ctx) noexcept {
+    // xorshift64 — victim selection only needs to be cheap and decorrelated.
+    ctx.rng ^= ctx.rng << 13;
+    ctx.rng ^= ctx.rng >> 7;
+    ctx.rng ^= ctx.rng << 17;
+    return static_cast<std::uint32_t>(ctx.rng >> 32);
+}
+
+// Default profiler timeline name; on_worker_start may rename it.
+void name_worker_timeline([[maybe_unused]] std::uint32_t index) noexcept {
+#if defined(WREN_PROFILER_ENABLED) && WREN_PROFILER_ENABLED
+    char       name[24] = "Job worker ";
+    auto const end      = std::to_chars(name + 11, name + sizeof(name), index).ptr;
+    WREN_PROFILE_THREAD(std::string_view(name, static_cast<std::size_t>(end - name)));
+#endif
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Impl
+// -------------------------------------------------------------------------------------------------
+struct JobSystem::Impl {
+    struct alignas(64) Participant {
+        explicit Participant(std::size_t capacity) : deque{capacity} {}
+
+        containers::WorkStealingDeque<Job*> deque;
+        Job*                                free_list  = nullptr; // owner-thread only
+        std::uint32_t                       free_count = 0;
+    };
+
+    JobSystem&                                self;
+    JobSystemDesc                             desc;
+    std::vector<std::unique_ptr<Participant>> participants;
+    std::vector<std::thread>                  workers;
+
+    // Submissions from threads outside the system.
+    std::mutex       injection_mutex;
+    std::deque<Job*> injection;
+    std::atomic<std::uint32_t> injection_size{0};
+
+    // Shared job storage: chunks own the memory, shared_free recycles it
+    // between threads.
+    std::mutex                          pool_mutex;
+    std::vector<std::unique_ptr<Job[]>> chunks;
+    Job*                                shared_free = nullptr;
+
+    // Sleep / wake for idle workers.
+    std::atomic<std::uint32_t> wake_epoch{0};
+    std::atomic<std::uint32_t> sleepers{0};
+    std::atomic<bool>          stopping{false};
+
+    std::atomic<std::int64_t> in_flight{0};
+
+    Impl(JobSystem& owner, JobSystemDesc d)
+        : self{owner}
+        , desc{std::move(d)}
+    {}
+
+    [[nodiscard]] Participant* local() noexcept {
+        return t_context.system == this ? participants[t_context.index].get() : nullptr;
+    }
+
+    // -----------------------------------------------------------------
+    // Job storage
+    // -----------------------------------------------------------------
+    [[nodiscard]] Job* acquire_storage() {
+        Participant* p = local();
+        if (p && p->free_list) {
+            Job* job     = p->free_list;
+            p->free_list = job->next_free;
+            --p->free_count;
+            return job;
+        }
+
+        std::lock_guard lock{pool_mutex};
+        if (!shared_free) {
+            auto chunk = std::make_unique<Job[]>(k_chunk_jobs);
+            for (std::uint32_t i = 0; i < k_chunk_jobs; ++i) {
+                chunk[i].next_free = shared_free;
+                shared_free        = &chunk[i];
+            }
+            chunks.push_back(std::move(chunk));
+        }
+        Job* job    = shared_free;
+        shared_free = job->next_free;
+
+        // Refill the local cache while the lock is held anyway.
+        if (p) {
+            for (std::uint32_t i = 0; i < k_chunk_jobs / 2 && shared_free; ++i) {
+                Job* extra   = shared_free;
+                shared_free  = extra->next_free;
+                extra->next_free = p->free_list;
+                p->free_list = extra;
+                ++p->free_count;
+            }
+        }
+        return job;
+    }
+
+    void recycle_storage(Job* job) noexcept {
+        Participant* p = local();
+        if (!p) {
+            std::lock_guard lock{pool_mutex};
+            job->next_free = shared_free;
+            shared_free    = job;
+            return;
+        }
+
+        job->next_free = p->free_list;
+        p->free_list   = job;
+        if (++p->free_count <= k_local_free_limit) {
+            return;
+        }
+
+        // Jobs created on one thread and finished on another pile up on the
+        // finishing side; hand half back so creators can reuse them.
+        std::lock_guard lock{pool_mutex};
+        while (p->free_count > k_local_free_limit / 2) {
+            Job* spill   = p->free_list;
+            p->free_list = spill->next_free;
+            --p->free_count;
+            spill->next_free = shared_free;
+            shared_free      = spill;
+        }
+    }
+
+    // -----------------------------------------------------------------
+    // Scheduling
+    // -----------------------------------------------------------------
+    void enqueue(Job* job) noexcept {
+        if (Participant* p = local()) {
+            if (!p->deque.push(job)) {
+                execute(job); // deque full: run inline rather than block
+                return;
+            }
+        } else {
+            std::lock_guard lock{injection_mutex};
+            injection.push_back(job);
+            injection_size.fetch_add(1, std::memory_order_release);
+        }
+        wake_one();
+    }
+
+    void wake_one() noexcept {
+        wake_epoch.fetch_add(1, std::memory_order_seq_cst);
+        if (sleepers.load(std::memory_order_seq_cst) > 0) {
+            wake_epoch.notify_one();
+        }
+    }
+
+    void release_dependency(Job* job) noexcept {
+        if (job->dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            enqueue(job);
+        }
+    }
+
+    [[nodiscard]] Job* find_work() noexcept {
+        Participant* p = local();
+        if (p) {
+            if (auto job = p->deque.pop()) {
+                return *job;
+            }
+        }
+
+        if (injection_size.load(std::memory_order_acquire) > 0) {
+            std::unique_lock lock{injection_mutex, std::try_to_lock};
+            if (lock.owns_lock() && !injection.empty()) {
+                Job* job = injection.front();
+                injection.pop_front();
+                injection_size.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        auto const count = static_cast<std::uint32_t>(participants.size());
+        std::uint32_t const start = next_random(t_context) % count;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            Participant* victim = participants[(start + i) % count].get();
+            if (victim == p) {
+                continue;
+            }
+            if (auto job = victim->deque.steal()) {
+                return *job;
+            }
+        }
+        return nullptr;
+    }
+
+    void execute(Job* job) noexcept {
+        WREN_PROFILE_ZONE("Job");
+        Job* const outer  = t_context.current;
+        t_context.current = job;
+        job->invoke(*job);
+        t_context.current = outer;
+        finish(job);
+    }
+
+    void finish(Job* job) noexcept {
+        if (job->unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return; // the last child to finish completes this job
+        }
+        job->unfinished.notify_all();
+
+        std::uint32_t const n = job->continuation_count.load(std::memory_order_acquire);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            release_dependency(job->continuations[i]);
+        }
+
+        Job* const parent = job->parent;
+        in_flight.fetch_sub(1, std::memory_order_release);
+        self.release_job(job); // drop the in-flight reference
+        if (parent) {
+            finish(parent);
+        }
+    }
+
+    // -----------------------------------------------------------------
+    // Worker loop
+    // -----------------------------------------------------------------
+    void worker_main(std::uint32_t index) {
+        t_context = ThreadContext{this, index, nullptr, 0x9E3779B97F4A7C15ull ^ (index * 0xBF58476D1CE4E5B9ull)};
+        name_worker_timeline(index);
+        if (desc.on_worker_start) {
+            desc.on_worker_start(index);
+        }
+
+        std::uint32_t idle = 0;
+        for (;;) {
+            if (Job* job = find_work()) {
+                execute(job);
+                idle = 0;
+                continue;
+            }
+            if (stopping.load(std::memory_order_acquire)) {
+                break;
+            }
+            if (++idle < k_idle_spins) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Publish that we are about to sleep, then re-check for work so a
+            // submission racing with us is never missed (see wake_one()).
+            sleepers.fetch_add(1, std::memory_order_seq_cst);
+            std::uint32_t const epoch = wake_epoch.load(std::memory_order_seq_cst);
+            Job* job = find_work();
+            if (!job && !stopping.load(std::memory_order_acquire)) {
+                WREN_PROFILE_ZONE("Job worker sleep");
+                wake_epoch.wait(epoch, std::memory_order_seq_cst);
+            }
+            sleepers.fetch_sub(1, std::memory_order_seq_cst);
+            if (job) {
+                execute(job);
+            }
+            idle = 0;
+        }
+
+        if (desc.on_worker_stop) {
+            desc.on_worker_stop(index);
+        }
+        t_context = ThreadContext{};
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+// JobHandle
+// -------------------------------------------------------------------------------------------------
+JobHandle::JobHandle(JobHandle const& other) noexcept : job_{other.job_} {
+    if (job_) {
+        job_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+JobHandle& JobHandle::operator=(JobHandle const& other) noexcept {
+    JobHandle copy{other};
+    std::swap(job_, copy.job_);
+    return *this;
+}
+
+JobHandle& JobHandle::operator=(JobHandle&& other) noexcept {
+    JobHandle moved{std::move(other)};
+    std::swap(job_, moved.job_);
+    return *this;
+}
+
+JobHandle::~JobHandle() {
+    if (job_) {
+        job_->owner->release_job(job_);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// JobSystem lifecycle
+// -------------------------------------------------------------------------------------------------
+JobSystem::JobSystem(JobSystemDesc desc)
+    : impl_{std::make_unique<Impl>(*this, std::move(desc))}
+{
+    assert(t_context.system == nullptr && "thread already participates in a JobSystem");
+
+    std::uint32_t workers = impl_->desc.worker_count;
+    if (workers == 0) {
+        unsigned const hw = std::thread::hardware_concurrency();
+        workers = hw > 1 ? hw - 1 : 1;
+    }
+    std::size_t const capacity = std::bit_ceil(std::max<std::uint32_t>(impl_->desc.queue_capacity, 2));
+
+    impl_->participants.reserve(workers + 1);
+    for (std::uint32_t i = 0; i <= workers; ++i) {
+        impl_->participants.push_back(std::make_unique<Impl::Participant>(capacity));
+    }
+
+    t_context = ThreadContext{impl_.get(), 0, nullptr, t_context.rng};
+
+    impl_->workers.reserve(workers);
+    for (std::uint32_t i = 1; i <= workers; ++i) {
+        impl_->workers.emplace_back([this, i] { impl_->worker_main(i); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    // Drain: help until nothing is in flight.
+    while (impl_->in_flight.load(std::memory_order_acquire) > 0) {
+        if (Job* job = impl_->find_work()) {
+            impl_->execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    impl_->stopping.store(true, std::memory_order_release);
+    impl_->wake_epoch.fetch_add(1, std::memory_order_seq_cst);
+    impl_->wake_epoch.notify_all();
+    for (auto& t : impl_->workers) {
+        t.join();
+    }
+
+    if (t_context.system == impl_.get()) {
+        t_context = ThreadContext{};
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Job storage
+// -------------------------------------------------------------------------------------------------
+Job* JobSystem::allocate_job(Job* parent) {
+    Job* job = impl_->acquire_storage();
+    job->invoke    = nullptr;
+    job->owner     = this;
+    job->parent    = parent;
+    job->next_free = nullptr;
+    job->unfinished.store(1, std::memory_order_relaxed);
+    job->dependencies.store(1, std::memory_order_relaxed); // released by run()
+    job->refs.store(2, std::memory_order_relaxed);         // returned handle + in flight
+    job->continuation_count.store(0, std::memory_order_relaxed);
+
+    if (parent) {
+        assert(parent->unfinished.load(std::memory_order_relaxed) > 0);
+        parent->unfinished.fetch_add(1, std::memory_order_relaxed);
+    }
+    impl_->in_flight.fetch_add(1, std::memory_order_relaxed);
+    return job;
+}
+
+void JobSystem::discard_job(Job* job) noexcept {
+    // Payload construction failed: undo allocate_job().
+    if (job->parent) {
+        job->parent->unfinished.fetch_sub(1, std::memory_order_relaxed);
+    }
+    impl_->in_flight.fetch_sub(1, std::memory_order_relaxed);
+    impl_->recycle_storage(job);
+}
+
+void JobSystem::release_job(Job* job) noexcept {
+    if (job->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        impl_->recycle_storage(job);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Scheduling
+// -------------------------------------------------------------------------------------------------
+void JobSystem::add_continuation(JobHandle const& ancestor, JobHandle const& continuation) noexcept {
+    Job* a = ancestor.job_;
+    Job* c = continuation.job_;
+    assert(a && c && a != c);
+    assert(a->dependencies.load(std::memory_order_relaxed) > 0 && "ancestor already run");
+
+    std::uint32_t const slot = a->continuation_count.load(std::memory_order_relaxed);
+    assert(slot < detail::k_max_continuations);
+    c->dependencies.fetch_add(1, std::memory_order_relaxed);
+    a->continuations[slot] = c;
+    a->continuation_count.store(slot + 1, std::memory_order_release);
+}
+
+void JobSystem::run(JobHandle const& job) noexcept {
+    if (job.job_) {
+        impl_->release_dependency(job.job_);
+    }
+}
+
+void JobSystem::wait(JobHandle const& job) noexcept {
+    Job* const target = job.job_;
+    if (!target) {
+        return;
+    }
+
+    std::uint32_t idle = 0;
+    for (;;) {
+        std::int32_t const remaining = target->unfinished.load(std::memory_order_acquire);
+        if (remaining == 0) {
+            return;
+        }
+        if (Job* other = impl_->find_work()) {
+            impl_->execute(other);
+            idle = 0;
+        } else if (++idle < k_idle_spins) {
+            std::this_thread::yield();
+        } else {
+            // Nothing to help with: the remaining work is running elsewhere.
+            WREN_PROFILE_ZONE("Job wait");
+            target->unfinished.wait(remaining, std::memory_order_acquire);
+            idle = 0;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Queries
+// -------------------------------------------------------------------------------------------------
+std::uint32_t JobSystem::thread_count() const noexcept {
+    return static_cast<std::uint32_t>(impl_->participants.size());
+}
+
+std::optional<std::uint32_t> JobSystem::thread_index() const noexcept {
+    if (t_context.system != impl_.get()) {
+        return std::nullopt;
+    }
+    return t_context.index;
+}
+
+JobHandle JobSystem::current_job() noexcept {
+    Job* job = t_context.current;
+    if (!job) {
+        return JobHandle{};
+    }
+    job->refs.fetch_add(1, std::memory_order_relaxed);
+    return JobHandle{job};
+}
+
+} // namespace wren::foundation::jobs
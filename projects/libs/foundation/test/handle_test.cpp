@@ -0,0 +1,99 @@
+// Handle packing, null semantics and generation wrap-around, plus stale-handle
+// rejection through SlotMap once a slot's generation has wrapped.
+
+#include <wren/foundation/containers/handle.hpp>
+#include <wren/foundation/containers/slot_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <unordered_set>
+
+namespace {
+
+using namespace wren::foundation::containers;
+
+struct TestTag;
+using TestHandle = Handle<TestTag>;
+
+TEST(Handle, DefaultIsNull) {
+    TestHandle const h{};
+    EXPECT_FALSE(h.is_valid());
+    EXPECT_FALSE(static_cast<bool>(h));
+    EXPECT_EQ(h, TestHandle{});
+}
+
+TEST(Handle, PacksIndexAndGeneration) {
+    TestHandle const h = TestHandle::make(TestHandle::k_max_slots - 1, TestHandle::k_generation_mask);
+    EXPECT_TRUE(h.is_valid());
+    EXPECT_EQ(h.index(), TestHandle::k_max_slots - 1);
+    EXPECT_EQ(h.generation(), TestHandle::k_generation_mask);
+
+    TestHandle const other = TestHandle::make(h.index(), 1);
+    EXPECT_NE(h, other);
+    EXPECT_EQ(other.index(), h.index());
+}
+
+TEST(Handle, HashDistinguishesGenerations) {
+    std::unordered_set<TestHandle> set;
+    set.insert(TestHandle::make(7, 1));
+    set.insert(TestHandle::make(7, 2));
+    set.insert(TestHandle::make(8, 1));
+    EXPECT_EQ(set.size(), 3u);
+    EXPECT_TRUE(set.contains(TestHandle::make(7, 2)));
+}
+
+TEST(Handle, GenerationWrapSkipsNull) {
+    // One slot, erased and reinserted until its generation wraps past the
+    // 12-bit limit; every handle must stay valid and never reuse 0.
+    SlotMap<TestHandle, int> map;
+    TestHandle h = map.insert(0);
+    ASSERT_TRUE(h.is_valid());
+    std::uint32_t const index = h.index();
+    std::uint32_t const first = h.generation();
+
+    bool wrapped = false;
+    for (std::uint32_t i = 0; i < TestHandle::k_generation_mask + 1; ++i) {
+        std::uint32_t const previous = h.generation();
+        ASSERT_TRUE(map.erase(h));
+        h = map.insert(static_cast<int>(i));
+        ASSERT_TRUE(h.is_valid());
+        ASSERT_EQ(h.index(), index);
+        ASSERT_NE(h.generation(), 0u);
+        if (h.generation() < previous) {
+            wrapped = true;
+            EXPECT_EQ(previous, TestHandle::k_generation_mask);
+            EXPECT_EQ(h.generation(), 1u);
+        }
+    }
+    EXPECT_TRUE(wrapped);
+    // 4096 bumps over 4095 non-null generations land one past the start.
+    EXPECT_EQ(h.generation(), first % TestHandle::k_generation_mask + 1);
+}
+
+TEST(Handle, StaleHandleRejected) {
+    SlotMap<TestHandle, int> map;
+    TestHandle const stale = map.insert(1);
+    ASSERT_TRUE(map.erase(stale));
+    TestHandle const fresh = map.insert(2);
+    ASSERT_EQ(fresh.index(), stale.index());
+
+    EXPECT_FALSE(map.contains(stale));
+    EXPECT_EQ(map.get<0>(stale), nullptr);
+    EXPECT_FALSE(map.erase(stale));
+    EXPECT_FALSE(map.extract(stale).has_value());
+
+    ASSERT_TRUE(map.contains(fresh));
+    EXPECT_EQ(*map.get<0>(fresh), 2);
+    EXPECT_EQ(map.size(), 1u);
+}
+
+TEST(Handle, NullHandleRejected) {
+    SlotMap<TestHandle, int> map;
+    (void)map.insert(1);
+    EXPECT_FALSE(map.contains(TestHandle{}));
+    EXPECT_EQ(map.get<0>(TestHandle{}), nullptr);
+    EXPECT_FALSE(map.erase(TestHandle{}));
+}
+
+} // namespace
@@ -0,0 +1,207 @@
+// JobSystem scheduling: children keeping their parent open, continuations
+// ordering dependent jobs, parallel_for coverage, and submission from threads
+// outside the system.
+
+#include <wren/foundation/jobs/job_system.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace wren::foundation::jobs;
+
+[[nodiscard]] JobSystemDesc test_desc(std::uint32_t workers = 3) {
+    JobSystemDesc desc;
+    desc.worker_count = workers;
+    return desc;
+}
+
+TEST(JobSystem, ThreadCountIncludesCaller) {
+    JobSystem jobs{test_desc(3)};
+    EXPECT_EQ(jobs.thread_count(), 4u);
+    EXPECT_EQ(jobs.thread_index(), 0u);
+
+    std::optional<std::uint32_t> outside = 0;
+    std::thread([&] { outside = jobs.thread_index(); }).join();
+    EXPECT_FALSE(outside.has_value());
+}
+
+TEST(JobSystem, WorkerCallbacksRunOncePerWorker) {
+    std::atomic<std::uint32_t> started{0};
+    std::atomic<std::uint32_t> stopped{0};
+    {
+        JobSystemDesc desc = test_desc(2);
+        desc.on_worker_start = [&](std::uint32_t index) {
+            EXPECT_GE(index, 1u);
+            started.fetch_add(1);
+        };
+        desc.on_worker_stop = [&](std::uint32_t) { stopped.fetch_add(1); };
+        JobSystem jobs{std::move(desc)};
+        jobs.wait(jobs.spawn([] {}));
+    }
+    EXPECT_EQ(started.load(), 2u);
+    EXPECT_EQ(stopped.load(), 2u);
+}
+
+TEST(JobSystem, SpawnAndWait) {
+    JobSystem jobs{test_desc()};
+    std::atomic<bool> ran{false};
+    JobHandle const h = jobs.spawn([&] { ran.store(true); });
+    jobs.wait(h);
+    EXPECT_TRUE(h.is_done());
+    EXPECT_TRUE(ran.load());
+    EXPECT_TRUE(JobHandle{}.is_done());
+}
+
+TEST(JobSystem, ParentWaitsForChildren) {
+    JobSystem jobs{test_desc()};
+    constexpr std::uint32_t k_children = 64;
+    std::atomic<std::uint32_t> finished{0};
+
+    JobHandle const root = jobs.create([&] {
+        JobHandle const self = JobSystem::current_job();
+        for (std::uint32_t i = 0; i < k_children; ++i) {
+            jobs.run(jobs.create_child(self, [&] {
+                std::this_thread::yield();
+                finished.fetch_add(1);
+            }));
+        }
+    });
+    jobs.run(root);
+    jobs.wait(root);
+    EXPECT_EQ(finished.load(), k_children);
+}
+
+TEST(JobSystem, NestedChildrenKeepRootOpen) {
+    JobSystem jobs{test_desc()};
+    std::atomic<std::uint32_t> leaves{0};
+
+    JobHandle const root = jobs.create([&] {
+        JobHandle const self = JobSystem::current_job();
+        for (int i = 0; i < 8; ++i) {
+            jobs.run(jobs.create_child(self, [&] {
+                JobHandle const mid = JobSystem::current_job();
+                for (int j = 0; j < 8; ++j) {
+                    jobs.run(jobs.create_child(mid, [&] { leaves.fetch_add(1); }));
+                }
+            }));
+        }
+    });
+    jobs.run(root);
+    jobs.wait(root);
+    EXPECT_EQ(leaves.load(), 64u);
+}
+
+TEST(JobSystem, ContinuationRunsAfterAncestor) {
+    JobSystem jobs{test_desc()};
+    std::atomic<std::uint32_t> step{0};
+    std::uint32_t              seen_by_second = 0;
+
+    JobHandle const first  = jobs.create([&] { step.store(1); });
+    JobHandle const second = jobs.create([&] { seen_by_second = step.exchange(2); });
+    jobs.add_continuation(first, second);
+    // Releasing the continuation first must not let it start early.
+    jobs.run(second);
+    jobs.run(first);
+    jobs.wait(second);
+
+    EXPECT_TRUE(first.is_done());
+    EXPECT_EQ(seen_by_second, 1u);
+    EXPECT_EQ(step.load(), 2u);
+}
+
+TEST(JobSystem, ContinuationWaitsForEveryAncestor) {
+    JobSystem jobs{test_desc()};
+    constexpr std::uint32_t k_ancestors = 6;
+    std::atomic<std::uint32_t> finished{0};
+    std::uint32_t              seen = 0;
+
+    JobHandle const join = jobs.create([&] { seen = finished.load(); });
+    std::vector<JobHandle> ancestors;
+    for (std::uint32_t i = 0; i < k_ancestors; ++i) {
+        ancestors.push_back(jobs.create([&] {
+            std::this_thread::yield();
+            finished.fetch_add(1);
+        }));
+        jobs.add_continuation(ancestors.back(), join);
+    }
+    jobs.run(join);
+    for (JobHandle const& a : ancestors) {
+        jobs.run(a);
+    }
+    jobs.wait(join);
+    EXPECT_EQ(seen, k_ancestors);
+}
+
+TEST(JobSystem, ContinuationWaitsForAncestorChildren) {
+    JobSystem jobs{test_desc()};
+    std::atomic<std::uint32_t> children{0};
+    std::uint32_t              seen = 0;
+
+    JobHandle const parent = jobs.create([&] {
+        JobHandle const self = JobSystem::current_job();
+        for (int i = 0; i < 16; ++i) {
+            jobs.run(jobs.create_child(self, [&] { children.fetch_add(1); }));
+        }
+    });
+    JobHandle const after = jobs.create([&] { seen = children.load(); });
+    jobs.add_continuation(parent, after);
+    jobs.run(after);
+    jobs.run(parent);
+    jobs.wait(after);
+    EXPECT_EQ(seen, 16u);
+}
+
+TEST(JobSystem, ParallelForCoversRangeOnce) {
+    JobSystem jobs{test_desc()};
+    constexpr std::uint32_t k_count = 10'000;
+    std::vector<std::atomic<std::uint32_t>> hits(k_count);
+
+    for (std::uint32_t grain : {0u, 1u, 7u, 64u, k_count}) {
+        for (auto& h : hits) {
+            h.store(0);
+        }
+        jobs.parallel_for(0, k_count, grain, [&](std::uint32_t first, std::uint32_t last) {
+            ASSERT_LT(first, last);
+            for (std::uint32_t i = first; i < last; ++i) {
+                hits[i].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        EXPECT_TRUE(std::ranges::all_of(hits, [](auto const& h) { return h.load() == 1; }))
+            << "grain " << grain;
+    }
+}
+
+TEST(JobSystem, ParallelForEmptyRange) {
+    JobSystem jobs{test_desc()};
+    bool called = false;
+    jobs.parallel_for(5, 5, 1, [&](std::uint32_t, std::uint32_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST(JobSystem, SubmitFromForeignThread) {
+    JobSystem jobs{test_desc(2)};
+    std::atomic<std::uint32_t> ran{0};
+    std::vector<JobHandle>     handles(32);
+
+    std::thread producer([&] {
+        for (JobHandle& h : handles) {
+            h = jobs.spawn([&] { ran.fetch_add(1); });
+        }
+    });
+    producer.join();
+    for (JobHandle const& h : handles) {
+        jobs.wait(h);
+    }
+    EXPECT_EQ(ran.load(), 32u);
+}
+
+} // namespace
@@ -0,0 +1,235 @@
+// LinearArena / FrameArena bump allocation, alignment, reset and rewind,
+// exhaustion, and std::pmr containers growing through ArenaResource.
+
+#include <wren/foundation/memory/linear_arena.hpp>
+#include <wren/foundation/memory/memory_resource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace wren::foundation::memory;
+
+/// Forwards to new/delete and counts the traffic, so tests can tell whether
+/// the arena went back to its upstream.
+class CountingResource final : public std::pmr::memory_resource {
+public:
+    std::size_t allocations   = 0;
+    std::size_t deallocations = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+[[nodiscard]] bool is_aligned(void const* p, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+TEST(LinearArena, OwnsBlockFromUpstream) {
+    CountingResource upstream;
+    {
+        LinearArena arena{1024, &upstream};
+        EXPECT_EQ(upstream.allocations, 1u);
+        EXPECT_EQ(arena.capacity(), 1024u);
+        EXPECT_EQ(arena.used(), 0u);
+
+        LinearArena moved{std::move(arena)};
+        EXPECT_EQ(moved.capacity(), 1024u);
+        EXPECT_EQ(arena.data(), nullptr);
+    }
+    EXPECT_EQ(upstream.deallocations, 1u);
+}
+
+TEST(LinearArena, HonoursAlignment) {
+    LinearArena arena{4096};
+    for (std::size_t alignment : {1u, 2u, 8u, 16u, 64u, 256u, 1024u}) {
+        (void)arena.allocate(1, 1); // knock the offset off any boundary
+        void* const p = arena.allocate(8, alignment);
+        ASSERT_NE(p, nullptr) << "alignment " << alignment;
+        EXPECT_TRUE(is_aligned(p, alignment)) << "alignment " << alignment;
+        EXPECT_TRUE(arena.owns(p));
+    }
+}
+
+TEST(LinearArena, AlignsBorrowedStorageByAddress) {
+    // An odd start address: alignment is relative to the address, not to the
+    // offset inside the block.
+    alignas(64) std::array<std::byte, 256> storage{};
+    LinearArena arena{std::span<std::byte>{storage}.subspan(3)};
+    void* const p = arena.allocate(16, 32);
+    ASSERT_NE(p, nullptr);
+    EXPECT_TRUE(is_aligned(p, 32));
+    EXPECT_EQ(static_cast<std::byte*>(p), storage.data() + 32);
+    EXPECT_EQ(arena.used(), 32u - 3u + 16u);
+}
+
+TEST(LinearArena, AllocationsAreSequentialAndDisjoint) {
+    LinearArena arena{256};
+    auto* const a = static_cast<std::byte*>(arena.allocate(10, 1));
+    auto* const b = static_cast<std::byte*>(arena.allocate(10, 1));
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(b, a + 10);
+    EXPECT_EQ(arena.used(), 20u);
+    EXPECT_EQ(arena.remaining(), 236u);
+}
+
+TEST(LinearArena, ExhaustionReturnsNull) {
+    LinearArena arena{128};
+    EXPECT_NE(arena.allocate(100, 1), nullptr);
+    std::size_t const used = arena.used();
+
+    EXPECT_EQ(arena.allocate(29, 1), nullptr);
+    EXPECT_EQ(arena.used(), used) << "a failed allocation must not move the offset";
+    EXPECT_NE(arena.allocate(28, 1), nullptr);
+    EXPECT_EQ(arena.remaining(), 0u);
+    EXPECT_EQ(arena.allocate(1, 1), nullptr);
+
+    // Alignment padding past the end, sizes near SIZE_MAX and oversized
+    // arrays must fail cleanly rather than wrap.
+    LinearArena small{64};
+    (void)small.allocate(33, 1);
+    EXPECT_EQ(small.allocate(1, 64), nullptr);
+    EXPECT_EQ(small.allocate(SIZE_MAX, 1), nullptr);
+    EXPECT_EQ(small.allocate_array<std::uint64_t>(SIZE_MAX / 4), nullptr);
+    EXPECT_EQ(small.used(), 33u);
+}
+
+TEST(LinearArena, EmptyArenaReturnsNull) {
+    LinearArena arena{std::span<std::byte>{}};
+    EXPECT_EQ(arena.allocate(1, 1), nullptr);
+    EXPECT_EQ(arena.allocate_array<int>(1), nullptr);
+}
+
+TEST(LinearArena, ResetReclaimsEverything) {
+    LinearArena arena{256};
+    void* const first = arena.allocate(64);
+    (void)arena.allocate(128);
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0u);
+    EXPECT_EQ(arena.allocate(64), first);
+}
+
+TEST(LinearArena, RewindFreesOnlyLaterAllocations) {
+    LinearArena arena{256};
+    (void)arena.allocate(32);
+    LinearArena::Marker const marker = arena.mark();
+    void* const scratch = arena.allocate(64);
+    (void)arena.allocate(64);
+
+    arena.rewind(marker);
+    EXPECT_EQ(arena.used(), marker);
+    EXPECT_EQ(arena.allocate(64), scratch);
+}
+
+TEST(LinearArena, CreateAndAllocateArray) {
+    struct Point {
+        float x, y, z;
+    };
+    LinearArena arena{256};
+    Point* const p = arena.create<Point>(1.0f, 2.0f, 3.0f);
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(p->y, 2.0f);
+
+    auto* const values = arena.allocate_array<std::uint64_t>(8);
+    ASSERT_NE(values, nullptr);
+    EXPECT_TRUE(is_aligned(values, alignof(std::uint64_t)));
+    EXPECT_EQ(arena.allocate_array<std::uint64_t>(64), nullptr);
+}
+
+TEST(FrameArena, RotatesSlices) {
+    FrameArena frames{256, 3};
+    EXPECT_EQ(frames.frame_count(), 3u);
+    EXPECT_EQ(frames.frame_capacity(), 256u);
+
+    std::array<void*, 3> firsts{};
+    for (std::uint32_t f = 0; f < 3; ++f) {
+        EXPECT_EQ(frames.frame_index(), f);
+        firsts[f] = frames.allocate(200);
+        ASSERT_NE(firsts[f], nullptr);
+        EXPECT_EQ(frames.allocate(100), nullptr) << "slice " << f << " must not spill over";
+        frames.begin_frame();
+    }
+
+    // Back on slice 0: reset, same memory as three frames ago.
+    EXPECT_EQ(frames.frame_index(), 0u);
+    EXPECT_EQ(frames.used(), 0u);
+    EXPECT_EQ(frames.allocate(200), firsts[0]);
+    EXPECT_NE(firsts[0], firsts[1]);
+    EXPECT_NE(firsts[1], firsts[2]);
+}
+
+TEST(FrameArena, SlicesDoNotOverlap) {
+    FrameArena frames{128, 2};
+    auto* const a = static_cast<std::byte*>(frames.allocate(128, 1));
+    frames.begin_frame();
+    auto* const b = static_cast<std::byte*>(frames.allocate(128, 1));
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_TRUE(b >= a + 128 || a >= b + 128);
+}
+
+TEST(ArenaResource, PmrVectorGrowsOnArena) {
+    CountingResource upstream;
+    LinearArena   arena{64 * 1024, &upstream};
+    ArenaResource resource{arena};
+
+    std::pmr::vector<std::uint32_t> values{&resource};
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        values.push_back(i);
+    }
+    EXPECT_EQ(upstream.allocations, 1u) << "growth must not reach the upstream";
+    EXPECT_TRUE(arena.owns(values.data()));
+    EXPECT_GE(arena.used(), 1000 * sizeof(std::uint32_t));
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        ASSERT_EQ(values[i], i);
+    }
+}
+
+TEST(ArenaResource, NestedPmrContainersPropagate) {
+    FrameArena    frames{64 * 1024, 2};
+    ArenaResource resource{frames};
+
+    std::pmr::vector<std::pmr::string> names{&resource};
+    for (int i = 0; i < 32; ++i) {
+        names.emplace_back(std::string(40, static_cast<char>('a' + i % 26)));
+    }
+    EXPECT_TRUE(frames.current().owns(names.data()));
+    for (std::pmr::string const& name : names) {
+        EXPECT_EQ(name.get_allocator().resource(), &resource);
+        EXPECT_TRUE(frames.current().owns(name.data()));
+    }
+}
+
+TEST(ArenaResource, ExhaustionThrowsBadAlloc) {
+    LinearArena   arena{256};
+    ArenaResource resource{arena};
+    std::pmr::vector<std::byte> bytes{&resource};
+    EXPECT_THROW(bytes.resize(1024), std::bad_alloc);
+
+    std::pmr::memory_resource& base = resource;
+    EXPECT_TRUE(base.is_equal(resource));
+    ArenaResource other{arena};
+    EXPECT_FALSE(base.is_equal(other));
+}
+
+} // namespace
@@ -0,0 +1,62 @@
+// The WREN_PROFILE_* macros with WREN_PROFILER_ENABLED unset: each expands to
+// a void expression that records nothing. The profiler functions stay usable.
+
+#undef WREN_PROFILER_ENABLED
+#include <wren/foundation/diag/profiler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace {
+
+namespace diag = wren::foundation::diag;
+
+static_assert(std::is_void_v<decltype(WREN_PROFILE_ZONE("zone"))>);
+static_assert(std::is_void_v<decltype(WREN_PROFILE_FUNCTION())>);
+static_assert(std::is_void_v<decltype(WREN_PROFILE_FRAME("frame"))>);
+static_assert(std::is_void_v<decltype(WREN_PROFILE_THREAD("thread"))>);
+
+// Every argument is dropped unevaluated: none of these names exist.
+void compiled_out() {
+    WREN_PROFILE_ZONE(no_such_zone_name);
+    WREN_PROFILE_FUNCTION();
+    WREN_PROFILE_FRAME(no_such_frame_name);
+    WREN_PROFILE_THREAD(no_such_thread_name);
+}
+
+TEST(ProfilerDisabled, MacrosRecordNothing) {
+    diag::set_enabled(true);
+    diag::clear();
+
+    {
+        WREN_PROFILE_ZONE("disabled-zone");
+        WREN_PROFILE_FRAME("disabled-frame");
+        WREN_PROFILE_FRAME("disabled-frame");
+        WREN_PROFILE_THREAD("disabled-thread");
+        compiled_out();
+    }
+
+    std::ostringstream out;
+    ASSERT_TRUE(diag::write_chrome_trace(out));
+    std::string const trace = out.str();
+    EXPECT_EQ(trace.find("disabled-zone"), std::string::npos);
+    EXPECT_EQ(trace.find("disabled-frame"), std::string::npos);
+    EXPECT_EQ(trace.find("disabled-thread"), std::string::npos);
+    EXPECT_EQ(trace.find("compiled_out"), std::string::npos);
+}
+
+TEST(ProfilerDisabled, FunctionsStillRecord) {
+    diag::set_enabled(true);
+    diag::clear();
+
+    { diag::Zone const zone{"explicit-zone"}; }
+
+    std::ostringstream out;
+    ASSERT_TRUE(diag::write_chrome_trace(out));
+    EXPECT_NE(out.str().find(R"("name":"explicit-zone")"), std::string::npos);
+}
+
+} // namespace
@@ -0,0 +1,536 @@
+// Profiler recording and export: per-thread ring wrap-around, zone nesting,
+// frame spans, imported track spans and the Chrome trace-event JSON that
+// write_chrome_trace() produces. The profiler is process-wide, so every test
+// starts from clear() and only looks at the threads and tracks it owns.
+
+#include <wren/foundation/diag/profiler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+namespace diag = wren::foundation::diag;
+
+// -------------------------------------------------------------------------------------------------
+// Minimal JSON reader: validates the whole document and extracts the flat
+// fields of each trace event.
+// -------------------------------------------------------------------------------------------------
+class JsonValidator {
+public:
+    explicit JsonValidator(std::string_view text) noexcept : text_{text} {}
+
+    [[nodiscard]] bool valid() noexcept {
+        return value() && (skip_space(), pos_ == text_.size());
+    }
+
+private:
+    void skip_space() noexcept {
+        while (pos_ < text_.size() && std::string_view{" \t\r\n"}.contains(text_[pos_])) {
+            ++pos_;
+        }
+    }
+
+    [[nodiscard]] bool eat(char c) noexcept {
+        skip_space();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool string() noexcept {
+        if (!eat('"')) {
+            return false;
+        }
+        while (pos_ < text_.size()) {
+            char const c = text_[pos_++];
+            if (c == '"') {
+                return true;
+            }
+            if (static_cast<unsigned char>(c) < 0x20) {
+                return false;
+            }
+            if (c == '\\') {
+                if (pos_ >= text_.size()) {
+                    return false;
+                }
+                char const e = text_[pos_++];
+                if (e == 'u') {
+                    if (pos_ + 4 > text_.size()) {
+                        return false;
+                    }
+                    pos_ += 4;
+                } else if (!std::string_view{"\"\\/bfnrt"}.contains(e)) {
+                    return false;
+                }
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool number() noexcept {
+        skip_space();
+        double value = 0;
+        auto const [end, ec] = std::from_chars(text_.data() + pos_, text_.data() + text_.size(), value);
+        if (ec != std::errc{}) {
+            return false;
+        }
+        pos_ = static_cast<std::size_t>(end - text_.data());
+        return true;
+    }
+
+    [[nodiscard]] bool value() noexcept {
+        skip_space();
+        if (pos_ >= text_.size()) {
+            return false;
+        }
+        switch (text_[pos_]) {
+            case '{': {
+                ++pos_;
+                if (eat('}')) {
+                    return true;
+                }
+                do {
+                    if (!string() || !eat(':') || !value()) {
+                        return false;
+                    }
+                } while (eat(','));
+                return eat('}');
+            }
+            case '[': {
+                ++pos_;
+                if (eat(']')) {
+                    return true;
+                }
+                do {
+                    if (!value()) {
+                        return false;
+                    }
+                } while (eat(','));
+                return eat(']');
+            }
+            case '"':
+                return string();
+            default:
+                for (std::string_view const word : {"true", "false", "null"}) {
+                    if (text_.substr(pos_).starts_with(word)) {
+                        pos_ += word.size();
+                        return true;
+                    }
+                }
+                return number();
+        }
+    }
+
+    std::string_view text_;
+    std::size_t      pos_ = 0;
+};
+
+/// One trace event; write_chrome_trace() puts each on its own line.
+struct TraceEvent {
+    std::string ph;
+    std::string name;       // first "name"; the metadata kind for "M" events
+    std::string arg_name;   // args.name of metadata events
+    std::uint32_t pid = 0;
+    std::uint32_t tid = 0;
+    std::int64_t  ts  = 0;  // nanoseconds; the JSON holds microseconds
+    std::int64_t  dur = 0;
+    std::string   line;
+};
+
+[[nodiscard]] std::string unescape(std::string_view quoted) {
+    std::string out;
+    for (std::size_t i = 0; i < quoted.size(); ++i) {
+        if (quoted[i] != '\\') {
+            out += quoted[i];
+            continue;
+        }
+        char const e = quoted[++i];
+        switch (e) {
+            case 'n': out += '\n'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                unsigned code = 0;
+                std::from_chars(quoted.data() + i + 1, quoted.data() + i + 5, code, 16);
+                out += static_cast<char>(code);
+                i += 4;
+                break;
+            }
+            default: out += e;
+        }
+    }
+    return out;
+}
+
+/// String value following the first occurrence of @p key at or after @p from.
+[[nodiscard]] std::optional<std::string> string_field(std::string_view line, std::string_view key,
+                                                      std::size_t from = 0) {
+    std::string const needle = "\"" + std::string{key} + "\":\"";
+    std::size_t const start  = line.find(needle, from);
+    if (start == std::string_view::npos) {
+        return std::nullopt;
+    }
+    std::size_t const first = start + needle.size();
+    std::size_t       last  = first;
+    while (last < line.size() && line[last] != '"') {
+        last += line[last] == '\\' ? 2u : 1u;
+    }
+    return unescape(line.substr(first, last - first));
+}
+
+[[nodiscard]] std::uint32_t id_field(std::string_view line, std::string_view key) {
+    std::string const needle = "\"" + std::string{key} + "\":";
+    std::size_t const start  = line.find(needle);
+    std::uint32_t value = 0;
+    if (start != std::string_view::npos) {
+        std::from_chars(line.data() + start + needle.size(), line.data() + line.size(), value);
+    }
+    return value;
+}
+
+/// "ts" and "dur" are microseconds with exactly three decimals; read back as
+/// integer nanoseconds so times compare exactly.
+[[nodiscard]] std::int64_t ns_field(std::string_view line, std::string_view key) {
+    std::string const needle = "\"" + std::string{key} + "\":";
+    std::size_t const start  = line.find(needle);
+    if (start == std::string_view::npos) {
+        return 0;
+    }
+    char const* const last = line.data() + line.size();
+    char const*       it   = line.data() + start + needle.size();
+    bool const negative = *it == '-';
+    std::int64_t whole = 0;
+    std::int64_t frac  = 0;
+    it = std::from_chars(it + (negative ? 1 : 0), last, whole).ptr;
+    EXPECT_EQ(*it, '.') << line;
+    auto const [end, ec] = std::from_chars(it + 1, last, frac);
+    EXPECT_EQ(end - it, 4) << line;
+    std::int64_t const ns = whole * 1000 + frac;
+    return negative ? -ns : ns;
+}
+
+struct Trace {
+    std::string             text;
+    std::vector<TraceEvent> events;
+
+    /// Thread id whose thread_name metadata is @p name, if any. Names outlive
+    /// clear(), so the newest thread of that name wins; thread ids only grow.
+    [[nodiscard]] std::optional<std::uint32_t> tid_of(std::string_view name, std::uint32_t pid = 1) const {
+        std::optional<std::uint32_t> tid;
+        for (TraceEvent const& e : events) {
+            if (e.ph == "M" && e.name == "thread_name" && e.pid == pid && e.arg_name == name) {
+                tid = std::max(tid.value_or(0), e.tid);
+            }
+        }
+        return tid;
+    }
+
+    [[nodiscard]] std::vector<TraceEvent> spans(std::uint32_t pid, std::uint32_t tid) const {
+        std::vector<TraceEvent> out;
+        std::ranges::copy_if(events, std::back_inserter(out), [&](TraceEvent const& e) {
+            return e.ph == "X" && e.pid == pid && e.tid == tid;
+        });
+        return out;
+    }
+
+    [[nodiscard]] std::size_t count_named(std::string_view name) const {
+        return static_cast<std::size_t>(std::ranges::count_if(
+            events, [&](TraceEvent const& e) { return e.ph != "M" && e.name == name; }));
+    }
+};
+
+[[nodiscard]] Trace capture() {
+    std::ostringstream out;
+    EXPECT_TRUE(diag::write_chrome_trace(out));
+
+    Trace trace{out.str(), {}};
+    EXPECT_TRUE(JsonValidator{trace.text}.valid()) << "write_chrome_trace produced invalid JSON";
+
+    std::istringstream lines{trace.text};
+    for (std::string line; std::getline(lines, line);) {
+        if (!line.starts_with("{\"ph\"")) {
+            continue;
+        }
+        if (line.ends_with(',')) {
+            line.pop_back();
+        }
+        TraceEvent e;
+        e.ph   = string_field(line, "ph").value_or("");
+        e.name = string_field(line, "name").value_or("");
+        if (std::size_t const args = line.find("\"args\""); args != std::string::npos) {
+            e.arg_name = string_field(line, "name", args).value_or("");
+        }
+        e.pid  = id_field(line, "pid");
+        e.tid  = id_field(line, "tid");
+        if (e.ph != "M") {
+            e.ts = ns_field(line, "ts");
+        }
+        if (e.ph == "X") {
+            e.dur = ns_field(line, "dur");
+        }
+        e.line = line;
+        trace.events.push_back(std::move(e));
+    }
+    return trace;
+}
+
+/// Runs @p fn on a fresh thread named @p name.
+template<typename F>
+void on_named_thread(std::string_view name, F&& fn) {
+    std::thread([&] {
+        diag::set_thread_name(name);
+        fn();
+    }).join();
+}
+
+class Profiler : public ::testing::Test {
+protected:
+    void SetUp() override {
+        diag::set_enabled(true);
+        diag::clear();
+    }
+
+    void TearDown() override { diag::set_enabled(true); }
+};
+
+// -------------------------------------------------------------------------------------------------
+// Document
+// -------------------------------------------------------------------------------------------------
+TEST_F(Profiler, EmptyTraceIsValidJson) {
+    Trace const trace = capture();
+    EXPECT_TRUE(trace.text.starts_with(R"({"displayTimeUnit":"ns","traceEvents":[)"));
+    EXPECT_TRUE(trace.text.ends_with("\n]}\n"));
+    EXPECT_EQ(trace.events.front().line,
+              R"({"ph":"M","name":"process_name","pid":1,"tid":0,"args":{"name":"CPU"}})");
+    EXPECT_TRUE(trace.tid_of("Frames") == 0u);
+}
+
+TEST_F(Profiler, ThreadNamesAreTruncatedAndEscaped) {
+    std::string const long_name(100, 'x');
+    on_named_thread(long_name, [] { diag::Zone const z{"named-zone"}; });
+    on_named_thread("tab\tquote\"", [] { diag::Zone const z{"escaped-zone"}; });
+
+    Trace const trace = capture();
+    EXPECT_TRUE(trace.tid_of(std::string(diag::k_max_diag_name - 1, 'x')).has_value());
+    auto const escaped = trace.tid_of("tab\tquote\"");
+    ASSERT_TRUE(escaped.has_value());
+    EXPECT_NE(trace.text.find(R"("args":{"name":"tab\tquote\""}})"), std::string::npos);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Zones
+// -------------------------------------------------------------------------------------------------
+TEST_F(Profiler, NestedZonesAreContained) {
+    on_named_thread("nesting", [] {
+        diag::Zone const outer{"outer"};
+        {
+            diag::Zone const inner{"inner"};
+            diag::Zone const innermost{"innermost"};
+        }
+        diag::Zone const sibling{"sibling"};
+    });
+
+    Trace const trace = capture();
+    auto const tid = trace.tid_of("nesting");
+    ASSERT_TRUE(tid.has_value());
+    auto const spans = trace.spans(1, *tid);
+    ASSERT_EQ(spans.size(), 4u);
+
+    auto const find = [&](std::string_view name) {
+        return *std::ranges::find(spans, name, &TraceEvent::name);
+    };
+    auto const contains = [](TraceEvent const& parent, TraceEvent const& child) {
+        return child.ts >= parent.ts && child.ts + child.dur <= parent.ts + parent.dur;
+    };
+    TraceEvent const outer = find("outer");
+    EXPECT_TRUE(contains(outer, find("inner")));
+    EXPECT_TRUE(contains(find("inner"), find("innermost")));
+    EXPECT_TRUE(contains(outer, find("sibling")));
+    EXPECT_GE(find("sibling").ts, find("inner").ts + find("inner").dur);
+
+    // A zone is written when it closes: innermost first, outer last.
+    EXPECT_EQ(spans.front().name, "innermost");
+    EXPECT_EQ(spans.back().name, "outer");
+}
+
+TEST_F(Profiler, RingKeepsNewestEventsAfterWrap) {
+    constexpr std::uint32_t k_extra = 1000;
+    on_named_thread("wrapping", [] {
+        for (std::uint32_t i = 0; i < k_extra; ++i) {
+            diag::Zone const z{"overwritten"};
+        }
+        for (std::uint32_t i = 0; i < diag::k_thread_events; ++i) {
+            diag::Zone const z{"kept"};
+        }
+    });
+
+    Trace const trace = capture();
+    auto const tid = trace.tid_of("wrapping");
+    ASSERT_TRUE(tid.has_value());
+    auto const spans = trace.spans(1, *tid);
+    EXPECT_EQ(spans.size(), diag::k_thread_events);
+    EXPECT_TRUE(std::ranges::all_of(spans, [](TraceEvent const& e) { return e.name == "kept"; }));
+    EXPECT_EQ(trace.count_named("overwritten"), 0u);
+}
+
+TEST_F(Profiler, PartialWrapDropsOnlyOldest) {
+    constexpr std::uint32_t k_extra = 10;
+    on_named_thread("partial", [] {
+        for (std::uint32_t i = 0; i < diag::k_thread_events - k_extra; ++i) {
+            diag::Zone const z{"first"};
+        }
+        for (std::uint32_t i = 0; i < 2 * k_extra; ++i) {
+            diag::Zone const z{"second"};
+        }
+    });
+
+    Trace const trace = capture();
+    auto const tid = trace.tid_of("partial");
+    ASSERT_TRUE(tid.has_value());
+    auto const spans = trace.spans(1, *tid);
+    ASSERT_EQ(spans.size(), diag::k_thread_events);
+    EXPECT_EQ(std::ranges::count(spans, std::string{"first"}, &TraceEvent::name),
+              diag::k_thread_events - 2 * k_extra);
+    EXPECT_EQ(std::ranges::count(spans, std::string{"second"}, &TraceEvent::name), 2 * k_extra);
+}
+
+TEST_F(Profiler, DisabledZonesAreDropped) {
+    on_named_thread("paused", [] {
+        diag::set_enabled(false);
+        { diag::Zone const z{"while-paused"}; }
+        diag::frame_mark("paused-frame");
+        diag::set_enabled(true);
+        diag::Zone const z{"after-resume"};
+    });
+    EXPECT_TRUE(diag::is_enabled());
+
+    Trace const trace = capture();
+    EXPECT_EQ(trace.count_named("while-paused"), 0u);
+    EXPECT_EQ(trace.count_named("paused-frame"), 0u);
+    EXPECT_EQ(trace.count_named("after-resume"), 1u);
+}
+
+TEST_F(Profiler, ClearDropsEarlierEvents) {
+    on_named_thread("before-clear", [] { diag::Zone const z{"stale"}; });
+    diag::clear();
+    on_named_thread("after-clear", [] { diag::Zone const z{"fresh"}; });
+
+    Trace const trace = capture();
+    EXPECT_EQ(trace.count_named("stale"), 0u);
+    EXPECT_EQ(trace.count_named("fresh"), 1u);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Frames
+// -------------------------------------------------------------------------------------------------
+TEST_F(Profiler, FrameMarksBecomeFrameSpans) {
+    on_named_thread("frames", [] {
+        for (int i = 0; i < 4; ++i) {
+            diag::frame_mark("TestFrame");
+            diag::Zone const z{"frame-work"};
+        }
+    });
+
+    Trace const trace = capture();
+    auto const instants = std::ranges::count_if(trace.events, [](TraceEvent const& e) {
+        return e.ph == "i" && e.name == "TestFrame";
+    });
+    EXPECT_EQ(instants, 4);
+
+    // Three spans between four marks, on the "Frames" track, back to back.
+    std::vector<TraceEvent> frames = trace.spans(1, 0);
+    std::erase_if(frames, [](TraceEvent const& e) { return e.name != "TestFrame"; });
+    ASSERT_EQ(frames.size(), 3u);
+    for (std::size_t i = 1; i < frames.size(); ++i) {
+        EXPECT_EQ(frames[i - 1].ts + frames[i - 1].dur, frames[i].ts);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Tracks
+// -------------------------------------------------------------------------------------------------
+TEST_F(Profiler, AddTrackReturnsExistingId) {
+    std::uint32_t const a = diag::add_track("test-track-a");
+    std::uint32_t const b = diag::add_track("test-track-b");
+    ASSERT_NE(a, diag::k_invalid_track);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(diag::add_track("test-track-a"), a);
+}
+
+TEST_F(Profiler, TrackSpansKeepTheirTimes) {
+    std::uint32_t const track = diag::add_track("test-gpu-queue");
+    std::uint64_t const base  = diag::now_ns();
+    diag::add_track_span(track, "pass", base + 1'000'000, base + 2'234'567);
+    diag::add_track_span(track, "nested", base + 1'500'000, base + 1'600'000);
+    diag::add_track_span(diag::k_invalid_track, "ignored", base, base + 1);
+
+    Trace const trace = capture();
+    auto const tid = trace.tid_of("test-gpu-queue", 2);
+    ASSERT_TRUE(tid.has_value());
+    EXPECT_EQ(*tid, track + 1);
+    EXPECT_TRUE(std::ranges::any_of(trace.events, [](TraceEvent const& e) {
+        return e.line == R"({"ph":"M","name":"process_name","pid":2,"tid":0,"args":{"name":"GPU"}})";
+    }));
+
+    auto const spans = trace.spans(2, *tid);
+    ASSERT_EQ(spans.size(), 2u);
+    EXPECT_EQ(spans[0].name, "pass");
+    EXPECT_TRUE(spans[0].line.ends_with(R"(,"dur":1234.567})")) << spans[0].line;
+    EXPECT_TRUE(spans[1].line.ends_with(R"(,"dur":100.000})")) << spans[1].line;
+    EXPECT_EQ(spans[0].dur, 1'234'567);
+    EXPECT_EQ(spans[1].ts - spans[0].ts, 500'000);
+    EXPECT_EQ(trace.count_named("ignored"), 0u);
+}
+
+TEST_F(Profiler, TrackSpanNamesAreEscaped) {
+    std::uint32_t const track = diag::add_track("test-escape");
+    std::uint64_t const base  = diag::now_ns();
+    diag::add_track_span(track, "quote\"back\\slash\nnl\x01", base, base + 1'000);
+
+    Trace const trace = capture();
+    auto const spans = trace.spans(2, track + 1);
+    ASSERT_EQ(spans.size(), 1u);
+    EXPECT_TRUE(spans[0].line.starts_with(
+        R"({"ph":"X","name":"quote\"back\\slash\nnl\u0001","pid":2,"tid":)" + std::to_string(track + 1)))
+        << spans[0].line;
+    EXPECT_EQ(spans[0].name, "quote\"back\\slash\nnl\x01");
+}
+
+TEST_F(Profiler, TrackSpanRingKeepsNewest) {
+    std::uint32_t const track = diag::add_track("test-span-ring");
+    std::uint64_t const base  = diag::now_ns();
+    for (std::uint32_t i = 0; i < diag::k_track_spans + 16; ++i) {
+        diag::add_track_span(track, i < 16 ? "old-span" : "new-span", base + i, base + i + 1);
+    }
+
+    Trace const trace = capture();
+    EXPECT_EQ(trace.spans(2, track + 1).size(), diag::k_track_spans);
+    EXPECT_EQ(trace.count_named("old-span"), 0u);
+}
+
+#if defined(WREN_PROFILER_ENABLED) && WREN_PROFILER_ENABLED
+TEST_F(Profiler, MacrosRecordWhenEnabled) {
+    on_named_thread("macros", [] {
+        WREN_PROFILE_ZONE("macro-zone");
+        WREN_PROFILE_FRAME("macro-frame");
+    });
+
+    Trace const trace = capture();
+    EXPECT_EQ(trace.count_named("macro-zone"), 1u);
+    EXPECT_EQ(trace.count_named("macro-frame"), 1u);
+}
+#endif
+
+} // namespace
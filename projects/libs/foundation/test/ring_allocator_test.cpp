@@ -0,0 +1,173 @@
+// RingAllocator reservation, wrap-around padding and in-order release, plus
+// RingBuffer pointer translation and concurrent producers.
+
+#include <wren/foundation/memory/ring_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace wren::foundation::memory;
+
+TEST(RingAllocator, AllocatesContiguously) {
+    RingAllocator ring{1024};
+    auto const a = ring.allocate(100, 4);
+    auto const b = ring.allocate(28, 4);
+    ASSERT_TRUE(a && b);
+    EXPECT_EQ(a->offset, 0u);
+    EXPECT_EQ(a->end, 100u);
+    EXPECT_EQ(b->offset, 100u);
+    EXPECT_EQ(b->end, 128u);
+    EXPECT_EQ(ring.used(), 128u);
+    EXPECT_EQ(ring.head(), 128u);
+}
+
+TEST(RingAllocator, HonoursAlignment) {
+    RingAllocator ring{4096};
+    (void)ring.allocate(3, 1);
+    auto const a = ring.allocate(16, 256);
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a->offset % 256, 0u);
+    EXPECT_EQ(a->offset, 256u);
+}
+
+TEST(RingAllocator, RejectsInvalidSizes) {
+    RingAllocator ring{256};
+    EXPECT_FALSE(ring.allocate(0));
+    EXPECT_FALSE(ring.allocate(257));
+    EXPECT_TRUE(ring.allocate(256));
+}
+
+TEST(RingAllocator, FullUntilReleased) {
+    RingAllocator ring{256};
+    auto const a = ring.allocate(128);
+    auto const b = ring.allocate(128);
+    ASSERT_TRUE(a && b);
+    EXPECT_FALSE(ring.allocate(16));
+
+    ring.release(a->end);
+    EXPECT_EQ(ring.used(), 128u);
+    auto const c = ring.allocate(64);
+    ASSERT_TRUE(c);
+    EXPECT_EQ(c->offset, 0u);
+    EXPECT_EQ(c->end, 320u);
+}
+
+TEST(RingAllocator, WrapSkipsTailPadding) {
+    RingAllocator ring{256};
+    auto const a = ring.allocate(200);
+    ASSERT_TRUE(a);
+    ring.release(a->end);
+
+    // 100 bytes do not fit in the 56 left before the wrap point: the request
+    // moves to offset 0 and the padding counts as used.
+    auto const b = ring.allocate(100);
+    ASSERT_TRUE(b);
+    EXPECT_EQ(b->offset, 0u);
+    EXPECT_EQ(b->end, 356u);
+    EXPECT_EQ(ring.used(), 156u);
+
+    // Releasing past the allocation reclaims the padding with it.
+    ring.release(b->end);
+    EXPECT_EQ(ring.used(), 0u);
+    auto const c = ring.allocate(144);
+    ASSERT_TRUE(c);
+    EXPECT_EQ(c->offset, 112u);
+    EXPECT_EQ(c->offset + c->size, ring.capacity());
+}
+
+TEST(RingAllocator, WrapWaitsForTail) {
+    RingAllocator ring{256};
+    auto const a = ring.allocate(128);
+    auto const b = ring.allocate(96);
+    ASSERT_TRUE(a && b);
+    ring.release(a->end);
+
+    // 64 bytes would straddle the end; after skipping the 32-byte tail it
+    // lands on [0, 64), still inside a's released range.
+    auto const c = ring.allocate(64);
+    ASSERT_TRUE(c);
+    EXPECT_EQ(c->offset, 0u);
+
+    // Another 96 would overlap b, which has not been released yet.
+    EXPECT_FALSE(ring.allocate(96));
+    ring.release(b->end);
+    EXPECT_TRUE(ring.allocate(96));
+}
+
+TEST(RingAllocator, ManyLapsNeverStraddleEnd) {
+    RingAllocator ring{1000};
+    std::uint64_t released = 0;
+    for (std::uint64_t i = 0; i < 10'000; ++i) {
+        std::uint64_t const size = 1 + (i * 37) % 300;
+        auto a = ring.allocate(size, 8);
+        if (!a) {
+            ring.release(ring.head());
+            released = ring.head();
+            a = ring.allocate(size, 8);
+        }
+        ASSERT_TRUE(a);
+        EXPECT_EQ(a->offset % 8, 0u);
+        EXPECT_LE(a->offset + a->size, ring.capacity());
+        EXPECT_LE(ring.used(), ring.capacity());
+    }
+    EXPECT_GT(released, ring.capacity());
+}
+
+TEST(RingBuffer, PointersStayInsideStorage) {
+    RingBuffer buffer{512};
+    std::byte* const base = buffer.data();
+    void* const a = buffer.allocate(100, 16);
+    void* const b = buffer.allocate(100, 64);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(static_cast<std::byte*>(a), base);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 64, 0u);
+    EXPECT_EQ(buffer.allocate(512), nullptr);
+    buffer.release(buffer.head());
+    // head() is 228; aligned to 16 the rest of the lap is exactly 272 bytes.
+    EXPECT_EQ(buffer.allocate(272), base + 240);
+}
+
+TEST(RingAllocator, ConcurrentProducersGetDisjointRanges) {
+    constexpr std::uint64_t k_capacity   = 1 << 20;
+    constexpr int           k_producers  = 4;
+    constexpr int           k_per_thread = 2000;
+
+    RingAllocator ring{k_capacity};
+    std::mutex    mutex;
+    std::vector<RingAllocator::Allocation> all;
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < k_producers; ++t) {
+        producers.emplace_back([&, t] {
+            std::vector<RingAllocator::Allocation> local;
+            for (int i = 0; i < k_per_thread; ++i) {
+                auto const size = static_cast<std::uint64_t>(16 + (i + t) % 48);
+                if (auto const a = ring.allocate(size, 16)) {
+                    local.push_back(*a);
+                }
+            }
+            std::lock_guard lock{mutex};
+            all.insert(all.end(), local.begin(), local.end());
+        });
+    }
+    for (std::thread& p : producers) {
+        p.join();
+    }
+
+    ASSERT_EQ(all.size(), static_cast<std::size_t>(k_producers * k_per_thread));
+    std::ranges::sort(all, {}, &RingAllocator::Allocation::offset);
+    for (std::size_t i = 1; i < all.size(); ++i) {
+        EXPECT_LE(all[i - 1].offset + all[i - 1].size, all[i].offset);
+    }
+}
+
+} // namespace
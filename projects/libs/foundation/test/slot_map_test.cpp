@@ -0,0 +1,159 @@
+// SlotMap insertion, erase and reinsertion, checking that every SoA column and
+// the dense handle array stay aligned through swap-removal.
+
+#include <wren/foundation/containers/handle.hpp>
+#include <wren/foundation/containers/slot_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using namespace wren::foundation::containers;
+
+struct ItemTag;
+using ItemHandle = Handle<ItemTag>;
+using ItemMap    = SlotMap<ItemHandle, std::uint32_t, std::string, float>;
+
+/// Every dense row must describe the same element in every column, and the
+/// handle stored for the row must resolve back to that row.
+void expect_aligned(ItemMap const& map) {
+    auto const handles = map.handles();
+    auto const ids     = map.column<0>();
+    auto const names   = map.column<1>();
+    auto const weights = map.column<2>();
+    ASSERT_EQ(handles.size(), map.size());
+    ASSERT_EQ(ids.size(), map.size());
+    ASSERT_EQ(names.size(), map.size());
+    ASSERT_EQ(weights.size(), map.size());
+
+    for (std::size_t i = 0; i < map.size(); ++i) {
+        EXPECT_EQ(map.dense_index(handles[i]), i);
+        EXPECT_EQ(names[i], std::to_string(ids[i]));
+        EXPECT_EQ(weights[i], static_cast<float>(ids[i]));
+    }
+}
+
+[[nodiscard]] ItemHandle insert_item(ItemMap& map, std::uint32_t id) {
+    return map.insert(id, std::to_string(id), static_cast<float>(id));
+}
+
+TEST(SlotMap, InsertAndGet) {
+    ItemMap map;
+    EXPECT_TRUE(map.empty());
+    ItemHandle const a = insert_item(map, 10);
+    ItemHandle const b = insert_item(map, 20);
+    ASSERT_TRUE(a.is_valid());
+    ASSERT_TRUE(b.is_valid());
+    EXPECT_NE(a, b);
+    EXPECT_EQ(map.size(), 2u);
+
+    EXPECT_EQ(*map.get<0>(a), 10u);
+    EXPECT_EQ(*map.get<1>(b), "20");
+    EXPECT_EQ(*map.get<2>(b), 20.0f);
+    expect_aligned(map);
+}
+
+TEST(SlotMap, EraseSwapsLastIntoHole) {
+    ItemMap map;
+    ItemHandle const a = insert_item(map, 1);
+    ItemHandle const b = insert_item(map, 2);
+    ItemHandle const c = insert_item(map, 3);
+
+    ASSERT_TRUE(map.erase(a));
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_FALSE(map.contains(a));
+    // c moved into the hole a left; its handle must follow it.
+    EXPECT_EQ(map.dense_index(c), 0u);
+    EXPECT_EQ(*map.get<1>(c), "3");
+    EXPECT_EQ(*map.get<0>(b), 2u);
+    expect_aligned(map);
+}
+
+TEST(SlotMap, ExtractReturnsAllColumns) {
+    ItemMap map;
+    ItemHandle const a = insert_item(map, 5);
+    (void)insert_item(map, 6);
+
+    auto const value = map.extract(a);
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(std::get<0>(*value), 5u);
+    EXPECT_EQ(std::get<1>(*value), "5");
+    EXPECT_EQ(std::get<2>(*value), 5.0f);
+    EXPECT_FALSE(map.contains(a));
+    expect_aligned(map);
+}
+
+TEST(SlotMap, ReinsertReusesSlotWithNewGeneration) {
+    ItemMap map;
+    ItemHandle const a = insert_item(map, 1);
+    ASSERT_TRUE(map.erase(a));
+    ItemHandle const b = insert_item(map, 2);
+
+    EXPECT_EQ(b.index(), a.index());
+    EXPECT_NE(b.generation(), a.generation());
+    EXPECT_FALSE(map.contains(a));
+    EXPECT_EQ(*map.get<0>(b), 2u);
+}
+
+TEST(SlotMap, ClearInvalidatesEveryHandle) {
+    ItemMap map;
+    std::vector<ItemHandle> handles;
+    for (std::uint32_t i = 0; i < 16; ++i) {
+        handles.push_back(insert_item(map, i));
+    }
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    for (ItemHandle const h : handles) {
+        EXPECT_FALSE(map.contains(h));
+    }
+    expect_aligned(map);
+}
+
+TEST(SlotMap, RandomEraseReinsertKeepsColumnsAligned) {
+    ItemMap map;
+    map.reserve(256);
+    std::unordered_map<std::uint32_t, ItemHandle> live;
+    std::vector<ItemHandle>                       dead;
+    std::mt19937                                  rng{1234};
+    std::uint32_t                                 next_id = 0;
+
+    for (int step = 0; step < 20000; ++step) {
+        bool const grow = live.empty() || (live.size() < 256 && rng() % 2 == 0);
+        if (grow) {
+            std::uint32_t const id = next_id++;
+            ItemHandle const    h  = insert_item(map, id);
+            ASSERT_TRUE(h.is_valid());
+            live.emplace(id, h);
+        } else {
+            auto it = live.begin();
+            std::advance(it, static_cast<std::ptrdiff_t>(rng() % live.size()));
+            ASSERT_TRUE(map.erase(it->second));
+            dead.push_back(it->second);
+            live.erase(it);
+        }
+        if (step % 1000 == 0) {
+            expect_aligned(map);
+        }
+    }
+
+    ASSERT_EQ(map.size(), live.size());
+    expect_aligned(map);
+    for (auto const& [id, h] : live) {
+        ASSERT_NE(map.get<0>(h), nullptr);
+        EXPECT_EQ(*map.get<0>(h), id);
+    }
+    // Slots are recycled FIFO across 256 slots, so no erased handle has had
+    // its generation wrap back around yet.
+    for (ItemHandle const h : dead) {
+        EXPECT_FALSE(map.contains(h));
+    }
+}
+
+} // namespace
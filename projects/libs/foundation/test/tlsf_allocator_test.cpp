@@ -0,0 +1,186 @@
+// TlsfAllocator splitting and coalescing, alignment, exhaustion, and a
+// randomized alloc/free run checking that live ranges never overlap.
+
+#include <wren/foundation/memory/tlsf_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace wren::foundation::memory;
+
+TEST(TlsfAllocator, StartsAsOneFreeRange) {
+    TlsfAllocator tlsf{1 << 20};
+    EXPECT_TRUE(tlsf.empty());
+    EXPECT_EQ(tlsf.used(), 0u);
+    EXPECT_EQ(tlsf.largest_free_range(), 1u << 20);
+
+    auto const a = tlsf.allocate(1 << 20);
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a->offset, 0u);
+    EXPECT_EQ(tlsf.largest_free_range(), 0u);
+}
+
+TEST(TlsfAllocator, RejectsInvalidSizes) {
+    TlsfAllocator tlsf{1024};
+    EXPECT_FALSE(tlsf.allocate(0));
+    EXPECT_FALSE(tlsf.allocate(1025));
+    EXPECT_TRUE(tlsf.empty());
+}
+
+TEST(TlsfAllocator, SplitLeavesRemainderFree) {
+    TlsfAllocator tlsf{4096};
+    auto const a = tlsf.allocate(1000);
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a->offset, 0u);
+    EXPECT_EQ(tlsf.used(), 1000u);
+    EXPECT_EQ(tlsf.largest_free_range(), 3096u);
+
+    // Requests are rounded up to their size class, so the remainder serves
+    // anything at or below the class boundary beneath it (3072 here).
+    EXPECT_FALSE(tlsf.allocate(3096));
+    auto const b = tlsf.allocate(3072);
+    ASSERT_TRUE(b);
+    EXPECT_EQ(b->offset, 1000u);
+    EXPECT_EQ(tlsf.allocation_count(), 2u);
+}
+
+TEST(TlsfAllocator, FreeMergesBothNeighbours) {
+    TlsfAllocator tlsf{3072};
+    auto const a = tlsf.allocate(1024);
+    auto const b = tlsf.allocate(1024);
+    auto const c = tlsf.allocate(1024);
+    ASSERT_TRUE(a && b && c);
+    EXPECT_FALSE(tlsf.allocate(1));
+
+    // a and c are free but separated by b: no range larger than 1024.
+    tlsf.free(*a);
+    tlsf.free(*c);
+    EXPECT_EQ(tlsf.largest_free_range(), 1024u);
+    EXPECT_FALSE(tlsf.allocate(2048));
+
+    // Freeing b merges with the range on either side.
+    tlsf.free(*b);
+    EXPECT_TRUE(tlsf.empty());
+    EXPECT_EQ(tlsf.largest_free_range(), 3072u);
+    auto const all = tlsf.allocate(3072);
+    ASSERT_TRUE(all);
+    EXPECT_EQ(all->offset, 0u);
+}
+
+TEST(TlsfAllocator, FreeMergesInEitherOrder) {
+    for (int order = 0; order < 2; ++order) {
+        TlsfAllocator tlsf{2048};
+        auto const a = tlsf.allocate(1024);
+        auto const b = tlsf.allocate(1024);
+        ASSERT_TRUE(a && b);
+        tlsf.free(order == 0 ? *a : *b);
+        tlsf.free(order == 0 ? *b : *a);
+        EXPECT_EQ(tlsf.largest_free_range(), 2048u) << "order " << order;
+    }
+}
+
+TEST(TlsfAllocator, HonoursAlignment) {
+    TlsfAllocator tlsf{1 << 20};
+    (void)tlsf.allocate(3);
+    for (std::uint64_t alignment : {2u, 16u, 256u, 4096u, 65536u}) {
+        auto const a = tlsf.allocate(100, alignment);
+        ASSERT_TRUE(a) << "alignment " << alignment;
+        EXPECT_EQ(a->offset % alignment, 0u) << "alignment " << alignment;
+        (void)tlsf.allocate(1); // leave the next free range misaligned
+    }
+}
+
+TEST(TlsfAllocator, AlignmentPaddingIsReclaimed) {
+    // b ends exactly at the capacity, so the only free range is its padding.
+    TlsfAllocator tlsf{4096 + 64};
+    auto const a = tlsf.allocate(1);
+    auto const b = tlsf.allocate(64, 4096);
+    ASSERT_TRUE(a && b);
+    EXPECT_EQ(b->offset, 4096u);
+    // The 4095 bytes of padding in front of b are their own free range.
+    auto const c = tlsf.allocate(3584);
+    ASSERT_TRUE(c);
+    EXPECT_EQ(c->offset, 1u);
+
+    tlsf.free(*a);
+    tlsf.free(*b);
+    tlsf.free(*c);
+    EXPECT_EQ(tlsf.largest_free_range(), 4096u + 64u);
+}
+
+TEST(TlsfAllocator, ExhaustionReturnsNullopt) {
+    TlsfAllocator tlsf{64 * 256};
+    std::vector<TlsfAllocator::Allocation> blocks;
+    while (auto const a = tlsf.allocate(256)) {
+        blocks.push_back(*a);
+    }
+    EXPECT_EQ(blocks.size(), 64u);
+    EXPECT_EQ(tlsf.used(), tlsf.capacity());
+    EXPECT_FALSE(tlsf.allocate(1));
+
+    tlsf.free(blocks[17]);
+    EXPECT_FALSE(tlsf.allocate(257));
+    auto const again = tlsf.allocate(256);
+    ASSERT_TRUE(again);
+    EXPECT_EQ(again->offset, blocks[17].offset);
+}
+
+TEST(TlsfAllocator, RandomizedBlocksNeverOverlap) {
+    constexpr std::uint64_t k_capacity = 1 << 24;
+
+    TlsfAllocator tlsf{k_capacity};
+    std::map<std::uint64_t, TlsfAllocator::Allocation> live; // keyed by offset
+    std::mt19937_64                                    rng{42};
+    std::uint64_t                                      live_bytes = 0;
+    std::size_t                                        failures   = 0;
+
+    for (int step = 0; step < 50'000; ++step) {
+        if (live.empty() || rng() % 3 != 0) {
+            std::uint64_t const size      = 1 + rng() % ((rng() % 8 == 0) ? 1'000'000 : 4096);
+            std::uint64_t const alignment = 1ull << (rng() % 13);
+            auto const a = tlsf.allocate(size, alignment);
+            if (!a) {
+                ++failures;
+                continue;
+            }
+            ASSERT_EQ(a->offset % alignment, 0u);
+            ASSERT_LE(a->offset + a->size, k_capacity);
+
+            auto const next = live.lower_bound(a->offset);
+            if (next != live.end()) {
+                ASSERT_LE(a->offset + a->size, next->second.offset) << "overlaps the next block";
+            }
+            if (next != live.begin()) {
+                auto const& prev = std::prev(next)->second;
+                ASSERT_LE(prev.offset + prev.size, a->offset) << "overlaps the previous block";
+            }
+            live.emplace(a->offset, *a);
+            live_bytes += a->size;
+        } else {
+            auto it = live.begin();
+            std::advance(it, static_cast<std::ptrdiff_t>(rng() % live.size()));
+            live_bytes -= it->second.size;
+            tlsf.free(it->second);
+            live.erase(it);
+        }
+        ASSERT_EQ(tlsf.used(), live_bytes);
+        ASSERT_EQ(tlsf.allocation_count(), live.size());
+    }
+    EXPECT_GT(failures, 0u) << "the run should have exercised exhaustion";
+
+    for (auto const& [offset, a] : live) {
+        tlsf.free(a);
+    }
+    EXPECT_TRUE(tlsf.empty());
+    EXPECT_EQ(tlsf.largest_free_range(), k_capacity) << "every range must have merged back";
+}
+
+} // namespace
@@ -0,0 +1,109 @@
+// WorkStealingDeque ordering, capacity limits, and a contended run where the
+// owner pushes and pops while thieves steal: every item must be taken exactly
+// once.
+
+#include <wren/foundation/containers/work_stealing_deque.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace wren::foundation::containers;
+
+TEST(WorkStealingDeque, OwnerPopIsLifo) {
+    WorkStealingDeque<std::uint32_t> deque{8};
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(deque.push(i));
+    }
+    EXPECT_EQ(deque.size_approx(), 4u);
+    for (std::uint32_t i = 4; i-- > 0;) {
+        auto const item = deque.pop();
+        ASSERT_TRUE(item.has_value());
+        EXPECT_EQ(*item, i);
+    }
+    EXPECT_FALSE(deque.pop().has_value());
+    EXPECT_TRUE(deque.empty_approx());
+}
+
+TEST(WorkStealingDeque, StealIsFifo) {
+    WorkStealingDeque<std::uint32_t> deque{8};
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(deque.push(i));
+    }
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        auto const item = deque.steal();
+        ASSERT_TRUE(item.has_value());
+        EXPECT_EQ(*item, i);
+    }
+    EXPECT_FALSE(deque.steal().has_value());
+}
+
+TEST(WorkStealingDeque, PushFailsWhenFull) {
+    WorkStealingDeque<std::uint32_t> deque{4};
+    ASSERT_EQ(deque.capacity(), 4u);
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(deque.push(i));
+    }
+    EXPECT_FALSE(deque.push(4));
+
+    // Room freed at either end is reusable as the indices wrap.
+    ASSERT_TRUE(deque.steal().has_value());
+    EXPECT_TRUE(deque.push(4));
+    EXPECT_FALSE(deque.push(5));
+    EXPECT_EQ(deque.pop(), 4u);
+}
+
+TEST(WorkStealingDeque, ContendedItemsTakenExactlyOnce) {
+    constexpr std::uint32_t k_items   = 200'000;
+    constexpr std::size_t   k_thieves = 4;
+
+    WorkStealingDeque<std::uint32_t> deque{256};
+    std::vector<std::atomic<std::uint32_t>> taken(k_items);
+    std::atomic<bool>                       done{false};
+
+    std::vector<std::thread> thieves;
+    for (std::size_t t = 0; t < k_thieves; ++t) {
+        thieves.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire) || !deque.empty_approx()) {
+                if (auto const item = deque.steal()) {
+                    taken[*item].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    // The owner interleaves pushes with pops so both ends race on the last
+    // element, then drains whatever the thieves leave behind.
+    for (std::uint32_t i = 0; i < k_items; ++i) {
+        while (!deque.push(i)) {
+            if (auto const item = deque.pop()) {
+                taken[*item].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if (i % 3 == 0) {
+            if (auto const item = deque.pop()) {
+                taken[*item].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    while (auto const item = deque.pop()) {
+        taken[*item].fetch_add(1, std::memory_order_relaxed);
+    }
+    done.store(true, std::memory_order_release);
+    for (std::thread& thief : thieves) {
+        thief.join();
+    }
+
+    std::size_t const wrong = static_cast<std::size_t>(std::count_if(
+        taken.begin(), taken.end(), [](std::atomic<std::uint32_t> const& n) { return n.load() != 1; }));
+    EXPECT_EQ(wrong, 0u);
+}
+
+} // namespace
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <wren/platform/export.hpp>
+
+
+namespace wren::platform {
+
+    /// What a window event reports.
+    enum class event_type : std::uint8_t {
+        key,              ///< code: GLFW key, scancode: platform scancode, action, mods.
+        character,        ///< code: Unicode code point.
+        mouse_button,     ///< code: button index, action, mods.
+        cursor_moved,     ///< x, y: cursor position in screen coordinates.
+        scroll,           ///< x, y: scroll offsets.
+        resized,          ///< x, y: new framebuffer size in pixels.
+        focus,            ///< action: 1 focused, 0 lost.
+        close_requested,  ///< The user asked to close the window.
+        refresh,          ///< The contents must be redrawn (expose).
+    };
+
+    /// One window event, timestamped when the event loop received it.
+    struct event {
+        event_type    type     = event_type::refresh;
+        std::uint8_t  action   = 0;  ///< 0 release, 1 press, 2 repeat.
+        std::uint16_t mods     = 0;  ///< GLFW_MOD_* bits.
+        std::int32_t  code     = 0;
+        std::int32_t  scancode = 0;
+        double        x        = 0.0;
+        double        y        = 0.0;
+        std::chrono::steady_clock::time_point time{};
+    };
+
+    /// Thread-safe queue of window events. The event loop pushes from the
+    /// thread that pumps the window; any other thread — typically one
+    /// dedicated to input — drains it in batches.
+    ///
+    /// Consecutive cursor moves are coalesced into the latest one, and once
+    /// @p capacity events are waiting further events are dropped and counted,
+    /// so a stalled consumer bounds memory instead of growing it.
+    class WREN_PLATFORM_EXPORT event_queue {
+    public:
+        explicit event_queue(std::size_t capacity = 4096);
+
+        event_queue(event_queue const&)                    = delete;
+        auto operator=(event_queue const&) -> event_queue& = delete;
+
+        void push(event const& e) noexcept;
+
+        /// Moves every waiting event to the end of @p out; returns how many.
+        auto drain(std::vector<event>& out) -> std::size_t;
+
+        /// drain(), blocking until an event arrives, @p timeout passes or the
+        /// queue is closed.
+        auto wait_drain(std::vector<event>& out, std::chrono::nanoseconds timeout) -> std::size_t;
+
+        /// Wakes every waiter for good: wait_drain() no longer blocks.
+        void close() noexcept;
+
+        [[nodiscard]] auto closed() const noexcept -> bool;
+
+        /// Events dropped because the queue was full.
+        [[nodiscard]] auto dropped() const noexcept -> std::uint64_t;
+
+    private:
+        auto take(std::vector<event>& out) -> std::size_t;  // caller holds _mutex
+
+        mutable std::mutex      _mutex;
+        std::condition_variable _ready;
+        std::vector<event>      _events;
+        std::size_t             _capacity;
+        std::uint64_t           _dropped = 0;
+        bool                    _closed  = false;
+    };
+
+} // namespace wren::platform
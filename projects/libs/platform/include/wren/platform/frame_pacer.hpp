@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+
+#include <wren/platform/export.hpp>
+
+
+namespace wren::platform {
+
+    /// Caps a render loop at a target rate by sleeping until each frame's
+    /// deadline. Meant for present modes that do not block (mailbox,
+    /// immediate), which otherwise render as fast as the GPU allows.
+    ///
+    /// Deadlines advance by one period per frame, so a late frame is made up
+    /// by a shorter sleep next time; a frame more than one period late
+    /// restarts the cadence instead of bursting to catch up.
+    class WREN_PLATFORM_EXPORT frame_pacer {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        /// @p rate_hz <= 0 disables pacing: wait() returns at once.
+        explicit frame_pacer(double rate_hz) noexcept;
+
+        void set_rate(double rate_hz) noexcept;
+
+        /// Sleeps until the next deadline; returns how long it slept.
+        auto wait() noexcept -> clock::duration;
+
+        /// The arithmetic of wait() without the clock: advances the cadence
+        /// for a frame that ended at @p now and returns the time to sleep
+        /// until, @p now itself when no sleep is due.
+        auto schedule(clock::time_point now) noexcept -> clock::time_point;
+
+        /// Forgets the cadence, e.g. after the loop idled: the next wait()
+        /// does not sleep.
+        void reset() noexcept;
+
+        [[nodiscard]] auto period() const noexcept -> clock::duration { return _period; }
+
+    private:
+        clock::duration   _period{};
+        clock::time_point _next{};
+    };
+
+} // namespace wren::platform
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <span>
+#include <system_error>
+
+#include <wren/platform/export.hpp>
+
+
+namespace wren::platform {
+
+    /// Read-only memory mapping of a whole file. Pages are faulted in on
+    /// first touch, so opening a large cache costs nothing until its bytes
+    /// are read, and the data is never copied through a user-space buffer.
+    class WREN_PLATFORM_EXPORT mapped_file {
+    public:
+        /// Maps @p path for reading. An empty file yields an empty mapping.
+        [[nodiscard]]
+        static auto open(std::filesystem::path const& path) noexcept
+            -> std::expected<mapped_file, std::error_code>;
+
+        mapped_file() noexcept = default;
+        ~mapped_file();
+
+        mapped_file(mapped_file&& other) noexcept;
+        auto operator=(mapped_file&& other) noexcept -> mapped_file&;
+
+        mapped_file(mapped_file const&) = delete;
+        auto operator=(mapped_file const&) -> mapped_file& = delete;
+
+        [[nodiscard]] auto bytes() const noexcept -> std::span<std::byte const> { return {_data, _size}; }
+        [[nodiscard]] auto size() const noexcept -> std::size_t { return _size; }
+        [[nodiscard]] auto empty() const noexcept -> bool { return _size == 0; }
+
+    private:
+        mapped_file(std::byte const* data, std::size_t size) noexcept;
+
+        void unmap() noexcept;
+
+        std::byte const* _data = nullptr;
+        std::size_t      _size = 0;
+    };
+
+    /// Replaces @p path with @p data through a temporary sibling and a
+    /// rename, so a crash or a concurrent reader never sees a partial file.
+    /// Missing parent directories are created.
+    [[nodiscard]]
+    WREN_PLATFORM_EXPORT auto write_file_atomic(std::filesystem::path const& path,
+                                                std::span<std::byte const> data) noexcept -> std::error_code;
+
+} // namespace wren::platform
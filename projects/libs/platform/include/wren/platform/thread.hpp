@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include <wren/platform/export.hpp>
+
+
+namespace wren::platform {
+
+    /// Number of logical cores the process may run on (at least 1).
+    [[nodiscard]]
+    WREN_PLATFORM_EXPORT auto logical_core_count() noexcept -> std::uint32_t;
+
+    /// Restricts the calling thread to logical core @p core.
+    /// Returns false when the OS refused or does not support hard affinity
+    /// (Apple platforms only offer affinity hints).
+    WREN_PLATFORM_EXPORT auto set_current_thread_affinity(std::uint32_t core) noexcept -> bool;
+
+    /// Names the calling thread for debuggers and profilers. Linux truncates
+    /// names to 15 characters.
+    WREN_PLATFORM_EXPORT auto set_current_thread_name(std::string_view name) noexcept -> bool;
+
+} // namespace wren::platform
@@ -1,13 +1,39 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <string_view>
 
+#include <wren/platform/events.hpp>
 #include <wren/platform/export.hpp>
 
 
 struct GLFWwindow; // Opaque forward declaration
 
 namespace wren::platform {
+
+    /// The window system behind a native_window_handle.
+    enum class window_system : std::uint8_t {
+        none,     ///< No handle for this platform (e.g. macOS, which needs a CAMetalLayer).
+        win32,    ///< display: HINSTANCE, window: HWND.
+        x11,      ///< display: Display*,  window: the X11 Window id cast to void*.
+        wayland,  ///< display: wl_display*, window: wl_surface*.
+    };
+
+    /// What a graphics API needs to create a surface for a window.
+    struct native_window_handle {
+        window_system system  = window_system::none;
+        void*         display = nullptr;
+        void*         window  = nullptr;
+    };
+
+    /// Framebuffer size in pixels; zero while the window is minimised.
+    struct framebuffer_extent {
+        std::uint32_t width  = 0;
+        std::uint32_t height = 0;
+    };
+
     class WREN_PLATFORM_EXPORT window  {
     public:
 
@@ -28,11 +54,45 @@ namespace wren::platform {
         [[nodiscard]]
         auto should_close() const noexcept -> bool;
 
+        /// Processes pending events and returns at once. Main thread only,
+        /// like every GLFW event function.
         void poll_events() noexcept;
 
+        /// Sleeps until at least one event arrives, then processes it.
+        void wait_events() noexcept;
+
+        /// wait_events(), returning after @p timeout even if nothing arrived.
+        /// An idle viewer should wait here instead of spinning on
+        /// poll_events().
+        void wait_events_timeout(std::chrono::duration<double> timeout) noexcept;
+
+        /// Wakes the main thread out of wait_events*(). Any thread.
+        static void post_empty_event() noexcept;
+
+        /// Flags the window for closing, as the close button would. Any thread;
+        /// pair with post_empty_event() to wake a waiting main thread.
+        void request_close() noexcept;
+
+        /// Refresh rate of the monitor the window is fullscreen on, else of
+        /// the primary monitor; 60 Hz when neither reports one.
+        [[nodiscard]]
+        auto refresh_rate() const noexcept -> double;
+
+        /// Events received by poll_events() / wait_events*(), for another
+        /// thread to drain. Stable across moves of the window.
+        [[nodiscard]]
+        auto events() noexcept -> event_queue&;
+
+        [[nodiscard]]
+        auto native_handle() const noexcept -> native_window_handle;
+
+        [[nodiscard]]
+        auto framebuffer_size() const noexcept -> framebuffer_extent;
+
     private:
         static inline bool _system_initialized = false;
-        GLFWwindow *_window;
+        GLFWwindow *_window = nullptr;
+        std::unique_ptr<event_queue> _events;
 
         void release();
     };
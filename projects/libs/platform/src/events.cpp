@@ -0,0 +1,65 @@
+#include <wren/platform/events.hpp>
+
+
+namespace wren::platform {
+
+    event_queue::event_queue(const std::size_t capacity) : _capacity(capacity) {
+        _events.reserve(capacity);
+    }
+
+    void event_queue::push(event const& e) noexcept {
+        {
+            const std::scoped_lock lock{_mutex};
+            if (e.type == event_type::cursor_moved && !_events.empty()
+                && _events.back().type == event_type::cursor_moved) {
+                _events.back() = e;
+                return;
+            }
+            if (_events.size() >= _capacity) {
+                ++_dropped;
+                return;
+            }
+            // Within the reserved capacity: does not allocate.
+            _events.push_back(e);
+        }
+        _ready.notify_one();
+    }
+
+    auto event_queue::drain(std::vector<event>& out) -> std::size_t {
+        const std::scoped_lock lock{_mutex};
+        return take(out);
+    }
+
+    auto event_queue::wait_drain(std::vector<event>& out, const std::chrono::nanoseconds timeout)
+        -> std::size_t {
+        std::unique_lock lock{_mutex};
+        _ready.wait_for(lock, timeout, [this] { return _closed || !_events.empty(); });
+        return take(out);
+    }
+
+    void event_queue::close() noexcept {
+        {
+            const std::scoped_lock lock{_mutex};
+            _closed = true;
+        }
+        _ready.notify_all();
+    }
+
+    auto event_queue::closed() const noexcept -> bool {
+        const std::scoped_lock lock{_mutex};
+        return _closed;
+    }
+
+    auto event_queue::dropped() const noexcept -> std::uint64_t {
+        const std::scoped_lock lock{_mutex};
+        return _dropped;
+    }
+
+    auto event_queue::take(std::vector<event>& out) -> std::size_t {
+        const std::size_t count = _events.size();
+        out.insert(out.end(), _events.begin(), _events.end());
+        _events.clear();
+        return count;
+    }
+
+} // namespace wren::platform
@@ -0,0 +1,51 @@
+#include <wren/platform/frame_pacer.hpp>
+
+#include <algorithm>
+#include <thread>
+
+
+namespace wren::platform {
+
+    frame_pacer::frame_pacer(const double rate_hz) noexcept {
+        set_rate(rate_hz);
+    }
+
+    void frame_pacer::set_rate(const double rate_hz) noexcept {
+        _period = rate_hz > 0.0
+            ? std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>{1.0 / rate_hz})
+            : clock::duration::zero();
+        reset();
+    }
+
+    auto frame_pacer::wait() noexcept -> clock::duration {
+        if (_period == clock::duration::zero()) {
+            return clock::duration::zero();
+        }
+
+        const auto now      = clock::now();
+        const auto deadline = schedule(now);
+        if (deadline <= now) {
+            return clock::duration::zero();
+        }
+        std::this_thread::sleep_until(deadline);
+        return clock::now() - now;
+    }
+
+    auto frame_pacer::schedule(const clock::time_point now) noexcept -> clock::time_point {
+        if (_period == clock::duration::zero()) {
+            return now;
+        }
+        if (_next == clock::time_point{} || now > _next + _period) {
+            _next = now + _period;
+            return now;
+        }
+        const auto deadline = std::max(now, _next);
+        _next += _period;
+        return deadline;
+    }
+
+    void frame_pacer::reset() noexcept {
+        _next = {};
+    }
+
+} // namespace wren::platform
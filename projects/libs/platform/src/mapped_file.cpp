@@ -0,0 +1,181 @@
+#include <wren/platform/mapped_file.hpp>
+
+#include <wren/foundation/system/platform.hpp>
+
+#include <fstream>
+#include <new>
+#include <utility>
+
+#if defined(WREN_PLATFORM_WINDOWS)
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#elif defined(WREN_PLATFORM_POSIX)
+#   include <cerrno>
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+
+namespace wren::platform {
+
+    namespace {
+
+        [[nodiscard]]
+        auto last_error() noexcept -> std::error_code {
+#if defined(WREN_PLATFORM_WINDOWS)
+            return {static_cast<int>(::GetLastError()), std::system_category()};
+#else
+            return {errno, std::generic_category()};
+#endif
+        }
+
+    } // anonymous namespace
+
+    auto mapped_file::open(std::filesystem::path const& path) noexcept
+        -> std::expected<mapped_file, std::error_code>
+    {
+#if defined(WREN_PLATFORM_WINDOWS)
+        HANDLE const file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                          nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return std::unexpected{last_error()};
+        }
+
+        LARGE_INTEGER size{};
+        if (!::GetFileSizeEx(file, &size)) {
+            auto const err = last_error();
+            ::CloseHandle(file);
+            return std::unexpected{err};
+        }
+        if (size.QuadPart == 0) {
+            ::CloseHandle(file);
+            return mapped_file{};
+        }
+
+        // The view keeps the mapping object and the file alive on its own.
+        HANDLE const mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        auto const   err     = last_error();
+        ::CloseHandle(file);
+        if (!mapping) {
+            return std::unexpected{err};
+        }
+
+        void const* view     = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        auto const  view_err = last_error();
+        ::CloseHandle(mapping);
+        if (!view) {
+            return std::unexpected{view_err};
+        }
+        return mapped_file{static_cast<std::byte const*>(view), static_cast<std::size_t>(size.QuadPart)};
+
+#elif defined(WREN_PLATFORM_POSIX)
+        int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return std::unexpected{last_error()};
+        }
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            auto const err = last_error();
+            ::close(fd);
+            return std::unexpected{err};
+        }
+        if (st.st_size == 0) {
+            ::close(fd);
+            return mapped_file{};
+        }
+
+        auto const size = static_cast<std::size_t>(st.st_size);
+        void*      data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        auto const err  = last_error();
+        ::close(fd); // the mapping holds its own reference
+        if (data == MAP_FAILED) {
+            return std::unexpected{err};
+        }
+        return mapped_file{static_cast<std::byte const*>(data), size};
+
+#else
+        (void)path;
+        return std::unexpected{std::make_error_code(std::errc::function_not_supported)};
+#endif
+    }
+
+    mapped_file::mapped_file(std::byte const* data, std::size_t size) noexcept
+        : _data{data}
+        , _size{size}
+    {}
+
+    mapped_file::~mapped_file() {
+        unmap();
+    }
+
+    mapped_file::mapped_file(mapped_file&& other) noexcept
+        : _data{std::exchange(other._data, nullptr)}
+        , _size{std::exchange(other._size, 0)}
+    {}
+
+    auto mapped_file::operator=(mapped_file&& other) noexcept -> mapped_file& {
+        if (this != &other) {
+            unmap();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+
+    void mapped_file::unmap() noexcept {
+        if (!_data) {
+            return;
+        }
+#if defined(WREN_PLATFORM_WINDOWS)
+        ::UnmapViewOfFile(_data);
+#elif defined(WREN_PLATFORM_POSIX)
+        ::munmap(const_cast<std::byte*>(_data), _size);
+#endif
+        _data = nullptr;
+        _size = 0;
+    }
+
+    auto write_file_atomic(std::filesystem::path const& path,
+                           std::span<std::byte const> data) noexcept -> std::error_code {
+        std::error_code ec;
+        try {
+            if (path.has_parent_path()) {
+                std::filesystem::create_directories(path.parent_path(), ec);
+                if (ec) {
+                    return ec;
+                }
+            }
+
+            std::filesystem::path tmp = path;
+            tmp += ".tmp";
+            {
+                std::ofstream out{tmp, std::ios::binary | std::ios::trunc};
+                out.write(reinterpret_cast<char const*>(data.data()), static_cast<std::streamsize>(data.size()));
+                out.close();
+                if (!out) {
+                    std::filesystem::remove(tmp, ec);
+                    return std::make_error_code(std::errc::io_error);
+                }
+            }
+
+            // rename() replaces the target in one step on every supported platform.
+            std::filesystem::rename(tmp, path, ec);
+            if (ec) {
+                std::error_code ignored;
+                std::filesystem::remove(tmp, ignored);
+            }
+        } catch (std::bad_alloc const&) {
+            return std::make_error_code(std::errc::not_enough_memory);
+        }
+        return ec;
+    }
+
+} // namespace wren::platform
@@ -0,0 +1,79 @@
+#include <wren/platform/thread.hpp>
+
+#include <wren/foundation/system/platform.hpp>
+
+#include <algorithm>
+#include <array>
+#include <thread>
+
+#if defined(WREN_PLATFORM_WINDOWS)
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#elif defined(WREN_PLATFORM_POSIX)
+#   include <pthread.h>
+#   if defined(WREN_PLATFORM_LINUX) || defined(WREN_PLATFORM_ANDROID)
+#       include <sched.h>
+#   endif
+#endif
+
+
+namespace wren::platform {
+
+    auto logical_core_count() noexcept -> std::uint32_t {
+#if defined(WREN_PLATFORM_LINUX) || defined(WREN_PLATFORM_ANDROID)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+            return static_cast<std::uint32_t>(std::max(1, CPU_COUNT(&set)));
+        }
+#endif
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    auto set_current_thread_affinity(const std::uint32_t core) noexcept -> bool {
+#if defined(WREN_PLATFORM_WINDOWS)
+        if (core >= sizeof(DWORD_PTR) * 8) {
+            return false;
+        }
+        return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR{1} << core) != 0;
+#elif defined(WREN_PLATFORM_LINUX) || defined(WREN_PLATFORM_ANDROID)
+        if (core >= CPU_SETSIZE) {
+            return false;
+        }
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core, &set);
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+        static_cast<void>(core);
+        return false;
+#endif
+    }
+
+    auto set_current_thread_name(const std::string_view name) noexcept -> bool {
+#if defined(WREN_PLATFORM_WINDOWS)
+        std::array<wchar_t, 64> wide{};
+        const auto count = std::min(name.size(), wide.size() - 1);
+        std::copy_n(name.begin(), count, wide.begin()); // thread names are ASCII in practice
+        return SUCCEEDED(SetThreadDescription(GetCurrentThread(), wide.data()));
+#elif defined(WREN_PLATFORM_POSIX)
+        std::array<char, 16> buffer{}; // pthread limit incl. terminator on Linux
+        const auto count = std::min(name.size(), buffer.size() - 1);
+        std::copy_n(name.begin(), count, buffer.begin());
+#   if defined(WREN_PLATFORM_APPLE)
+        return pthread_setname_np(buffer.data()) == 0;
+#   else
+        return pthread_setname_np(pthread_self(), buffer.data()) == 0;
+#   endif
+#else
+        static_cast<void>(name);
+        return false;
+#endif
+    }
+
+} // namespace wren::platform
@@ -1,31 +1,118 @@
 #include <wren/platform/window.hpp>
 
+#include <cstdint>
 #include <stdexcept>
+#include <utility>
 
 #include <GLFW/glfw3.h>
 
+#if defined(_WIN32)
+#  define GLFW_EXPOSE_NATIVE_WIN32
+#elif defined(__linux__)
+#  define GLFW_EXPOSE_NATIVE_X11
+#  if WREN_PLATFORM_WAYLAND
+#    define GLFW_EXPOSE_NATIVE_WAYLAND
+#  endif
+#endif
+#if defined(GLFW_EXPOSE_NATIVE_WIN32) || defined(GLFW_EXPOSE_NATIVE_X11)
+#  include <GLFW/glfw3native.h>
+#endif
+
 
 namespace wren::platform {
 
-    window::window(int width, int height, const std::string_view title) {
+    namespace {
+
+        // The queue lives behind the GLFW user pointer so that callbacks
+        // find it without the window object, which may have moved.
+        void enqueue(GLFWwindow* handle, event e) noexcept {
+            if (auto* queue = static_cast<event_queue*>(glfwGetWindowUserPointer(handle))) {
+                e.time = std::chrono::steady_clock::now();
+                queue->push(e);
+            }
+        }
+
+        void on_key(GLFWwindow* handle, int key, int scancode, int action, int mods) {
+            enqueue(handle, {.type     = event_type::key,
+                             .action   = static_cast<std::uint8_t>(action),
+                             .mods     = static_cast<std::uint16_t>(mods),
+                             .code     = key,
+                             .scancode = scancode});
+        }
+
+        void on_char(GLFWwindow* handle, unsigned int codepoint) {
+            enqueue(handle, {.type = event_type::character, .code = static_cast<std::int32_t>(codepoint)});
+        }
+
+        void on_mouse_button(GLFWwindow* handle, int button, int action, int mods) {
+            enqueue(handle, {.type   = event_type::mouse_button,
+                             .action = static_cast<std::uint8_t>(action),
+                             .mods   = static_cast<std::uint16_t>(mods),
+                             .code   = button});
+        }
+
+        void on_cursor_pos(GLFWwindow* handle, double x, double y) {
+            enqueue(handle, {.type = event_type::cursor_moved, .x = x, .y = y});
+        }
+
+        void on_scroll(GLFWwindow* handle, double x, double y) {
+            enqueue(handle, {.type = event_type::scroll, .x = x, .y = y});
+        }
+
+        void on_framebuffer_size(GLFWwindow* handle, int width, int height) {
+            enqueue(handle, {.type = event_type::resized,
+                             .x    = static_cast<double>(width),
+                             .y    = static_cast<double>(height)});
+        }
+
+        void on_focus(GLFWwindow* handle, int focused) {
+            enqueue(handle, {.type = event_type::focus, .action = static_cast<std::uint8_t>(focused)});
+        }
+
+        void on_close(GLFWwindow* handle) {
+            enqueue(handle, {.type = event_type::close_requested});
+        }
+
+        void on_refresh(GLFWwindow* handle) {
+            enqueue(handle, {.type = event_type::refresh});
+        }
+
+    } // namespace
+
+    window::window(int width, int height, const std::string_view title)
+        : _events(std::make_unique<event_queue>()) {
         glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
         _window = glfwCreateWindow(width, height, title.data(), nullptr, nullptr);
-    }
+        if (_window == nullptr) {
+            throw std::runtime_error("Failed to create window");
+        }
 
-    window::window(window&& other) noexcept : _window(other._window) {
-        other._window = nullptr;
+        glfwSetWindowUserPointer(_window, _events.get());
+        glfwSetKeyCallback(_window, on_key);
+        glfwSetCharCallback(_window, on_char);
+        glfwSetMouseButtonCallback(_window, on_mouse_button);
+        glfwSetCursorPosCallback(_window, on_cursor_pos);
+        glfwSetScrollCallback(_window, on_scroll);
+        glfwSetFramebufferSizeCallback(_window, on_framebuffer_size);
+        glfwSetWindowFocusCallback(_window, on_focus);
+        glfwSetWindowCloseCallback(_window, on_close);
+        glfwSetWindowRefreshCallback(_window, on_refresh);
     }
 
+    window::window(window&& other) noexcept
+        : _window(std::exchange(other._window, nullptr)), _events(std::move(other._events)) {}
+
     auto window::operator=(window&& other) noexcept -> window& {
         if (this != &other) {
             release();
             std::swap(_window, other._window);
+            std::swap(_events, other._events);
         }
         return *this;
     }
 
     window::~window() {
-        glfwDestroyWindow(_window);
+        release();
     }
 
     void window::init_system() {
@@ -54,15 +141,76 @@ namespace wren::platform {
     }
 
     auto window::should_close() const noexcept -> bool {
-        return glfwWindowShouldClose(_window) == 0;
+        return glfwWindowShouldClose(_window) != 0;
     }
 
     void window::release() {
         glfwDestroyWindow(_window);
+        _window = nullptr;
     }
 
     void window::poll_events() noexcept {
         glfwPollEvents();
     }
 
+    void window::wait_events() noexcept {
+        glfwWaitEvents();
+    }
+
+    void window::wait_events_timeout(const std::chrono::duration<double> timeout) noexcept {
+        if (timeout.count() <= 0.0) {
+            glfwPollEvents();
+            return;
+        }
+        glfwWaitEventsTimeout(timeout.count());
+    }
+
+    void window::post_empty_event() noexcept {
+        glfwPostEmptyEvent();
+    }
+
+    void window::request_close() noexcept {
+        glfwSetWindowShouldClose(_window, GLFW_TRUE);
+    }
+
+    auto window::refresh_rate() const noexcept -> double {
+        GLFWmonitor* monitor = glfwGetWindowMonitor(_window);
+        if (monitor == nullptr) {
+            monitor = glfwGetPrimaryMonitor();
+        }
+        if (monitor != nullptr) {
+            if (const GLFWvidmode* mode = glfwGetVideoMode(monitor); mode != nullptr && mode->refreshRate > 0) {
+                return static_cast<double>(mode->refreshRate);
+            }
+        }
+        return 60.0;
+    }
+
+    auto window::events() noexcept -> event_queue& {
+        return *_events;
+    }
+
+    auto window::native_handle() const noexcept -> native_window_handle {
+#if defined(GLFW_EXPOSE_NATIVE_WIN32)
+        return {window_system::win32, GetModuleHandleW(nullptr), glfwGetWin32Window(_window)};
+#elif defined(GLFW_EXPOSE_NATIVE_X11)
+#  if defined(GLFW_EXPOSE_NATIVE_WAYLAND)
+        if (glfwGetPlatform() == GLFW_PLATFORM_WAYLAND) {
+            return {window_system::wayland, glfwGetWaylandDisplay(), glfwGetWaylandWindow(_window)};
+        }
+#  endif
+        return {window_system::x11, glfwGetX11Display(),
+                reinterpret_cast<void*>(static_cast<std::uintptr_t>(glfwGetX11Window(_window)))};
+#else
+        return {};
+#endif
+    }
+
+    auto window::framebuffer_size() const noexcept -> framebuffer_extent {
+        int width  = 0;
+        int height = 0;
+        glfwGetFramebufferSize(_window, &width, &height);
+        return {static_cast<std::uint32_t>(width), static_cast<std::uint32_t>(height)};
+    }
+
 } // namespace wren::platform
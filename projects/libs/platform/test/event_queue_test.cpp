@@ -0,0 +1,171 @@
+// event_queue: FIFO order, cursor-move coalescing, the capacity bound, and
+// per-producer ordering while several threads push and one drains.
+
+#include <wren/platform/events.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+    using namespace wren::platform;
+    using namespace std::chrono_literals;
+
+    [[nodiscard]] auto key(const std::int32_t code, const std::int32_t scancode = 0) -> event {
+        return event{.type = event_type::key, .action = 1, .code = code, .scancode = scancode};
+    }
+
+    [[nodiscard]] auto cursor(const double x, const double y) -> event {
+        return event{.type = event_type::cursor_moved, .x = x, .y = y};
+    }
+
+    TEST(EventQueue, DrainsInPushOrder) {
+        event_queue queue{16};
+        for (std::int32_t i = 0; i < 5; ++i) {
+            queue.push(key(i));
+        }
+
+        std::vector<event> out{key(-1)};
+        EXPECT_EQ(queue.drain(out), 5u);
+        ASSERT_EQ(out.size(), 6u);
+        EXPECT_EQ(out.front().code, -1); // appended, not replaced
+        for (std::int32_t i = 0; i < 5; ++i) {
+            EXPECT_EQ(out[static_cast<std::size_t>(i) + 1].code, i);
+        }
+        EXPECT_EQ(queue.drain(out), 0u);
+    }
+
+    TEST(EventQueue, CoalescesConsecutiveCursorMoves) {
+        event_queue queue{16};
+        queue.push(cursor(1, 1));
+        queue.push(cursor(2, 2));
+        queue.push(cursor(3, 3));
+        queue.push(key(7));
+        queue.push(cursor(4, 4));
+        queue.push(cursor(5, 5));
+
+        std::vector<event> out;
+        ASSERT_EQ(queue.drain(out), 3u);
+        EXPECT_EQ(out[0].type, event_type::cursor_moved);
+        EXPECT_EQ(out[0].x, 3.0);
+        EXPECT_EQ(out[1].code, 7);
+        EXPECT_EQ(out[2].x, 5.0);
+
+        // A drain ends the run: the next move is not merged into a drained one.
+        queue.push(cursor(6, 6));
+        EXPECT_EQ(queue.drain(out), 1u);
+        EXPECT_EQ(out.back().x, 6.0);
+    }
+
+    TEST(EventQueue, DropsAndCountsBeyondCapacity) {
+        event_queue queue{3};
+        for (std::int32_t i = 0; i < 5; ++i) {
+            queue.push(key(i));
+        }
+        EXPECT_EQ(queue.dropped(), 2u);
+
+        std::vector<event> out;
+        ASSERT_EQ(queue.drain(out), 3u);
+        EXPECT_EQ(out.back().code, 2); // the newest events are the ones dropped
+
+        // A full queue still takes cursor moves that coalesce.
+        queue.push(key(0));
+        queue.push(key(1));
+        queue.push(cursor(1, 1));
+        queue.push(cursor(2, 2));
+        EXPECT_EQ(queue.dropped(), 2u);
+        out.clear();
+        ASSERT_EQ(queue.drain(out), 3u);
+        EXPECT_EQ(out.back().x, 2.0);
+    }
+
+    TEST(EventQueue, WaitDrainTimesOutWhenEmpty) {
+        event_queue queue{4};
+        std::vector<event> out;
+        const auto start = std::chrono::steady_clock::now();
+        EXPECT_EQ(queue.wait_drain(out, 10ms), 0u);
+        EXPECT_GE(std::chrono::steady_clock::now() - start, 10ms);
+    }
+
+    TEST(EventQueue, CloseWakesWaiter) {
+        event_queue queue{4};
+        std::thread waiter{[&] {
+            std::vector<event> out;
+            EXPECT_EQ(queue.wait_drain(out, 1h), 0u);
+        }};
+        std::this_thread::sleep_for(5ms);
+        queue.close();
+        waiter.join();
+
+        EXPECT_TRUE(queue.closed());
+        std::vector<event> out;
+        const auto start = std::chrono::steady_clock::now();
+        EXPECT_EQ(queue.wait_drain(out, 1h), 0u);
+        EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+    }
+
+    TEST(EventQueue, ConcurrentProducersKeepTheirOrder) {
+        constexpr std::int32_t k_producers = 4;
+        constexpr std::int32_t k_events    = 5000;
+        constexpr auto         k_total     = static_cast<std::size_t>(k_producers * k_events);
+
+        event_queue queue{k_total};
+        std::atomic<std::int32_t> running{k_producers};
+
+        std::vector<std::thread> producers;
+        for (std::int32_t p = 0; p < k_producers; ++p) {
+            producers.emplace_back([&, p] {
+                for (std::int32_t i = 0; i < k_events; ++i) {
+                    queue.push(key(p, i));
+                    if (i % 64 == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+                if (running.fetch_sub(1) == 1) {
+                    queue.close();
+                }
+            });
+        }
+
+        // Drain in batches while the producers run, until they are done and
+        // the queue is empty.
+        std::vector<event> received;
+        std::size_t        batches = 0;
+        while (true) {
+            const bool closed = queue.closed();
+            if (queue.wait_drain(received, 1ms) > 0) {
+                ++batches;
+            } else if (closed) {
+                break;
+            }
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+
+        EXPECT_EQ(queue.dropped(), 0u);
+        ASSERT_EQ(received.size(), k_total);
+        EXPECT_GE(batches, 1u);
+
+        std::vector<std::int32_t> next(k_producers, 0);
+        for (const event& e : received) {
+            ASSERT_EQ(e.type, event_type::key);
+            ASSERT_GE(e.code, 0);
+            ASSERT_LT(e.code, k_producers);
+            auto& expected = next[static_cast<std::size_t>(e.code)];
+            ASSERT_EQ(e.scancode, expected) << "producer " << e.code << " out of order";
+            ++expected;
+        }
+        for (const std::int32_t count : next) {
+            EXPECT_EQ(count, k_events);
+        }
+    }
+
+} // namespace
@@ -0,0 +1,106 @@
+// frame_pacer: period arithmetic and the frame cadence, driven through
+// schedule() with a hand-advanced clock, plus a short check of wait().
+
+#include <wren/platform/frame_pacer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+
+namespace {
+
+    using namespace wren::platform;
+    using namespace std::chrono_literals;
+
+    using clock = frame_pacer::clock;
+
+    /// Any point but the epoch, which the pacer reserves for "no cadence".
+    const clock::time_point t0 = clock::time_point{} + 1h;
+
+    TEST(FramePacer, PeriodFromRate) {
+        EXPECT_EQ(frame_pacer{0.5}.period(), 2s);
+        EXPECT_EQ(frame_pacer{100.0}.period(), 10ms);
+        EXPECT_EQ(frame_pacer{60.0}.period(),
+                  std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>{1.0 / 60.0}));
+        EXPECT_EQ(frame_pacer{0.0}.period(), clock::duration::zero());
+        EXPECT_EQ(frame_pacer{-30.0}.period(), clock::duration::zero());
+    }
+
+    TEST(FramePacer, DisabledNeverSleeps) {
+        frame_pacer pacer{0.0};
+        EXPECT_EQ(pacer.schedule(t0), t0);
+        EXPECT_EQ(pacer.schedule(t0 + 1ns), t0 + 1ns);
+        EXPECT_EQ(pacer.wait(), clock::duration::zero());
+    }
+
+    TEST(FramePacer, FirstFrameStartsTheCadence) {
+        frame_pacer pacer{100.0};
+        EXPECT_EQ(pacer.schedule(t0), t0);             // nothing to wait for yet
+        EXPECT_EQ(pacer.schedule(t0 + 3ms), t0 + 10ms); // sleeps out the period
+    }
+
+    TEST(FramePacer, DeadlinesAdvanceByOnePeriod) {
+        frame_pacer pacer{100.0};
+        static_cast<void>(pacer.schedule(t0));
+
+        // Frames ending at varying points before their deadline: the cadence
+        // stays on t0 + k * period, so jitter does not accumulate.
+        constexpr clock::duration k_work[] = {1ms, 9ms, 0ms, 5ms, 9999us};
+        for (int k = 1; k <= 100; ++k) {
+            const auto deadline = t0 + k * 10ms;
+            const auto now      = deadline - 10ms + k_work[k % 5];
+            EXPECT_EQ(pacer.schedule(now), deadline) << "frame " << k;
+        }
+    }
+
+    TEST(FramePacer, LateFrameIsMadeUpNextTime) {
+        frame_pacer pacer{100.0};
+        static_cast<void>(pacer.schedule(t0));
+
+        // 4 ms past its deadline: no sleep, and the next deadline stays on
+        // the cadence, leaving that frame 6 ms instead of 10.
+        EXPECT_EQ(pacer.schedule(t0 + 14ms), t0 + 14ms);
+        EXPECT_EQ(pacer.schedule(t0 + 15ms), t0 + 20ms);
+
+        // Exactly one period late is still caught up: the next deadline is
+        // the end of this frame, so the following one starts out late.
+        EXPECT_EQ(pacer.schedule(t0 + 40ms), t0 + 40ms);
+        EXPECT_EQ(pacer.schedule(t0 + 41ms), t0 + 41ms);
+        EXPECT_EQ(pacer.schedule(t0 + 42ms), t0 + 50ms);
+    }
+
+    TEST(FramePacer, FrameMoreThanAPeriodLateRestarts) {
+        frame_pacer pacer{100.0};
+        static_cast<void>(pacer.schedule(t0));
+
+        // Deadline t0 + 10 ms; 25 ms is beyond one further period, so the
+        // cadence restarts from now rather than bursting two frames.
+        EXPECT_EQ(pacer.schedule(t0 + 25ms), t0 + 25ms);
+        EXPECT_EQ(pacer.schedule(t0 + 26ms), t0 + 35ms);
+        EXPECT_EQ(pacer.schedule(t0 + 36ms), t0 + 45ms);
+    }
+
+    TEST(FramePacer, ResetAndSetRateForgetTheCadence) {
+        frame_pacer pacer{100.0};
+        static_cast<void>(pacer.schedule(t0));
+        pacer.reset();
+        EXPECT_EQ(pacer.schedule(t0 + 1ms), t0 + 1ms);
+        EXPECT_EQ(pacer.schedule(t0 + 2ms), t0 + 11ms);
+
+        pacer.set_rate(50.0);
+        EXPECT_EQ(pacer.period(), 20ms);
+        EXPECT_EQ(pacer.schedule(t0 + 3ms), t0 + 3ms);
+        EXPECT_EQ(pacer.schedule(t0 + 4ms), t0 + 23ms);
+    }
+
+    TEST(FramePacer, WaitSleepsUntilTheDeadline) {
+        frame_pacer pacer{200.0};
+        const auto start = clock::now();
+        EXPECT_EQ(pacer.wait(), clock::duration::zero());
+        const auto slept = pacer.wait();
+        EXPECT_GT(slept, clock::duration::zero());
+        EXPECT_GE(clock::now() - start, pacer.period());
+    }
+
+} // namespace
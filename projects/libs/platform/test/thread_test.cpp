@@ -0,0 +1,82 @@
+// Thread helpers: the core count, pinning to a core the process may use, and
+// thread names, read back through the OS where it allows.
+
+#include <wren/platform/thread.hpp>
+
+#include <wren/foundation/system/platform.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#if defined(WREN_PLATFORM_LINUX)
+#   include <pthread.h>
+#   include <sched.h>
+#endif
+
+
+namespace {
+
+    using namespace wren::platform;
+
+    /// Runs @p fn on a fresh thread, so pinning and naming leave the test
+    /// runner's main thread alone.
+    template <typename F>
+    void on_thread(F&& fn) {
+        std::thread{[&] { fn(); }}.join();
+    }
+
+    TEST(Thread, LogicalCoreCountIsPositive) {
+        const std::uint32_t count = logical_core_count();
+        EXPECT_GE(count, 1u);
+        if (const unsigned hardware = std::thread::hardware_concurrency(); hardware != 0) {
+            EXPECT_LE(count, hardware);
+        }
+    }
+
+    TEST(Thread, AffinityRejectsCoresOutOfRange) {
+        on_thread([] { EXPECT_FALSE(set_current_thread_affinity(UINT32_MAX)); });
+    }
+
+#if defined(WREN_PLATFORM_LINUX)
+    TEST(Thread, AffinityPinsToAllowedCore) {
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+        std::uint32_t core = 0;
+        while (!CPU_ISSET(core, &allowed)) {
+            ++core;
+        }
+
+        on_thread([core] {
+            ASSERT_TRUE(set_current_thread_affinity(core));
+            cpu_set_t pinned;
+            CPU_ZERO(&pinned);
+            ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(pinned), &pinned), 0);
+            EXPECT_EQ(CPU_COUNT(&pinned), 1);
+            EXPECT_TRUE(CPU_ISSET(core, &pinned));
+            EXPECT_EQ(sched_getcpu(), static_cast<int>(core));
+        });
+    }
+
+    TEST(Thread, NameIsTruncatedToTheLinuxLimit) {
+        on_thread([] {
+            ASSERT_TRUE(set_current_thread_name("wren-worker"));
+            char name[16] = {};
+            ASSERT_EQ(pthread_getname_np(pthread_self(), name, sizeof(name)), 0);
+            EXPECT_EQ(std::string{name}, "wren-worker");
+
+            ASSERT_TRUE(set_current_thread_name("wren-a-name-longer-than-fifteen"));
+            ASSERT_EQ(pthread_getname_np(pthread_self(), name, sizeof(name)), 0);
+            EXPECT_EQ(std::string{name}, "wren-a-name-lon");
+        });
+    }
+#elif defined(WREN_PLATFORM_WINDOWS) || defined(WREN_PLATFORM_POSIX)
+    TEST(Thread, NameIsAccepted) {
+        on_thread([] { EXPECT_TRUE(set_current_thread_name("wren-worker")); });
+    }
+#endif
+
+} // namespace
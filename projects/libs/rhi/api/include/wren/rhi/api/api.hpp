@@ -2,8 +2,15 @@
 #define WREN_RHI_API_API_HPP
 
 
+#include <wren/rhi/api/commands.hpp>
 #include <wren/rhi/api/enums.hpp>
 #include <wren/rhi/api/features.hpp>
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/pipelines.hpp>
+#include <wren/rhi/api/resources.hpp>
+#include <wren/rhi/api/state_hash.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/api/swapchain.hpp>
 
 namespace wren::rhi {
 
@@ -0,0 +1,554 @@
+#ifndef WREN_RHI_API_COMMANDS_HPP
+#define WREN_RHI_API_COMMANDS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/resources.hpp>
+
+namespace wren::rhi {
+
+// ===================================================================================
+// Command lists
+//   A command list is a transient object owned by the backend's per-frame pools.
+//   It is valid from begin_command_list() until the device starts the same
+//   frame-in-flight slot again (DeviceDesc::framesInFlight begin_frame() calls
+//   later); there is no explicit destroy.
+//
+//   Recording is thread-safe per list: any number of threads may record into
+//   different lists at the same time. Each recording thread draws from its own
+//   command pool, so begin_command_list() takes no lock. A thread keeps its
+//   pool for the device's lifetime; at most k_max_recording_threads distinct
+//   threads may record on one device, and begin_command_list() returns
+//   Status::OutOfMemory to any thread past that.
+// ===================================================================================
+
+/// Forward declaration of the per-backend command list state.
+/// Each backend defines this struct in its own translation unit.
+struct CommandListState;
+
+/// Opaque handle to a command list; see the block comment above for lifetime.
+using CommandListHandle = CommandListState*;
+
+/// Distinct threads that may ever call begin_command_list() on one device.
+/// Size the job system (and any other recording threads) below it.
+inline constexpr uint32_t k_max_recording_threads = 64;
+
+/// Upper bound on simultaneous colour attachments in one render pass.
+inline constexpr uint32_t k_max_color_attachments = 8;
+
+/// Attachment formats of a render pass, declared up front by secondary
+/// command lists that are executed inside it.
+struct RenderTargetLayout {
+    uint32_t      colorFormatCount = 0;
+    TextureFormat colorFormats[k_max_color_attachments]{};
+    bool          hasDepthStencil    = false;
+    TextureFormat depthStencilFormat = TextureFormat::D32;
+    SampleCount   samples            = SampleCount::C1;
+};
+
+/// Parameters for BackendVTable::begin_command_list.
+struct CommandListDesc {
+    QueueType        queue = QueueType::Graphics;         ///< Queue the list will be submitted to.
+    CommandListLevel level = CommandListLevel::Primary;
+
+    /// Secondary lists only: non-null when the list is executed inside a
+    /// render pass with this layout; null for lists of copies or dispatches.
+    RenderTargetLayout const* renderTargets = nullptr;
+
+    /// Primary lists only: bit i runs the list on physical device i of a
+    /// device group (DeviceLimits::deviceCount); 0 runs it on all of them.
+    /// Alternate-frame rendering gives frame N the mask 1 << (N % count);
+    /// split-frame rendering narrows it per region with device_mask_packet().
+    /// Secondary lists run on the devices of the list executing them.
+    uint32_t deviceMask = 0;
+};
+
+// ===================================================================================
+// Submission & GPU timelines
+//   Every queue advances a 64-bit timeline by one per submission. A SyncPoint
+//   names a value on one queue's timeline; it is reached when the GPU has
+//   finished that submission and everything submitted to the queue before it.
+//   Submissions may wait on SyncPoints of other queues (graphics ↔ async
+//   compute ↔ transfer) and the CPU may wait on any of them.
+// ===================================================================================
+
+/// A value on a queue's timeline. Value 0 is always complete.
+struct SyncPoint {
+    QueueType queue = QueueType::Graphics;
+    uint64_t  value = 0;
+};
+
+/// Parameters for BackendVTable::submit_command_lists.
+struct SubmitDesc {
+    /// Ended primary lists, executed in array order. All must have been begun
+    /// for the same queue.
+    CommandListHandle const* lists     = nullptr;
+    uint32_t                 listCount = 0;
+
+    /// GPU-side waits, typically on another queue's SyncPoint. The whole
+    /// submission waits; there is no per-stage scope.
+    SyncPoint const* waits     = nullptr;
+    uint32_t         waitCount = 0;
+};
+
+// ===================================================================================
+// Sparse binding (see Sparse textures in resources.hpp)
+//   Binds run on the device's sparse binding queue, which is ordered against
+//   nothing by itself: the first use of a page must wait on the SyncPoint of
+//   the bind that made it resident, and a page must only be unbound or
+//   rebound after the GPU has finished every use of its old binding — pass
+//   the SyncPoints of that work as waits.
+// ===================================================================================
+
+/// One page of a sparse texture to bind or unbind. x and y count pages
+/// inside the mip level. With `mipTail` set the entry covers the whole mip
+/// tail of `arrayLayer` instead, and mipLevel, x and y are ignored.
+struct SparsePageBind {
+    TextureHandle texture;
+    uint32_t      mipLevel   = 0;
+    uint32_t      arrayLayer = 0;
+    uint32_t      x = 0, y = 0;
+    bool          mipTail    = false;
+    HeapHandle    heap{};          ///< Null unbinds the page.
+    uint64_t      heapOffset = 0;  ///< A multiple of SparseTextureInfo::pageBytes.
+};
+
+/// Parameters for BackendVTable::bind_sparse.
+struct SparseBindDesc {
+    SparsePageBind const* binds     = nullptr;
+    uint32_t              bindCount = 0;
+
+    /// GPU-side waits before any page changes.
+    SyncPoint const* waits     = nullptr;
+    uint32_t         waitCount = 0;
+};
+
+// ===================================================================================
+// Barriers
+//   Usages double as resource states (ARCHITECTURE.md §4.9). A barrier should
+//   name one state on each side; TextureUsage::None as the old state discards
+//   the previous contents. Stage masks only matter for the shader-visible
+//   states (Sampled, Storage, Uniform); the others imply their fixed stages.
+//
+//   Queue ownership: resources belong to one queue at a time. To hand one
+//   over (say Graphics → Compute for async compute), set srcQueue/dstQueue
+//   and record the same barrier twice — once in a list for srcQueue (the
+//   release) and once in a list for dstQueue (the acquire) — and make the
+//   acquiring submission wait on the releasing one's SyncPoint. Queues that
+//   alias each other (Feature::AsyncCompute / AsyncTransfer absent) need no
+//   transfer: the release degrades to a plain barrier and the acquire is a
+//   no-op. Contents that are discarded (oldUsage None) never need a transfer.
+//
+//   `discard` drops a texture's contents while still ordering the barrier
+//   after oldUsage. It is how memory passes between aliasing textures placed
+//   in one heap: the new texture's barrier names, as oldUsage and srcStages,
+//   how the previous occupant was last used on the same queue.
+// ===================================================================================
+
+struct TextureBarrier {
+    TextureHandle texture;
+    TextureUsage  oldUsage  = TextureUsage::None;
+    TextureUsage  newUsage  = TextureUsage::None;
+    ShaderStage   srcStages = ShaderStage::None;
+    ShaderStage   dstStages = ShaderStage::None;
+    QueueType     srcQueue  = QueueType::Graphics;  ///< Equal queues: no ownership transfer.
+    QueueType     dstQueue  = QueueType::Graphics;
+    bool          discard   = false;                ///< Contents are not preserved; see above.
+};
+
+struct BufferBarrier {
+    BufferHandle buffer;
+    BufferUsage  oldUsage  = BufferUsage::None;
+    BufferUsage  newUsage  = BufferUsage::None;
+    ShaderStage  srcStages = ShaderStage::None;
+    ShaderStage  dstStages = ShaderStage::None;
+    QueueType    srcQueue  = QueueType::Graphics;   ///< Equal queues: no ownership transfer.
+    QueueType    dstQueue  = QueueType::Graphics;
+};
+
+// ===================================================================================
+// Copies
+// ===================================================================================
+
+struct BufferCopy {
+    uint64_t srcOffset = 0;
+    uint64_t dstOffset = 0;
+    uint64_t size      = 0;
+};
+
+/// One region of a copy between a buffer and a texture, in either
+/// direction. A row length / image height of zero means the buffer data is
+/// tightly packed.
+struct BufferTextureCopy {
+    uint64_t bufferOffset      = 0;
+    uint32_t bufferRowLength   = 0;  ///< In texels.
+    uint32_t bufferImageHeight = 0;  ///< In texels.
+    uint32_t mipLevel          = 0;
+    uint32_t baseArrayLayer    = 0;
+    uint32_t layerCount        = 1;
+    int32_t  x = 0, y = 0, z = 0;
+    uint32_t width = 1, height = 1, depth = 1;
+};
+
+// ===================================================================================
+// Acceleration structure builds (ARCHITECTURE.md §4.15)
+//   One cmd_build_acceleration_structures call builds many structures at
+//   once; the driver overlaps them, so batching is the fast path. Each
+//   build in a batch needs scratch of its own: ranges of one scratch buffer
+//   (BufferUsage::Storage) aligned to
+//   DeviceLimits::accelerationStructureScratchAlignment. The call waits for
+//   earlier work on the queue, which may still trace the structures it
+//   rewrites, and ends with a barrier that makes its builds visible to later
+//   builds, ray tracing and shader reads, and lets the next batch reuse the
+//   scratch ranges.
+// ===================================================================================
+
+enum class AccelerationStructureBuildMode : std::uint8_t {
+    Build,   ///< From scratch.
+    Update   ///< Refit `source` to moved inputs; same counts, built with AllowUpdate.
+};
+
+struct AccelerationStructureBuild {
+    AccelerationStructureInputs    inputs;
+    AccelerationStructureBuildMode mode = AccelerationStructureBuildMode::Build;
+    AccelerationStructureHandle    destination{};
+    AccelerationStructureHandle    source{};         ///< Update only; may equal `destination`.
+    BufferHandle                   scratch{};        ///< Ignored by host builds, which allocate their own.
+    uint64_t                       scratchOffset = 0;
+};
+
+enum class AccelerationStructureCopyMode : std::uint8_t {
+    Clone,   ///< Destination as large as the source.
+    Compact  ///< Destination sized from cmd_write_compacted_sizes; source built with AllowCompaction.
+};
+
+// ===================================================================================
+// Rendering (dynamic render passes, ARCHITECTURE.md §4.11)
+//   Attachments must be in the ColorAttachment / DepthStencilAtt state.
+// ===================================================================================
+
+struct ColorAttachment {
+    TextureHandle texture;
+    LoadOp        load  = LoadOp::Load;
+    StoreOp       store = StoreOp::Store;
+    float         clearColor[4]{};
+};
+
+struct DepthStencilAttachment {
+    TextureHandle texture;
+    LoadOp        depthLoad    = LoadOp::Load;
+    StoreOp       depthStore   = StoreOp::Store;
+    LoadOp        stencilLoad  = LoadOp::DontCare;   ///< Ignored for depth-only formats.
+    StoreOp       stencilStore = StoreOp::DontCare;
+    float         clearDepth   = 1.0f;
+    uint32_t      clearStencil = 0;
+};
+
+struct RenderingDesc {
+    ColorAttachment const*        colorAttachments     = nullptr;
+    uint32_t                      colorAttachmentCount = 0;
+    DepthStencilAttachment const* depthStencil         = nullptr;
+    int32_t                       x = 0, y = 0;
+    uint32_t                      width = 0, height = 0;
+
+    /// When true the pass body comes only from secondary command lists
+    /// (BackendVTable::cmd_execute_command_lists); no draws may be recorded
+    /// into the primary list until cmd_end_rendering.
+    bool secondaryCommandLists = false;
+};
+
+struct Viewport {
+    float x = 0.0f, y = 0.0f;
+    float width = 0.0f, height = 0.0f;
+    float minDepth = 0.0f, maxDepth = 1.0f;
+};
+
+struct Scissor {
+    int32_t  x = 0, y = 0;
+    uint32_t width = 0, height = 0;
+};
+
+// ===================================================================================
+// Indirect draws & dispatches (GPU-driven rendering)
+//   The arguments come from a buffer with BufferUsage::Indirect, usually
+//   written by a compute pass that culls instances and compacts the
+//   survivors' draws (ARCHITECTURE.md §4.8). A count buffer makes the number
+//   of draws GPU-side too: the draw reads a uint32 from it and issues
+//   min(count, maxDrawCount) draws, so the CPU records one call per pass
+//   however many objects the scene holds.
+//
+//   The records below match the layouts of VkDraw*IndirectCommand,
+//   D3D12_DRAW_*_ARGUMENTS and the GL indirect structs, so shaders write them
+//   as plain uint arrays. Before the draw, the writes must be made visible
+//   with a BufferBarrier to BufferUsage::Indirect.
+// ===================================================================================
+
+struct DrawIndirectCommand {
+    uint32_t vertexCount   = 0;
+    uint32_t instanceCount = 0;
+    uint32_t firstVertex   = 0;
+    uint32_t firstInstance = 0;
+};
+
+struct DrawIndexedIndirectCommand {
+    uint32_t indexCount    = 0;
+    uint32_t instanceCount = 0;
+    uint32_t firstIndex    = 0;
+    int32_t  vertexOffset  = 0;
+    uint32_t firstInstance = 0;  ///< Commonly the instance's index into per-instance data.
+};
+
+struct DispatchIndirectCommand {
+    uint32_t x = 0, y = 0, z = 0;
+};
+
+struct IndirectDrawDesc {
+    BufferHandle argsBuffer;          ///< Draw*IndirectCommand records.
+    uint64_t     argsOffset = 0;      ///< Multiple of 4.
+    uint32_t     stride     = 0;      ///< Between records; 0 = sizeof the record.
+
+    /// Draws issued without a count buffer, or the upper bound with one.
+    /// More than one needs Feature::MultiDrawIndirect and at most
+    /// DeviceLimits::maxDrawIndirectCount.
+    uint32_t     maxDrawCount = 1;
+
+    /// Optional uint32 draw count (Feature::MultiDrawIndirect); null issues
+    /// exactly maxDrawCount draws.
+    BufferHandle countBuffer;
+    uint64_t     countOffset = 0;     ///< Multiple of 4.
+};
+
+// ===================================================================================
+// Command packets
+//   The per-draw commands as fixed-size 32-byte records. One
+//   BackendVTable::cmd_record_packets call records a whole array of them, so
+//   the ABI crossing, the argument marshalling and the backend's per-call
+//   setup are paid once per batch instead of once per command. Packets run
+//   in array order with the same semantics as the individual cmd_* entry
+//   points; build them with the *_packet() helpers below.
+// ===================================================================================
+
+enum class CommandOp : std::uint8_t {
+    Draw,
+    DrawIndexed,
+    Dispatch,
+    BindPipeline,
+    PushConstants,      // up to k_packet_push_constant_bytes inline
+    SetViewport,
+    SetScissor,
+    BindVertexBuffer,   // one binding; use one packet per binding
+    BindIndexBuffer,
+    SetDeviceMask,      // device group: the devices that run the commands after it
+};
+
+/// Push-constant bytes one packet carries; larger writes take several
+/// packets or BackendVTable::cmd_push_constants.
+inline constexpr uint32_t k_packet_push_constant_bytes = 24;
+
+struct CommandPacket {
+    struct DrawArgs {
+        uint32_t vertexCount, instanceCount, firstVertex, firstInstance;
+    };
+    struct DrawIndexedArgs {
+        uint32_t indexCount, instanceCount, firstIndex;
+        int32_t  vertexOffset;
+        uint32_t firstInstance;
+    };
+    struct DispatchArgs {
+        uint32_t x, y, z;
+    };
+    struct PushArgs {
+        std::byte data[k_packet_push_constant_bytes];
+    };
+    struct BufferArgs {
+        BufferHandle buffer;
+        uint64_t     offset;
+    };
+
+    CommandOp op         = CommandOp::Draw;    ///< Selects the active union member.
+    uint8_t   binding    = 0;                  ///< BindVertexBuffer: vertex input binding.
+    IndexType indexType  = IndexType::Uint32;  ///< BindIndexBuffer: index width.
+    uint8_t   pushSize   = 0;                  ///< PushConstants: bytes of push.data used; multiple of 4.
+    uint32_t  pushOffset = 0;                  ///< PushConstants: byte offset in the range; multiple of 4.
+    union {
+        DrawArgs        draw;
+        DrawIndexedArgs drawIndexed;
+        DispatchArgs    dispatch;
+        PipelineHandle  pipeline;
+        PushArgs        push;
+        Viewport        viewport;
+        Scissor         scissor;
+        BufferArgs      buffer;  ///< BindVertexBuffer / BindIndexBuffer.
+        uint32_t        deviceMask;
+    };
+
+    CommandPacket() noexcept : draw{} {}
+};
+static_assert(sizeof(CommandPacket) == 32, "packets are sized to pack two per cache line");
+static_assert(std::is_trivially_copyable_v<CommandPacket>, "packets cross the ABI by memcpy");
+
+[[nodiscard]] inline CommandPacket draw_packet(uint32_t vertex_count, uint32_t instance_count = 1,
+                                               uint32_t first_vertex = 0,
+                                               uint32_t first_instance = 0) noexcept {
+    CommandPacket p;
+    p.op = CommandOp::Draw;
+    p.draw = {vertex_count, instance_count, first_vertex, first_instance};
+    return p;
+}
+
+[[nodiscard]] inline CommandPacket draw_indexed_packet(uint32_t index_count, uint32_t instance_count = 1,
+                                                       uint32_t first_index = 0, int32_t vertex_offset = 0,
+                                                       uint32_t first_instance = 0) noexcept {
+    CommandPacket p;
+    p.op = CommandOp::DrawIndexed;
+    p.drawIndexed = {index_count, instance_count, first_index, vertex_offset, first_instance};
+    return p;
+}
+
+[[nodiscard]] inline CommandPacket dispatch_packet(uint32_t x, uint32_t y = 1, uint32_t z = 1) noexcept {
+    CommandPacket p;
+    p.op = CommandOp::Dispatch;
+    p.dispatch = {x, y, z};
+    return p;
+}
+
+[[nodiscard]] inline CommandPacket bind_pipeline_packet(PipelineHandle pipeline) noexcept {
+    CommandPacket p;
+    p.op = CommandOp::BindPipeline;
+    p.pipeline = pipeline;
+    return p;
+}
+
+/// @p value is at most k_packet_push_constant_bytes and a multiple of 4 bytes.
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && (sizeof(T) <= k_packet_push_constant_bytes) &&
+             (sizeof(T) % 4 == 0)
+[[nodiscard]] inline CommandPacket push_constants_packet(T const& value, uint32_t offset = 0) noexcept {
+    CommandPacket p;
+    p.op = CommandOp::PushConstants;
+    p.pushSize = static_cast<uint8_t>(sizeof(T));
+    p.pushOffset = offset;
+    std::memcpy(p.push.data, &value, sizeof(T));
+    return p;
+}
+
+[[nodiscard]] inline CommandPacket viewport_packet(Viewport const& viewport) noexcept {
+    CommandPacket p;
+    p.op = CommandOp::SetViewport;
+    p.viewport = viewport;
+    return p;
+}
+
+[[nodiscard]] inline CommandPacket scissor_packet(Scissor const& scissor) noexcept {
+    CommandPacket p;
+    p.op = CommandOp::SetScissor;
+    p.scissor = scissor;
+    return p;
+}
+
+[[nodiscard]] inline CommandPacket vertex_buffer_packet(uint32_t binding, BufferHandle buffer,
+                                                        uint64_t offset = 0) noexcept {
+    CommandPacket p;
+    p.op = CommandOp::BindVertexBuffer;
+    p.binding = static_cast<uint8_t>(binding);
+    p.buffer = {buffer, offset};
+    return p;
+}
+
+[[nodiscard]] inline CommandPacket index_buffer_packet(BufferHandle buffer, IndexType type,
+                                                       uint64_t offset = 0) noexcept {
+    CommandPacket p;
+    p.op = CommandOp::BindIndexBuffer;
+    p.indexType = type;
+    p.buffer = {buffer, offset};
+    return p;
+}
+
+/// Runs the following commands on the physical devices in @p mask only; a
+/// subset of the list's CommandListDesc::deviceMask. Paired with a scissor
+/// per device, this splits one frame between the GPUs of a device group.
+[[nodiscard]] inline CommandPacket device_mask_packet(uint32_t mask) noexcept {
+    CommandPacket p;
+    p.op = CommandOp::SetDeviceMask;
+    p.deviceMask = mask;
+    return p;
+}
+
+// ===================================================================================
+// GPU profiling (ARCHITECTURE.md §9)
+//   A profiling region brackets the commands recorded between
+//   cmd_begin_profile_region and cmd_end_profile_region with two timestamps
+//   and, with Feature::DebugMarkers_Labels, a debug label of the same name,
+//   so captures and the in-engine profiler show the same tree. Regions nest
+//   within one list; regions still open when the list ends are closed there.
+//
+//   Queries come from a ring with one pool per frame-in-flight slot.
+//   begin_frame() reads back the slot it is about to reuse, whose GPU work it
+//   has already waited for, so results arrive framesInFlight frames late and
+//   never stall. Regions beyond k_max_profile_regions in a frame, on queues
+//   without timestamps, or in lists that were never submitted are dropped.
+//   Without Feature::TimestampQueries only the labels remain.
+// ===================================================================================
+
+inline constexpr uint32_t k_max_profile_regions            = 1024;  ///< Per frame, all lists.
+inline constexpr uint32_t k_max_profile_statistics_regions = 64;    ///< Per frame.
+inline constexpr uint32_t k_max_profile_region_depth       = 16;    ///< Per list.
+inline constexpr uint32_t k_max_profile_region_name        = 48;    ///< Bytes kept, terminator included.
+
+struct ProfileRegionDesc {
+    const char* name = nullptr;  ///< Copied; longer names are truncated.
+
+    /// Also count vertices, primitives and shader invocations
+    /// (Feature::PipelineStatistics). Only on primary Graphics lists, only
+    /// for the outermost such region of a list, and the region must begin
+    /// and end on the same side of a render pass.
+    bool pipelineStatistics = false;
+};
+
+struct PipelineStatistics {
+    uint64_t inputAssemblyVertices     = 0;
+    uint64_t inputAssemblyPrimitives   = 0;
+    uint64_t vertexShaderInvocations   = 0;
+    uint64_t clippingInvocations       = 0;
+    uint64_t clippingPrimitives        = 0;
+    uint64_t fragmentShaderInvocations = 0;
+    uint64_t computeShaderInvocations  = 0;
+};
+
+/// One resolved region. Times are nanoseconds, already scaled by
+/// DeviceLimits::timestampPeriod.
+struct ProfileRegion {
+    const char* name  = nullptr;  ///< Valid until the next begin_frame().
+    QueueType   queue = QueueType::Graphics;
+    uint32_t    depth = 0;        ///< Nesting level within its list; 0 is outermost.
+
+    /// Device timestamp domain; only differences are meaningful.
+    uint64_t gpuBeginNs = 0;
+    uint64_t gpuEndNs   = 0;
+
+    /// The same moments on the host's steady clock (std::chrono::steady_clock),
+    /// for lining up with CPU profiler zones. 0 without
+    /// Feature::CalibratedTimestamps.
+    uint64_t cpuBeginNs = 0;
+    uint64_t cpuEndNs   = 0;
+
+    bool               hasStatistics = false;
+    PipelineStatistics statistics{};
+};
+
+/// Results of one past frame; read with BackendVTable::read_profile_frame.
+struct ProfileFrame {
+    uint64_t             frameNumber    = 0;  ///< Frame the regions were recorded in; 0 if none yet.
+    ProfileRegion const* regions        = nullptr;  ///< Sorted by queue, then gpuBeginNs.
+    uint32_t             regionCount    = 0;
+    uint32_t             droppedRegions = 0;
+};
+
+} // namespace wren::rhi
+
+#endif // WREN_RHI_API_COMMANDS_HPP
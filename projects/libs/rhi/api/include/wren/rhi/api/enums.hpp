@@ -42,6 +42,15 @@ enum class QueueType : std::uint8_t {
     Present     // VK: presentation-capable queue family | D3D12: swapchain on DIRECT | Metal: present drawable | GL: SwapBuffers
 };
 
+/// @brief Whether a command list is submitted directly or replayed from another list.
+///
+/// Secondary lists let several threads record one render pass in parallel;
+/// the primary list that owns the pass executes them in order.
+enum class CommandListLevel : std::uint8_t {
+    Primary,    // VK: VK_COMMAND_BUFFER_LEVEL_PRIMARY   | D3D12: DIRECT/COMPUTE/COPY list | Metal: MTLCommandBuffer | GL: CPU command stream
+    Secondary   // VK: VK_COMMAND_BUFFER_LEVEL_SECONDARY | D3D12: BUNDLE list              | Metal: MTLParallelRenderCommandEncoder child | GL: CPU command stream
+};
+
 // ===================================================================================
 // Shader stages (bitmask)
 //   VK: VkShaderStageFlagBits — https://docs.vulkan.org/refpages/latest/refpages/source/VkShaderStageFlagBits.html
@@ -130,6 +139,14 @@ enum class FrontFace : std::uint8_t {
     CW        // VK_FRONT_FACE_CLOCKWISE         | GL_CW             | D3D12: FrontCounterClockwise=FALSE | Metal: clockwise
 };
 
+/// @brief How the rasterizer fills polygons.
+///
+/// @note @c Wireframe requires @c Feature::NonSolidFill.
+enum class FillMode : std::uint8_t {
+    Solid,      // VK_POLYGON_MODE_FILL | GL_FILL | D3D12: FILL_MODE_SOLID     | Metal: MTLTriangleFillModeFill
+    Wireframe   // VK_POLYGON_MODE_LINE | GL_LINE | D3D12: FILL_MODE_WIREFRAME | Metal: MTLTriangleFillModeLines
+};
+
 // ===================================================================================
 // Multisample (MSAA) sample counts
 //   VK: VkSampleCountFlagBits — https://docs.vulkan.org/refpages/latest/refpages/source/VkSampleCountFlagBits.html
@@ -360,7 +377,8 @@ enum class TextureUsage : std::uint32_t {
     ColorAttachment = 1u << 2,   // VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | GL: FBO color attachment (glFramebufferTexture2D) | D3D12: ALLOW_RENDER_TARGET | Metal: renderTarget
     DepthStencilAtt = 1u << 3,   // VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | GL: FBO depth/stencil attachment | D3D12: ALLOW_DEPTH_STENCIL | Metal: renderTarget
     TransferSrc     = 1u << 4,   // VK_IMAGE_USAGE_TRANSFER_SRC_BIT     | GL: implicit (glBlitFramebuffer / glCopyImageSubData src) | D3D12: no flag (state COPY_SOURCE) | Metal: no flag (any texture is blit-able)
-    TransferDst     = 1u << 5    // VK_IMAGE_USAGE_TRANSFER_DST_BIT     | GL: implicit (copy/blit dst) | D3D12: no flag (state COPY_DEST) | Metal: no flag (any texture is blit-able)
+    TransferDst     = 1u << 5,   // VK_IMAGE_USAGE_TRANSFER_DST_BIT     | GL: implicit (copy/blit dst) | D3D12: no flag (state COPY_DEST) | Metal: no flag (any texture is blit-able)
+    Present         = 1u << 6    // state only: VK_IMAGE_LAYOUT_PRESENT_SRC_KHR | GL: default framebuffer | D3D12: state PRESENT | Metal: drawable; swapchain images only
 };
 
 /// @brief Bitmask declaring the intended usage of a buffer resource.
@@ -377,7 +395,18 @@ enum class BufferUsage : std::uint32_t {
     Storage     = 1u << 3,  // VK_BUFFER_USAGE_STORAGE_BUFFER_BIT  | GL: GL_SHADER_STORAGE_BUFFER target | D3D12: ALLOW_UNORDERED_ACCESS   | Metal: no flag (read/write in shader)
     Indirect    = 1u << 4,  // VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | GL: GL_DRAW_INDIRECT_BUFFER target  | D3D12: no flag (ExecuteIndirect) | Metal: no flag (drawPrimitives indirect)
     TransferSrc = 1u << 5,  // VK_BUFFER_USAGE_TRANSFER_SRC_BIT    | GL: implicit copy src               | D3D12: no flag (state COPY_SOURCE) | Metal: no flag
-    TransferDst = 1u << 6   // VK_BUFFER_USAGE_TRANSFER_DST_BIT    | GL: implicit copy dst               | D3D12: no flag (state COPY_DEST)   | Metal: no flag
+    TransferDst = 1u << 6,  // VK_BUFFER_USAGE_TRANSFER_DST_BIT    | GL: implicit copy dst               | D3D12: no flag (state COPY_DEST)   | Metal: no flag
+    AccelerationStructureInput = 1u << 7  // VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR | GL: n/a | D3D12: no flag (state NON_PIXEL_SHADER_RESOURCE) | Metal: no flag
+};
+
+/// @brief Intended CPU/GPU access pattern of a resource's memory.
+///
+/// Selects the heap a resource is placed in (see ARCHITECTURE.md §8).
+/// Upload and Readback resources are persistently CPU-mapped.
+enum class MemoryUsage : std::uint8_t {
+    GpuOnly,   // VK: DEVICE_LOCAL                   | D3D12: DEFAULT  | Metal: Private | GL: GL_STATIC_DRAW
+    Upload,    // VK: HOST_VISIBLE + HOST_COHERENT   | D3D12: UPLOAD   | Metal: Shared  | GL: GL_STREAM_DRAW / MAP_PERSISTENT
+    Readback   // VK: HOST_VISIBLE + HOST_CACHED     | D3D12: READBACK | Metal: Shared  | GL: GL_STREAM_READ
 };
 
 // ===================================================================================
@@ -413,6 +442,60 @@ enum class TextureFormat : std::uint16_t {
     D32S8,               // VK_FORMAT_D32_SFLOAT_S8_UINT    | GL_DEPTH32F_STENCIL8 | DXGI_FORMAT_D32_FLOAT_S8X24_UINT  | MTLPixelFormatDepth32Float_Stencil8
 };
 
+// ===================================================================================
+// Acceleration structure build flags
+//   VK: VkBuildAccelerationStructureFlagBitsKHR — https://docs.vulkan.org/refpages/latest/refpages/source/VkBuildAccelerationStructureFlagBitsKHR.html
+//       VkGeometryInstanceFlagBitsKHR — https://docs.vulkan.org/refpages/latest/refpages/source/VkGeometryInstanceFlagBitsKHR.html
+//   D3D12: D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS — https://learn.microsoft.com/windows/win32/api/d3d12/ne-d3d12-d3d12_raytracing_acceleration_structure_build_flags
+//   Metal: MTLAccelerationStructureUsage — https://developer.apple.com/documentation/metal/mtlaccelerationstructureusage
+//   GL: n/a
+// ===================================================================================
+
+/// @brief How an acceleration structure is built and what it allows later.
+///
+/// A structure is updated (refitted) only if built with @c AllowUpdate, and
+/// compacted only if built with @c AllowCompaction. Combine with operator|.
+enum class AccelerationStructureFlags : std::uint32_t {
+    None            = 0,
+    AllowUpdate     = 1u << 0,  // VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR      | D3D12: ALLOW_UPDATE      | Metal: Refit
+    AllowCompaction = 1u << 1,  // VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR  | D3D12: ALLOW_COMPACTION  | Metal: (always)
+    PreferFastTrace = 1u << 2,  // VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR | D3D12: PREFER_FAST_TRACE | Metal: none
+    PreferFastBuild = 1u << 3   // VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_BUILD_BIT_KHR | D3D12: PREFER_FAST_BUILD | Metal: PreferFastBuild
+};
+
+/// @brief Per-instance overrides in a top-level acceleration structure.
+///
+/// The values are the Vulkan and D3D12 bit values: they are written into
+/// AccelerationStructureInstance::flags unchanged.
+enum class AccelerationStructureInstanceFlags : std::uint8_t {
+    None                  = 0,
+    TriangleCullDisable   = 1u << 0,  // VK_GEOMETRY_INSTANCE_TRIANGLE_FACING_CULL_DISABLE_BIT_KHR | D3D12: TRIANGLE_CULL_DISABLE
+    FrontCounterClockwise = 1u << 1,  // VK_GEOMETRY_INSTANCE_TRIANGLE_FLIP_FACING_BIT_KHR         | D3D12: TRIANGLE_FRONT_COUNTERCLOCKWISE
+    ForceOpaque           = 1u << 2,  // VK_GEOMETRY_INSTANCE_FORCE_OPAQUE_BIT_KHR                 | D3D12: FORCE_OPAQUE
+    ForceNoOpaque         = 1u << 3   // VK_GEOMETRY_INSTANCE_FORCE_NO_OPAQUE_BIT_KHR              | D3D12: FORCE_NON_OPAQUE
+};
+
+// ===================================================================================
+// Attachment load / store operations
+//   VK: VkAttachmentLoadOp / VkAttachmentStoreOp — https://docs.vulkan.org/refpages/latest/refpages/source/VkAttachmentLoadOp.html
+//   D3D12: D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE — https://learn.microsoft.com/windows/win32/api/d3d12/ne-d3d12-d3d12_render_pass_beginning_access_type
+//   Metal: MTLLoadAction / MTLStoreAction — https://developer.apple.com/documentation/metal/mtlloadaction
+//   GL: emulated with glClear / glInvalidateFramebuffer
+// ===================================================================================
+
+/// @brief What happens to an attachment's contents when a render pass begins.
+enum class LoadOp : std::uint8_t {
+    Load,       // VK: LOAD      | D3D12: PRESERVE | Metal: MTLLoadActionLoad     | GL: no-op
+    Clear,      // VK: CLEAR     | D3D12: CLEAR    | Metal: MTLLoadActionClear    | GL: glClearBuffer*
+    DontCare    // VK: DONT_CARE | D3D12: DISCARD  | Metal: MTLLoadActionDontCare | GL: glInvalidateFramebuffer
+};
+
+/// @brief What happens to an attachment's contents when a render pass ends.
+enum class StoreOp : std::uint8_t {
+    Store,      // VK: STORE     | D3D12: PRESERVE | Metal: MTLStoreActionStore    | GL: no-op
+    DontCare    // VK: DONT_CARE | D3D12: DISCARD  | Metal: MTLStoreActionDontCare | GL: glInvalidateFramebuffer
+};
+
 [[nodiscard]] inline const char *to_string(Backend b) {
   switch (b) {
     case Backend::OpenGL: return "OpenGL";
@@ -433,6 +516,8 @@ template<> struct enable_flags<wren::rhi::ShaderStage>    : std::true_type {};
 template<> struct enable_flags<wren::rhi::ColorWriteMask> : std::true_type {};
 template<> struct enable_flags<wren::rhi::TextureUsage>   : std::true_type {};
 template<> struct enable_flags<wren::rhi::BufferUsage>    : std::true_type {};
+template<> struct enable_flags<wren::rhi::AccelerationStructureFlags>         : std::true_type {};
+template<> struct enable_flags<wren::rhi::AccelerationStructureInstanceFlags> : std::true_type {};
 } // namespace wren::foundation
 
 #endif // WREN_RHI_API_ENUMS_HPP
@@ -7,6 +7,10 @@
 #include <wren/foundation/utility/enum_utils.hpp>
 #include <wren/rhi/api/enums.hpp>
 
+namespace wren::foundation::jobs {
+class JobSystem;
+} // namespace wren::foundation::jobs
+
 namespace wren::rhi {
 
 // Import bitwise-operator templates from wren::foundation so they are
@@ -309,7 +313,8 @@ enum class Feature : std::uint64_t {
 
     /// Sparse/tiled resources (partially resident textures & buffers).
     ///
-    /// - **Vulkan** – Sparse binding / aliased residency (core + extensions)
+    /// - **Vulkan** – `sparseBinding` + `sparseResidencyImage2D`; pages of
+    ///   TextureDesc::sparse textures are bound with vkQueueBindSparse
     /// - **D3D12** – Tiled Resources
     ///   https://learn.microsoft.com/windows/win32/direct3d12/tiled-resources
     /// - **OpenGL** – `ARB_sparse_texture` (+ variants)
@@ -384,6 +389,129 @@ enum class Feature : std::uint64_t {
     /// - **Metal** – Push/pop debug groups, object labels.
     DebugMarkers_Labels = 1ull << 31,
 
+    /// @}
+    /// @name Queues
+    /// Informational: reported when present, never masked by the feature
+    /// request. Without them QueueType::Compute / Transfer alias Graphics.
+    /// @{
+
+    /// A compute queue that runs concurrently with graphics work.
+    ///
+    /// - **Vulkan** – a queue family with `VK_QUEUE_COMPUTE_BIT` and no `VK_QUEUE_GRAPHICS_BIT`
+    ///   https://registry.khronos.org/vulkan/specs/latest/man/html/VkQueueFlagBits.html
+    /// - **D3D12** – `D3D12_COMMAND_LIST_TYPE_COMPUTE` queue
+    /// - **Metal** – a second `MTLCommandQueue`; concurrency is driver-managed.
+    /// - **OpenGL** – Not supported (single context).
+    AsyncCompute = 1ull << 32,
+
+    /// A copy queue backed by a dedicated DMA engine.
+    ///
+    /// - **Vulkan** – a queue family with `VK_QUEUE_TRANSFER_BIT` and neither graphics nor compute
+    /// - **D3D12** – `D3D12_COMMAND_LIST_TYPE_COPY` queue
+    /// - **Metal** – blit encoders on a separate queue.
+    /// - **OpenGL** – Not supported.
+    AsyncTransfer = 1ull << 33,
+
+    /// @}
+    /// @name Memory budget
+    /// Informational like the queue bits: reported when present, never masked.
+    /// @{
+
+    /// Driver-reported per-heap budget and usage behind MemoryBudget. Without
+    /// it the numbers are estimated from heap sizes and the RHI's own usage.
+    ///
+    /// - **Vulkan** – `VK_EXT_memory_budget`
+    ///   https://registry.khronos.org/vulkan/specs/latest/man/html/VK_EXT_memory_budget.html
+    /// - **D3D12** – `IDXGIAdapter3::QueryVideoMemoryInfo`
+    /// - **Metal** – `MTLDevice.recommendedMaxWorkingSetSize` / `currentAllocatedSize`
+    /// - **OpenGL** – `NVX_gpu_memory_info` / `ATI_meminfo` (vendor)
+    MemoryBudget = 1ull << 34,
+
+    /// @}
+    /// @name Pipeline compilation
+    /// Informational: used whenever present, never masked.
+    /// @{
+
+    /// Pipelines are built from separately compiled parts (vertex input,
+    /// pre-rasterisation shaders, fragment shader, fragment output) that are
+    /// shared between pipelines and linked without optimisation first, so a
+    /// new permutation is usable in a fraction of a full compile; the
+    /// optimised pipeline replaces it in the background.
+    ///
+    /// - **Vulkan** – `VK_EXT_graphics_pipeline_library` with `graphicsPipelineLibraryFastLinking`
+    ///   https://registry.khronos.org/vulkan/specs/latest/man/html/VK_EXT_graphics_pipeline_library.html
+    /// - **D3D12** – State object collections (`D3D12_STATE_OBJECT_TYPE_COLLECTION`, DXR only)
+    /// - **Metal** – `MTLBinaryArchive` / function pointers; no separate linking step.
+    /// - **OpenGL** – Not applicable; the driver links programs.
+    GraphicsPipelineLibrary = 1ull << 35,
+
+    /// @}
+    /// @name Profiling
+    /// Informational: used whenever present, never masked. Regions recorded
+    /// without them still emit their debug labels (commands.hpp).
+    /// @{
+
+    /// Timestamp queries on the graphics and compute queues, with host-side
+    /// query reset; behind the GPU times of profiling regions.
+    ///
+    /// - **Vulkan** – `timestampComputeAndGraphics` + `hostQueryReset` (1.2 core)
+    ///   https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdWriteTimestamp2.html
+    /// - **D3D12** – `D3D12_QUERY_HEAP_TYPE_TIMESTAMP`; the copy queue needs `D3D12_QUERY_HEAP_TYPE_COPY_QUEUE_TIMESTAMP`
+    /// - **Metal** – `MTLCounterSampleBuffer` with `MTLCommonCounterSetTimestamp`
+    /// - **OpenGL** – `ARB_timer_query` (`GL_TIMESTAMP`)
+    TimestampQueries = 1ull << 36,
+
+    /// Pipeline-statistics queries (vertex, primitive and shader invocation
+    /// counts) on profiling regions that ask for them.
+    ///
+    /// - **Vulkan** – `pipelineStatisticsQuery` feature bit
+    ///   https://registry.khronos.org/vulkan/specs/latest/man/html/VkQueryPipelineStatisticFlagBits.html
+    /// - **D3D12** – `D3D12_QUERY_TYPE_PIPELINE_STATISTICS`
+    /// - **Metal** – Not available.
+    /// - **OpenGL** – `ARB_pipeline_statistics_query`
+    PipelineStatistics = 1ull << 37,
+
+    /// GPU timestamps correlated with the host clock, so GPU regions line
+    /// up with CPU profiler zones.
+    ///
+    /// - **Vulkan** – `VK_EXT_calibrated_timestamps`
+    ///   https://registry.khronos.org/vulkan/specs/latest/man/html/VK_EXT_calibrated_timestamps.html
+    /// - **D3D12** – `ID3D12CommandQueue::GetClockCalibration`
+    /// - **Metal** – `MTLDevice.sampleTimestamps(_:gpuTimestamp:)`
+    /// - **OpenGL** – Not available.
+    CalibratedTimestamps = 1ull << 38,
+
+    /// @}
+    /// @name Presentation pacing
+    /// Informational: used whenever present together with Presentation.
+    /// @{
+
+    /// Waiting on the host until a given present has reached the display,
+    /// behind Swapchain::wait_for_present(). Without it the wait ends when
+    /// the GPU has finished the frame instead.
+    ///
+    /// - **Vulkan** – `VK_KHR_present_id` + `VK_KHR_present_wait`
+    ///   https://registry.khronos.org/vulkan/specs/latest/man/html/VK_KHR_present_wait.html
+    /// - **D3D12** – `IDXGISwapChain2::GetFrameLatencyWaitableObject`
+    /// - **Metal** – `MTLDrawable.addPresentedHandler`
+    /// - **OpenGL** – Not available.
+    PresentWait = 1ull << 39,
+
+    /// @}
+    /// @name Ray tracing
+    /// @{
+
+    /// Building acceleration structures on the CPU, into structures created
+    /// with MemoryUsage::Upload, behind build_acceleration_structures_on_host.
+    /// Requires RayTracing. The GPU builds independently of it.
+    ///
+    /// - **Vulkan** – `accelerationStructureHostCommands` + `VK_KHR_deferred_host_operations`
+    ///   https://docs.vulkan.org/refpages/latest/refpages/source/VK_KHR_deferred_host_operations.html
+    /// - **D3D12** – Not available.
+    /// - **Metal** – Not available.
+    /// - **OpenGL** – Not available.
+    AccelerationStructureHostBuild = 1ull << 40,
+
     /// @}
     // Add new bits above; keep <= 64 bits or split into Feature2.
 };
@@ -469,11 +597,36 @@ struct DeviceLimits {
     uint32_t maxComputeWorkGroupInvocations;    ///< Max total invocations per work-group (X × Y × Z).
     /// @}
 
+    /// @name Indirect draws
+    /// @{
+    uint32_t maxDrawIndirectCount;  ///< Max IndirectDrawDesc::maxDrawCount; 1 without Feature::MultiDrawIndirect.
+    /// @}
+
+    /// @name Device groups
+    /// @{
+    /// Physical devices the device drives; CommandListDesc::deviceMask and
+    /// device_mask_packet() select among them. 1 unless created with
+    /// DeviceFlag::DeviceGroup on an adapter whose deviceGroupSize is above 1.
+    uint32_t deviceCount;
+    /// @}
+
+    /// @name Ray tracing
+    /// All 0 without Feature::RayTracing.
+    /// @{
+    uint32_t accelerationStructureScratchAlignment;    ///< Alignment of AccelerationStructureBuild::scratchOffset.
+    uint32_t maxAccelerationStructureGeometryCount;    ///< Max AccelerationStructureInputs::triangleCount.
+    uint64_t maxAccelerationStructureInstanceCount;    ///< Max AccelerationStructureInputs::instanceCount.
+    uint64_t maxAccelerationStructurePrimitiveCount;   ///< Max triangles over a BLAS's geometries.
+    /// @}
+
     /// @name Timing
     /// @{
     /// Ticks per second of the device timestamp counter.
     /// Set to 1 when timestamps are emulated or unavailable.
     uint64_t timelineTickFrequency;
+    /// Nanoseconds per timestamp tick; profiling results are already
+    /// converted with it. 0 without Feature::TimestampQueries.
+    float timestampPeriod;
     /// @}
 };
 
@@ -504,13 +657,17 @@ struct DeviceFeatureRequest {
 /// Flags that control global device behaviour.
 ///
 /// - `Debug`        – Enable API validation layers / `KHR_debug` / D3D12 debug layer / Metal validation.
-/// - `Headless`     – No swapchain / presentation; use off-screen render targets.
+/// - `Headless`     – No swapchain / presentation; use off-screen render targets. The
+///                    backend drops `Feature::Presentation` from the request (requiring it
+///                    fails) and a private instance skips the window-system extensions, so
+///                    the process needs no display or windowing library.
 /// - `HighPriority` – Hint for a high-priority queue if the platform supports it.
 enum class DeviceFlag : uint32_t {
     None         = 0,
     Debug        = 1u << 0,   ///< Enable API validation / debug layers.
-    Headless     = 1u << 1,   ///< Off-screen only; no presentation.
+    Headless     = 1u << 1,   ///< Off-screen only; no presentation or window system.
     HighPriority = 1u << 2,   ///< Prefer high-priority / compute queue.
+    DeviceGroup  = 1u << 3,   ///< Span every adapter of the preferred adapter's device group.
 };
 
 [[nodiscard]] constexpr bool has_any(DeviceFlag set, DeviceFlag bits) noexcept {
@@ -522,15 +679,94 @@ enum class DeviceFlag : uint32_t {
 /// @par Platform notes
 /// - **Vulkan** – `nativeWindowHandle` is forwarded to the platform layer
 ///   (e.g. GLFW) to create a `VkSurfaceKHR`.
-/// - **OpenGL** – `nativeWindowHandle` (or a GLFW window) is used to create
-///   the GL context.
+/// - **OpenGL** – `nativeWindowHandle` is ignored: the device owns a hidden
+///   GLFW window whose 4.5+ core context it keeps current on the creating
+///   thread, which must be the main thread. `preferredAdapterIndex` is
+///   ignored too; the driver picks the GPU.
 /// - **D3D12** – Used to create an `IDXGISwapChain*` when presenting.
 /// - **Metal** – Maps to a `CAMetalLayer` host window when presenting.
+///
+/// @par Pipeline cache
+/// - **Vulkan** – `pipelineCacheDirectory` holds one `VkPipelineCache` file
+///   per GPU, invalidated when the driver or device changes.
+/// - **OpenGL** – Ignored; drivers keep their own program binary caches.
+///
+/// @par Capability cache
+/// - **Vulkan** – `capabilityCacheDirectory` holds one file per GPU with the
+///   feature, property, extension and queue family queries, keyed by driver
+///   version and `pipelineCacheUUID`. Without it the driver is still queried
+///   only once per GPU and process.
+///
+/// @par Pipeline compilation
+/// - `jobSystem` must outlive the device. Without it pipelines compile inside
+///   the create call on the calling thread, and host acceleration structure
+///   builds run on the calling thread alone.
 struct DeviceDesc {
-    void*                nativeWindowHandle    = nullptr;           ///< Window/view handle; null for headless.
-    uint32_t             preferredAdapterIndex = 0;                 ///< Adapter hint for multi-GPU systems (0 = default).
-    DeviceFlag           flags                 = DeviceFlag::None;  ///< Behaviour flags.
-    DeviceFeatureRequest featureRequest{};                          ///< Required/preferred feature negotiation.
+    void*                        nativeWindowHandle       = nullptr;           ///< Window/view handle; null for headless.
+    uint32_t                     preferredAdapterIndex    = 0;                 ///< Adapter hint for multi-GPU systems (0 = default).
+    DeviceFlag                   flags                    = DeviceFlag::None;  ///< Behaviour flags.
+    DeviceFeatureRequest         featureRequest{};                             ///< Required/preferred feature negotiation.
+    uint32_t                     framesInFlight           = 2;                 ///< CPU frames recorded ahead of the GPU (1..3).
+    const char*                  pipelineCacheDirectory   = nullptr;           ///< On-disk pipeline cache location; null disables it.
+    const char*                  capabilityCacheDirectory = nullptr;           ///< On-disk adapter capability cache location; null disables it.
+    foundation::jobs::JobSystem* jobSystem                = nullptr;           ///< Runs background pipeline compiles; null compiles inline.
+};
+
+/// Descriptor passed to the backend when creating a shared instance.
+///
+/// An instance is the per-process part of device creation — loader and
+/// driver initialisation, layers, adapter enumeration — made once and
+/// shared by every device created from it and by the adapter picker.
+///
+/// @par Platform notes
+/// - **Vulkan** – One `VkInstance` and, with `debug`, the validation layer
+///   and debug messenger. Validation follows `debug` here, not
+///   `DeviceFlag::Debug` of the devices created from the instance. Unless
+///   `headless`, `VK_KHR_surface` and the platform's surface extensions
+///   are enabled when available.
+/// - **OpenGL** – No instance object. `debug` asks the devices created from
+///   the instance for debug contexts; adapter enumeration creates one
+///   throwaway context, on the first call, and reports a single adapter.
+/// - **D3D12 / Metal** – Not implemented yet; creation fails.
+struct InstanceDesc {
+    const char* applicationName          = nullptr;  ///< Reported to the driver; null reports "wren".
+    uint32_t    applicationVersion       = 0;        ///< Reported to the driver alongside the name.
+    bool        debug                    = false;    ///< Enable API validation / debug layers.
+    bool        headless                 = false;    ///< Skip the window-system extensions; no swapchains.
+    const char* capabilityCacheDirectory = nullptr;  ///< As DeviceDesc's, for adapter enumeration.
+};
+
+/// Physical device category.
+enum class AdapterType : uint8_t {
+    Other,
+    Integrated,
+    Discrete,
+    Virtual,
+    Cpu,
+};
+
+/// Capacity of AdapterDesc::name, including the null terminator.
+inline constexpr uint32_t k_max_adapter_name = 256;
+
+/// Adapter snapshot returned by instance adapter enumeration. Trivially
+/// copyable so it crosses the backend ABI by value.
+///
+/// `index` is what DeviceDesc::preferredAdapterIndex refers to, and
+/// `capabilities` is what a device on it could enable, before feature
+/// negotiation. Linked GPUs the driver exposes as one device group share a
+/// `deviceGroup`; DeviceFlag::DeviceGroup drives all of them from a single
+/// device. Every other adapter is a group of one.
+struct AdapterDesc {
+    uint32_t     index              = 0;                   ///< Position in the instance's adapter list.
+    char         name[k_max_adapter_name]{};               ///< Null-terminated driver-reported name.
+    AdapterType  type               = AdapterType::Other;  ///< Integrated / Discrete / Virtual / Cpu / Other.
+    uint32_t     vendorId           = 0;                   ///< PCI vendor ID.
+    uint32_t     deviceId           = 0;                   ///< PCI device ID.
+    uint32_t     driverVersion      = 0;                   ///< Driver-defined encoding.
+    uint64_t     videoMemoryBytes   = 0;                   ///< Approximate device-local memory.
+    uint32_t     deviceGroup        = 0;                   ///< Device group the adapter belongs to.
+    uint32_t     deviceGroupSize    = 1;                   ///< Adapters in that group, this one included.
+    Capabilities capabilities{};                           ///< Supported features and limits.
 };
 
 
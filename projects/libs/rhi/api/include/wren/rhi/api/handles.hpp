@@ -0,0 +1,36 @@
+#ifndef WREN_RHI_API_HANDLES_HPP
+#define WREN_RHI_API_HANDLES_HPP
+
+#include <wren/foundation/containers/handle.hpp>
+
+namespace wren::rhi {
+
+// ===================================================================================
+// Resource handles
+//   32-bit generational handles (20-bit slot index, 12-bit generation) issued by
+//   the backend's slot maps. Zero is the null handle. A destroyed resource's
+//   handle goes stale: the backend rejects it instead of touching whatever now
+//   occupies the slot.
+//
+//   Handles are plain 4-byte values, so they cross the BackendVTable ABI by value
+//   and in contiguous arrays for the bulk create/destroy entry points.
+// ===================================================================================
+
+struct BufferTag;
+struct TextureTag;
+struct PipelineTag;
+struct HeapTag;
+struct ShaderModuleTag;
+struct AccelerationStructureTag;
+
+using BufferHandle   = wren::foundation::containers::Handle<BufferTag>;
+using TextureHandle  = wren::foundation::containers::Handle<TextureTag>;
+using PipelineHandle = wren::foundation::containers::Handle<PipelineTag>;
+using HeapHandle     = wren::foundation::containers::Handle<HeapTag>;
+
+using ShaderModuleHandle          = wren::foundation::containers::Handle<ShaderModuleTag>;
+using AccelerationStructureHandle = wren::foundation::containers::Handle<AccelerationStructureTag>;
+
+} // namespace wren::rhi
+
+#endif // WREN_RHI_API_HANDLES_HPP
@@ -0,0 +1,230 @@
+#ifndef WREN_RHI_API_PIPELINES_HPP
+#define WREN_RHI_API_PIPELINES_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/handles.hpp>
+
+namespace wren::rhi {
+
+// ===================================================================================
+// Pipeline state objects (ARCHITECTURE.md §4.7)
+//   Creation returns handles at once. When DeviceDesc::jobSystem is set the
+//   backend compiles on its workers, most urgent pipeline first; otherwise
+//   it compiles before returning. Meanwhile a caller may poll
+//   pipeline_status(), let cmd_bind_pipeline() substitute a fallback, or
+//   block in wait_pipelines() behind a loading screen.
+//
+//   Every pipeline reads viewport and scissor from cmd_set_viewport /
+//   cmd_set_scissor, and renders with dynamic rendering into the formats
+//   named by its RenderTargetLayout. All pipelines share one layout: the
+//   bindless heap at set 0 (resources.hpp) and k_max_push_constant_bytes of
+//   push constants visible to every stage.
+// ===================================================================================
+
+/// Push constant range of every pipeline, written by cmd_push_constants.
+inline constexpr uint32_t k_max_push_constant_bytes = 128;
+
+/// Upper bounds of a VertexInputLayout.
+inline constexpr uint32_t k_max_vertex_bindings   = 16;
+inline constexpr uint32_t k_max_vertex_attributes = 16;
+
+// ===================================================================================
+// Shader modules (ARCHITECTURE.md §4.7)
+//   A module is SPIR-V loaded once and reflected once. The device keeps one
+//   driver module per distinct SPIR-V, keyed by a 64-bit hash of the code,
+//   so the thousands of permutations a level loads share the stages they
+//   have in common and never re-parse them. Pipelines reference modules by
+//   handle; raw code in a ShaderStageDesc goes through the same cache.
+// ===================================================================================
+
+/// Upper bounds of a ShaderReflection.
+inline constexpr uint32_t k_max_shader_entry_points   = 4;
+inline constexpr uint32_t k_max_shader_bindings       = 32;
+inline constexpr uint32_t k_max_entry_point_name_size = 64;  ///< Including the terminator.
+
+/// Parameters for BackendVTable::create_shader_modules. The code is read
+/// in place during the call and never copied, so it may point straight
+/// into a memory-mapped pack file (wren/rhi/transfer/shader_pack.hpp).
+struct ShaderModuleDesc {
+    void const* code      = nullptr;  ///< SPIR-V; 4-byte aligned.
+    std::size_t codeSize  = 0;        ///< In bytes; a multiple of 4.
+    const char* debugName = nullptr;  ///< Optional; attached when debug labels are enabled.
+};
+
+/// Kind of a descriptor a shader declares.
+enum class ShaderResourceKind : uint8_t {
+    UniformBuffer,
+    StorageBuffer,
+    SampledImage,
+    StorageImage,
+    Sampler,
+    CombinedImageSampler,
+    AccelerationStructure,
+};
+
+struct ShaderResourceBinding {
+    uint32_t           set     = 0;
+    uint32_t           binding = 0;
+    uint32_t           count   = 1;  ///< Array length; 0 for a runtime-sized array.
+    ShaderResourceKind kind    = ShaderResourceKind::UniformBuffer;
+};
+
+struct ShaderEntryPoint {
+    ShaderStage stage = ShaderStage::None;
+    char        name[k_max_entry_point_name_size]{};
+    uint32_t    localSize[3]{};  ///< Workgroup size; compute, task and mesh stages only.
+};
+
+/// What a module declares, parsed from its SPIR-V when it is created.
+struct ShaderReflection {
+    uint64_t              hash   = 0;                  ///< Content hash the cache keys on.
+    ShaderStage           stages = ShaderStage::None;  ///< Union of the entry points' stages.
+    uint32_t              entryPointCount = 0;
+    ShaderEntryPoint      entryPoints[k_max_shader_entry_points];
+    uint32_t              pushConstantBytes = 0;       ///< Size of the push constant block; 0 if none.
+    uint32_t              inputLocations    = 0;       ///< Bit per stage input location below 32.
+    uint32_t              bindingCount      = 0;       ///< The first k_max_shader_bindings are listed.
+    ShaderResourceBinding bindings[k_max_shader_bindings];
+};
+
+/// One shader of a pipeline: a module, or SPIR-V that is looked up in the
+/// module cache at creation and only has to outlive the create call.
+struct ShaderStageDesc {
+    ShaderStage        stage      = ShaderStage::None;  ///< Exactly one stage bit.
+    void const*        code       = nullptr;
+    std::size_t        codeSize   = 0;                  ///< In bytes.
+    const char*        entryPoint = "main";
+    ShaderModuleHandle module{};                        ///< When set, code and codeSize are ignored.
+};
+
+struct VertexBinding {
+    uint32_t binding     = 0;
+    uint32_t stride      = 0;
+    bool     perInstance = false;
+};
+
+struct VertexAttribute {
+    uint32_t     location = 0;
+    uint32_t     binding  = 0;
+    VertexFormat format   = VertexFormat::RGB32_Float;
+    uint32_t     offset   = 0;
+};
+
+/// Vertex buffer layout. Empty for pipelines that fetch vertices themselves.
+struct VertexInputLayout {
+    uint32_t        bindingCount   = 0;
+    VertexBinding   bindings[k_max_vertex_bindings]{};
+    uint32_t        attributeCount = 0;
+    VertexAttribute attributes[k_max_vertex_attributes]{};
+};
+
+struct RasterizerStateDesc {
+    CullMode  cullMode             = CullMode::Back;
+    FrontFace frontFace            = FrontFace::CCW;
+    FillMode  fillMode             = FillMode::Solid;  ///< Wireframe needs Feature::NonSolidFill.
+    bool      depthClamp           = false;            ///< Needs Feature::DepthClamp.
+    float     depthBias            = 0.0f;             ///< Constant factor; bias is off when both are 0.
+    float     slopeScaledDepthBias = 0.0f;
+    float     depthBiasClamp       = 0.0f;
+};
+
+struct StencilOpState {
+    StencilOp failOp      = StencilOp::Keep;
+    StencilOp depthFailOp = StencilOp::Keep;
+    StencilOp passOp      = StencilOp::Keep;
+    CompareOp compareOp   = CompareOp::Always;
+};
+
+struct DepthStencilStateDesc {
+    bool           depthTestEnable   = false;
+    bool           depthWriteEnable  = false;
+    CompareOp      depthCompareOp    = CompareOp::LessEqual;
+    bool           stencilTestEnable = false;
+    uint8_t        stencilReadMask   = 0xFF;
+    uint8_t        stencilWriteMask  = 0xFF;
+    uint8_t        stencilReference  = 0;
+    StencilOpState front{};
+    StencilOpState back{};
+};
+
+struct ColorAttachmentBlendDesc {
+    bool           blendEnable = false;
+    BlendFactor    srcColor    = BlendFactor::One;
+    BlendFactor    dstColor    = BlendFactor::Zero;
+    BlendOp        colorOp     = BlendOp::Add;
+    BlendFactor    srcAlpha    = BlendFactor::One;
+    BlendFactor    dstAlpha    = BlendFactor::Zero;
+    BlendOp        alphaOp     = BlendOp::Add;
+    ColorWriteMask writeMask   = ColorWriteMask::All;
+};
+
+/// One entry per colour format of the pipeline's RenderTargetLayout.
+struct BlendStateDesc {
+    ColorAttachmentBlendDesc attachments[k_max_color_attachments]{};
+};
+
+/// Parameters for BackendVTable::create_graphics_pipelines.
+struct GraphicsPipelineDesc {
+    ShaderStageDesc const* shaders     = nullptr;  ///< Vertex (+ tessellation, geometry) or Task + Mesh, and Fragment.
+    uint32_t               shaderCount = 0;
+
+    PrimitiveTopology topology           = PrimitiveTopology::TriangleList;
+    uint32_t          patchControlPoints = 0;  ///< PatchList only.
+
+    VertexInputLayout     vertexInput{};
+    RasterizerStateDesc   rasterizer{};
+    DepthStencilStateDesc depthStencil{};
+    BlendStateDesc        blend{};
+    RenderTargetLayout    renderTargets{};     ///< Also carries the MSAA sample count.
+
+    /// Bound by cmd_bind_pipeline() in this pipeline's place until it is
+    /// ready, e.g. an uber-shader variant. Must render into the same
+    /// RenderTargetLayout. Null: the binding thread waits for the compile.
+    PipelineHandle fallback{};
+
+    const char* debugName = nullptr;
+};
+
+/// Parameters for BackendVTable::create_compute_pipelines.
+struct ComputePipelineDesc {
+    ShaderStageDesc shader{};    ///< stage must be ShaderStage::Compute.
+    PipelineHandle  fallback{};  ///< As GraphicsPipelineDesc::fallback.
+    const char*     debugName = nullptr;
+};
+
+/// Compile state reported by BackendVTable::pipeline_status.
+enum class PipelineStatus : uint8_t {
+    Pending,  ///< Queued or compiling.
+    Ready,    ///< Can be bound.
+    Failed    ///< The driver rejected it, or the handle is null or stale.
+};
+
+// ===================================================================================
+// Pipeline cache (ARCHITECTURE.md §6.1)
+//   Compiled pipelines are kept in a driver cache that the backend persists
+//   under DeviceDesc::pipelineCacheDirectory, so warm starts skip compilation.
+// ===================================================================================
+
+/// Snapshot returned by BackendVTable::query_pipeline_cache.
+struct PipelineCacheStats {
+    uint64_t hits        = 0;      ///< Pipelines the driver found in the cache.
+    uint64_t misses      = 0;      ///< Pipelines that had to be compiled.
+    uint64_t loadedBytes = 0;      ///< Cache data accepted from disk at device creation.
+    uint64_t savedBytes  = 0;      ///< Size of the last file written.
+    bool     enabled     = false;  ///< A cache directory was given and the backend supports it.
+    bool     loaded      = false;  ///< A matching file was found; false when absent, stale or corrupt.
+
+    uint64_t shaderModules     = 0;  ///< Distinct shader modules alive.
+    uint64_t shaderModuleHits  = 0;  ///< Module lookups served by an existing module.
+    uint64_t shaderModuleBytes = 0;  ///< SPIR-V parsed and handed to the driver so far.
+
+    uint64_t pipelineHits = 0;  ///< Pipeline creations served by a live pipeline with equal state.
+};
+
+} // namespace wren::rhi
+
+#endif // WREN_RHI_API_PIPELINES_HPP
@@ -0,0 +1,306 @@
+#ifndef WREN_RHI_API_RESOURCES_HPP
+#define WREN_RHI_API_RESOURCES_HPP
+
+#include <cstdint>
+
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/handles.hpp>
+
+namespace wren::rhi {
+
+/// Creation parameters for a buffer.
+///
+/// Passed by pointer (single or array) to BackendVTable::create_buffers; only
+/// needs to stay valid for the duration of the call. Storage buffers get a
+/// StorageBuffer slot in the bindless heap when it is enabled.
+struct BufferDesc {
+    uint64_t    size      = 0;                     ///< Size in bytes; must be non-zero.
+    BufferUsage usage     = BufferUsage::None;     ///< Every way the buffer will be bound.
+    MemoryUsage memory    = MemoryUsage::GpuOnly;  ///< Access pattern; selects the heap.
+    const char* debugName = nullptr;               ///< Optional; attached when debug labels are enabled.
+};
+
+/// Creation parameters for a texture.
+///
+/// `depth` applies to Tex3D only; `arrayLayers` to every other dimension
+/// (a Cube must use a multiple of 6). Multisampled textures must be Tex2D
+/// with `mipLevels == 1`. Sampled and Storage usage each add the default
+/// view to the matching bindless heap array when the heap is enabled.
+///
+/// With `heap` set the texture is placed at `heapOffset` inside that memory
+/// heap instead of getting memory of its own (see Aliasing heaps below).
+/// With `sparse` set it gets no memory at all; pages of it are bound to
+/// heap memory later (see Sparse textures below).
+struct TextureDesc {
+    TextureDimension dimension   = TextureDimension::Tex2D;
+    TextureFormat    format      = TextureFormat::RGBA8_UNorm;
+    TextureUsage     usage       = TextureUsage::None;
+    SampleCount      samples     = SampleCount::C1;
+    uint32_t         width       = 1;
+    uint32_t         height      = 1;
+    uint32_t         depth       = 1;
+    uint32_t         mipLevels   = 1;
+    uint32_t         arrayLayers = 1;
+    HeapHandle       heap{};                  ///< Optional; null allocates memory for the texture.
+    uint64_t         heapOffset  = 0;         ///< Byte offset into `heap`; a multiple of the required alignment.
+    bool             sparse      = false;     ///< Partially resident; needs Feature::SparseResources and no `heap`.
+    const char*      debugName   = nullptr;   ///< Optional; attached when debug labels are enabled.
+};
+
+// ===================================================================================
+// Device memory (ARCHITECTURE.md §8)
+//   Backends place resources in large memory blocks they sub-allocate, so the
+//   number of driver allocations stays far below the API limit. The structs
+//   below report live usage and drive compaction.
+// ===================================================================================
+
+/// Upper bound on the memory heaps a MemoryBudget reports.
+inline constexpr uint32_t k_max_memory_heaps = 16;
+
+/// Live numbers for one memory heap.
+///
+/// `budget` and `usage` cover the whole process (every API user, not only
+/// this device). They are driver-reported when Feature::MemoryBudget is
+/// present and estimated from the heap size and the RHI's own allocations
+/// otherwise.
+struct MemoryHeapBudget {
+    uint64_t size            = 0;      ///< Total heap size in bytes.
+    uint64_t budget          = 0;      ///< Bytes the process can use before evictions or failures start.
+    uint64_t usage           = 0;      ///< Bytes the process currently uses.
+    uint64_t blockBytes      = 0;      ///< Device memory this device allocated in the heap.
+    uint64_t allocationBytes = 0;      ///< Part of blockBytes held by live resources.
+    bool     deviceLocal     = false;  ///< GPU-local heap (VRAM on discrete adapters).
+};
+
+/// Snapshot returned by BackendVTable::query_memory_budget.
+struct MemoryBudget {
+    uint32_t         heapCount = 0;
+    MemoryHeapBudget heaps[k_max_memory_heaps]{};
+
+    uint32_t deviceMemoryCount    = 0;  ///< Live driver allocations (blocks and dedicated).
+    uint32_t maxDeviceMemoryCount = 0;  ///< Driver limit on deviceMemoryCount.
+    uint32_t resourceCount        = 0;  ///< Buffers and textures holding memory.
+};
+
+/// Parameters for BackendVTable::defragment_memory. Bounding the work lets
+/// a caller spread compaction over several frames.
+struct DefragmentDesc {
+    uint64_t maxBytesToMove       = UINT64_MAX;
+    uint32_t maxAllocationsToMove = UINT32_MAX;
+};
+
+struct DefragmentStats {
+    uint64_t bytesMoved       = 0;
+    uint32_t allocationsMoved = 0;
+    uint64_t bytesReleased    = 0;  ///< Device memory returned to the driver.
+    uint32_t blocksReleased   = 0;
+};
+
+// ===================================================================================
+// Aliasing heaps (ARCHITECTURE.md §8)
+//   A memory heap is one GPU-only allocation that textures are placed into
+//   at caller-chosen offsets. Textures whose ranges overlap alias: only one
+//   of them may be in use at a time, and a placed texture's contents are
+//   undefined until it is written. Hand the memory over with a barrier that
+//   names the previous occupant's last usage as oldUsage and sets `discard`
+//   on the new texture (commands.hpp). Render graphs use heaps to share
+//   memory between transient attachments whose lifetimes do not overlap.
+//
+//   Destroy every texture placed in a heap before the heap itself.
+// ===================================================================================
+
+/// Size and placement constraints of a texture, from
+/// BackendVTable::texture_memory_requirements.
+struct MemoryRequirements {
+    uint64_t size      = 0;
+    uint64_t alignment = 1;
+    /// Opaque backend mask. A texture can be placed in a heap whose
+    /// MemoryHeapDesc::compatibility intersects it.
+    uint32_t compatibility = 0;
+};
+
+/// Parameters for BackendVTable::create_memory_heaps.
+struct MemoryHeapDesc {
+    uint64_t    size          = 0;        ///< In bytes; must be non-zero.
+    uint32_t    compatibility = 0;        ///< AND of the placed textures' MemoryRequirements::compatibility.
+    const char* debugName     = nullptr;  ///< Optional; attached when debug labels are enabled.
+};
+
+// ===================================================================================
+// Sparse textures (ARCHITECTURE.md §8)
+//   A sparse texture is created without memory and split into pages of a
+//   fixed texel size. Pages are bound to, and unbound from, aliasing heap
+//   memory with BackendVTable::bind_sparse while the texture stays in use,
+//   so only the part that is actually sampled occupies memory. Sampling a
+//   page that is not bound returns zero.
+//
+//   The finest mips are made of pages. The coarsest ones, smaller than a
+//   page, are packed together into one mip tail per array layer that is
+//   bound as a whole. Sparse textures are single-sample Tex2D textures of a
+//   colour format.
+// ===================================================================================
+
+/// Page layout of a sparse texture, from BackendVTable::sparse_texture_info.
+struct SparseTextureInfo {
+    uint32_t pageWidth     = 0;  ///< Texels per page; pages at a mip's edge are clipped to it.
+    uint32_t pageHeight    = 0;
+    uint64_t pageBytes     = 0;  ///< Memory of one page; heap offsets bound to pages are multiples of it.
+    uint32_t compatibility = 0;  ///< As MemoryRequirements::compatibility, for the heaps pages are bound to.
+    uint32_t mipTailFirst  = 0;  ///< First mip level in the mip tail; mipLevels when there is none.
+    uint64_t mipTailBytes  = 0;  ///< Memory of one array layer's mip tail; a multiple of pageBytes.
+    bool     singleMipTail = false;  ///< One tail covers every layer; bind it through layer 0.
+};
+
+// ===================================================================================
+// Acceleration structures (ARCHITECTURE.md §4.15)
+//   Ray-tracing geometry lives in acceleration structures: bottom-level ones
+//   (BLAS) hold triangles, top-level ones (TLAS) hold instances of BLASes.
+//   A structure is created with a size from
+//   BackendVTable::acceleration_structure_sizes and filled by a build, on
+//   the GPU (cmd_build_acceleration_structures) or, with
+//   Feature::AccelerationStructureHostBuild, on the CPU. Build inputs are
+//   read through buffer device addresses.
+// ===================================================================================
+
+enum class AccelerationStructureType : std::uint8_t {
+    BottomLevel,  // VK: BOTTOM_LEVEL | D3D12: BOTTOM_LEVEL | Metal: MTLPrimitiveAccelerationStructureDescriptor
+    TopLevel      // VK: TOP_LEVEL    | D3D12: TOP_LEVEL    | Metal: MTLInstanceAccelerationStructureDescriptor
+};
+
+/// One triangle geometry of a bottom-level structure. Buffers need
+/// BufferUsage::AccelerationStructureInput.
+struct AccelerationStructureTriangles {
+    BufferHandle vertexBuffer{};
+    uint64_t     vertexOffset = 0;
+    uint64_t     vertexStride = 12;
+    uint32_t     vertexCount  = 0;
+    VertexFormat vertexFormat = VertexFormat::RGB32_Float;  ///< Position format; RGB32_Float is always supported.
+    IndexType    indexType    = IndexType::Uint32;
+    BufferHandle indexBuffer{};                             ///< Optional; null for non-indexed triangles.
+    uint64_t     indexOffset     = 0;
+    uint32_t     triangleCount   = 0;
+    BufferHandle transformBuffer{};                         ///< Optional row-major 3x4 float matrix.
+    uint64_t     transformOffset = 0;
+    bool         opaque          = true;                    ///< Skips any-hit shaders.
+};
+
+/// One instance of a top-level structure, laid out as
+/// VkAccelerationStructureInstanceKHR and D3D12_RAYTRACING_INSTANCE_DESC so
+/// an instance buffer is written without conversion.
+struct AccelerationStructureInstance {
+    float    transform[3][4];                         ///< Row-major 3x4 object-to-world matrix.
+    uint32_t instanceCustomIndex : 24;
+    uint32_t mask                : 8;
+    uint32_t shaderBindingTableOffset : 24;
+    uint32_t flags                    : 8;            ///< AccelerationStructureInstanceFlags.
+    uint64_t accelerationStructure;                   ///< From BackendVTable::acceleration_structure_reference.
+};
+
+static_assert(sizeof(AccelerationStructureInstance) == 64);
+
+/// What a build reads. A bottom-level build reads `triangles`; a top-level
+/// one reads `instanceCount` AccelerationStructureInstance records at
+/// `instanceOffset` (a multiple of 16) in `instanceBuffer`.
+struct AccelerationStructureInputs {
+    AccelerationStructureType             type  = AccelerationStructureType::BottomLevel;
+    AccelerationStructureFlags            flags = AccelerationStructureFlags::PreferFastTrace;
+    const AccelerationStructureTriangles* triangles     = nullptr;
+    uint32_t                              triangleCount = 0;  ///< Geometries in `triangles`.
+    BufferHandle                          instanceBuffer{};
+    uint64_t                              instanceOffset = 0;
+    uint32_t                              instanceCount  = 0;
+};
+
+/// From BackendVTable::acceleration_structure_sizes; worst case for the
+/// inputs' counts, so the same sizes serve later builds with fewer.
+struct AccelerationStructureSizes {
+    uint64_t size              = 0;  ///< Bytes of the structure.
+    uint64_t buildScratchSize  = 0;  ///< Scratch bytes a build needs.
+    uint64_t updateScratchSize = 0;  ///< Scratch bytes an update needs; 0 without AllowUpdate.
+};
+
+struct AccelerationStructureDesc {
+    AccelerationStructureType type   = AccelerationStructureType::BottomLevel;
+    uint64_t                  size   = 0;                     ///< AccelerationStructureSizes::size or larger.
+    MemoryUsage               memory = MemoryUsage::GpuOnly;  ///< Upload for structures built on the host.
+    const char*               debugName = nullptr;
+};
+
+// ===================================================================================
+// Bindless heap (ARCHITECTURE.md §4.13)
+//   With Feature::DescriptorIndexing_Bindless enabled, the device owns one
+//   global descriptor heap that every pipeline sees at set 0. Resources enter
+//   it at creation and leave it on destruction; shaders address them by the
+//   index the queries below return, usually passed in push constants. The
+//   heap is bound once per command list, so draws bind no descriptors.
+//
+//   GLSL view of the heap:
+//     layout(set = 0, binding = 0) uniform texture2D g_textures[];  // SampledTexture
+//     layout(set = 0, binding = 1) uniform image2D   g_images[];    // StorageTexture
+//     layout(set = 0, binding = 2) buffer Buffers { uint data[]; } g_buffers[];  // StorageBuffer
+//     layout(set = 0, binding = 3) uniform sampler   g_samplers[];  // StaticSampler, then find_samplers()
+// ===================================================================================
+
+/// Index returned for resources outside the heap.
+inline constexpr uint32_t k_invalid_bindless_index = UINT32_MAX;
+
+/// One descriptor array of the heap; the value is its binding number.
+enum class BindlessClass : std::uint8_t {
+    SampledTexture,  ///< Textures with TextureUsage::Sampled.
+    StorageTexture,  ///< Textures with TextureUsage::Storage.
+    StorageBuffer,   ///< Buffers with BufferUsage::Storage.
+    Sampler,         ///< The StaticSampler table, then samplers from find_samplers().
+};
+
+inline constexpr uint32_t k_bindless_class_count = 4;
+
+/// Samplers the heap always holds, indexed by value.
+enum class StaticSampler : std::uint32_t {
+    LinearRepeat,
+    LinearClamp,
+    NearestRepeat,
+    NearestClamp,
+    AnisotropicRepeat,  ///< Up to 16x; plain linear without Feature::AnisotropicFiltering.
+};
+
+inline constexpr uint32_t k_static_sampler_count = 5;
+
+/// Length of the Sampler array, static samplers included. Bounded well
+/// below maxSamplerAllocationCount (4000 on most drivers).
+inline constexpr uint32_t k_max_samplers = 256;
+
+/// Parameters for BackendVTable::find_samplers. Small and padding-free, so
+/// the device's sampler cache hashes (wren/rhi/api/state_hash.hpp) and
+/// compares it in a few instructions. Equal descriptors share a heap index.
+struct SamplerDesc {
+    Filter      magFilter     = Filter::Linear;
+    Filter      minFilter     = Filter::Linear;
+    MipmapMode  mipmapMode    = MipmapMode::Linear;
+    AddressMode addressU      = AddressMode::Repeat;
+    AddressMode addressV      = AddressMode::Repeat;
+    AddressMode addressW      = AddressMode::Repeat;
+    BorderColor borderColor   = BorderColor::TransparentBlack;  ///< AddressMode::ClampToBorder only.
+    bool        compareEnable = false;                          ///< Depth comparison, for shadow maps.
+    CompareOp   compareOp     = CompareOp::Always;
+    uint8_t     maxAnisotropy = 1;  ///< 1 disables it; above 1 needs Feature::AnisotropicFiltering.
+    uint8_t     reserved[2]{};      ///< Zero.
+    float       mipLodBias    = 0.0f;
+    float       minLod        = 0.0f;
+    float       maxLod        = 1000.0f;  ///< 1000 or more: no clamp.
+
+    friend constexpr bool operator==(SamplerDesc const&, SamplerDesc const&) noexcept = default;
+};
+
+static_assert(sizeof(SamplerDesc) == 24);
+
+/// Snapshot returned by BackendVTable::query_bindless_heap.
+struct BindlessHeapInfo {
+    bool     enabled          = false;  ///< The heap exists; false leaves every index invalid.
+    bool     descriptorBuffer = false;  ///< Backed by VK_EXT_descriptor_buffer rather than a descriptor set.
+    uint32_t capacity[k_bindless_class_count]{};  ///< Per BindlessClass.
+    uint32_t used[k_bindless_class_count]{};      ///< Live entries per BindlessClass.
+};
+
+} // namespace wren::rhi
+
+#endif // WREN_RHI_API_RESOURCES_HPP
@@ -0,0 +1,172 @@
+#ifndef WREN_RHI_API_STATE_HASH_HPP
+#define WREN_RHI_API_STATE_HASH_HPP
+
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/pipelines.hpp>
+#include <wren/rhi/api/resources.hpp>
+
+namespace wren::rhi {
+
+// ===================================================================================
+// State hashing (ARCHITECTURE.md §4.7)
+//   Every state descriptor hashes field by field, so padding never reaches
+//   the hash and the functions are constexpr: a material system can hash
+//   its fixed presets at compile time and key its own tables on them. The
+//   backends key their sampler and pipeline caches on the same values.
+//
+//     constexpr SamplerDesc k_shadow{.compareEnable = true, .compareOp = CompareOp::LessEqual};
+//     static_assert(hash_state(k_shadow) != hash_state(SamplerDesc{}));
+// ===================================================================================
+
+/// FNV-1a over 64-bit field values, with a final avalanche so that the low
+/// bits are usable as a table index.
+class StateHasher {
+public:
+    template<typename T>
+        requires std::is_integral_v<T> || std::is_enum_v<T>
+    constexpr void add(T value) noexcept {
+        if constexpr (std::is_enum_v<T>)
+            mix(static_cast<uint64_t>(static_cast<std::underlying_type_t<T>>(value)));
+        else
+            mix(static_cast<uint64_t>(value));
+    }
+
+    /// -0.0 and 0.0 compare equal, so they hash equal.
+    constexpr void add(float value) noexcept { mix(value == 0.0f ? 0u : std::bit_cast<uint32_t>(value)); }
+
+    /// Characters up to the terminator, then the length.
+    constexpr void add(char const* text) noexcept {
+        uint64_t length = 0;
+        for (; text && text[length] != '\0'; ++length)
+            mix(static_cast<unsigned char>(text[length]));
+        mix(length);
+    }
+
+    [[nodiscard]] constexpr uint64_t value() const noexcept {
+        uint64_t h = hash_;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+private:
+    constexpr void mix(uint64_t value) noexcept { hash_ = (hash_ ^ value) * 0x100000001b3ull; }
+
+    uint64_t hash_ = 0xcbf29ce484222325ull;
+};
+
+constexpr void hash_append(StateHasher& h, SamplerDesc const& s) noexcept {
+    h.add(s.magFilter);
+    h.add(s.minFilter);
+    h.add(s.mipmapMode);
+    h.add(s.addressU);
+    h.add(s.addressV);
+    h.add(s.addressW);
+    h.add(s.borderColor);
+    h.add(s.compareEnable);
+    h.add(s.compareOp);
+    h.add(s.maxAnisotropy);
+    h.add(s.mipLodBias);
+    h.add(s.minLod);
+    h.add(s.maxLod);
+}
+
+/// Only the bindingCount / attributeCount entries in use.
+constexpr void hash_append(StateHasher& h, VertexInputLayout const& vi) noexcept {
+    h.add(vi.bindingCount);
+    for (uint32_t i = 0; i < vi.bindingCount && i < k_max_vertex_bindings; ++i) {
+        h.add(vi.bindings[i].binding);
+        h.add(vi.bindings[i].stride);
+        h.add(vi.bindings[i].perInstance);
+    }
+    h.add(vi.attributeCount);
+    for (uint32_t i = 0; i < vi.attributeCount && i < k_max_vertex_attributes; ++i) {
+        h.add(vi.attributes[i].location);
+        h.add(vi.attributes[i].binding);
+        h.add(vi.attributes[i].format);
+        h.add(vi.attributes[i].offset);
+    }
+}
+
+constexpr void hash_append(StateHasher& h, RasterizerStateDesc const& rs) noexcept {
+    h.add(rs.cullMode);
+    h.add(rs.frontFace);
+    h.add(rs.fillMode);
+    h.add(rs.depthClamp);
+    h.add(rs.depthBias);
+    h.add(rs.slopeScaledDepthBias);
+    h.add(rs.depthBiasClamp);
+}
+
+constexpr void hash_append(StateHasher& h, DepthStencilStateDesc const& ds) noexcept {
+    h.add(ds.depthTestEnable);
+    h.add(ds.depthWriteEnable);
+    h.add(ds.depthCompareOp);
+    h.add(ds.stencilTestEnable);
+    h.add(ds.stencilReadMask);
+    h.add(ds.stencilWriteMask);
+    h.add(ds.stencilReference);
+    for (StencilOpState const* s : {&ds.front, &ds.back}) {
+        h.add(s->failOp);
+        h.add(s->depthFailOp);
+        h.add(s->passOp);
+        h.add(s->compareOp);
+    }
+}
+
+constexpr void hash_append(StateHasher& h, ColorAttachmentBlendDesc const& b) noexcept {
+    h.add(b.blendEnable);
+    h.add(b.srcColor);
+    h.add(b.dstColor);
+    h.add(b.colorOp);
+    h.add(b.srcAlpha);
+    h.add(b.dstAlpha);
+    h.add(b.alphaOp);
+    h.add(b.writeMask);
+}
+
+/// Only the colorFormatCount formats in use, and the depth format only
+/// when there is one.
+constexpr void hash_append(StateHasher& h, RenderTargetLayout const& rt) noexcept {
+    h.add(rt.colorFormatCount);
+    for (uint32_t i = 0; i < rt.colorFormatCount && i < k_max_color_attachments; ++i)
+        h.add(rt.colorFormats[i]);
+    h.add(rt.hasDepthStencil);
+    if (rt.hasDepthStencil)
+        h.add(rt.depthStencilFormat);
+    h.add(rt.samples);
+}
+
+/// Every field of @p desc except the shaders, the fallback and the debug
+/// name: pipelines with equal values differ only in their code. Blend
+/// state counts only for the colour attachments in use.
+constexpr void hash_append(StateHasher& h, GraphicsPipelineDesc const& desc) noexcept {
+    h.add(desc.topology);
+    h.add(desc.patchControlPoints);
+    hash_append(h, desc.vertexInput);
+    hash_append(h, desc.rasterizer);
+    hash_append(h, desc.depthStencil);
+    hash_append(h, desc.renderTargets);
+    for (uint32_t i = 0; i < desc.renderTargets.colorFormatCount && i < k_max_color_attachments; ++i)
+        hash_append(h, desc.blend.attachments[i]);
+}
+
+/// Hash of one state descriptor.
+template<typename Desc>
+[[nodiscard]] constexpr uint64_t hash_state(Desc const& desc) noexcept {
+    StateHasher h;
+    hash_append(h, desc);
+    return h.value();
+}
+
+} // namespace wren::rhi
+
+#endif // WREN_RHI_API_STATE_HASH_HPP
@@ -14,7 +14,10 @@ enum class Status : uint8_t {
   UnsupportedLimit,
   OutOfMemory,
   InvalidArgument,
-  InternalError
+  InternalError,
+  Timeout,         // a wait with a finite timeout expired; not an error
+  IoError,         // a cache or other file could not be read or written
+  OutOfDate        // a swapchain no longer matches its surface; resize it
 };
 
 inline const char* to_string(Status s) {
@@ -27,6 +30,9 @@ inline const char* to_string(Status s) {
     case Status::UnsupportedLimit:       return "UnsupportedLimit";
     case Status::OutOfMemory:            return "OutOfMemory";
     case Status::InvalidArgument:        return "InvalidArgument";
+    case Status::Timeout:                return "Timeout";
+    case Status::IoError:                return "IoError";
+    case Status::OutOfDate:              return "OutOfDate";
     default:                             return "InternalError";
   }
 }
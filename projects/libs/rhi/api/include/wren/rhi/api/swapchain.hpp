@@ -0,0 +1,112 @@
+#ifndef WREN_RHI_API_SWAPCHAIN_HPP
+#define WREN_RHI_API_SWAPCHAIN_HPP
+
+#include <cstdint>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/handles.hpp>
+
+namespace wren::rhi {
+
+// ===================================================================================
+// Swapchains (ARCHITECTURE.md §4.12)
+//   A swapchain presents textures to one window surface. Its images are
+//   ordinary TextureHandles owned by the swapchain: they are rendered and
+//   transitioned like any texture, and TextureUsage::Present is the state an
+//   image must be in when it is presented.
+//
+//   One frame on the frame thread, for low input-to-photon latency:
+//
+//     swapchain.wait_for_present();   // pace: sleep here, not in acquire
+//     sample input, update the scene
+//     device.begin_frame();
+//     auto image = swapchain.acquire();
+//     record into image->texture; submit waiting on image->ready
+//     device.end_frame();
+//     swapchain.present();
+//
+//   wait_for_present() is where the CPU gives back the time the display
+//   would otherwise spend queuing frames: it returns once the frames still
+//   queued for display have dropped to maxFrameLatency - 1, so input sampled
+//   right after it is shown as early as the present mode allows.
+//
+//   Status::OutOfDate from acquire or present means the surface changed
+//   (typically a resize); call resize() with the new size and skip the frame.
+// ===================================================================================
+
+/// The window system a NativeWindow belongs to.
+enum class WindowSystem : uint8_t {
+    None,     ///< No window; swapchain creation fails.
+    Win32,    ///< display: HINSTANCE, window: HWND.
+    Xlib,     ///< display: Display*,  window: the X11 Window id cast to void*.
+    Wayland,  ///< display: wl_display*, window: wl_surface*.
+    Metal,    ///< display: unused,    window: CAMetalLayer*.
+};
+
+/// Platform handles of the window a swapchain presents to. The window must
+/// outlive the swapchain.
+struct NativeWindow {
+    WindowSystem system  = WindowSystem::None;
+    void*        display = nullptr;
+    void*        window  = nullptr;
+};
+
+/// How presented images reach the display.
+///
+/// Modes the surface lacks fall back: Mailbox → Immediate → Fifo,
+/// Immediate → Mailbox → Fifo, FifoRelaxed → Fifo. Fifo is always available.
+///
+/// - **Vulkan** – `VkPresentModeKHR` of the same name.
+/// - **D3D12** – Flip-model swap chains: Fifo is sync interval 1, Immediate
+///   and Mailbox are sync interval 0 (with `ALLOW_TEARING` for Immediate).
+/// - **Metal** – `CAMetalLayer.displaySyncEnabled` on (Fifo) or off.
+/// - **OpenGL** – Swap interval 1 (Fifo), 0 (Immediate) or -1 (FifoRelaxed).
+enum class PresentMode : uint8_t {
+    Fifo,         ///< Vsync; the queue blocks when full. No tearing.
+    FifoRelaxed,  ///< Vsync, but a late image is shown at once and may tear.
+    Mailbox,      ///< Newest image replaces the queued one at vblank; no tearing, no blocking.
+    Immediate,    ///< Shown at once; lowest latency, tears.
+};
+
+/// Creation parameters for a swapchain.
+///
+/// `imageCount` 0 asks for one image more than the surface minimum; other
+/// values are clamped to what the surface supports. `maxFrameLatency` is
+/// the number of presented frames wait_for_present() lets queue up for
+/// display, clamped to [1, image count]: 1 gives the lowest latency, higher
+/// values trade latency for throughput headroom.
+struct SwapchainDesc {
+    NativeWindow  window{};
+    uint32_t      width           = 0;                              ///< Framebuffer size in pixels.
+    uint32_t      height          = 0;
+    TextureFormat format          = TextureFormat::BGRA8_sRGB;      ///< Falls back to the first common 8-bit format the surface offers.
+    TextureUsage  usage           = TextureUsage::ColorAttachment;  ///< Every way the images are used besides Present.
+    PresentMode   presentMode     = PresentMode::Fifo;
+    uint32_t      imageCount      = 0;
+    uint32_t      maxFrameLatency = 1;
+    const char*   debugName       = nullptr;                        ///< Optional; attached when debug labels are enabled.
+};
+
+/// The image acquire() handed out for the current frame.
+struct SwapchainImage {
+    TextureHandle texture;      ///< Valid until the swapchain is resized or destroyed.
+    uint32_t      index = 0;    ///< Position in the swapchain, < SwapchainInfo::imageCount.
+    SyncPoint     ready{};      ///< Submissions touching the image must wait on it.
+};
+
+/// Snapshot returned by BackendVTable::query_swapchain.
+struct SwapchainInfo {
+    uint32_t      width        = 0;
+    uint32_t      height       = 0;
+    TextureFormat format       = TextureFormat::BGRA8_sRGB;
+    PresentMode   presentMode  = PresentMode::Fifo;  ///< After fallback.
+    uint32_t      imageCount   = 0;
+    bool          presentWait  = false;  ///< wait_for_present() waits on the display, not the GPU (Feature::PresentWait).
+    uint64_t      presentCount = 0;      ///< Presents since creation.
+    uint64_t      waitNs       = 0;      ///< Time the last wait_for_present() blocked.
+};
+
+} // namespace wren::rhi
+
+#endif // WREN_RHI_API_SWAPCHAIN_HPP
@@ -28,21 +28,39 @@
 #include <cstddef>
 #include <cstdint>
 
+#include <wren/rhi/api/commands.hpp>
 #include <wren/rhi/api/features.hpp>
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/pipelines.hpp>
+#include <wren/rhi/api/resources.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/api/swapchain.hpp>
 
 namespace wren::rhi {
 
 /// Increment when BackendVTable's layout or any function-pointer signature changes.
-inline constexpr uint32_t k_backend_abi_version = 1;
+inline constexpr uint32_t k_backend_abi_version = 22;
 
-/// Forward declaration of the per-backend opaque device state.
-/// Each backend defines this struct in its own translation unit.
+/// Forward declarations of the per-backend opaque instance and device state.
+/// Each backend defines these structs in its own translation unit.
+struct InstanceState;
 struct DeviceState;
 
+/// Opaque handle to a shared instance owned by the backend DLL.
+/// Obtained from BackendVTable::create_instance; released with BackendVTable::destroy_instance.
+using InstanceHandle = InstanceState*;
+
 /// Opaque handle to a live device owned by the backend DLL.
 /// Obtained from BackendVTable::create_device; released with BackendVTable::destroy_device.
 using DeviceHandle = DeviceState*;
 
+/// Forward declaration of the per-backend swapchain state.
+struct SwapchainState;
+
+/// Opaque handle to a swapchain of one device.
+/// Obtained from BackendVTable::create_swapchain; released with BackendVTable::destroy_swapchain.
+using SwapchainHandle = SwapchainState*;
+
 /// Stable vtable exchanged between the loader and a backend DLL.
 struct BackendVTable {
     /// Must equal k_backend_abi_version; checked by the loader on load.
@@ -52,19 +70,41 @@ struct BackendVTable {
     /// Identifies the compile-time API of this backend DLL.
     uint8_t (*backend_id)();
 
+    // -----------------------------------------------------------------
+    // Instance lifecycle (thread-safe)
+    //
+    // An instance is reference-counted: every device created from it holds
+    // a reference, so destroy_instance may come before the devices do.
+    // -----------------------------------------------------------------
+
+    /// Creates a shared instance (see InstanceDesc). @p err_buf and
+    /// @p err_len as for create_device.
+    /// @returns Opaque instance handle on success, nullptr on failure.
+    InstanceHandle (*create_instance)(InstanceDesc const* desc, char* err_buf, std::size_t err_len);
+
+    /// Releases the reference returned by create_instance. Passing nullptr is a no-op.
+    void (*destroy_instance)(InstanceHandle instance);
+
+    /// Writes up to @p capacity adapter snapshots into @p out and returns the
+    /// number of adapters, so a call with @p capacity 0 sizes the array.
+    uint32_t (*enumerate_adapters)(InstanceHandle instance, AdapterDesc* out, uint32_t capacity);
+
     // -----------------------------------------------------------------
     // Device lifecycle
     // -----------------------------------------------------------------
 
     /// Creates a logical device satisfying @p desc.
     ///
+    /// @param instance Instance to create the device from, or nullptr for
+    ///                 a private instance configured from @p desc.
     /// @param desc     Creation parameters; pointer only needs to be valid
     ///                 for the duration of this call.
     /// @param err_buf  Receives a null-terminated error message on failure
     ///                 (up to @p err_len bytes including the null terminator).
     /// @param err_len  Byte capacity of err_buf.
     /// @returns        Opaque device handle on success, nullptr on failure.
-    DeviceHandle (*create_device)(DeviceDesc const* desc, char* err_buf, std::size_t err_len);
+    DeviceHandle (*create_device)(InstanceHandle instance, DeviceDesc const* desc,
+                                  char* err_buf, std::size_t err_len);
 
     /// Destroys a device previously returned by create_device.
     /// Passing nullptr is a no-op.
@@ -76,6 +116,384 @@ struct BackendVTable {
 
     /// Copies the post-creation capability snapshot into @p out.
     void (*get_capabilities)(DeviceHandle device, Capabilities* out);
+
+    // -----------------------------------------------------------------
+    // Resources (thread-safe; batched to amortise the ABI crossing)
+    //
+    // Creation is all-or-nothing: on failure nothing is created and every
+    // entry of the output array is set to the null handle. Destruction
+    // ignores null and stale handles.
+    // -----------------------------------------------------------------
+
+    /// Creates @p count buffers; writes one handle per descriptor into @p out.
+    Status (*create_buffers)(DeviceHandle device, BufferDesc const* descs, uint32_t count,
+                             BufferHandle* out);
+
+    /// Destroys @p count buffers. The handles go stale at once; the buffers
+    /// themselves are destroyed once the GPU has finished every submission
+    /// made before the call, so submit the last use first.
+    void (*destroy_buffers)(DeviceHandle device, BufferHandle const* handles, uint32_t count);
+
+    /// Creates @p count textures (plus a default full-resource view each).
+    Status (*create_textures)(DeviceHandle device, TextureDesc const* descs, uint32_t count,
+                              TextureHandle* out);
+
+    /// Destroys @p count textures, deferred like destroy_buffers.
+    void (*destroy_textures)(DeviceHandle device, TextureHandle const* handles, uint32_t count);
+
+    /// Returns the persistent CPU mapping of an Upload / Readback buffer,
+    /// or nullptr for GpuOnly buffers and invalid handles.
+    void* (*map_buffer)(DeviceHandle device, BufferHandle buffer);
+
+    /// Returns the GPU virtual address of a buffer, for shaders that read it
+    /// through a pointer (Feature::BufferDeviceAddress), or 0 without the
+    /// feature and for invalid handles. defragment_memory() may move buffers;
+    /// query again after it.
+    uint64_t (*buffer_device_address)(DeviceHandle device, BufferHandle buffer);
+
+    // -----------------------------------------------------------------
+    // Bindless heap (thread-safe; see wren/rhi/api/resources.hpp)
+    // -----------------------------------------------------------------
+
+    /// Fills @p out with the heap's mode, capacity and occupancy.
+    void (*query_bindless_heap)(DeviceHandle device, BindlessHeapInfo* out);
+
+    /// Heap index of a storage buffer, assigned at creation.
+    /// k_invalid_bindless_index without the heap or Storage usage.
+    uint32_t (*buffer_bindless_index)(DeviceHandle device, BufferHandle buffer);
+
+    /// Heap index of a texture in the SampledTexture or StorageTexture array,
+    /// assigned at creation. k_invalid_bindless_index without the heap or the
+    /// matching usage.
+    uint32_t (*texture_bindless_index)(DeviceHandle device, TextureHandle texture, BindlessClass cls);
+
+    /// Writes the Sampler-array index of a sampler matching each of
+    /// @p descs to @p outIndices, creating it on first use; equal
+    /// descriptors always get the same index and samplers live as long as
+    /// the device. MissingRequiredFeature without the heap or for
+    /// anisotropy / MirrorClampToEdge the device lacks, OutOfMemory once
+    /// k_max_samplers distinct samplers exist. On failure every index is
+    /// k_invalid_bindless_index.
+    Status (*find_samplers)(DeviceHandle device, SamplerDesc const* descs, uint32_t count, uint32_t* outIndices);
+
+    // -----------------------------------------------------------------
+    // Device memory (see wren/rhi/api/resources.hpp)
+    // -----------------------------------------------------------------
+
+    /// Fills @p out with per-heap budget and usage. Thread-safe.
+    void (*query_memory_budget)(DeviceHandle device, MemoryBudget* out);
+
+    /// Compacts sub-allocated GpuOnly buffers into fewer memory blocks and
+    /// releases the blocks left empty. Handles stay valid; the underlying API
+    /// objects change. Frame thread only, outside begin_frame / end_frame;
+    /// blocks until the GPU is idle. Writes what was done into @p out.
+    Status (*defragment_memory)(DeviceHandle device, DefragmentDesc const* desc,
+                                DefragmentStats* out);
+
+    /// Writes the MemoryRequirements of each of @p count texture descriptors
+    /// into @p out without creating anything. The descriptors' heap fields
+    /// are ignored. Thread-safe.
+    Status (*texture_memory_requirements)(DeviceHandle device, TextureDesc const* descs,
+                                          uint32_t count, MemoryRequirements* out);
+
+    /// Creates @p count aliasing heaps, all-or-nothing like resources.
+    /// Thread-safe.
+    Status (*create_memory_heaps)(DeviceHandle device, MemoryHeapDesc const* descs, uint32_t count,
+                                  HeapHandle* out);
+
+    /// Destroys @p count heaps, deferred like destroy_buffers; null and
+    /// stale handles are ignored. Destroy the textures placed in them first.
+    /// Thread-safe.
+    void (*destroy_memory_heaps)(DeviceHandle device, HeapHandle const* handles, uint32_t count);
+
+    /// Writes the page layout of sparse texture @p texture into @p out.
+    /// Status::InvalidArgument for stale handles and textures that are not
+    /// sparse. Thread-safe.
+    Status (*sparse_texture_info)(DeviceHandle device, TextureHandle texture, SparseTextureInfo* out);
+
+    // -----------------------------------------------------------------
+    // Acceleration structures (thread-safe; see wren/rhi/api/resources.hpp)
+    //
+    // All of them need Feature::RayTracing: MissingRequiredFeature, a 0
+    // reference or nothing recorded without it.
+    // -----------------------------------------------------------------
+
+    /// Writes the sizes a structure built from @p inputs needs into @p out.
+    /// Only the inputs' type, flags and counts are read; the buffers may
+    /// be null.
+    Status (*acceleration_structure_sizes)(DeviceHandle device, AccelerationStructureInputs const* inputs,
+                                           AccelerationStructureSizes* out);
+
+    /// Creates @p count empty structures, all-or-nothing like resources.
+    Status (*create_acceleration_structures)(DeviceHandle device, AccelerationStructureDesc const* descs,
+                                             uint32_t count, AccelerationStructureHandle* out);
+
+    /// Destroys @p count structures, deferred like destroy_buffers.
+    void (*destroy_acceleration_structures)(DeviceHandle device, AccelerationStructureHandle const* handles,
+                                            uint32_t count);
+
+    /// The value AccelerationStructureInstance::accelerationStructure takes
+    /// for @p structure: its device address, or for an Upload structure its
+    /// host reference, valid only in host-built TLASes. 0 for invalid handles.
+    uint64_t (*acceleration_structure_reference)(DeviceHandle device, AccelerationStructureHandle structure);
+
+    /// Builds @p count structures on the CPU and returns when they are done,
+    /// spread over DeviceDesc::jobSystem as far as the driver allows.
+    /// Destinations are Upload structures and every input buffer is an
+    /// Upload buffer the CPU writes; scratch is allocated internally.
+    /// MissingRequiredFeature without Feature::AccelerationStructureHostBuild.
+    Status (*build_acceleration_structures_on_host)(DeviceHandle device, AccelerationStructureBuild const* builds,
+                                                    uint32_t count);
+
+    // -----------------------------------------------------------------
+    // Shader modules (thread-safe; see wren/rhi/api/pipelines.hpp)
+    // -----------------------------------------------------------------
+
+    /// Creates one module per descriptor, reflecting the SPIR-V and creating
+    /// the driver module unless identical code is already loaded; the new
+    /// handle then shares it. Status::InvalidArgument for malformed SPIR-V.
+    /// On failure nothing is created and @p out is filled with null handles.
+    Status (*create_shader_modules)(DeviceHandle device, ShaderModuleDesc const* descs,
+                                    uint32_t count, ShaderModuleHandle* out);
+
+    /// Destroys @p count module handles. Pipelines created from them keep
+    /// working; the driver module goes with the last handle or pipeline
+    /// recipe that uses it. Null and stale handles are ignored.
+    void (*destroy_shader_modules)(DeviceHandle device, ShaderModuleHandle const* handles, uint32_t count);
+
+    /// Copies the reflection of @p module into @p out. Status::InvalidArgument
+    /// for stale handles.
+    Status (*shader_module_reflection)(DeviceHandle device, ShaderModuleHandle module, ShaderReflection* out);
+
+    // -----------------------------------------------------------------
+    // Pipeline cache (see wren/rhi/api/pipelines.hpp)
+    // -----------------------------------------------------------------
+
+    /// Fills @p out with hit / miss counters and load state, and the shader
+    /// module and pipeline de-duplication counters. Thread-safe.
+    void (*query_pipeline_cache)(DeviceHandle device, PipelineCacheStats* out);
+
+    /// Writes the cache to DeviceDesc::pipelineCacheDirectory now, e.g. after
+    /// a loading screen; destroy_device does the same. Status::Ok without
+    /// writing when the cache is disabled or unchanged. Thread-safe.
+    Status (*save_pipeline_cache)(DeviceHandle device);
+
+    // -----------------------------------------------------------------
+    // Pipelines (thread-safe; see wren/rhi/api/pipelines.hpp)
+    //
+    // Creation validates every descriptor, copies it and returns handles at
+    // once; invalid descriptors fail the whole batch as for resources.
+    // Compilation runs on DeviceDesc::jobSystem when set, in creation order
+    // unless reprioritised, and inside the call otherwise. A driver failure
+    // shows up as PipelineStatus::Failed, not as the returned Status.
+    // -----------------------------------------------------------------
+
+    Status (*create_graphics_pipelines)(DeviceHandle device, GraphicsPipelineDesc const* descs,
+                                        uint32_t count, PipelineHandle* out);
+    Status (*create_compute_pipelines)(DeviceHandle device, ComputePipelineDesc const* descs,
+                                       uint32_t count, PipelineHandle* out);
+
+    /// Destroys @p count pipelines, deferred like destroy_buffers; queued
+    /// compiles are dropped, running ones finish first.
+    void (*destroy_pipelines)(DeviceHandle device, PipelineHandle const* handles, uint32_t count);
+
+    /// Non-blocking readiness poll.
+    PipelineStatus (*pipeline_status)(DeviceHandle device, PipelineHandle pipeline);
+
+    /// Moves the still-queued pipelines among @p handles to the front of the
+    /// compile queue, the first handle ending up first. Use it for pipelines
+    /// the next frames will draw with.
+    void (*prioritize_pipelines)(DeviceHandle device, PipelineHandle const* handles, uint32_t count);
+
+    /// Blocks until none of @p handles is pending, compiling queued ones on
+    /// the calling thread. Status::InternalError when any of them failed.
+    Status (*wait_pipelines)(DeviceHandle device, PipelineHandle const* handles, uint32_t count);
+
+    // -----------------------------------------------------------------
+    // Frames (frame thread only; no list may be recording during either call)
+    //
+    // begin_frame() moves to the next frame-in-flight slot, waits until the
+    // GPU has reached the queue timelines recorded when that slot last ended
+    // (framesInFlight frames ago) and recycles its command pools. end_frame()
+    // flushes every submission queued since begin_frame() with one queue
+    // submit call per queue.
+    // -----------------------------------------------------------------
+
+    Status (*begin_frame)(DeviceHandle device);
+    Status (*end_frame)(DeviceHandle device);
+
+    /// Writes the profiling regions of the newest frame begin_frame() has
+    /// read back into @p out (see wren/rhi/api/commands.hpp); the regions
+    /// stay valid until the next begin_frame().
+    void (*read_profile_frame)(DeviceHandle device, ProfileFrame* out);
+
+    // -----------------------------------------------------------------
+    // Command lists (thread-safe; see wren/rhi/api/commands.hpp)
+    // -----------------------------------------------------------------
+
+    /// Begins recording a new list from the calling thread's pool for the
+    /// current frame. On failure *out is set to nullptr. Returns
+    /// Status::OutOfMemory on a thread beyond the first
+    /// k_max_recording_threads to record on the device.
+    Status (*begin_command_list)(DeviceHandle device, CommandListDesc const* desc,
+                                 CommandListHandle* out);
+
+    /// Finishes recording. The list must not be recorded into afterwards.
+    Status (*end_command_list)(CommandListHandle list);
+
+    /// Queues one submission of ended primary lists for the current frame on
+    /// the queue they were begun for. Writes the SyncPoint the submission
+    /// signals into @p out; submissions reach the GPU in the order they were
+    /// queued, at end_frame(). On failure *out is the null SyncPoint.
+    Status (*submit_command_lists)(DeviceHandle device, SubmitDesc const* desc, SyncPoint* out);
+
+    /// Queues one batch of sparse page binds for the current frame, after
+    /// the batch's waits and every earlier bind. Writes the SyncPoint the
+    /// batch signals into @p out; its queue is the sparse binding queue,
+    /// preferably Transfer. Status::MissingRequiredFeature without
+    /// Feature::SparseResources. On failure *out is the null SyncPoint.
+    Status (*bind_sparse)(DeviceHandle device, SparseBindDesc const* desc, SyncPoint* out);
+
+    // -----------------------------------------------------------------
+    // Timelines (thread-safe)
+    // -----------------------------------------------------------------
+
+    /// Blocks until every one of @p count points is reached or @p timeout_ns
+    /// elapses (Status::Timeout). Points queued but not yet flushed by
+    /// end_frame() are only reached after it.
+    Status (*wait_sync_points)(DeviceHandle device, SyncPoint const* points, uint32_t count,
+                               uint64_t timeout_ns);
+
+    /// Returns the last value the GPU has reached on @p queue's timeline.
+    uint64_t (*completed_value)(DeviceHandle device, QueueType queue);
+
+    // -----------------------------------------------------------------
+    // Presentation (frame thread only; see wren/rhi/api/swapchain.hpp)
+    //
+    // acquire_swapchain_image runs inside begin_frame / end_frame, at most
+    // once per swapchain and frame; present_swapchain after end_frame, and
+    // presents what the frame submitted. Status::OutOfDate from either
+    // asks for resize_swapchain.
+    // -----------------------------------------------------------------
+
+    /// Creates a surface and swapchain for @p desc's window. @p err_buf and
+    /// @p err_len as for create_device.
+    /// @returns Opaque swapchain handle on success, nullptr on failure.
+    SwapchainHandle (*create_swapchain)(DeviceHandle device, SwapchainDesc const* desc,
+                                        char* err_buf, std::size_t err_len);
+
+    /// Waits for the swapchain's presents to finish, then destroys it and
+    /// its images. Passing nullptr is a no-op.
+    void (*destroy_swapchain)(DeviceHandle device, SwapchainHandle swapchain);
+
+    /// Recreates the images at the new framebuffer size, outside
+    /// begin_frame / end_frame, without waiting for the GPU: the old images
+    /// are destroyed once their last frame retires. Every image handle
+    /// handed out before becomes stale.
+    Status (*resize_swapchain)(DeviceHandle device, SwapchainHandle swapchain,
+                               uint32_t width, uint32_t height);
+
+    /// Acquires the next image into @p out. Status::Timeout when none is
+    /// available within @p timeout_ns.
+    Status (*acquire_swapchain_image)(DeviceHandle device, SwapchainHandle swapchain,
+                                      uint64_t timeout_ns, SwapchainImage* out);
+
+    /// Presents the acquired image once the graphics work submitted so far
+    /// has finished. The image must be in TextureUsage::Present by then.
+    Status (*present_swapchain)(DeviceHandle device, SwapchainHandle swapchain);
+
+    /// Blocks until at most maxFrameLatency - 1 presents are still waiting
+    /// for the display (Feature::PresentWait) or the GPU (without it), or
+    /// @p timeout_ns elapses (Status::Timeout).
+    Status (*wait_for_present)(DeviceHandle device, SwapchainHandle swapchain, uint64_t timeout_ns);
+
+    /// Fills @p out with the swapchain's current size, mode and counters.
+    void (*query_swapchain)(DeviceHandle device, SwapchainHandle swapchain, SwapchainInfo* out);
+
+    // -----------------------------------------------------------------
+    // Recording (hot path: no Status; contracts are debug-asserted)
+    // -----------------------------------------------------------------
+
+    void (*cmd_barriers)(CommandListHandle list,
+                         TextureBarrier const* textures, uint32_t texture_count,
+                         BufferBarrier const*  buffers,  uint32_t buffer_count);
+
+    void (*cmd_copy_buffer)(CommandListHandle list, BufferHandle src, BufferHandle dst,
+                            BufferCopy const* regions, uint32_t count);
+    void (*cmd_copy_buffer_to_texture)(CommandListHandle list, BufferHandle src, TextureHandle dst,
+                                       BufferTextureCopy const* regions, uint32_t count);
+    /// @p src must be in the TransferSrc state. Depth formats copy their
+    /// depth aspect.
+    void (*cmd_copy_texture_to_buffer)(CommandListHandle list, TextureHandle src, BufferHandle dst,
+                                       BufferTextureCopy const* regions, uint32_t count);
+
+    void (*cmd_begin_rendering)(CommandListHandle list, RenderingDesc const* desc);
+    void (*cmd_end_rendering)(CommandListHandle list);
+
+    void (*cmd_set_viewport)(CommandListHandle list, Viewport const* viewport);
+    void (*cmd_set_scissor)(CommandListHandle list, Scissor const* scissor);
+
+    /// Binds @p pipeline. While it is pending, binds its ready fallback instead
+    /// and moves it to the front of the compile queue, or, without one,
+    /// compiles it on the calling thread (or waits for the worker compiling it).
+    void (*cmd_bind_pipeline)(CommandListHandle list, PipelineHandle pipeline);
+
+    /// Writes @p size bytes at @p offset of the push constant range; both are
+    /// multiples of 4 and end within k_max_push_constant_bytes. Values stay
+    /// set across pipeline binds. Graphics and compute lists only.
+    void (*cmd_push_constants)(CommandListHandle list, uint32_t offset, uint32_t size, void const* data);
+
+    void (*cmd_bind_vertex_buffers)(CommandListHandle list, uint32_t first_binding,
+                                    BufferHandle const* buffers, uint64_t const* offsets,
+                                    uint32_t count);
+    void (*cmd_bind_index_buffer)(CommandListHandle list, BufferHandle buffer, uint64_t offset,
+                                  IndexType type);
+
+    void (*cmd_draw)(CommandListHandle list, uint32_t vertex_count, uint32_t instance_count,
+                     uint32_t first_vertex, uint32_t first_instance);
+    void (*cmd_draw_indexed)(CommandListHandle list, uint32_t index_count, uint32_t instance_count,
+                             uint32_t first_index, int32_t vertex_offset, uint32_t first_instance);
+    void (*cmd_dispatch)(CommandListHandle list, uint32_t x, uint32_t y, uint32_t z);
+
+    /// Indirect forms of the three above; arguments are read from the buffers
+    /// when the GPU executes the list (see IndirectDrawDesc in
+    /// wren/rhi/api/commands.hpp). Not valid in packets.
+    void (*cmd_draw_indirect)(CommandListHandle list, IndirectDrawDesc const* desc);
+    void (*cmd_draw_indexed_indirect)(CommandListHandle list, IndirectDrawDesc const* desc);
+    void (*cmd_dispatch_indirect)(CommandListHandle list, BufferHandle buffer, uint64_t offset);
+
+    /// Builds @p count structures in one batch (see AccelerationStructureBuild
+    /// in wren/rhi/api/commands.hpp); input buffers must be in the
+    /// AccelerationStructureInput state and builds must not share scratch.
+    /// Compute and graphics lists outside rendering; not valid in packets.
+    void (*cmd_build_acceleration_structures)(CommandListHandle list, AccelerationStructureBuild const* builds,
+                                              uint32_t count);
+
+    /// Writes the compacted size of each of @p count structures, built with
+    /// AllowCompaction by earlier commands, as uint64 values at @p offset of
+    /// @p dst (TransferDst, usually Readback memory). The values are there
+    /// once the list has completed on the GPU.
+    void (*cmd_write_compacted_sizes)(CommandListHandle list, AccelerationStructureHandle const* structures,
+                                      uint32_t count, BufferHandle dst, uint64_t offset);
+
+    /// Copies @p src into @p dst, made visible like a build. Compact copies
+    /// need a destination of at least the compacted size.
+    void (*cmd_copy_acceleration_structure)(CommandListHandle list, AccelerationStructureHandle src,
+                                            AccelerationStructureHandle dst, AccelerationStructureCopyMode mode);
+
+    /// Records @p count packets in order, each as the matching cmd_* entry
+    /// point would (see CommandPacket in wren/rhi/api/commands.hpp). The
+    /// per-draw path: one call per batch instead of one per command.
+    void (*cmd_record_packets)(CommandListHandle list, CommandPacket const* packets, uint32_t count);
+
+    /// Replays ended secondary lists inside @p list, in array order.
+    void (*cmd_execute_command_lists)(CommandListHandle list, CommandListHandle const* secondaries,
+                                      uint32_t count);
+
+    /// Opens a profiling region; every begin needs an end in the same list,
+    /// or end_command_list closes it.
+    void (*cmd_begin_profile_region)(CommandListHandle list, ProfileRegionDesc const* desc);
+    void (*cmd_end_profile_region)(CommandListHandle list);
 };
 
 /// Factory function type — resolved by the loader via dlsym / GetProcAddress.
@@ -0,0 +1,103 @@
+#ifndef WREN_RHI_STATIC_BACKEND_HPP
+#define WREN_RHI_STATIC_BACKEND_HPP
+
+// -------------------------------------------------------------------------------------------------
+// wren::rhi::static_backend — direct entry points of a statically linked backend.
+//
+// With the CMake option WREN_RHI_STATIC_BACKEND set, one backend is built as
+// a static library and linked into the loader instead of being loaded at
+// runtime; WREN_RHI_STATIC_BACKEND is then defined to 1 for its consumers.
+// BackendLibrary::load() takes the vtable from the linked wren_rhi_create(),
+// and the recording calls of wren::rhi::CommandList — the per-draw path —
+// call the functions below directly instead of through that vtable, so the
+// compiler sees a plain call it can inline under LTO.
+//
+// The linked backend defines every function below with the signature of the
+// BackendVTable member of the same name. Everything else is per-frame or
+// rarer and keeps going through the vtable.
+// -------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/status.hpp>
+
+#ifndef WREN_RHI_STATIC_BACKEND
+#  define WREN_RHI_STATIC_BACKEND 0
+#endif
+
+#if WREN_RHI_STATIC_BACKEND
+
+namespace wren::rhi::static_backend {
+
+Status end_command_list(CommandListHandle list) noexcept;
+
+void cmd_barriers(CommandListHandle list,
+                  TextureBarrier const* textures, uint32_t texture_count,
+                  BufferBarrier const*  buffers,  uint32_t buffer_count) noexcept;
+void cmd_copy_buffer(CommandListHandle list, BufferHandle src, BufferHandle dst,
+                     BufferCopy const* regions, uint32_t count) noexcept;
+void cmd_copy_buffer_to_texture(CommandListHandle list, BufferHandle src, TextureHandle dst,
+                                BufferTextureCopy const* regions, uint32_t count) noexcept;
+void cmd_copy_texture_to_buffer(CommandListHandle list, TextureHandle src, BufferHandle dst,
+                                BufferTextureCopy const* regions, uint32_t count) noexcept;
+void cmd_begin_rendering(CommandListHandle list, RenderingDesc const* desc) noexcept;
+void cmd_end_rendering(CommandListHandle list) noexcept;
+void cmd_set_viewport(CommandListHandle list, Viewport const* viewport) noexcept;
+void cmd_set_scissor(CommandListHandle list, Scissor const* scissor) noexcept;
+void cmd_bind_pipeline(CommandListHandle list, PipelineHandle pipeline) noexcept;
+void cmd_push_constants(CommandListHandle list, uint32_t offset, uint32_t size, void const* data) noexcept;
+void cmd_bind_vertex_buffers(CommandListHandle list, uint32_t first_binding,
+                             BufferHandle const* buffers, uint64_t const* offsets,
+                             uint32_t count) noexcept;
+void cmd_bind_index_buffer(CommandListHandle list, BufferHandle buffer, uint64_t offset,
+                           IndexType type) noexcept;
+void cmd_draw(CommandListHandle list, uint32_t vertex_count, uint32_t instance_count,
+              uint32_t first_vertex, uint32_t first_instance) noexcept;
+void cmd_draw_indexed(CommandListHandle list, uint32_t index_count, uint32_t instance_count,
+                      uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) noexcept;
+void cmd_dispatch(CommandListHandle list, uint32_t x, uint32_t y, uint32_t z) noexcept;
+void cmd_draw_indirect(CommandListHandle list, IndirectDrawDesc const* desc) noexcept;
+void cmd_draw_indexed_indirect(CommandListHandle list, IndirectDrawDesc const* desc) noexcept;
+void cmd_dispatch_indirect(CommandListHandle list, BufferHandle buffer, uint64_t offset) noexcept;
+void cmd_record_packets(CommandListHandle list, CommandPacket const* packets, uint32_t count) noexcept;
+void cmd_execute_command_lists(CommandListHandle list, CommandListHandle const* secondaries,
+                               uint32_t count) noexcept;
+void cmd_begin_profile_region(CommandListHandle list, ProfileRegionDesc const* desc) noexcept;
+void cmd_end_profile_region(CommandListHandle list) noexcept;
+
+/// The functions above under their BackendVTable member names, so that
+/// CommandList writes `recording()->cmd_draw(...)` whichever it calls.
+struct RecordingTable {
+    static constexpr auto& end_command_list           = ::wren::rhi::static_backend::end_command_list;
+    static constexpr auto& cmd_barriers               = ::wren::rhi::static_backend::cmd_barriers;
+    static constexpr auto& cmd_copy_buffer            = ::wren::rhi::static_backend::cmd_copy_buffer;
+    static constexpr auto& cmd_copy_buffer_to_texture = ::wren::rhi::static_backend::cmd_copy_buffer_to_texture;
+    static constexpr auto& cmd_copy_texture_to_buffer = ::wren::rhi::static_backend::cmd_copy_texture_to_buffer;
+    static constexpr auto& cmd_begin_rendering        = ::wren::rhi::static_backend::cmd_begin_rendering;
+    static constexpr auto& cmd_end_rendering          = ::wren::rhi::static_backend::cmd_end_rendering;
+    static constexpr auto& cmd_set_viewport           = ::wren::rhi::static_backend::cmd_set_viewport;
+    static constexpr auto& cmd_set_scissor            = ::wren::rhi::static_backend::cmd_set_scissor;
+    static constexpr auto& cmd_bind_pipeline          = ::wren::rhi::static_backend::cmd_bind_pipeline;
+    static constexpr auto& cmd_push_constants         = ::wren::rhi::static_backend::cmd_push_constants;
+    static constexpr auto& cmd_bind_vertex_buffers    = ::wren::rhi::static_backend::cmd_bind_vertex_buffers;
+    static constexpr auto& cmd_bind_index_buffer      = ::wren::rhi::static_backend::cmd_bind_index_buffer;
+    static constexpr auto& cmd_draw                   = ::wren::rhi::static_backend::cmd_draw;
+    static constexpr auto& cmd_draw_indexed           = ::wren::rhi::static_backend::cmd_draw_indexed;
+    static constexpr auto& cmd_dispatch               = ::wren::rhi::static_backend::cmd_dispatch;
+    static constexpr auto& cmd_draw_indirect          = ::wren::rhi::static_backend::cmd_draw_indirect;
+    static constexpr auto& cmd_draw_indexed_indirect  = ::wren::rhi::static_backend::cmd_draw_indexed_indirect;
+    static constexpr auto& cmd_dispatch_indirect      = ::wren::rhi::static_backend::cmd_dispatch_indirect;
+    static constexpr auto& cmd_record_packets         = ::wren::rhi::static_backend::cmd_record_packets;
+    static constexpr auto& cmd_execute_command_lists  = ::wren::rhi::static_backend::cmd_execute_command_lists;
+    static constexpr auto& cmd_begin_profile_region   = ::wren::rhi::static_backend::cmd_begin_profile_region;
+    static constexpr auto& cmd_end_profile_region     = ::wren::rhi::static_backend::cmd_end_profile_region;
+};
+inline constexpr RecordingTable k_recording{};
+
+} // namespace wren::rhi::static_backend
+
+#endif
+
+#endif // WREN_RHI_STATIC_BACKEND_HPP
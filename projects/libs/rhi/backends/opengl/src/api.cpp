@@ -3,44 +3,1079 @@
 #include <wren/foundation/system/platform.hpp>
 #include <wren/rhi/api/enums.hpp>
 #include <wren/rhi/api/features.hpp>
+#include <wren/rhi/static_backend.hpp>
 
+#include <atomic>
 #include <cstring>
+#include <mutex>
+#include <new>
+#include <optional>
+
+#include "gl_context.hpp"
+#include "gl_device.hpp"
+#include "gl_device_impl.hpp"
+
+// -------------------------------------------------------------------------------------------------
+// Internal instance state
+//
+// GL has no instance object: the state records the InstanceDesc settings
+// devices inherit and caches the one adapter probe_adapter() reports.
+// Reference-counted like the Vulkan backend's, so devices may outlive the
+// handle gl_create_instance returned.
+//
+// Named InstanceState to match the forward declaration in wren::rhi::InstanceHandle.
+// -------------------------------------------------------------------------------------------------
+struct wren::rhi::InstanceState {
+    bool                                   debug = false;
+    std::once_flag                         probed;
+    std::optional<wren::rhi::AdapterDesc>  adapter;  // empty when no usable context exists
+    std::atomic<uint32_t>                  refs  {1};
+};
+
+namespace {
+
+void retain(wren::rhi::InstanceState* state) noexcept {
+    state->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void release(wren::rhi::InstanceState* state) noexcept {
+    if (state && state->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete state; // NOLINT
+    }
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Internal device state
+//
+// Owns the GlDevice and, when created from an instance, one reference to
+// it. Lifetime is managed by gl_create_device / gl_destroy_device, which
+// the loader calls through the vtable.
+//
+// Named DeviceState to match the forward declaration in wren::rhi::DeviceHandle.
+// -------------------------------------------------------------------------------------------------
+struct wren::rhi::DeviceState {
+    wren::rhi::InstanceState*                  instance = nullptr;
+    std::optional<wren::rhi::opengl::GlDevice> device;
+    wren::rhi::Capabilities                    capabilities{};
+
+    ~DeviceState() {
+        device.reset();
+        release(instance);
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+// Function pointer implementations
+// -------------------------------------------------------------------------------------------------
 
 static uint8_t gl_backend_id() noexcept {
     return static_cast<uint8_t>(wren::rhi::Backend::OpenGL);
 }
 
-static wren::rhi::DeviceHandle gl_create_device(
-    wren::rhi::DeviceDesc const* /*desc*/,
-    char*       err_buf,
-    std::size_t err_len) noexcept
-{
-    static constexpr const char k_msg[] = "OpenGL backend: device creation not yet implemented";
+static void gl_write_error(char* err_buf, std::size_t err_len, const char* msg) noexcept {
     if (err_buf && err_len > 0) {
 #ifdef WREN_COMPILER_MSVC_ABI
-        strncpy_s(err_buf, err_len, k_msg, err_len - 1);
+        strncpy_s(err_buf, err_len, msg, err_len - 1);
 #else
-        std::strncpy(err_buf, k_msg, err_len - 1);
+        std::strncpy(err_buf, msg, err_len - 1);
         err_buf[err_len - 1] = '\0';
 #endif
     }
+}
+
+static wren::rhi::InstanceHandle gl_create_instance(
+    wren::rhi::InstanceDesc const* desc,
+    char*       err_buf,
+    std::size_t err_len) noexcept
+{
+    if (!desc) {
+        gl_write_error(err_buf, err_len, "null InstanceDesc pointer");
+        return nullptr;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto* state = new (std::nothrow) wren::rhi::InstanceState{};
+    if (!state) {
+        gl_write_error(err_buf, err_len, "out of memory");
+        return nullptr;
+    }
+    state->debug = desc->debug;
+    return state;
+}
+
+static void gl_destroy_instance(wren::rhi::InstanceHandle instance) noexcept {
+    release(instance);
+}
+
+/// The adapter is probed on the first call, with a throwaway context; like
+/// device creation, that call must come from the main thread.
+static uint32_t gl_enumerate_adapters(
+    wren::rhi::InstanceHandle instance,
+    wren::rhi::AdapterDesc*   out,
+    uint32_t                  capacity) noexcept
+{
+    if (!instance) {
+        return 0;
+    }
+    try {
+        std::call_once(instance->probed, [instance] {
+            wren::rhi::AdapterDesc adapter{};
+            if (wren::rhi::opengl::probe_adapter(adapter)) {
+                instance->adapter = adapter;
+            }
+        });
+    } catch (...) {
+        return 0;
+    }
+    if (!instance->adapter) {
+        return 0;
+    }
+    if (out && capacity > 0) {
+        out[0] = *instance->adapter;
+    }
+    return 1;
+}
+
+static wren::rhi::DeviceHandle gl_create_device(
+    wren::rhi::InstanceHandle    instance,
+    wren::rhi::DeviceDesc const* desc,
+    char*       err_buf,
+    std::size_t err_len) noexcept
+{
+    if (!desc) {
+        gl_write_error(err_buf, err_len, "null DeviceDesc pointer");
+        return nullptr;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto* state = new (std::nothrow) wren::rhi::DeviceState{};
+    if (!state) {
+        gl_write_error(err_buf, err_len, "out of memory");
+        return nullptr;
+    }
+    if (instance) {
+        retain(instance);
+        state->instance = instance;
+    }
+
+    try {
+        bool const debug = (instance && instance->debug) ||
+                           wren::rhi::has_any(desc->flags, wren::rhi::DeviceFlag::Debug);
+        auto dev = wren::rhi::opengl::GlDevice::create(*desc, debug);
+        if (!dev) {
+            gl_write_error(err_buf, err_len, dev.error().message.c_str());
+            delete state; // NOLINT
+            return nullptr;
+        }
+
+        state->capabilities = dev->capabilities();
+        state->device.emplace(std::move(*dev));
+
+        return state;
+
+    } catch (std::exception const& e) {
+        gl_write_error(err_buf, err_len, e.what());
+    } catch (...) {
+        gl_write_error(err_buf, err_len, "unknown exception during device creation");
+    }
+
+    delete state; // NOLINT
     return nullptr;
 }
 
-static void gl_destroy_device(wren::rhi::DeviceHandle /*device*/) noexcept {}
+static void gl_destroy_device(wren::rhi::DeviceHandle device) noexcept {
+    delete device; // NOLINT
+}
 
 static void gl_get_capabilities(
-    wren::rhi::DeviceHandle  /*device*/,
-    wren::rhi::Capabilities*  /*out*/) noexcept {}
+    wren::rhi::DeviceHandle  device,
+    wren::rhi::Capabilities* out) noexcept
+{
+    if (device && out) {
+        *out = device->capabilities;
+    }
+}
+
+static wren::rhi::Status gl_create_buffers(
+    wren::rhi::DeviceHandle      device,
+    wren::rhi::BufferDesc const* descs,
+    uint32_t                     count,
+    wren::rhi::BufferHandle*     out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_buffers({descs, count}, {out, count});
+}
+
+static void gl_destroy_buffers(
+    wren::rhi::DeviceHandle        device,
+    wren::rhi::BufferHandle const* handles,
+    uint32_t                       count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->destroy_buffers({handles, count});
+    }
+}
+
+static wren::rhi::Status gl_create_textures(
+    wren::rhi::DeviceHandle       device,
+    wren::rhi::TextureDesc const* descs,
+    uint32_t                      count,
+    wren::rhi::TextureHandle*     out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_textures({descs, count}, {out, count});
+}
+
+static void gl_destroy_textures(
+    wren::rhi::DeviceHandle         device,
+    wren::rhi::TextureHandle const* handles,
+    uint32_t                        count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->destroy_textures({handles, count});
+    }
+}
+
+static void* gl_map_buffer(
+    wren::rhi::DeviceHandle device,
+    wren::rhi::BufferHandle buffer) noexcept
+{
+    return (device && device->device) ? device->device->buffer_mapping(buffer) : nullptr;
+}
+
+// Feature::BufferDeviceAddress is never offered.
+static uint64_t gl_buffer_device_address(
+    wren::rhi::DeviceHandle /*device*/,
+    wren::rhi::BufferHandle /*buffer*/) noexcept { return 0; }
+
+// -------------------------------------------------------------------------------------------------
+// Bindless heap
+// -------------------------------------------------------------------------------------------------
+
+static void gl_query_bindless_heap(
+    wren::rhi::DeviceHandle      device,
+    wren::rhi::BindlessHeapInfo* out) noexcept
+{
+    if (!out) {
+        return;
+    }
+    if (!device || !device->device) {
+        *out = {};
+        return;
+    }
+    device->device->bindless_heap_info(*out);
+}
+
+static uint32_t gl_buffer_bindless_index(
+    wren::rhi::DeviceHandle device,
+    wren::rhi::BufferHandle buffer) noexcept
+{
+    return (device && device->device) ? device->device->bindless_index(buffer)
+                                      : wren::rhi::k_invalid_bindless_index;
+}
+
+static uint32_t gl_texture_bindless_index(
+    wren::rhi::DeviceHandle  device,
+    wren::rhi::TextureHandle texture,
+    wren::rhi::BindlessClass cls) noexcept
+{
+    return (device && device->device) ? device->device->bindless_index(texture, cls)
+                                      : wren::rhi::k_invalid_bindless_index;
+}
+
+static wren::rhi::Status gl_find_samplers(
+    wren::rhi::DeviceHandle       device,
+    wren::rhi::SamplerDesc const* descs,
+    uint32_t                      count,
+    uint32_t*                     out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->find_samplers({descs, count}, {out, count});
+}
+
+// -------------------------------------------------------------------------------------------------
+// Device memory
+//
+// The driver places every GL object itself: there is nothing to defragment,
+// and no placed or sparse resources.
+// -------------------------------------------------------------------------------------------------
+
+static void gl_query_memory_budget(
+    wren::rhi::DeviceHandle  device,
+    wren::rhi::MemoryBudget* out) noexcept
+{
+    if (!out) {
+        return;
+    }
+    if (!device || !device->device) {
+        *out = {};
+        return;
+    }
+    device->device->memory_budget(*out);
+}
+
+static wren::rhi::Status gl_defragment_memory(
+    wren::rhi::DeviceHandle          /*device*/,
+    wren::rhi::DefragmentDesc const* /*desc*/,
+    wren::rhi::DefragmentStats*      out) noexcept
+{
+    if (out) *out = {};
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+static wren::rhi::Status gl_texture_memory_requirements(
+    wren::rhi::DeviceHandle        /*device*/,
+    wren::rhi::TextureDesc const*  /*descs*/,
+    uint32_t                       count,
+    wren::rhi::MemoryRequirements* out) noexcept
+{
+    for (uint32_t i = 0; out && i < count; ++i) out[i] = {};
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+static wren::rhi::Status gl_create_memory_heaps(
+    wren::rhi::DeviceHandle          /*device*/,
+    wren::rhi::MemoryHeapDesc const* /*descs*/,
+    uint32_t                         count,
+    wren::rhi::HeapHandle*           out) noexcept
+{
+    for (uint32_t i = 0; out && i < count; ++i) out[i] = {};
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+static void gl_destroy_memory_heaps(
+    wren::rhi::DeviceHandle      /*device*/,
+    wren::rhi::HeapHandle const* /*handles*/,
+    uint32_t                     /*count*/) noexcept {}
+
+static wren::rhi::Status gl_sparse_texture_info(
+    wren::rhi::DeviceHandle       /*device*/,
+    wren::rhi::TextureHandle      /*texture*/,
+    wren::rhi::SparseTextureInfo* out) noexcept
+{
+    if (out) *out = {};
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+// Acceleration structures: GL has no core ray tracing.
+static wren::rhi::Status gl_acceleration_structure_sizes(
+    wren::rhi::DeviceHandle                        /*device*/,
+    wren::rhi::AccelerationStructureInputs const*  /*inputs*/,
+    wren::rhi::AccelerationStructureSizes*         out) noexcept
+{
+    if (out) *out = {};
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+static wren::rhi::Status gl_create_acceleration_structures(
+    wren::rhi::DeviceHandle                      /*device*/,
+    wren::rhi::AccelerationStructureDesc const*  /*descs*/,
+    uint32_t                                     count,
+    wren::rhi::AccelerationStructureHandle*      out) noexcept
+{
+    for (uint32_t i = 0; out && i < count; ++i) out[i] = {};
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+static void gl_destroy_acceleration_structures(
+    wren::rhi::DeviceHandle                        /*device*/,
+    wren::rhi::AccelerationStructureHandle const*  /*handles*/,
+    uint32_t                                       /*count*/) noexcept {}
+
+static uint64_t gl_acceleration_structure_reference(
+    wren::rhi::DeviceHandle                 /*device*/,
+    wren::rhi::AccelerationStructureHandle  /*structure*/) noexcept
+{
+    return 0;
+}
+
+static wren::rhi::Status gl_build_acceleration_structures_on_host(
+    wren::rhi::DeviceHandle                       /*device*/,
+    wren::rhi::AccelerationStructureBuild const*  /*builds*/,
+    uint32_t                                      /*count*/) noexcept
+{
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Shader modules
+// -------------------------------------------------------------------------------------------------
+
+static wren::rhi::Status gl_create_shader_modules(
+    wren::rhi::DeviceHandle            device,
+    wren::rhi::ShaderModuleDesc const* descs,
+    uint32_t                           count,
+    wren::rhi::ShaderModuleHandle*     out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_shader_modules({descs, count}, {out, count});
+}
+
+static void gl_destroy_shader_modules(
+    wren::rhi::DeviceHandle              device,
+    wren::rhi::ShaderModuleHandle const* handles,
+    uint32_t                             count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->destroy_shader_modules({handles, count});
+    }
+}
+
+static wren::rhi::Status gl_shader_module_reflection(
+    wren::rhi::DeviceHandle       device,
+    wren::rhi::ShaderModuleHandle module,
+    wren::rhi::ShaderReflection*  out) noexcept
+{
+    if (!out) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    *out = {};
+    if (!device || !device->device) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->shader_module_reflection(module, *out);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Pipeline cache
+// -------------------------------------------------------------------------------------------------
+
+static void gl_query_pipeline_cache(
+    wren::rhi::DeviceHandle        device,
+    wren::rhi::PipelineCacheStats* out) noexcept
+{
+    if (!out) {
+        return;
+    }
+    if (!device || !device->device) {
+        *out = {};
+        return;
+    }
+    device->device->pipeline_cache_stats(*out);
+}
+
+static wren::rhi::Status gl_save_pipeline_cache(wren::rhi::DeviceHandle device) noexcept {
+    if (!device || !device->device) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return wren::rhi::Status::Ok;  // the driver keeps its own
+}
+
+// -------------------------------------------------------------------------------------------------
+// Pipelines
+// -------------------------------------------------------------------------------------------------
+
+static wren::rhi::Status gl_create_graphics_pipelines(
+    wren::rhi::DeviceHandle                device,
+    wren::rhi::GraphicsPipelineDesc const* descs,
+    uint32_t                               count,
+    wren::rhi::PipelineHandle*             out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_graphics_pipelines({descs, count}, {out, count});
+}
+
+static wren::rhi::Status gl_create_compute_pipelines(
+    wren::rhi::DeviceHandle               device,
+    wren::rhi::ComputePipelineDesc const* descs,
+    uint32_t                              count,
+    wren::rhi::PipelineHandle*            out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_compute_pipelines({descs, count}, {out, count});
+}
+
+static void gl_destroy_pipelines(
+    wren::rhi::DeviceHandle          device,
+    wren::rhi::PipelineHandle const* handles,
+    uint32_t                         count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->destroy_pipelines({handles, count});
+    }
+}
+
+static wren::rhi::PipelineStatus gl_pipeline_status(
+    wren::rhi::DeviceHandle   device,
+    wren::rhi::PipelineHandle pipeline) noexcept
+{
+    if (!device || !device->device) {
+        return wren::rhi::PipelineStatus::Failed;
+    }
+    return device->device->pipeline_status(pipeline);
+}
+
+static void gl_prioritize_pipelines(
+    wren::rhi::DeviceHandle          device,
+    wren::rhi::PipelineHandle const* handles,
+    uint32_t                         count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->prioritize_pipelines({handles, count});
+    }
+}
+
+static wren::rhi::Status gl_wait_pipelines(
+    wren::rhi::DeviceHandle          device,
+    wren::rhi::PipelineHandle const* handles,
+    uint32_t                         count) noexcept
+{
+    if (!device || !device->device || (count > 0 && !handles)) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->wait_pipelines({handles, count});
+}
+
+// -------------------------------------------------------------------------------------------------
+// Frames, command lists & timelines
+// -------------------------------------------------------------------------------------------------
+
+static wren::rhi::Status gl_begin_frame(wren::rhi::DeviceHandle device) noexcept {
+    if (!device || !device->device) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->begin_frame();
+}
+
+static wren::rhi::Status gl_end_frame(wren::rhi::DeviceHandle device) noexcept {
+    if (!device || !device->device) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->end_frame();
+}
+
+// No GPU timestamps: frames read back empty.
+static void gl_read_profile_frame(wren::rhi::DeviceHandle /*device*/,
+                                  wren::rhi::ProfileFrame* out) noexcept {
+    if (out) *out = {};
+}
+
+static wren::rhi::Status gl_begin_command_list(
+    wren::rhi::DeviceHandle           device,
+    wren::rhi::CommandListDesc const* desc,
+    wren::rhi::CommandListHandle*     out) noexcept
+{
+    if (!out) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    *out = nullptr;
+    if (!device || !device->device || !desc) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->begin_command_list(*desc, *out);
+}
+
+static wren::rhi::Status gl_end_command_list(wren::rhi::CommandListHandle list) noexcept {
+    return wren::rhi::opengl::GlDevice::end_command_list(list);
+}
+
+static wren::rhi::Status gl_submit_command_lists(
+    wren::rhi::DeviceHandle      device,
+    wren::rhi::SubmitDesc const* desc,
+    wren::rhi::SyncPoint*        out) noexcept
+{
+    if (!out) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    *out = {};
+    if (!device || !device->device || !desc) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->submit(*desc, *out);
+}
+
+static wren::rhi::Status gl_bind_sparse(
+    wren::rhi::DeviceHandle          /*device*/,
+    wren::rhi::SparseBindDesc const* /*desc*/,
+    wren::rhi::SyncPoint*            out) noexcept
+{
+    if (out) *out = {};
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+static wren::rhi::Status gl_wait_sync_points(
+    wren::rhi::DeviceHandle     device,
+    wren::rhi::SyncPoint const* points,
+    uint32_t                    count,
+    uint64_t                    timeout_ns) noexcept
+{
+    if (!device || !device->device || (count > 0 && !points)) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->wait({points, count}, timeout_ns);
+}
+
+static uint64_t gl_completed_value(wren::rhi::DeviceHandle device, wren::rhi::QueueType queue) noexcept {
+    return (device && device->device) ? device->device->completed_value(queue) : 0;
+}
+
+// Presentation entry points: the device renders off-screen into its own
+// textures and offers no Feature::Presentation.
+static wren::rhi::SwapchainHandle gl_create_swapchain(
+    wren::rhi::DeviceHandle         /*device*/,
+    wren::rhi::SwapchainDesc const* /*desc*/,
+    char*       err_buf,
+    std::size_t err_len) noexcept
+{
+    gl_write_error(err_buf, err_len, "OpenGL backend: presentation is not supported");
+    return nullptr;
+}
+
+static void gl_destroy_swapchain(wren::rhi::DeviceHandle /*device*/,
+                                 wren::rhi::SwapchainHandle /*swapchain*/) noexcept {}
+
+static wren::rhi::Status gl_resize_swapchain(
+    wren::rhi::DeviceHandle    /*device*/,
+    wren::rhi::SwapchainHandle /*swapchain*/,
+    uint32_t                   /*width*/,
+    uint32_t                   /*height*/) noexcept
+{
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+static wren::rhi::Status gl_acquire_swapchain_image(
+    wren::rhi::DeviceHandle    /*device*/,
+    wren::rhi::SwapchainHandle /*swapchain*/,
+    uint64_t                   /*timeout_ns*/,
+    wren::rhi::SwapchainImage* out) noexcept
+{
+    if (out) *out = {};
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+static wren::rhi::Status gl_present_swapchain(wren::rhi::DeviceHandle /*device*/,
+                                              wren::rhi::SwapchainHandle /*swapchain*/) noexcept {
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+static wren::rhi::Status gl_wait_for_present(wren::rhi::DeviceHandle /*device*/,
+                                             wren::rhi::SwapchainHandle /*swapchain*/,
+                                             uint64_t /*timeout_ns*/) noexcept {
+    return wren::rhi::Status::MissingRequiredFeature;
+}
+
+static void gl_query_swapchain(wren::rhi::DeviceHandle /*device*/, wren::rhi::SwapchainHandle /*swapchain*/,
+                               wren::rhi::SwapchainInfo* out) noexcept {
+    if (out) *out = {};
+}
+
+// Recording entries forward straight to commands.cpp; null arguments are
+// contract violations caught by the asserts there.
+
+static void gl_cmd_barriers(
+    wren::rhi::CommandListHandle     list,
+    wren::rhi::TextureBarrier const* textures, uint32_t texture_count,
+    wren::rhi::BufferBarrier const*  buffers,  uint32_t buffer_count) noexcept
+{
+    wren::rhi::opengl::cmd_barriers(*list, {textures, texture_count}, {buffers, buffer_count});
+}
+
+static void gl_cmd_copy_buffer(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::BufferHandle      src,
+    wren::rhi::BufferHandle      dst,
+    wren::rhi::BufferCopy const* regions,
+    uint32_t                     count) noexcept
+{
+    wren::rhi::opengl::cmd_copy_buffer(*list, src, dst, {regions, count});
+}
+
+static void gl_cmd_copy_buffer_to_texture(
+    wren::rhi::CommandListHandle        list,
+    wren::rhi::BufferHandle             src,
+    wren::rhi::TextureHandle            dst,
+    wren::rhi::BufferTextureCopy const* regions,
+    uint32_t                            count) noexcept
+{
+    wren::rhi::opengl::cmd_copy_buffer_to_texture(*list, src, dst, {regions, count});
+}
+
+static void gl_cmd_copy_texture_to_buffer(
+    wren::rhi::CommandListHandle        list,
+    wren::rhi::TextureHandle            src,
+    wren::rhi::BufferHandle             dst,
+    wren::rhi::BufferTextureCopy const* regions,
+    uint32_t                            count) noexcept
+{
+    wren::rhi::opengl::cmd_copy_texture_to_buffer(*list, src, dst, {regions, count});
+}
+
+static void gl_cmd_begin_rendering(
+    wren::rhi::CommandListHandle    list,
+    wren::rhi::RenderingDesc const* desc) noexcept
+{
+    wren::rhi::opengl::cmd_begin_rendering(*list, *desc);
+}
+
+static void gl_cmd_end_rendering(wren::rhi::CommandListHandle list) noexcept {
+    wren::rhi::opengl::cmd_end_rendering(*list);
+}
+
+static void gl_cmd_set_viewport(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::Viewport const*   viewport) noexcept
+{
+    wren::rhi::opengl::cmd_set_viewport(*list, *viewport);
+}
+
+static void gl_cmd_set_scissor(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::Scissor const*    scissor) noexcept
+{
+    wren::rhi::opengl::cmd_set_scissor(*list, *scissor);
+}
+
+static void gl_cmd_bind_pipeline(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::PipelineHandle    pipeline) noexcept
+{
+    wren::rhi::opengl::cmd_bind_pipeline(*list, pipeline);
+}
+
+static void gl_cmd_push_constants(
+    wren::rhi::CommandListHandle list,
+    uint32_t                     offset,
+    uint32_t                     size,
+    void const*                  data) noexcept
+{
+    wren::rhi::opengl::cmd_push_constants(*list, offset, size, data);
+}
+
+static void gl_cmd_bind_vertex_buffers(
+    wren::rhi::CommandListHandle   list,
+    uint32_t                       first_binding,
+    wren::rhi::BufferHandle const* buffers,
+    uint64_t const*                offsets,
+    uint32_t                       count) noexcept
+{
+    wren::rhi::opengl::cmd_bind_vertex_buffers(*list, first_binding, {buffers, count}, {offsets, count});
+}
+
+static void gl_cmd_bind_index_buffer(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::BufferHandle      buffer,
+    uint64_t                     offset,
+    wren::rhi::IndexType         type) noexcept
+{
+    wren::rhi::opengl::cmd_bind_index_buffer(*list, buffer, offset, type);
+}
+
+static void gl_cmd_draw(
+    wren::rhi::CommandListHandle list,
+    uint32_t vertex_count, uint32_t instance_count,
+    uint32_t first_vertex, uint32_t first_instance) noexcept
+{
+    wren::rhi::opengl::cmd_draw(*list, vertex_count, instance_count, first_vertex, first_instance);
+}
+
+static void gl_cmd_draw_indexed(
+    wren::rhi::CommandListHandle list,
+    uint32_t index_count, uint32_t instance_count,
+    uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) noexcept
+{
+    wren::rhi::opengl::cmd_draw_indexed(*list, index_count, instance_count, first_index,
+                                        vertex_offset, first_instance);
+}
+
+static void gl_cmd_dispatch(wren::rhi::CommandListHandle list, uint32_t x, uint32_t y, uint32_t z) noexcept {
+    wren::rhi::opengl::cmd_dispatch(*list, x, y, z);
+}
+
+static void gl_cmd_draw_indirect(
+    wren::rhi::CommandListHandle       list,
+    wren::rhi::IndirectDrawDesc const* desc) noexcept
+{
+    wren::rhi::opengl::cmd_draw_indirect(*list, *desc, false);
+}
+
+static void gl_cmd_draw_indexed_indirect(
+    wren::rhi::CommandListHandle       list,
+    wren::rhi::IndirectDrawDesc const* desc) noexcept
+{
+    wren::rhi::opengl::cmd_draw_indirect(*list, *desc, true);
+}
+
+static void gl_cmd_dispatch_indirect(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::BufferHandle      buffer,
+    uint64_t                     offset) noexcept
+{
+    wren::rhi::opengl::cmd_dispatch_indirect(*list, buffer, offset);
+}
+
+// Acceleration structure commands: unreachable, no structure can be created.
+static void gl_cmd_build_acceleration_structures(wren::rhi::CommandListHandle,
+                                                wren::rhi::AccelerationStructureBuild const*, uint32_t) noexcept {}
+
+static void gl_cmd_write_compacted_sizes(wren::rhi::CommandListHandle, wren::rhi::AccelerationStructureHandle const*,
+                                         uint32_t, wren::rhi::BufferHandle, uint64_t) noexcept {}
+
+static void gl_cmd_copy_acceleration_structure(wren::rhi::CommandListHandle, wren::rhi::AccelerationStructureHandle,
+                                               wren::rhi::AccelerationStructureHandle,
+                                               wren::rhi::AccelerationStructureCopyMode) noexcept {}
+
+static void gl_cmd_record_packets(
+    wren::rhi::CommandListHandle    list,
+    wren::rhi::CommandPacket const* packets,
+    uint32_t                        count) noexcept
+{
+    wren::rhi::opengl::cmd_record_packets(*list, {packets, count});
+}
+
+static void gl_cmd_execute_command_lists(
+    wren::rhi::CommandListHandle        list,
+    wren::rhi::CommandListHandle const* secondaries,
+    uint32_t                            count) noexcept
+{
+    wren::rhi::opengl::cmd_execute_command_lists(*list, {secondaries, count});
+}
+
+static void gl_cmd_begin_profile_region(
+    wren::rhi::CommandListHandle        list,
+    wren::rhi::ProfileRegionDesc const* desc) noexcept
+{
+    wren::rhi::opengl::cmd_begin_profile_region(*list, *desc);
+}
+
+static void gl_cmd_end_profile_region(wren::rhi::CommandListHandle list) noexcept {
+    wren::rhi::opengl::cmd_end_profile_region(*list);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Static backend vtable + DLL entry point
+// -------------------------------------------------------------------------------------------------
 
 static wren::rhi::BackendVTable s_opengl_backend{
     .abi_version      = wren::rhi::k_backend_abi_version,
     .backend_id       = gl_backend_id,
+
+    .create_instance    = gl_create_instance,
+    .destroy_instance   = gl_destroy_instance,
+    .enumerate_adapters = gl_enumerate_adapters,
+
     .create_device    = gl_create_device,
     .destroy_device   = gl_destroy_device,
     .get_capabilities = gl_get_capabilities,
+    .create_buffers   = gl_create_buffers,
+    .destroy_buffers  = gl_destroy_buffers,
+    .create_textures  = gl_create_textures,
+    .destroy_textures = gl_destroy_textures,
+    .map_buffer       = gl_map_buffer,
+
+    .buffer_device_address = gl_buffer_device_address,
+
+    .query_bindless_heap    = gl_query_bindless_heap,
+    .buffer_bindless_index  = gl_buffer_bindless_index,
+    .texture_bindless_index = gl_texture_bindless_index,
+    .find_samplers          = gl_find_samplers,
+
+    .query_memory_budget = gl_query_memory_budget,
+    .defragment_memory   = gl_defragment_memory,
+
+    .texture_memory_requirements = gl_texture_memory_requirements,
+    .create_memory_heaps         = gl_create_memory_heaps,
+    .destroy_memory_heaps        = gl_destroy_memory_heaps,
+    .sparse_texture_info         = gl_sparse_texture_info,
+
+    .acceleration_structure_sizes          = gl_acceleration_structure_sizes,
+    .create_acceleration_structures        = gl_create_acceleration_structures,
+    .destroy_acceleration_structures       = gl_destroy_acceleration_structures,
+    .acceleration_structure_reference      = gl_acceleration_structure_reference,
+    .build_acceleration_structures_on_host = gl_build_acceleration_structures_on_host,
+
+    .create_shader_modules    = gl_create_shader_modules,
+    .destroy_shader_modules   = gl_destroy_shader_modules,
+    .shader_module_reflection = gl_shader_module_reflection,
+
+    .query_pipeline_cache = gl_query_pipeline_cache,
+    .save_pipeline_cache  = gl_save_pipeline_cache,
+
+    .create_graphics_pipelines = gl_create_graphics_pipelines,
+    .create_compute_pipelines  = gl_create_compute_pipelines,
+    .destroy_pipelines         = gl_destroy_pipelines,
+    .pipeline_status           = gl_pipeline_status,
+    .prioritize_pipelines      = gl_prioritize_pipelines,
+    .wait_pipelines            = gl_wait_pipelines,
+
+    .begin_frame          = gl_begin_frame,
+    .end_frame            = gl_end_frame,
+    .read_profile_frame   = gl_read_profile_frame,
+    .begin_command_list   = gl_begin_command_list,
+    .end_command_list     = gl_end_command_list,
+    .submit_command_lists = gl_submit_command_lists,
+    .bind_sparse          = gl_bind_sparse,
+    .wait_sync_points     = gl_wait_sync_points,
+    .completed_value      = gl_completed_value,
+
+    .create_swapchain        = gl_create_swapchain,
+    .destroy_swapchain       = gl_destroy_swapchain,
+    .resize_swapchain        = gl_resize_swapchain,
+    .acquire_swapchain_image = gl_acquire_swapchain_image,
+    .present_swapchain       = gl_present_swapchain,
+    .wait_for_present        = gl_wait_for_present,
+    .query_swapchain         = gl_query_swapchain,
+
+    .cmd_barriers               = gl_cmd_barriers,
+    .cmd_copy_buffer            = gl_cmd_copy_buffer,
+    .cmd_copy_buffer_to_texture = gl_cmd_copy_buffer_to_texture,
+    .cmd_copy_texture_to_buffer = gl_cmd_copy_texture_to_buffer,
+    .cmd_begin_rendering        = gl_cmd_begin_rendering,
+    .cmd_end_rendering          = gl_cmd_end_rendering,
+    .cmd_set_viewport           = gl_cmd_set_viewport,
+    .cmd_set_scissor            = gl_cmd_set_scissor,
+    .cmd_bind_pipeline          = gl_cmd_bind_pipeline,
+    .cmd_push_constants         = gl_cmd_push_constants,
+    .cmd_bind_vertex_buffers    = gl_cmd_bind_vertex_buffers,
+    .cmd_bind_index_buffer      = gl_cmd_bind_index_buffer,
+    .cmd_draw                   = gl_cmd_draw,
+    .cmd_draw_indexed           = gl_cmd_draw_indexed,
+    .cmd_dispatch               = gl_cmd_dispatch,
+    .cmd_draw_indirect          = gl_cmd_draw_indirect,
+    .cmd_draw_indexed_indirect  = gl_cmd_draw_indexed_indirect,
+    .cmd_dispatch_indirect      = gl_cmd_dispatch_indirect,
+    .cmd_build_acceleration_structures = gl_cmd_build_acceleration_structures,
+    .cmd_write_compacted_sizes         = gl_cmd_write_compacted_sizes,
+    .cmd_copy_acceleration_structure   = gl_cmd_copy_acceleration_structure,
+    .cmd_record_packets         = gl_cmd_record_packets,
+    .cmd_execute_command_lists  = gl_cmd_execute_command_lists,
+    .cmd_begin_profile_region   = gl_cmd_begin_profile_region,
+    .cmd_end_profile_region     = gl_cmd_end_profile_region,
 };
 
 extern "C" WREN_RHI_OPENGL_EXPORT wren::rhi::BackendVTable* wren_rhi_create() {
     return &s_opengl_backend;
 }
+
+// -------------------------------------------------------------------------------------------------
+// Static-link entry points (WREN_RHI_STATIC_BACKEND, see wren/rhi/static_backend.hpp)
+//
+// CommandList calls these directly instead of through s_opengl_backend; each
+// forwards to the vtable function above.
+// -------------------------------------------------------------------------------------------------
+
+#if WREN_RHI_STATIC_BACKEND
+
+namespace wren::rhi::static_backend {
+
+Status end_command_list(CommandListHandle list) noexcept {
+    return ::gl_end_command_list(list);
+}
+
+void cmd_barriers(CommandListHandle list, TextureBarrier const* textures, uint32_t texture_count,
+                  BufferBarrier const* buffers, uint32_t buffer_count) noexcept {
+    ::gl_cmd_barriers(list, textures, texture_count, buffers, buffer_count);
+}
+
+void cmd_copy_buffer(CommandListHandle list, BufferHandle src, BufferHandle dst,
+                     BufferCopy const* regions, uint32_t count) noexcept {
+    ::gl_cmd_copy_buffer(list, src, dst, regions, count);
+}
+
+void cmd_copy_buffer_to_texture(CommandListHandle list, BufferHandle src, TextureHandle dst,
+                                BufferTextureCopy const* regions, uint32_t count) noexcept {
+    ::gl_cmd_copy_buffer_to_texture(list, src, dst, regions, count);
+}
+
+void cmd_copy_texture_to_buffer(CommandListHandle list, TextureHandle src, BufferHandle dst,
+                                BufferTextureCopy const* regions, uint32_t count) noexcept {
+    ::gl_cmd_copy_texture_to_buffer(list, src, dst, regions, count);
+}
+
+void cmd_begin_rendering(CommandListHandle list, RenderingDesc const* desc) noexcept {
+    ::gl_cmd_begin_rendering(list, desc);
+}
+
+void cmd_end_rendering(CommandListHandle list) noexcept {
+    ::gl_cmd_end_rendering(list);
+}
+
+void cmd_set_viewport(CommandListHandle list, Viewport const* viewport) noexcept {
+    ::gl_cmd_set_viewport(list, viewport);
+}
+
+void cmd_set_scissor(CommandListHandle list, Scissor const* scissor) noexcept {
+    ::gl_cmd_set_scissor(list, scissor);
+}
+
+void cmd_bind_pipeline(CommandListHandle list, PipelineHandle pipeline) noexcept {
+    ::gl_cmd_bind_pipeline(list, pipeline);
+}
+
+void cmd_push_constants(CommandListHandle list, uint32_t offset, uint32_t size,
+                        void const* data) noexcept {
+    ::gl_cmd_push_constants(list, offset, size, data);
+}
+
+void cmd_bind_vertex_buffers(CommandListHandle list, uint32_t first_binding,
+                             BufferHandle const* buffers, uint64_t const* offsets,
+                             uint32_t count) noexcept {
+    ::gl_cmd_bind_vertex_buffers(list, first_binding, buffers, offsets, count);
+}
+
+void cmd_bind_index_buffer(CommandListHandle list, BufferHandle buffer, uint64_t offset,
+                           IndexType type) noexcept {
+    ::gl_cmd_bind_index_buffer(list, buffer, offset, type);
+}
+
+void cmd_draw(CommandListHandle list, uint32_t vertex_count, uint32_t instance_count,
+              uint32_t first_vertex, uint32_t first_instance) noexcept {
+    ::gl_cmd_draw(list, vertex_count, instance_count, first_vertex, first_instance);
+}
+
+void cmd_draw_indexed(CommandListHandle list, uint32_t index_count, uint32_t instance_count,
+                      uint32_t first_index, int32_t vertex_offset,
+                      uint32_t first_instance) noexcept {
+    ::gl_cmd_draw_indexed(list, index_count, instance_count, first_index, vertex_offset, first_instance);
+}
+
+void cmd_dispatch(CommandListHandle list, uint32_t x, uint32_t y, uint32_t z) noexcept {
+    ::gl_cmd_dispatch(list, x, y, z);
+}
+
+void cmd_draw_indirect(CommandListHandle list, IndirectDrawDesc const* desc) noexcept {
+    ::gl_cmd_draw_indirect(list, desc);
+}
+
+void cmd_draw_indexed_indirect(CommandListHandle list, IndirectDrawDesc const* desc) noexcept {
+    ::gl_cmd_draw_indexed_indirect(list, desc);
+}
+
+void cmd_dispatch_indirect(CommandListHandle list, BufferHandle buffer, uint64_t offset) noexcept {
+    ::gl_cmd_dispatch_indirect(list, buffer, offset);
+}
+
+void cmd_record_packets(CommandListHandle list, CommandPacket const* packets,
+                        uint32_t count) noexcept {
+    ::gl_cmd_record_packets(list, packets, count);
+}
+
+void cmd_execute_command_lists(CommandListHandle list, CommandListHandle const* secondaries,
+                               uint32_t count) noexcept {
+    ::gl_cmd_execute_command_lists(list, secondaries, count);
+}
+
+void cmd_begin_profile_region(CommandListHandle list, ProfileRegionDesc const* desc) noexcept {
+    ::gl_cmd_begin_profile_region(list, desc);
+}
+
+void cmd_end_profile_region(CommandListHandle list) noexcept {
+    ::gl_cmd_end_profile_region(list);
+}
+
+} // namespace wren::rhi::static_backend
+
+#endif
@@ -0,0 +1,1262 @@
+#include "gl_device.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <span>
+#include <type_traits>
+
+#include <spdlog/spdlog.h>
+
+#include <wren/rhi/api/state_hash.hpp>
+
+#include "gl_convert.hpp"
+#include "gl_device_impl.hpp"
+
+namespace wren::rhi::opengl {
+
+namespace {
+
+// GL_MAX_DEBUG_GROUP_STACK_DEPTH is at least 64; deeper regions are not
+// labelled.
+constexpr uint32_t k_max_region_depth = 64;
+constexpr uint32_t k_max_region_name  = 255;
+
+// -----------------------------------------------------------------
+// Arena
+//
+// Payloads start 8-byte aligned. A header's items follow it at the next
+// 8-byte boundary.
+// -----------------------------------------------------------------
+[[nodiscard]] constexpr std::size_t arena_align(std::size_t bytes) noexcept {
+    return (bytes + 7) & ~std::size_t{7};
+}
+
+template<typename T>
+[[nodiscard]] uint32_t append(CommandListState& list, T const* items, std::size_t count) {
+    static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= 8);
+    std::size_t const offset = arena_align(list.data.size());
+    list.data.resize(offset + sizeof(T) * count);
+    if (count > 0)
+        std::memcpy(list.data.data() + offset, items, sizeof(T) * count);
+    return static_cast<uint32_t>(offset);
+}
+
+template<typename T>
+[[nodiscard]] T const* payload(CommandListState const& list, GlCommand const& c) noexcept {
+    return reinterpret_cast<T const*>(list.data.data() + c.payload);
+}
+
+template<typename Header, typename T>
+[[nodiscard]] T const* items_after(CommandListState const& list, GlCommand const& c) noexcept {
+    return reinterpret_cast<T const*>(list.data.data() + c.payload + arena_align(sizeof(Header)));
+}
+
+void dropped() noexcept {
+    SPDLOG_ERROR("[wren/rhi/opengl] Out of memory recording a command; it is dropped.");
+}
+
+void record(CommandListState& list, GlCommand const& command) noexcept {
+    try {
+        list.commands.push_back(command);
+    } catch (std::bad_alloc const&) {
+        dropped();
+    }
+}
+
+template<typename T>
+void record(CommandListState& list, GlCommand command, std::span<T const> items) noexcept {
+    std::size_t const size = list.data.size();
+    try {
+        command.payload = append(list, items.data(), items.size());
+        list.commands.push_back(command);
+    } catch (std::bad_alloc const&) {
+        list.data.resize(size);
+        dropped();
+    }
+}
+
+template<typename Header, typename T>
+void record(CommandListState& list, GlCommand command, Header const& header, std::span<T const> items) noexcept {
+    std::size_t const size = list.data.size();
+    try {
+        command.payload = append(list, &header, 1);
+        (void)append(list, items.data(), items.size());
+        list.commands.push_back(command);
+    } catch (std::bad_alloc const&) {
+        list.data.resize(size);
+        dropped();
+    }
+}
+
+[[nodiscard]] void const* buffer_offset(uint64_t offset) noexcept {
+    return reinterpret_cast<void const*>(static_cast<std::uintptr_t>(offset));
+}
+
+// -----------------------------------------------------------------
+// Fixed-function state
+//
+// Every setter compares against the shadow in ReplayState::fixed first.
+// -----------------------------------------------------------------
+void set_enabled(GlFunctions const& gl, GLenum cap, bool& shadow, bool enabled) noexcept {
+    if (shadow == enabled) return;
+    enabled ? gl.glEnable(cap) : gl.glDisable(cap);
+    shadow = enabled;
+}
+
+void set_depth_write(GlDevice::Impl& impl, bool enabled) noexcept {
+    auto& f = impl.replay.fixed;
+    if (f.depth_write == enabled) return;
+    impl.gl.glDepthMask(enabled ? 1 : 0);
+    f.depth_write = enabled;
+}
+
+void set_stencil_write(GlDevice::Impl& impl, GLuint mask) noexcept {
+    auto& f = impl.replay.fixed;
+    if (f.stencil_write == mask) return;
+    impl.gl.glStencilMaskSeparate(GL_FRONT_AND_BACK, mask);
+    f.stencil_write = mask;
+}
+
+void set_color_mask(GlDevice::Impl& impl, uint32_t attachment, ColorWriteMask mask) noexcept {
+    auto& shadow = impl.replay.fixed.blend[attachment].writeMask;
+    if (shadow == mask) return;
+    auto const bit = [mask](ColorWriteMask b) -> GLboolean { return underlying(mask & b) != 0 ? 1 : 0; };
+    impl.gl.glColorMaski(attachment, bit(ColorWriteMask::R), bit(ColorWriteMask::G), bit(ColorWriteMask::B),
+                         bit(ColorWriteMask::A));
+    shadow = mask;
+}
+
+void apply_rasterizer(GlDevice::Impl& impl, RasterizerStateDesc const& rs) noexcept {
+    auto const& gl = impl.gl;
+    auto& f        = impl.replay.fixed;
+
+    bool const cull = rs.cullMode != CullMode::None;
+    set_enabled(gl, GL_CULL_FACE, f.cull, cull);
+    if (cull) {
+        GLenum const face = rs.cullMode == CullMode::Front ? GL_FRONT
+                          : rs.cullMode == CullMode::Back  ? GL_BACK
+                                                           : GL_FRONT_AND_BACK;
+        if (f.cull_face != face) {
+            gl.glCullFace(face);
+            f.cull_face = face;
+        }
+    }
+    if (GLenum const front = to_gl(rs.frontFace); f.front_face != front) {
+        gl.glFrontFace(front);
+        f.front_face = front;
+    }
+    if (GLenum const mode = rs.fillMode == FillMode::Wireframe ? GL_LINE : GL_FILL; f.polygon_mode != mode) {
+        gl.glPolygonMode(GL_FRONT_AND_BACK, mode);
+        f.polygon_mode = mode;
+    }
+    set_enabled(gl, GL_DEPTH_CLAMP, f.depth_clamp, rs.depthClamp);
+
+    bool const offset = rs.depthBias != 0.0f || rs.slopeScaledDepthBias != 0.0f;
+    if (f.offset != offset) {
+        offset ? gl.glEnable(GL_POLYGON_OFFSET_FILL) : gl.glDisable(GL_POLYGON_OFFSET_FILL);
+        offset ? gl.glEnable(GL_POLYGON_OFFSET_LINE) : gl.glDisable(GL_POLYGON_OFFSET_LINE);
+        f.offset = offset;
+    }
+    if (offset && (f.offset_factor != rs.slopeScaledDepthBias || f.offset_units != rs.depthBias ||
+                   f.offset_clamp != rs.depthBiasClamp)) {
+        if (gl.glPolygonOffsetClamp)
+            gl.glPolygonOffsetClamp(rs.slopeScaledDepthBias, rs.depthBias, rs.depthBiasClamp);
+        else
+            gl.glPolygonOffset(rs.slopeScaledDepthBias, rs.depthBias);
+        f.offset_factor = rs.slopeScaledDepthBias;
+        f.offset_units  = rs.depthBias;
+        f.offset_clamp  = rs.depthBiasClamp;
+    }
+}
+
+void apply_depth_stencil(GlDevice::Impl& impl, DepthStencilStateDesc const& ds) noexcept {
+    auto const& gl = impl.gl;
+    auto& f        = impl.replay.fixed;
+
+    set_enabled(gl, GL_DEPTH_TEST, f.depth_test, ds.depthTestEnable);
+    if (ds.depthTestEnable) {
+        set_depth_write(impl, ds.depthWriteEnable);
+        if (GLenum const func = to_gl(ds.depthCompareOp); f.depth_func != func) {
+            gl.glDepthFunc(func);
+            f.depth_func = func;
+        }
+    }
+
+    set_enabled(gl, GL_STENCIL_TEST, f.stencil, ds.stencilTestEnable);
+    if (!ds.stencilTestEnable)
+        return;
+
+    auto const ref  = static_cast<GLint>(ds.stencilReference);
+    auto const read = static_cast<GLuint>(ds.stencilReadMask);
+    bool const shared_changed = f.stencil_ref != ref || f.stencil_read != read;
+    GLenum const faces[2] = {GL_FRONT, GL_BACK};
+    StencilOpState const* const ops[2] = {&ds.front, &ds.back};
+    for (uint32_t i = 0; i < 2; ++i) {
+        StencilOpState const& s = *ops[i];
+        if (GLenum const func = to_gl(s.compareOp); shared_changed || f.stencil_func[i] != func) {
+            gl.glStencilFuncSeparate(faces[i], func, ref, read);
+            f.stencil_func[i] = func;
+        }
+        GLenum const op[3] = {to_gl(s.failOp), to_gl(s.depthFailOp), to_gl(s.passOp)};
+        if (!std::equal(op, op + 3, f.stencil_op[i])) {
+            gl.glStencilOpSeparate(faces[i], op[0], op[1], op[2]);
+            std::copy_n(op, 3, f.stencil_op[i]);
+        }
+    }
+    f.stencil_ref  = ref;
+    f.stencil_read = read;
+    set_stencil_write(impl, ds.stencilWriteMask);
+}
+
+void apply_blend(GlDevice::Impl& impl, GraphicsState const& state) noexcept {
+    auto const& gl = impl.gl;
+    auto& f        = impl.replay.fixed;
+
+    for (uint32_t i = 0; i < state.color_count; ++i) {
+        ColorAttachmentBlendDesc const& b = state.blend[i];
+        ColorAttachmentBlendDesc&       s = f.blend[i];
+        if (s.blendEnable != b.blendEnable) {
+            b.blendEnable ? gl.glEnablei(GL_BLEND, i) : gl.glDisablei(GL_BLEND, i);
+            s.blendEnable = b.blendEnable;
+        }
+        if (b.blendEnable) {
+            if (s.srcColor != b.srcColor || s.dstColor != b.dstColor || s.srcAlpha != b.srcAlpha ||
+                s.dstAlpha != b.dstAlpha) {
+                gl.glBlendFuncSeparatei(i, to_gl(b.srcColor), to_gl(b.dstColor), to_gl(b.srcAlpha),
+                                        to_gl(b.dstAlpha));
+                s.srcColor = b.srcColor;
+                s.dstColor = b.dstColor;
+                s.srcAlpha = b.srcAlpha;
+                s.dstAlpha = b.dstAlpha;
+            }
+            if (s.colorOp != b.colorOp || s.alphaOp != b.alphaOp) {
+                gl.glBlendEquationSeparatei(i, to_gl(b.colorOp), to_gl(b.alphaOp));
+                s.colorOp = b.colorOp;
+                s.alphaOp = b.alphaOp;
+            }
+        }
+        set_color_mask(impl, i, b.writeMask);
+    }
+}
+
+void apply_state(GlDevice::Impl& impl, GraphicsState const& state) noexcept {
+    auto& f = impl.replay.fixed;
+    apply_rasterizer(impl, state.rasterizer);
+    apply_depth_stencil(impl, state.depth_stencil);
+    apply_blend(impl, state);
+    if (state.topology == GL_PATCHES && f.patch_points != static_cast<GLint>(state.patch_points)) {
+        f.patch_points = static_cast<GLint>(state.patch_points);
+        impl.gl.glPatchParameteri(GL_PATCH_VERTICES, f.patch_points);
+    }
+}
+
+// -----------------------------------------------------------------
+// Bindings
+// -----------------------------------------------------------------
+void use_program(GlDevice::Impl& impl, GLuint program) noexcept {
+    if (impl.replay.program == program) return;
+    impl.gl.glUseProgram(program);
+    impl.replay.program = program;
+}
+
+void bind_draw_indirect(GlDevice::Impl& impl, GLuint buffer) noexcept {
+    if (impl.replay.draw_indirect_buffer == buffer) return;
+    impl.gl.glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer);
+    impl.replay.draw_indirect_buffer = buffer;
+}
+
+/// Makes the pipeline @p record, its fallback while it is pending, or
+/// nothing when neither is usable, current for draws or dispatches.
+void bind_pipeline(GlDevice::Impl& impl, PipelineRecord* record) noexcept {
+    auto& r = impl.replay;
+    auto const ready = [](PipelineRecord const* p) {
+        return p && p->status.load(std::memory_order_acquire) == PipelineStatus::Ready;
+    };
+
+    PipelineRecord* bound = record;
+    if (!ready(record)) {
+        // The fallback outlives the flush: destroying it defers its release.
+        auto const fallback = record->fallback ? find_pipeline(impl, record->fallback) : nullptr;
+        if (ready(fallback.get()))
+            bound = fallback.get();
+        else if (!ensure_linked(impl, *record))
+            bound = nullptr;
+    }
+
+    if (record->compute) {
+        r.compute = bound;
+        return;
+    }
+    r.graphics = bound;
+    if (!bound)
+        return;
+
+    if (r.vertex_array != bound->vertex_array) {
+        impl.gl.glBindVertexArray(bound->vertex_array);
+        r.vertex_array = bound->vertex_array;
+        // Vertex and index buffers are vertex array state.
+        for (uint32_t b = 0; b < k_max_vertex_bindings; ++b) {
+            if (r.vertex_buffers[b].buffer)
+                r.dirty_vertex_buffers |= 1u << b;
+        }
+        r.index_dirty = true;
+    }
+    apply_state(impl, bound->state);
+}
+
+[[nodiscard]] GLsizei vertex_stride(VertexInputLayout const& vi, uint32_t binding) noexcept {
+    for (uint32_t i = 0; i < vi.bindingCount; ++i) {
+        if (vi.bindings[i].binding == binding)
+            return static_cast<GLsizei>(vi.bindings[i].stride);
+    }
+    return 0;
+}
+
+/// Copies the push constant range into the stream ring if it changed.
+void upload_push_constants(GlDevice::Impl& impl) noexcept {
+    auto& r = impl.replay;
+    if (!r.push_dirty) return;
+    auto const offset = stream_allocate(impl, k_max_push_constant_bytes, impl.stream.uniform_alignment);
+    if (!offset) return;
+    std::memcpy(impl.stream.mapped + *offset, r.push, k_max_push_constant_bytes);
+    impl.gl.glBindBufferRange(GL_UNIFORM_BUFFER, k_push_constant_binding, impl.stream.buffer,
+                              static_cast<GLintptr>(*offset), k_max_push_constant_bytes);
+    r.push_dirty = false;
+}
+
+[[nodiscard]] bool prepare_draw(GlDevice::Impl& impl, bool indexed) noexcept {
+    auto& r = impl.replay;
+    auto const& gl = impl.gl;
+    PipelineRecord const* p = r.graphics;
+    if (!p || (indexed && !r.index_buffer.buffer))
+        return false;
+
+    use_program(impl, p->program);
+    for (uint32_t dirty = r.dirty_vertex_buffers; dirty != 0; dirty &= dirty - 1) {
+        auto const b = static_cast<uint32_t>(std::countr_zero(dirty));
+        gl.glVertexArrayVertexBuffer(r.vertex_array, b, r.vertex_buffers[b].buffer,
+                                     static_cast<GLintptr>(r.vertex_buffers[b].offset),
+                                     vertex_stride(p->vertex_input, b));
+    }
+    r.dirty_vertex_buffers = 0;
+    if (indexed && r.index_dirty) {
+        gl.glVertexArrayElementBuffer(r.vertex_array, r.index_buffer.buffer);
+        r.index_dirty = false;
+    }
+    upload_push_constants(impl);
+    return true;
+}
+
+[[nodiscard]] bool prepare_dispatch(GlDevice::Impl& impl) noexcept {
+    auto& r = impl.replay;
+    if (!r.compute)
+        return false;
+    use_program(impl, r.compute->program);
+    upload_push_constants(impl);
+    return true;
+}
+
+// -----------------------------------------------------------------
+// Multi-draw runs
+//
+// Direct draws queue up while nothing between them changes state. The
+// first draw of a run prepares the bindings; every other command issues
+// the run before it runs itself.
+// -----------------------------------------------------------------
+void draw_direct(GlDevice::Impl& impl, DrawIndirectCommand const& d) noexcept {
+    impl.gl.glDrawArraysInstancedBaseInstance(impl.replay.graphics->state.topology,
+                                              static_cast<GLint>(d.firstVertex),
+                                              static_cast<GLsizei>(d.vertexCount),
+                                              static_cast<GLsizei>(d.instanceCount), d.firstInstance);
+}
+
+void draw_direct(GlDevice::Impl& impl, DrawIndexedIndirectCommand const& d) noexcept {
+    auto const& r = impl.replay;
+    impl.gl.glDrawElementsInstancedBaseVertexBaseInstance(
+        r.graphics->state.topology, static_cast<GLsizei>(d.indexCount), to_gl(r.index_type),
+        buffer_offset(uint64_t{d.firstIndex} * index_size(r.index_type)), static_cast<GLsizei>(d.instanceCount),
+        d.vertexOffset, d.firstInstance);
+}
+
+template<typename Draw, typename MultiDraw>
+void issue_run(GlDevice::Impl& impl, std::vector<Draw>& run, MultiDraw&& multi_draw) noexcept {
+    if (run.empty()) return;
+    std::optional<uint64_t> offset;
+    if (run.size() > 1)
+        offset = stream_allocate(impl, run.size() * sizeof(Draw), 16);
+    if (offset) {
+        std::memcpy(impl.stream.mapped + *offset, run.data(), run.size() * sizeof(Draw));
+        bind_draw_indirect(impl, impl.stream.buffer);
+        multi_draw(buffer_offset(*offset), static_cast<GLsizei>(run.size()));
+    } else {
+        for (Draw const& d : run)
+            draw_direct(impl, d);
+    }
+    run.clear();
+}
+
+void flush_run(GlDevice::Impl& impl) noexcept {
+    auto& r = impl.replay;
+    auto const& gl = impl.gl;
+    issue_run(impl, r.run, [&](void const* indirect, GLsizei count) {
+        gl.glMultiDrawArraysIndirect(r.graphics->state.topology, indirect, count, 0);
+    });
+    issue_run(impl, r.run_indexed_draws, [&](void const* indirect, GLsizei count) {
+        gl.glMultiDrawElementsIndirect(r.graphics->state.topology, to_gl(r.index_type), indirect, count, 0);
+    });
+}
+
+template<typename Draw, typename Other>
+void queue_draw(GlDevice::Impl& impl, std::vector<Draw>& run, std::vector<Other> const& other,
+                std::type_identity_t<Draw> const& draw, bool indexed) noexcept
+{
+    if (!other.empty() || run.size() >= k_max_multi_draw)
+        flush_run(impl);
+    if (run.empty() && !prepare_draw(impl, indexed))
+        return;
+    try {
+        run.push_back(draw);
+    } catch (std::bad_alloc const&) {
+        flush_run(impl);
+        draw_direct(impl, draw);
+    }
+}
+
+// -----------------------------------------------------------------
+// Render passes
+// -----------------------------------------------------------------
+
+/// The cached framebuffer for @p h's attachments; 0 when incomplete.
+[[nodiscard]] GLuint framebuffer(GlDevice::Impl& impl, GlRenderingHeader const& h) noexcept {
+    auto const& gl = impl.gl;
+
+    FramebufferKey key;
+    key.color_count = h.color_count;
+    for (uint32_t i = 0; i < h.color_count; ++i)
+        key.colors[i] = h.colors[i].texture;
+    key.depth_stencil = h.has_depth ? h.depth_stencil : 0;
+    key.has_stencil   = h.has_stencil;
+    if (auto it = impl.framebuffers.find(key); it != impl.framebuffers.end())
+        return it->second;
+
+    GLuint fbo = 0;
+    gl.glCreateFramebuffers(1, &fbo);
+    GLenum draw_buffers[k_max_color_attachments];
+    for (uint32_t i = 0; i < h.color_count; ++i) {
+        gl.glNamedFramebufferTexture(fbo, GL_COLOR_ATTACHMENT0 + i, key.colors[i], 0);
+        draw_buffers[i] = GL_COLOR_ATTACHMENT0 + i;
+    }
+    if (key.depth_stencil)
+        gl.glNamedFramebufferTexture(fbo, h.has_stencil ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT,
+                                     key.depth_stencil, 0);
+    if (h.color_count > 0) {
+        gl.glNamedFramebufferDrawBuffers(fbo, static_cast<GLsizei>(h.color_count), draw_buffers);
+    } else {
+        GLenum const none = GL_NONE;
+        gl.glNamedFramebufferDrawBuffers(fbo, 1, &none);
+    }
+
+    if (GLenum const status = gl.glCheckNamedFramebufferStatus(fbo, GL_FRAMEBUFFER);
+        status != GL_FRAMEBUFFER_COMPLETE) {
+        SPDLOG_ERROR("[wren/rhi/opengl] Render pass attachments form an incomplete framebuffer ({:#x}); "
+                     "the pass is skipped.", status);
+        gl.glDeleteFramebuffers(1, &fbo);
+        return 0;
+    }
+    try {
+        impl.framebuffers.emplace(key, fbo);
+    } catch (std::bad_alloc const&) {
+        gl.glDeleteFramebuffers(1, &fbo);
+        return 0;
+    }
+    return fbo;
+}
+
+/// Invalidates the attachments of the open pass whose load (@p at_end
+/// false) or store (true) op is DontCare.
+void discard_attachments(GlDevice::Impl& impl, GlRenderingHeader const& h, bool at_end) noexcept {
+    GLenum   attachments[k_max_color_attachments + 2];
+    GLsizei  count = 0;
+    for (uint32_t i = 0; i < h.color_count; ++i) {
+        bool const discard = at_end ? h.colors[i].store == StoreOp::DontCare : h.colors[i].load == LoadOp::DontCare;
+        if (discard) attachments[count++] = GL_COLOR_ATTACHMENT0 + i;
+    }
+    if (h.has_depth && (at_end ? h.depth_store == StoreOp::DontCare : h.depth_load == LoadOp::DontCare))
+        attachments[count++] = GL_DEPTH_ATTACHMENT;
+    if (h.has_stencil && (at_end ? h.stencil_store == StoreOp::DontCare : h.stencil_load == LoadOp::DontCare))
+        attachments[count++] = GL_STENCIL_ATTACHMENT;
+    if (count > 0)
+        impl.gl.glInvalidateNamedFramebufferData(impl.replay.framebuffer, count, attachments);
+}
+
+void begin_rendering(GlDevice::Impl& impl, GlRenderingHeader const& h) noexcept {
+    auto& r = impl.replay;
+    auto const& gl = impl.gl;
+
+    GLuint const fbo = framebuffer(impl, h);
+    r.rendering = fbo ? &h : nullptr;
+    if (!fbo) return;
+    if (r.framebuffer != fbo) {
+        gl.glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        r.framebuffer = fbo;
+    }
+    discard_attachments(impl, h, false);
+
+    // Clears honour the scissor and write masks: open both up, then put
+    // back the bound pipeline's.
+    gl.glScissorIndexed(0, h.x, h.y, static_cast<GLsizei>(h.width), static_cast<GLsizei>(h.height));
+    bool cleared = false;
+    for (uint32_t i = 0; i < h.color_count; ++i) {
+        if (h.colors[i].load != LoadOp::Clear) continue;
+        set_color_mask(impl, i, ColorWriteMask::All);
+        gl.glClearNamedFramebufferfv(fbo, GL_COLOR, static_cast<GLint>(i), h.colors[i].clear);
+        cleared = true;
+    }
+    bool const clear_depth   = h.has_depth && h.depth_load == LoadOp::Clear;
+    bool const clear_stencil = h.has_stencil && h.stencil_load == LoadOp::Clear;
+    if (clear_depth) set_depth_write(impl, true);
+    if (clear_stencil) set_stencil_write(impl, 0xFF);
+    auto const stencil = static_cast<GLint>(h.clear_stencil);
+    if (clear_depth && clear_stencil)
+        gl.glClearNamedFramebufferfi(fbo, GL_DEPTH_STENCIL, 0, h.clear_depth, stencil);
+    else if (clear_depth)
+        gl.glClearNamedFramebufferfv(fbo, GL_DEPTH, 0, &h.clear_depth);
+    else if (clear_stencil)
+        gl.glClearNamedFramebufferiv(fbo, GL_STENCIL, 0, &stencil);
+    cleared |= clear_depth || clear_stencil;
+
+    if (cleared && r.graphics)
+        apply_state(impl, r.graphics->state);
+}
+
+void end_rendering(GlDevice::Impl& impl) noexcept {
+    auto& r = impl.replay;
+    if (!r.rendering) return;
+    discard_attachments(impl, *r.rendering, true);
+    r.rendering = nullptr;
+}
+
+// -----------------------------------------------------------------
+// Copies
+// -----------------------------------------------------------------
+struct Box {
+    GLint   x = 0, y = 0, z = 0;
+    GLsizei width = 1, height = 1, depth = 1;
+};
+
+/// The region as GL addresses it: array layers are the last coordinate.
+[[nodiscard]] Box texel_box(GLenum target, BufferTextureCopy const& c) noexcept {
+    auto const w      = static_cast<GLsizei>(c.width);
+    auto const h      = static_cast<GLsizei>(c.height);
+    auto const layer  = static_cast<GLint>(c.baseArrayLayer);
+    auto const layers = static_cast<GLsizei>(c.layerCount);
+    switch (target) {
+        case GL_TEXTURE_1D:             return {c.x, 0, 0, w, 1, 1};
+        case GL_TEXTURE_1D_ARRAY:       return {c.x, layer, 0, w, layers, 1};
+        case GL_TEXTURE_2D_ARRAY:
+        case GL_TEXTURE_CUBE_MAP:
+        case GL_TEXTURE_CUBE_MAP_ARRAY: return {c.x, c.y, layer, w, h, layers};
+        case GL_TEXTURE_3D:             return {c.x, c.y, c.z, w, h, static_cast<GLsizei>(c.depth)};
+        default:                        return {c.x, c.y, 0, w, h, 1};
+    }
+}
+
+void copy_buffer_to_texture(GlDevice::Impl& impl, GlCopyHeader const& h,
+                            std::span<BufferTextureCopy const> regions) noexcept
+{
+    auto const& gl = impl.gl;
+    gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, h.buffer);
+    for (BufferTextureCopy const& c : regions) {
+        gl.glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(c.bufferRowLength));
+        gl.glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, static_cast<GLint>(c.bufferImageHeight));
+        Box const b = texel_box(h.target, c);
+        auto const level = static_cast<GLint>(c.mipLevel);
+        void const* src  = buffer_offset(c.bufferOffset);
+        switch (h.target) {
+            case GL_TEXTURE_1D:
+                gl.glTextureSubImage1D(h.texture, level, b.x, b.width, h.format, h.type, src);
+                break;
+            case GL_TEXTURE_1D_ARRAY:
+            case GL_TEXTURE_2D:
+                gl.glTextureSubImage2D(h.texture, level, b.x, b.y, b.width, b.height, h.format, h.type, src);
+                break;
+            default:
+                gl.glTextureSubImage3D(h.texture, level, b.x, b.y, b.z, b.width, b.height, b.depth, h.format,
+                                       h.type, src);
+                break;
+        }
+    }
+    gl.glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    gl.glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, 0);
+    gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+void copy_texture_to_buffer(GlDevice::Impl& impl, GlCopyHeader const& h,
+                            std::span<BufferTextureCopy const> regions) noexcept
+{
+    auto const& gl = impl.gl;
+    gl.glBindBuffer(GL_PIXEL_PACK_BUFFER, h.buffer);
+    for (BufferTextureCopy const& c : regions) {
+        if (c.bufferOffset >= h.buffer_size) continue;
+        gl.glPixelStorei(GL_PACK_ROW_LENGTH, static_cast<GLint>(c.bufferRowLength));
+        gl.glPixelStorei(GL_PACK_IMAGE_HEIGHT, static_cast<GLint>(c.bufferImageHeight));
+        Box const b = texel_box(h.target, c);
+        auto const room = static_cast<GLsizei>(std::min<uint64_t>(h.buffer_size - c.bufferOffset, INT32_MAX));
+        gl.glGetTextureSubImage(h.texture, static_cast<GLint>(c.mipLevel), b.x, b.y, b.z, b.width, b.height,
+                                b.depth, h.format, h.type, room,
+                                reinterpret_cast<void*>(static_cast<std::uintptr_t>(c.bufferOffset)));
+    }
+    gl.glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+    gl.glPixelStorei(GL_PACK_IMAGE_HEIGHT, 0);
+    gl.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+// -----------------------------------------------------------------
+// Indirect draws
+//
+// GL has no index buffer offset for these: the records' firstIndex counts
+// from the start of the index buffer.
+// -----------------------------------------------------------------
+void draw_indirect(GlDevice::Impl& impl, GlIndirectHeader const& h, bool indexed) noexcept {
+    auto const& r  = impl.replay;
+    auto const& gl = impl.gl;
+    if (!prepare_draw(impl, indexed))
+        return;
+    assert((!indexed || r.index_buffer.offset == 0) && "indexed indirect draws need an index buffer offset of 0");
+
+    bind_draw_indirect(impl, h.args);
+    GLenum const mode     = r.graphics->state.topology;
+    GLenum const type     = to_gl(r.index_type);
+    void const*  indirect = buffer_offset(h.args_offset);
+    auto const   count    = static_cast<GLsizei>(h.max_count);
+    auto const   stride   = static_cast<GLsizei>(h.stride);
+    if (h.count_buffer) {
+        gl.glBindBuffer(GL_PARAMETER_BUFFER, h.count_buffer);
+        auto const count_offset = static_cast<GLintptr>(h.count_offset);
+        if (indexed)
+            gl.glMultiDrawElementsIndirectCount(mode, type, indirect, count_offset, count, stride);
+        else
+            gl.glMultiDrawArraysIndirectCount(mode, indirect, count_offset, count, stride);
+    } else if (indexed) {
+        gl.glMultiDrawElementsIndirect(mode, type, indirect, count, stride);
+    } else {
+        gl.glMultiDrawArraysIndirect(mode, indirect, count, stride);
+    }
+}
+
+// -----------------------------------------------------------------
+// Replay
+// -----------------------------------------------------------------
+void replay_commands(GlDevice::Impl& impl, CommandListState const& list) noexcept {
+    auto& r = impl.replay;
+    auto const& gl = impl.gl;
+
+    for (GlCommand const& c : list.commands) {
+        if (c.op != GlOp::Draw && c.op != GlOp::DrawIndexed)
+            flush_run(impl);
+
+        switch (c.op) {
+            case GlOp::Draw: {
+                auto const& d = c.draw;
+                if (d.vertexCount == 0 || d.instanceCount == 0) break;
+                queue_draw(impl, r.run, r.run_indexed_draws, {d.vertexCount, d.instanceCount, d.firstVertex, d.firstInstance},
+                           false);
+                break;
+            }
+            case GlOp::DrawIndexed: {
+                auto const& d = c.draw_indexed;
+                if (d.indexCount == 0 || d.instanceCount == 0) break;
+                // The index buffer is bound whole; its offset moves the first index.
+                auto const first = static_cast<uint32_t>(d.firstIndex +
+                                                         r.index_buffer.offset / index_size(r.index_type));
+                queue_draw(impl, r.run_indexed_draws, r.run,
+                           {d.indexCount, d.instanceCount, first, d.vertexOffset, d.firstInstance}, true);
+                break;
+            }
+            case GlOp::Dispatch:
+                if (prepare_dispatch(impl))
+                    gl.glDispatchCompute(c.dispatch.x, c.dispatch.y, c.dispatch.z);
+                break;
+            case GlOp::BindPipeline:
+                bind_pipeline(impl, c.pipeline);
+                break;
+            case GlOp::PushConstants:
+                std::memcpy(r.push + c.push_offset, payload<std::byte>(list, c), c.count);
+                r.push_dirty = true;
+                break;
+            case GlOp::SetViewport: {
+                Viewport const& v = c.viewport;
+                gl.glViewportIndexedf(0, v.x, v.y, v.width, v.height);
+                gl.glDepthRangeIndexed(0, v.minDepth, v.maxDepth);
+                break;
+            }
+            case GlOp::SetScissor: {
+                Scissor const& s = c.scissor;
+                gl.glScissorIndexed(0, s.x, s.y, static_cast<GLsizei>(s.width), static_cast<GLsizei>(s.height));
+                break;
+            }
+            case GlOp::BindVertexBuffer: {
+                GlBufferRef& bound = r.vertex_buffers[c.binding];
+                if (bound.buffer != c.buffer.buffer || bound.offset != c.buffer.offset) {
+                    bound = c.buffer;
+                    r.dirty_vertex_buffers |= 1u << c.binding;
+                }
+                break;
+            }
+            case GlOp::BindIndexBuffer:
+                r.index_dirty |= r.index_buffer.buffer != c.buffer.buffer;
+                r.index_buffer = c.buffer;
+                r.index_type   = c.index_type;
+                break;
+            case GlOp::SetDeviceMask:
+                break;  // one device
+            case GlOp::Barrier:
+                gl.glMemoryBarrier(c.count);
+                break;
+            case GlOp::CopyBuffer: {
+                auto const& h      = *payload<GlCopyHeader>(list, c);
+                auto const* copies = items_after<GlCopyHeader, BufferCopy>(list, c);
+                for (BufferCopy const& copy : std::span{copies, c.count})
+                    gl.glCopyNamedBufferSubData(h.buffer, h.texture, static_cast<GLintptr>(copy.srcOffset),
+                                                static_cast<GLintptr>(copy.dstOffset),
+                                                static_cast<GLsizeiptr>(copy.size));
+                break;
+            }
+            case GlOp::CopyBufferToTexture:
+                copy_buffer_to_texture(impl, *payload<GlCopyHeader>(list, c),
+                                       {items_after<GlCopyHeader, BufferTextureCopy>(list, c), c.count});
+                break;
+            case GlOp::CopyTextureToBuffer:
+                copy_texture_to_buffer(impl, *payload<GlCopyHeader>(list, c),
+                                       {items_after<GlCopyHeader, BufferTextureCopy>(list, c), c.count});
+                break;
+            case GlOp::BeginRendering:
+                begin_rendering(impl, *payload<GlRenderingHeader>(list, c));
+                break;
+            case GlOp::EndRendering:
+                end_rendering(impl);
+                break;
+            case GlOp::DrawIndirect:
+            case GlOp::DrawIndexedIndirect:
+                draw_indirect(impl, *payload<GlIndirectHeader>(list, c), c.op == GlOp::DrawIndexedIndirect);
+                break;
+            case GlOp::DispatchIndirect:
+                if (prepare_dispatch(impl)) {
+                    gl.glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, c.buffer.buffer);
+                    gl.glDispatchComputeIndirect(static_cast<GLintptr>(c.buffer.offset));
+                }
+                break;
+            case GlOp::ExecuteLists:
+                for (CommandListState const* secondary : std::span{payload<CommandListState*>(list, c), c.count})
+                    replay_commands(impl, *secondary);
+                break;
+            case GlOp::BeginRegion:
+                gl.glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, static_cast<GLsizei>(c.count),
+                                    payload<char>(list, c));
+                break;
+            case GlOp::EndRegion:
+                gl.glPopDebugGroup();
+                break;
+        }
+    }
+}
+
+// -----------------------------------------------------------------
+// Recording helpers
+// -----------------------------------------------------------------
+[[nodiscard]] GlBufferRef resolve_buffer_ref(GlDevice::Impl const& impl, BufferHandle buffer,
+                                             uint64_t offset) noexcept
+{
+    return {resolve_buffer(impl, buffer), offset};
+}
+
+void copy_buffer_texture(CommandListState& list, GlOp op, BufferHandle buffer, TextureHandle texture,
+                         std::span<BufferTextureCopy const> regions) noexcept
+{
+    assert(list.recording);
+    auto const& impl = *list.device;
+
+    GlCopyHeader h;
+    h.buffer = resolve_buffer(impl, buffer, &h.buffer_size);
+    TextureDesc desc{};
+    bool const resolved = resolve_texture(impl, texture, h.texture, h.target, desc);
+    assert(h.buffer && resolved && "copy between a null or stale buffer and texture");
+    assert(desc.samples == SampleCount::C1 && "multisampled textures cannot be copied");
+    if (!h.buffer || !resolved || desc.samples != SampleCount::C1 || regions.empty()) return;
+
+    FormatInfo const format = to_gl(desc.format);
+    h.format = format.format;
+    h.type   = format.type;
+
+    GlCommand c;
+    c.op    = op;
+    c.count = static_cast<uint32_t>(regions.size());
+    record(list, c, h, regions);
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Framebuffer cache
+// -------------------------------------------------------------------------------------------------
+std::size_t FramebufferKeyHash::operator()(FramebufferKey const& key) const noexcept {
+    StateHasher h;
+    h.add(key.color_count);
+    for (uint32_t i = 0; i < key.color_count; ++i)
+        h.add(key.colors[i]);
+    h.add(key.depth_stencil);
+    h.add(key.has_stencil);
+    return static_cast<std::size_t>(h.value());
+}
+
+void forget_framebuffers(GlDevice::Impl& impl, GLuint texture) noexcept {
+    std::erase_if(impl.framebuffers, [&](auto const& entry) {
+        auto const& [key, fbo] = entry;
+        bool const uses = texture == 0 || key.depth_stencil == texture ||
+                          std::ranges::find(key.colors, key.colors + key.color_count, texture) !=
+                              key.colors + key.color_count;
+        if (!uses) return false;
+        impl.gl.glDeleteFramebuffers(1, &fbo);
+        // Deleting the bound framebuffer binds the default one.
+        if (impl.replay.framebuffer == fbo)
+            impl.replay.framebuffer = 0;
+        return true;
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+// Replay
+// -------------------------------------------------------------------------------------------------
+void begin_replay(GlDevice::Impl& impl) noexcept {
+    auto& r = impl.replay;
+    r.graphics = nullptr;
+    r.compute  = nullptr;
+    std::ranges::fill(r.vertex_buffers, GlBufferRef{});
+    r.dirty_vertex_buffers = 0;
+    r.index_buffer         = {};
+    r.index_dirty          = true;
+    r.push_dirty           = true;
+    r.draw_indirect_buffer = 0;
+    r.rendering            = nullptr;
+    r.run.clear();
+    r.run_indexed_draws.clear();
+    try {
+        r.run.reserve(k_max_multi_draw);
+        r.run_indexed_draws.reserve(k_max_multi_draw);
+    } catch (std::bad_alloc const&) {
+        // Runs that cannot grow are issued draw by draw.
+    }
+
+    // Heap changes only happen between flushes, on this thread.
+    bind_bindless(impl);
+}
+
+void replay(GlDevice::Impl& impl, CommandListState const& list) noexcept {
+    replay_commands(impl, list);
+}
+
+void end_replay(GlDevice::Impl& impl) noexcept {
+    flush_run(impl);
+    impl.replay.rendering = nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Recording — barriers & copies
+//
+// GL orders every command against the ones before it except for shader
+// writes through image stores and storage buffers. Only barriers out of
+// a Storage state emit glMemoryBarrier, with the bits of the states they
+// lead into; the barriers of one call are merged.
+// -------------------------------------------------------------------------------------------------
+void cmd_barriers(CommandListState& list, std::span<TextureBarrier const> textures,
+                  std::span<BufferBarrier const> buffers) noexcept
+{
+    assert(list.recording);
+    GLbitfield bits = 0;
+    for (TextureBarrier const& b : textures) {
+        if (underlying(b.oldUsage & TextureUsage::Storage) != 0)
+            bits |= barrier_bits(b.newUsage);
+    }
+    for (BufferBarrier const& b : buffers) {
+        if (underlying(b.oldUsage & BufferUsage::Storage) != 0)
+            bits |= barrier_bits(b.newUsage);
+    }
+    if (bits == 0) return;
+
+    GlCommand c;
+    c.op    = GlOp::Barrier;
+    c.count = bits;
+    record(list, c);
+}
+
+void cmd_copy_buffer(CommandListState& list, BufferHandle src, BufferHandle dst,
+                     std::span<BufferCopy const> regions) noexcept
+{
+    assert(list.recording);
+    auto const& impl = *list.device;
+
+    GlCopyHeader h;
+    h.buffer  = resolve_buffer(impl, src);
+    h.texture = resolve_buffer(impl, dst);
+    assert(h.buffer && h.texture && "copy between null or stale buffers");
+    if (!h.buffer || !h.texture || regions.empty()) return;
+
+    GlCommand c;
+    c.op    = GlOp::CopyBuffer;
+    c.count = static_cast<uint32_t>(regions.size());
+    record(list, c, h, regions);
+}
+
+void cmd_copy_buffer_to_texture(CommandListState& list, BufferHandle src, TextureHandle dst,
+                                std::span<BufferTextureCopy const> regions) noexcept
+{
+    copy_buffer_texture(list, GlOp::CopyBufferToTexture, src, dst, regions);
+}
+
+void cmd_copy_texture_to_buffer(CommandListState& list, TextureHandle src, BufferHandle dst,
+                                std::span<BufferTextureCopy const> regions) noexcept
+{
+    copy_buffer_texture(list, GlOp::CopyTextureToBuffer, dst, src, regions);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Recording — render passes & dynamic state
+// -------------------------------------------------------------------------------------------------
+void cmd_begin_rendering(CommandListState& list, RenderingDesc const& desc) noexcept {
+    assert(list.recording);
+    assert(desc.colorAttachmentCount <= k_max_color_attachments);
+    auto const& impl = *list.device;
+
+    GlRenderingHeader h;
+    h.color_count = std::min(desc.colorAttachmentCount, k_max_color_attachments);
+    h.x      = desc.x;
+    h.y      = desc.y;
+    h.width  = desc.width;
+    h.height = desc.height;
+    {
+        std::shared_lock lock{impl.textures_mutex};
+        for (uint32_t i = 0; i < h.color_count; ++i) {
+            ColorAttachment const& a = desc.colorAttachments[i];
+            auto const* name = impl.textures.get<0>(a.texture);
+            assert(name && "color attachment is a null or stale texture");
+            h.colors[i].texture = name ? *name : 0;
+            h.colors[i].load    = a.load;
+            h.colors[i].store   = a.store;
+            std::copy_n(a.clearColor, 4, h.colors[i].clear);
+        }
+        if (DepthStencilAttachment const* ds = desc.depthStencil) {
+            auto const* name = impl.textures.get<0>(ds->texture);
+            assert(name && "depth attachment is a null or stale texture");
+            if (name) {
+                h.depth_stencil = *name;
+                h.has_depth     = true;
+                h.has_stencil   = to_gl(impl.textures.get<3>(ds->texture)->format).stencil;
+                h.depth_load    = ds->depthLoad;
+                h.depth_store   = ds->depthStore;
+                h.stencil_load  = ds->stencilLoad;
+                h.stencil_store = ds->stencilStore;
+                h.clear_depth   = ds->clearDepth;
+                h.clear_stencil = ds->clearStencil;
+            }
+        }
+    }
+
+    GlCommand c;
+    c.op = GlOp::BeginRendering;
+    record(list, c, std::span<GlRenderingHeader const>{&h, 1});
+}
+
+void cmd_end_rendering(CommandListState& list) noexcept {
+    assert(list.recording);
+    GlCommand c;
+    c.op = GlOp::EndRendering;
+    record(list, c);
+}
+
+void cmd_set_viewport(CommandListState& list, Viewport const& viewport) noexcept {
+    assert(list.recording);
+    GlCommand c;
+    c.op       = GlOp::SetViewport;
+    c.viewport = viewport;
+    record(list, c);
+}
+
+void cmd_set_scissor(CommandListState& list, Scissor const& scissor) noexcept {
+    assert(list.recording);
+    GlCommand c;
+    c.op      = GlOp::SetScissor;
+    c.scissor = scissor;
+    record(list, c);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Recording — pipelines & bindings
+//
+// A pipeline that is still pending is linked, or swapped for its ready
+// fallback, when replay reaches the bind.
+// -------------------------------------------------------------------------------------------------
+void cmd_bind_pipeline(CommandListState& list, PipelineHandle pipeline) noexcept {
+    assert(list.recording);
+    auto const& ctx = list.device->pipelines;
+
+    PipelineRecord* record_ptr = nullptr;
+    {
+        std::shared_lock lock{ctx.pool_mutex};
+        if (auto const* r = ctx.pool.get<0>(pipeline)) record_ptr = r->get();
+    }
+    assert(record_ptr && "pipeline is null or stale");
+    if (!record_ptr) return;
+
+    GlCommand c;
+    c.op       = GlOp::BindPipeline;
+    c.pipeline = record_ptr;
+    record(list, c);
+}
+
+void cmd_push_constants(CommandListState& list, uint32_t offset, uint32_t size, void const* data) noexcept {
+    assert(list.recording);
+    bool const valid = data && size > 0 && offset % 4 == 0 && size % 4 == 0 &&
+                       size <= k_max_push_constant_bytes && offset <= k_max_push_constant_bytes - size;
+    assert(valid && "push constants must be 4-byte aligned and within k_max_push_constant_bytes");
+    if (!valid) return;
+
+    GlCommand c;
+    c.op          = GlOp::PushConstants;
+    c.count       = size;
+    c.push_offset = offset;
+    record(list, c, std::span{static_cast<std::byte const*>(data), size});
+}
+
+void cmd_bind_vertex_buffers(CommandListState& list, uint32_t first_binding,
+                             std::span<BufferHandle const> buffers,
+                             std::span<uint64_t const> offsets) noexcept
+{
+    assert(list.recording);
+    assert(first_binding + buffers.size() <= k_max_vertex_bindings && offsets.size() >= buffers.size());
+    auto const& impl = *list.device;
+
+    auto const count = std::min<std::size_t>(buffers.size(), k_max_vertex_bindings - std::min(first_binding, k_max_vertex_bindings));
+    std::shared_lock lock{impl.buffers_mutex};
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const* b = impl.buffers.get<0>(buffers[i]);
+        assert(b && "vertex buffer is null or stale");
+        GlCommand c;
+        c.op      = GlOp::BindVertexBuffer;
+        c.binding = static_cast<uint8_t>(first_binding + i);
+        c.buffer  = {b ? *b : 0, offsets[i]};
+        record(list, c);
+    }
+}
+
+void cmd_bind_index_buffer(CommandListState& list, BufferHandle buffer, uint64_t offset,
+                           IndexType type) noexcept
+{
+    assert(list.recording);
+    GlCommand c;
+    c.op         = GlOp::BindIndexBuffer;
+    c.index_type = type;
+    c.buffer     = resolve_buffer_ref(*list.device, buffer, offset);
+    assert(c.buffer.buffer && "index buffer is null or stale");
+    if (!c.buffer.buffer) return;
+    record(list, c);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Recording — draws & dispatches
+// -------------------------------------------------------------------------------------------------
+void cmd_draw(CommandListState& list, uint32_t vertex_count, uint32_t instance_count,
+              uint32_t first_vertex, uint32_t first_instance) noexcept
+{
+    assert(list.recording);
+    GlCommand c;
+    c.op   = GlOp::Draw;
+    c.draw = {vertex_count, instance_count, first_vertex, first_instance};
+    record(list, c);
+}
+
+void cmd_draw_indexed(CommandListState& list, uint32_t index_count, uint32_t instance_count,
+                      uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) noexcept
+{
+    assert(list.recording);
+    GlCommand c;
+    c.op           = GlOp::DrawIndexed;
+    c.draw_indexed = {index_count, instance_count, first_index, vertex_offset, first_instance};
+    record(list, c);
+}
+
+void cmd_dispatch(CommandListState& list, uint32_t x, uint32_t y, uint32_t z) noexcept {
+    assert(list.recording);
+    GlCommand c;
+    c.op       = GlOp::Dispatch;
+    c.dispatch = {x, y, z};
+    record(list, c);
+}
+
+void cmd_draw_indirect(CommandListState& list, IndirectDrawDesc const& desc, bool indexed) noexcept {
+    assert(list.recording);
+    auto const& impl = *list.device;
+    assert((desc.argsOffset % 4) == 0 && (desc.countOffset % 4) == 0 && (desc.stride % 4) == 0);
+    assert((desc.maxDrawCount <= 1 && !desc.countBuffer) ||
+           has_any(impl.capabilities.features, Feature::MultiDrawIndirect));
+    assert(desc.maxDrawCount <= impl.capabilities.limits.maxDrawIndirectCount);
+
+    GlIndirectHeader h;
+    h.args         = resolve_buffer(impl, desc.argsBuffer);
+    h.args_offset  = desc.argsOffset;
+    h.max_count    = desc.maxDrawCount;
+    h.count_buffer = desc.countBuffer ? resolve_buffer(impl, desc.countBuffer) : 0;
+    h.count_offset = desc.countOffset;
+    h.stride       = desc.stride != 0 ? desc.stride
+                   : indexed          ? uint32_t{sizeof(DrawIndexedIndirectCommand)}
+                                      : uint32_t{sizeof(DrawIndirectCommand)};
+    assert(h.args && "indirect argument buffer is null or stale");
+    assert((h.count_buffer || !desc.countBuffer) && "indirect count buffer is stale");
+    if (!h.args || (desc.countBuffer && !h.count_buffer) || desc.maxDrawCount == 0) return;
+
+    GlCommand c;
+    c.op = indexed ? GlOp::DrawIndexedIndirect : GlOp::DrawIndirect;
+    record(list, c, std::span<GlIndirectHeader const>{&h, 1});
+}
+
+void cmd_dispatch_indirect(CommandListState& list, BufferHandle buffer, uint64_t offset) noexcept {
+    assert(list.recording);
+    assert((offset % 4) == 0);
+    GlCommand c;
+    c.op     = GlOp::DispatchIndirect;
+    c.buffer = resolve_buffer_ref(*list.device, buffer, offset);
+    assert(c.buffer.buffer && "indirect dispatch buffer is null or stale");
+    if (!c.buffer.buffer) return;
+    record(list, c);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Command packets
+//
+// Packets translate one to one; buffer handles are resolved under one
+// shared lock held across the call.
+// -------------------------------------------------------------------------------------------------
+void cmd_record_packets(CommandListState& list, std::span<CommandPacket const> packets) noexcept {
+    assert(list.recording);
+    auto const& impl = *list.device;
+    try {
+        list.commands.reserve(list.commands.size() + packets.size());
+    } catch (std::bad_alloc const&) {
+        // Recorded one by one below; each drop is logged.
+    }
+
+    std::shared_lock buffers_lock{impl.buffers_mutex, std::defer_lock};
+    auto resolve = [&](BufferHandle handle) noexcept -> GLuint {
+        if (!buffers_lock.owns_lock())
+            buffers_lock.lock();
+        auto const* b = impl.buffers.get<0>(handle);
+        assert(b && "bound buffer is null or stale");
+        return b ? *b : 0;
+    };
+
+    for (CommandPacket const& p : packets) {
+        GlCommand c;
+        c.op = static_cast<GlOp>(p.op);
+        switch (p.op) {
+            case CommandOp::Draw:
+                c.draw = p.draw;
+                record(list, c);
+                break;
+            case CommandOp::DrawIndexed:
+                c.draw_indexed = p.drawIndexed;
+                record(list, c);
+                break;
+            case CommandOp::Dispatch:
+                c.dispatch = p.dispatch;
+                record(list, c);
+                break;
+            case CommandOp::BindPipeline:
+                cmd_bind_pipeline(list, p.pipeline);
+                break;
+            case CommandOp::PushConstants:
+                assert(p.pushSize <= k_packet_push_constant_bytes);
+                cmd_push_constants(list, p.pushOffset, p.pushSize, p.push.data);
+                break;
+            case CommandOp::SetViewport:
+                c.viewport = p.viewport;
+                record(list, c);
+                break;
+            case CommandOp::SetScissor:
+                c.scissor = p.scissor;
+                record(list, c);
+                break;
+            case CommandOp::BindVertexBuffer:
+                assert(p.binding < k_max_vertex_bindings);
+                if (p.binding >= k_max_vertex_bindings) break;
+                c.binding = p.binding;
+                c.buffer  = {resolve(p.buffer.buffer), p.buffer.offset};
+                record(list, c);
+                break;
+            case CommandOp::BindIndexBuffer:
+                c.index_type = p.indexType;
+                c.buffer     = {resolve(p.buffer.buffer), p.buffer.offset};
+                if (c.buffer.buffer)
+                    record(list, c);
+                break;
+            case CommandOp::SetDeviceMask:
+                assert(p.deviceMask == 1 && "OpenGL exposes one device");
+                break;
+            default:
+                assert(false && "unknown CommandOp");
+                break;
+        }
+    }
+}
+
+void cmd_execute_command_lists(CommandListState& list,
+                               std::span<CommandListHandle const> secondaries) noexcept
+{
+    assert(list.recording && list.level == CommandListLevel::Primary);
+    for (CommandListHandle const s : secondaries)
+        assert(s && s->level == CommandListLevel::Secondary && !s->recording);
+    if (secondaries.empty()) return;
+
+    GlCommand c;
+    c.op    = GlOp::ExecuteLists;
+    c.count = static_cast<uint32_t>(secondaries.size());
+    record(list, c, secondaries);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Profiling regions
+//
+// KHR_debug groups, so captures show the frame's structure. There are no
+// GPU timestamps on this backend.
+// -------------------------------------------------------------------------------------------------
+void cmd_begin_profile_region(CommandListState& list, ProfileRegionDesc const& desc) noexcept {
+    assert(list.recording && desc.name && "profiling region without a name");
+    uint32_t const level = list.profile_depth++;
+    if (level >= k_max_region_depth || !desc.name)
+        return;
+
+    auto const length = static_cast<uint32_t>(std::min<std::size_t>(std::strlen(desc.name), k_max_region_name));
+    GlCommand c;
+    c.op    = GlOp::BeginRegion;
+    c.count = length;
+    record(list, c, std::span{desc.name, length});
+}
+
+void cmd_end_profile_region(CommandListState& list) noexcept {
+    assert(list.profile_depth > 0 && "cmd_end_profile_region without a matching begin");
+    if (list.profile_depth == 0)
+        return;
+    uint32_t const level = --list.profile_depth;
+    if (level >= k_max_region_depth)
+        return;
+
+    GlCommand c;
+    c.op = GlOp::EndRegion;
+    record(list, c);
+}
+
+} // namespace wren::rhi::opengl
@@ -0,0 +1,297 @@
+#include "gl_context.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <string_view>
+#include <utility>
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <spdlog/spdlog.h>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/pipelines.hpp>
+
+namespace wren::rhi::opengl {
+
+// -------------------------------------------------------------------------------------------------
+// GlContext
+// -------------------------------------------------------------------------------------------------
+
+GlContext::~GlContext() {
+    if (window_) glfwDestroyWindow(window_);
+}
+
+GlContext::GlContext(GlContext&& other) noexcept
+    : window_{std::exchange(other.window_, nullptr)} {}
+
+GlContext& GlContext::operator=(GlContext&& other) noexcept {
+    if (this != &other) {
+        if (window_) glfwDestroyWindow(window_);
+        window_ = std::exchange(other.window_, nullptr);
+    }
+    return *this;
+}
+
+auto GlContext::create(bool debug) -> std::expected<GlContext, std::string> {
+    if (glfwInit() == GLFW_FALSE) return std::unexpected{std::string{"GLFW initialisation failed"}};
+
+    glfwDefaultWindowHints();
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_API);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, debug ? GLFW_TRUE : GLFW_FALSE);
+    glfwWindowHint(GLFW_CONTEXT_NO_ERROR, debug ? GLFW_FALSE : GLFW_TRUE);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+
+    GLFWwindow* window = nullptr;
+    for (int const minor : {6, 5}) {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, minor);
+        window = glfwCreateWindow(1, 1, "wren", nullptr, nullptr);
+        if (window) break;
+    }
+
+    // The hints are global: leave them as wren::platform expects to find them.
+    glfwDefaultWindowHints();
+
+    if (!window) {
+        char const* description = nullptr;
+        glfwGetError(&description);
+        return std::unexpected{std::format("No OpenGL 4.5 core context: {}",
+                                           description ? description : "unknown error")};
+    }
+    return GlContext{window};
+}
+
+void GlContext::make_current() const noexcept {
+    glfwMakeContextCurrent(window_);
+}
+
+bool GlContext::is_current() const noexcept {
+    return window_ && glfwGetCurrentContext() == window_;
+}
+
+GlProcLoader GlContext::proc_loader() noexcept {
+    return &glfwGetProcAddress;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Context queries
+// -------------------------------------------------------------------------------------------------
+
+namespace {
+
+std::string lowercase(std::string_view s) {
+    std::string out{s};
+    std::ranges::transform(out, out.begin(), [](char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    });
+    return out;
+}
+
+uint32_t get_u32(GlFunctions const& gl, GLenum pname) {
+    GLint value = 0;
+    gl.glGetIntegerv(pname, &value);
+    return value > 0 ? static_cast<uint32_t>(value) : 0u;
+}
+
+uint32_t get_indexed_u32(GlFunctions const& gl, GLenum pname, GLuint index) {
+    GLint value = 0;
+    gl.glGetIntegeri_v(pname, index, &value);
+    return value > 0 ? static_cast<uint32_t>(value) : 0u;
+}
+
+/// PCI vendor ID and adapter type from the GL_VENDOR / GL_RENDERER
+/// strings, the only identification a GL context offers.
+void identify(ContextInfo& info) {
+    std::string const vendor   = lowercase(info.vendor);
+    std::string const renderer = lowercase(info.renderer);
+
+    if (vendor.contains("nvidia")) {
+        info.vendor_id = 0x10DE;
+        info.type      = AdapterType::Discrete;
+    } else if (vendor.contains("amd") || vendor.contains("ati technologies")) {
+        info.vendor_id = 0x1002;
+        info.type      = AdapterType::Discrete;
+    } else if (vendor.contains("intel")) {
+        info.vendor_id = 0x8086;
+        info.type      = AdapterType::Integrated;
+    }
+
+    if (renderer.contains("llvmpipe") || renderer.contains("softpipe") || renderer.contains("swrast"))
+        info.type = AdapterType::Cpu;
+}
+
+/// Features and limits a device on the context could enable.
+Capabilities assemble_capabilities(ContextInfo const& info, GlFunctions const& gl) {
+    using enum Feature;
+
+    Capabilities caps{};
+    caps.backend         = Backend::OpenGL;
+    caps.apiVersionMajor = info.version_major;
+    caps.apiVersionMinor = info.version_minor;
+
+    // GL 4.5 core: tessellation (4.0), geometry shaders (3.2), image
+    // load/store (4.2), sample shading (4.0), depth clamp (3.2), dual-source
+    // blending (3.3), mirror-clamp (4.4), polygon modes, buffer storage
+    // (4.4), FBOs, ETC2 (4.3) and KHR_debug (4.3).
+    Feature features = Tessellation | GeometryShader | ImageLoadStore_UAV | SampleRateShading | DepthClamp
+                     | DualSourceBlending | MirrorClampToEdge | NonSolidFill | PersistentMappedBuffers
+                     | DynamicRendering | TexCompression_ETC2 | DebugMarkers_Labels;
+
+    GlExtensions const& ext = info.extensions;
+    if (gl.glMultiDrawArraysIndirectCount && gl.glMultiDrawElementsIndirectCount) features |= MultiDrawIndirect;
+    if (ext.bindless_texture)           features |= DescriptorIndexing_Bindless;
+    if (ext.texture_filter_anisotropic) features |= AnisotropicFiltering;
+    if (ext.texture_compression_s3tc)   features |= TexCompression_BC;
+    if (ext.texture_compression_astc)   features |= TexCompression_ASTC_LDR;
+    if (ext.gpu_shader_int64)           features |= ShaderInt64;
+    if (ext.shader_subgroup)            features |= Subgroup_WaveOps;
+    if (ext.fragment_shader_interlock)  features |= FragmentInterlock_ROV;
+    if (ext.nvx_gpu_memory_info || ext.ati_meminfo) features |= MemoryBudget;
+    caps.features = features;
+
+    DeviceLimits& limits = caps.limits;
+    limits.maxImageDimension1D = get_u32(gl, GL_MAX_TEXTURE_SIZE);
+    limits.maxImageDimension2D = limits.maxImageDimension1D;
+    limits.maxImageDimension3D = get_u32(gl, GL_MAX_3D_TEXTURE_SIZE);
+    limits.maxCubeDimension    = get_u32(gl, GL_MAX_CUBE_MAP_TEXTURE_SIZE);
+    limits.maxMipLevels        = limits.maxImageDimension2D > 0
+                               ? static_cast<uint32_t>(std::bit_width(limits.maxImageDimension2D)) : 1u;
+    limits.maxArrayLayers      = get_u32(gl, GL_MAX_ARRAY_TEXTURE_LAYERS);
+
+    // Samplers live inside textures, so a stage sees as many as it has
+    // texture units. Uniform block binding 0 carries the push constants.
+    limits.maxPerStageSamplers       = get_u32(gl, GL_MAX_TEXTURE_IMAGE_UNITS);
+    limits.maxPerStageSampledImages  = limits.maxPerStageSamplers;
+    limits.maxPerStageStorageImages  = get_u32(gl, GL_MAX_FRAGMENT_IMAGE_UNIFORMS);
+    limits.maxPerStageUniformBuffers = std::max(get_u32(gl, GL_MAX_FRAGMENT_UNIFORM_BLOCKS), 1u) - 1u;
+    limits.maxPerStageStorageBuffers = get_u32(gl, GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS);
+
+    limits.maxColorAttachments = std::min({get_u32(gl, GL_MAX_COLOR_ATTACHMENTS), get_u32(gl, GL_MAX_DRAW_BUFFERS),
+                                           k_max_color_attachments});
+    limits.maxVertexInputBindings   = std::min(get_u32(gl, GL_MAX_VERTEX_ATTRIB_BINDINGS), k_max_vertex_bindings);
+    limits.maxVertexInputAttributes = std::min(get_u32(gl, GL_MAX_VERTEX_ATTRIBS), k_max_vertex_attributes);
+
+    uint32_t const samples = std::min({get_u32(gl, GL_MAX_SAMPLES), get_u32(gl, GL_MAX_COLOR_TEXTURE_SAMPLES),
+                                       get_u32(gl, GL_MAX_DEPTH_TEXTURE_SAMPLES)});
+    limits.maxMSAASamples = samples > 0 ? std::bit_floor(samples) : 1u;
+
+    limits.uniformBufferAlignment = std::max(get_u32(gl, GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT), 1u);
+    limits.storageBufferAlignment = std::max(get_u32(gl, GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT), 1u);
+
+    limits.maxComputeWorkGroupSizeX       = get_indexed_u32(gl, GL_MAX_COMPUTE_WORK_GROUP_SIZE, 0);
+    limits.maxComputeWorkGroupSizeY       = get_indexed_u32(gl, GL_MAX_COMPUTE_WORK_GROUP_SIZE, 1);
+    limits.maxComputeWorkGroupSizeZ       = get_indexed_u32(gl, GL_MAX_COMPUTE_WORK_GROUP_SIZE, 2);
+    limits.maxComputeWorkGroupInvocations = get_u32(gl, GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS);
+
+    limits.maxDrawIndirectCount = has_any(features, MultiDrawIndirect) ? UINT32_MAX : 1u;
+    limits.deviceCount          = 1;
+
+    // No timer queries yet: timestamps are unavailable.
+    limits.timelineTickFrequency = 1;
+    limits.timestampPeriod       = 0.0f;
+    return caps;
+}
+
+} // anonymous namespace
+
+ContextInfo query_context(GlFunctions const& gl) {
+    ContextInfo info{};
+    info.version_major = get_u32(gl, GL_MAJOR_VERSION);
+    info.version_minor = get_u32(gl, GL_MINOR_VERSION);
+
+    auto const string = [&gl](GLenum name) {
+        auto const* s = reinterpret_cast<char const*>(gl.glGetString(name)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        return std::string{s ? s : ""};
+    };
+    info.vendor   = string(GL_VENDOR);
+    info.renderer = string(GL_RENDERER);
+    identify(info);
+
+    GlExtensions& ext = info.extensions;
+    uint32_t const extension_count = get_u32(gl, GL_NUM_EXTENSIONS);
+    for (uint32_t i = 0; i < extension_count; ++i) {
+        auto const* s = reinterpret_cast<char const*>(gl.glGetStringi(GL_EXTENSIONS, i)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        if (!s) continue;
+        std::string_view const name{s};
+        if (name == "GL_ARB_bindless_texture")                ext.bindless_texture = true;
+        else if (name == "GL_ARB_texture_filter_anisotropic"
+              || name == "GL_EXT_texture_filter_anisotropic") ext.texture_filter_anisotropic = true;
+        else if (name == "GL_EXT_texture_compression_s3tc")   ext.texture_compression_s3tc = true;
+        else if (name == "GL_KHR_texture_compression_astc_ldr") ext.texture_compression_astc = true;
+        else if (name == "GL_ARB_gpu_shader_int64")           ext.gpu_shader_int64 = true;
+        else if (name == "GL_KHR_shader_subgroup")            ext.shader_subgroup = true;
+        else if (name == "GL_ARB_fragment_shader_interlock")  ext.fragment_shader_interlock = true;
+        else if (name == "GL_NVX_gpu_memory_info")            ext.nvx_gpu_memory_info = true;
+        else if (name == "GL_ATI_meminfo")                    ext.ati_meminfo = true;
+    }
+
+    if (info.version_major > 4 || (info.version_major == 4 && info.version_minor >= 6))
+        ext.texture_filter_anisotropic = true;
+
+    // The extension string alone is not enough: every handle entry point
+    // must have loaded too.
+    ext.bindless_texture = ext.bindless_texture && gl.glGetTextureHandleARB && gl.glGetImageHandleARB
+                        && gl.glMakeTextureHandleResidentARB && gl.glMakeTextureHandleNonResidentARB
+                        && gl.glMakeImageHandleResidentARB && gl.glMakeImageHandleNonResidentARB;
+
+    if (ext.nvx_gpu_memory_info) {
+        info.video_memory_bytes = uint64_t{get_u32(gl, GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX)} * 1024u;
+    } else if (ext.ati_meminfo) {
+        GLint free_kb[4]{};
+        gl.glGetIntegerv(GL_VBO_FREE_MEMORY_ATI, free_kb);
+        info.video_memory_bytes = uint64_t{static_cast<uint32_t>(std::max(free_kb[0], 0))} * 1024u;
+    }
+
+    info.capabilities = assemble_capabilities(info, gl);
+    return info;
+}
+
+std::string check_requirements(ContextInfo const& info, GlFunctions const& gl) {
+    if (info.version_major < 4 || (info.version_major == 4 && info.version_minor < 5))
+        return std::format("OpenGL {}.{} context; the backend requires 4.5", info.version_major,
+                           info.version_minor);
+    if (!gl.glSpecializeShader)
+        return "SPIR-V shaders unsupported (needs OpenGL 4.6 or ARB_gl_spirv)";
+    return {};
+}
+
+bool probe_adapter(AdapterDesc& out) {
+    auto context = GlContext::create(false);
+    if (!context) {
+        SPDLOG_WARN("[wren/rhi/opengl] Adapter probe failed: {}", context.error());
+        return false;
+    }
+    context->make_current();
+
+    GlFunctions gl{};
+    if (char const* missing = load_functions(gl, GlContext::proc_loader())) {
+        SPDLOG_WARN("[wren/rhi/opengl] Adapter probe failed: missing entry point {}", missing);
+        glfwMakeContextCurrent(nullptr);
+        return false;
+    }
+
+    ContextInfo const info = query_context(gl);
+    glfwMakeContextCurrent(nullptr);
+
+    if (std::string const reason = check_requirements(info, gl); !reason.empty()) {
+        SPDLOG_WARN("[wren/rhi/opengl] Adapter '{}' unusable: {}", info.renderer, reason);
+        return false;
+    }
+
+    out              = {};
+    out.index        = 0;
+    out.type         = info.type;
+    out.vendorId     = info.vendor_id;
+    out.videoMemoryBytes = info.video_memory_bytes;
+    out.capabilities = info.capabilities;
+    std::memcpy(out.name, info.renderer.data(), std::min<std::size_t>(info.renderer.size(), k_max_adapter_name - 1));
+    return true;
+}
+
+} // namespace wren::rhi::opengl
@@ -0,0 +1,555 @@
+#include "gl_device.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+
+#include "gl_device_impl.hpp"
+
+// The bitwise operators for wren::rhi flag enums are available via features.hpp.
+
+namespace wren::rhi::opengl {
+
+// -------------------------------------------------------------------------------------------------
+// Internal helpers
+// -------------------------------------------------------------------------------------------------
+namespace {
+
+// -----------------------------------------------------------------
+// Thread → pool slot binding
+//
+// As on Vulkan: a recording thread claims a pool slot on its first list
+// for a device and keeps it for the device's lifetime. Serials are never
+// reused, so a binding cannot leak onto a new device at the same address.
+// -----------------------------------------------------------------
+std::atomic<uint64_t> g_next_context_serial{1};
+
+struct ThreadBinding {
+    uint64_t serial = 0;
+    uint32_t slot   = 0;
+};
+thread_local std::array<ThreadBinding, 4> t_bindings{};
+
+[[nodiscard]] std::optional<uint32_t> bind_thread(CommandContext& ctx) noexcept {
+    for (auto const& b : t_bindings) {
+        if (b.serial == ctx.serial)
+            return b.slot;
+    }
+
+    uint32_t slot = ctx.next_thread_slot.load(std::memory_order_relaxed);
+    do {
+        if (slot >= k_max_recording_threads)
+            return std::nullopt;
+    } while (!ctx.next_thread_slot.compare_exchange_weak(slot, slot + 1, std::memory_order_acq_rel));
+
+    std::shift_right(t_bindings.begin(), t_bindings.end(), 1);
+    t_bindings.front() = {ctx.serial, slot};
+    return slot;
+}
+
+// -----------------------------------------------------------------
+// Timeouts
+// -----------------------------------------------------------------
+using Clock = std::chrono::steady_clock;
+
+/// @p timeout_ns from now; Clock::time_point::max() when that is out of
+/// range, which waits forever.
+[[nodiscard]] Clock::time_point deadline_after(uint64_t timeout_ns) noexcept {
+    auto const now  = Clock::now();
+    auto const left = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::time_point::max() - now);
+    if (timeout_ns >= static_cast<uint64_t>(left.count()))
+        return Clock::time_point::max();
+    return now + std::chrono::duration_cast<Clock::duration>(
+                     std::chrono::nanoseconds{static_cast<int64_t>(timeout_ns)});
+}
+
+// -----------------------------------------------------------------
+// Context setup
+// -----------------------------------------------------------------
+void WREN_GL_APIENTRY debug_message(GLenum /*source*/, GLenum type, GLuint /*id*/, GLenum severity,
+                                    GLsizei length, GLchar const* message, void const* /*user*/)
+{
+    std::string_view const msg{message, length >= 0 ? static_cast<std::size_t>(length) : std::strlen(message)};
+    if      (type == GL_DEBUG_TYPE_ERROR || severity == GL_DEBUG_SEVERITY_HIGH) SPDLOG_ERROR("[GL] {}", msg);
+    else if (severity == GL_DEBUG_SEVERITY_MEDIUM)                              SPDLOG_WARN ("[GL] {}", msg);
+    else if (severity == GL_DEBUG_SEVERITY_LOW)                                 SPDLOG_INFO ("[GL] {}", msg);
+    else                                                                        SPDLOG_TRACE("[GL] {}", msg);
+}
+
+/// The state every replay assumes (ReplayState): Vulkan's clip space and
+/// depth range, sRGB encoding on sRGB attachments, seamless cube maps,
+/// tightly packed pixel transfers and an always-on scissor test.
+void init_context_state(GlFunctions const& gl, bool debug) noexcept {
+    gl.glClipControl(GL_LOWER_LEFT, GL_ZERO_TO_ONE);
+    gl.glEnable(GL_FRAMEBUFFER_SRGB);
+    gl.glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+    gl.glEnable(GL_SCISSOR_TEST);
+    gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    gl.glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    if (debug) {
+        gl.glEnable(GL_DEBUG_OUTPUT);
+        gl.glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        gl.glDebugMessageCallback(&debug_message, nullptr);
+    }
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Impl teardown
+// -------------------------------------------------------------------------------------------------
+GlDevice::Impl::~Impl() {
+    context.make_current();
+    gl.glFinish();
+
+    for (RetireFence const& fence : commands.fences)
+        gl.glDeleteSync(fence.sync);
+    commands.fences.clear();
+
+    collect_deferred(*this, UINT64_MAX);
+    release_pipelines(*this);
+    forget_framebuffers(*this, 0);
+    release_resources(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+// GlDevice lifecycle
+// -------------------------------------------------------------------------------------------------
+GlDevice::GlDevice(std::unique_ptr<Impl> impl) noexcept
+    : impl_{std::move(impl)}
+{}
+
+GlDevice::~GlDevice() = default;
+
+GlDevice::GlDevice(GlDevice&&) noexcept            = default;
+GlDevice& GlDevice::operator=(GlDevice&&) noexcept = default;
+
+// -------------------------------------------------------------------------------------------------
+// Queries
+// -------------------------------------------------------------------------------------------------
+auto GlDevice::capabilities() const noexcept -> Capabilities const& {
+    return impl_->capabilities;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Factory
+// -------------------------------------------------------------------------------------------------
+auto GlDevice::create(DeviceDesc const& desc, bool debug) -> std::expected<GlDevice, DeviceCreateError> {
+    try {
+        // ------------------------------------------------------------------
+        // 1. Context. GL cannot choose among GPUs: the driver's default is
+        //    the one adapter enumerate_adapters() reports, so
+        //    preferredAdapterIndex has nothing to select.
+        // ------------------------------------------------------------------
+        bool const headless = has_any(desc.flags, DeviceFlag::Headless);
+        if (headless && has_any(desc.featureRequest.required, Feature::Presentation)) {
+            return std::unexpected{DeviceCreateError{
+                Status::InvalidArgument, "A headless device cannot require Feature::Presentation."}};
+        }
+
+        auto context = GlContext::create(debug);
+        if (!context)
+            return std::unexpected{DeviceCreateError{Status::InternalError, std::move(context.error())}};
+        context->make_current();
+
+        GlFunctions gl{};
+        if (char const* missing = load_functions(gl, GlContext::proc_loader())) {
+            return std::unexpected{DeviceCreateError{
+                Status::InternalError, std::format("OpenGL entry point {} unavailable.", missing)}};
+        }
+
+        ContextInfo info = query_context(gl);
+        if (std::string const reason = check_requirements(info, gl); !reason.empty()) {
+            return std::unexpected{DeviceCreateError{
+                Status::InternalError, std::format("Adapter '{}': {}.", info.renderer, reason)}};
+        }
+
+        // ------------------------------------------------------------------
+        // 2. Resolve feature set: required + available subset of preferred.
+        // ------------------------------------------------------------------
+        Feature const available = info.capabilities.features;
+        Feature const required  = desc.featureRequest.required;
+        Feature const preferred = headless
+            ? static_cast<Feature>(static_cast<uint64_t>(desc.featureRequest.preferred) &
+                                   ~static_cast<uint64_t>(Feature::Presentation))
+            : desc.featureRequest.preferred;
+
+        if (!has_all(available, required)) {
+            auto const bits = static_cast<uint64_t>(required) & ~static_cast<uint64_t>(available);
+            return std::unexpected{DeviceCreateError{
+                Status::MissingRequiredFeature,
+                std::format("Adapter '{}' lacks required features (mask={:#x}).", info.renderer, bits)}};
+        }
+
+        Feature const resolved = required | (preferred & available);
+
+        Feature const missing_preferred = static_cast<Feature>(
+            static_cast<uint64_t>(preferred) & ~static_cast<uint64_t>(available));
+        if (auto bits = static_cast<uint64_t>(missing_preferred); bits != 0) {
+            SPDLOG_WARN("[wren/rhi/opengl] Selected adapter '{}': "
+                        "some preferred features unavailable (mask={:#x}). "
+                        "Continuing with reduced feature set.",
+                        info.renderer, bits);
+        }
+
+        // ------------------------------------------------------------------
+        // 3. Final Capabilities. The memory counters are informational and
+        //    always read when present.
+        // ------------------------------------------------------------------
+        Capabilities final_caps = info.capabilities;
+        final_caps.features = resolved | (available & Feature::MemoryBudget);
+
+        // Coalesced and single indirect draws are core; more than one
+        // indirect draw per call needs the count entry points.
+        if (!has_any(final_caps.features, Feature::MultiDrawIndirect))
+            final_caps.limits.maxDrawIndirectCount = 1;
+
+        // ------------------------------------------------------------------
+        // 4. Construct. On failure the Impl destructor releases whatever
+        //    was created.
+        // ------------------------------------------------------------------
+        auto impl = std::make_unique<Impl>(std::move(*context), gl, std::move(info), std::move(final_caps));
+
+        auto& ctx = impl->commands;
+        ctx.serial           = g_next_context_serial.fetch_add(1, std::memory_order_relaxed);
+        ctx.frames_in_flight = std::clamp(desc.framesInFlight, 1u, k_max_frames_in_flight);
+
+        init_context_state(impl->gl, debug);
+        if (Status s = init_resources(*impl); s != Status::Ok) {
+            return std::unexpected{DeviceCreateError{
+                s, "Could not create the persistently mapped stream ring and bindless tables."}};
+        }
+
+        return GlDevice{std::move(impl)};
+
+    } catch (std::exception const& err) {
+        return std::unexpected{DeviceCreateError{
+            Status::InternalError,
+            std::format("Device creation error: {}", err.what())}};
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Replay & fences
+// -------------------------------------------------------------------------------------------------
+void flush_submissions(GlDevice::Impl& impl) noexcept {
+    auto& ctx = impl.commands;
+    {
+        // Swap rather than copy: submit() keeps appending to the emptied
+        // vectors, and their capacity returns here on the next flush.
+        std::scoped_lock lock{ctx.pending_mutex};
+        std::swap(ctx.pending, ctx.replay_batches);
+        std::swap(ctx.pending_lists, ctx.replay_lists);
+    }
+    if (ctx.replay_batches.empty())
+        return;
+
+    auto const& gl = impl.gl;
+
+    // Pipelines queued since begin_frame() link before the lists that bind them.
+    link_queued_pipelines(impl);
+
+    begin_replay(impl);
+    for (PendingSubmission const& batch : ctx.replay_batches) {
+        for (uint32_t i = 0; i < batch.list_count; ++i)
+            replay(impl, *ctx.replay_lists[batch.first_list + i]);
+    }
+    end_replay(impl);
+
+    // Shader writes into persistently mapped readback buffers become
+    // visible to the host once the fence below signals.
+    if (impl.readback_buffers.load(std::memory_order_relaxed) > 0)
+        gl.glMemoryBarrier(GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT);
+
+    RetireFence const fence{
+        .sync      = gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0),
+        .value     = ctx.replay_batches.back().value,
+        .ring_head = impl.stream.ring.head(),
+    };
+    gl.glFlush();
+
+    try {
+        ctx.fences.push_back(fence);
+    } catch (std::bad_alloc const&) {
+        // No room to track the fence: retire it on the spot.
+        gl.glClientWaitSync(fence.sync, GL_SYNC_FLUSH_COMMANDS_BIT, UINT64_MAX);
+        gl.glDeleteSync(fence.sync);
+        impl.stream.ring.release(fence.ring_head);
+        ctx.completed.store(fence.value, std::memory_order_release);
+        ctx.progress.notify_all();
+    }
+
+    ctx.replay_batches.clear();
+    ctx.replay_lists.clear();
+}
+
+Status retire_fences(GlDevice::Impl& impl, uint64_t wait_value, uint64_t timeout_ns) noexcept {
+    auto& ctx      = impl.commands;
+    auto const& gl = impl.gl;
+
+    uint64_t const fenced = ctx.fences.empty() ? ctx.completed.load(std::memory_order_relaxed)
+                                               : ctx.fences.back().value;
+    if (wait_value > fenced)
+        flush_submissions(impl);
+
+    auto const deadline = deadline_after(timeout_ns);
+
+    Status status  = Status::Ok;
+    bool   retired = false;
+    while (!ctx.fences.empty()) {
+        RetireFence const& fence = ctx.fences.front();
+
+        // Fences below the target are waited for; the rest only polled.
+        GLuint64 timeout = 0;
+        if (fence.value <= wait_value) {
+            timeout = deadline == Clock::time_point::max()
+                ? UINT64_MAX
+                : static_cast<GLuint64>(std::max<int64_t>(
+                      std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now()).count(), 0));
+        }
+
+        GLenum const r = gl.glClientWaitSync(fence.sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+        if (r == GL_WAIT_FAILED) {
+            SPDLOG_ERROR("[wren/rhi/opengl] glClientWaitSync failed; the context may be lost.");
+            status = Status::InternalError;
+            break;
+        }
+        if (r == GL_TIMEOUT_EXPIRED) {
+            if (fence.value <= wait_value)
+                status = Status::Timeout;
+            break;
+        }
+
+        gl.glDeleteSync(fence.sync);
+        impl.stream.ring.release(fence.ring_head);
+        ctx.completed.store(fence.value, std::memory_order_release);
+        ctx.fences.pop_front();
+        retired = true;
+    }
+
+    if (retired) {
+        // Taking the mutex orders the store above before a waiter's check.
+        { std::scoped_lock lock{ctx.progress_mutex}; }
+        ctx.progress.notify_all();
+    }
+    if (status == Status::Ok && ctx.completed.load(std::memory_order_relaxed) < wait_value)
+        status = Status::Timeout;
+    return status;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Frames
+// -------------------------------------------------------------------------------------------------
+auto GlDevice::begin_frame() noexcept -> Status {
+    auto& impl = *impl_;
+    auto& ctx  = impl.commands;
+    if (!impl.on_gl_thread() || ctx.in_frame)
+        return Status::InvalidArgument;
+
+    uint32_t const slot  = static_cast<uint32_t>(ctx.frame_number % ctx.frames_in_flight);
+    auto&          frame = ctx.frames[slot];
+
+    // Throttle: the GPU must have retired what this slot submitted
+    // framesInFlight frames ago before the CPU runs further ahead.
+    if (Status s = retire_fences(impl, frame.retire_value, UINT64_MAX); s != Status::Ok)
+        return s;
+
+    // Recycle every thread's lists for the slot. Lists keep their storage
+    // and are cleared by their next owner.
+    uint32_t const threads = std::min(ctx.next_thread_slot.load(std::memory_order_acquire),
+                                      k_max_recording_threads);
+    for (uint32_t t = 0; t < threads; ++t) {
+        if (auto* lists = frame.threads[t].get())
+            lists->used = 0;
+    }
+
+    // Destroy whatever was released before work the GPU has now finished.
+    collect_deferred(impl, ctx.completed.load(std::memory_order_acquire));
+    if (has_any(impl.capabilities.features, Feature::MemoryBudget))
+        sample_memory_budget(impl);
+    link_queued_pipelines(impl);
+
+    ctx.frame_slot = slot;
+    ++ctx.frame_number;
+    ctx.in_frame = true;
+    return Status::Ok;
+}
+
+auto GlDevice::end_frame() noexcept -> Status {
+    auto& impl = *impl_;
+    auto& ctx  = impl.commands;
+    if (!impl.on_gl_thread() || !ctx.in_frame)
+        return Status::InvalidArgument;
+    ctx.in_frame = false;
+
+    flush_submissions(impl);
+
+    // Recorded even for idle frames: waiting on a value already reached is
+    // free, and it keeps the slot's retire point exact.
+    ctx.frames[ctx.frame_slot].retire_value = ctx.last_value.load(std::memory_order_acquire);
+    return retire_fences(impl, 0, 0);
+}
+
+auto GlDevice::frame_number() const noexcept -> uint64_t {
+    return impl_->commands.frame_number;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Command lists
+// -------------------------------------------------------------------------------------------------
+auto GlDevice::begin_command_list(CommandListDesc const& desc,
+                                  CommandListHandle&     out) noexcept -> Status
+{
+    out = nullptr;
+
+    auto& impl = *impl_;
+    auto& ctx  = impl.commands;
+    if (!ctx.in_frame)
+        return Status::InvalidArgument;
+
+    // Replay inlines secondaries into their primary's render pass, so the
+    // declared layout is only validated.
+    RenderTargetLayout const* rt = desc.renderTargets;
+    if (rt && (desc.level != CommandListLevel::Secondary || rt->colorFormatCount > k_max_color_attachments))
+        return Status::InvalidArgument;
+
+    uint32_t const device_count = impl.capabilities.limits.deviceCount;
+    uint32_t const all_devices  = device_count >= 32 ? ~0u : (1u << device_count) - 1;
+    if ((desc.deviceMask & ~all_devices) != 0)
+        return Status::InvalidArgument;
+
+    auto const thread = bind_thread(ctx);
+    if (!thread) {
+        SPDLOG_ERROR("[wren/rhi/opengl] More than {} threads recorded command lists on one device.",
+                     k_max_recording_threads);
+        return Status::OutOfMemory;
+    }
+
+    try {
+        auto& lists = ctx.frames[ctx.frame_slot].threads[*thread];
+        if (!lists)
+            lists = std::make_unique<ThreadLists>();
+        if (lists->used == lists->lists.size())
+            lists->lists.emplace_back();
+
+        CommandListState& list = lists->lists[lists->used];
+        ++lists->used;
+        list.device        = &impl;
+        list.queue         = desc.queue;
+        list.level         = desc.level;
+        list.recording     = true;
+        list.profile_depth = 0;
+        list.commands.clear();
+        list.data.clear();
+        out = &list;
+        return Status::Ok;
+
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+}
+
+auto GlDevice::end_command_list(CommandListHandle list) noexcept -> Status {
+    if (!list || !list->recording)
+        return Status::InvalidArgument;
+    while (list->profile_depth > 0)
+        cmd_end_profile_region(*list);
+    list->recording = false;
+    return Status::Ok;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Submission & timelines
+// -------------------------------------------------------------------------------------------------
+auto GlDevice::submit(SubmitDesc const& desc, SyncPoint& out) noexcept -> Status {
+    out = {};
+
+    auto& ctx = impl_->commands;
+    if (!ctx.in_frame || desc.listCount == 0 || !desc.lists || (desc.waitCount > 0 && !desc.waits))
+        return Status::InvalidArgument;
+
+    std::span const lists{desc.lists, desc.listCount};
+    std::span const waits{desc.waits, desc.waitCount};
+
+    for (CommandListHandle list : lists) {
+        if (!list || list->device != impl_.get() || list->recording ||
+            list->level != CommandListLevel::Primary)
+            return Status::InvalidArgument;
+    }
+
+    std::scoped_lock lock{ctx.pending_mutex};
+
+    // A wait on a value nobody has been handed yet could never complete.
+    // Every other wait is met by replay order on the one timeline.
+    uint64_t const last = ctx.last_value.load(std::memory_order_relaxed);
+    for (SyncPoint const& w : waits) {
+        if (w.value > last)
+            return Status::InvalidArgument;
+    }
+
+    try {
+        ctx.pending_lists.reserve(ctx.pending_lists.size() + lists.size());
+        ctx.pending.reserve(ctx.pending.size() + 1);
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+
+    PendingSubmission const batch{
+        .first_list = static_cast<uint32_t>(ctx.pending_lists.size()),
+        .list_count = static_cast<uint32_t>(lists.size()),
+        .value      = last + 1,
+    };
+    ctx.pending_lists.insert(ctx.pending_lists.end(), lists.begin(), lists.end());
+    ctx.pending.push_back(batch);
+    ctx.last_value.store(batch.value, std::memory_order_release);
+
+    out = {lists.front()->queue, batch.value};
+    return Status::Ok;
+}
+
+auto GlDevice::wait(std::span<SyncPoint const> points, uint64_t timeout_ns) const noexcept -> Status {
+    auto& impl = *impl_;
+    auto& ctx  = impl.commands;
+
+    // One timeline: only the latest point matters.
+    uint64_t target = 0;
+    for (SyncPoint const& p : points)
+        target = std::max(target, p.value);
+    if (target <= ctx.completed.load(std::memory_order_acquire))
+        return Status::Ok;
+
+    if (impl.on_gl_thread())
+        return retire_fences(impl, target, timeout_ns);
+
+    // Elsewhere the GL thread advances the timeline as it retires fences.
+    std::unique_lock lock{ctx.progress_mutex};
+    auto const reached  = [&] { return ctx.completed.load(std::memory_order_acquire) >= target; };
+    auto const deadline = deadline_after(timeout_ns);
+    if (deadline == Clock::time_point::max()) {
+        ctx.progress.wait(lock, reached);
+        return Status::Ok;
+    }
+    return ctx.progress.wait_until(lock, deadline, reached) ? Status::Ok : Status::Timeout;
+}
+
+auto GlDevice::completed_value(QueueType /*queue*/) const noexcept -> uint64_t {
+    auto& impl = *impl_;
+    if (impl.on_gl_thread())
+        (void)retire_fences(impl, 0, 0);
+    return impl.commands.completed.load(std::memory_order_acquire);
+}
+
+} // namespace wren::rhi::opengl
@@ -0,0 +1,107 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// The hidden window that owns the device's GL context, and the probe that
+// turns a context's version, extensions and GL_MAX_* values into the
+// engine-level wren::rhi::Capabilities aggregate (context.cpp).
+
+#include <cstdint>
+#include <expected>
+#include <string>
+
+#include <wren/rhi/api/features.hpp>
+
+#include "gl_functions.hpp"
+
+struct GLFWwindow;
+
+namespace wren::rhi::opengl {
+
+// -------------------------------------------------------------------------------------------------
+// GlContext
+//
+// A 1x1 invisible GLFW window with a 4.6 (else 4.5) core, forward-compatible
+// context. The device renders off-screen into its own textures, so the
+// window is never shown and no default framebuffer is used.
+//
+// GLFW requires window creation and destruction on the main thread; the
+// device inherits that restriction. glfwInit() is reference-free and shared
+// with wren::platform, which owns glfwTerminate().
+// -------------------------------------------------------------------------------------------------
+class GlContext {
+public:
+    ~GlContext();
+
+    GlContext(GlContext&& other) noexcept;
+    GlContext& operator=(GlContext&& other) noexcept;
+
+    GlContext(GlContext const&)            = delete;
+    GlContext& operator=(GlContext const&) = delete;
+
+    /// Creates the window and its context. @p debug asks for a debug
+    /// context (KHR_debug output); otherwise the context is created with
+    /// GLFW_CONTEXT_NO_ERROR where the driver supports it.
+    [[nodiscard]] static auto create(bool debug) -> std::expected<GlContext, std::string>;
+
+    /// Makes the context current on the calling thread.
+    void make_current() const noexcept;
+
+    /// True when the context is current on the calling thread.
+    [[nodiscard]] bool is_current() const noexcept;
+
+    /// glfwGetProcAddress, for load_functions().
+    [[nodiscard]] static GlProcLoader proc_loader() noexcept;
+
+private:
+    explicit GlContext(GLFWwindow* window) noexcept : window_{window} {}
+    GLFWwindow* window_ = nullptr;
+};
+
+// -------------------------------------------------------------------------------------------------
+// Context queries
+// -------------------------------------------------------------------------------------------------
+
+/// Extensions the backend looks for beyond those its entry points imply.
+struct GlExtensions {
+    bool bindless_texture          = false;  ///< ARB_bindless_texture, with its entry points.
+    bool texture_filter_anisotropic = false; ///< 4.6, ARB_ or EXT_texture_filter_anisotropic.
+    bool texture_compression_s3tc  = false;  ///< EXT_texture_compression_s3tc.
+    bool texture_compression_astc  = false;  ///< KHR_texture_compression_astc_ldr.
+    bool gpu_shader_int64          = false;  ///< ARB_gpu_shader_int64.
+    bool shader_subgroup           = false;  ///< KHR_shader_subgroup.
+    bool fragment_shader_interlock = false;  ///< ARB_fragment_shader_interlock.
+    bool nvx_gpu_memory_info       = false;  ///< NVX_gpu_memory_info.
+    bool ati_meminfo               = false;  ///< ATI_meminfo.
+};
+
+/// Everything device creation and adapter enumeration read from a context.
+struct ContextInfo {
+    uint32_t     version_major = 0;
+    uint32_t     version_minor = 0;
+    std::string  vendor;             ///< GL_VENDOR.
+    std::string  renderer;           ///< GL_RENDERER; the adapter name.
+    uint32_t     vendor_id = 0;      ///< PCI vendor ID guessed from GL_VENDOR; 0 if unknown.
+    AdapterType  type      = AdapterType::Other;
+    uint64_t     video_memory_bytes = 0;  ///< NVX / ATI meminfo; 0 without either.
+    GlExtensions extensions{};
+
+    /// What a device on this context could enable, before feature
+    /// negotiation. Presentation, timeline semaphores and timestamps are
+    /// never offered.
+    Capabilities capabilities{};
+};
+
+/// Reads @p gl's context, which must be current and loaded.
+[[nodiscard]] ContextInfo query_context(GlFunctions const& gl);
+
+/// Backend requirements a context must meet: GL 4.5 and SPIR-V shaders
+/// (4.6 or ARB_gl_spirv). Returns an empty string when @p info meets them,
+/// the reason otherwise.
+[[nodiscard]] std::string check_requirements(ContextInfo const& info, GlFunctions const& gl);
+
+/// Creates a throwaway context, queries it and fills @p out as the one
+/// adapter the backend exposes: a GL context cannot pick among GPUs.
+/// Returns false when no usable context could be created.
+[[nodiscard]] bool probe_adapter(AdapterDesc& out);
+
+} // namespace wren::rhi::opengl
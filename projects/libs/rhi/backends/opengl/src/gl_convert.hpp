@@ -0,0 +1,237 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Conversions from wren::rhi enums to GL enums, shared by resources.cpp,
+// pipelines.cpp and commands.cpp.
+
+#include <cstdint>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/features.hpp>
+#include <wren/rhi/api/pipelines.hpp>
+
+#include "gl_functions.hpp"
+
+namespace wren::rhi::opengl {
+
+// -------------------------------------------------------------------------------------------------
+// Texture formats
+// -------------------------------------------------------------------------------------------------
+
+/// Storage format and pixel-transfer format / type of a TextureFormat.
+/// GL has no BGRA internal formats: BGRA textures are stored as RGBA and
+/// transferred as GL_BGRA, which swaps the channels on the way in and out.
+struct FormatInfo {
+    GLenum   internal_format;
+    GLenum   format;
+    GLenum   type;
+    uint32_t texel_bytes;
+    bool     depth;
+    bool     stencil;
+};
+
+[[nodiscard]] constexpr FormatInfo to_gl(TextureFormat f) noexcept {
+    switch (f) {
+        case TextureFormat::RGBA8_UNorm:     return {GL_RGBA8,              GL_RGBA, GL_UNSIGNED_BYTE, 4, false, false};
+        case TextureFormat::BGRA8_UNorm:     return {GL_RGBA8,              GL_BGRA, GL_UNSIGNED_BYTE, 4, false, false};
+        case TextureFormat::RGBA8_sRGB:      return {GL_SRGB8_ALPHA8,       GL_RGBA, GL_UNSIGNED_BYTE, 4, false, false};
+        case TextureFormat::BGRA8_sRGB:      return {GL_SRGB8_ALPHA8,       GL_BGRA, GL_UNSIGNED_BYTE, 4, false, false};
+        case TextureFormat::RG16_Float:      return {GL_RG16F,              GL_RG,   GL_HALF_FLOAT,    4, false, false};
+        case TextureFormat::RGBA16_Float:    return {GL_RGBA16F,            GL_RGBA, GL_HALF_FLOAT,    8, false, false};
+        case TextureFormat::RGBA32_Float:    return {GL_RGBA32F,            GL_RGBA, GL_FLOAT,        16, false, false};
+        case TextureFormat::R11G11B10_Float: return {GL_R11F_G11F_B10F,     GL_RGB,  GL_UNSIGNED_INT_10F_11F_11F_REV, 4, false, false};
+        case TextureFormat::RGB10A2_UNorm:   return {GL_RGB10_A2,           GL_RGBA, GL_UNSIGNED_INT_2_10_10_10_REV,  4, false, false};
+        case TextureFormat::D24S8:           return {GL_DEPTH24_STENCIL8,   GL_DEPTH_STENCIL,   GL_UNSIGNED_INT_24_8, 4, true, true};
+        case TextureFormat::D32:             return {GL_DEPTH_COMPONENT32F, GL_DEPTH_COMPONENT, GL_FLOAT,             4, true, false};
+        case TextureFormat::D32S8:           return {GL_DEPTH32F_STENCIL8,  GL_DEPTH_STENCIL,   GL_FLOAT_32_UNSIGNED_INT_24_8_REV, 8, true, true};
+    }
+    return {GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4, false, false};
+}
+
+/// Texture target of a TextureDesc's shape.
+[[nodiscard]] constexpr GLenum texture_target(TextureDimension dimension, uint32_t layers, SampleCount samples) noexcept {
+    switch (dimension) {
+        case TextureDimension::Tex1D: return layers > 1 ? GL_TEXTURE_1D_ARRAY : GL_TEXTURE_1D;
+        case TextureDimension::Tex2D:
+            if (samples != SampleCount::C1)
+                return layers > 1 ? GL_TEXTURE_2D_MULTISAMPLE_ARRAY : GL_TEXTURE_2D_MULTISAMPLE;
+            return layers > 1 ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
+        case TextureDimension::Tex3D: return GL_TEXTURE_3D;
+        case TextureDimension::Cube:  return layers > 6 ? GL_TEXTURE_CUBE_MAP_ARRAY : GL_TEXTURE_CUBE_MAP;
+    }
+    return GL_TEXTURE_2D;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Vertex input
+// -------------------------------------------------------------------------------------------------
+
+/// glVertexArrayAttrib{I}Format arguments of a VertexFormat. `integer`
+/// formats go through the I variant and reach the shader unconverted.
+struct VertexFormatInfo {
+    GLint     components;
+    GLenum    type;
+    GLboolean normalized;
+    bool      integer;
+};
+
+[[nodiscard]] constexpr VertexFormatInfo to_gl(VertexFormat f) noexcept {
+    switch (f) {
+        case VertexFormat::R32_Float:       return {1, GL_FLOAT, 0, false};
+        case VertexFormat::RG32_Float:      return {2, GL_FLOAT, 0, false};
+        case VertexFormat::RGB32_Float:     return {3, GL_FLOAT, 0, false};
+        case VertexFormat::RGBA32_Float:    return {4, GL_FLOAT, 0, false};
+        case VertexFormat::R8_UNorm:        return {1, GL_UNSIGNED_BYTE, 1, false};
+        case VertexFormat::RG8_UNorm:       return {2, GL_UNSIGNED_BYTE, 1, false};
+        case VertexFormat::RGBA8_UNorm:     return {4, GL_UNSIGNED_BYTE, 1, false};
+        case VertexFormat::BGRA8_UNorm:     return {static_cast<GLint>(GL_BGRA), GL_UNSIGNED_BYTE, 1, false};
+        case VertexFormat::RGBA8_SNorm:     return {4, GL_BYTE, 1, false};
+        case VertexFormat::RGB10A2_UNorm:   return {4, GL_UNSIGNED_INT_2_10_10_10_REV, 1, false};
+        case VertexFormat::R11G11B10_Float: return {3, GL_UNSIGNED_INT_10F_11F_11F_REV, 0, false};
+        case VertexFormat::R16_UInt:        return {1, GL_UNSIGNED_SHORT, 0, true};
+        case VertexFormat::RG16_UInt:       return {2, GL_UNSIGNED_SHORT, 0, true};
+        case VertexFormat::RGBA16_UInt:     return {4, GL_UNSIGNED_SHORT, 0, true};
+        case VertexFormat::R32_UInt:        return {1, GL_UNSIGNED_INT, 0, true};
+        case VertexFormat::RG32_UInt:       return {2, GL_UNSIGNED_INT, 0, true};
+        case VertexFormat::RGBA32_UInt:     return {4, GL_UNSIGNED_INT, 0, true};
+        case VertexFormat::R32_SInt:        return {1, GL_INT, 0, true};
+        case VertexFormat::RG32_SInt:       return {2, GL_INT, 0, true};
+        case VertexFormat::RGBA32_SInt:     return {4, GL_INT, 0, true};
+    }
+    return {3, GL_FLOAT, 0, false};
+}
+
+[[nodiscard]] constexpr GLenum to_gl(IndexType t) noexcept {
+    switch (t) {
+        case IndexType::Uint16: return GL_UNSIGNED_SHORT;
+        case IndexType::Uint32: return GL_UNSIGNED_INT;
+        case IndexType::Uint8:  return GL_UNSIGNED_BYTE;
+    }
+    return GL_UNSIGNED_INT;
+}
+
+[[nodiscard]] constexpr uint32_t index_size(IndexType t) noexcept {
+    switch (t) {
+        case IndexType::Uint16: return 2;
+        case IndexType::Uint32: return 4;
+        case IndexType::Uint8:  return 1;
+    }
+    return 4;
+}
+
+[[nodiscard]] constexpr GLenum to_gl(PrimitiveTopology t) noexcept {
+    switch (t) {
+        case PrimitiveTopology::PointList:     return GL_POINTS;
+        case PrimitiveTopology::LineList:      return GL_LINES;
+        case PrimitiveTopology::LineStrip:     return GL_LINE_STRIP;
+        case PrimitiveTopology::TriangleList:  return GL_TRIANGLES;
+        case PrimitiveTopology::TriangleStrip: return GL_TRIANGLE_STRIP;
+        case PrimitiveTopology::TriangleFan:   return GL_TRIANGLE_FAN;
+        case PrimitiveTopology::PatchList:     return GL_PATCHES;
+    }
+    return GL_TRIANGLES;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Fixed-function state
+// -------------------------------------------------------------------------------------------------
+
+/// GL's comparison functions are consecutive in CompareOp's order.
+[[nodiscard]] constexpr GLenum to_gl(CompareOp op) noexcept {
+    return GL_NEVER + static_cast<GLenum>(op);
+}
+
+[[nodiscard]] constexpr GLenum to_gl(StencilOp op) noexcept {
+    switch (op) {
+        case StencilOp::Keep:           return GL_KEEP;
+        case StencilOp::Zero:           return GL_ZERO;
+        case StencilOp::Replace:        return GL_REPLACE;
+        case StencilOp::IncrementClamp: return GL_INCR;
+        case StencilOp::DecrementClamp: return GL_DECR;
+        case StencilOp::Invert:         return GL_INVERT;
+        case StencilOp::IncrementWrap:  return GL_INCR_WRAP;
+        case StencilOp::DecrementWrap:  return GL_DECR_WRAP;
+    }
+    return GL_KEEP;
+}
+
+[[nodiscard]] constexpr GLenum to_gl(BlendFactor f) noexcept {
+    switch (f) {
+        case BlendFactor::Zero:                  return GL_ZERO;
+        case BlendFactor::One:                   return GL_ONE;
+        case BlendFactor::SrcColor:              return GL_SRC_COLOR;
+        case BlendFactor::OneMinusSrcColor:      return GL_ONE_MINUS_SRC_COLOR;
+        case BlendFactor::DstColor:              return GL_DST_COLOR;
+        case BlendFactor::OneMinusDstColor:      return GL_ONE_MINUS_DST_COLOR;
+        case BlendFactor::SrcAlpha:              return GL_SRC_ALPHA;
+        case BlendFactor::OneMinusSrcAlpha:      return GL_ONE_MINUS_SRC_ALPHA;
+        case BlendFactor::DstAlpha:              return GL_DST_ALPHA;
+        case BlendFactor::OneMinusDstAlpha:      return GL_ONE_MINUS_DST_ALPHA;
+        case BlendFactor::ConstantColor:         return GL_CONSTANT_COLOR;
+        case BlendFactor::OneMinusConstantColor: return GL_ONE_MINUS_CONSTANT_COLOR;
+        case BlendFactor::ConstantAlpha:         return GL_CONSTANT_ALPHA;
+        case BlendFactor::OneMinusConstantAlpha: return GL_ONE_MINUS_CONSTANT_ALPHA;
+        case BlendFactor::SrcAlphaSaturate:      return GL_SRC_ALPHA_SATURATE;
+        case BlendFactor::Src1Color:             return GL_SRC1_COLOR;
+        case BlendFactor::OneMinusSrc1Color:     return GL_ONE_MINUS_SRC1_COLOR;
+        case BlendFactor::Src1Alpha:             return GL_SRC1_ALPHA;
+        case BlendFactor::OneMinusSrc1Alpha:     return GL_ONE_MINUS_SRC1_ALPHA;
+    }
+    return GL_ONE;
+}
+
+[[nodiscard]] constexpr GLenum to_gl(BlendOp op) noexcept {
+    switch (op) {
+        case BlendOp::Add:             return GL_FUNC_ADD;
+        case BlendOp::Subtract:        return GL_FUNC_SUBTRACT;
+        case BlendOp::ReverseSubtract: return GL_FUNC_REVERSE_SUBTRACT;
+        case BlendOp::Min:             return GL_MIN;
+        case BlendOp::Max:             return GL_MAX;
+    }
+    return GL_FUNC_ADD;
+}
+
+/// The backend renders with GL's lower-left origin, so a texture holds its
+/// rows in the order Vulkan would write them and no shader flips y. Window
+/// y then grows the other way to Vulkan's framebuffer y, which mirrors
+/// every triangle's winding: counter-clockwise in the API is clockwise to GL.
+[[nodiscard]] constexpr GLenum to_gl(FrontFace f) noexcept {
+    return f == FrontFace::CCW ? GL_CW : GL_CCW;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Barriers
+// -------------------------------------------------------------------------------------------------
+
+/// glMemoryBarrier bits that make shader storage writes visible to a
+/// buffer's @p next usage. Every other write GL orders by itself.
+[[nodiscard]] constexpr GLbitfield barrier_bits(BufferUsage next) noexcept {
+    auto const has = [next](BufferUsage bit) { return underlying(next & bit) != 0; };
+
+    GLbitfield bits = 0;
+    if (has(BufferUsage::Vertex))   bits |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;
+    if (has(BufferUsage::Index))    bits |= GL_ELEMENT_ARRAY_BARRIER_BIT;
+    if (has(BufferUsage::Uniform))  bits |= GL_UNIFORM_BARRIER_BIT;
+    if (has(BufferUsage::Storage))  bits |= GL_SHADER_STORAGE_BARRIER_BIT;
+    if (has(BufferUsage::Indirect)) bits |= GL_COMMAND_BARRIER_BIT;
+    if (has(BufferUsage::TransferSrc | BufferUsage::TransferDst))
+        bits |= GL_BUFFER_UPDATE_BARRIER_BIT | GL_PIXEL_BUFFER_BARRIER_BIT;
+    return bits;
+}
+
+/// Texture counterpart of barrier_bits(BufferUsage), for image stores.
+[[nodiscard]] constexpr GLbitfield barrier_bits(TextureUsage next) noexcept {
+    auto const has = [next](TextureUsage bit) { return underlying(next & bit) != 0; };
+
+    GLbitfield bits = 0;
+    if (has(TextureUsage::Sampled)) bits |= GL_TEXTURE_FETCH_BARRIER_BIT;
+    if (has(TextureUsage::Storage)) bits |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+    if (has(TextureUsage::ColorAttachment | TextureUsage::DepthStencilAtt))
+        bits |= GL_FRAMEBUFFER_BARRIER_BIT;
+    if (has(TextureUsage::TransferSrc | TextureUsage::TransferDst))
+        bits |= GL_TEXTURE_UPDATE_BARRIER_BIT;
+    return bits;
+}
+
+} // namespace wren::rhi::opengl
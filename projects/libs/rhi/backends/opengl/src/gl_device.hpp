@@ -0,0 +1,316 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// GlDevice, the device behind the backend's vtable entry points (api.cpp).
+// Its implementation is split like VulkanDevice's: device.cpp (creation,
+// frames, submission and timelines), resources.cpp, pipelines.cpp and
+// commands.cpp.
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <span>
+#include <string>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/features.hpp>
+#include <wren/rhi/api/pipelines.hpp>
+#include <wren/rhi/api/resources.hpp>
+#include <wren/rhi/api/status.hpp>
+
+namespace wren::rhi::opengl {
+
+// -------------------------------------------------------------------------------------------------
+// Fine-grained error returned from GlDevice::create().
+// -------------------------------------------------------------------------------------------------
+struct DeviceCreateError {
+    Status      status;
+    std::string message;
+};
+
+// -------------------------------------------------------------------------------------------------
+// GlDevice — owns a GL 4.5+ core context and everything created on it.
+//
+// Responsibilities:
+//   - Creates a hidden context (gl_context.hpp), loads the entry points and
+//     resolves DeviceFeatureRequest against what the context offers.
+//   - Queries and stores the final Capabilities, like VulkanDevice.
+//
+// The GL thread:
+//   A GL context is current on one thread at a time, and the device keeps
+//   its own current on the thread that created it. Everything that reaches
+//   the driver runs there: create_buffers(), create_textures(),
+//   begin_frame(), end_frame() and the replay of submitted lists. Other
+//   threads get Status::InvalidArgument from those calls. What only touches
+//   CPU state — recording, submitting, destroying, shader modules, pipeline
+//   creation, timeline queries — is thread-safe as on Vulkan.
+//
+// Command recording:
+//   Lists are CPU command streams drawn from per-thread pools for each frame
+//   in flight, recorded without locks. submit() queues them; end_frame()
+//   replays every queued list in submission order. Replay keeps a shadow of
+//   the bound GL state and drops the calls that would not change it.
+//
+// Multi-draw fast path:
+//   Consecutive direct draws of the same kind with no state change between
+//   them are coalesced during replay: their arguments are written into the
+//   persistently mapped stream ring as DrawArraysIndirectCommand /
+//   DrawElementsIndirectCommand records and issued as one
+//   glMultiDraw{Arrays,Elements}Indirect call. A lone draw goes to the
+//   driver directly. gl_DrawID therefore numbers the draws of a batch;
+//   shaders must not read it outside indirect draws.
+//
+// Scheduling:
+//   GL has one implicit queue, so every QueueType shares one timeline and
+//   SubmitDesc waits are met by replay order alone. Each end_frame() that
+//   replayed anything inserts one glFenceSync, tagged with the timeline
+//   value of its last submission; completed_value() is the value of the
+//   newest fence the GPU has passed. Frames in flight are throttled by
+//   waiting on those fences.
+//
+// Resources:
+//   Buffers are immutable glNamedBufferStorage objects. Upload and Readback
+//   buffers are mapped once, persistent and coherent (ARB_buffer_storage),
+//   and stay mapped until destroyed. Textures are glTextureStorage objects
+//   with their sampler state baked in: linear filtering, repeat addressing.
+//
+// Bindless heap:
+//   Always enabled. Sampled and storage textures and storage buffers get a
+//   free-list index at creation. With ARB_bindless_texture
+//   (Feature::DescriptorIndexing_Bindless) the index selects a resident
+//   handle in a persistently mapped table, SSBO binding 0 for sampled and
+//   1 for storage textures. Without it the index is a texture or image
+//   unit, and the tables are bound with glBindTextures / glBindImageTextures
+//   whenever they changed. Storage buffer i is SSBO binding 2 + i. There is
+//   no sampler array: find_samplers() reports MissingRequiredFeature.
+//
+// Push constants:
+//   GL SPIR-V has no push constants. The 128-byte range is a std140 uniform
+//   block at binding 0, copied into the stream ring before each draw or
+//   dispatch that follows a change.
+//
+// Stream ring:
+//   One persistently mapped, coherent buffer (k_stream_ring_bytes) feeds
+//   multi-draw records and push constants. Each fence carries the ring's
+//   head when it was inserted, and retiring the fence releases everything
+//   before it; a full ring waits for the oldest fence.
+//
+// Shader modules and pipelines:
+//   Modules are shared per distinct SPIR-V like on Vulkan. Pipelines are
+//   recipes until the GL thread links them with glSpecializeShader: at once
+//   when created on the GL thread, otherwise at the next begin_frame(), the
+//   first time replay binds them, or in wait_pipelines(). There is no
+//   on-disk cache; the driver keeps its own.
+//
+// Destruction:
+//   destroy_*() invalidates the handles at once. The GL objects, and the
+//   heap slots they held, are deleted by begin_frame() once the GPU has
+//   passed the timeline value current at the call.
+//
+// Thread-safety:
+//   Construction and destruction happen on the GL thread, which must be the
+//   main thread (GLFW). See "The GL thread" above for everything else.
+// -------------------------------------------------------------------------------------------------
+class GlDevice {
+public:
+    ~GlDevice();
+
+    GlDevice(GlDevice&&) noexcept;
+    GlDevice& operator=(GlDevice&&) noexcept;
+
+    GlDevice(GlDevice const&)            = delete;
+    GlDevice& operator=(GlDevice const&) = delete;
+
+    // -----------------------------------------------------------------
+    // Factory
+    // -----------------------------------------------------------------
+
+    /// Creates the context on the calling thread, which becomes the GL
+    /// thread, and resolves the feature set described by @p desc.
+    ///
+    /// Returns DeviceCreateError with Status::MissingRequiredFeature when
+    /// the context lacks a feature in desc.featureRequest.required, and
+    /// Status::InternalError when no 4.5 context with SPIR-V support could
+    /// be created. @p debug asks for a debug context whose messages are
+    /// logged (InstanceDesc::debug or DeviceFlag::Debug).
+    [[nodiscard]] static auto create(DeviceDesc const& desc, bool debug)
+        -> std::expected<GlDevice, DeviceCreateError>;
+
+    // -----------------------------------------------------------------
+    // Queries
+    // -----------------------------------------------------------------
+
+    /// Returns the resolved capabilities. Features in
+    /// featureRequest.preferred that were unavailable are absent.
+    [[nodiscard]] auto capabilities() const noexcept -> Capabilities const&;
+
+    // -----------------------------------------------------------------
+    // Resources
+    // -----------------------------------------------------------------
+
+    /// Creates one buffer per element of @p descs into the matching element
+    /// of @p out. On failure nothing is created, @p out is filled with null
+    /// handles and the first error is returned. GL thread only.
+    [[nodiscard]] auto create_buffers(std::span<BufferDesc const> descs,
+                                      std::span<BufferHandle>     out) noexcept -> Status;
+
+    /// Destroys every live buffer in @p handles; null and stale handles are
+    /// skipped. Deferred until the GPU has finished everything submitted
+    /// before the call. Thread-safe.
+    void destroy_buffers(std::span<BufferHandle const> handles) noexcept;
+
+    /// Texture counterpart of create_buffers(). Placed (heap) and sparse
+    /// textures report MissingRequiredFeature. GL thread only.
+    [[nodiscard]] auto create_textures(std::span<TextureDesc const> descs,
+                                       std::span<TextureHandle>     out) noexcept -> Status;
+
+    /// Destroys every live texture in @p handles, deferred like
+    /// destroy_buffers(). Thread-safe.
+    void destroy_textures(std::span<TextureHandle const> handles) noexcept;
+
+    /// Persistent mapping of an Upload or Readback buffer; null for GpuOnly
+    /// buffers and null or stale handles. Thread-safe.
+    [[nodiscard]] auto buffer_mapping(BufferHandle handle) const noexcept -> void*;
+
+    // -----------------------------------------------------------------
+    // Bindless heap (thread-safe)
+    // -----------------------------------------------------------------
+
+    /// Capacity and occupancy of the heap; descriptorBuffer is always false.
+    void bindless_heap_info(BindlessHeapInfo& out) const noexcept;
+
+    /// Samplers are baked into textures: MissingRequiredFeature, with @p out
+    /// filled with k_invalid_bindless_index.
+    [[nodiscard]] auto find_samplers(std::span<SamplerDesc const> descs, std::span<uint32_t> out) noexcept
+        -> Status;
+
+    /// Heap index of a storage buffer, or of a texture in the table @p cls
+    /// names; k_invalid_bindless_index for resources outside it.
+    [[nodiscard]] auto bindless_index(BufferHandle handle) const noexcept -> uint32_t;
+    [[nodiscard]] auto bindless_index(TextureHandle handle, BindlessClass cls) const noexcept -> uint32_t;
+
+    // -----------------------------------------------------------------
+    // Device memory
+    // -----------------------------------------------------------------
+
+    /// One device-local heap. Size and usage are driver-reported with
+    /// NVX_gpu_memory_info / ATI_meminfo, sampled by begin_frame(); without
+    /// either they are the bytes the device allocated. Thread-safe.
+    void memory_budget(MemoryBudget& out) const noexcept;
+
+    // -----------------------------------------------------------------
+    // Shader modules
+    // -----------------------------------------------------------------
+
+    /// Copies and reflects one module per element of @p descs into @p out,
+    /// sharing the record of identical code already loaded. On failure
+    /// nothing is created and @p out is filled with null handles. Only
+    /// entry points and workgroup sizes are reflected. Thread-safe.
+    [[nodiscard]] auto create_shader_modules(std::span<ShaderModuleDesc const> descs,
+                                             std::span<ShaderModuleHandle>     out) noexcept -> Status;
+
+    /// Releases every live handle in @p handles; null and stale handles are
+    /// skipped. Thread-safe.
+    void destroy_shader_modules(std::span<ShaderModuleHandle const> handles) noexcept;
+
+    /// Reflection parsed when @p handle was created. Thread-safe.
+    [[nodiscard]] auto shader_module_reflection(ShaderModuleHandle handle, ShaderReflection& out) const noexcept
+        -> Status;
+
+    // -----------------------------------------------------------------
+    // Pipeline cache
+    // -----------------------------------------------------------------
+
+    /// Shader module cache counters; the pipeline cache counters stay 0.
+    /// Thread-safe.
+    void pipeline_cache_stats(PipelineCacheStats& out) const noexcept;
+
+    // -----------------------------------------------------------------
+    // Pipelines
+    // -----------------------------------------------------------------
+
+    /// Validates every element of @p descs and creates one pipeline per
+    /// element into @p out. On the GL thread the programs are linked before
+    /// the call returns; elsewhere they are queued. On failure nothing is
+    /// created and @p out is filled with null handles. A program the driver
+    /// rejects reports PipelineStatus::Failed. Thread-safe.
+    [[nodiscard]] auto create_graphics_pipelines(std::span<GraphicsPipelineDesc const> descs,
+                                                 std::span<PipelineHandle>             out) noexcept
+        -> Status;
+
+    /// Compute counterpart of create_graphics_pipelines().
+    [[nodiscard]] auto create_compute_pipelines(std::span<ComputePipelineDesc const> descs,
+                                                std::span<PipelineHandle>            out) noexcept
+        -> Status;
+
+    /// Destroys every live pipeline in @p handles, deferred like
+    /// destroy_buffers(); null and stale handles are skipped. Thread-safe.
+    void destroy_pipelines(std::span<PipelineHandle const> handles) noexcept;
+
+    /// Link state of @p handle; Failed for null and stale handles. Thread-safe.
+    [[nodiscard]] auto pipeline_status(PipelineHandle handle) const noexcept -> PipelineStatus;
+
+    /// Moves the still-queued pipelines in @p handles to the front of the
+    /// link queue, first handle first.
+    void prioritize_pipelines(std::span<PipelineHandle const> handles) noexcept;
+
+    /// Blocks until every pipeline in @p handles is linked: on the GL thread
+    /// by linking the queued ones, elsewhere by waiting for the GL thread to.
+    /// InternalError if any failed or was stale.
+    [[nodiscard]] auto wait_pipelines(std::span<PipelineHandle const> handles) noexcept -> Status;
+
+    // -----------------------------------------------------------------
+    // Frames & command lists
+    // -----------------------------------------------------------------
+
+    /// Advances to the next frame-in-flight slot, waits on the fence the
+    /// slot recorded when it last ended, recycles its lists, deletes the
+    /// deferred releases the GPU has finished with and links queued
+    /// pipelines. GL thread only; no list may be recording.
+    [[nodiscard]] auto begin_frame() noexcept -> Status;
+
+    /// Replays every submission queued since begin_frame() and fences it.
+    /// GL thread only.
+    [[nodiscard]] auto end_frame() noexcept -> Status;
+
+    /// Monotonic frame counter; 0 before the first begin_frame().
+    [[nodiscard]] auto frame_number() const noexcept -> uint64_t;
+
+    /// Begins a list from the calling thread's pool for the current frame.
+    /// Thread-safe and lock-free after the thread's first call in a frame slot.
+    [[nodiscard]] auto begin_command_list(CommandListDesc const& desc,
+                                          CommandListHandle&     out) noexcept -> Status;
+
+    /// Ends recording of @p list.
+    [[nodiscard]] static auto end_command_list(CommandListHandle list) noexcept -> Status;
+
+    /// Queues one submission for end_frame() and assigns it the next
+    /// timeline value, written to @p out. Thread-safe.
+    [[nodiscard]] auto submit(SubmitDesc const& desc, SyncPoint& out) noexcept -> Status;
+
+    // -----------------------------------------------------------------
+    // Timelines (thread-safe)
+    // -----------------------------------------------------------------
+
+    /// Blocks until every point is reached; Status::Timeout if @p timeout_ns
+    /// elapses first. On the GL thread, submissions still queued are
+    /// replayed first so the wait can finish.
+    [[nodiscard]] auto wait(std::span<SyncPoint const> points,
+                            uint64_t                   timeout_ns) const noexcept -> Status;
+
+    /// Last value the GPU has reached on the shared timeline.
+    [[nodiscard]] auto completed_value(QueueType queue) const noexcept -> uint64_t;
+
+    // -----------------------------------------------------------------
+    // Internal
+    // -----------------------------------------------------------------
+    struct Impl;
+    [[nodiscard]] Impl&       impl() noexcept       { return *impl_; }
+    [[nodiscard]] Impl const& impl() const noexcept { return *impl_; }
+
+private:
+    explicit GlDevice(std::unique_ptr<Impl> impl) noexcept;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace wren::rhi::opengl
@@ -0,0 +1,702 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Definition of GlDevice::Impl and the command list state, shared by the
+// translation units that implement GlDevice (device.cpp, resources.cpp,
+// pipelines.cpp, commands.cpp).
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <wren/foundation/containers/slot_map.hpp>
+#include <wren/foundation/memory/ring_allocator.hpp>
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/features.hpp>
+#include <wren/rhi/api/pipelines.hpp>
+#include <wren/rhi/api/resources.hpp>
+
+#include "gl_context.hpp"
+#include "gl_device.hpp"
+#include "gl_functions.hpp"
+
+namespace wren::rhi::opengl {
+
+inline constexpr uint32_t k_max_frames_in_flight = 3;
+
+/// Capacity of the stream ring: multi-draw records and push constant
+/// copies of every frame in flight.
+inline constexpr uint64_t k_stream_ring_bytes = 8ull << 20;
+
+/// Longest run of direct draws one glMultiDraw*Indirect call takes.
+inline constexpr uint32_t k_max_multi_draw = 4096;
+
+/// Fixed binding points (GlDevice, "Bindless heap" and "Push constants").
+inline constexpr GLuint k_push_constant_binding        = 0;  // GL_UNIFORM_BUFFER
+inline constexpr GLuint k_texture_table_binding        = 0;  // GL_SHADER_STORAGE_BUFFER, with handles
+inline constexpr GLuint k_image_table_binding          = 1;  // GL_SHADER_STORAGE_BUFFER, with handles
+inline constexpr GLuint k_first_storage_buffer_binding = 2;  // GL_SHADER_STORAGE_BUFFER
+
+// -------------------------------------------------------------------------------------------------
+// Resource pools
+//
+// Columns are ordered hot to cold, as on Vulkan: the GL name recording
+// resolves first, the creation descriptor last. extract() yields the
+// BufferRow / TextureRow tuples the deferred queue holds.
+// -------------------------------------------------------------------------------------------------
+
+/// Heap slots of one texture. The handles are the resident
+/// ARB_bindless_texture handles behind the indices; 0 without the extension.
+struct BindlessSlots {
+    uint32_t sampled        = k_invalid_bindless_index;
+    uint32_t storage        = k_invalid_bindless_index;
+    GLuint64 texture_handle = 0;
+    GLuint64 image_handle   = 0;
+};
+
+using BufferPool = foundation::containers::SlotMap<
+    BufferHandle,
+    GLuint,        // 0: buffer name
+    void*,         // 1: persistent mapping (Upload / Readback only)
+    uint32_t,      // 2: StorageBuffer heap index (k_invalid_bindless_index if none)
+    BufferDesc>;   // 3: creation parameters (debugName cleared)
+
+using TexturePool = foundation::containers::SlotMap<
+    TextureHandle,
+    GLuint,        // 0: texture name
+    GLenum,        // 1: target
+    BindlessSlots, // 2: heap slots
+    TextureDesc>;  // 3: creation parameters (debugName cleared)
+
+using BufferRow  = std::tuple<GLuint, void*, uint32_t, BufferDesc>;
+using TextureRow = std::tuple<GLuint, GLenum, BindlessSlots, TextureDesc>;
+
+// -------------------------------------------------------------------------------------------------
+// Bindless heap
+//
+// One free list per BindlessClass; the Sampler class has no capacity. The
+// tables are written on the GL thread only (creation and deferred release
+// both run there); `mutex` guards the counters bindless_heap_info() reads.
+// Replay rebinds the unit arrays and storage buffers when `version` moved
+// past the version it last bound.
+// -------------------------------------------------------------------------------------------------
+struct BindlessTable {
+    uint32_t              capacity = 0;
+    uint32_t              next     = 0;  // lowest index never handed out
+    uint32_t              used     = 0;
+    std::vector<uint32_t> free;
+
+    /// k_invalid_bindless_index when the table is full.
+    [[nodiscard]] uint32_t acquire() {
+        if (!free.empty()) {
+            uint32_t const index = free.back();
+            free.pop_back();
+            ++used;
+            return index;
+        }
+        if (next == capacity) return k_invalid_bindless_index;
+        ++used;
+        return next++;
+    }
+
+    void release(uint32_t index) {
+        if (index == k_invalid_bindless_index) return;
+        free.push_back(index);
+        --used;
+    }
+};
+
+struct BindlessContext {
+    bool handles = false;  // ARB_bindless_texture
+
+    mutable std::mutex mutex;
+    BindlessTable      tables[k_bindless_class_count];  // by BindlessClass
+
+    // With handles: resident handles by index, persistently mapped.
+    GLuint    texture_table   = 0;
+    GLuint    image_table     = 0;
+    GLuint64* texture_handles = nullptr;
+    GLuint64* image_handles   = nullptr;
+
+    // Without handles: the texture / image unit each index binds.
+    std::vector<GLuint> texture_units;
+    std::vector<GLuint> image_units;
+
+    // Storage buffer i is SSBO binding k_first_storage_buffer_binding + i.
+    std::vector<GLuint> storage_buffers;
+
+    uint64_t version = 1;
+};
+
+// -------------------------------------------------------------------------------------------------
+// Stream ring
+//
+// Persistently mapped, coherent and write-only. The GL thread is its only
+// producer and consumer: replay allocates, retire_fences() releases up to
+// the head each retired fence recorded.
+// -------------------------------------------------------------------------------------------------
+struct StreamRing {
+    GLuint                           buffer = 0;
+    std::byte*                       mapped = nullptr;
+    uint32_t                         uniform_alignment = 256;  // power of two
+    foundation::memory::RingAllocator ring{k_stream_ring_bytes};
+};
+
+// -------------------------------------------------------------------------------------------------
+// Shader modules
+//
+// One immutable record per distinct SPIR-V, like the Vulkan backend's. The
+// code is kept: the GL thread specialises it into shader objects when a
+// pipeline using it is linked.
+// -------------------------------------------------------------------------------------------------
+struct ShaderModuleRecord {
+    std::vector<uint32_t> code;
+    ShaderReflection      reflection{};
+};
+
+using ShaderModulePool = foundation::containers::SlotMap<
+    ShaderModuleHandle,
+    std::shared_ptr<ShaderModuleRecord const>>;  // 0: record
+
+struct ShaderModuleContext {
+    mutable std::shared_mutex pool_mutex;
+    ShaderModulePool          pool;
+
+    // Guards everything below.
+    mutable std::mutex                                                    mutex;
+    std::unordered_map<uint64_t, std::weak_ptr<ShaderModuleRecord const>> by_hash;
+    std::size_t                                                           sweep_at = 64;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> bytes{0};
+};
+
+// -------------------------------------------------------------------------------------------------
+// Pipelines
+//
+// A record is a recipe until the GL thread links it; `status` publishes the
+// result to other threads. Everything past `status` is written before the
+// record is published, or by the GL thread while linking, and read by the
+// GL thread only.
+// -------------------------------------------------------------------------------------------------
+struct PipelineStage {
+    GLenum                                    type = 0;  // GL_VERTEX_SHADER, ...
+    std::shared_ptr<ShaderModuleRecord const> module;
+    std::string                               entry_point;
+};
+
+/// Fixed-function state a graphics pipeline sets when bound.
+struct GraphicsState {
+    GLenum                   topology      = 0;
+    uint32_t                 patch_points  = 0;
+    RasterizerStateDesc      rasterizer{};
+    DepthStencilStateDesc    depth_stencil{};
+    uint32_t                 color_count   = 0;
+    ColorAttachmentBlendDesc blend[k_max_color_attachments]{};
+};
+
+struct PipelineRecord {
+    std::atomic<PipelineStatus> status{PipelineStatus::Pending};
+
+    bool                       compute = false;
+    GLuint                     program = 0;
+    GLuint                     vertex_array = 0;  // shared, owned by PipelineContext::vertex_arrays
+    std::vector<PipelineStage> stages;            // dropped once linked
+    VertexInputLayout          vertex_input{};
+    GraphicsState              state{};
+    uint32_t                   local_size[3]{};
+    PipelineHandle             fallback{};
+    std::string                debug_name;
+    std::atomic<bool>          queued{false};
+};
+
+using PipelinePool = foundation::containers::SlotMap<
+    PipelineHandle,
+    std::shared_ptr<PipelineRecord>>;  // 0: record
+
+struct PipelineContext {
+    mutable std::shared_mutex pool_mutex;
+    PipelinePool              pool;
+
+    // Link queue, front first. `linked` wakes wait_pipelines() callers
+    // off the GL thread whenever the GL thread linked something.
+    std::mutex                                  queue_mutex;
+    std::condition_variable                     linked;
+    std::deque<std::shared_ptr<PipelineRecord>> queue;
+
+    // GL thread only. Vertex arrays by hash of their VertexInputLayout;
+    // specialised shader objects by module hash, stage and entry point.
+    std::unordered_map<uint64_t, GLuint> vertex_arrays;
+    std::unordered_map<uint64_t, GLuint> shaders;
+
+    std::atomic<uint64_t> links{0};
+};
+
+// -------------------------------------------------------------------------------------------------
+// Deferred releases
+//
+// Each entry carries the timeline value current when it was destroyed;
+// begin_frame() frees the entries the GPU has passed. Values are not
+// ordered across threads, so collection scans the whole list.
+// -------------------------------------------------------------------------------------------------
+struct DeferredContext {
+    std::mutex                                                    mutex;
+    std::vector<std::pair<uint64_t, BufferRow>>                   buffers;
+    std::vector<std::pair<uint64_t, TextureRow>>                  textures;
+    std::vector<std::pair<uint64_t, std::shared_ptr<PipelineRecord>>> pipelines;
+};
+
+} // namespace wren::rhi::opengl
+
+// -------------------------------------------------------------------------------------------------
+// Command list state
+//
+// Named CommandListState to match the forward declaration behind
+// wren::rhi::CommandListHandle. A list is a CPU command stream: fixed-size
+// GlCommand records plus a byte arena their variable-length arguments
+// (copy regions, attachments, push constant bytes, labels) point into.
+// Handles are resolved to GL names while recording, on the recording
+// thread, so replay on the GL thread does no pool lookups.
+// -------------------------------------------------------------------------------------------------
+namespace wren::rhi::opengl {
+
+/// CommandOp's values first, so packets translate with a cast.
+enum class GlOp : uint8_t {
+    Draw,
+    DrawIndexed,
+    Dispatch,
+    BindPipeline,
+    PushConstants,
+    SetViewport,
+    SetScissor,
+    BindVertexBuffer,
+    BindIndexBuffer,
+    SetDeviceMask,
+    Barrier,
+    CopyBuffer,
+    CopyBufferToTexture,
+    CopyTextureToBuffer,
+    BeginRendering,
+    EndRendering,
+    DrawIndirect,
+    DrawIndexedIndirect,
+    DispatchIndirect,
+    ExecuteLists,
+    BeginRegion,
+    EndRegion,
+};
+
+struct GlBufferRef {
+    GLuint   buffer = 0;
+    uint64_t offset = 0;
+};
+
+struct GlCommand {
+    GlOp      op         = GlOp::Draw;
+    uint8_t   binding    = 0;                  // BindVertexBuffer
+    IndexType index_type = IndexType::Uint32;  // BindIndexBuffer
+    uint32_t  payload    = 0;                  // byte offset of the arguments in CommandListState::data
+    uint32_t  count      = 0;                  // payload elements; bytes for PushConstants; bits for Barrier
+    union {
+        CommandPacket::DrawArgs        draw;
+        CommandPacket::DrawIndexedArgs draw_indexed;
+        CommandPacket::DispatchArgs    dispatch;
+        PipelineRecord*                pipeline;
+        Viewport                       viewport;
+        Scissor                        scissor;
+        GlBufferRef                    buffer;
+        uint32_t                       push_offset;
+    };
+
+    GlCommand() noexcept : draw{} {}
+};
+
+/// A copy's resolved endpoints, followed in the arena by its regions.
+struct GlCopyHeader {
+    GLuint   buffer         = 0;
+    GLuint   texture        = 0;    // buffer-buffer copies: the destination buffer
+    GLenum   target         = 0;
+    GLenum   format         = 0;
+    GLenum   type           = 0;
+    uint64_t buffer_size    = 0;
+};
+
+struct GlAttachment {
+    GLuint   texture = 0;
+    LoadOp   load    = LoadOp::Load;
+    StoreOp  store   = StoreOp::Store;
+    float    clear[4]{};
+};
+
+struct GlRenderingHeader {
+    uint32_t     color_count = 0;
+    GlAttachment colors[k_max_color_attachments]{};
+    GLuint       depth_stencil = 0;
+    bool         has_depth     = false;
+    bool         has_stencil   = false;
+    LoadOp       depth_load    = LoadOp::Load;
+    StoreOp      depth_store   = StoreOp::Store;
+    LoadOp       stencil_load  = LoadOp::DontCare;
+    StoreOp      stencil_store = StoreOp::DontCare;
+    float        clear_depth   = 1.0f;
+    uint32_t     clear_stencil = 0;
+    int32_t      x = 0, y = 0;
+    uint32_t     width = 0, height = 0;
+};
+
+struct GlIndirectHeader {
+    GLuint   args         = 0;
+    uint64_t args_offset  = 0;
+    uint32_t stride       = 0;
+    uint32_t max_count    = 1;
+    GLuint   count_buffer = 0;
+    uint64_t count_offset = 0;
+};
+
+} // namespace wren::rhi::opengl
+
+struct wren::rhi::CommandListState {
+    wren::rhi::opengl::GlDevice::Impl*        device    = nullptr;
+    wren::rhi::QueueType                      queue     = wren::rhi::QueueType::Graphics;
+    wren::rhi::CommandListLevel               level     = wren::rhi::CommandListLevel::Primary;
+    bool                                      recording = false;
+    std::vector<wren::rhi::opengl::GlCommand> commands;
+    std::vector<std::byte>                    data;
+    uint32_t                                  profile_depth = 0;
+};
+
+namespace wren::rhi::opengl {
+
+// -------------------------------------------------------------------------------------------------
+// Frames, submissions and the timeline
+//
+// Lists come from per-thread pools for each frame slot, bound to threads
+// by the same thread-local scheme as on Vulkan. Lists and their arenas
+// survive recycling, so steady-state frames allocate nothing.
+// -------------------------------------------------------------------------------------------------
+struct ThreadLists {
+    std::deque<CommandListState> lists;  // deque keeps addresses stable
+    uint32_t                     used = 0;
+};
+
+struct FrameLists {
+    // Allocated by each recording thread on its first list in this slot.
+    std::array<std::unique_ptr<ThreadLists>, k_max_recording_threads> threads;
+    // Timeline value when the slot last ended; begin_frame() waits for it.
+    uint64_t retire_value = 0;
+};
+
+struct PendingSubmission {
+    uint32_t first_list = 0;
+    uint32_t list_count = 0;
+    uint64_t value      = 0;
+};
+
+struct RetireFence {
+    GLsync   sync      = nullptr;
+    uint64_t value     = 0;  // timeline value of the last submission it covers
+    uint64_t ring_head = 0;  // stream ring head when it was inserted
+};
+
+struct CommandContext {
+    uint64_t serial           = 0;  // process-unique; keys the thread-local pool bindings
+    uint32_t frames_in_flight = 2;
+    uint32_t frame_slot       = 0;
+    uint64_t frame_number     = 0;
+    bool     in_frame         = false;
+
+    std::atomic<uint32_t>                          next_thread_slot{0};
+    std::array<FrameLists, k_max_frames_in_flight> frames;
+
+    // Guarded by pending_mutex. last_value is written under the lock only;
+    // atomic so destroy_*() can read it without taking it.
+    std::mutex                     pending_mutex;
+    std::atomic<uint64_t>          last_value{0};
+    std::vector<PendingSubmission> pending;
+    std::vector<CommandListState*> pending_lists;
+
+    // GL thread only. Fences in insertion order, and the swap targets that
+    // let replay run without holding pending_mutex.
+    std::deque<RetireFence>        fences;
+    std::vector<PendingSubmission> replay_batches;
+    std::vector<CommandListState*> replay_lists;
+
+    // Advanced by the GL thread as fences retire; waits off the GL thread
+    // sleep on `progress`.
+    std::atomic<uint64_t>           completed{0};
+    mutable std::mutex              progress_mutex;
+    mutable std::condition_variable progress;
+};
+
+// -------------------------------------------------------------------------------------------------
+// Replay state
+//
+// What the GL thread has bound, so replay can drop redundant calls, plus
+// the run of draws waiting to be issued as one multi-draw. The program,
+// vertex array, framebuffer and fixed-function shadows carry over between
+// flushes, since nothing else changes them; buffer bindings are forgotten
+// at the start of each flush, since a deleted buffer's name can come back.
+// -------------------------------------------------------------------------------------------------
+struct FixedFunctionState {
+    bool      cull         = false;
+    GLenum    cull_face    = GL_BACK;
+    GLenum    front_face   = GL_CCW;
+    GLenum    polygon_mode = GL_FILL;
+    bool      depth_clamp  = false;
+    bool      offset       = false;
+    float     offset_factor = 0.0f;
+    float     offset_units  = 0.0f;
+    float     offset_clamp  = 0.0f;
+    bool      depth_test   = false;
+    bool      depth_write  = true;
+    GLenum    depth_func   = GL_NEVER + 1;  // GL_LESS
+    bool      stencil      = false;
+    GLenum    stencil_func[2]{GL_NEVER + 7, GL_NEVER + 7};  // front, back; GL_ALWAYS
+    GLenum    stencil_op[2][3]{{GL_KEEP, GL_KEEP, GL_KEEP}, {GL_KEEP, GL_KEEP, GL_KEEP}};
+    GLint     stencil_ref  = 0;
+    GLuint    stencil_read  = 0xFF;
+    GLuint    stencil_write = 0xFF;
+    GLint     patch_points = 3;
+    ColorAttachmentBlendDesc blend[k_max_color_attachments]{};
+};
+
+struct ReplayState {
+    // Vulkan keeps a graphics and a compute pipeline bound side by side;
+    // `program` follows whichever the last draw or dispatch used. Null
+    // when nothing usable is bound, and draws or dispatches are dropped.
+    PipelineRecord* graphics     = nullptr;
+    PipelineRecord* compute      = nullptr;
+    GLuint          program      = 0;
+    GLuint          vertex_array = 0;
+
+    GlBufferRef vertex_buffers[k_max_vertex_bindings]{};
+    uint32_t    dirty_vertex_buffers = 0;  // bit per binding
+    GlBufferRef index_buffer{};
+    IndexType   index_type  = IndexType::Uint32;
+    bool        index_dirty = false;
+
+    std::byte push[k_max_push_constant_bytes]{};
+    bool      push_dirty = true;
+
+    GLuint                   draw_indirect_buffer = 0;
+    GLuint                   framebuffer          = 0;
+    GlRenderingHeader const* rendering            = nullptr;  // the open render pass
+
+    FixedFunctionState fixed{};
+    uint64_t           bindless_version = 0;
+
+    // Pending multi-draw run.
+    std::vector<DrawIndirectCommand>        run;
+    std::vector<DrawIndexedIndirectCommand> run_indexed_draws;
+};
+
+/// Attachments identifying one cached framebuffer object.
+struct FramebufferKey {
+    GLuint   colors[k_max_color_attachments]{};
+    GLuint   depth_stencil = 0;
+    uint32_t color_count   = 0;
+    bool     has_stencil   = false;
+
+    bool operator==(FramebufferKey const&) const = default;
+};
+
+struct FramebufferKeyHash {
+    [[nodiscard]] std::size_t operator()(FramebufferKey const& key) const noexcept;
+};
+
+// -------------------------------------------------------------------------------------------------
+// Impl
+// -------------------------------------------------------------------------------------------------
+struct GlDevice::Impl {
+    // Declared first so it is destroyed last, after every GL object below.
+    GlContext       context;
+    GlFunctions     gl{};
+    ContextInfo     info{};
+    Capabilities    capabilities{};
+    std::thread::id gl_thread;
+
+    // Pools take an exclusive lock to insert / erase and a shared lock for
+    // lookups, so handle resolution on recording threads never serialises.
+    mutable std::shared_mutex buffers_mutex;
+    BufferPool                buffers;
+    mutable std::shared_mutex textures_mutex;
+    TexturePool               textures;
+
+    // Memory accounting for memory_budget(); the driver figures are sampled
+    // by begin_frame() with NVX_gpu_memory_info / ATI_meminfo.
+    std::atomic<uint64_t> allocated_bytes{0};
+    std::atomic<uint64_t> driver_total_bytes{0};
+    std::atomic<uint64_t> driver_available_bytes{0};
+    std::atomic<uint32_t> readback_buffers{0};
+
+    BindlessContext     bindless;
+    StreamRing          stream;
+    ShaderModuleContext shaders;
+    PipelineContext     pipelines;
+    CommandContext      commands;
+    DeferredContext     deferred;
+
+    // GL thread only.
+    ReplayState                                                replay;
+    std::unordered_map<FramebufferKey, GLuint, FramebufferKeyHash> framebuffers;
+
+    Impl(GlContext ctx, GlFunctions const& functions, ContextInfo context_info, Capabilities caps)
+        : context{std::move(ctx)}
+        , gl{functions}
+        , info{std::move(context_info)}
+        , capabilities{std::move(caps)}
+        , gl_thread{std::this_thread::get_id()}
+    {}
+
+    /// Waits for the GPU, then deletes the pipelines, vertex arrays,
+    /// framebuffers, every deferred release and every resource still alive,
+    /// the heap tables and the stream ring (device.cpp).
+    ~Impl();
+
+    Impl(Impl const&)            = delete;
+    Impl& operator=(Impl const&) = delete;
+
+    [[nodiscard]] bool on_gl_thread() const noexcept { return std::this_thread::get_id() == gl_thread; }
+};
+
+// -------------------------------------------------------------------------------------------------
+// device.cpp
+// -------------------------------------------------------------------------------------------------
+
+/// Replays every queued submission and fences it. GL thread only.
+void flush_submissions(GlDevice::Impl& impl) noexcept;
+
+/// Retires the fences the GPU has passed, and waits up to @p timeout_ns for
+/// the ones below @p wait_value (0 just polls), replaying the submissions
+/// still queued first if the value is not fenced yet. Releases the stream
+/// ring behind each retired fence and wakes waiting threads. Status::Timeout
+/// when the value was not reached in time, InternalError when a wait
+/// failed. GL thread only.
+[[nodiscard]] Status retire_fences(GlDevice::Impl& impl, uint64_t wait_value, uint64_t timeout_ns) noexcept;
+
+// -------------------------------------------------------------------------------------------------
+// resources.cpp
+// -------------------------------------------------------------------------------------------------
+
+/// Creates the stream ring and sizes the heap tables, creating the handle
+/// tables with ARB_bindless_texture. Status::OutOfMemory when a mapping fails.
+[[nodiscard]] Status init_resources(GlDevice::Impl& impl) noexcept;
+
+/// Deletes every resource still alive, the heap tables and the stream ring.
+void release_resources(GlDevice::Impl& impl) noexcept;
+
+/// Frees the deferred releases at or below @p completed, every one when
+/// @p completed is UINT64_MAX. GL thread only.
+void collect_deferred(GlDevice::Impl& impl, uint64_t completed) noexcept;
+
+/// Reads the driver's memory counters into impl's atomics. GL thread only.
+void sample_memory_budget(GlDevice::Impl& impl) noexcept;
+
+/// Binds the heap tables, or the unit arrays, and the storage buffers if
+/// they changed since replay last bound them. GL thread only.
+void bind_bindless(GlDevice::Impl& impl) noexcept;
+
+/// Reserves @p size bytes of the stream ring, waiting for the oldest fence
+/// while it is full. Returns the offset, or nullopt when @p size exceeds
+/// the ring. GL thread only.
+[[nodiscard]] std::optional<uint64_t> stream_allocate(GlDevice::Impl& impl, uint64_t size,
+                                                      uint64_t alignment) noexcept;
+
+/// GL name of a live buffer; 0 for null or stale handles. Thread-safe.
+[[nodiscard]] GLuint resolve_buffer(GlDevice::Impl const& impl, BufferHandle handle,
+                                    uint64_t* size = nullptr) noexcept;
+
+/// Name, target and descriptor of a live texture; false for null or stale
+/// handles. Thread-safe.
+[[nodiscard]] bool resolve_texture(GlDevice::Impl const& impl, TextureHandle handle, GLuint& name,
+                                   GLenum& target, TextureDesc& desc) noexcept;
+
+// -------------------------------------------------------------------------------------------------
+// pipelines.cpp
+// -------------------------------------------------------------------------------------------------
+
+/// Links every queued pipeline. GL thread only.
+void link_queued_pipelines(GlDevice::Impl& impl) noexcept;
+
+/// Links @p record if it is still pending; returns whether it is Ready.
+/// GL thread only.
+bool ensure_linked(GlDevice::Impl& impl, PipelineRecord& record) noexcept;
+
+/// The record behind @p handle; null for a null or stale handle.
+[[nodiscard]] std::shared_ptr<PipelineRecord> find_pipeline(GlDevice::Impl const& impl,
+                                                            PipelineHandle handle) noexcept;
+
+/// Deletes a destroyed pipeline's program. GL thread only.
+void release_pipeline(GlDevice::Impl& impl, PipelineRecord& record) noexcept;
+
+/// Deletes every pipeline, vertex array and shader object.
+void release_pipelines(GlDevice::Impl& impl) noexcept;
+
+// -------------------------------------------------------------------------------------------------
+// commands.cpp
+// -------------------------------------------------------------------------------------------------
+
+/// Resets the replay state to what `gl` holds at the start of a flush.
+void begin_replay(GlDevice::Impl& impl) noexcept;
+
+/// Replays @p list, and the secondaries it executes, onto the context.
+void replay(GlDevice::Impl& impl, CommandListState const& list) noexcept;
+
+/// Issues the pending multi-draw run. Call before anything reads what
+/// the run's draws write.
+void end_replay(GlDevice::Impl& impl) noexcept;
+
+/// Deletes the cached framebuffers that attach @p texture, or every one
+/// for 0. GL thread only.
+void forget_framebuffers(GlDevice::Impl& impl, GLuint texture) noexcept;
+
+// -------------------------------------------------------------------------------------------------
+// Recording — implementations of the BackendVTable cmd_* entry points (commands.cpp).
+// -------------------------------------------------------------------------------------------------
+void cmd_barriers(CommandListState& list, std::span<TextureBarrier const> textures,
+                  std::span<BufferBarrier const> buffers) noexcept;
+void cmd_copy_buffer(CommandListState& list, BufferHandle src, BufferHandle dst,
+                     std::span<BufferCopy const> regions) noexcept;
+void cmd_copy_buffer_to_texture(CommandListState& list, BufferHandle src, TextureHandle dst,
+                                std::span<BufferTextureCopy const> regions) noexcept;
+void cmd_copy_texture_to_buffer(CommandListState& list, TextureHandle src, BufferHandle dst,
+                                std::span<BufferTextureCopy const> regions) noexcept;
+void cmd_begin_rendering(CommandListState& list, RenderingDesc const& desc) noexcept;
+void cmd_end_rendering(CommandListState& list) noexcept;
+void cmd_set_viewport(CommandListState& list, Viewport const& viewport) noexcept;
+void cmd_set_scissor(CommandListState& list, Scissor const& scissor) noexcept;
+void cmd_bind_pipeline(CommandListState& list, PipelineHandle pipeline) noexcept;
+void cmd_push_constants(CommandListState& list, uint32_t offset, uint32_t size, void const* data) noexcept;
+void cmd_bind_vertex_buffers(CommandListState& list, uint32_t first_binding,
+                             std::span<BufferHandle const> buffers,
+                             std::span<uint64_t const> offsets) noexcept;
+void cmd_bind_index_buffer(CommandListState& list, BufferHandle buffer, uint64_t offset,
+                           IndexType type) noexcept;
+void cmd_draw(CommandListState& list, uint32_t vertex_count, uint32_t instance_count,
+              uint32_t first_vertex, uint32_t first_instance) noexcept;
+void cmd_draw_indexed(CommandListState& list, uint32_t index_count, uint32_t instance_count,
+                      uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) noexcept;
+void cmd_dispatch(CommandListState& list, uint32_t x, uint32_t y, uint32_t z) noexcept;
+void cmd_draw_indirect(CommandListState& list, IndirectDrawDesc const& desc, bool indexed) noexcept;
+void cmd_dispatch_indirect(CommandListState& list, BufferHandle buffer, uint64_t offset) noexcept;
+void cmd_record_packets(CommandListState& list, std::span<CommandPacket const> packets) noexcept;
+void cmd_execute_command_lists(CommandListState& list,
+                               std::span<CommandListHandle const> secondaries) noexcept;
+void cmd_begin_profile_region(CommandListState& list, ProfileRegionDesc const& desc) noexcept;
+void cmd_end_profile_region(CommandListState& list) noexcept;
+
+} // namespace wren::rhi::opengl
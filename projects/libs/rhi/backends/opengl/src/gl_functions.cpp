@@ -0,0 +1,36 @@
+#include "gl_functions.hpp"
+
+#include <cstring>
+
+namespace wren::rhi::opengl {
+
+namespace {
+
+/// Casts a loaded proc to the member's type. GL entry points are looked up
+/// as void(*)() and called through their real signature, as every loader does.
+template<typename Fn>
+void assign(Fn& member, void (*proc)()) noexcept {
+    member = reinterpret_cast<Fn>(proc); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+} // anonymous namespace
+
+char const* load_functions(GlFunctions& gl, GlProcLoader loader) noexcept {
+    gl = {};
+
+#define WREN_GL_LOAD_REQUIRED(ret, name, params)  \
+    assign(gl.name, loader(#name));               \
+    if (!gl.name) return #name;
+    WREN_GL_REQUIRED_FUNCTIONS(WREN_GL_LOAD_REQUIRED)
+#undef WREN_GL_LOAD_REQUIRED
+
+#define WREN_GL_LOAD_OPTIONAL(ret, name, suffix, params)                  \
+    assign(gl.name, loader(#name));                                       \
+    if (!gl.name && std::strlen(#suffix) > 0) assign(gl.name, loader(#name #suffix));
+    WREN_GL_OPTIONAL_FUNCTIONS(WREN_GL_LOAD_OPTIONAL)
+#undef WREN_GL_LOAD_OPTIONAL
+
+    return nullptr;
+}
+
+} // namespace wren::rhi::opengl
@@ -0,0 +1,473 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// The OpenGL types, enums and entry points the backend uses, loaded through
+// the context's proc-address function (gl_functions.cpp). Every other
+// translation unit of the backend reaches GL through a GlFunctions table.
+
+#include <cstddef>
+#include <cstdint>
+
+#include <wren/foundation/system/platform.hpp>
+
+// -------------------------------------------------------------------------------------------------
+// Types
+//
+// The subset of glcorearb.h the backend needs. No system GL header is
+// included, so the backend builds without GL development packages and
+// cannot accidentally call an entry point it did not load.
+// -------------------------------------------------------------------------------------------------
+
+#if WREN_PLATFORM_WINDOWS_32
+#   define WREN_GL_APIENTRY __stdcall
+#else
+#   define WREN_GL_APIENTRY
+#endif
+
+namespace wren::rhi::opengl {
+
+using GLenum     = unsigned int;
+using GLboolean  = unsigned char;
+using GLbitfield = unsigned int;
+using GLint      = int;
+using GLuint     = unsigned int;
+using GLsizei    = int;
+using GLfloat    = float;
+using GLdouble   = double;
+using GLchar     = char;
+using GLubyte    = unsigned char;
+using GLint64    = int64_t;
+using GLuint64   = uint64_t;
+using GLintptr   = std::ptrdiff_t;
+using GLsizeiptr = std::ptrdiff_t;
+using GLsync     = struct __GLsync*;
+
+using GLDEBUGPROC = void(WREN_GL_APIENTRY*)(GLenum source, GLenum type, GLuint id, GLenum severity,
+                                            GLsizei length, GLchar const* message, void const* user);
+
+// -------------------------------------------------------------------------------------------------
+// Enums (values from the Khronos registry, gl.xml)
+// -------------------------------------------------------------------------------------------------
+
+// Errors
+inline constexpr GLenum GL_NO_ERROR      = 0;
+inline constexpr GLenum GL_OUT_OF_MEMORY = 0x0505;
+
+// Queries
+inline constexpr GLenum GL_VENDOR                                   = 0x1F00;
+inline constexpr GLenum GL_RENDERER                                 = 0x1F01;
+inline constexpr GLenum GL_VERSION                                  = 0x1F02;
+inline constexpr GLenum GL_EXTENSIONS                               = 0x1F03;
+inline constexpr GLenum GL_NUM_EXTENSIONS                           = 0x821D;
+inline constexpr GLenum GL_MAJOR_VERSION                            = 0x821B;
+inline constexpr GLenum GL_MINOR_VERSION                            = 0x821C;
+inline constexpr GLenum GL_MAX_TEXTURE_SIZE                         = 0x0D33;
+inline constexpr GLenum GL_MAX_3D_TEXTURE_SIZE                      = 0x8073;
+inline constexpr GLenum GL_MAX_CUBE_MAP_TEXTURE_SIZE                = 0x851C;
+inline constexpr GLenum GL_MAX_ARRAY_TEXTURE_LAYERS                 = 0x88FF;
+inline constexpr GLenum GL_MAX_TEXTURE_IMAGE_UNITS                  = 0x8872;
+inline constexpr GLenum GL_MAX_IMAGE_UNITS                          = 0x8F38;
+inline constexpr GLenum GL_MAX_FRAGMENT_IMAGE_UNIFORMS              = 0x90CE;
+inline constexpr GLenum GL_MAX_VERTEX_UNIFORM_BLOCKS                = 0x8A2B;
+inline constexpr GLenum GL_MAX_FRAGMENT_UNIFORM_BLOCKS              = 0x8A2D;
+inline constexpr GLenum GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS       = 0x90DA;
+inline constexpr GLenum GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS       = 0x90DD;
+inline constexpr GLenum GL_MAX_COLOR_ATTACHMENTS                    = 0x8CDF;
+inline constexpr GLenum GL_MAX_DRAW_BUFFERS                         = 0x8824;
+inline constexpr GLenum GL_MAX_VERTEX_ATTRIBS                       = 0x8869;
+inline constexpr GLenum GL_MAX_VERTEX_ATTRIB_BINDINGS               = 0x82DA;
+inline constexpr GLenum GL_MAX_SAMPLES                              = 0x8D57;
+inline constexpr GLenum GL_MAX_COLOR_TEXTURE_SAMPLES                = 0x910E;
+inline constexpr GLenum GL_MAX_DEPTH_TEXTURE_SAMPLES                = 0x910F;
+inline constexpr GLenum GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT          = 0x8A34;
+inline constexpr GLenum GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT   = 0x90DF;
+inline constexpr GLenum GL_MAX_COMPUTE_WORK_GROUP_SIZE              = 0x91BF;
+inline constexpr GLenum GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS       = 0x90EB;
+inline constexpr GLenum GL_MAX_TEXTURE_MAX_ANISOTROPY               = 0x84FF;
+inline constexpr GLenum GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX   = 0x9048;
+inline constexpr GLenum GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX = 0x9049;
+inline constexpr GLenum GL_VBO_FREE_MEMORY_ATI                      = 0x87FB;
+
+// Buffers
+inline constexpr GLenum     GL_ELEMENT_ARRAY_BUFFER   = 0x8893;
+inline constexpr GLenum     GL_UNIFORM_BUFFER         = 0x8A11;
+inline constexpr GLenum     GL_SHADER_STORAGE_BUFFER  = 0x90D2;
+inline constexpr GLenum     GL_DRAW_INDIRECT_BUFFER   = 0x8F3F;
+inline constexpr GLenum     GL_DISPATCH_INDIRECT_BUFFER = 0x90EE;
+inline constexpr GLenum     GL_PARAMETER_BUFFER       = 0x80EE;
+inline constexpr GLenum     GL_PIXEL_PACK_BUFFER      = 0x88EB;
+inline constexpr GLenum     GL_PIXEL_UNPACK_BUFFER    = 0x88EC;
+inline constexpr GLbitfield GL_MAP_READ_BIT           = 0x0001;
+inline constexpr GLbitfield GL_MAP_WRITE_BIT          = 0x0002;
+inline constexpr GLbitfield GL_MAP_PERSISTENT_BIT     = 0x0040;
+inline constexpr GLbitfield GL_MAP_COHERENT_BIT       = 0x0080;
+inline constexpr GLbitfield GL_DYNAMIC_STORAGE_BIT    = 0x0100;
+inline constexpr GLbitfield GL_CLIENT_STORAGE_BIT     = 0x0200;
+
+// Sync objects
+inline constexpr GLenum     GL_SYNC_GPU_COMMANDS_COMPLETE = 0x9117;
+inline constexpr GLbitfield GL_SYNC_FLUSH_COMMANDS_BIT    = 0x0001;
+inline constexpr GLenum     GL_ALREADY_SIGNALED           = 0x911A;
+inline constexpr GLenum     GL_TIMEOUT_EXPIRED            = 0x911B;
+inline constexpr GLenum     GL_CONDITION_SATISFIED        = 0x911C;
+inline constexpr GLenum     GL_WAIT_FAILED                = 0x911D;
+
+// glMemoryBarrier
+inline constexpr GLbitfield GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT  = 0x0001;
+inline constexpr GLbitfield GL_ELEMENT_ARRAY_BARRIER_BIT        = 0x0002;
+inline constexpr GLbitfield GL_UNIFORM_BARRIER_BIT              = 0x0004;
+inline constexpr GLbitfield GL_TEXTURE_FETCH_BARRIER_BIT        = 0x0008;
+inline constexpr GLbitfield GL_SHADER_IMAGE_ACCESS_BARRIER_BIT  = 0x0020;
+inline constexpr GLbitfield GL_COMMAND_BARRIER_BIT              = 0x0040;
+inline constexpr GLbitfield GL_PIXEL_BUFFER_BARRIER_BIT         = 0x0080;
+inline constexpr GLbitfield GL_TEXTURE_UPDATE_BARRIER_BIT       = 0x0100;
+inline constexpr GLbitfield GL_BUFFER_UPDATE_BARRIER_BIT        = 0x0200;
+inline constexpr GLbitfield GL_FRAMEBUFFER_BARRIER_BIT          = 0x0400;
+inline constexpr GLbitfield GL_SHADER_STORAGE_BARRIER_BIT       = 0x2000;
+inline constexpr GLbitfield GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT = 0x4000;
+
+// Textures
+inline constexpr GLenum GL_TEXTURE_1D                   = 0x0DE0;
+inline constexpr GLenum GL_TEXTURE_2D                   = 0x0DE1;
+inline constexpr GLenum GL_TEXTURE_3D                   = 0x806F;
+inline constexpr GLenum GL_TEXTURE_CUBE_MAP             = 0x8513;
+inline constexpr GLenum GL_TEXTURE_1D_ARRAY             = 0x8C18;
+inline constexpr GLenum GL_TEXTURE_2D_ARRAY             = 0x8C1A;
+inline constexpr GLenum GL_TEXTURE_CUBE_MAP_ARRAY       = 0x9009;
+inline constexpr GLenum GL_TEXTURE_2D_MULTISAMPLE       = 0x9100;
+inline constexpr GLenum GL_TEXTURE_2D_MULTISAMPLE_ARRAY = 0x9102;
+inline constexpr GLenum GL_TEXTURE_MAG_FILTER           = 0x2800;
+inline constexpr GLenum GL_TEXTURE_MIN_FILTER           = 0x2801;
+inline constexpr GLenum GL_TEXTURE_WRAP_S               = 0x2802;
+inline constexpr GLenum GL_TEXTURE_WRAP_T               = 0x2803;
+inline constexpr GLenum GL_TEXTURE_WRAP_R               = 0x8072;
+inline constexpr GLenum GL_TEXTURE_MAX_LEVEL            = 0x813D;
+inline constexpr GLenum GL_NEAREST                      = 0x2600;
+inline constexpr GLenum GL_LINEAR                       = 0x2601;
+inline constexpr GLenum GL_LINEAR_MIPMAP_LINEAR         = 0x2703;
+inline constexpr GLenum GL_REPEAT                       = 0x2901;
+inline constexpr GLenum GL_READ_WRITE                   = 0x88BA;
+
+// Internal formats
+inline constexpr GLenum GL_RGBA8                = 0x8058;
+inline constexpr GLenum GL_RGB10_A2             = 0x8059;
+inline constexpr GLenum GL_SRGB8_ALPHA8         = 0x8C43;
+inline constexpr GLenum GL_RG16F                = 0x822F;
+inline constexpr GLenum GL_RGBA16F              = 0x881A;
+inline constexpr GLenum GL_RGBA32F              = 0x8814;
+inline constexpr GLenum GL_R11F_G11F_B10F       = 0x8C3A;
+inline constexpr GLenum GL_DEPTH24_STENCIL8     = 0x88F0;
+inline constexpr GLenum GL_DEPTH_COMPONENT32F   = 0x8CAC;
+inline constexpr GLenum GL_DEPTH32F_STENCIL8    = 0x8CAD;
+
+// Pixel transfer formats and types
+inline constexpr GLenum GL_DEPTH_COMPONENT                 = 0x1902;
+inline constexpr GLenum GL_RGBA                            = 0x1908;
+inline constexpr GLenum GL_RG                              = 0x8227;
+inline constexpr GLenum GL_RGB                             = 0x1907;
+inline constexpr GLenum GL_BGRA                            = 0x80E1;
+inline constexpr GLenum GL_DEPTH_STENCIL                   = 0x84F9;
+inline constexpr GLenum GL_BYTE                            = 0x1400;
+inline constexpr GLenum GL_UNSIGNED_BYTE                   = 0x1401;
+inline constexpr GLenum GL_UNSIGNED_SHORT                  = 0x1403;
+inline constexpr GLenum GL_INT                             = 0x1404;
+inline constexpr GLenum GL_UNSIGNED_INT                    = 0x1405;
+inline constexpr GLenum GL_FLOAT                           = 0x1406;
+inline constexpr GLenum GL_HALF_FLOAT                      = 0x140B;
+inline constexpr GLenum GL_UNSIGNED_INT_2_10_10_10_REV     = 0x8368;
+inline constexpr GLenum GL_UNSIGNED_INT_10F_11F_11F_REV    = 0x8C3B;
+inline constexpr GLenum GL_UNSIGNED_INT_24_8               = 0x84FA;
+inline constexpr GLenum GL_FLOAT_32_UNSIGNED_INT_24_8_REV  = 0x8DAD;
+inline constexpr GLenum GL_UNPACK_ROW_LENGTH               = 0x0CF2;
+inline constexpr GLenum GL_UNPACK_IMAGE_HEIGHT             = 0x806E;
+inline constexpr GLenum GL_UNPACK_ALIGNMENT                = 0x0CF5;
+inline constexpr GLenum GL_PACK_ROW_LENGTH                 = 0x0D02;
+inline constexpr GLenum GL_PACK_IMAGE_HEIGHT               = 0x806C;
+inline constexpr GLenum GL_PACK_ALIGNMENT                  = 0x0D05;
+
+// Framebuffers
+inline constexpr GLenum GL_NONE                        = 0;
+inline constexpr GLenum GL_FRAMEBUFFER                 = 0x8D40;
+inline constexpr GLenum GL_COLOR_ATTACHMENT0           = 0x8CE0;
+inline constexpr GLenum GL_DEPTH_ATTACHMENT            = 0x8D00;
+inline constexpr GLenum GL_STENCIL_ATTACHMENT          = 0x8D20;
+inline constexpr GLenum GL_DEPTH_STENCIL_ATTACHMENT    = 0x821A;
+inline constexpr GLenum GL_FRAMEBUFFER_COMPLETE        = 0x8CD5;
+inline constexpr GLenum GL_COLOR                       = 0x1800;
+inline constexpr GLenum GL_DEPTH                       = 0x1801;
+inline constexpr GLenum GL_STENCIL                     = 0x1802;
+
+// Fixed-function state
+inline constexpr GLenum GL_CULL_FACE                   = 0x0B44;
+inline constexpr GLenum GL_DEPTH_TEST                  = 0x0B71;
+inline constexpr GLenum GL_STENCIL_TEST                = 0x0B90;
+inline constexpr GLenum GL_BLEND                       = 0x0BE2;
+inline constexpr GLenum GL_SCISSOR_TEST                = 0x0C11;
+inline constexpr GLenum GL_DEPTH_CLAMP                 = 0x864F;
+inline constexpr GLenum GL_POLYGON_OFFSET_FILL         = 0x8037;
+inline constexpr GLenum GL_POLYGON_OFFSET_LINE         = 0x2A02;
+inline constexpr GLenum GL_FRAMEBUFFER_SRGB            = 0x8DB9;
+inline constexpr GLenum GL_TEXTURE_CUBE_MAP_SEAMLESS   = 0x884F;
+inline constexpr GLenum GL_PRIMITIVE_RESTART_FIXED_INDEX = 0x8D69;
+inline constexpr GLenum GL_DEBUG_OUTPUT                = 0x92E0;
+inline constexpr GLenum GL_DEBUG_OUTPUT_SYNCHRONOUS    = 0x8242;
+inline constexpr GLenum GL_FRONT                       = 0x0404;
+inline constexpr GLenum GL_BACK                        = 0x0405;
+inline constexpr GLenum GL_FRONT_AND_BACK              = 0x0408;
+inline constexpr GLenum GL_CW                          = 0x0900;
+inline constexpr GLenum GL_CCW                         = 0x0901;
+inline constexpr GLenum GL_LINE                        = 0x1B01;
+inline constexpr GLenum GL_FILL                        = 0x1B02;
+inline constexpr GLenum GL_LOWER_LEFT                  = 0x8CA1;
+inline constexpr GLenum GL_ZERO_TO_ONE                 = 0x935F;
+inline constexpr GLenum GL_PATCH_VERTICES              = 0x8E72;
+
+// Comparison, stencil and blend
+inline constexpr GLenum GL_NEVER                    = 0x0200;  // + CompareOp, in API order
+inline constexpr GLenum GL_ZERO                     = 0;
+inline constexpr GLenum GL_ONE                      = 1;
+inline constexpr GLenum GL_KEEP                     = 0x1E00;
+inline constexpr GLenum GL_REPLACE                  = 0x1E01;
+inline constexpr GLenum GL_INCR                     = 0x1E02;
+inline constexpr GLenum GL_DECR                     = 0x1E03;
+inline constexpr GLenum GL_INVERT                   = 0x150A;
+inline constexpr GLenum GL_INCR_WRAP                = 0x8507;
+inline constexpr GLenum GL_DECR_WRAP                = 0x8508;
+inline constexpr GLenum GL_SRC_COLOR                = 0x0300;
+inline constexpr GLenum GL_ONE_MINUS_SRC_COLOR      = 0x0301;
+inline constexpr GLenum GL_SRC_ALPHA                = 0x0302;
+inline constexpr GLenum GL_ONE_MINUS_SRC_ALPHA      = 0x0303;
+inline constexpr GLenum GL_DST_ALPHA                = 0x0304;
+inline constexpr GLenum GL_ONE_MINUS_DST_ALPHA      = 0x0305;
+inline constexpr GLenum GL_DST_COLOR                = 0x0306;
+inline constexpr GLenum GL_ONE_MINUS_DST_COLOR      = 0x0307;
+inline constexpr GLenum GL_SRC_ALPHA_SATURATE       = 0x0308;
+inline constexpr GLenum GL_CONSTANT_COLOR           = 0x8001;
+inline constexpr GLenum GL_ONE_MINUS_CONSTANT_COLOR = 0x8002;
+inline constexpr GLenum GL_CONSTANT_ALPHA           = 0x8003;
+inline constexpr GLenum GL_ONE_MINUS_CONSTANT_ALPHA = 0x8004;
+inline constexpr GLenum GL_SRC1_ALPHA               = 0x8589;
+inline constexpr GLenum GL_SRC1_COLOR               = 0x88F9;
+inline constexpr GLenum GL_ONE_MINUS_SRC1_COLOR     = 0x88FA;
+inline constexpr GLenum GL_ONE_MINUS_SRC1_ALPHA     = 0x88FB;
+inline constexpr GLenum GL_FUNC_ADD                 = 0x8006;
+inline constexpr GLenum GL_MIN                      = 0x8007;
+inline constexpr GLenum GL_MAX                      = 0x8008;
+inline constexpr GLenum GL_FUNC_SUBTRACT            = 0x800A;
+inline constexpr GLenum GL_FUNC_REVERSE_SUBTRACT    = 0x800B;
+
+// Primitives
+inline constexpr GLenum GL_POINTS         = 0x0000;
+inline constexpr GLenum GL_LINES          = 0x0001;
+inline constexpr GLenum GL_LINE_STRIP     = 0x0003;
+inline constexpr GLenum GL_TRIANGLES      = 0x0004;
+inline constexpr GLenum GL_TRIANGLE_STRIP = 0x0005;
+inline constexpr GLenum GL_TRIANGLE_FAN   = 0x0006;
+inline constexpr GLenum GL_PATCHES        = 0x000E;
+
+// Shaders and programs
+inline constexpr GLenum GL_FRAGMENT_SHADER               = 0x8B30;
+inline constexpr GLenum GL_VERTEX_SHADER                 = 0x8B31;
+inline constexpr GLenum GL_GEOMETRY_SHADER               = 0x8DD9;
+inline constexpr GLenum GL_TESS_EVALUATION_SHADER        = 0x8E87;
+inline constexpr GLenum GL_TESS_CONTROL_SHADER           = 0x8E88;
+inline constexpr GLenum GL_COMPUTE_SHADER                = 0x91B9;
+inline constexpr GLenum GL_SHADER_BINARY_FORMAT_SPIR_V   = 0x9551;
+inline constexpr GLenum GL_COMPILE_STATUS                = 0x8B81;
+inline constexpr GLenum GL_LINK_STATUS                   = 0x8B82;
+inline constexpr GLenum GL_INFO_LOG_LENGTH               = 0x8B84;
+
+// Debug output and labels
+inline constexpr GLenum GL_DEBUG_SOURCE_APPLICATION      = 0x824A;
+inline constexpr GLenum GL_DEBUG_TYPE_ERROR              = 0x824C;
+inline constexpr GLenum GL_DEBUG_SEVERITY_HIGH           = 0x9146;
+inline constexpr GLenum GL_DEBUG_SEVERITY_MEDIUM         = 0x9147;
+inline constexpr GLenum GL_DEBUG_SEVERITY_LOW            = 0x9148;
+inline constexpr GLenum GL_DEBUG_SEVERITY_NOTIFICATION   = 0x826B;
+inline constexpr GLenum GL_BUFFER                        = 0x82E0;
+inline constexpr GLenum GL_PROGRAM                       = 0x82E2;
+inline constexpr GLenum GL_TEXTURE                       = 0x1702;
+
+// -------------------------------------------------------------------------------------------------
+// Entry points
+//
+// X(return type, name, parameter list). The members of GlFunctions keep the
+// GL names so call sites read like GL: `gl.glNamedBufferStorage(...)`.
+//
+// Required entry points are core in GL 4.5, the backend's minimum; device
+// creation fails if one is missing. Optional ones come from GL 4.6 or an
+// extension and are null when absent; each has the extension suffix it is
+// also loaded under.
+// -------------------------------------------------------------------------------------------------
+
+#define WREN_GL_REQUIRED_FUNCTIONS(X)                                                                         \
+    X(GLenum, glGetError, (void))                                                                              \
+    X(void, glGetIntegerv, (GLenum pname, GLint* data))                                                        \
+    X(void, glGetInteger64v, (GLenum pname, GLint64* data))                                                    \
+    X(void, glGetIntegeri_v, (GLenum target, GLuint index, GLint* data))                                       \
+    X(void, glGetFloatv, (GLenum pname, GLfloat* data))                                                        \
+    X(GLubyte const*, glGetString, (GLenum name))                                                              \
+    X(GLubyte const*, glGetStringi, (GLenum name, GLuint index))                                               \
+    X(void, glEnable, (GLenum cap))                                                                            \
+    X(void, glDisable, (GLenum cap))                                                                           \
+    X(void, glEnablei, (GLenum cap, GLuint index))                                                             \
+    X(void, glDisablei, (GLenum cap, GLuint index))                                                            \
+    X(void, glFlush, (void))                                                                                   \
+    X(void, glFinish, (void))                                                                                  \
+    X(void, glClipControl, (GLenum origin, GLenum depth))                                                      \
+    X(void, glPixelStorei, (GLenum pname, GLint param))                                                        \
+    /* Buffers */                                                                                              \
+    X(void, glCreateBuffers, (GLsizei n, GLuint* buffers))                                                     \
+    X(void, glDeleteBuffers, (GLsizei n, GLuint const* buffers))                                               \
+    X(void, glNamedBufferStorage, (GLuint buffer, GLsizeiptr size, void const* data, GLbitfield flags))        \
+    X(void*, glMapNamedBufferRange, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access))    \
+    X(GLboolean, glUnmapNamedBuffer, (GLuint buffer))                                                          \
+    X(void, glCopyNamedBufferSubData,                                                                          \
+      (GLuint read, GLuint write, GLintptr read_offset, GLintptr write_offset, GLsizeiptr size))               \
+    X(void, glBindBuffer, (GLenum target, GLuint buffer))                                                      \
+    X(void, glBindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)) \
+    X(void, glBindBuffersBase, (GLenum target, GLuint first, GLsizei count, GLuint const* buffers))            \
+    /* Textures */                                                                                             \
+    X(void, glCreateTextures, (GLenum target, GLsizei n, GLuint* textures))                                    \
+    X(void, glDeleteTextures, (GLsizei n, GLuint const* textures))                                             \
+    X(void, glTextureStorage1D, (GLuint texture, GLsizei levels, GLenum format, GLsizei width))                \
+    X(void, glTextureStorage2D, (GLuint texture, GLsizei levels, GLenum format, GLsizei width, GLsizei height)) \
+    X(void, glTextureStorage3D,                                                                                \
+      (GLuint texture, GLsizei levels, GLenum format, GLsizei width, GLsizei height, GLsizei depth))           \
+    X(void, glTextureStorage2DMultisample,                                                                     \
+      (GLuint texture, GLsizei samples, GLenum format, GLsizei width, GLsizei height, GLboolean fixed))        \
+    X(void, glTextureStorage3DMultisample,                                                                     \
+      (GLuint texture, GLsizei samples, GLenum format, GLsizei width, GLsizei height, GLsizei depth,           \
+       GLboolean fixed))                                                                                       \
+    X(void, glTextureParameteri, (GLuint texture, GLenum pname, GLint param))                                  \
+    X(void, glTextureSubImage1D,                                                                               \
+      (GLuint texture, GLint level, GLint x, GLsizei width, GLenum format, GLenum type, void const* pixels))   \
+    X(void, glTextureSubImage2D,                                                                               \
+      (GLuint texture, GLint level, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format,            \
+       GLenum type, void const* pixels))                                                                       \
+    X(void, glTextureSubImage3D,                                                                               \
+      (GLuint texture, GLint level, GLint x, GLint y, GLint z, GLsizei width, GLsizei height, GLsizei depth,   \
+       GLenum format, GLenum type, void const* pixels))                                                        \
+    X(void, glGetTextureSubImage,                                                                              \
+      (GLuint texture, GLint level, GLint x, GLint y, GLint z, GLsizei width, GLsizei height, GLsizei depth,   \
+       GLenum format, GLenum type, GLsizei size, void* pixels))                                                \
+    X(void, glBindTextures, (GLuint first, GLsizei count, GLuint const* textures))                             \
+    X(void, glBindImageTextures, (GLuint first, GLsizei count, GLuint const* textures))                        \
+    /* Framebuffers */                                                                                         \
+    X(void, glCreateFramebuffers, (GLsizei n, GLuint* framebuffers))                                           \
+    X(void, glDeleteFramebuffers, (GLsizei n, GLuint const* framebuffers))                                     \
+    X(void, glNamedFramebufferTexture, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level))   \
+    X(void, glNamedFramebufferDrawBuffers, (GLuint framebuffer, GLsizei n, GLenum const* buffers))             \
+    X(GLenum, glCheckNamedFramebufferStatus, (GLuint framebuffer, GLenum target))                              \
+    X(void, glBindFramebuffer, (GLenum target, GLuint framebuffer))                                            \
+    X(void, glClearNamedFramebufferfv, (GLuint framebuffer, GLenum buffer, GLint draw_buffer, GLfloat const* v)) \
+    X(void, glClearNamedFramebufferiv, (GLuint framebuffer, GLenum buffer, GLint draw_buffer, GLint const* v)) \
+    X(void, glClearNamedFramebufferfi,                                                                         \
+      (GLuint framebuffer, GLenum buffer, GLint draw_buffer, GLfloat depth, GLint stencil))                    \
+    X(void, glInvalidateNamedFramebufferData, (GLuint framebuffer, GLsizei n, GLenum const* attachments))      \
+    /* Vertex arrays */                                                                                        \
+    X(void, glCreateVertexArrays, (GLsizei n, GLuint* arrays))                                                 \
+    X(void, glDeleteVertexArrays, (GLsizei n, GLuint const* arrays))                                           \
+    X(void, glBindVertexArray, (GLuint array))                                                                 \
+    X(void, glEnableVertexArrayAttrib, (GLuint vao, GLuint index))                                             \
+    X(void, glVertexArrayAttribFormat,                                                                         \
+      (GLuint vao, GLuint index, GLint size, GLenum type, GLboolean normalized, GLuint offset))                \
+    X(void, glVertexArrayAttribIFormat, (GLuint vao, GLuint index, GLint size, GLenum type, GLuint offset))    \
+    X(void, glVertexArrayAttribBinding, (GLuint vao, GLuint index, GLuint binding))                            \
+    X(void, glVertexArrayBindingDivisor, (GLuint vao, GLuint binding, GLuint divisor))                         \
+    X(void, glVertexArrayVertexBuffer, (GLuint vao, GLuint binding, GLuint buffer, GLintptr offset, GLsizei stride)) \
+    X(void, glVertexArrayElementBuffer, (GLuint vao, GLuint buffer))                                           \
+    /* Shaders and programs */                                                                                 \
+    X(GLuint, glCreateShader, (GLenum type))                                                                   \
+    X(void, glDeleteShader, (GLuint shader))                                                                   \
+    X(void, glShaderBinary,                                                                                    \
+      (GLsizei count, GLuint const* shaders, GLenum format, void const* binary, GLsizei length))               \
+    X(void, glGetShaderiv, (GLuint shader, GLenum pname, GLint* params))                                       \
+    X(void, glGetShaderInfoLog, (GLuint shader, GLsizei size, GLsizei* length, GLchar* log))                   \
+    X(GLuint, glCreateProgram, (void))                                                                         \
+    X(void, glDeleteProgram, (GLuint program))                                                                 \
+    X(void, glAttachShader, (GLuint program, GLuint shader))                                                   \
+    X(void, glDetachShader, (GLuint program, GLuint shader))                                                   \
+    X(void, glLinkProgram, (GLuint program))                                                                   \
+    X(void, glGetProgramiv, (GLuint program, GLenum pname, GLint* params))                                     \
+    X(void, glGetProgramInfoLog, (GLuint program, GLsizei size, GLsizei* length, GLchar* log))                 \
+    X(void, glUseProgram, (GLuint program))                                                                    \
+    /* Rasterizer, depth-stencil and blend state */                                                            \
+    X(void, glViewportIndexedf, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h))                    \
+    X(void, glDepthRangeIndexed, (GLuint index, GLdouble n, GLdouble f))                                       \
+    X(void, glScissorIndexed, (GLuint index, GLint x, GLint y, GLsizei width, GLsizei height))                 \
+    X(void, glFrontFace, (GLenum mode))                                                                        \
+    X(void, glCullFace, (GLenum mode))                                                                         \
+    X(void, glPolygonMode, (GLenum face, GLenum mode))                                                         \
+    X(void, glPolygonOffset, (GLfloat factor, GLfloat units))                                                  \
+    X(void, glDepthFunc, (GLenum func))                                                                        \
+    X(void, glDepthMask, (GLboolean flag))                                                                     \
+    X(void, glStencilFuncSeparate, (GLenum face, GLenum func, GLint ref, GLuint mask))                         \
+    X(void, glStencilOpSeparate, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass))                    \
+    X(void, glStencilMaskSeparate, (GLenum face, GLuint mask))                                                 \
+    X(void, glBlendFuncSeparatei, (GLuint buf, GLenum src_rgb, GLenum dst_rgb, GLenum src_a, GLenum dst_a))    \
+    X(void, glBlendEquationSeparatei, (GLuint buf, GLenum mode_rgb, GLenum mode_alpha))                        \
+    X(void, glColorMaski, (GLuint buf, GLboolean r, GLboolean g, GLboolean b, GLboolean a))                    \
+    X(void, glPatchParameteri, (GLenum pname, GLint value))                                                    \
+    /* Draws and dispatches */                                                                                 \
+    X(void, glDrawArraysInstancedBaseInstance,                                                                 \
+      (GLenum mode, GLint first, GLsizei count, GLsizei instances, GLuint base_instance))                      \
+    X(void, glDrawElementsInstancedBaseVertexBaseInstance,                                                     \
+      (GLenum mode, GLsizei count, GLenum type, void const* indices, GLsizei instances, GLint base_vertex,     \
+       GLuint base_instance))                                                                                  \
+    X(void, glMultiDrawArraysIndirect, (GLenum mode, void const* indirect, GLsizei count, GLsizei stride))     \
+    X(void, glMultiDrawElementsIndirect,                                                                       \
+      (GLenum mode, GLenum type, void const* indirect, GLsizei count, GLsizei stride))                         \
+    X(void, glDispatchCompute, (GLuint x, GLuint y, GLuint z))                                                 \
+    X(void, glDispatchComputeIndirect, (GLintptr indirect))                                                    \
+    X(void, glMemoryBarrier, (GLbitfield barriers))                                                            \
+    /* Sync objects */                                                                                         \
+    X(GLsync, glFenceSync, (GLenum condition, GLbitfield flags))                                               \
+    X(GLenum, glClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout))                             \
+    X(void, glDeleteSync, (GLsync sync))                                                                       \
+    /* Debug output and labels (KHR_debug, core 4.3) */                                                        \
+    X(void, glDebugMessageCallback, (GLDEBUGPROC callback, void const* user))                                  \
+    X(void, glPushDebugGroup, (GLenum source, GLuint id, GLsizei length, GLchar const* message))               \
+    X(void, glPopDebugGroup, (void))                                                                           \
+    X(void, glObjectLabel, (GLenum identifier, GLuint name, GLsizei length, GLchar const* label))
+
+#define WREN_GL_OPTIONAL_FUNCTIONS(X)                                                                         \
+    /* GL 4.6 / ARB_gl_spirv */                                                                                \
+    X(void, glSpecializeShader, ARB,                                                                           \
+      (GLuint shader, GLchar const* entry, GLuint count, GLuint const* indices, GLuint const* values))         \
+    /* GL 4.6 / ARB_indirect_parameters */                                                                     \
+    X(void, glMultiDrawArraysIndirectCount, ARB,                                                               \
+      (GLenum mode, void const* indirect, GLintptr count_offset, GLsizei max_count, GLsizei stride))           \
+    X(void, glMultiDrawElementsIndirectCount, ARB,                                                             \
+      (GLenum mode, GLenum type, void const* indirect, GLintptr count_offset, GLsizei max_count,               \
+       GLsizei stride))                                                                                        \
+    /* GL 4.6 / EXT_polygon_offset_clamp */                                                                    \
+    X(void, glPolygonOffsetClamp, EXT, (GLfloat factor, GLfloat units, GLfloat clamp))                         \
+    /* ARB_bindless_texture (the core name carries the suffix already) */                                      \
+    X(GLuint64, glGetTextureHandleARB, , (GLuint texture))                                                     \
+    X(GLuint64, glGetImageHandleARB, ,                                                                         \
+      (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format))                            \
+    X(void, glMakeTextureHandleResidentARB, , (GLuint64 handle))                                               \
+    X(void, glMakeTextureHandleNonResidentARB, , (GLuint64 handle))                                            \
+    X(void, glMakeImageHandleResidentARB, , (GLuint64 handle, GLenum access))                                  \
+    X(void, glMakeImageHandleNonResidentARB, , (GLuint64 handle))
+
+struct GlFunctions {
+#define WREN_GL_DECLARE_REQUIRED(ret, name, params) ret(WREN_GL_APIENTRY* name) params = nullptr;
+#define WREN_GL_DECLARE_OPTIONAL(ret, name, suffix, params) ret(WREN_GL_APIENTRY* name) params = nullptr;
+    WREN_GL_REQUIRED_FUNCTIONS(WREN_GL_DECLARE_REQUIRED)
+    WREN_GL_OPTIONAL_FUNCTIONS(WREN_GL_DECLARE_OPTIONAL)
+#undef WREN_GL_DECLARE_REQUIRED
+#undef WREN_GL_DECLARE_OPTIONAL
+};
+
+/// The context's proc-address function, e.g. glfwGetProcAddress.
+using GlProcLoader = void (*(*)(char const* name))();
+
+/// Loads every entry point of @p gl for the current context. Optional ones
+/// fall back to their extension-suffixed name. Returns the name of the
+/// first required entry point the driver lacks, or nullptr when all of
+/// them were found.
+[[nodiscard]] char const* load_functions(GlFunctions& gl, GlProcLoader loader) noexcept;
+
+} // namespace wren::rhi::opengl
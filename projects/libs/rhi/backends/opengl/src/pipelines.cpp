@@ -0,0 +1,772 @@
+#include "gl_device.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include <wren/rhi/api/state_hash.hpp>
+
+#include "gl_convert.hpp"
+#include "gl_device_impl.hpp"
+
+namespace wren::rhi::opengl {
+
+namespace {
+
+// Vertex, two tessellation stages, geometry, fragment.
+constexpr uint32_t k_max_graphics_stages = 5;
+
+constexpr ShaderStage k_graphics_stages = ShaderStage::Vertex | ShaderStage::TessControl |
+                                          ShaderStage::TessEval | ShaderStage::Geometry |
+                                          ShaderStage::Fragment | ShaderStage::Task |
+                                          ShaderStage::Mesh;
+
+[[nodiscard]] constexpr bool has(ShaderStage set, ShaderStage bits) noexcept {
+    return underlying(set & bits) != 0;
+}
+
+[[nodiscard]] constexpr GLenum shader_type(ShaderStage stage) noexcept {
+    switch (stage) {
+        case ShaderStage::Vertex:      return GL_VERTEX_SHADER;
+        case ShaderStage::TessControl: return GL_TESS_CONTROL_SHADER;
+        case ShaderStage::TessEval:    return GL_TESS_EVALUATION_SHADER;
+        case ShaderStage::Geometry:    return GL_GEOMETRY_SHADER;
+        case ShaderStage::Fragment:    return GL_FRAGMENT_SHADER;
+        case ShaderStage::Compute:     return GL_COMPUTE_SHADER;
+        default:                       return 0;
+    }
+}
+
+// -----------------------------------------------------------------
+// SPIR-V — only what linking needs: the entry points, for validation
+// and glSpecializeShader, and the compute workgroup sizes.
+// -----------------------------------------------------------------
+constexpr uint32_t k_spirv_magic          = 0x07230203;
+constexpr uint32_t k_op_entry_point       = 15;
+constexpr uint32_t k_op_execution_mode    = 16;
+constexpr uint32_t k_op_function          = 54;
+constexpr uint32_t k_execution_local_size = 17;
+
+[[nodiscard]] constexpr ShaderStage execution_model_stage(uint32_t model) noexcept {
+    switch (model) {
+        case 0:    return ShaderStage::Vertex;
+        case 1:    return ShaderStage::TessControl;
+        case 2:    return ShaderStage::TessEval;
+        case 3:    return ShaderStage::Geometry;
+        case 4:    return ShaderStage::Fragment;
+        case 5:    return ShaderStage::Compute;
+        case 5267: // TaskNV
+        case 5364: return ShaderStage::Task;
+        case 5268: // MeshNV
+        case 5365: return ShaderStage::Mesh;
+        default:   return ShaderStage::None;
+    }
+}
+
+/// Fills the entry points of @p out from @p code; Status::InvalidArgument
+/// when @p code is not well-formed SPIR-V.
+[[nodiscard]] Status reflect_entry_points(std::span<uint32_t const> code, ShaderReflection& out) noexcept {
+    if (code.size() < 5 || code[0] != k_spirv_magic)
+        return Status::InvalidArgument;
+
+    uint32_t ids[k_max_shader_entry_points]{};
+    for (std::size_t i = 5; i < code.size();) {
+        uint32_t const count = code[i] >> 16;
+        uint32_t const op    = code[i] & 0xffffu;
+        if (count == 0 || i + count > code.size())
+            return Status::InvalidArgument;
+        // Entry points and execution modes precede every function.
+        if (op == k_op_function)
+            break;
+
+        if (op == k_op_entry_point && count >= 4) {
+            ShaderStage const stage = execution_model_stage(code[i + 1]);
+            out.stages |= stage;
+            if (stage != ShaderStage::None && out.entryPointCount < k_max_shader_entry_points) {
+                ShaderEntryPoint& e = out.entryPoints[out.entryPointCount];
+                ids[out.entryPointCount++] = code[i + 2];
+                e.stage = stage;
+
+                // A literal string: UTF-8 packed low byte first, NUL-terminated.
+                std::size_t const bytes = (count - 3) * sizeof(uint32_t);
+                char const* name = reinterpret_cast<char const*>(code.data() + i + 3);
+                auto const length = std::min(static_cast<std::size_t>(std::find(name, name + bytes, '\0') - name),
+                                             std::size_t{k_max_entry_point_name_size - 1});
+                std::memcpy(e.name, name, length);
+                e.name[length] = '\0';
+            }
+        } else if (op == k_op_execution_mode && count >= 6 && code[i + 2] == k_execution_local_size) {
+            for (uint32_t e = 0; e < out.entryPointCount; ++e) {
+                if (ids[e] == code[i + 1])
+                    std::copy_n(code.data() + i + 3, 3, out.entryPoints[e].localSize);
+            }
+        }
+        i += count;
+    }
+    return Status::Ok;
+}
+
+// -----------------------------------------------------------------
+// Shader module cache
+// -----------------------------------------------------------------
+
+/// The record for @p code: a live one with equal code, or a new one that is
+/// published for later lookups.
+[[nodiscard]] auto intern_shader_module(GlDevice::Impl& impl, void const* code, std::size_t size) noexcept
+    -> std::expected<std::shared_ptr<ShaderModuleRecord const>, Status>
+{
+    if (!code || size == 0 || size % sizeof(uint32_t) != 0)
+        return std::unexpected{Status::InvalidArgument};
+
+    auto& ctx = impl.shaders;
+    try {
+        auto record = std::make_shared<ShaderModuleRecord>();
+        record->code.resize(size / sizeof(uint32_t));
+        std::memcpy(record->code.data(), code, size);
+
+        StateHasher h;
+        for (uint32_t word : record->code)
+            h.add(word);
+        record->reflection.hash = h.value();
+
+        // Compared word for word, so a hash collision only costs a miss.
+        auto const same = [&record](ShaderModuleRecord const& existing) {
+            return existing.code == record->code;
+        };
+        {
+            std::lock_guard lock{ctx.mutex};
+            if (auto it = ctx.by_hash.find(record->reflection.hash); it != ctx.by_hash.end()) {
+                if (auto existing = it->second.lock(); existing && same(*existing)) {
+                    ctx.hits.fetch_add(1, std::memory_order_relaxed);
+                    return existing;
+                }
+            }
+        }
+
+        if (Status s = reflect_entry_points(record->code, record->reflection); s != Status::Ok)
+            return std::unexpected{s};
+
+        std::lock_guard lock{ctx.mutex};
+        auto& slot = ctx.by_hash[record->reflection.hash];
+        if (auto existing = slot.lock(); existing && same(*existing)) {
+            ctx.hits.fetch_add(1, std::memory_order_relaxed);
+            return existing;
+        }
+        slot = record;
+        if (ctx.by_hash.size() >= ctx.sweep_at) {
+            std::erase_if(ctx.by_hash, [](auto const& entry) { return entry.second.expired(); });
+            ctx.sweep_at = std::max<std::size_t>(64, ctx.by_hash.size() * 2);
+        }
+        ctx.bytes.fetch_add(size, std::memory_order_relaxed);
+        return std::shared_ptr<ShaderModuleRecord const>{std::move(record)};
+    } catch (std::bad_alloc const&) {
+        return std::unexpected{Status::OutOfMemory};
+    }
+}
+
+[[nodiscard]] std::shared_ptr<ShaderModuleRecord const> find_shader_module(ShaderModuleContext const& ctx,
+                                                                           ShaderModuleHandle handle) noexcept
+{
+    std::shared_lock lock{ctx.pool_mutex};
+    auto const* record = ctx.pool.get<0>(handle);
+    return record ? *record : nullptr;
+}
+
+// -----------------------------------------------------------------
+// Validation — as on Vulkan, everything the driver would reject or the
+// device lacks is caught on the creating thread.
+// -----------------------------------------------------------------
+[[nodiscard]] Status validate_shader(ShaderStageDesc const& shader) noexcept {
+    if (!shader.entryPoint)
+        return Status::InvalidArgument;
+    if (!shader.module && (!shader.code || shader.codeSize == 0 || shader.codeSize % 4 != 0))
+        return Status::InvalidArgument;
+    return Status::Ok;
+}
+
+[[nodiscard]] Status validate(Capabilities const& caps, GraphicsPipelineDesc const& desc) noexcept {
+    if (!desc.shaders || desc.shaderCount == 0 || desc.shaderCount > k_max_graphics_stages)
+        return Status::InvalidArgument;
+
+    ShaderStage stages = ShaderStage::None;
+    for (uint32_t i = 0; i < desc.shaderCount; ++i) {
+        ShaderStage const stage = desc.shaders[i].stage;
+        if (std::popcount(underlying(stage)) != 1 || !has(k_graphics_stages, stage) || has(stages, stage))
+            return Status::InvalidArgument;
+        if (Status s = validate_shader(desc.shaders[i]); s != Status::Ok)
+            return s;
+        stages |= stage;
+    }
+
+    // GL has no task or mesh stages through SPIR-V.
+    if (has(stages, ShaderStage::Task | ShaderStage::Mesh))
+        return Status::MissingRequiredFeature;
+    bool const tess = has(stages, ShaderStage::TessControl | ShaderStage::TessEval);
+    if (!has(stages, ShaderStage::Vertex))
+        return Status::InvalidArgument;
+    if (tess && !(has(stages, ShaderStage::TessControl) && has(stages, ShaderStage::TessEval)))
+        return Status::InvalidArgument;
+    if (tess != (desc.topology == PrimitiveTopology::PatchList) || (tess && desc.patchControlPoints == 0))
+        return Status::InvalidArgument;
+
+    auto const& vi = desc.vertexInput;
+    auto const& rt = desc.renderTargets;
+    if (vi.bindingCount > k_max_vertex_bindings || vi.attributeCount > k_max_vertex_attributes ||
+        rt.colorFormatCount > k_max_color_attachments)
+        return Status::InvalidArgument;
+    for (uint32_t i = 0; i < vi.bindingCount; ++i) {
+        if (vi.bindings[i].binding >= k_max_vertex_bindings)
+            return Status::InvalidArgument;
+    }
+    if (static_cast<uint32_t>(rt.samples) > caps.limits.maxMSAASamples)
+        return Status::UnsupportedSampleCount;
+
+    bool dual_source = false;
+    for (uint32_t i = 0; i < rt.colorFormatCount; ++i) {
+        auto const& b = desc.blend.attachments[i];
+        for (BlendFactor f : {b.srcColor, b.dstColor, b.srcAlpha, b.dstAlpha})
+            dual_source |= f >= BlendFactor::Src1Color;
+    }
+
+    auto const missing = [&caps](Feature feature) { return !has_all(caps.features, feature); };
+    if ((tess && missing(Feature::Tessellation)) ||
+        (has(stages, ShaderStage::Geometry) && missing(Feature::GeometryShader)) ||
+        (desc.rasterizer.fillMode == FillMode::Wireframe && missing(Feature::NonSolidFill)) ||
+        (desc.rasterizer.depthClamp && missing(Feature::DepthClamp)) ||
+        (dual_source && missing(Feature::DualSourceBlending)))
+        return Status::MissingRequiredFeature;
+    return Status::Ok;
+}
+
+[[nodiscard]] Status validate(Capabilities const& /*caps*/, ComputePipelineDesc const& desc) noexcept {
+    if (desc.shader.stage != ShaderStage::Compute)
+        return Status::InvalidArgument;
+    return validate_shader(desc.shader);
+}
+
+// -----------------------------------------------------------------
+// Records
+// -----------------------------------------------------------------
+
+/// The module of @p shader, checked to declare its entry point. May throw
+/// std::bad_alloc.
+[[nodiscard]] auto make_stage(GlDevice::Impl& impl, ShaderStageDesc const& shader)
+    -> std::expected<PipelineStage, Status>
+{
+    std::shared_ptr<ShaderModuleRecord const> module;
+    if (shader.module) {
+        module = find_shader_module(impl.shaders, shader.module);
+        if (!module)
+            return std::unexpected{Status::InvalidArgument};
+    } else {
+        auto interned = intern_shader_module(impl, shader.code, shader.codeSize);
+        if (!interned)
+            return std::unexpected{interned.error()};
+        module = std::move(*interned);
+    }
+
+    auto const& reflection = module->reflection;
+    auto const* const begin = reflection.entryPoints;
+    auto const* const end   = begin + reflection.entryPointCount;
+    bool const found = std::any_of(begin, end, [&shader](ShaderEntryPoint const& e) {
+        return e.stage == shader.stage && std::strcmp(e.name, shader.entryPoint) == 0;
+    });
+    // Past k_max_shader_entry_points the entry point may just not be listed.
+    if (!found && reflection.entryPointCount < k_max_shader_entry_points)
+        return std::unexpected{Status::InvalidArgument};
+
+    return PipelineStage{shader_type(shader.stage), std::move(module), shader.entryPoint};
+}
+
+[[nodiscard]] auto make_record(GlDevice::Impl& impl, GraphicsPipelineDesc const& desc)
+    -> std::expected<std::shared_ptr<PipelineRecord>, Status>
+{
+    auto record = std::make_shared<PipelineRecord>();
+    record->stages.reserve(desc.shaderCount);
+    for (uint32_t i = 0; i < desc.shaderCount; ++i) {
+        auto stage = make_stage(impl, desc.shaders[i]);
+        if (!stage)
+            return std::unexpected{stage.error()};
+        record->stages.push_back(std::move(*stage));
+    }
+
+    record->vertex_input = desc.vertexInput;
+    GraphicsState& s = record->state;
+    s.topology      = to_gl(desc.topology);
+    s.patch_points  = desc.patchControlPoints;
+    s.rasterizer    = desc.rasterizer;
+    s.depth_stencil = desc.depthStencil;
+    s.color_count   = desc.renderTargets.colorFormatCount;
+    std::copy_n(desc.blend.attachments, s.color_count, s.blend);
+
+    record->fallback = desc.fallback;
+    if (desc.debugName)
+        record->debug_name = desc.debugName;
+    return record;
+}
+
+[[nodiscard]] auto make_record(GlDevice::Impl& impl, ComputePipelineDesc const& desc)
+    -> std::expected<std::shared_ptr<PipelineRecord>, Status>
+{
+    auto record     = std::make_shared<PipelineRecord>();
+    record->compute = true;
+    auto stage      = make_stage(impl, desc.shader);
+    if (!stage)
+        return std::unexpected{stage.error()};
+
+    auto const& reflection = stage->module->reflection;
+    for (uint32_t i = 0; i < reflection.entryPointCount; ++i) {
+        auto const& e = reflection.entryPoints[i];
+        if (e.stage == ShaderStage::Compute && stage->entry_point == e.name)
+            std::copy_n(e.localSize, 3, record->local_size);
+    }
+    record->stages.push_back(std::move(*stage));
+
+    record->fallback = desc.fallback;
+    if (desc.debugName)
+        record->debug_name = desc.debugName;
+    return record;
+}
+
+// -----------------------------------------------------------------
+// Linking (GL thread)
+// -----------------------------------------------------------------
+template<typename GetIv, typename GetLog>
+[[nodiscard]] std::string info_log(GLuint object, GetIv get_iv, GetLog get_log) noexcept {
+    GLint length = 0;
+    get_iv(object, GL_INFO_LOG_LENGTH, &length);
+    std::string log;
+    try {
+        log.resize(static_cast<std::size_t>(std::max(length, 1)));
+    } catch (std::bad_alloc const&) {
+        return {};
+    }
+    GLsizei written = 0;
+    get_log(object, static_cast<GLsizei>(log.size()), &written, log.data());
+    log.resize(static_cast<std::size_t>(written));
+    return log;
+}
+
+/// Specialised shader object for @p stage, shared by every pipeline using
+/// the same module, stage and entry point; 0 when the driver rejects it.
+[[nodiscard]] GLuint shader_object(GlDevice::Impl& impl, PipelineStage const& stage,
+                                   std::string const& pipeline_name) noexcept
+{
+    auto& ctx      = impl.pipelines;
+    auto const& gl = impl.gl;
+
+    StateHasher h;
+    h.add(stage.module->reflection.hash);
+    h.add(stage.type);
+    h.add(stage.entry_point.c_str());
+    uint64_t const key = h.value();
+    if (auto it = ctx.shaders.find(key); it != ctx.shaders.end())
+        return it->second;
+
+    auto const& code    = stage.module->code;
+    GLuint const shader = gl.glCreateShader(stage.type);
+    gl.glShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, code.data(),
+                      static_cast<GLsizei>(code.size() * sizeof(uint32_t)));
+    gl.glSpecializeShader(shader, stage.entry_point.c_str(), 0, nullptr, nullptr);
+
+    GLint compiled = 0;
+    gl.glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (!compiled) {
+        SPDLOG_ERROR("[wren/rhi/opengl] Pipeline '{}': specialising '{}' failed: {}", pipeline_name,
+                     stage.entry_point, info_log(shader, gl.glGetShaderiv, gl.glGetShaderInfoLog));
+        gl.glDeleteShader(shader);
+        return 0;
+    }
+    try {
+        ctx.shaders.emplace(key, shader);
+    } catch (std::bad_alloc const&) {
+        gl.glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+/// Vertex array for @p vi, shared by every pipeline with the same layout;
+/// 0 when out of memory.
+[[nodiscard]] GLuint vertex_array(GlDevice::Impl& impl, VertexInputLayout const& vi) noexcept {
+    auto& ctx      = impl.pipelines;
+    auto const& gl = impl.gl;
+
+    uint64_t const key = hash_state(vi);
+    if (auto it = ctx.vertex_arrays.find(key); it != ctx.vertex_arrays.end())
+        return it->second;
+
+    GLuint vao = 0;
+    gl.glCreateVertexArrays(1, &vao);
+    for (uint32_t i = 0; i < vi.attributeCount; ++i) {
+        VertexAttribute const& a = vi.attributes[i];
+        VertexFormatInfo const f = to_gl(a.format);
+        gl.glEnableVertexArrayAttrib(vao, a.location);
+        if (f.integer)
+            gl.glVertexArrayAttribIFormat(vao, a.location, f.components, f.type, a.offset);
+        else
+            gl.glVertexArrayAttribFormat(vao, a.location, f.components, f.type, f.normalized, a.offset);
+        gl.glVertexArrayAttribBinding(vao, a.location, a.binding);
+    }
+    for (uint32_t i = 0; i < vi.bindingCount; ++i)
+        gl.glVertexArrayBindingDivisor(vao, vi.bindings[i].binding, vi.bindings[i].perInstance ? 1 : 0);
+
+    try {
+        ctx.vertex_arrays.emplace(key, vao);
+    } catch (std::bad_alloc const&) {
+        gl.glDeleteVertexArrays(1, &vao);
+        return 0;
+    }
+    return vao;
+}
+
+void link(GlDevice::Impl& impl, PipelineRecord& record) noexcept {
+    auto& ctx      = impl.pipelines;
+    auto const& gl = impl.gl;
+
+    bool ok = record.compute || (record.vertex_array = vertex_array(impl, record.vertex_input)) != 0;
+
+    GLuint shaders[k_max_graphics_stages]{};
+    std::size_t const count = std::min(record.stages.size(), std::size(shaders));
+    for (std::size_t i = 0; ok && i < count; ++i)
+        ok = (shaders[i] = shader_object(impl, record.stages[i], record.debug_name)) != 0;
+
+    if (ok) {
+        GLuint const program = gl.glCreateProgram();
+        for (std::size_t i = 0; i < count; ++i)
+            gl.glAttachShader(program, shaders[i]);
+        gl.glLinkProgram(program);
+        // The shader objects stay cached for the next pipeline.
+        for (std::size_t i = 0; i < count; ++i)
+            gl.glDetachShader(program, shaders[i]);
+
+        GLint linked = 0;
+        gl.glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (linked) {
+            record.program = program;
+            if (!record.debug_name.empty() && has_any(impl.capabilities.features, Feature::DebugMarkers_Labels))
+                gl.glObjectLabel(GL_PROGRAM, program, -1, record.debug_name.c_str());
+        } else {
+            SPDLOG_ERROR("[wren/rhi/opengl] Pipeline '{}': link failed: {}", record.debug_name,
+                         info_log(program, gl.glGetProgramiv, gl.glGetProgramInfoLog));
+            gl.glDeleteProgram(program);
+            ok = false;
+        }
+    }
+
+    record.stages.clear();
+    record.stages.shrink_to_fit();
+    record.status.store(ok ? PipelineStatus::Ready : PipelineStatus::Failed, std::memory_order_release);
+    ctx.links.fetch_add(1, std::memory_order_relaxed);
+    {
+        // Orders the store against a waiter between its check and its wait.
+        std::lock_guard lock{ctx.queue_mutex};
+    }
+    ctx.linked.notify_all();
+}
+
+// -----------------------------------------------------------------
+// Batched creation
+// -----------------------------------------------------------------
+template<typename Desc>
+[[nodiscard]] Status create_pipelines(GlDevice::Impl& impl, std::span<Desc const> descs,
+                                      std::span<PipelineHandle> out) noexcept
+{
+    auto& ctx = impl.pipelines;
+    std::ranges::fill(out.first(descs.size()), PipelineHandle{});
+
+    for (Desc const& desc : descs) {
+        if (Status s = validate(impl.capabilities, desc); s != Status::Ok)
+            return s;
+    }
+
+    std::vector<std::shared_ptr<PipelineRecord>> records;
+    try {
+        records.reserve(descs.size());
+        for (Desc const& desc : descs) {
+            auto record = make_record(impl, desc);
+            if (!record)
+                return record.error();
+            records.push_back(std::move(*record));
+        }
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+
+    bool const gl_thread = impl.on_gl_thread();
+    if (gl_thread) {
+        for (auto const& record : records)
+            link(impl, *record);
+    }
+
+    {
+        std::unique_lock lock{ctx.pool_mutex};
+        bool             full = false;
+        try {
+            for (size_t i = 0; i < records.size() && !full; ++i) {
+                out[i] = ctx.pool.insert(records[i]);
+                full   = !out[i];
+            }
+        } catch (std::bad_alloc const&) {
+            full = true;
+        }
+        if (full) {
+            for (size_t i = 0; i < records.size(); ++i) {
+                ctx.pool.erase(out[i]);
+                out[i] = {};
+            }
+            lock.unlock();
+            // Nothing was published, so nothing can have been bound.
+            if (gl_thread) {
+                for (auto const& record : records)
+                    release_pipeline(impl, *record);
+            }
+            return Status::OutOfMemory;
+        }
+    }
+
+    if (!gl_thread) {
+        std::lock_guard lock{ctx.queue_mutex};
+        for (auto& record : records) {
+            try {
+                ctx.queue.push_back(record);
+            } catch (std::bad_alloc const&) {
+                break; // the rest link when replay first binds them
+            }
+            record->queued.store(true, std::memory_order_relaxed);
+        }
+    }
+    return Status::Ok;
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Linking & teardown
+// -------------------------------------------------------------------------------------------------
+void link_queued_pipelines(GlDevice::Impl& impl) noexcept {
+    auto& ctx = impl.pipelines;
+    for (;;) {
+        std::shared_ptr<PipelineRecord> record;
+        {
+            std::lock_guard lock{ctx.queue_mutex};
+            if (ctx.queue.empty())
+                return;
+            record = std::move(ctx.queue.front());
+            ctx.queue.pop_front();
+        }
+        record->queued.store(false, std::memory_order_relaxed);
+        ensure_linked(impl, *record);
+    }
+}
+
+bool ensure_linked(GlDevice::Impl& impl, PipelineRecord& record) noexcept {
+    PipelineStatus const status = record.status.load(std::memory_order_acquire);
+    if (status == PipelineStatus::Pending)
+        link(impl, record);
+    return record.status.load(std::memory_order_acquire) == PipelineStatus::Ready;
+}
+
+std::shared_ptr<PipelineRecord> find_pipeline(GlDevice::Impl const& impl, PipelineHandle handle) noexcept {
+    auto const& ctx = impl.pipelines;
+    std::shared_lock lock{ctx.pool_mutex};
+    auto const* record = ctx.pool.get<0>(handle);
+    return record ? *record : nullptr;
+}
+
+void release_pipeline(GlDevice::Impl& impl, PipelineRecord& record) noexcept {
+    // A record destroyed while still queued is never linked afterwards.
+    if (record.status.load(std::memory_order_relaxed) == PipelineStatus::Pending)
+        record.status.store(PipelineStatus::Failed, std::memory_order_release);
+    if (record.program)
+        impl.gl.glDeleteProgram(record.program);
+    record.program = 0;
+}
+
+void release_pipelines(GlDevice::Impl& impl) noexcept {
+    auto& ctx      = impl.pipelines;
+    auto const& gl = impl.gl;
+
+    ctx.queue.clear();
+    for (auto const& record : ctx.pool.column<0>())
+        release_pipeline(impl, *record);
+    ctx.pool.clear();
+
+    for (auto const& [key, vao] : ctx.vertex_arrays)
+        gl.glDeleteVertexArrays(1, &vao);
+    ctx.vertex_arrays.clear();
+    for (auto const& [key, shader] : ctx.shaders)
+        gl.glDeleteShader(shader);
+    ctx.shaders.clear();
+
+    auto& shaders = impl.shaders;
+    if (shaders.pool.size() > 0)
+        SPDLOG_WARN("[wren/rhi/opengl] Device destroyed with {} shader module(s) alive.", shaders.pool.size());
+    shaders.pool.clear();
+    shaders.by_hash.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+// GlDevice — shader modules
+// -------------------------------------------------------------------------------------------------
+auto GlDevice::create_shader_modules(std::span<ShaderModuleDesc const> descs,
+                                     std::span<ShaderModuleHandle>     out) noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    std::ranges::fill(out.first(descs.size()), ShaderModuleHandle{});
+
+    std::vector<std::shared_ptr<ShaderModuleRecord const>> records;
+    try {
+        records.reserve(descs.size());
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+    for (ShaderModuleDesc const& desc : descs) {
+        auto record = intern_shader_module(*impl_, desc.code, desc.codeSize);
+        if (!record)
+            return record.error();
+        records.push_back(std::move(*record));
+    }
+
+    auto&            ctx = impl_->shaders;
+    std::unique_lock lock{ctx.pool_mutex};
+    bool             full = false;
+    try {
+        for (size_t i = 0; i < records.size() && !full; ++i) {
+            out[i] = ctx.pool.insert(records[i]);
+            full   = !out[i];
+        }
+    } catch (std::bad_alloc const&) {
+        full = true;
+    }
+    if (full) {
+        for (size_t i = 0; i < records.size(); ++i) {
+            ctx.pool.erase(out[i]);
+            out[i] = {};
+        }
+        return Status::OutOfMemory;
+    }
+    return Status::Ok;
+}
+
+void GlDevice::destroy_shader_modules(std::span<ShaderModuleHandle const> handles) noexcept {
+    // Records only hold SPIR-V; pipelines that use a module keep it alive.
+    auto& ctx = impl_->shaders;
+    std::unique_lock lock{ctx.pool_mutex};
+    for (ShaderModuleHandle handle : handles)
+        ctx.pool.erase(handle);
+}
+
+auto GlDevice::shader_module_reflection(ShaderModuleHandle handle, ShaderReflection& out) const noexcept
+    -> Status
+{
+    auto record = find_shader_module(impl_->shaders, handle);
+    if (!record)
+        return Status::InvalidArgument;
+    out = record->reflection;
+    return Status::Ok;
+}
+
+void GlDevice::pipeline_cache_stats(PipelineCacheStats& out) const noexcept {
+    out = {};
+    auto& shaders = impl_->shaders;
+    std::scoped_lock lock{shaders.mutex};
+    out.shaderModules = static_cast<uint64_t>(std::ranges::count_if(
+        shaders.by_hash, [](auto const& entry) { return !entry.second.expired(); }));
+    out.shaderModuleHits  = shaders.hits.load(std::memory_order_relaxed);
+    out.shaderModuleBytes = shaders.bytes.load(std::memory_order_relaxed);
+}
+
+// -------------------------------------------------------------------------------------------------
+// GlDevice — pipelines
+// -------------------------------------------------------------------------------------------------
+auto GlDevice::create_graphics_pipelines(std::span<GraphicsPipelineDesc const> descs,
+                                         std::span<PipelineHandle>             out) noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    return create_pipelines(*impl_, descs, out);
+}
+
+auto GlDevice::create_compute_pipelines(std::span<ComputePipelineDesc const> descs,
+                                        std::span<PipelineHandle>            out) noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    return create_pipelines(*impl_, descs, out);
+}
+
+void GlDevice::destroy_pipelines(std::span<PipelineHandle const> handles) noexcept {
+    auto& ctx = impl_->pipelines;
+    // The caller orders its last submit() before the release, so a relaxed
+    // load sees that submission's value.
+    uint64_t const value = impl_->commands.last_value.load(std::memory_order_relaxed);
+
+    std::unique_lock pool_lock{ctx.pool_mutex};
+    std::scoped_lock lock{impl_->deferred.mutex};
+    for (PipelineHandle h : handles) {
+        auto row = ctx.pool.extract(h);
+        if (!row) continue;
+        try {
+            impl_->deferred.pipelines.emplace_back(value, std::move(std::get<0>(*row)));
+        } catch (std::bad_alloc const&) {
+            SPDLOG_ERROR("[wren/rhi/opengl] Out of memory queueing a deferred destruction; the object leaks.");
+        }
+    }
+}
+
+auto GlDevice::pipeline_status(PipelineHandle handle) const noexcept -> PipelineStatus {
+    auto record = find_pipeline(*impl_, handle);
+    return record ? record->status.load(std::memory_order_acquire) : PipelineStatus::Failed;
+}
+
+void GlDevice::prioritize_pipelines(std::span<PipelineHandle const> handles) noexcept {
+    auto& ctx = impl_->pipelines;
+    // Last handle first, so the first handle ends up at the very front.
+    for (auto it = handles.rbegin(); it != handles.rend(); ++it) {
+        auto record = find_pipeline(*impl_, *it);
+        if (!record || !record->queued.load(std::memory_order_relaxed))
+            continue;
+        std::lock_guard lock{ctx.queue_mutex};
+        if (auto pos = std::ranges::find(ctx.queue, record); pos != ctx.queue.end())
+            std::rotate(ctx.queue.begin(), pos, pos + 1);
+    }
+}
+
+auto GlDevice::wait_pipelines(std::span<PipelineHandle const> handles) noexcept -> Status {
+    auto& ctx = impl_->pipelines;
+    bool const gl_thread = impl_->on_gl_thread();
+    bool failed = false;
+    for (PipelineHandle h : handles) {
+        auto record = find_pipeline(*impl_, h);
+        if (!record) {
+            failed = true;
+            continue;
+        }
+        if (gl_thread) {
+            failed |= !ensure_linked(*impl_, *record);
+            continue;
+        }
+        std::unique_lock lock{ctx.queue_mutex};
+        ctx.linked.wait(lock, [&record] {
+            return record->status.load(std::memory_order_acquire) != PipelineStatus::Pending;
+        });
+        failed |= record->status.load(std::memory_order_relaxed) != PipelineStatus::Ready;
+    }
+    return failed ? Status::InternalError : Status::Ok;
+}
+
+} // namespace wren::rhi::opengl
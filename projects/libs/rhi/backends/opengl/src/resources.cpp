@@ -0,0 +1,806 @@
+#include "gl_device.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <expected>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include "gl_convert.hpp"
+#include "gl_device_impl.hpp"
+
+namespace wren::rhi::opengl {
+
+namespace {
+
+// Entries per handle table with ARB_bindless_texture; 128 KiB of handles
+// each. Without it the tables are as long as a stage has units.
+constexpr uint32_t k_bindless_texture_capacity = 16384;
+
+[[nodiscard]] bool labels_enabled(GlDevice::Impl const& impl) noexcept {
+    return has_any(impl.capabilities.features, Feature::DebugMarkers_Labels);
+}
+
+void set_debug_name(GlDevice::Impl const& impl, GLenum identifier, GLuint name, char const* label) noexcept {
+    if (label && labels_enabled(impl))
+        impl.gl.glObjectLabel(identifier, name, -1, label);
+}
+
+/// Status of the storage call just made. NO_ERROR contexts always pass.
+[[nodiscard]] Status storage_status(GlFunctions const& gl) noexcept {
+    GLenum error = gl.glGetError();
+    if (error == GL_NO_ERROR)
+        return Status::Ok;
+    Status const status = error == GL_OUT_OF_MEMORY ? Status::OutOfMemory : Status::InternalError;
+    while (error != GL_NO_ERROR)
+        error = gl.glGetError();
+    return status;
+}
+
+/// Bytes glTextureStorage* reserves for @p desc, for memory_budget().
+[[nodiscard]] uint64_t texture_bytes(TextureDesc const& desc) noexcept {
+    uint64_t const texel = uint64_t{to_gl(desc.format).texel_bytes} * static_cast<uint32_t>(desc.samples);
+    uint64_t bytes = 0;
+    for (uint32_t mip = 0; mip < desc.mipLevels; ++mip) {
+        uint64_t const w = std::max(desc.width >> mip, 1u);
+        uint64_t const h = std::max(desc.height >> mip, 1u);
+        uint64_t const d = std::max(desc.depth >> mip, 1u);
+        bytes += w * h * d * texel;
+    }
+    return bytes * desc.arrayLayers;
+}
+
+// -----------------------------------------------------------------
+// Bindless slots
+//
+// Called on the GL thread only, from creation and deferred release; the
+// mutex orders the table writes against bindless_heap_info() readers.
+// -----------------------------------------------------------------
+[[nodiscard]] BindlessTable& table(BindlessContext& ctx, BindlessClass cls) noexcept {
+    return ctx.tables[static_cast<uint32_t>(cls)];
+}
+
+void release_bindless_texture(GlDevice::Impl& impl, BindlessSlots const& slots) noexcept {
+    auto& ctx      = impl.bindless;
+    auto const& gl = impl.gl;
+
+    std::scoped_lock lock{ctx.mutex};
+    if (slots.sampled != k_invalid_bindless_index) {
+        if (ctx.handles) {
+            gl.glMakeTextureHandleNonResidentARB(slots.texture_handle);
+            ctx.texture_handles[slots.sampled] = 0;
+        } else {
+            ctx.texture_units[slots.sampled] = 0;
+        }
+        table(ctx, BindlessClass::SampledTexture).release(slots.sampled);
+    }
+    if (slots.storage != k_invalid_bindless_index) {
+        if (ctx.handles) {
+            gl.glMakeImageHandleNonResidentARB(slots.image_handle);
+            ctx.image_handles[slots.storage] = 0;
+        } else {
+            ctx.image_units[slots.storage] = 0;
+        }
+        table(ctx, BindlessClass::StorageTexture).release(slots.storage);
+    }
+    ++ctx.version;
+}
+
+/// Heap slots for a texture of @p desc; OutOfMemory when a table is full.
+[[nodiscard]] auto acquire_bindless_texture(GlDevice::Impl& impl, GLuint name, TextureDesc const& desc,
+                                            GLenum target) noexcept -> std::expected<BindlessSlots, Status>
+{
+    auto& ctx      = impl.bindless;
+    auto const& gl = impl.gl;
+
+    bool const sampled = underlying(desc.usage & TextureUsage::Sampled) != 0;
+    bool const storage = underlying(desc.usage & TextureUsage::Storage) != 0;
+    BindlessSlots slots;
+    if (!sampled && !storage)
+        return slots;
+
+    {
+        std::scoped_lock lock{ctx.mutex};
+        if (sampled)
+            slots.sampled = table(ctx, BindlessClass::SampledTexture).acquire();
+        if (storage)
+            slots.storage = table(ctx, BindlessClass::StorageTexture).acquire();
+    }
+    if ((sampled && slots.sampled == k_invalid_bindless_index) ||
+        (storage && slots.storage == k_invalid_bindless_index)) {
+        std::scoped_lock lock{ctx.mutex};
+        table(ctx, BindlessClass::SampledTexture).release(slots.sampled);
+        table(ctx, BindlessClass::StorageTexture).release(slots.storage);
+        return std::unexpected{Status::OutOfMemory};
+    }
+
+    // Handles are made resident outside the lock; once created they freeze
+    // the texture's sampler state, which creation has already set.
+    if (ctx.handles) {
+        if (sampled) {
+            slots.texture_handle = gl.glGetTextureHandleARB(name);
+            gl.glMakeTextureHandleResidentARB(slots.texture_handle);
+        }
+        if (storage) {
+            bool const layered = desc.arrayLayers > 1 || target == GL_TEXTURE_3D || target == GL_TEXTURE_CUBE_MAP;
+            slots.image_handle = gl.glGetImageHandleARB(name, 0, layered ? 1 : 0, 0,
+                                                        to_gl(desc.format).internal_format);
+            gl.glMakeImageHandleResidentARB(slots.image_handle, GL_READ_WRITE);
+        }
+    }
+
+    std::scoped_lock lock{ctx.mutex};
+    if (sampled) {
+        if (ctx.handles) ctx.texture_handles[slots.sampled] = slots.texture_handle;
+        else             ctx.texture_units[slots.sampled]   = name;
+    }
+    if (storage) {
+        if (ctx.handles) ctx.image_handles[slots.storage] = slots.image_handle;
+        else             ctx.image_units[slots.storage]   = name;
+    }
+    ++ctx.version;
+    return slots;
+}
+
+[[nodiscard]] uint32_t acquire_bindless_buffer(GlDevice::Impl& impl, GLuint name) noexcept {
+    auto& ctx = impl.bindless;
+    std::scoped_lock lock{ctx.mutex};
+    uint32_t const index = table(ctx, BindlessClass::StorageBuffer).acquire();
+    if (index != k_invalid_bindless_index) {
+        ctx.storage_buffers[index] = name;
+        ++ctx.version;
+    }
+    return index;
+}
+
+void release_bindless_buffer(GlDevice::Impl& impl, uint32_t index) noexcept {
+    if (index == k_invalid_bindless_index)
+        return;
+    auto& ctx = impl.bindless;
+    std::scoped_lock lock{ctx.mutex};
+    ctx.storage_buffers[index] = 0;
+    table(ctx, BindlessClass::StorageBuffer).release(index);
+    ++ctx.version;
+}
+
+// -----------------------------------------------------------------
+// Raw object teardown
+// -----------------------------------------------------------------
+void release_buffer(GlDevice::Impl& impl, BufferRow const& row) noexcept {
+    auto const& [name, mapping, storage, desc] = row;
+    release_bindless_buffer(impl, storage);
+    // Deleting a buffer unmaps it.
+    impl.gl.glDeleteBuffers(1, &name);
+    impl.allocated_bytes.fetch_sub(desc.size, std::memory_order_relaxed);
+    if (desc.memory == MemoryUsage::Readback)
+        impl.readback_buffers.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void release_texture(GlDevice::Impl& impl, TextureRow const& row) noexcept {
+    auto const& [name, target, slots, desc] = row;
+    release_bindless_texture(impl, slots);
+    forget_framebuffers(impl, name);
+    impl.gl.glDeleteTextures(1, &name);
+    impl.allocated_bytes.fetch_sub(texture_bytes(desc), std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------
+// Single-object creation
+// -----------------------------------------------------------------
+[[nodiscard]] auto make_buffer(GlDevice::Impl& impl, BufferDesc const& desc)
+    -> std::expected<BufferRow, Status>
+{
+    if (desc.size == 0 || desc.usage == BufferUsage::None)
+        return std::unexpected{Status::InvalidArgument};
+
+    auto const& gl = impl.gl;
+
+    // Upload and readback buffers are mapped once for their whole life
+    // (ARB_buffer_storage). Readback memory lives on the host.
+    GLbitfield access = 0;
+    GLbitfield flags  = 0;
+    switch (desc.memory) {
+        case MemoryUsage::GpuOnly:
+            break;
+        case MemoryUsage::Upload:
+            access = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            flags  = access;
+            break;
+        case MemoryUsage::Readback:
+            access = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            flags  = access | GL_CLIENT_STORAGE_BIT;
+            break;
+    }
+
+    GLuint name = 0;
+    gl.glCreateBuffers(1, &name);
+    gl.glNamedBufferStorage(name, static_cast<GLsizeiptr>(desc.size), nullptr, flags);
+    if (Status s = storage_status(gl); s != Status::Ok) {
+        gl.glDeleteBuffers(1, &name);
+        return std::unexpected{s};
+    }
+
+    void* mapped = nullptr;
+    if (access != 0) {
+        mapped = gl.glMapNamedBufferRange(name, 0, static_cast<GLsizeiptr>(desc.size), access);
+        if (!mapped) {
+            gl.glDeleteBuffers(1, &name);
+            return std::unexpected{Status::OutOfMemory};
+        }
+    }
+
+    uint32_t slot = k_invalid_bindless_index;
+    if (underlying(desc.usage & BufferUsage::Storage) != 0) {
+        slot = acquire_bindless_buffer(impl, name);
+        if (slot == k_invalid_bindless_index) {
+            gl.glDeleteBuffers(1, &name);
+            return std::unexpected{Status::OutOfMemory};
+        }
+    }
+
+    set_debug_name(impl, GL_BUFFER, name, desc.debugName);
+
+    impl.allocated_bytes.fetch_add(desc.size, std::memory_order_relaxed);
+    if (desc.memory == MemoryUsage::Readback)
+        impl.readback_buffers.fetch_add(1, std::memory_order_relaxed);
+
+    BufferDesc stored = desc;
+    stored.debugName  = nullptr; // caller-owned; never dereferenced after creation
+    return BufferRow{name, mapped, slot, stored};
+}
+
+[[nodiscard]] Status validate(TextureDesc const& desc, DeviceLimits const& limits) noexcept {
+    if (desc.width == 0 || desc.height == 0 || desc.depth == 0 ||
+        desc.mipLevels == 0 || desc.arrayLayers == 0 || desc.usage == TextureUsage::None)
+        return Status::InvalidArgument;
+
+    uint32_t max_dim = 0;
+    switch (desc.dimension) {
+        case TextureDimension::Tex1D:
+            if (desc.height != 1 || desc.depth != 1) return Status::InvalidArgument;
+            max_dim = limits.maxImageDimension1D;
+            break;
+        case TextureDimension::Tex2D:
+            if (desc.depth != 1) return Status::InvalidArgument;
+            max_dim = limits.maxImageDimension2D;
+            break;
+        case TextureDimension::Tex3D:
+            if (desc.arrayLayers != 1) return Status::InvalidArgument;
+            max_dim = limits.maxImageDimension3D;
+            break;
+        case TextureDimension::Cube:
+            if (desc.width != desc.height || desc.depth != 1 || desc.arrayLayers % 6 != 0)
+                return Status::InvalidArgument;
+            max_dim = limits.maxCubeDimension;
+            break;
+    }
+
+    uint32_t const largest = std::max({desc.width, desc.height, desc.depth});
+    if (largest > max_dim || desc.arrayLayers > limits.maxArrayLayers)
+        return Status::UnsupportedLimit;
+    if (desc.mipLevels > static_cast<uint32_t>(std::bit_width(largest)))
+        return Status::InvalidArgument;
+
+    if (desc.samples != SampleCount::C1) {
+        if (desc.dimension != TextureDimension::Tex2D || desc.mipLevels != 1)
+            return Status::InvalidArgument;
+        if (static_cast<uint32_t>(desc.samples) > limits.maxMSAASamples)
+            return Status::UnsupportedSampleCount;
+    }
+
+    // Image load/store has no depth or sRGB formats.
+    FormatInfo const format = to_gl(desc.format);
+    if (underlying(desc.usage & TextureUsage::Storage) != 0 &&
+        (format.depth || format.internal_format == GL_SRGB8_ALPHA8))
+        return Status::UnsupportedFormat;
+
+    return Status::Ok;
+}
+
+[[nodiscard]] auto make_texture(GlDevice::Impl& impl, TextureDesc const& desc)
+    -> std::expected<TextureRow, Status>
+{
+    // Placed and sparse textures need memory objects GL does not expose.
+    if (desc.heap || desc.sparse)
+        return std::unexpected{Status::MissingRequiredFeature};
+    if (Status s = validate(desc, impl.capabilities.limits); s != Status::Ok)
+        return std::unexpected{s};
+
+    auto const& gl      = impl.gl;
+    FormatInfo const fmt = to_gl(desc.format);
+    GLenum const target = texture_target(desc.dimension, desc.arrayLayers, desc.samples);
+    auto const levels   = static_cast<GLsizei>(desc.mipLevels);
+    auto const samples  = static_cast<GLsizei>(desc.samples);
+    auto const w        = static_cast<GLsizei>(desc.width);
+    auto const h        = static_cast<GLsizei>(desc.height);
+    auto const d        = static_cast<GLsizei>(desc.depth);
+    auto const layers   = static_cast<GLsizei>(desc.arrayLayers);
+
+    GLuint name = 0;
+    gl.glCreateTextures(target, 1, &name);
+    switch (target) {
+        case GL_TEXTURE_1D:
+            gl.glTextureStorage1D(name, levels, fmt.internal_format, w);
+            break;
+        case GL_TEXTURE_1D_ARRAY:
+            gl.glTextureStorage2D(name, levels, fmt.internal_format, w, layers);
+            break;
+        case GL_TEXTURE_2D:
+        case GL_TEXTURE_CUBE_MAP:
+            gl.glTextureStorage2D(name, levels, fmt.internal_format, w, h);
+            break;
+        case GL_TEXTURE_2D_ARRAY:
+        case GL_TEXTURE_CUBE_MAP_ARRAY:
+            gl.glTextureStorage3D(name, levels, fmt.internal_format, w, h, layers);
+            break;
+        case GL_TEXTURE_3D:
+            gl.glTextureStorage3D(name, levels, fmt.internal_format, w, h, d);
+            break;
+        case GL_TEXTURE_2D_MULTISAMPLE:
+            gl.glTextureStorage2DMultisample(name, samples, fmt.internal_format, w, h, 1);
+            break;
+        case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:
+            gl.glTextureStorage3DMultisample(name, samples, fmt.internal_format, w, h, layers, 1);
+            break;
+        default:
+            break;
+    }
+    if (Status s = storage_status(gl); s != Status::Ok) {
+        gl.glDeleteTextures(1, &name);
+        return std::unexpected{s};
+    }
+
+    // The baked-in sampler: trilinear, repeat. Multisample textures have
+    // no sampler state.
+    if (desc.samples == SampleCount::C1) {
+        gl.glTextureParameteri(name, GL_TEXTURE_MIN_FILTER,
+                               static_cast<GLint>(desc.mipLevels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR));
+        gl.glTextureParameteri(name, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(GL_LINEAR));
+        gl.glTextureParameteri(name, GL_TEXTURE_WRAP_S, static_cast<GLint>(GL_REPEAT));
+        gl.glTextureParameteri(name, GL_TEXTURE_WRAP_T, static_cast<GLint>(GL_REPEAT));
+        gl.glTextureParameteri(name, GL_TEXTURE_WRAP_R, static_cast<GLint>(GL_REPEAT));
+        gl.glTextureParameteri(name, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(desc.mipLevels - 1));
+    }
+
+    auto const slots = acquire_bindless_texture(impl, name, desc, target);
+    if (!slots) {
+        gl.glDeleteTextures(1, &name);
+        return std::unexpected{slots.error()};
+    }
+
+    set_debug_name(impl, GL_TEXTURE, name, desc.debugName);
+    impl.allocated_bytes.fetch_add(texture_bytes(desc), std::memory_order_relaxed);
+
+    TextureDesc stored = desc;
+    stored.debugName   = nullptr;
+    return TextureRow{name, target, *slots, stored};
+}
+
+// -----------------------------------------------------------------
+// Batched creation
+//
+// As on Vulkan: every GL object is created first, then the whole batch is
+// published under a single exclusive lock. Any failure unwinds the batch
+// so callers never see a partially created set.
+// -----------------------------------------------------------------
+template<typename Pool, typename Row, typename Desc, typename Handle, typename Make, typename Release>
+[[nodiscard]] Status create_batch(GlDevice::Impl&       impl,
+                                  Pool&                 pool,
+                                  std::shared_mutex&    mutex,
+                                  std::span<Desc const> descs,
+                                  std::span<Handle>     out,
+                                  Make&&                make,
+                                  Release&&             release) noexcept
+{
+    std::ranges::fill(out.first(descs.size()), Handle{});
+    if (!impl.on_gl_thread())
+        return Status::InvalidArgument;
+
+    std::vector<Row> rows;
+    Status status = Status::Ok;
+    try {
+        rows.reserve(descs.size());
+        for (Desc const& desc : descs) {
+            auto row = make(impl, desc);
+            if (!row) {
+                status = row.error();
+                break;
+            }
+            rows.push_back(*row);
+        }
+    } catch (std::bad_alloc const&) {
+        status = Status::OutOfMemory;
+    }
+
+    if (status == Status::Ok) {
+        std::unique_lock lock{mutex};
+        std::size_t published = 0;
+        try {
+            for (; published < rows.size(); ++published) {
+                out[published] = std::apply([&pool](auto const&... col) { return pool.insert(col...); },
+                                            rows[published]);
+                if (!out[published]) break; // every slot is in use
+            }
+        } catch (std::bad_alloc const&) {}
+
+        if (published == rows.size())
+            return Status::Ok;
+
+        for (std::size_t i = 0; i < published; ++i) {
+            pool.erase(out[i]);
+            out[i] = Handle{};
+        }
+        status = Status::OutOfMemory;
+    }
+
+    for (Row const& row : rows)
+        release(impl, row);
+    return status;
+}
+
+/// Queues @p row for release once the GPU passes every submission made so
+/// far.
+template<typename Row>
+void defer_release(GlDevice::Impl& impl, std::vector<std::pair<uint64_t, Row>>& queue, Row&& row) noexcept {
+    // The caller orders its last submit() before the release, so a relaxed
+    // load sees that submission's value.
+    uint64_t const value = impl.commands.last_value.load(std::memory_order_relaxed);
+    try {
+        std::scoped_lock lock{impl.deferred.mutex};
+        queue.emplace_back(value, std::move(row));
+    } catch (std::bad_alloc const&) {
+        // Waiting here could stall on work the frame thread has not
+        // flushed yet; losing the object is the lesser evil.
+        SPDLOG_ERROR("[wren/rhi/opengl] Out of memory queueing a deferred destruction; the object leaks.");
+    }
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Setup & teardown
+// -------------------------------------------------------------------------------------------------
+Status init_resources(GlDevice::Impl& impl) noexcept {
+    auto const& gl = impl.gl;
+    auto const& limits = impl.capabilities.limits;
+
+    // Stream ring.
+    auto& stream = impl.stream;
+    stream.uniform_alignment = std::max(std::bit_ceil(limits.uniformBufferAlignment), 16u);
+    GLbitfield const ring_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    gl.glCreateBuffers(1, &stream.buffer);
+    gl.glNamedBufferStorage(stream.buffer, static_cast<GLsizeiptr>(k_stream_ring_bytes), nullptr, ring_flags);
+    stream.mapped = static_cast<std::byte*>(
+        gl.glMapNamedBufferRange(stream.buffer, 0, static_cast<GLsizeiptr>(k_stream_ring_bytes), ring_flags));
+    if (!stream.mapped)
+        return Status::OutOfMemory;
+    set_debug_name(impl, GL_BUFFER, stream.buffer, "wren stream ring");
+
+    // Bindless heap.
+    auto& ctx   = impl.bindless;
+    ctx.handles = has_any(impl.capabilities.features, Feature::DescriptorIndexing_Bindless);
+
+    GLint ssbo_bindings = 0;
+    gl.glGetIntegerv(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, &ssbo_bindings);
+
+    table(ctx, BindlessClass::SampledTexture).capacity =
+        ctx.handles ? k_bindless_texture_capacity : limits.maxPerStageSampledImages;
+    table(ctx, BindlessClass::StorageTexture).capacity =
+        ctx.handles ? k_bindless_texture_capacity : limits.maxPerStageStorageImages;
+    table(ctx, BindlessClass::StorageBuffer).capacity =
+        static_cast<uint32_t>(std::max<GLint>(ssbo_bindings, k_first_storage_buffer_binding)) -
+        k_first_storage_buffer_binding;
+
+    try {
+        ctx.storage_buffers.assign(table(ctx, BindlessClass::StorageBuffer).capacity, 0);
+        if (!ctx.handles) {
+            ctx.texture_units.assign(table(ctx, BindlessClass::SampledTexture).capacity, 0);
+            ctx.image_units.assign(table(ctx, BindlessClass::StorageTexture).capacity, 0);
+        }
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+
+    if (ctx.handles) {
+        auto const make_table = [&](GLuint& buffer, GLuint64*& handles, GLuint binding, char const* label) {
+            auto const bytes = static_cast<GLsizeiptr>(k_bindless_texture_capacity * sizeof(GLuint64));
+            gl.glCreateBuffers(1, &buffer);
+            gl.glNamedBufferStorage(buffer, bytes, nullptr, ring_flags);
+            handles = static_cast<GLuint64*>(gl.glMapNamedBufferRange(buffer, 0, bytes, ring_flags));
+            if (!handles)
+                return false;
+            std::memset(handles, 0, static_cast<std::size_t>(bytes));
+            gl.glBindBuffersBase(GL_SHADER_STORAGE_BUFFER, binding, 1, &buffer);
+            set_debug_name(impl, GL_BUFFER, buffer, label);
+            return true;
+        };
+        if (!make_table(ctx.texture_table, ctx.texture_handles, k_texture_table_binding, "wren texture handles") ||
+            !make_table(ctx.image_table, ctx.image_handles, k_image_table_binding, "wren image handles"))
+            return Status::OutOfMemory;
+    }
+    return Status::Ok;
+}
+
+void release_resources(GlDevice::Impl& impl) noexcept {
+    auto const& gl = impl.gl;
+
+    auto& buffers = impl.buffers;
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+        release_buffer(impl, BufferRow{buffers.column<0>()[i], buffers.column<1>()[i],
+                                       buffers.column<2>()[i], buffers.column<3>()[i]});
+    buffers.clear();
+
+    auto& textures = impl.textures;
+    for (std::size_t i = 0; i < textures.size(); ++i)
+        release_texture(impl, TextureRow{textures.column<0>()[i], textures.column<1>()[i],
+                                         textures.column<2>()[i], textures.column<3>()[i]});
+    textures.clear();
+
+    auto& ctx = impl.bindless;
+    GLuint const objects[] = {ctx.texture_table, ctx.image_table, impl.stream.buffer};
+    gl.glDeleteBuffers(3, objects);
+    ctx.texture_table = ctx.image_table = impl.stream.buffer = 0;
+    ctx.texture_handles = ctx.image_handles = nullptr;
+    impl.stream.mapped = nullptr;
+}
+
+void collect_deferred(GlDevice::Impl& impl, uint64_t completed) noexcept {
+    auto& ctx = impl.deferred;
+    std::scoped_lock lock{ctx.mutex};
+    std::erase_if(ctx.buffers, [&](auto const& entry) {
+        if (entry.first > completed) return false;
+        release_buffer(impl, entry.second);
+        return true;
+    });
+    std::erase_if(ctx.textures, [&](auto const& entry) {
+        if (entry.first > completed) return false;
+        release_texture(impl, entry.second);
+        return true;
+    });
+    std::erase_if(ctx.pipelines, [&](auto const& entry) {
+        if (entry.first > completed) return false;
+        release_pipeline(impl, *entry.second);
+        return true;
+    });
+}
+
+void sample_memory_budget(GlDevice::Impl& impl) noexcept {
+    auto const& gl  = impl.gl;
+    auto const& ext = impl.info.extensions;
+    if (ext.nvx_gpu_memory_info) {
+        GLint total = 0, available = 0;
+        gl.glGetIntegerv(GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX, &total);
+        gl.glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &available);
+        impl.driver_total_bytes.store(uint64_t{static_cast<uint32_t>(std::max(total, 0))} * 1024u,
+                                      std::memory_order_relaxed);
+        impl.driver_available_bytes.store(uint64_t{static_cast<uint32_t>(std::max(available, 0))} * 1024u,
+                                          std::memory_order_relaxed);
+    } else if (ext.ati_meminfo) {
+        // ATI_meminfo reports free memory only; the total is what was free
+        // when the context was created.
+        GLint free_kb[4]{};
+        gl.glGetIntegerv(GL_VBO_FREE_MEMORY_ATI, free_kb);
+        impl.driver_total_bytes.store(impl.info.video_memory_bytes, std::memory_order_relaxed);
+        impl.driver_available_bytes.store(uint64_t{static_cast<uint32_t>(std::max(free_kb[0], 0))} * 1024u,
+                                          std::memory_order_relaxed);
+    }
+}
+
+void bind_bindless(GlDevice::Impl& impl) noexcept {
+    auto& ctx      = impl.bindless;
+    auto const& gl = impl.gl;
+
+    std::scoped_lock lock{ctx.mutex};
+    if (impl.replay.bindless_version == ctx.version)
+        return;
+    impl.replay.bindless_version = ctx.version;
+
+    // Only the entries ever handed out are bound; the handle tables were
+    // bound once by init_resources().
+    auto const bind_units = [&](auto&& bind, std::vector<GLuint> const& units, BindlessClass cls) {
+        if (uint32_t const count = table(ctx, cls).next; count > 0)
+            bind(0, static_cast<GLsizei>(count), units.data());
+    };
+    if (!ctx.handles) {
+        bind_units(gl.glBindTextures, ctx.texture_units, BindlessClass::SampledTexture);
+        bind_units(gl.glBindImageTextures, ctx.image_units, BindlessClass::StorageTexture);
+    }
+    if (uint32_t const count = table(ctx, BindlessClass::StorageBuffer).next; count > 0)
+        gl.glBindBuffersBase(GL_SHADER_STORAGE_BUFFER, k_first_storage_buffer_binding,
+                             static_cast<GLsizei>(count), ctx.storage_buffers.data());
+}
+
+std::optional<uint64_t> stream_allocate(GlDevice::Impl& impl, uint64_t size, uint64_t alignment) noexcept {
+    auto& ring = impl.stream.ring;
+    auto& ctx  = impl.commands;
+    auto const& gl = impl.gl;
+    if (size > ring.capacity())
+        return std::nullopt;
+
+    for (;;) {
+        if (auto const a = ring.allocate(size, alignment))
+            return a->offset;
+
+        // An idle ring fails only when the request would straddle the wrap
+        // point: skip to the start of the next lap.
+        if (ring.used() == 0) {
+            if (auto const pad = ring.allocate(ring.capacity() - ring.head() % ring.capacity(), 1))
+                ring.release(pad->end);
+            continue;
+        }
+
+        // Everything in the ring belongs to the flush in progress: fence it
+        // so its front can retire. The fence adds no timeline value.
+        if (ctx.fences.empty()) {
+            RetireFence const fence{
+                .sync      = gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0),
+                .value     = ctx.completed.load(std::memory_order_relaxed),
+                .ring_head = ring.head(),
+            };
+            try {
+                ctx.fences.push_back(fence);
+            } catch (std::bad_alloc const&) {
+                gl.glClientWaitSync(fence.sync, GL_SYNC_FLUSH_COMMANDS_BIT, UINT64_MAX);
+                gl.glDeleteSync(fence.sync);
+                ring.release(fence.ring_head);
+                continue;
+            }
+        }
+        if (retire_fences(impl, ctx.fences.front().value, UINT64_MAX) != Status::Ok)
+            return std::nullopt;
+    }
+}
+
+GLuint resolve_buffer(GlDevice::Impl const& impl, BufferHandle handle, uint64_t* size) noexcept {
+    std::shared_lock lock{impl.buffers_mutex};
+    auto const* name = impl.buffers.get<0>(handle);
+    if (!name) return 0;
+    if (size) *size = impl.buffers.get<3>(handle)->size;
+    return *name;
+}
+
+bool resolve_texture(GlDevice::Impl const& impl, TextureHandle handle, GLuint& name, GLenum& target,
+                     TextureDesc& desc) noexcept
+{
+    std::shared_lock lock{impl.textures_mutex};
+    auto const* n = impl.textures.get<0>(handle);
+    if (!n) return false;
+    name   = *n;
+    target = *impl.textures.get<1>(handle);
+    desc   = *impl.textures.get<3>(handle);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Buffers
+// -------------------------------------------------------------------------------------------------
+auto GlDevice::create_buffers(std::span<BufferDesc const> descs,
+                              std::span<BufferHandle>     out) noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    return create_batch<BufferPool, BufferRow>(*impl_, impl_->buffers, impl_->buffers_mutex,
+                                               descs, out, make_buffer, release_buffer);
+}
+
+void GlDevice::destroy_buffers(std::span<BufferHandle const> handles) noexcept {
+    std::unique_lock lock{impl_->buffers_mutex};
+    for (BufferHandle h : handles) {
+        if (auto row = impl_->buffers.extract(h))
+            defer_release(*impl_, impl_->deferred.buffers, std::move(*row));
+    }
+}
+
+auto GlDevice::buffer_mapping(BufferHandle handle) const noexcept -> void* {
+    std::shared_lock lock{impl_->buffers_mutex};
+    auto const* p = impl_->buffers.get<1>(handle);
+    return p ? *p : nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Textures
+// -------------------------------------------------------------------------------------------------
+auto GlDevice::create_textures(std::span<TextureDesc const> descs,
+                               std::span<TextureHandle>     out) noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    return create_batch<TexturePool, TextureRow>(*impl_, impl_->textures, impl_->textures_mutex,
+                                                 descs, out, make_texture, release_texture);
+}
+
+void GlDevice::destroy_textures(std::span<TextureHandle const> handles) noexcept {
+    std::unique_lock lock{impl_->textures_mutex};
+    for (TextureHandle h : handles) {
+        if (auto row = impl_->textures.extract(h))
+            defer_release(*impl_, impl_->deferred.textures, std::move(*row));
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Bindless heap
+// -------------------------------------------------------------------------------------------------
+void GlDevice::bindless_heap_info(BindlessHeapInfo& out) const noexcept {
+    auto const& ctx = impl_->bindless;
+    out = {};
+    out.enabled = true;
+    std::scoped_lock lock{ctx.mutex};
+    for (uint32_t c = 0; c < k_bindless_class_count; ++c) {
+        out.capacity[c] = ctx.tables[c].capacity;
+        out.used[c]     = ctx.tables[c].used;
+    }
+}
+
+auto GlDevice::find_samplers(std::span<SamplerDesc const> descs, std::span<uint32_t> out) noexcept -> Status {
+    std::ranges::fill(out.first(std::min(descs.size(), out.size())), k_invalid_bindless_index);
+    return Status::MissingRequiredFeature;
+}
+
+auto GlDevice::bindless_index(BufferHandle handle) const noexcept -> uint32_t {
+    std::shared_lock lock{impl_->buffers_mutex};
+    auto const* index = impl_->buffers.get<2>(handle);
+    return index ? *index : k_invalid_bindless_index;
+}
+
+auto GlDevice::bindless_index(TextureHandle handle, BindlessClass cls) const noexcept -> uint32_t {
+    std::shared_lock lock{impl_->textures_mutex};
+    auto const* s = impl_->textures.get<2>(handle);
+    if (!s) return k_invalid_bindless_index;
+    switch (cls) {
+        case BindlessClass::SampledTexture: return s->sampled;
+        case BindlessClass::StorageTexture: return s->storage;
+        default:                            return k_invalid_bindless_index;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Device memory
+// -------------------------------------------------------------------------------------------------
+void GlDevice::memory_budget(MemoryBudget& out) const noexcept {
+    auto const& impl = *impl_;
+    out = {};
+
+    uint64_t const allocated = impl.allocated_bytes.load(std::memory_order_relaxed);
+    uint64_t const total     = impl.driver_total_bytes.load(std::memory_order_relaxed);
+    uint64_t const available = impl.driver_available_bytes.load(std::memory_order_relaxed);
+
+    MemoryHeapBudget& heap = out.heaps[0];
+    heap.deviceLocal     = true;
+    heap.blockBytes      = allocated;
+    heap.allocationBytes = allocated;
+    if (total > 0) {
+        heap.size   = total;
+        heap.budget = total;
+        heap.usage  = total - std::min(available, total);
+    } else {
+        heap.size   = std::max(impl.info.video_memory_bytes, allocated);
+        heap.budget = heap.size;
+        heap.usage  = allocated;
+    }
+    out.heapCount = 1;
+
+    std::size_t resources = 0;
+    {
+        std::shared_lock lock{impl.buffers_mutex};
+        resources += impl.buffers.size();
+    }
+    {
+        std::shared_lock lock{impl.textures_mutex};
+        resources += impl.textures.size();
+    }
+    // Every GL object is its own driver allocation, without a limit.
+    out.resourceCount        = static_cast<uint32_t>(resources);
+    out.deviceMemoryCount    = out.resourceCount;
+    out.maxDeviceMemoryCount = UINT32_MAX;
+}
+
+} // namespace wren::rhi::opengl
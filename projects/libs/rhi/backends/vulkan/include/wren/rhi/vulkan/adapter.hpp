@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -50,16 +51,26 @@ enum class AdapterKind : uint8_t {
 // For integrated GPUs sharing system RAM this value may be zero or reflect
 // the shared aperture, not total system RAM.
 //
+// vendor_id, device_id, driver_version and pipeline_cache_uuid together key
+// anything persisted per GPU, such as the on-disk pipeline cache.
+//
+// device_group numbers the VkPhysicalDeviceGroup the adapter belongs to;
+// linked GPUs share one and can back a single device (DeviceFlag::DeviceGroup).
 // -------------------------------------------------------------------------------------------------
 struct WREN_RHI_VULKAN_EXPORT AdapterInfo {
-    uint32_t     index;               ///< Zero-based index in the instance's physical device list.
-    std::string  name;                ///< VkPhysicalDeviceProperties::deviceName
-    AdapterKind  kind;                ///< Integrated / Discrete / Virtual / CPU / Other
-    uint64_t     video_memory_bytes;  ///< Approximate DEVICE_LOCAL heap size in bytes.
-    uint32_t     driver_version;      ///< Raw VkPhysicalDeviceProperties::driverVersion.
-    uint32_t     api_version_major;   ///< Supported Vulkan API major version.
-    uint32_t     api_version_minor;   ///< Supported Vulkan API minor version.
-    Capabilities capabilities;        ///< Feature flags + numeric limits snapshot.
+    uint32_t                index;                ///< Zero-based index in the instance's physical device list.
+    std::string             name;                 ///< VkPhysicalDeviceProperties::deviceName
+    AdapterKind             kind;                 ///< Integrated / Discrete / Virtual / CPU / Other
+    uint64_t                video_memory_bytes;   ///< Approximate DEVICE_LOCAL heap size in bytes.
+    uint32_t                vendor_id;            ///< VkPhysicalDeviceProperties::vendorID (PCI vendor).
+    uint32_t                device_id;            ///< VkPhysicalDeviceProperties::deviceID.
+    uint32_t                driver_version;       ///< Raw VkPhysicalDeviceProperties::driverVersion.
+    std::array<uint8_t, 16> pipeline_cache_uuid;  ///< Changes whenever the driver's cache format does.
+    uint32_t                api_version_major;    ///< Supported Vulkan API major version.
+    uint32_t                api_version_minor;    ///< Supported Vulkan API minor version.
+    uint32_t                device_group;         ///< Index in vkEnumeratePhysicalDeviceGroups.
+    uint32_t                device_group_size;    ///< Physical devices in that group, this one included.
+    Capabilities            capabilities;         ///< Feature flags + numeric limits snapshot.
 };
 
 } // namespace wren::rhi::vulkan
@@ -3,9 +3,13 @@
 #include <cstdint>
 #include <expected>
 #include <memory>
+#include <span>
 #include <string>
 
+#include <wren/rhi/api/commands.hpp>
 #include <wren/rhi/api/features.hpp>
+#include <wren/rhi/api/pipelines.hpp>
+#include <wren/rhi/api/resources.hpp>
 #include <wren/rhi/api/status.hpp>
 #include <wren/rhi/vulkan/adapter.hpp>
 #include <wren/rhi/vulkan/export.hpp>
@@ -62,13 +66,99 @@ struct DeviceCreateError {
 //   VulkanDevice does NOT create a VkSurfaceKHR. Presentation capability is
 //   indicated through Feature::Presentation in the resolved capabilities, which
 //   reflects whether VK_KHR_swapchain is available on the selected device.
-//   The surface and swapchain are created by a higher-level presentation layer
-//   that may depend on the platform (Win32, Xlib, Wayland, etc.).
+//   Surfaces and swapchains belong to the backend's presentation entry points
+//   (swapchain.cpp), which build on the device's texture pool and graphics
+//   timeline; only src/surface.cpp sees the platform headers.
+//
+// Command recording:
+//   Every recording thread draws from its own VkCommandPool per queue family
+//   and frame-in-flight, so lists are begun and recorded on many threads
+//   without locks. Submitted lists are batched and flushed by end_frame()
+//   with a single vkQueueSubmit2 per queue.
+//
+// Scheduling:
+//   Each queue owns a timeline semaphore and every submission signals the
+//   next value on it. Frames in flight are throttled by CPU waits on the
+//   values a frame slot reached, and cross-queue dependencies are timeline
+//   waits, so no fences or binary semaphores are created per frame.
+//
+// Resources:
+//   Buffers and textures live in generational slot maps owned by the device
+//   and are addressed by BufferHandle / TextureHandle. Creation takes spans so
+//   the vtable can forward a whole batch in one call, and is all-or-nothing.
+//   Resources still alive when the device is destroyed are released with it.
+//   Their memory is sub-allocated from large per-memory-type blocks; large
+//   render targets and resources the driver wants dedicated get their own.
+//   Textures can instead be placed into caller-managed memory heaps, where
+//   textures with non-overlapping lifetimes alias.
+//
+// Pipeline cache:
+//   Pipelines are created through one VkPipelineCache. With
+//   DeviceDesc::pipelineCacheDirectory set it is seeded from a memory-mapped
+//   file keyed by vendor, device, driver version and pipelineCacheUUID, and
+//   written back on destruction; stale or corrupt files are ignored.
+//
+// Bindless heap:
+//   With Feature::DescriptorIndexing_Bindless, one update-after-bind
+//   descriptor set (or, with Feature::DescriptorBuffer, a mapped descriptor
+//   buffer) holds every sampled and storage texture and storage buffer at a
+//   free-list index assigned at creation. Every pipeline shares one layout
+//   over it plus a push constant range, and begin_command_list() binds it,
+//   so no per-draw descriptor work remains.
+//
+// Shader modules:
+//   One VkShaderModule per distinct SPIR-V, found by a 64-bit hash of the
+//   code and shared by every handle and pipeline that uses it. The code is
+//   reflected once, when it first arrives, and read in place without a
+//   copy. Raw code in pipeline descriptors is looked up the same way.
+//
+// Pipelines:
+//   Creation copies the descriptors and returns handles at once; the
+//   compiles run on DeviceDesc::jobSystem workers, or inline without one.
+//   Binding a pipeline that is still pending draws with its fallback and
+//   moves it to the front of the queue, or compiles it on the spot. With
+//   VK_EXT_graphics_pipeline_library, shared parts are fast-linked first
+//   and an optimised link replaces the result in the background.
+//
+// Destruction:
+//   destroy_*() detaches the objects from their pool under the pool's
+//   exclusive lock, which invalidates the handles at once, then pushes them
+//   onto a lock-free deferred queue, tagged with each queue's last timeline
+//   value. Only that queue is lock-free: a destroy briefly excludes handle
+//   lookups on the same pool. begin_frame() destroys every batch the GPU has
+//   passed, so releases never wait for the device, and neither does
+//   resize_swapchain().
+//
+// Sparse binding:
+//   bind_sparse() batches join the scheduler's queue like submissions and
+//   become vkQueueBindSparse calls at end_frame(), on the first of the
+//   transfer, compute and graphics families that supports sparse binding.
+//   They signal that queue's timeline, so the SyncPoints they return are
+//   waited on like any other.
+//
+// Acceleration structures:
+//   Each structure sits at offset 0 of a buffer of its own, sub-allocated
+//   like any other, so destroying one returns its memory. GPU builds of a
+//   batch go to the driver in one vkCmdBuildAccelerationStructuresKHR call.
+//   Host builds run as one VkDeferredOperationKHR per call, joined by as
+//   many DeviceDesc::jobSystem workers as the driver can use. Compacted
+//   sizes come from a query pool per frame slot that the recording list
+//   resets and copies into the caller's buffer.
+//
+// Profiling:
+//   Profiling regions write timestamps into one query pool per frame slot
+//   (hostQueryReset, so lists never reset queries) and push a debug label
+//   of the same name. begin_frame() reads back the slot after waiting for
+//   it, without VK_QUERY_RESULT_WAIT_BIT, scales the ticks by
+//   timestampPeriod and, with VK_EXT_calibrated_timestamps, maps them onto
+//   the host's steady clock.
 //
 // Thread-safety:
 //   Construction and destruction must happen on a single thread.
 //   Query methods (capabilities(), queue_family_indices()) are const and
-//   safe to call from any thread.
+//   safe to call from any thread. Resource creation, destruction and handle
+//   lookup are thread-safe, as are beginning, recording and submitting
+//   command lists. begin_frame() / end_frame() belong to the frame thread.
 // -------------------------------------------------------------------------------------------------
 class WREN_RHI_VULKAN_EXPORT VulkanDevice {
 public:
@@ -112,6 +202,241 @@ public:
     /// Returns the queue family indices selected during device creation.
     [[nodiscard]] auto queue_family_indices() const noexcept -> QueueFamilyIndices const&;
 
+    // -----------------------------------------------------------------
+    // Resources
+    // -----------------------------------------------------------------
+
+    /// Creates one buffer per element of @p descs into the matching element of
+    /// @p out (which must be at least as long). On failure nothing is created,
+    /// @p out is filled with null handles and the first error is returned.
+    [[nodiscard]] auto create_buffers(std::span<BufferDesc const> descs,
+                                      std::span<BufferHandle>     out) noexcept -> Status;
+
+    /// Destroys every live buffer in @p handles; null and stale handles are skipped.
+    /// The handles go stale at once, the buffers once the GPU has finished
+    /// everything submitted before the call. Takes the buffer pool's
+    /// exclusive lock for the whole batch, so pass handles in bulk.
+    void destroy_buffers(std::span<BufferHandle const> handles) noexcept;
+
+    /// Texture counterpart of create_buffers(). Each texture also gets a
+    /// default view covering all of its mips and layers.
+    [[nodiscard]] auto create_textures(std::span<TextureDesc const> descs,
+                                       std::span<TextureHandle>     out) noexcept -> Status;
+
+    /// Destroys every live texture in @p handles, deferred like
+    /// destroy_buffers(); null and stale handles are skipped.
+    void destroy_textures(std::span<TextureHandle const> handles) noexcept;
+
+    /// Handle resolution. Return null Vulkan handles for null or stale handles.
+    [[nodiscard]] auto buffer(BufferHandle handle) const noexcept -> vk::Buffer;
+    [[nodiscard]] auto buffer_mapping(BufferHandle handle) const noexcept -> void*;
+    /// vkGetBufferDeviceAddress; 0 without Feature::BufferDeviceAddress.
+    [[nodiscard]] auto buffer_device_address(BufferHandle handle) const noexcept -> uint64_t;
+    [[nodiscard]] auto image(TextureHandle handle) const noexcept -> vk::Image;
+    [[nodiscard]] auto image_view(TextureHandle handle) const noexcept -> vk::ImageView;
+
+    // -----------------------------------------------------------------
+    // Bindless heap (thread-safe)
+    // -----------------------------------------------------------------
+
+    /// Mode, capacity and occupancy of the heap; all zero when disabled.
+    void bindless_heap_info(BindlessHeapInfo& out) const noexcept;
+
+    /// Sampler-array indices for @p descs, creating the samplers not seen
+    /// before (bindless.cpp). Thread-safe; repeated lookups take a shared
+    /// lock only.
+    [[nodiscard]] auto find_samplers(std::span<SamplerDesc const> descs, std::span<uint32_t> out) noexcept
+        -> Status;
+
+    /// Heap index of a storage buffer, or of a texture in the array @p cls
+    /// names; k_invalid_bindless_index for resources outside it.
+    [[nodiscard]] auto bindless_index(BufferHandle handle) const noexcept -> uint32_t;
+    [[nodiscard]] auto bindless_index(TextureHandle handle, BindlessClass cls) const noexcept -> uint32_t;
+
+    // -----------------------------------------------------------------
+    // Device memory
+    // -----------------------------------------------------------------
+
+    /// Per-heap budget and usage; driver-reported with VK_EXT_memory_budget,
+    /// estimated otherwise. Thread-safe.
+    void memory_budget(MemoryBudget& out) const noexcept;
+
+    /// Moves GPU-only buffers out of sparsely used blocks and frees the blocks
+    /// that end up empty. Waits for the device to go idle. Frame thread only,
+    /// outside begin_frame() / end_frame(); no other thread may use the device.
+    [[nodiscard]] auto defragment_memory(DefragmentDesc const& desc, DefragmentStats& out) noexcept
+        -> Status;
+
+    /// Size, alignment and compatible memory types of each texture in
+    /// @p descs, queried without creating images. Thread-safe.
+    [[nodiscard]] auto texture_memory_requirements(std::span<TextureDesc const> descs,
+                                                   std::span<MemoryRequirements> out) const noexcept
+        -> Status;
+
+    /// Aliasing heaps for placed textures; all-or-nothing as create_buffers().
+    /// Thread-safe.
+    [[nodiscard]] auto create_memory_heaps(std::span<MemoryHeapDesc const> descs,
+                                           std::span<HeapHandle>           out) noexcept -> Status;
+
+    /// Frees every live heap in @p handles, deferred like destroy_buffers().
+    /// Destroy the textures placed in them first. Thread-safe.
+    void destroy_memory_heaps(std::span<HeapHandle const> handles) noexcept;
+
+    /// Page granularity, page size and mip tail of a sparse texture, from
+    /// vkGetImageSparseMemoryRequirements. Thread-safe.
+    [[nodiscard]] auto sparse_texture_info(TextureHandle texture, SparseTextureInfo& out) const noexcept
+        -> Status;
+
+    // -----------------------------------------------------------------
+    // Acceleration structures (acceleration_structures.cpp; pools in resources.cpp)
+    // -----------------------------------------------------------------
+
+    /// vkGetAccelerationStructureBuildSizesKHR for the type, flags and counts
+    /// of @p inputs. MissingRequiredFeature without Feature::RayTracing.
+    /// Thread-safe.
+    [[nodiscard]] auto acceleration_structure_sizes(AccelerationStructureInputs const& inputs,
+                                                    AccelerationStructureSizes&        out) const noexcept
+        -> Status;
+
+    /// Creates one structure, with a backing buffer of desc.size bytes, per
+    /// element of @p descs; all-or-nothing as create_buffers(). Thread-safe.
+    [[nodiscard]] auto create_acceleration_structures(std::span<AccelerationStructureDesc const> descs,
+                                                      std::span<AccelerationStructureHandle>     out) noexcept
+        -> Status;
+
+    /// Destroys every live structure in @p handles, deferred like
+    /// destroy_buffers(). Thread-safe.
+    void destroy_acceleration_structures(std::span<AccelerationStructureHandle const> handles) noexcept;
+
+    /// Handle resolution; null for null or stale handles.
+    [[nodiscard]] auto acceleration_structure(AccelerationStructureHandle handle) const noexcept
+        -> vk::AccelerationStructureKHR;
+    /// Device address of a GpuOnly structure, the VkAccelerationStructureKHR
+    /// handle value of an Upload one; 0 for null or stale handles.
+    [[nodiscard]] auto acceleration_structure_reference(AccelerationStructureHandle handle) const noexcept
+        -> uint64_t;
+
+    /// Builds on the host with a deferred operation spread over the job
+    /// system; returns when every build is done. Thread-safe.
+    [[nodiscard]] auto build_acceleration_structures_on_host(std::span<AccelerationStructureBuild const> builds) noexcept
+        -> Status;
+
+    // -----------------------------------------------------------------
+    // Shader modules
+    // -----------------------------------------------------------------
+
+    /// Reflects and creates one module per element of @p descs into @p out
+    /// (which must be at least as long), sharing the VkShaderModule of
+    /// identical code already loaded. On failure nothing is created and
+    /// @p out is filled with null handles. Thread-safe.
+    [[nodiscard]] auto create_shader_modules(std::span<ShaderModuleDesc const> descs,
+                                             std::span<ShaderModuleHandle>     out) noexcept -> Status;
+
+    /// Releases every live handle in @p handles; null and stale handles are
+    /// skipped. Thread-safe.
+    void destroy_shader_modules(std::span<ShaderModuleHandle const> handles) noexcept;
+
+    /// Reflection parsed when @p handle was created. Thread-safe.
+    [[nodiscard]] auto shader_module_reflection(ShaderModuleHandle handle, ShaderReflection& out) const noexcept
+        -> Status;
+
+    // -----------------------------------------------------------------
+    // Pipeline cache
+    // -----------------------------------------------------------------
+
+    /// Hit / miss counters and load state of the pipeline cache, and the
+    /// shader module cache counters. Thread-safe.
+    void pipeline_cache_stats(PipelineCacheStats& out) const noexcept;
+
+    /// Writes the cache to DeviceDesc::pipelineCacheDirectory if it grew
+    /// since the last save; also done on destruction. Thread-safe.
+    [[nodiscard]] auto save_pipeline_cache() noexcept -> Status;
+
+    // -----------------------------------------------------------------
+    // Pipelines
+    // -----------------------------------------------------------------
+
+    /// Validates every element of @p descs and queues one pipeline per element
+    /// into @p out (which must be at least as long). On failure nothing is
+    /// created and @p out is filled with null handles. A pipeline the driver
+    /// rejects later reports PipelineStatus::Failed. Thread-safe.
+    [[nodiscard]] auto create_graphics_pipelines(std::span<GraphicsPipelineDesc const> descs,
+                                                 std::span<PipelineHandle>             out) noexcept
+        -> Status;
+
+    /// Compute counterpart of create_graphics_pipelines().
+    [[nodiscard]] auto create_compute_pipelines(std::span<ComputePipelineDesc const> descs,
+                                                std::span<PipelineHandle>            out) noexcept
+        -> Status;
+
+    /// Destroys every live pipeline in @p handles, deferred like
+    /// destroy_buffers(), or abandons its compile; null and stale handles
+    /// are skipped.
+    void destroy_pipelines(std::span<PipelineHandle const> handles) noexcept;
+
+    /// Compile state of @p handle; Failed for null and stale handles. Thread-safe.
+    [[nodiscard]] auto pipeline_status(PipelineHandle handle) const noexcept -> PipelineStatus;
+
+    /// Moves the still-queued pipelines in @p handles to the front of the
+    /// compile queue, first handle first. Each pipeline moves at most once.
+    void prioritize_pipelines(std::span<PipelineHandle const> handles) noexcept;
+
+    /// Blocks until every pipeline in @p handles is compiled, compiling queued
+    /// ones on the calling thread. InternalError if any failed or was stale.
+    [[nodiscard]] auto wait_pipelines(std::span<PipelineHandle const> handles) noexcept -> Status;
+
+    // -----------------------------------------------------------------
+    // Frames & command lists
+    // -----------------------------------------------------------------
+
+    /// Advances to the next frame-in-flight slot, blocks until the GPU has
+    /// reached the timeline values the slot recorded when it last ended,
+    /// resets its command pools and destroys the deferred releases the GPU
+    /// has finished with. Frame thread only; no list may be recording.
+    [[nodiscard]] auto begin_frame() noexcept -> Status;
+
+    /// Flushes every submission queued since begin_frame(): one
+    /// vkQueueSubmit2 per queue. Frame thread only.
+    [[nodiscard]] auto end_frame() noexcept -> Status;
+
+    /// Monotonic frame counter; 0 before the first begin_frame().
+    [[nodiscard]] auto frame_number() const noexcept -> uint64_t;
+
+    /// Profiling regions begin_frame() last read back, framesInFlight frames
+    /// old; valid until the next begin_frame(). Frame thread only.
+    void profile_frame(ProfileFrame& out) const noexcept;
+
+    /// Begins a list from the calling thread's pool for the current frame.
+    /// Thread-safe and lock-free after the thread's first call in a frame slot.
+    /// Status::OutOfMemory once k_max_recording_threads other threads have
+    /// claimed a pool on this device.
+    [[nodiscard]] auto begin_command_list(CommandListDesc const& desc,
+                                          CommandListHandle&     out) noexcept -> Status;
+
+    /// Ends recording of @p list.
+    [[nodiscard]] static auto end_command_list(CommandListHandle list) noexcept -> Status;
+
+    /// Queues one submission for end_frame() and assigns it the next value
+    /// on its queue's timeline, written to @p out. Thread-safe.
+    [[nodiscard]] auto submit(SubmitDesc const& desc, SyncPoint& out) noexcept -> Status;
+
+    /// Queues one vkQueueBindSparse batch for end_frame() on the sparse
+    /// binding queue and assigns it the next value on that queue's timeline.
+    /// Thread-safe.
+    [[nodiscard]] auto bind_sparse(SparseBindDesc const& desc, SyncPoint& out) noexcept -> Status;
+
+    // -----------------------------------------------------------------
+    // Timelines (thread-safe)
+    // -----------------------------------------------------------------
+
+    /// Blocks until every point is reached; Status::Timeout if @p timeout_ns
+    /// elapses first.
+    [[nodiscard]] auto wait(std::span<SyncPoint const> points,
+                            uint64_t                   timeout_ns) const noexcept -> Status;
+
+    /// Last value the GPU has reached on @p queue's timeline.
+    [[nodiscard]] auto completed_value(QueueType queue) const noexcept -> uint64_t;
+
     // -----------------------------------------------------------------
     // Internal (used by higher-level RHI objects built on top)
     // -----------------------------------------------------------------
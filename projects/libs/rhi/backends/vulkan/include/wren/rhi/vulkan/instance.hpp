@@ -16,14 +16,14 @@ namespace wren::rhi::vulkan {
 // -------------------------------------------------------------------------------------------------
 // Options for Vulkan instance creation.
 //
-// No surface or presentation extensions are requested here — those are the
-// responsibility of the platform/presentation layer, keeping this factory
-// usable in headless / off-screen workloads.
+// Surface extensions are only requested with enable_presentation, keeping
+// headless / off-screen instances free of window-system dependencies.
 // -------------------------------------------------------------------------------------------------
 struct InstanceConfig {
     std::string_view application_name    = "wren";
     uint32_t         application_version = 0;      ///< Pack with VK_MAKE_VERSION(maj,min,patch).
     bool             enable_debug        = false;  ///< Request validation layers + debug utils extension.
+    bool             enable_presentation = false;  ///< Request VK_KHR_surface + the platform surface extensions.
 };
 
 // -------------------------------------------------------------------------------------------------
@@ -35,6 +35,8 @@ struct InstanceConfig {
 //
 // Validation layers are activated when cfg.enable_debug is true and
 // VK_LAYER_KHRONOS_validation is available; absence is logged but non-fatal.
+// The same holds for the surface extensions of cfg.enable_presentation:
+// those missing only rule out swapchains on their window system.
 //
 // @returns The instance on success, or a human-readable error string.
 // -------------------------------------------------------------------------------------------------
@@ -57,9 +59,12 @@ auto create_debug_messenger(vk::raii::Instance& instance)
 //
 // Intended to be called before VulkanDevice::create() so the application
 // can inspect and choose a GPU without committing to a logical device.
+// The driver is queried once per GPU and process; the device created
+// afterwards reuses those queries. @p cache_directory, when set, is the
+// on-disk capability cache described on DeviceDesc::capabilityCacheDirectory.
 // -------------------------------------------------------------------------------------------------
 [[nodiscard]] WREN_RHI_VULKAN_EXPORT
-auto enumerate_adapters(vk::raii::Instance const& instance)
+auto enumerate_adapters(vk::raii::Instance const& instance, const char* cache_directory = nullptr)
     -> std::vector<AdapterInfo>;
 
 } // namespace wren::rhi::vulkan
@@ -0,0 +1,563 @@
+#include <wren/rhi/vulkan/device.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <span>
+#include <vector>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/foundation/jobs/job_system.hpp>
+#include <wren/foundation/memory/align.hpp>
+
+#include "vk_acceleration_structures.hpp"
+#include "vk_commands.hpp"
+#include "vk_convert.hpp"
+#include "vk_device_impl.hpp"
+
+namespace wren::rhi::vulkan {
+
+namespace {
+
+// -----------------------------------------------------------------
+// Build inputs
+//
+// AccelerationStructureInputs become the geometry arrays, build ranges and
+// primitive counts of VK_KHR_acceleration_structure. One BuildArrays holds
+// every build of a call; the infos point into it only once all of them
+// have been appended, as the vectors move while they grow.
+// -----------------------------------------------------------------
+enum class AddressSpace : uint8_t {
+    None,    // size queries: addresses are ignored
+    Device,  // GPU builds: buffer device addresses
+    Host     // host builds: persistent mappings of Upload buffers
+};
+
+struct BuildArrays {
+    std::vector<VkAccelerationStructureBuildGeometryInfoKHR> infos;
+    std::vector<VkAccelerationStructureGeometryKHR>          geometries;
+    std::vector<VkAccelerationStructureBuildRangeInfoKHR>    ranges;
+    std::vector<VkAccelerationStructureBuildRangeInfoKHR const*> range_pointers;
+    std::vector<uint32_t>                                    max_primitives;
+    std::vector<uint32_t>                                    first_geometry;  // per info
+
+    void clear() noexcept {
+        infos.clear();
+        geometries.clear();
+        ranges.clear();
+        range_pointers.clear();
+        max_primitives.clear();
+        first_geometry.clear();
+    }
+
+    /// Points every info at its geometries and ranges. Call once the last
+    /// build has been appended.
+    void link() {
+        range_pointers.resize(infos.size());
+        for (std::size_t i = 0; i < infos.size(); ++i) {
+            infos[i].pGeometries = geometries.data() + first_geometry[i];
+            range_pointers[i]    = ranges.data() + first_geometry[i];
+        }
+    }
+};
+
+/// Reused by every recording on the thread, so GPU builds allocate only
+/// while a thread meets its largest batch yet.
+thread_local BuildArrays t_build_arrays;
+
+/// @p buffer's address at @p offset, 0 for a null handle (optional inputs).
+/// The caller holds buffers_mutex. False for a stale handle, or an unmapped
+/// buffer on the host.
+[[nodiscard]] bool input_address(VulkanDevice::Impl const& impl, AddressSpace space, BufferHandle buffer,
+                                 uint64_t offset, VkDeviceOrHostAddressConstKHR& out) noexcept
+{
+    out.deviceAddress = 0;
+    if (!buffer || space == AddressSpace::None)
+        return true;
+    if (space == AddressSpace::Host) {
+        void* const* mapped = impl.buffers.get<1>(buffer);
+        if (!mapped || !*mapped)
+            return false;
+        out.hostAddress = static_cast<std::byte const*>(*mapped) + offset;
+        return true;
+    }
+    auto const* b = impl.buffers.get<0>(buffer);
+    if (!b)
+        return false;
+    VkBufferDeviceAddressInfo const info{
+        .sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+        .pNext  = nullptr,
+        .buffer = static_cast<VkBuffer>(*b),
+    };
+    out.deviceAddress = impl.device.getDispatcher()->vkGetBufferDeviceAddress(
+        static_cast<VkDevice>(*impl.device), &info) + offset;
+    return true;
+}
+
+/// Appends the geometries of @p inputs and an info without structures or
+/// scratch. The caller holds buffers_mutex. InvalidArgument for
+/// inconsistent inputs or stale buffers.
+[[nodiscard]] Status append_inputs(VulkanDevice::Impl const& impl, AddressSpace space,
+                                   AccelerationStructureInputs const& in, BuildArrays& out)
+{
+    bool const top = in.type == AccelerationStructureType::TopLevel;
+    if (top ? (!in.instanceBuffer && space != AddressSpace::None) || in.instanceOffset % 16 != 0
+            : in.triangleCount == 0 || !in.triangles)
+        return Status::InvalidArgument;
+
+    auto const first = static_cast<uint32_t>(out.geometries.size());
+    if (top) {
+        VkAccelerationStructureGeometryKHR geometry{
+            .sType        = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR,
+            .pNext        = nullptr,
+            .geometryType = VK_GEOMETRY_TYPE_INSTANCES_KHR,
+            .geometry     = {},
+            .flags        = 0,
+        };
+        geometry.geometry.instances = VkAccelerationStructureGeometryInstancesDataKHR{
+            .sType           = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
+            .pNext           = nullptr,
+            .arrayOfPointers = VK_FALSE,
+            .data            = {},
+        };
+        if (!input_address(impl, space, in.instanceBuffer, in.instanceOffset, geometry.geometry.instances.data))
+            return Status::InvalidArgument;
+        out.geometries.push_back(geometry);
+        out.ranges.push_back({.primitiveCount = in.instanceCount, .primitiveOffset = 0,
+                              .firstVertex = 0, .transformOffset = 0});
+        out.max_primitives.push_back(in.instanceCount);
+    } else {
+        for (AccelerationStructureTriangles const& t : std::span{in.triangles, in.triangleCount}) {
+            // Acceleration structures take 16- and 32-bit indices only.
+            if (!t.vertexBuffer || (t.indexBuffer && t.indexType == IndexType::Uint8))
+                return Status::InvalidArgument;
+
+            VkAccelerationStructureGeometryTrianglesDataKHR triangles{
+                .sType         = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR,
+                .pNext         = nullptr,
+                .vertexFormat  = static_cast<VkFormat>(detail::to_vk(t.vertexFormat)),
+                .vertexData    = {},
+                .vertexStride  = t.vertexStride,
+                .maxVertex     = t.vertexCount > 0 ? t.vertexCount - 1 : 0,
+                .indexType     = t.indexBuffer ? static_cast<VkIndexType>(detail::to_vk(t.indexType))
+                                               : VK_INDEX_TYPE_NONE_KHR,
+                .indexData     = {},
+                .transformData = {},
+            };
+            if (!input_address(impl, space, t.vertexBuffer, t.vertexOffset, triangles.vertexData) ||
+                !input_address(impl, space, t.indexBuffer, t.indexOffset, triangles.indexData) ||
+                !input_address(impl, space, t.transformBuffer, t.transformOffset, triangles.transformData))
+                return Status::InvalidArgument;
+
+            VkAccelerationStructureGeometryKHR geometry{
+                .sType        = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR,
+                .pNext        = nullptr,
+                .geometryType = VK_GEOMETRY_TYPE_TRIANGLES_KHR,
+                .geometry     = {},
+                .flags        = t.opaque ? VkGeometryFlagsKHR{VK_GEOMETRY_OPAQUE_BIT_KHR} : VkGeometryFlagsKHR{0},
+            };
+            geometry.geometry.triangles = triangles;
+            out.geometries.push_back(geometry);
+            out.ranges.push_back({.primitiveCount = t.triangleCount, .primitiveOffset = 0,
+                                  .firstVertex = 0, .transformOffset = 0});
+            out.max_primitives.push_back(t.triangleCount);
+        }
+    }
+
+    out.first_geometry.push_back(first);
+    out.infos.push_back(VkAccelerationStructureBuildGeometryInfoKHR{
+        .sType                    = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR,
+        .pNext                    = nullptr,
+        .type                     = top ? VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR
+                                        : VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR,
+        .flags                    = static_cast<VkBuildAccelerationStructureFlagsKHR>(detail::to_vk(in.flags)),
+        .mode                     = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR,
+        .srcAccelerationStructure = VK_NULL_HANDLE,
+        .dstAccelerationStructure = VK_NULL_HANDLE,
+        .geometryCount            = static_cast<uint32_t>(out.geometries.size()) - first,
+        .pGeometries              = nullptr,
+        .ppGeometries             = nullptr,
+        .scratchData              = {},
+    });
+    return Status::Ok;
+}
+
+/// Appends every build of @p builds, structures included, to @p out: the
+/// buffer and structure locks are taken once for the whole batch.
+/// InvalidArgument for bad inputs, stale handles, an update without
+/// AllowUpdate, or a host build into a GpuOnly structure.
+[[nodiscard]] Status append_builds(VulkanDevice::Impl const& impl, AddressSpace space,
+                                   std::span<AccelerationStructureBuild const> builds, BuildArrays& out)
+{
+    std::shared_lock buffer_lock{impl.buffers_mutex};
+    std::shared_lock structure_lock{impl.acceleration_structures_mutex};
+    for (AccelerationStructureBuild const& b : builds) {
+        if (Status s = append_inputs(impl, space, b.inputs, out); s != Status::Ok)
+            return s;
+
+        bool const update = b.mode == AccelerationStructureBuildMode::Update;
+        auto const* dst   = impl.acceleration_structures.get<0>(b.destination);
+        auto const* src   = update ? impl.acceleration_structures.get<0>(b.source) : nullptr;
+        if (!dst || (update && (!src || underlying(b.inputs.flags & AccelerationStructureFlags::AllowUpdate) == 0)))
+            return Status::InvalidArgument;
+        bool const host = impl.acceleration_structures.get<4>(b.destination)->memory == MemoryUsage::Upload;
+        if (host != (space == AddressSpace::Host))
+            return Status::InvalidArgument;
+
+        auto& info = out.infos.back();
+        info.mode  = update ? VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR
+                            : VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
+        info.dstAccelerationStructure = static_cast<VkAccelerationStructureKHR>(*dst);
+        info.srcAccelerationStructure = src ? static_cast<VkAccelerationStructureKHR>(*src) : VK_NULL_HANDLE;
+
+        if (space == AddressSpace::Device) {
+            VkDeviceOrHostAddressConstKHR scratch{};
+            if (!b.scratch || !input_address(impl, space, b.scratch, b.scratchOffset, scratch))
+                return Status::InvalidArgument;
+            assert(scratch.deviceAddress % impl.raytracing.scratch_alignment == 0 &&
+                   "scratch offset breaks accelerationStructureScratchAlignment");
+            info.scratchData.deviceAddress = scratch.deviceAddress;
+        }
+    }
+    return Status::Ok;
+}
+
+/// The scratch sizes of @p info, whose geometries are linked.
+[[nodiscard]] VkAccelerationStructureBuildSizesInfoKHR build_sizes(
+    VulkanDevice::Impl const& impl, VkAccelerationStructureBuildTypeKHR type,
+    VkAccelerationStructureBuildGeometryInfoKHR const& info, uint32_t const* max_primitives) noexcept
+{
+    VkAccelerationStructureBuildSizesInfoKHR sizes{
+        .sType                     = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR,
+        .pNext                     = nullptr,
+        .accelerationStructureSize = 0,
+        .updateScratchSize         = 0,
+        .buildScratchSize          = 0,
+    };
+    impl.device.getDispatcher()->vkGetAccelerationStructureBuildSizesKHR(
+        static_cast<VkDevice>(*impl.device), type, &info, max_primitives, &sizes);
+    return sizes;
+}
+
+void memory_barrier(CommandListState const& list, VkPipelineStageFlags2 src_stages, VkAccessFlags2 src_access,
+                    VkPipelineStageFlags2 dst_stages, VkAccessFlags2 dst_access) noexcept
+{
+    VkMemoryBarrier2 const barrier{
+        .sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2,
+        .pNext         = nullptr,
+        .srcStageMask  = src_stages,
+        .srcAccessMask = src_access,
+        .dstStageMask  = dst_stages,
+        .dstAccessMask = dst_access,
+    };
+    VkDependencyInfo const info{
+        .sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+        .pNext                    = nullptr,
+        .dependencyFlags          = 0,
+        .memoryBarrierCount       = 1,
+        .pMemoryBarriers          = &barrier,
+        .bufferMemoryBarrierCount = 0,
+        .pBufferMemoryBarriers    = nullptr,
+        .imageMemoryBarrierCount  = 0,
+        .pImageMemoryBarriers     = nullptr,
+    };
+    list.dispatch->vkCmdPipelineBarrier2(list.cmd, &info);
+}
+
+/// Orders builds and copies after earlier work on the queue, which may
+/// still trace the structures they overwrite.
+void structure_overwrite_barrier(CommandListState const& list) noexcept {
+    memory_barrier(list, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, VK_ACCESS_2_NONE,
+                   VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_ACCESS_2_NONE);
+}
+
+/// Makes the structures written before it visible to later builds,
+/// copies and queries, ray tracing and shader reads, and orders later
+/// scratch writes after the earlier ones.
+void structure_write_barrier(CommandListState const& list) noexcept {
+    memory_barrier(list, VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                   VK_ACCESS_2_ACCELERATION_STRUCTURE_WRITE_BIT_KHR, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                   VK_ACCESS_2_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_2_ACCELERATION_STRUCTURE_WRITE_BIT_KHR |
+                       VK_ACCESS_2_SHADER_READ_BIT);
+}
+
+/// Makes the compacted sizes written into Readback memory visible to the
+/// host once the list's submission has signalled.
+void size_read_barrier(CommandListState const& list) noexcept {
+    memory_barrier(list, VK_PIPELINE_STAGE_2_COPY_BIT | VK_PIPELINE_STAGE_2_CLEAR_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                   VK_PIPELINE_STAGE_2_HOST_BIT, VK_ACCESS_2_HOST_READ_BIT);
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Setup & teardown
+// -------------------------------------------------------------------------------------------------
+void init_acceleration_structures(VulkanDevice::Impl& impl) {
+    auto&       ctx  = impl.raytracing;
+    auto const& caps = impl.capabilities;
+    if (!has_any(caps.features, Feature::RayTracing))
+        return;
+
+    ctx.host_build        = has_any(caps.features, Feature::AccelerationStructureHostBuild);
+    ctx.scratch_alignment = std::max<uint64_t>(1, caps.limits.accelerationStructureScratchAlignment);
+
+    // Lists reset their own ranges (vkCmdResetQueryPool), so the pools
+    // start unreset.
+    for (uint32_t i = 0; i < impl.commands.frames_in_flight; ++i) {
+        ctx.slots[i].pool = static_cast<VkQueryPool>(vk::raii::QueryPool{impl.device,
+            vk::QueryPoolCreateInfo{}
+                .setQueryType(vk::QueryType::eAccelerationStructureCompactedSizeKHR)
+                .setQueryCount(k_max_compaction_queries)}.release());
+    }
+    ctx.enabled = true;
+}
+
+void release_acceleration_structures(VulkanDevice::Impl& impl) noexcept {
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+    for (auto& slot : impl.raytracing.slots) {
+        d->vkDestroyQueryPool(dev, slot.pool, nullptr);
+        slot.pool = VK_NULL_HANDLE;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Sizes
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::acceleration_structure_sizes(AccelerationStructureInputs const& inputs,
+                                                AccelerationStructureSizes& out) const noexcept -> Status
+{
+    out = {};
+
+    auto const& impl = *impl_;
+    if (!impl.raytracing.enabled)
+        return Status::MissingRequiredFeature;
+
+    try {
+        BuildArrays arrays;
+        if (Status s = append_inputs(impl, AddressSpace::None, inputs, arrays); s != Status::Ok)
+            return s;
+        arrays.link();
+
+        // Sizes that hold for either kind of build once host builds exist,
+        // so one query serves a structure of any memory usage.
+        auto const sizes = build_sizes(impl,
+                                       impl.raytracing.host_build ? VK_ACCELERATION_STRUCTURE_BUILD_TYPE_HOST_OR_DEVICE_KHR
+                                                                  : VK_ACCELERATION_STRUCTURE_BUILD_TYPE_DEVICE_KHR,
+                                       arrays.infos.front(), arrays.max_primitives.data());
+        out = AccelerationStructureSizes{
+            .size              = sizes.accelerationStructureSize,
+            .buildScratchSize  = sizes.buildScratchSize,
+            .updateScratchSize = underlying(inputs.flags & AccelerationStructureFlags::AllowUpdate) != 0
+                                     ? sizes.updateScratchSize : 0,
+        };
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+    return Status::Ok;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Host builds
+//
+// One deferred operation carries the whole call. Every job system thread
+// the driver can use joins it with vkDeferredOperationJoinKHR; the calling
+// thread takes part through parallel_for() and carries on alone should the
+// operation outlast the joins (VK_THREAD_DONE_KHR releases a thread while
+// others still work). Scratch is host memory, one allocation per call.
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::build_acceleration_structures_on_host(std::span<AccelerationStructureBuild const> builds) noexcept
+    -> Status
+{
+    auto& impl = *impl_;
+    if (!impl.raytracing.host_build)
+        return Status::MissingRequiredFeature;
+    if (builds.empty())
+        return Status::Ok;
+
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    try {
+        BuildArrays arrays;
+        if (Status s = append_builds(impl, AddressSpace::Host, builds, arrays); s != Status::Ok)
+            return s;
+        arrays.link();
+
+        constexpr uint64_t k_host_scratch_alignment = 256;
+        std::vector<uint64_t> offsets(arrays.infos.size());
+        uint64_t              total = 0;
+        for (std::size_t i = 0; i < arrays.infos.size(); ++i) {
+            auto const& info  = arrays.infos[i];
+            auto const  sizes = build_sizes(impl, VK_ACCELERATION_STRUCTURE_BUILD_TYPE_HOST_KHR, info,
+                                            arrays.max_primitives.data() + arrays.first_geometry[i]);
+            offsets[i] = total;
+            total     += foundation::memory::align_up(
+                info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR ? sizes.updateScratchSize
+                                                                             : sizes.buildScratchSize,
+                k_host_scratch_alignment);
+        }
+        auto scratch = std::make_unique_for_overwrite<std::byte[]>(total + k_host_scratch_alignment);
+        auto* const base = static_cast<std::byte*>(
+            foundation::memory::align_up(static_cast<void*>(scratch.get()), k_host_scratch_alignment));
+        for (std::size_t i = 0; i < arrays.infos.size(); ++i)
+            arrays.infos[i].scratchData.hostAddress = base + offsets[i];
+
+        VkDeferredOperationKHR operation = VK_NULL_HANDLE;
+        if (VkResult r = d->vkCreateDeferredOperationKHR(dev, nullptr, &operation); r != VK_SUCCESS)
+            return detail::to_status(r);
+
+        VkResult result = d->vkBuildAccelerationStructuresKHR(dev, operation,
+                                                              static_cast<uint32_t>(arrays.infos.size()),
+                                                              arrays.infos.data(), arrays.range_pointers.data());
+        if (result == VK_OPERATION_DEFERRED_KHR) {
+            auto const join = [d, dev, operation] {
+                VkResult j;
+                do {
+                    j = d->vkDeferredOperationJoinKHR(dev, operation);
+                } while (j == VK_THREAD_IDLE_KHR);
+            };
+
+            if (auto* jobs = impl.pipelines.jobs) {
+                uint32_t const threads = std::min(jobs->thread_count(),
+                                                  d->vkGetDeferredOperationMaxConcurrencyKHR(dev, operation));
+                jobs->parallel_for(0, threads, 1, [&join](uint32_t first, uint32_t last) {
+                    for (uint32_t i = first; i < last; ++i)
+                        join();
+                });
+            }
+            while ((result = d->vkGetDeferredOperationResultKHR(dev, operation)) == VK_NOT_READY)
+                join();
+        } else if (result == VK_OPERATION_NOT_DEFERRED_KHR) {
+            result = VK_SUCCESS;
+        }
+        d->vkDestroyDeferredOperationKHR(dev, operation, nullptr);
+        return result == VK_SUCCESS ? Status::Ok : detail::to_status(result);
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Recording — hot path: no Status; contracts debug-asserted
+// -------------------------------------------------------------------------------------------------
+void cmd_build_acceleration_structures(CommandListState& list,
+                                       std::span<AccelerationStructureBuild const> builds) noexcept
+{
+    assert(list.recording);
+    if (builds.empty())
+        return;
+
+    auto& arrays = t_build_arrays;
+    arrays.clear();
+    try {
+        [[maybe_unused]] Status const s = append_builds(*list.device, AddressSpace::Device, builds, arrays);
+        assert(s == Status::Ok && "build with bad inputs, stale handles or no scratch");
+        if (s != Status::Ok)
+            return;
+        arrays.link();
+    } catch (std::bad_alloc const&) {
+        assert(false && "out of memory translating acceleration structure builds");
+        return;
+    }
+
+    structure_overwrite_barrier(list);
+    list.dispatch->vkCmdBuildAccelerationStructuresKHR(list.cmd, static_cast<uint32_t>(arrays.infos.size()),
+                                                       arrays.infos.data(), arrays.range_pointers.data());
+    structure_write_barrier(list);
+}
+
+void cmd_write_compacted_sizes(CommandListState& list, std::span<AccelerationStructureHandle const> structures,
+                               BufferHandle dst, uint64_t offset) noexcept
+{
+    assert(list.recording);
+    auto& impl = *list.device;
+    assert(impl.raytracing.enabled || structures.empty());
+    if (structures.empty() || !impl.raytracing.enabled)
+        return;
+
+    VkBuffer buffer   = VK_NULL_HANDLE;
+    bool     readback = false;
+    {
+        std::shared_lock lock{impl.buffers_mutex};
+        if (auto const* b = impl.buffers.get<0>(dst)) {
+            buffer   = static_cast<VkBuffer>(*b);
+            readback = impl.buffers.get<4>(dst)->memory == MemoryUsage::Readback;
+        }
+    }
+    assert(buffer && "compacted sizes into a null or stale buffer");
+    if (!buffer)
+        return;
+
+    auto const count = static_cast<uint32_t>(structures.size());
+    auto&      slot  = impl.raytracing.slots[impl.commands.frame_slot];
+    uint32_t const first = slot.used.fetch_add(count, std::memory_order_relaxed);
+    if (count > k_max_compaction_queries || first > k_max_compaction_queries - count) {
+        // Out of queries this frame: zero reads as "keep the structure as is".
+        list.dispatch->vkCmdFillBuffer(list.cmd, buffer, offset, uint64_t{count} * sizeof(uint64_t), 0);
+    } else {
+        std::array<VkAccelerationStructureKHR, 64> batch{};
+        uint32_t written = 0;
+        list.dispatch->vkCmdResetQueryPool(list.cmd, slot.pool, first, count);
+        while (written < count) {
+            uint32_t const n = std::min<uint32_t>(count - written, batch.size());
+            {
+                std::shared_lock lock{impl.acceleration_structures_mutex};
+                for (uint32_t i = 0; i < n; ++i) {
+                    auto const* s = impl.acceleration_structures.get<0>(structures[written + i]);
+                    assert(s && "compacted size of a null or stale structure");
+                    batch[i] = s ? static_cast<VkAccelerationStructureKHR>(*s) : VK_NULL_HANDLE;
+                }
+            }
+            list.dispatch->vkCmdWriteAccelerationStructuresPropertiesKHR(
+                list.cmd, n, batch.data(), VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR,
+                slot.pool, first + written);
+            written += n;
+        }
+        list.dispatch->vkCmdCopyQueryPoolResults(list.cmd, slot.pool, first, count, buffer, offset,
+                                                 sizeof(uint64_t),
+                                                 VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+    }
+    if (readback)
+        size_read_barrier(list);
+}
+
+void cmd_copy_acceleration_structure(CommandListState& list, AccelerationStructureHandle src,
+                                     AccelerationStructureHandle dst, AccelerationStructureCopyMode mode) noexcept
+{
+    assert(list.recording);
+    auto& impl = *list.device;
+
+    VkAccelerationStructureKHR source      = VK_NULL_HANDLE;
+    VkAccelerationStructureKHR destination = VK_NULL_HANDLE;
+    {
+        std::shared_lock lock{impl.acceleration_structures_mutex};
+        if (auto const* s = impl.acceleration_structures.get<0>(src)) source = static_cast<VkAccelerationStructureKHR>(*s);
+        if (auto const* s = impl.acceleration_structures.get<0>(dst)) destination = static_cast<VkAccelerationStructureKHR>(*s);
+    }
+    assert(source && destination && "copy between null or stale acceleration structures");
+    if (!source || !destination)
+        return;
+
+    VkCopyAccelerationStructureInfoKHR const info{
+        .sType = VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR,
+        .pNext = nullptr,
+        .src   = source,
+        .dst   = destination,
+        .mode  = mode == AccelerationStructureCopyMode::Compact ? VK_COPY_ACCELERATION_STRUCTURE_MODE_COMPACT_KHR
+                                                                : VK_COPY_ACCELERATION_STRUCTURE_MODE_CLONE_KHR,
+    };
+    structure_overwrite_barrier(list);
+    list.dispatch->vkCmdCopyAccelerationStructureKHR(list.cmd, &info);
+    structure_write_barrier(list);
+}
+
+} // namespace wren::rhi::vulkan
@@ -0,0 +1,320 @@
+// Internal — not part of the public API.
+// Process-wide and on-disk caches of the physical device queries.
+
+#include "vk_adapter_cache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include <wren/platform/mapped_file.hpp>
+
+#include "vk_cache_file.hpp"
+
+namespace wren::rhi::vulkan::detail {
+
+namespace {
+
+// -----------------------------------------------------------------
+// Key
+// -----------------------------------------------------------------
+struct AdapterKey {
+    uint32_t                          vendor_id      = 0;
+    uint32_t                          device_id      = 0;
+    uint32_t                          driver_version = 0;
+    uint32_t                          api_version    = 0;
+    std::array<uint8_t, VK_UUID_SIZE> uuid{};
+
+    bool operator==(AdapterKey const&) const noexcept = default;
+};
+
+[[nodiscard]] AdapterKey make_key(vk::PhysicalDeviceProperties const& props) noexcept {
+    AdapterKey key{
+        .vendor_id      = props.vendorID,
+        .device_id      = props.deviceID,
+        .driver_version = props.driverVersion,
+        .api_version    = props.apiVersion,
+    };
+    std::ranges::copy(props.pipelineCacheUUID, key.uuid.begin());
+    return key;
+}
+
+// -----------------------------------------------------------------
+// Driver queries
+// -----------------------------------------------------------------
+template<class... Structs>
+void unlink(Structs&... structs) noexcept {
+    ((structs.pNext = nullptr), ...);
+}
+
+[[nodiscard]] AdapterQuery query_driver(vk::raii::PhysicalDevice const& phys) {
+    AdapterQuery q;
+    q.extensions = phys.enumerateDeviceExtensionProperties();
+    auto const available = [&](const char* name) noexcept { return has_extension(q.extensions, name); };
+
+    auto const* d      = phys.getDispatcher();
+    auto const  handle = static_cast<VkPhysicalDevice>(*phys);
+
+    auto& f = q.features;
+    link_feature_chain(f, available);
+    d->vkGetPhysicalDeviceFeatures2(handle, reinterpret_cast<VkPhysicalDeviceFeatures2*>(&f.features2));
+    unlink(f.features2, f.vk11, f.vk12, f.vk13, f.mesh_shader, f.ray_tracing, f.accel_struct,
+           f.descriptor_buffer, f.fsr, f.interlock, f.gpl, f.present_id, f.present_wait);
+
+    auto& p = q.properties;
+    p.properties2.pNext = &p.vk12;
+    void** tail = &p.vk12.pNext;
+    if (available("VK_EXT_descriptor_buffer")) {
+        *tail = &p.descriptor_buffer;
+        tail  = &p.descriptor_buffer.pNext;
+    }
+    if (available(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME)) {
+        *tail = &p.gpl;
+        tail  = &p.gpl.pNext;
+    }
+    if (available(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME)) {
+        *tail = &p.accel_struct;
+        tail  = &p.accel_struct.pNext;
+    }
+    *tail = nullptr;
+    d->vkGetPhysicalDeviceProperties2(handle, reinterpret_cast<VkPhysicalDeviceProperties2*>(&p.properties2));
+    unlink(p.properties2, p.vk12, p.descriptor_buffer, p.gpl, p.accel_struct);
+
+    q.memory         = phys.getMemoryProperties();
+    q.queue_families = phys.getQueueFamilyProperties();
+    if (available(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME))
+        q.time_domains = phys.getCalibrateableTimeDomainsEXT();
+    return q;
+}
+
+// -----------------------------------------------------------------
+// File format
+//
+//   CapsFileHeader, then DeviceFeatureChain, DevicePropertyChain and
+//   VkPhysicalDeviceMemoryProperties as bytes (pNext cleared), then the
+//   extension, queue family and time domain arrays. Native byte order and
+//   struct layout: the Vulkan header version is part of the key, and the
+//   payload size must match the layout this build expects.
+// -----------------------------------------------------------------
+constexpr uint32_t k_caps_file_magic   = 0x43415257;  // "WRAC"
+constexpr uint32_t k_caps_file_version = 3;  // 3: acceleration structure properties
+
+struct CapsFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_version;  // VK_HEADER_VERSION
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint32_t api_version;
+    uint32_t extension_count;
+    uint32_t queue_family_count;
+    uint32_t time_domain_count;
+    uint8_t  uuid[VK_UUID_SIZE];
+    uint64_t data_size;
+    uint64_t data_hash;
+};
+static_assert(sizeof(CapsFileHeader) == 72);
+
+static_assert(std::is_trivially_copyable_v<DeviceFeatureChain>);
+static_assert(std::is_trivially_copyable_v<DevicePropertyChain>);
+static_assert(std::is_trivially_copyable_v<vk::PhysicalDeviceMemoryProperties>);
+static_assert(std::is_trivially_copyable_v<vk::ExtensionProperties>);
+static_assert(std::is_trivially_copyable_v<vk::QueueFamilyProperties>);
+
+[[nodiscard]] constexpr uint64_t payload_size(uint64_t extensions, uint64_t families, uint64_t domains) noexcept {
+    return sizeof(DeviceFeatureChain) + sizeof(DevicePropertyChain) +
+           sizeof(vk::PhysicalDeviceMemoryProperties) +
+           extensions * sizeof(vk::ExtensionProperties) +
+           families   * sizeof(vk::QueueFamilyProperties) +
+           domains    * sizeof(vk::TimeDomainEXT);
+}
+
+template<class T>
+void append(std::vector<std::byte>& out, std::span<T> values) {
+    auto const bytes = std::as_bytes(values);
+    out.insert(out.end(), bytes.begin(), bytes.end());
+}
+
+template<class T>
+void take(std::span<std::byte const>& in, std::span<T> values) noexcept {
+    std::size_t const size = values.size_bytes();
+    std::memcpy(values.data(), in.data(), size);
+    in = in.subspan(size);
+}
+
+[[nodiscard]] std::vector<std::byte> serialize(AdapterKey const& key, AdapterQuery const& q) {
+    std::vector<std::byte> file(sizeof(CapsFileHeader));
+    file.reserve(sizeof(CapsFileHeader) +
+                 payload_size(q.extensions.size(), q.queue_families.size(), q.time_domains.size()));
+    append(file, std::span{&q.features, 1});
+    append(file, std::span{&q.properties, 1});
+    append(file, std::span{&q.memory, 1});
+    append(file, std::span{q.extensions});
+    append(file, std::span{q.queue_families});
+    append(file, std::span{q.time_domains});
+
+    auto const payload = std::span<std::byte const>{file}.subspan(sizeof(CapsFileHeader));
+    CapsFileHeader header{
+        .magic              = k_caps_file_magic,
+        .version            = k_caps_file_version,
+        .header_version     = VK_HEADER_VERSION,
+        .vendor_id          = key.vendor_id,
+        .device_id          = key.device_id,
+        .driver_version     = key.driver_version,
+        .api_version        = key.api_version,
+        .extension_count    = static_cast<uint32_t>(q.extensions.size()),
+        .queue_family_count = static_cast<uint32_t>(q.queue_families.size()),
+        .time_domain_count  = static_cast<uint32_t>(q.time_domains.size()),
+        .uuid               = {},
+        .data_size          = payload.size(),
+        .data_hash          = hash_payload(payload),
+    };
+    std::ranges::copy(key.uuid, header.uuid);
+    std::memcpy(file.data(), &header, sizeof header);
+    return file;
+}
+
+/// The queries stored in @p file when it belongs to @p key and is intact,
+/// otherwise null and the reason in @p reason.
+[[nodiscard]] std::shared_ptr<AdapterQuery> deserialize(AdapterKey const&          key,
+                                                        std::span<std::byte const> file,
+                                                        const char*&               reason) {
+    CapsFileHeader header{};
+    if (file.size() < sizeof header) {
+        reason = "truncated header";
+        return nullptr;
+    }
+    std::memcpy(&header, file.data(), sizeof header);
+    auto payload = file.subspan(sizeof header);
+
+    if (header.magic != k_caps_file_magic || header.version != k_caps_file_version ||
+        header.header_version != VK_HEADER_VERSION) {
+        reason = "unknown format";
+        return nullptr;
+    }
+    if (header.vendor_id != key.vendor_id || header.device_id != key.device_id ||
+        header.driver_version != key.driver_version || header.api_version != key.api_version ||
+        !std::ranges::equal(header.uuid, key.uuid)) {
+        reason = "different device or driver";
+        return nullptr;
+    }
+    if (header.data_size != payload.size() ||
+        header.data_size != payload_size(header.extension_count, header.queue_family_count,
+                                         header.time_domain_count) ||
+        header.data_hash != hash_payload(payload)) {
+        reason = "corrupt payload";
+        return nullptr;
+    }
+
+    auto q = std::make_shared<AdapterQuery>();
+    q->extensions.resize(header.extension_count);
+    q->queue_families.resize(header.queue_family_count);
+    q->time_domains.resize(header.time_domain_count);
+    take(payload, std::span{&q->features, 1});
+    take(payload, std::span{&q->properties, 1});
+    take(payload, std::span{&q->memory, 1});
+    take(payload, std::span{q->extensions});
+    take(payload, std::span{q->queue_families});
+    take(payload, std::span{q->time_domains});
+    return q;
+}
+
+// -----------------------------------------------------------------
+// Process-wide cache
+//
+// A handful of entries at most, so a vector. `persisted` lists the
+// directories whose file already matches, so a lookup with a directory
+// the entry has not been written to yet still writes it once.
+// -----------------------------------------------------------------
+struct CacheEntry {
+    AdapterKey                          key;
+    std::shared_ptr<AdapterQuery const> query;
+    std::vector<std::filesystem::path>  persisted;
+};
+
+struct ProcessCache {
+    std::mutex              mutex;
+    std::vector<CacheEntry> entries;
+};
+
+[[nodiscard]] ProcessCache& process_cache() {
+    static ProcessCache cache;
+    return cache;
+}
+
+void persist(std::filesystem::path const& path, AdapterKey const& key, AdapterQuery const& q) {
+    if (auto const ec = platform::write_file_atomic(path, serialize(key, q))) {
+        SPDLOG_WARN("[wren/rhi/vulkan] Failed to write capability cache '{}': {}",
+                    path.string(), ec.message());
+    }
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// query_adapter
+// -------------------------------------------------------------------------------------------------
+std::shared_ptr<AdapterQuery const> query_adapter(vk::raii::PhysicalDevice const& phys,
+                                                  const char*                      cache_directory) {
+    auto const       props = phys.getProperties();
+    AdapterKey const key   = make_key(props);
+
+    std::filesystem::path path;
+    if (cache_directory && *cache_directory)
+        path = std::filesystem::path{cache_directory} /
+               std::format("vulkan_{:04x}_{:04x}.wac", props.vendorID, props.deviceID);
+
+    auto& cache = process_cache();
+    {
+        std::unique_lock lock{cache.mutex};
+        auto it = std::ranges::find(cache.entries, key, &CacheEntry::key);
+        if (it != cache.entries.end()) {
+            auto query = it->query;
+            if (path.empty() || std::ranges::find(it->persisted, path) != it->persisted.end())
+                return query;
+            it->persisted.push_back(path);
+            lock.unlock();
+            persist(path, key, *query);
+            return query;
+        }
+    }
+
+    std::shared_ptr<AdapterQuery const> query;
+    if (!path.empty()) {
+        if (auto const file = platform::mapped_file::open(path)) {
+            const char* reason = nullptr;
+            query = deserialize(key, file->bytes(), reason);
+            if (query)
+                SPDLOG_INFO("[wren/rhi/vulkan] Loaded capabilities of '{}' from '{}'.",
+                            props.deviceName.data(), path.string());
+            else
+                SPDLOG_WARN("[wren/rhi/vulkan] Ignoring capability cache '{}': {}.", path.string(), reason);
+        }
+    }
+    if (!query) {
+        query = std::make_shared<AdapterQuery const>(query_driver(phys));
+        if (!path.empty())
+            persist(path, key, *query);
+    }
+
+    std::scoped_lock lock{cache.mutex};
+    auto it = std::ranges::find(cache.entries, key, &CacheEntry::key);
+    if (it != cache.entries.end())  // another thread queried the same adapter meanwhile
+        return it->query;
+    auto& entry = cache.entries.emplace_back(CacheEntry{.key = key, .query = query, .persisted = {}});
+    if (!path.empty())
+        entry.persisted.push_back(path);
+    return query;
+}
+
+} // namespace wren::rhi::vulkan::detail
@@ -2,6 +2,7 @@
 
 #include <wren/rhi/api/enums.hpp>
 #include <wren/rhi/api/features.hpp>
+#include <wren/rhi/static_backend.hpp>
 #include <wren/rhi/vulkan/device.hpp>
 #include <wren/rhi/vulkan/instance.hpp>
 
@@ -9,24 +10,125 @@
 
 #include <wren/foundation/system/platform.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <new>
 #include <optional>
+#include <string>
+
+#include "vk_acceleration_structures.hpp"
+#include "vk_commands.hpp"
+#include "vk_swapchain.hpp"
 
 // -------------------------------------------------------------------------------------------------
-// Internal device state
+// Internal instance state
 //
-// Owns everything from the Vulkan context through the logical device in a
-// single heap allocation.  Lifetime is managed by vk_create_device /
-// vk_destroy_device, which the loader calls through the vtable.
+// Owns the Vulkan context, instance and debug messenger shared by every
+// device created from it. Reference-counted: the handle vk_create_instance
+// returns holds one reference and each device another, so the instance is
+// destroyed with the last of them whatever the order.
 //
-// Named DeviceState to match the forward declaration in wren::rhi::DeviceHandle.
+// Named InstanceState to match the forward declaration in wren::rhi::InstanceHandle.
 // -------------------------------------------------------------------------------------------------
-struct wren::rhi::DeviceState {
+struct wren::rhi::InstanceState {
     vk::raii::Context                               ctx;
     vk::raii::Instance                              instance   {nullptr};
     std::optional<vk::raii::DebugUtilsMessengerEXT> debug_messenger;
-    std::optional<wren::rhi::vulkan::VulkanDevice>  device;
-    wren::rhi::Capabilities                         capabilities{};
+    std::string                                     capability_cache_directory;  // InstanceDesc's; empty disables it
+    std::atomic<uint32_t>                           refs       {1};
+};
+
+namespace {
+
+void write_error(char* err_buf, std::size_t err_len, const char* msg) noexcept {
+    if (err_buf && err_len > 0) {
+#ifdef WREN_COMPILER_MSVC_ABI
+        strncpy_s(err_buf, err_len, msg, err_len - 1);
+#else
+        std::strncpy(err_buf, msg, err_len - 1);
+        err_buf[err_len - 1] = '\0';
+#endif
+    }
+}
+
+void retain(wren::rhi::InstanceState* state) noexcept {
+    state->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void release(wren::rhi::InstanceState* state) noexcept {
+    if (state && state->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete state; // NOLINT
+    }
+}
+
+/// Creates an instance holding one reference, or writes the error and
+/// returns nullptr. Throws what vk::raii throws.
+wren::rhi::InstanceState* make_instance(
+    wren::rhi::vulkan::InstanceConfig const& cfg,
+    char*                                    err_buf,
+    std::size_t                              err_len)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto* state = new (std::nothrow) wren::rhi::InstanceState{};
+    if (!state) {
+        write_error(err_buf, err_len, "out of memory");
+        return nullptr;
+    }
+
+    try {
+        auto inst = wren::rhi::vulkan::create_instance(state->ctx, cfg);
+        if (!inst) {
+            write_error(err_buf, err_len, inst.error().c_str());
+            release(state);
+            return nullptr;
+        }
+        state->instance = std::move(*inst);
+
+        if (cfg.enable_debug) {
+            state->debug_messenger =
+                wren::rhi::vulkan::create_debug_messenger(state->instance);
+        }
+        return state;
+    } catch (...) {
+        release(state);
+        throw;
+    }
+}
+
+[[nodiscard]] wren::rhi::AdapterType to_adapter_type(wren::rhi::vulkan::AdapterKind kind) noexcept {
+    using wren::rhi::AdapterType;
+    using wren::rhi::vulkan::AdapterKind;
+    switch (kind) {
+        case AdapterKind::Integrated: return AdapterType::Integrated;
+        case AdapterKind::Discrete:   return AdapterType::Discrete;
+        case AdapterKind::Virtual:    return AdapterType::Virtual;
+        case AdapterKind::CPU:        return AdapterType::Cpu;
+        default:                      return AdapterType::Other;
+    }
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Internal device state
+//
+// Owns the logical device and one reference to the instance it was created
+// from, released after the device is gone. Lifetime is managed by
+// vk_create_device / vk_destroy_device, which the loader calls through the
+// vtable.
+//
+// Named DeviceState to match the forward declaration in wren::rhi::DeviceHandle.
+// -------------------------------------------------------------------------------------------------
+struct wren::rhi::DeviceState {
+    wren::rhi::InstanceState*                      instance = nullptr;
+    std::optional<wren::rhi::vulkan::VulkanDevice> device;
+    wren::rhi::Capabilities                        capabilities{};
+
+    ~DeviceState() {
+        device.reset();
+        release(instance);
+    }
 };
 
 // -------------------------------------------------------------------------------------------------
@@ -37,57 +139,117 @@ static uint8_t vk_backend_id() noexcept {
     return static_cast<uint8_t>(wren::rhi::Backend::Vulkan);
 }
 
-static wren::rhi::DeviceHandle vk_create_device(
-    wren::rhi::DeviceDesc const* desc,
+static wren::rhi::InstanceHandle vk_create_instance(
+    wren::rhi::InstanceDesc const* desc,
     char*       err_buf,
     std::size_t err_len) noexcept
 {
-    auto write_error = [&](const char* msg) noexcept {
-        if (err_buf && err_len > 0) {
-#ifdef WREN_COMPILER_MSVC_ABI
-            strncpy_s(err_buf, err_len, msg, err_len - 1);
-#else
-            std::strncpy(err_buf, msg, err_len - 1);
-            err_buf[err_len - 1] = '\0';
-#endif
+    if (!desc) {
+        write_error(err_buf, err_len, "null InstanceDesc pointer");
+        return nullptr;
+    }
+
+    try {
+        wren::rhi::vulkan::InstanceConfig const cfg{
+            .application_name    = desc->applicationName ? desc->applicationName : "wren",
+            .application_version = desc->applicationVersion,
+            .enable_debug        = desc->debug,
+            .enable_presentation = !desc->headless,
+        };
+        auto* state = make_instance(cfg, err_buf, err_len);
+        if (state && desc->capabilityCacheDirectory) {
+            state->capability_cache_directory = desc->capabilityCacheDirectory;
         }
-    };
+        return state;
 
+    } catch (std::exception const& e) {
+        write_error(err_buf, err_len, e.what());
+    } catch (...) {
+        write_error(err_buf, err_len, "unknown exception during instance creation");
+    }
+    return nullptr;
+}
+
+static void vk_destroy_instance(wren::rhi::InstanceHandle instance) noexcept {
+    release(instance);
+}
+
+static uint32_t vk_enumerate_adapters(
+    wren::rhi::InstanceHandle instance,
+    wren::rhi::AdapterDesc*   out,
+    uint32_t                  capacity) noexcept
+{
+    if (!instance) {
+        return 0;
+    }
+    try {
+        auto const& cache = instance->capability_cache_directory;
+        auto const  infos = wren::rhi::vulkan::enumerate_adapters(
+            instance->instance, cache.empty() ? nullptr : cache.c_str());
+
+        uint32_t const count = static_cast<uint32_t>(infos.size());
+        for (uint32_t i = 0; out && i < std::min(count, capacity); ++i) {
+            auto const& info = infos[i];
+            auto&       desc = out[i];
+            desc = wren::rhi::AdapterDesc{
+                .index            = info.index,
+                .type             = to_adapter_type(info.kind),
+                .vendorId         = info.vendor_id,
+                .deviceId         = info.device_id,
+                .driverVersion    = info.driver_version,
+                .videoMemoryBytes = info.video_memory_bytes,
+                .deviceGroup      = info.device_group,
+                .deviceGroupSize  = info.device_group_size,
+                .capabilities     = info.capabilities,
+            };
+            std::size_t const len = std::min<std::size_t>(info.name.size(), wren::rhi::k_max_adapter_name - 1);
+            std::memcpy(desc.name, info.name.data(), len);
+        }
+        return count;
+    } catch (...) {
+        return 0;
+    }
+}
+
+static wren::rhi::DeviceHandle vk_create_device(
+    wren::rhi::InstanceHandle    instance,
+    wren::rhi::DeviceDesc const* desc,
+    char*       err_buf,
+    std::size_t err_len) noexcept
+{
     if (!desc) {
-        write_error("null DeviceDesc pointer");
+        write_error(err_buf, err_len, "null DeviceDesc pointer");
         return nullptr;
     }
 
     // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
     auto* state = new (std::nothrow) wren::rhi::DeviceState{};
     if (!state) {
-        write_error("out of memory");
+        write_error(err_buf, err_len, "out of memory");
         return nullptr;
     }
 
     try {
-        const bool debug = wren::rhi::has_any(desc->flags, wren::rhi::DeviceFlag::Debug);
-
-        wren::rhi::vulkan::InstanceConfig cfg{
-            .enable_debug = debug,
-        };
-
-        auto inst = wren::rhi::vulkan::create_instance(state->ctx, cfg);
-        if (!inst) {
-            write_error(inst.error().c_str());
-            delete state; // NOLINT
-            return nullptr;
-        }
-        state->instance = std::move(*inst);
-
-        if (debug) {
-            state->debug_messenger =
-                wren::rhi::vulkan::create_debug_messenger(state->instance);
+        if (instance) {
+            retain(instance);
+            state->instance = instance;
+        } else {
+            // No shared instance: a private one, with validation when the device asks
+            // for it and surfaces unless it is headless.
+            wren::rhi::vulkan::InstanceConfig const cfg{
+                .enable_debug        = wren::rhi::has_any(desc->flags, wren::rhi::DeviceFlag::Debug),
+                .enable_presentation = !wren::rhi::has_any(desc->flags, wren::rhi::DeviceFlag::Headless),
+            };
+            state->instance = make_instance(cfg, err_buf, err_len);
+            if (!state->instance) {
+                delete state; // NOLINT
+                return nullptr;
+            }
         }
 
-        auto dev = wren::rhi::vulkan::VulkanDevice::create(state->instance, *desc);
+        auto dev = wren::rhi::vulkan::VulkanDevice::create(state->instance->instance, *desc);
         if (!dev) {
-            write_error(dev.error().message.c_str());
+            write_error(err_buf, err_len, dev.error().message.c_str());
             delete state; // NOLINT
             return nullptr;
         }
@@ -98,9 +260,9 @@ static wren::rhi::DeviceHandle vk_create_device(
         return state;
 
     } catch (std::exception const& e) {
-        write_error(e.what());
+        write_error(err_buf, err_len, e.what());
     } catch (...) {
-        write_error("unknown exception during device creation");
+        write_error(err_buf, err_len, "unknown exception during device creation");
     }
 
     delete state; // NOLINT
@@ -120,6 +282,766 @@ static void vk_get_capabilities(
     }
 }
 
+static wren::rhi::Status vk_create_buffers(
+    wren::rhi::DeviceHandle      device,
+    wren::rhi::BufferDesc const* descs,
+    uint32_t                     count,
+    wren::rhi::BufferHandle*     out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_buffers({descs, count}, {out, count});
+}
+
+static void vk_destroy_buffers(
+    wren::rhi::DeviceHandle        device,
+    wren::rhi::BufferHandle const* handles,
+    uint32_t                       count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->destroy_buffers({handles, count});
+    }
+}
+
+static wren::rhi::Status vk_create_textures(
+    wren::rhi::DeviceHandle       device,
+    wren::rhi::TextureDesc const* descs,
+    uint32_t                      count,
+    wren::rhi::TextureHandle*     out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_textures({descs, count}, {out, count});
+}
+
+static void vk_destroy_textures(
+    wren::rhi::DeviceHandle         device,
+    wren::rhi::TextureHandle const* handles,
+    uint32_t                        count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->destroy_textures({handles, count});
+    }
+}
+
+static void* vk_map_buffer(
+    wren::rhi::DeviceHandle device,
+    wren::rhi::BufferHandle buffer) noexcept
+{
+    return (device && device->device) ? device->device->buffer_mapping(buffer) : nullptr;
+}
+
+static uint64_t vk_buffer_device_address(
+    wren::rhi::DeviceHandle device,
+    wren::rhi::BufferHandle buffer) noexcept
+{
+    return (device && device->device) ? device->device->buffer_device_address(buffer) : 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Bindless heap
+// -------------------------------------------------------------------------------------------------
+
+static void vk_query_bindless_heap(
+    wren::rhi::DeviceHandle      device,
+    wren::rhi::BindlessHeapInfo* out) noexcept
+{
+    if (!out) {
+        return;
+    }
+    if (!device || !device->device) {
+        *out = {};
+        return;
+    }
+    device->device->bindless_heap_info(*out);
+}
+
+static uint32_t vk_buffer_bindless_index(
+    wren::rhi::DeviceHandle device,
+    wren::rhi::BufferHandle buffer) noexcept
+{
+    return (device && device->device) ? device->device->bindless_index(buffer)
+                                      : wren::rhi::k_invalid_bindless_index;
+}
+
+static uint32_t vk_texture_bindless_index(
+    wren::rhi::DeviceHandle  device,
+    wren::rhi::TextureHandle texture,
+    wren::rhi::BindlessClass cls) noexcept
+{
+    return (device && device->device) ? device->device->bindless_index(texture, cls)
+                                      : wren::rhi::k_invalid_bindless_index;
+}
+
+static wren::rhi::Status vk_find_samplers(
+    wren::rhi::DeviceHandle       device,
+    wren::rhi::SamplerDesc const* descs,
+    uint32_t                      count,
+    uint32_t*                     out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->find_samplers({descs, count}, {out, count});
+}
+
+// -------------------------------------------------------------------------------------------------
+// Device memory
+// -------------------------------------------------------------------------------------------------
+
+static void vk_query_memory_budget(
+    wren::rhi::DeviceHandle  device,
+    wren::rhi::MemoryBudget* out) noexcept
+{
+    if (!out) {
+        return;
+    }
+    if (!device || !device->device) {
+        *out = {};
+        return;
+    }
+    device->device->memory_budget(*out);
+}
+
+static wren::rhi::Status vk_defragment_memory(
+    wren::rhi::DeviceHandle          device,
+    wren::rhi::DefragmentDesc const* desc,
+    wren::rhi::DefragmentStats*      out) noexcept
+{
+    if (!device || !device->device || !desc || !out) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->defragment_memory(*desc, *out);
+}
+
+static wren::rhi::Status vk_texture_memory_requirements(
+    wren::rhi::DeviceHandle        device,
+    wren::rhi::TextureDesc const*  descs,
+    uint32_t                       count,
+    wren::rhi::MemoryRequirements* out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->texture_memory_requirements({descs, count}, {out, count});
+}
+
+static wren::rhi::Status vk_create_memory_heaps(
+    wren::rhi::DeviceHandle          device,
+    wren::rhi::MemoryHeapDesc const* descs,
+    uint32_t                         count,
+    wren::rhi::HeapHandle*           out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_memory_heaps({descs, count}, {out, count});
+}
+
+static void vk_destroy_memory_heaps(
+    wren::rhi::DeviceHandle      device,
+    wren::rhi::HeapHandle const* handles,
+    uint32_t                     count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->destroy_memory_heaps({handles, count});
+    }
+}
+
+static wren::rhi::Status vk_sparse_texture_info(
+    wren::rhi::DeviceHandle        device,
+    wren::rhi::TextureHandle       texture,
+    wren::rhi::SparseTextureInfo*  out) noexcept
+{
+    if (!out) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    *out = {};
+    if (!device || !device->device) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->sparse_texture_info(texture, *out);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Acceleration structures
+// -------------------------------------------------------------------------------------------------
+static wren::rhi::Status vk_acceleration_structure_sizes(
+    wren::rhi::DeviceHandle                        device,
+    wren::rhi::AccelerationStructureInputs const*  inputs,
+    wren::rhi::AccelerationStructureSizes*         out) noexcept
+{
+    if (!out) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    *out = {};
+    if (!device || !device->device || !inputs) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->acceleration_structure_sizes(*inputs, *out);
+}
+
+static wren::rhi::Status vk_create_acceleration_structures(
+    wren::rhi::DeviceHandle                      device,
+    wren::rhi::AccelerationStructureDesc const*  descs,
+    uint32_t                                     count,
+    wren::rhi::AccelerationStructureHandle*      out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_acceleration_structures({descs, count}, {out, count});
+}
+
+static void vk_destroy_acceleration_structures(
+    wren::rhi::DeviceHandle                       device,
+    wren::rhi::AccelerationStructureHandle const* handles,
+    uint32_t                                      count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->destroy_acceleration_structures({handles, count});
+    }
+}
+
+static uint64_t vk_acceleration_structure_reference(
+    wren::rhi::DeviceHandle                device,
+    wren::rhi::AccelerationStructureHandle structure) noexcept
+{
+    return (device && device->device) ? device->device->acceleration_structure_reference(structure) : 0;
+}
+
+static wren::rhi::Status vk_build_acceleration_structures_on_host(
+    wren::rhi::DeviceHandle                       device,
+    wren::rhi::AccelerationStructureBuild const*  builds,
+    uint32_t                                      count) noexcept
+{
+    if (!device || !device->device || (count > 0 && !builds)) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->build_acceleration_structures_on_host({builds, count});
+}
+
+// -------------------------------------------------------------------------------------------------
+// Shader modules
+// -------------------------------------------------------------------------------------------------
+
+static wren::rhi::Status vk_create_shader_modules(
+    wren::rhi::DeviceHandle            device,
+    wren::rhi::ShaderModuleDesc const* descs,
+    uint32_t                           count,
+    wren::rhi::ShaderModuleHandle*     out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_shader_modules({descs, count}, {out, count});
+}
+
+static void vk_destroy_shader_modules(
+    wren::rhi::DeviceHandle              device,
+    wren::rhi::ShaderModuleHandle const* handles,
+    uint32_t                             count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->destroy_shader_modules({handles, count});
+    }
+}
+
+static wren::rhi::Status vk_shader_module_reflection(
+    wren::rhi::DeviceHandle       device,
+    wren::rhi::ShaderModuleHandle module,
+    wren::rhi::ShaderReflection*  out) noexcept
+{
+    if (!out) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    *out = {};
+    if (!device || !device->device) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->shader_module_reflection(module, *out);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Pipeline cache
+// -------------------------------------------------------------------------------------------------
+
+static void vk_query_pipeline_cache(
+    wren::rhi::DeviceHandle        device,
+    wren::rhi::PipelineCacheStats* out) noexcept
+{
+    if (!out) {
+        return;
+    }
+    if (!device || !device->device) {
+        *out = {};
+        return;
+    }
+    device->device->pipeline_cache_stats(*out);
+}
+
+static wren::rhi::Status vk_save_pipeline_cache(wren::rhi::DeviceHandle device) noexcept {
+    if (!device || !device->device) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->save_pipeline_cache();
+}
+
+// -------------------------------------------------------------------------------------------------
+// Pipelines
+// -------------------------------------------------------------------------------------------------
+
+static wren::rhi::Status vk_create_graphics_pipelines(
+    wren::rhi::DeviceHandle                device,
+    wren::rhi::GraphicsPipelineDesc const* descs,
+    uint32_t                               count,
+    wren::rhi::PipelineHandle*             out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_graphics_pipelines({descs, count}, {out, count});
+}
+
+static wren::rhi::Status vk_create_compute_pipelines(
+    wren::rhi::DeviceHandle               device,
+    wren::rhi::ComputePipelineDesc const* descs,
+    uint32_t                              count,
+    wren::rhi::PipelineHandle*            out) noexcept
+{
+    if (!device || !device->device || (count > 0 && (!descs || !out))) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->create_compute_pipelines({descs, count}, {out, count});
+}
+
+static void vk_destroy_pipelines(
+    wren::rhi::DeviceHandle          device,
+    wren::rhi::PipelineHandle const* handles,
+    uint32_t                         count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->destroy_pipelines({handles, count});
+    }
+}
+
+static wren::rhi::PipelineStatus vk_pipeline_status(
+    wren::rhi::DeviceHandle   device,
+    wren::rhi::PipelineHandle pipeline) noexcept
+{
+    if (!device || !device->device) {
+        return wren::rhi::PipelineStatus::Failed;
+    }
+    return device->device->pipeline_status(pipeline);
+}
+
+static void vk_prioritize_pipelines(
+    wren::rhi::DeviceHandle          device,
+    wren::rhi::PipelineHandle const* handles,
+    uint32_t                         count) noexcept
+{
+    if (device && device->device && handles) {
+        device->device->prioritize_pipelines({handles, count});
+    }
+}
+
+static wren::rhi::Status vk_wait_pipelines(
+    wren::rhi::DeviceHandle          device,
+    wren::rhi::PipelineHandle const* handles,
+    uint32_t                         count) noexcept
+{
+    if (!device || !device->device || (count > 0 && !handles)) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->wait_pipelines({handles, count});
+}
+
+// -------------------------------------------------------------------------------------------------
+// Frames, command lists & timelines
+// -------------------------------------------------------------------------------------------------
+
+static wren::rhi::Status vk_begin_frame(wren::rhi::DeviceHandle device) noexcept {
+    if (!device || !device->device) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->begin_frame();
+}
+
+static wren::rhi::Status vk_end_frame(wren::rhi::DeviceHandle device) noexcept {
+    if (!device || !device->device) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->end_frame();
+}
+
+static void vk_read_profile_frame(
+    wren::rhi::DeviceHandle  device,
+    wren::rhi::ProfileFrame* out) noexcept
+{
+    if (!out) return;
+    *out = {};
+    if (device && device->device) {
+        device->device->profile_frame(*out);
+    }
+}
+
+static wren::rhi::Status vk_begin_command_list(
+    wren::rhi::DeviceHandle           device,
+    wren::rhi::CommandListDesc const* desc,
+    wren::rhi::CommandListHandle*     out) noexcept
+{
+    if (!out) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    *out = nullptr;
+    if (!device || !device->device || !desc) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->begin_command_list(*desc, *out);
+}
+
+static wren::rhi::Status vk_end_command_list(wren::rhi::CommandListHandle list) noexcept {
+    return wren::rhi::vulkan::VulkanDevice::end_command_list(list);
+}
+
+static wren::rhi::Status vk_submit_command_lists(
+    wren::rhi::DeviceHandle      device,
+    wren::rhi::SubmitDesc const* desc,
+    wren::rhi::SyncPoint*        out) noexcept
+{
+    if (!out) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    *out = {};
+    if (!device || !device->device || !desc) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->submit(*desc, *out);
+}
+
+static wren::rhi::Status vk_bind_sparse(
+    wren::rhi::DeviceHandle          device,
+    wren::rhi::SparseBindDesc const* desc,
+    wren::rhi::SyncPoint*            out) noexcept
+{
+    if (!out) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    *out = {};
+    if (!device || !device->device || !desc) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->bind_sparse(*desc, *out);
+}
+
+static wren::rhi::Status vk_wait_sync_points(
+    wren::rhi::DeviceHandle     device,
+    wren::rhi::SyncPoint const* points,
+    uint32_t                    count,
+    uint64_t                    timeout_ns) noexcept
+{
+    if (!device || !device->device || (count > 0 && !points)) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return device->device->wait({points, count}, timeout_ns);
+}
+
+static uint64_t vk_completed_value(
+    wren::rhi::DeviceHandle device,
+    wren::rhi::QueueType    queue) noexcept
+{
+    return (device && device->device) ? device->device->completed_value(queue) : 0;
+}
+
+static wren::rhi::SwapchainHandle vk_create_swapchain(
+    wren::rhi::DeviceHandle         device,
+    wren::rhi::SwapchainDesc const* desc,
+    char*       err_buf,
+    std::size_t err_len) noexcept
+{
+    if (!device || !device->device || !desc) {
+        write_error(err_buf, err_len, "null device or SwapchainDesc pointer");
+        return nullptr;
+    }
+    auto swapchain = wren::rhi::vulkan::create_swapchain(device->device->impl(),
+                                                         device->instance->instance, *desc);
+    if (!swapchain) {
+        write_error(err_buf, err_len, swapchain.error().c_str());
+        return nullptr;
+    }
+    return *swapchain;
+}
+
+static void vk_destroy_swapchain(
+    wren::rhi::DeviceHandle    device,
+    wren::rhi::SwapchainHandle swapchain) noexcept
+{
+    if (device && device->device) {
+        wren::rhi::vulkan::destroy_swapchain(device->device->impl(), swapchain);
+    }
+}
+
+static wren::rhi::Status vk_resize_swapchain(
+    wren::rhi::DeviceHandle    device,
+    wren::rhi::SwapchainHandle swapchain,
+    uint32_t                   width,
+    uint32_t                   height) noexcept
+{
+    if (!device || !device->device || !swapchain) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return wren::rhi::vulkan::resize_swapchain(device->device->impl(), *swapchain, width, height);
+}
+
+static wren::rhi::Status vk_acquire_swapchain_image(
+    wren::rhi::DeviceHandle     device,
+    wren::rhi::SwapchainHandle  swapchain,
+    uint64_t                    timeout_ns,
+    wren::rhi::SwapchainImage*  out) noexcept
+{
+    if (!out) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    *out = {};
+    if (!device || !device->device || !swapchain) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return wren::rhi::vulkan::acquire_swapchain_image(device->device->impl(), *swapchain, timeout_ns, *out);
+}
+
+static wren::rhi::Status vk_present_swapchain(
+    wren::rhi::DeviceHandle    device,
+    wren::rhi::SwapchainHandle swapchain) noexcept
+{
+    if (!device || !device->device || !swapchain) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return wren::rhi::vulkan::present_swapchain(device->device->impl(), *swapchain);
+}
+
+static wren::rhi::Status vk_wait_for_present(
+    wren::rhi::DeviceHandle    device,
+    wren::rhi::SwapchainHandle swapchain,
+    uint64_t                   timeout_ns) noexcept
+{
+    if (!device || !device->device || !swapchain) {
+        return wren::rhi::Status::InvalidArgument;
+    }
+    return wren::rhi::vulkan::wait_for_present(device->device->impl(), *swapchain, timeout_ns);
+}
+
+static void vk_query_swapchain(
+    wren::rhi::DeviceHandle    device,
+    wren::rhi::SwapchainHandle swapchain,
+    wren::rhi::SwapchainInfo*  out) noexcept
+{
+    if (!out) return;
+    *out = {};
+    if (device && swapchain) {
+        wren::rhi::vulkan::query_swapchain(*swapchain, *out);
+    }
+}
+
+// Recording entries forward straight to commands.cpp; null arguments are
+// contract violations caught by the asserts there.
+
+static void vk_cmd_barriers(
+    wren::rhi::CommandListHandle     list,
+    wren::rhi::TextureBarrier const* textures, uint32_t texture_count,
+    wren::rhi::BufferBarrier const*  buffers,  uint32_t buffer_count) noexcept
+{
+    wren::rhi::vulkan::cmd_barriers(*list, {textures, texture_count}, {buffers, buffer_count});
+}
+
+static void vk_cmd_copy_buffer(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::BufferHandle      src,
+    wren::rhi::BufferHandle      dst,
+    wren::rhi::BufferCopy const* regions,
+    uint32_t                     count) noexcept
+{
+    wren::rhi::vulkan::cmd_copy_buffer(*list, src, dst, {regions, count});
+}
+
+static void vk_cmd_copy_buffer_to_texture(
+    wren::rhi::CommandListHandle        list,
+    wren::rhi::BufferHandle             src,
+    wren::rhi::TextureHandle            dst,
+    wren::rhi::BufferTextureCopy const* regions,
+    uint32_t                            count) noexcept
+{
+    wren::rhi::vulkan::cmd_copy_buffer_to_texture(*list, src, dst, {regions, count});
+}
+
+static void vk_cmd_copy_texture_to_buffer(
+    wren::rhi::CommandListHandle        list,
+    wren::rhi::TextureHandle            src,
+    wren::rhi::BufferHandle             dst,
+    wren::rhi::BufferTextureCopy const* regions,
+    uint32_t                            count) noexcept
+{
+    wren::rhi::vulkan::cmd_copy_texture_to_buffer(*list, src, dst, {regions, count});
+}
+
+static void vk_cmd_begin_rendering(
+    wren::rhi::CommandListHandle    list,
+    wren::rhi::RenderingDesc const* desc) noexcept
+{
+    wren::rhi::vulkan::cmd_begin_rendering(*list, *desc);
+}
+
+static void vk_cmd_end_rendering(wren::rhi::CommandListHandle list) noexcept {
+    wren::rhi::vulkan::cmd_end_rendering(*list);
+}
+
+static void vk_cmd_set_viewport(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::Viewport const*   viewport) noexcept
+{
+    wren::rhi::vulkan::cmd_set_viewport(*list, *viewport);
+}
+
+static void vk_cmd_set_scissor(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::Scissor const*    scissor) noexcept
+{
+    wren::rhi::vulkan::cmd_set_scissor(*list, *scissor);
+}
+
+static void vk_cmd_bind_pipeline(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::PipelineHandle    pipeline) noexcept
+{
+    wren::rhi::vulkan::cmd_bind_pipeline(*list, pipeline);
+}
+
+static void vk_cmd_push_constants(
+    wren::rhi::CommandListHandle list,
+    uint32_t                     offset,
+    uint32_t                     size,
+    void const*                  data) noexcept
+{
+    wren::rhi::vulkan::cmd_push_constants(*list, offset, size, data);
+}
+
+static void vk_cmd_bind_vertex_buffers(
+    wren::rhi::CommandListHandle   list,
+    uint32_t                       first_binding,
+    wren::rhi::BufferHandle const* buffers,
+    uint64_t const*                offsets,
+    uint32_t                       count) noexcept
+{
+    wren::rhi::vulkan::cmd_bind_vertex_buffers(*list, first_binding, {buffers, count}, {offsets, count});
+}
+
+static void vk_cmd_bind_index_buffer(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::BufferHandle      buffer,
+    uint64_t                     offset,
+    wren::rhi::IndexType         type) noexcept
+{
+    wren::rhi::vulkan::cmd_bind_index_buffer(*list, buffer, offset, type);
+}
+
+static void vk_cmd_draw(
+    wren::rhi::CommandListHandle list,
+    uint32_t vertex_count, uint32_t instance_count,
+    uint32_t first_vertex, uint32_t first_instance) noexcept
+{
+    wren::rhi::vulkan::cmd_draw(*list, vertex_count, instance_count, first_vertex, first_instance);
+}
+
+static void vk_cmd_draw_indexed(
+    wren::rhi::CommandListHandle list,
+    uint32_t index_count, uint32_t instance_count,
+    uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) noexcept
+{
+    wren::rhi::vulkan::cmd_draw_indexed(*list, index_count, instance_count, first_index,
+                                        vertex_offset, first_instance);
+}
+
+static void vk_cmd_dispatch(wren::rhi::CommandListHandle list, uint32_t x, uint32_t y, uint32_t z) noexcept {
+    wren::rhi::vulkan::cmd_dispatch(*list, x, y, z);
+}
+
+static void vk_cmd_draw_indirect(
+    wren::rhi::CommandListHandle       list,
+    wren::rhi::IndirectDrawDesc const* desc) noexcept
+{
+    wren::rhi::vulkan::cmd_draw_indirect(*list, *desc, false);
+}
+
+static void vk_cmd_draw_indexed_indirect(
+    wren::rhi::CommandListHandle       list,
+    wren::rhi::IndirectDrawDesc const* desc) noexcept
+{
+    wren::rhi::vulkan::cmd_draw_indirect(*list, *desc, true);
+}
+
+static void vk_cmd_dispatch_indirect(
+    wren::rhi::CommandListHandle list,
+    wren::rhi::BufferHandle      buffer,
+    uint64_t                     offset) noexcept
+{
+    wren::rhi::vulkan::cmd_dispatch_indirect(*list, buffer, offset);
+}
+
+static void vk_cmd_build_acceleration_structures(
+    wren::rhi::CommandListHandle                 list,
+    wren::rhi::AccelerationStructureBuild const* builds,
+    uint32_t                                     count) noexcept
+{
+    wren::rhi::vulkan::cmd_build_acceleration_structures(*list, {builds, count});
+}
+
+static void vk_cmd_write_compacted_sizes(
+    wren::rhi::CommandListHandle                  list,
+    wren::rhi::AccelerationStructureHandle const* structures,
+    uint32_t                                      count,
+    wren::rhi::BufferHandle                       dst,
+    uint64_t                                      offset) noexcept
+{
+    wren::rhi::vulkan::cmd_write_compacted_sizes(*list, {structures, count}, dst, offset);
+}
+
+static void vk_cmd_copy_acceleration_structure(
+    wren::rhi::CommandListHandle           list,
+    wren::rhi::AccelerationStructureHandle src,
+    wren::rhi::AccelerationStructureHandle dst,
+    wren::rhi::AccelerationStructureCopyMode mode) noexcept
+{
+    wren::rhi::vulkan::cmd_copy_acceleration_structure(*list, src, dst, mode);
+}
+
+static void vk_cmd_record_packets(
+    wren::rhi::CommandListHandle    list,
+    wren::rhi::CommandPacket const* packets,
+    uint32_t                        count) noexcept
+{
+    wren::rhi::vulkan::cmd_record_packets(*list, {packets, count});
+}
+
+static void vk_cmd_execute_command_lists(
+    wren::rhi::CommandListHandle        list,
+    wren::rhi::CommandListHandle const* secondaries,
+    uint32_t                            count) noexcept
+{
+    wren::rhi::vulkan::cmd_execute_command_lists(*list, {secondaries, count});
+}
+
+static void vk_cmd_begin_profile_region(
+    wren::rhi::CommandListHandle        list,
+    wren::rhi::ProfileRegionDesc const* desc) noexcept
+{
+    wren::rhi::vulkan::cmd_begin_profile_region(*list, *desc);
+}
+
+static void vk_cmd_end_profile_region(wren::rhi::CommandListHandle list) noexcept {
+    wren::rhi::vulkan::cmd_end_profile_region(*list);
+}
+
 // -------------------------------------------------------------------------------------------------
 // Static backend vtable + DLL entry point
 // -------------------------------------------------------------------------------------------------
@@ -127,11 +1049,220 @@ static void vk_get_capabilities(
 static wren::rhi::BackendVTable s_vulkan_backend{
     .abi_version      = wren::rhi::k_backend_abi_version,
     .backend_id       = vk_backend_id,
+
+    .create_instance    = vk_create_instance,
+    .destroy_instance   = vk_destroy_instance,
+    .enumerate_adapters = vk_enumerate_adapters,
+
     .create_device    = vk_create_device,
     .destroy_device   = vk_destroy_device,
     .get_capabilities = vk_get_capabilities,
+    .create_buffers   = vk_create_buffers,
+    .destroy_buffers  = vk_destroy_buffers,
+    .create_textures  = vk_create_textures,
+    .destroy_textures = vk_destroy_textures,
+    .map_buffer       = vk_map_buffer,
+
+    .buffer_device_address = vk_buffer_device_address,
+
+    .query_bindless_heap    = vk_query_bindless_heap,
+    .buffer_bindless_index  = vk_buffer_bindless_index,
+    .texture_bindless_index = vk_texture_bindless_index,
+    .find_samplers          = vk_find_samplers,
+
+    .query_memory_budget = vk_query_memory_budget,
+    .defragment_memory   = vk_defragment_memory,
+
+    .texture_memory_requirements = vk_texture_memory_requirements,
+    .create_memory_heaps         = vk_create_memory_heaps,
+    .destroy_memory_heaps        = vk_destroy_memory_heaps,
+    .sparse_texture_info         = vk_sparse_texture_info,
+
+    .acceleration_structure_sizes          = vk_acceleration_structure_sizes,
+    .create_acceleration_structures        = vk_create_acceleration_structures,
+    .destroy_acceleration_structures       = vk_destroy_acceleration_structures,
+    .acceleration_structure_reference      = vk_acceleration_structure_reference,
+    .build_acceleration_structures_on_host = vk_build_acceleration_structures_on_host,
+
+    .create_shader_modules    = vk_create_shader_modules,
+    .destroy_shader_modules   = vk_destroy_shader_modules,
+    .shader_module_reflection = vk_shader_module_reflection,
+
+    .query_pipeline_cache = vk_query_pipeline_cache,
+    .save_pipeline_cache  = vk_save_pipeline_cache,
+
+    .create_graphics_pipelines = vk_create_graphics_pipelines,
+    .create_compute_pipelines  = vk_create_compute_pipelines,
+    .destroy_pipelines         = vk_destroy_pipelines,
+    .pipeline_status           = vk_pipeline_status,
+    .prioritize_pipelines      = vk_prioritize_pipelines,
+    .wait_pipelines            = vk_wait_pipelines,
+
+    .begin_frame          = vk_begin_frame,
+    .end_frame            = vk_end_frame,
+    .read_profile_frame   = vk_read_profile_frame,
+    .begin_command_list   = vk_begin_command_list,
+    .end_command_list     = vk_end_command_list,
+    .submit_command_lists = vk_submit_command_lists,
+    .bind_sparse          = vk_bind_sparse,
+    .wait_sync_points     = vk_wait_sync_points,
+    .completed_value      = vk_completed_value,
+
+    .create_swapchain        = vk_create_swapchain,
+    .destroy_swapchain       = vk_destroy_swapchain,
+    .resize_swapchain        = vk_resize_swapchain,
+    .acquire_swapchain_image = vk_acquire_swapchain_image,
+    .present_swapchain       = vk_present_swapchain,
+    .wait_for_present        = vk_wait_for_present,
+    .query_swapchain         = vk_query_swapchain,
+
+    .cmd_barriers               = vk_cmd_barriers,
+    .cmd_copy_buffer            = vk_cmd_copy_buffer,
+    .cmd_copy_buffer_to_texture = vk_cmd_copy_buffer_to_texture,
+    .cmd_copy_texture_to_buffer = vk_cmd_copy_texture_to_buffer,
+    .cmd_begin_rendering        = vk_cmd_begin_rendering,
+    .cmd_end_rendering          = vk_cmd_end_rendering,
+    .cmd_set_viewport           = vk_cmd_set_viewport,
+    .cmd_set_scissor            = vk_cmd_set_scissor,
+    .cmd_bind_pipeline          = vk_cmd_bind_pipeline,
+    .cmd_push_constants         = vk_cmd_push_constants,
+    .cmd_bind_vertex_buffers    = vk_cmd_bind_vertex_buffers,
+    .cmd_bind_index_buffer      = vk_cmd_bind_index_buffer,
+    .cmd_draw                   = vk_cmd_draw,
+    .cmd_draw_indexed           = vk_cmd_draw_indexed,
+    .cmd_dispatch               = vk_cmd_dispatch,
+    .cmd_draw_indirect          = vk_cmd_draw_indirect,
+    .cmd_draw_indexed_indirect  = vk_cmd_draw_indexed_indirect,
+    .cmd_dispatch_indirect      = vk_cmd_dispatch_indirect,
+    .cmd_build_acceleration_structures = vk_cmd_build_acceleration_structures,
+    .cmd_write_compacted_sizes         = vk_cmd_write_compacted_sizes,
+    .cmd_copy_acceleration_structure   = vk_cmd_copy_acceleration_structure,
+    .cmd_record_packets         = vk_cmd_record_packets,
+    .cmd_execute_command_lists  = vk_cmd_execute_command_lists,
+    .cmd_begin_profile_region   = vk_cmd_begin_profile_region,
+    .cmd_end_profile_region     = vk_cmd_end_profile_region,
 };
 
 extern "C" WREN_RHI_VULKAN_EXPORT wren::rhi::BackendVTable* wren_rhi_create() {
     return &s_vulkan_backend;
 }
+
+// -------------------------------------------------------------------------------------------------
+// Static-link entry points (WREN_RHI_STATIC_BACKEND, see wren/rhi/static_backend.hpp)
+//
+// CommandList calls these directly instead of through s_vulkan_backend; each
+// forwards to the vtable function above, which the compiler inlines here.
+// -------------------------------------------------------------------------------------------------
+
+#if WREN_RHI_STATIC_BACKEND
+
+namespace wren::rhi::static_backend {
+
+Status end_command_list(CommandListHandle list) noexcept {
+    return ::vk_end_command_list(list);
+}
+
+void cmd_barriers(CommandListHandle list, TextureBarrier const* textures, uint32_t texture_count,
+                  BufferBarrier const* buffers, uint32_t buffer_count) noexcept {
+    ::vk_cmd_barriers(list, textures, texture_count, buffers, buffer_count);
+}
+
+void cmd_copy_buffer(CommandListHandle list, BufferHandle src, BufferHandle dst,
+                     BufferCopy const* regions, uint32_t count) noexcept {
+    ::vk_cmd_copy_buffer(list, src, dst, regions, count);
+}
+
+void cmd_copy_buffer_to_texture(CommandListHandle list, BufferHandle src, TextureHandle dst,
+                                BufferTextureCopy const* regions, uint32_t count) noexcept {
+    ::vk_cmd_copy_buffer_to_texture(list, src, dst, regions, count);
+}
+
+void cmd_copy_texture_to_buffer(CommandListHandle list, TextureHandle src, BufferHandle dst,
+                                BufferTextureCopy const* regions, uint32_t count) noexcept {
+    ::vk_cmd_copy_texture_to_buffer(list, src, dst, regions, count);
+}
+
+void cmd_begin_rendering(CommandListHandle list, RenderingDesc const* desc) noexcept {
+    ::vk_cmd_begin_rendering(list, desc);
+}
+
+void cmd_end_rendering(CommandListHandle list) noexcept {
+    ::vk_cmd_end_rendering(list);
+}
+
+void cmd_set_viewport(CommandListHandle list, Viewport const* viewport) noexcept {
+    ::vk_cmd_set_viewport(list, viewport);
+}
+
+void cmd_set_scissor(CommandListHandle list, Scissor const* scissor) noexcept {
+    ::vk_cmd_set_scissor(list, scissor);
+}
+
+void cmd_bind_pipeline(CommandListHandle list, PipelineHandle pipeline) noexcept {
+    ::vk_cmd_bind_pipeline(list, pipeline);
+}
+
+void cmd_push_constants(CommandListHandle list, uint32_t offset, uint32_t size,
+                        void const* data) noexcept {
+    ::vk_cmd_push_constants(list, offset, size, data);
+}
+
+void cmd_bind_vertex_buffers(CommandListHandle list, uint32_t first_binding,
+                             BufferHandle const* buffers, uint64_t const* offsets,
+                             uint32_t count) noexcept {
+    ::vk_cmd_bind_vertex_buffers(list, first_binding, buffers, offsets, count);
+}
+
+void cmd_bind_index_buffer(CommandListHandle list, BufferHandle buffer, uint64_t offset,
+                           IndexType type) noexcept {
+    ::vk_cmd_bind_index_buffer(list, buffer, offset, type);
+}
+
+void cmd_draw(CommandListHandle list, uint32_t vertex_count, uint32_t instance_count,
+              uint32_t first_vertex, uint32_t first_instance) noexcept {
+    ::vk_cmd_draw(list, vertex_count, instance_count, first_vertex, first_instance);
+}
+
+void cmd_draw_indexed(CommandListHandle list, uint32_t index_count, uint32_t instance_count,
+                      uint32_t first_index, int32_t vertex_offset,
+                      uint32_t first_instance) noexcept {
+    ::vk_cmd_draw_indexed(list, index_count, instance_count, first_index, vertex_offset, first_instance);
+}
+
+void cmd_dispatch(CommandListHandle list, uint32_t x, uint32_t y, uint32_t z) noexcept {
+    ::vk_cmd_dispatch(list, x, y, z);
+}
+
+void cmd_draw_indirect(CommandListHandle list, IndirectDrawDesc const* desc) noexcept {
+    ::vk_cmd_draw_indirect(list, desc);
+}
+
+void cmd_draw_indexed_indirect(CommandListHandle list, IndirectDrawDesc const* desc) noexcept {
+    ::vk_cmd_draw_indexed_indirect(list, desc);
+}
+
+void cmd_dispatch_indirect(CommandListHandle list, BufferHandle buffer, uint64_t offset) noexcept {
+    ::vk_cmd_dispatch_indirect(list, buffer, offset);
+}
+
+void cmd_record_packets(CommandListHandle list, CommandPacket const* packets,
+                        uint32_t count) noexcept {
+    ::vk_cmd_record_packets(list, packets, count);
+}
+
+void cmd_execute_command_lists(CommandListHandle list, CommandListHandle const* secondaries,
+                               uint32_t count) noexcept {
+    ::vk_cmd_execute_command_lists(list, secondaries, count);
+}
+
+void cmd_begin_profile_region(CommandListHandle list, ProfileRegionDesc const* desc) noexcept {
+    ::vk_cmd_begin_profile_region(list, desc);
+}
+
+void cmd_end_profile_region(CommandListHandle list) noexcept {
+    ::vk_cmd_end_profile_region(list);
+}
+
+} // namespace wren::rhi::static_backend
+
+#endif
@@ -0,0 +1,731 @@
+#include <wren/rhi/vulkan/device.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <expected>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+
+#include <spdlog/spdlog.h>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/rhi/api/state_hash.hpp>
+
+#include "vk_bindless.hpp"
+#include "vk_commands.hpp"
+#include "vk_convert.hpp"
+#include "vk_device_impl.hpp"
+#include "vk_memory.hpp"
+
+namespace wren::rhi::vulkan {
+
+namespace {
+
+// Array sizes when the device allows them; clamped to its limits otherwise.
+constexpr uint32_t k_default_capacity[k_bindless_class_count - 1] = {
+    1u << 16,  // SampledTexture
+    1u << 14,  // StorageTexture
+    1u << 16,  // StorageBuffer
+};
+
+constexpr VkDescriptorType k_descriptor_types[k_bindless_class_count] = {
+    VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+    VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+    VK_DESCRIPTOR_TYPE_SAMPLER,
+};
+
+[[nodiscard]] constexpr uint32_t binding(BindlessClass cls) noexcept {
+    return static_cast<uint32_t>(cls);
+}
+
+void check(VkResult r, const char* what) {
+    if (r != VK_SUCCESS)
+        throw vk::SystemError{vk::make_error_code(static_cast<vk::Result>(r)), what};
+}
+
+// -----------------------------------------------------------------
+// Capacities
+//
+// Each array is clamped to its own per-set and per-stage limits, then all
+// three are scaled down together until their cost fits the shared budget:
+// a descriptor count per stage, or bytes of descriptor buffer.
+// -----------------------------------------------------------------
+struct HeapLimits {
+    uint32_t per_class[k_bindless_class_count - 1]{};
+    uint64_t weight[k_bindless_class_count - 1]{};
+    uint64_t budget = 0;
+};
+
+void pick_capacities(BindlessContext& ctx, HeapLimits const& limits) noexcept {
+    uint64_t cost = 0;
+    for (uint32_t i = 0; i < k_bindless_class_count - 1; ++i) {
+        ctx.slots[i].capacity = std::min(k_default_capacity[i], limits.per_class[i]);
+        cost += ctx.slots[i].capacity * limits.weight[i];
+    }
+    if (cost <= limits.budget) return;
+    for (auto& allocator : ctx.slots)
+        allocator.capacity = static_cast<uint32_t>(uint64_t{allocator.capacity} * limits.budget / cost);
+}
+
+[[nodiscard]] uint32_t sampler_capacity(vk::PhysicalDeviceLimits const& lim, uint32_t per_set,
+                                        uint32_t per_stage) noexcept {
+    return std::min({k_max_samplers, per_set, per_stage, lim.maxSamplerAllocationCount});
+}
+
+[[nodiscard]] HeapLimits descriptor_set_limits(vk::PhysicalDeviceVulkan12Properties const& p12) noexcept {
+    return HeapLimits{
+        .per_class = {
+            std::min(p12.maxDescriptorSetUpdateAfterBindSampledImages,
+                     p12.maxPerStageDescriptorUpdateAfterBindSampledImages),
+            std::min(p12.maxDescriptorSetUpdateAfterBindStorageImages,
+                     p12.maxPerStageDescriptorUpdateAfterBindStorageImages),
+            std::min(p12.maxDescriptorSetUpdateAfterBindStorageBuffers,
+                     p12.maxPerStageDescriptorUpdateAfterBindStorageBuffers),
+        },
+        .weight = {1, 1, 1},
+        .budget = p12.maxPerStageUpdateAfterBindResources,
+    };
+}
+
+[[nodiscard]] HeapLimits descriptor_buffer_limits(vk::PhysicalDeviceLimits const& lim,
+                                                  vk::PhysicalDeviceDescriptorBufferPropertiesEXT const& db) noexcept
+{
+    // Leave room for the samplers and each binding's alignment padding.
+    uint64_t const reserve = 4 * db.descriptorBufferOffsetAlignment +
+                             k_max_samplers * db.samplerDescriptorSize;
+    uint64_t const range   = std::min<uint64_t>(db.maxResourceDescriptorBufferRange,
+                                                db.resourceDescriptorBufferAddressSpaceSize);
+    return HeapLimits{
+        .per_class = {
+            std::min(lim.maxDescriptorSetSampledImages, lim.maxPerStageDescriptorSampledImages),
+            std::min(lim.maxDescriptorSetStorageImages, lim.maxPerStageDescriptorStorageImages),
+            std::min(lim.maxDescriptorSetStorageBuffers, lim.maxPerStageDescriptorStorageBuffers),
+        },
+        .weight = {db.sampledImageDescriptorSize, db.storageImageDescriptorSize, db.storageBufferDescriptorSize},
+        .budget = range > reserve ? range - reserve : 0,
+    };
+}
+
+// -----------------------------------------------------------------
+// Samplers
+// -----------------------------------------------------------------
+constexpr SamplerDesc k_clamp_to_edge{
+    .addressU = AddressMode::ClampToEdge, .addressV = AddressMode::ClampToEdge, .addressW = AddressMode::ClampToEdge};
+
+[[nodiscard]] constexpr SamplerDesc nearest(SamplerDesc desc) noexcept {
+    desc.magFilter  = Filter::Nearest;
+    desc.minFilter  = Filter::Nearest;
+    desc.mipmapMode = MipmapMode::Nearest;
+    return desc;
+}
+
+// In StaticSampler order.
+constexpr SamplerDesc k_static_samplers[k_static_sampler_count] = {
+    SamplerDesc{},
+    k_clamp_to_edge,
+    nearest(SamplerDesc{}),
+    nearest(k_clamp_to_edge),
+    SamplerDesc{.maxAnisotropy = 16},
+};
+
+[[nodiscard]] bool uses(SamplerDesc const& desc, AddressMode mode) noexcept {
+    return desc.addressU == mode || desc.addressV == mode || desc.addressW == mode;
+}
+
+/// Status::Ok when the device can create @p desc as given.
+[[nodiscard]] Status validate(VulkanDevice::Impl const& impl, SamplerDesc const& desc) noexcept {
+    if (desc.maxAnisotropy == 0 || desc.reserved[0] != 0 || desc.reserved[1] != 0 ||
+        std::isnan(desc.mipLodBias) || std::isnan(desc.minLod) || std::isnan(desc.maxLod) ||
+        desc.minLod > desc.maxLod)
+        return Status::InvalidArgument;
+    Feature const enabled = impl.capabilities.features;
+    if (desc.maxAnisotropy > 1 && !has_any(enabled, Feature::AnisotropicFiltering))
+        return Status::MissingRequiredFeature;
+    if (uses(desc, AddressMode::MirrorClampToEdge) && !has_any(enabled, Feature::MirrorClampToEdge))
+        return Status::MissingRequiredFeature;
+    return Status::Ok;
+}
+
+[[nodiscard]] VkResult create_sampler(VulkanDevice::Impl& impl, SamplerDesc const& desc, VkSampler& out) noexcept {
+    auto const& limits = impl.adapter->base().limits;
+    VkSamplerCreateInfo const info{
+        .sType                   = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO,
+        .pNext                   = nullptr,
+        .flags                   = 0,
+        .magFilter               = static_cast<VkFilter>(detail::to_vk(desc.magFilter)),
+        .minFilter               = static_cast<VkFilter>(detail::to_vk(desc.minFilter)),
+        .mipmapMode              = static_cast<VkSamplerMipmapMode>(detail::to_vk(desc.mipmapMode)),
+        .addressModeU            = static_cast<VkSamplerAddressMode>(detail::to_vk(desc.addressU)),
+        .addressModeV            = static_cast<VkSamplerAddressMode>(detail::to_vk(desc.addressV)),
+        .addressModeW            = static_cast<VkSamplerAddressMode>(detail::to_vk(desc.addressW)),
+        .mipLodBias              = std::clamp(desc.mipLodBias, -limits.maxSamplerLodBias, limits.maxSamplerLodBias),
+        .anisotropyEnable        = desc.maxAnisotropy > 1 ? VK_TRUE : VK_FALSE,
+        .maxAnisotropy           = std::min(static_cast<float>(desc.maxAnisotropy), limits.maxSamplerAnisotropy),
+        .compareEnable           = desc.compareEnable ? VK_TRUE : VK_FALSE,
+        .compareOp               = static_cast<VkCompareOp>(detail::to_vk(desc.compareOp)),
+        .minLod                  = desc.minLod,
+        .maxLod                  = std::max(desc.maxLod, desc.minLod),  // 1000 is VK_LOD_CLAMP_NONE
+        .borderColor             = static_cast<VkBorderColor>(detail::to_vk(desc.borderColor)),
+        .unnormalizedCoordinates = VK_FALSE,
+    };
+    return impl.device.getDispatcher()->vkCreateSampler(static_cast<VkDevice>(*impl.device), &info, nullptr, &out);
+}
+
+/// The index holding @p desc, if any. The caller holds sampler_mutex.
+[[nodiscard]] std::optional<uint32_t> lookup_sampler(BindlessContext const& ctx, uint64_t hash,
+                                                     SamplerDesc const& desc) noexcept
+{
+    auto const it = ctx.sampler_index.find(hash);
+    if (it == ctx.sampler_index.end())
+        return std::nullopt;
+    if (ctx.sampler_descs[it->second] == desc)
+        return it->second;
+    // Two descriptors with one 64-bit hash: only the first is in the map.
+    for (uint32_t i = 0; i < ctx.sampler_count; ++i) {
+        if (ctx.sampler_descs[i] == desc) return i;
+    }
+    return std::nullopt;
+}
+
+// -----------------------------------------------------------------
+// Descriptor writes. The caller holds BindlessContext::mutex, or is
+// init_bindless().
+// -----------------------------------------------------------------
+union DescriptorData {
+    VkDescriptorImageInfo  image;
+    VkDescriptorBufferInfo buffer;
+    VkSampler              sampler;
+};
+
+void write_descriptor(VulkanDevice::Impl& impl, BindlessClass cls, uint32_t index,
+                      DescriptorData const& data) noexcept
+{
+    auto& ctx      = impl.bindless;
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+    auto const b   = binding(cls);
+
+    if (!ctx.descriptor_buffer) {
+        VkDescriptorImageInfo const sampler_info{
+            .sampler     = data.sampler,
+            .imageView   = VK_NULL_HANDLE,
+            .imageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        };
+        VkWriteDescriptorSet const write{
+            .sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .pNext            = nullptr,
+            .dstSet           = ctx.set,
+            .dstBinding       = b,
+            .dstArrayElement  = index,
+            .descriptorCount  = 1,
+            .descriptorType   = k_descriptor_types[b],
+            .pImageInfo       = cls == BindlessClass::Sampler       ? &sampler_info
+                              : cls == BindlessClass::StorageBuffer ? nullptr
+                              : &data.image,
+            .pBufferInfo      = cls == BindlessClass::StorageBuffer ? &data.buffer : nullptr,
+            .pTexelBufferView = nullptr,
+        };
+        d->vkUpdateDescriptorSets(dev, 1, &write, 0, nullptr);
+        return;
+    }
+
+    // Storage buffers are addressed by device address in a descriptor buffer.
+    VkDescriptorAddressInfoEXT address{
+        .sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT,
+        .pNext   = nullptr,
+        .address = 0,
+        .range   = 0,
+        .format  = VK_FORMAT_UNDEFINED,
+    };
+    VkDescriptorGetInfoEXT info{
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+        .pNext = nullptr,
+        .type  = k_descriptor_types[b],
+        .data  = {},
+    };
+    switch (cls) {
+        case BindlessClass::SampledTexture: info.data.pSampledImage = &data.image; break;
+        case BindlessClass::StorageTexture: info.data.pStorageImage = &data.image; break;
+        case BindlessClass::Sampler:        info.data.pSampler      = &data.sampler; break;
+        case BindlessClass::StorageBuffer: {
+            VkBufferDeviceAddressInfo const buffer{
+                .sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+                .pNext  = nullptr,
+                .buffer = data.buffer.buffer,
+            };
+            address.address          = d->vkGetBufferDeviceAddress(dev, &buffer);
+            address.range            = data.buffer.range;
+            info.data.pStorageBuffer = &address;
+            break;
+        }
+    }
+    auto* const dst = static_cast<std::byte*>(ctx.memory.mapped) + ctx.binding_offsets[b] +
+                      uint64_t{index} * ctx.descriptor_sizes[b];
+    d->vkGetDescriptorEXT(dev, &info, ctx.descriptor_sizes[b], dst);
+}
+
+void write_buffer(VulkanDevice::Impl& impl, uint32_t index, vk::Buffer buffer, uint64_t size) noexcept {
+    DescriptorData data{};
+    data.buffer = VkDescriptorBufferInfo{
+        .buffer = static_cast<VkBuffer>(buffer),
+        .offset = 0,
+        .range  = std::min(size, impl.bindless.max_storage_range),
+    };
+    write_descriptor(impl, BindlessClass::StorageBuffer, index, data);
+}
+
+// -----------------------------------------------------------------
+// Slot allocation. The caller holds BindlessContext::mutex.
+// -----------------------------------------------------------------
+[[nodiscard]] uint32_t take(BindlessSlotAllocator& a) noexcept {
+    uint32_t index = k_invalid_bindless_index;
+    if (!a.free.empty()) {
+        index = a.free.back();
+        a.free.pop_back();
+    } else if (a.next < a.capacity) {
+        index = a.next++;
+    } else {
+        return index;
+    }
+    ++a.used;
+    return index;
+}
+
+void give(BindlessSlotAllocator& a, uint32_t index) noexcept {
+    if (index == k_invalid_bindless_index) return;
+    a.free.push_back(index);  // reserved for the whole capacity; never reallocates
+    --a.used;
+}
+
+[[nodiscard]] BindlessSlotAllocator& slots(BindlessContext& ctx, BindlessClass cls) noexcept {
+    return ctx.slots[binding(cls)];
+}
+
+// -----------------------------------------------------------------
+// Sampler cache
+// -----------------------------------------------------------------
+
+/// Heap index for @p desc, creating and writing its sampler on first use.
+[[nodiscard]] auto find_sampler(VulkanDevice::Impl& impl, SamplerDesc const& desc) noexcept
+    -> std::expected<uint32_t, Status>
+{
+    auto& ctx           = impl.bindless;
+    uint64_t const hash = hash_state(desc);
+    {
+        std::shared_lock lock{ctx.sampler_mutex};
+        if (auto index = lookup_sampler(ctx, hash, desc)) return *index;
+    }
+    if (Status s = validate(impl, desc); s != Status::Ok)
+        return std::unexpected{s};
+
+    std::unique_lock lock{ctx.sampler_mutex};
+    if (auto index = lookup_sampler(ctx, hash, desc)) return *index;  // raced with another creator
+    if (ctx.sampler_count == ctx.sampler_capacity)
+        return std::unexpected{Status::OutOfMemory};
+
+    uint32_t const index = ctx.sampler_count;
+    bool           keyed = false;
+    try {
+        keyed = ctx.sampler_index.emplace(hash, index).second;
+    } catch (std::bad_alloc const&) {
+        return std::unexpected{Status::OutOfMemory};
+    }
+    if (VkResult r = create_sampler(impl, desc, ctx.samplers[index]); r != VK_SUCCESS) {
+        if (keyed) ctx.sampler_index.erase(hash);
+        ctx.samplers[index] = VK_NULL_HANDLE;
+        return std::unexpected{detail::to_status(r)};
+    }
+    ctx.sampler_descs[index] = desc;
+    {
+        std::scoped_lock heap_lock{ctx.mutex};
+        DescriptorData data{};
+        data.sampler = ctx.samplers[index];
+        write_descriptor(impl, BindlessClass::Sampler, index, data);
+    }
+    ++ctx.sampler_count;
+    return index;
+}
+
+// -----------------------------------------------------------------
+// Setup
+// -----------------------------------------------------------------
+void create_set_layout(VulkanDevice::Impl& impl) {
+    auto& ctx = impl.bindless;
+
+    VkDescriptorSetLayoutBinding bindings[k_bindless_class_count]{};
+    VkDescriptorBindingFlags     binding_flags[k_bindless_class_count]{};
+    for (uint32_t b = 0; b < k_bindless_class_count; ++b) {
+        bindings[b] = VkDescriptorSetLayoutBinding{
+            .binding            = b,
+            .descriptorType     = k_descriptor_types[b],
+            .descriptorCount    = b < k_bindless_class_count - 1 ? ctx.slots[b].capacity : ctx.sampler_capacity,
+            .stageFlags         = VK_SHADER_STAGE_ALL,
+            .pImmutableSamplers = nullptr,
+        };
+        // Slots are written while lists using the set are pending, and most
+        // of them hold nothing; samplers are appended on first request.
+        binding_flags[b] = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+                           VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+                           VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+    }
+
+    // A descriptor buffer has no update-after-bind semantics to ask for:
+    // its memory may be written at any time and unused slots are never read.
+    VkDescriptorSetLayoutBindingFlagsCreateInfo const flags_info{
+        .sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO,
+        .pNext         = nullptr,
+        .bindingCount  = k_bindless_class_count,
+        .pBindingFlags = binding_flags,
+    };
+    VkDescriptorSetLayoutCreateInfo const info{
+        .sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+        .pNext        = ctx.descriptor_buffer ? nullptr : &flags_info,
+        .flags        = ctx.descriptor_buffer
+                      ? VkDescriptorSetLayoutCreateFlags{VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT}
+                      : VkDescriptorSetLayoutCreateFlags{VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT},
+        .bindingCount = k_bindless_class_count,
+        .pBindings    = bindings,
+    };
+    check(impl.device.getDispatcher()->vkCreateDescriptorSetLayout(static_cast<VkDevice>(*impl.device), &info,
+                                                                   nullptr, &ctx.set_layout),
+          "vkCreateDescriptorSetLayout");
+}
+
+void create_descriptor_set(VulkanDevice::Impl& impl) {
+    auto& ctx      = impl.bindless;
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    VkDescriptorPoolSize sizes[k_bindless_class_count]{};
+    for (uint32_t b = 0; b < k_bindless_class_count; ++b) {
+        sizes[b] = VkDescriptorPoolSize{
+            .type            = k_descriptor_types[b],
+            .descriptorCount = b < k_bindless_class_count - 1 ? ctx.slots[b].capacity : ctx.sampler_capacity,
+        };
+    }
+    VkDescriptorPoolCreateInfo const pool_info{
+        .sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+        .pNext         = nullptr,
+        .flags         = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT,
+        .maxSets       = 1,
+        .poolSizeCount = k_bindless_class_count,
+        .pPoolSizes    = sizes,
+    };
+    check(d->vkCreateDescriptorPool(dev, &pool_info, nullptr, &ctx.pool), "vkCreateDescriptorPool");
+
+    VkDescriptorSetAllocateInfo const alloc{
+        .sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+        .pNext              = nullptr,
+        .descriptorPool     = ctx.pool,
+        .descriptorSetCount = 1,
+        .pSetLayouts        = &ctx.set_layout,
+    };
+    check(d->vkAllocateDescriptorSets(dev, &alloc, &ctx.set), "vkAllocateDescriptorSets");
+}
+
+void create_descriptor_buffer(VulkanDevice::Impl& impl,
+                              vk::PhysicalDeviceDescriptorBufferPropertiesEXT const& db) {
+    auto& ctx      = impl.bindless;
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    VkDeviceSize size = 0;
+    d->vkGetDescriptorSetLayoutSizeEXT(dev, ctx.set_layout, &size);
+    for (uint32_t b = 0; b < k_bindless_class_count; ++b)
+        d->vkGetDescriptorSetLayoutBindingOffsetEXT(dev, ctx.set_layout, b, &ctx.binding_offsets[b]);
+    ctx.descriptor_sizes[0] = db.sampledImageDescriptorSize;
+    ctx.descriptor_sizes[1] = db.storageImageDescriptorSize;
+    ctx.descriptor_sizes[2] = db.storageBufferDescriptorSize;
+    ctx.descriptor_sizes[3] = db.samplerDescriptorSize;
+
+    ctx.buffer_usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                       VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+                       VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    VkBufferCreateInfo const info{
+        .sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .pNext                 = nullptr,
+        .flags                 = 0,
+        .size                  = size,
+        .usage                 = ctx.buffer_usage,
+        .sharingMode           = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices   = nullptr,
+    };
+    check(d->vkCreateBuffer(dev, &info, nullptr, &ctx.buffer), "vkCreateBuffer");
+
+    VkMemoryRequirements reqs{};
+    d->vkGetBufferMemoryRequirements(dev, ctx.buffer, &reqs);
+    reqs.alignment = std::max(reqs.alignment, db.descriptorBufferOffsetAlignment);
+
+    // Written by the CPU whenever a resource is created, so it stays mapped.
+    auto alloc = allocate_memory(impl, MemoryRequest{
+        .requirements = reqs,
+        .usage        = MemoryUsage::Upload,
+        .tiling       = ResourceTiling::Linear,
+    });
+    if (!alloc)
+        check(VK_ERROR_OUT_OF_DEVICE_MEMORY, "bindless descriptor buffer");
+    ctx.memory = *alloc;
+    check(d->vkBindBufferMemory(dev, ctx.buffer, static_cast<VkDeviceMemory>(ctx.memory.memory), ctx.memory.offset),
+          "vkBindBufferMemory");
+
+    VkBufferDeviceAddressInfo const address{
+        .sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+        .pNext  = nullptr,
+        .buffer = ctx.buffer,
+    };
+    ctx.address = d->vkGetBufferDeviceAddress(dev, &address);
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Lifecycle
+// -------------------------------------------------------------------------------------------------
+void init_bindless(VulkanDevice::Impl& impl) {
+    auto& ctx             = impl.bindless;
+    Feature const enabled = impl.capabilities.features;
+    if (!has_any(enabled, Feature::DescriptorIndexing_Bindless))
+        return;
+    ctx.enabled           = true;
+    ctx.descriptor_buffer = has_all(enabled, Feature::DescriptorBuffer | Feature::BufferDeviceAddress);
+
+    auto const& props     = impl.adapter->properties;
+    auto const& limits    = impl.adapter->base().limits;
+    ctx.max_storage_range = limits.maxStorageBufferRange;
+
+    // descriptor_buffer is only filled when the extension is present.
+    if (ctx.descriptor_buffer) {
+        pick_capacities(ctx, descriptor_buffer_limits(limits, props.descriptor_buffer));
+        ctx.sampler_capacity = sampler_capacity(limits, limits.maxDescriptorSetSamplers,
+                                                limits.maxPerStageDescriptorSamplers);
+    } else {
+        pick_capacities(ctx, descriptor_set_limits(props.vk12));
+        ctx.sampler_capacity = sampler_capacity(limits, props.vk12.maxDescriptorSetUpdateAfterBindSamplers,
+                                                props.vk12.maxPerStageDescriptorUpdateAfterBindSamplers);
+    }
+    for (auto& allocator : ctx.slots)
+        allocator.free.reserve(allocator.capacity);
+
+    create_set_layout(impl);
+    if (ctx.descriptor_buffer)
+        create_descriptor_buffer(impl, props.descriptor_buffer);
+    else
+        create_descriptor_set(impl);
+
+    // The static samplers take the first indices. Without anisotropy the
+    // last one is plain linear and keys as LinearRepeat, which keeps index 0.
+    bool const anisotropy = has_any(enabled, Feature::AnisotropicFiltering);
+    ctx.sampler_index.reserve(ctx.sampler_capacity);
+    for (uint32_t i = 0; i < k_static_sampler_count; ++i) {
+        SamplerDesc desc = k_static_samplers[i];
+        if (!anisotropy) desc.maxAnisotropy = 1;
+        check(create_sampler(impl, desc, ctx.samplers[i]), "vkCreateSampler");
+        ctx.sampler_descs[i] = desc;
+        ctx.sampler_index.emplace(hash_state(desc), i);
+        DescriptorData data{};
+        data.sampler = ctx.samplers[i];
+        write_descriptor(impl, BindlessClass::Sampler, i, data);
+    }
+    ctx.sampler_count = k_static_sampler_count;
+
+    SPDLOG_INFO("[wren/rhi/vulkan] Bindless heap ({}): {} sampled, {} storage textures, {} storage buffers, "
+                "{} samplers.",
+                ctx.descriptor_buffer ? "descriptor buffer" : "descriptor set",
+                ctx.slots[0].capacity, ctx.slots[1].capacity, ctx.slots[2].capacity, ctx.sampler_capacity);
+}
+
+void release_bindless(VulkanDevice::Impl& impl) noexcept {
+    auto& ctx      = impl.bindless;
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    if (ctx.buffer) d->vkDestroyBuffer(dev, ctx.buffer, nullptr);
+    if (ctx.memory.memory) free_memory(impl, ctx.memory);
+    if (ctx.pool) d->vkDestroyDescriptorPool(dev, ctx.pool, nullptr);  // frees the set
+    for (VkSampler sampler : ctx.samplers) {
+        if (sampler) d->vkDestroySampler(dev, sampler, nullptr);
+    }
+    if (ctx.set_layout) d->vkDestroyDescriptorSetLayout(dev, ctx.set_layout, nullptr);
+
+    ctx.buffer     = VK_NULL_HANDLE;
+    ctx.memory     = {};
+    ctx.pool       = VK_NULL_HANDLE;
+    ctx.set        = VK_NULL_HANDLE;
+    ctx.set_layout = VK_NULL_HANDLE;
+    std::ranges::fill(ctx.samplers, VkSampler{VK_NULL_HANDLE});
+    ctx.sampler_index.clear();
+    ctx.sampler_count = 0;
+    ctx.enabled       = false;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Slots
+// -------------------------------------------------------------------------------------------------
+auto acquire_bindless_buffer(VulkanDevice::Impl& impl, vk::Buffer buffer, uint64_t size) noexcept
+    -> std::expected<uint32_t, Status>
+{
+    auto& ctx = impl.bindless;
+    if (!ctx.enabled)
+        return k_invalid_bindless_index;
+
+    std::scoped_lock lock{ctx.mutex};
+    uint32_t const index = take(slots(ctx, BindlessClass::StorageBuffer));
+    if (index == k_invalid_bindless_index)
+        return std::unexpected{Status::OutOfMemory};
+    write_buffer(impl, index, buffer, size);
+    return index;
+}
+
+auto acquire_bindless_texture(VulkanDevice::Impl& impl, vk::ImageView view, TextureUsage usage) noexcept
+    -> std::expected<BindlessSlots, Status>
+{
+    auto& ctx = impl.bindless;
+    BindlessSlots out;
+    if (!ctx.enabled)
+        return out;
+
+    bool const sampled = underlying(usage & TextureUsage::Sampled) != 0;
+    bool const storage = underlying(usage & TextureUsage::Storage) != 0;
+
+    std::scoped_lock lock{ctx.mutex};
+    if (sampled) out.sampled = take(slots(ctx, BindlessClass::SampledTexture));
+    if (storage) out.storage = take(slots(ctx, BindlessClass::StorageTexture));
+    if ((sampled && out.sampled == k_invalid_bindless_index) ||
+        (storage && out.storage == k_invalid_bindless_index)) {
+        give(slots(ctx, BindlessClass::SampledTexture), out.sampled);
+        give(slots(ctx, BindlessClass::StorageTexture), out.storage);
+        return std::unexpected{Status::OutOfMemory};
+    }
+
+    // Layouts match the ones cmd_barriers() uses for each access.
+    DescriptorData data{};
+    data.image.imageView = static_cast<VkImageView>(view);
+    if (sampled) {
+        data.image.imageLayout = VK_IMAGE_LAYOUT_READ_ONLY_OPTIMAL;
+        write_descriptor(impl, BindlessClass::SampledTexture, out.sampled, data);
+    }
+    if (storage) {
+        data.image.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+        write_descriptor(impl, BindlessClass::StorageTexture, out.storage, data);
+    }
+    return out;
+}
+
+void release_bindless_buffer(VulkanDevice::Impl& impl, uint32_t index) noexcept {
+    auto& ctx = impl.bindless;
+    if (index == k_invalid_bindless_index) return;
+    std::scoped_lock lock{ctx.mutex};
+    give(slots(ctx, BindlessClass::StorageBuffer), index);
+}
+
+void release_bindless_texture(VulkanDevice::Impl& impl, BindlessSlots s) noexcept {
+    auto& ctx = impl.bindless;
+    if (s.sampled == k_invalid_bindless_index && s.storage == k_invalid_bindless_index) return;
+    std::scoped_lock lock{ctx.mutex};
+    give(slots(ctx, BindlessClass::SampledTexture), s.sampled);
+    give(slots(ctx, BindlessClass::StorageTexture), s.storage);
+}
+
+void rewrite_bindless_buffer(VulkanDevice::Impl& impl, uint32_t index, vk::Buffer buffer,
+                             uint64_t size) noexcept
+{
+    std::scoped_lock lock{impl.bindless.mutex};
+    write_buffer(impl, index, buffer, size);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Recording
+// -------------------------------------------------------------------------------------------------
+void cmd_bind_bindless_heap(CommandListState& list) noexcept {
+    auto const& ctx = list.device->bindless;
+    if (!ctx.enabled || list.queue == QueueType::Transfer)
+        return;
+
+    VkPipelineBindPoint const points[] = {VK_PIPELINE_BIND_POINT_COMPUTE, VK_PIPELINE_BIND_POINT_GRAPHICS};
+    uint32_t const point_count = list.queue == QueueType::Compute ? 1 : 2;
+    VkPipelineLayout const layout = list.device->pipelines.layout;
+
+    if (ctx.descriptor_buffer) {
+        VkDescriptorBufferBindingInfoEXT const buffer{
+            .sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+            .pNext   = nullptr,
+            .address = ctx.address,
+            .usage   = ctx.buffer_usage,
+        };
+        list.dispatch->vkCmdBindDescriptorBuffersEXT(list.cmd, 1, &buffer);
+
+        uint32_t const     buffer_index = 0;
+        VkDeviceSize const offset       = 0;
+        for (uint32_t i = 0; i < point_count; ++i)
+            list.dispatch->vkCmdSetDescriptorBufferOffsetsEXT(list.cmd, points[i], layout, 0, 1,
+                                                              &buffer_index, &offset);
+        return;
+    }
+    for (uint32_t i = 0; i < point_count; ++i)
+        list.dispatch->vkCmdBindDescriptorSets(list.cmd, points[i], layout, 0, 1, &ctx.set, 0, nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+// VulkanDevice — bindless heap
+// -------------------------------------------------------------------------------------------------
+void VulkanDevice::bindless_heap_info(BindlessHeapInfo& out) const noexcept {
+    auto const& ctx      = impl_->bindless;
+    out                  = {};
+    out.enabled          = ctx.enabled;
+    out.descriptorBuffer = ctx.descriptor_buffer;
+    if (!ctx.enabled) return;
+
+    {
+        std::scoped_lock lock{ctx.mutex};
+        for (uint32_t i = 0; i < k_bindless_class_count - 1; ++i) {
+            out.capacity[i] = ctx.slots[i].capacity;
+            out.used[i]     = ctx.slots[i].used;
+        }
+    }
+    // Taken after `mutex` is released: find_sampler nests them the other way.
+    std::shared_lock lock{ctx.sampler_mutex};
+    out.capacity[binding(BindlessClass::Sampler)] = ctx.sampler_capacity;
+    out.used[binding(BindlessClass::Sampler)]     = ctx.sampler_count;
+}
+
+auto VulkanDevice::find_samplers(std::span<SamplerDesc const> descs, std::span<uint32_t> out) noexcept -> Status {
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    Status status = impl_->bindless.enabled ? Status::Ok : Status::MissingRequiredFeature;
+    for (size_t i = 0; i < descs.size() && status == Status::Ok; ++i) {
+        auto index = find_sampler(*impl_, descs[i]);
+        if (index)
+            out[i] = *index;
+        else
+            status = index.error();
+    }
+    // Samplers created before a failure stay cached for the next call.
+    if (status != Status::Ok)
+        std::ranges::fill(out.first(descs.size()), k_invalid_bindless_index);
+    return status;
+}
+
+auto VulkanDevice::bindless_index(BufferHandle handle) const noexcept -> uint32_t {
+    std::shared_lock lock{impl_->buffers_mutex};
+    auto const* index = impl_->buffers.get<3>(handle);
+    return index ? *index : k_invalid_bindless_index;
+}
+
+auto VulkanDevice::bindless_index(TextureHandle handle, BindlessClass cls) const noexcept -> uint32_t {
+    std::shared_lock lock{impl_->textures_mutex};
+    auto const* s = impl_->textures.get<3>(handle);
+    if (!s) return k_invalid_bindless_index;
+    switch (cls) {
+        case BindlessClass::SampledTexture: return s->sampled;
+        case BindlessClass::StorageTexture: return s->storage;
+        default:                            return k_invalid_bindless_index;
+    }
+}
+
+} // namespace wren::rhi::vulkan
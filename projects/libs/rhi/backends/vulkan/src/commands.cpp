@@ -0,0 +1,1196 @@
+#include <wren/rhi/vulkan/device.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+
+#include <spdlog/spdlog.h>
+#include <vulkan/vulkan_raii.hpp>
+
+#include "vk_commands.hpp"
+#include "vk_convert.hpp"
+#include "vk_deferred.hpp"
+#include "vk_device_impl.hpp"
+#include "vk_profiler.hpp"
+
+namespace wren::rhi::vulkan {
+
+namespace {
+
+// Command buffers allocated per vkAllocateCommandBuffers call when a pool
+// runs out of recycled lists.
+constexpr uint32_t k_list_allocation_batch = 8;
+
+// Stack batch sizes for translating recording arguments. Longer inputs are
+// split into several calls.
+constexpr uint32_t k_barrier_batch      = 32;
+constexpr uint32_t k_copy_region_batch  = 16;
+constexpr uint32_t k_vertex_buffer_max  = 32;
+constexpr uint32_t k_execute_batch      = 64;
+
+static_assert(sizeof(BufferCopy) == sizeof(VkBufferCopy) &&
+              offsetof(BufferCopy, srcOffset) == offsetof(VkBufferCopy, srcOffset) &&
+              offsetof(BufferCopy, dstOffset) == offsetof(VkBufferCopy, dstOffset) &&
+              offsetof(BufferCopy, size)      == offsetof(VkBufferCopy, size),
+              "BufferCopy is passed to vkCmdCopyBuffer as-is");
+
+static_assert(sizeof(DrawIndirectCommand) == sizeof(VkDrawIndirectCommand) &&
+              sizeof(DrawIndexedIndirectCommand) == sizeof(VkDrawIndexedIndirectCommand) &&
+              offsetof(DrawIndexedIndirectCommand, vertexOffset) ==
+                  offsetof(VkDrawIndexedIndirectCommand, vertexOffset) &&
+              sizeof(DispatchIndirectCommand) == sizeof(VkDispatchIndirectCommand),
+              "indirect records are read by the GPU in Vulkan's layout");
+
+// -----------------------------------------------------------------
+// Thread → pool slot binding
+//
+// A recording thread claims a pool slot on its first list for a device and
+// keeps it for the device's lifetime. The few most recent devices are
+// remembered per thread; serials are never reused, so a binding cannot leak
+// onto a new device allocated at the same address.
+// -----------------------------------------------------------------
+std::atomic<uint64_t> g_next_context_serial{1};
+
+struct ThreadBinding {
+    uint64_t serial = 0;
+    uint32_t slot   = 0;
+};
+thread_local std::array<ThreadBinding, 4> t_bindings{};
+
+[[nodiscard]] std::optional<uint32_t> bind_thread(CommandContext& ctx) noexcept {
+    for (auto const& b : t_bindings) {
+        if (b.serial == ctx.serial)
+            return b.slot;
+    }
+
+    uint32_t slot = ctx.next_thread_slot.load(std::memory_order_relaxed);
+    do {
+        if (slot >= k_max_recording_threads)
+            return std::nullopt;
+    } while (!ctx.next_thread_slot.compare_exchange_weak(slot, slot + 1, std::memory_order_acq_rel));
+
+    std::shift_right(t_bindings.begin(), t_bindings.end(), 1);
+    t_bindings.front() = {ctx.serial, slot};
+    return slot;
+}
+
+// -----------------------------------------------------------------
+// Resource state → synchronization2 scope
+//
+// Usages act as resource states (ARCHITECTURE.md §4.9). A state combining
+// several usages is legal but falls back to the GENERAL layout.
+// -----------------------------------------------------------------
+struct AccessScope {
+    vk::PipelineStageFlags2 stages;
+    vk::AccessFlags2        access;
+    vk::ImageLayout         layout = vk::ImageLayout::eUndefined;
+};
+
+[[nodiscard]] vk::PipelineStageFlags2 shader_scope(ShaderStage stages) noexcept {
+    // Without a hint the access may come from any stage.
+    return stages == ShaderStage::None ? vk::PipelineStageFlags2{vk::PipelineStageFlagBits2::eAllCommands}
+                                       : detail::to_vk_pipeline_stages(stages);
+}
+
+[[nodiscard]] AccessScope texture_scope(TextureUsage usage, ShaderStage stages) noexcept {
+    using P = vk::PipelineStageFlagBits2;
+    using A = vk::AccessFlagBits2;
+    using L = vk::ImageLayout;
+
+    AccessScope out{};
+    uint32_t    states = 0;
+    auto const add = [&](TextureUsage bit, vk::PipelineStageFlags2 s, vk::AccessFlags2 a, L layout) {
+        if (underlying(usage & bit) == 0) return;
+        out.stages |= s;
+        out.access |= a;
+        out.layout  = layout;
+        ++states;
+    };
+
+    add(TextureUsage::Sampled,         shader_scope(stages),
+        A::eShaderSampledRead,                                            L::eReadOnlyOptimal);
+    add(TextureUsage::Storage,         shader_scope(stages),
+        A::eShaderStorageRead | A::eShaderStorageWrite,                   L::eGeneral);
+    add(TextureUsage::ColorAttachment, P::eColorAttachmentOutput,
+        A::eColorAttachmentRead | A::eColorAttachmentWrite,               L::eAttachmentOptimal);
+    add(TextureUsage::DepthStencilAtt, P::eEarlyFragmentTests | P::eLateFragmentTests,
+        A::eDepthStencilAttachmentRead | A::eDepthStencilAttachmentWrite, L::eAttachmentOptimal);
+    add(TextureUsage::TransferSrc,     P::eAllTransfer, A::eTransferRead,  L::eTransferSrcOptimal);
+    add(TextureUsage::TransferDst,     P::eAllTransfer, A::eTransferWrite, L::eTransferDstOptimal);
+    // The presentation engine is ordered by the present semaphore, not by the barrier.
+    add(TextureUsage::Present,         P::eNone,        A::eNone,          L::ePresentSrcKHR);
+
+    if (states > 1)
+        out.layout = L::eGeneral;
+    return out;
+}
+
+[[nodiscard]] AccessScope buffer_scope(BufferUsage usage, ShaderStage stages) noexcept {
+    using P = vk::PipelineStageFlagBits2;
+    using A = vk::AccessFlagBits2;
+
+    AccessScope out{};
+    auto const add = [&](BufferUsage bit, vk::PipelineStageFlags2 s, vk::AccessFlags2 a) {
+        if (underlying(usage & bit) == 0) return;
+        out.stages |= s;
+        out.access |= a;
+    };
+
+    add(BufferUsage::Vertex,      P::eVertexAttributeInput, A::eVertexAttributeRead);
+    add(BufferUsage::Index,       P::eIndexInput,           A::eIndexRead);
+    add(BufferUsage::Uniform,     shader_scope(stages),     A::eUniformRead);
+    add(BufferUsage::Storage,     shader_scope(stages),     A::eShaderStorageRead | A::eShaderStorageWrite);
+    add(BufferUsage::Indirect,    P::eDrawIndirect,         A::eIndirectCommandRead);
+    add(BufferUsage::TransferSrc, P::eAllTransfer,          A::eTransferRead);
+    add(BufferUsage::TransferDst, P::eAllTransfer,          A::eTransferWrite);
+    // Builds read their vertices, indices, transforms and instances as shader reads.
+    add(BufferUsage::AccelerationStructureInput, P::eAccelerationStructureBuildKHR, A::eShaderRead);
+    return out;
+}
+
+// -----------------------------------------------------------------
+// Queue family ownership
+//
+// Equal families need no transfer. Otherwise the family of the list the
+// barrier is recorded into decides which half it is: the release drops its
+// destination scope and the acquire its source scope (the timeline wait
+// between the two submissions orders them).
+//
+// Aliased queues (say Transfer falling back to the graphics family) still
+// see both halves recorded. The release then performs the whole transition
+// and the acquire is skipped, or the layout change would run twice.
+// -----------------------------------------------------------------
+struct OwnershipTransfer {
+    uint32_t src_family = VK_QUEUE_FAMILY_IGNORED;
+    uint32_t dst_family = VK_QUEUE_FAMILY_IGNORED;
+    bool     release    = false;
+    bool     acquire    = false;
+    bool     skip       = false;  // redundant acquire on an aliased queue
+};
+
+[[nodiscard]] OwnershipTransfer ownership(CommandContext const& ctx, QueueType recording_queue,
+                                          QueueType src, QueueType dst) noexcept
+{
+    uint32_t const from = ctx.families[queue_slot(src)];
+    uint32_t const to   = ctx.families[queue_slot(dst)];
+    if (from == to) {
+        uint32_t const slot = queue_slot(recording_queue);
+        return {.skip = queue_slot(src) != queue_slot(dst) && slot == queue_slot(dst)};
+    }
+
+    uint32_t const here = ctx.families[queue_slot(recording_queue)];
+    assert((here == from || here == to) && "ownership barrier recorded on an unrelated queue");
+    return {from, to, here == from, here == to};
+}
+
+void apply_ownership(OwnershipTransfer const& own, AccessScope& src, AccessScope& dst) noexcept {
+    if (own.release) {
+        dst.stages = {};
+        dst.access = {};
+    }
+    if (own.acquire) {
+        src.stages = {};
+        src.access = {};
+    }
+}
+
+// -----------------------------------------------------------------
+// Timeline waits
+// -----------------------------------------------------------------
+
+/// Blocks until every submit-target timeline s reaches values[s]; zero
+/// entries are skipped. One vkWaitSemaphores call covers all queues.
+[[nodiscard]] Status wait_timelines(VulkanDevice::Impl const&                     impl,
+                                    std::span<uint64_t const, k_queue_slot_count> values,
+                                    uint64_t                                      timeout_ns) noexcept
+{
+    auto const& ctx = impl.commands;
+
+    std::array<VkSemaphore, k_queue_slot_count> semaphores{};
+    std::array<uint64_t, k_queue_slot_count>    targets{};
+    uint32_t count = 0;
+    for (uint32_t s = 0; s < k_queue_slot_count; ++s) {
+        if (values[s] == 0) continue;
+        semaphores[count] = static_cast<VkSemaphore>(ctx.timelines[s]);
+        targets[count++]  = values[s];
+    }
+    if (count == 0)
+        return Status::Ok;
+
+    VkSemaphoreWaitInfo const info{
+        .sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+        .pNext          = nullptr,
+        .flags          = 0,
+        .semaphoreCount = count,
+        .pSemaphores    = semaphores.data(),
+        .pValues        = targets.data(),
+    };
+    return detail::to_status(impl.device.getDispatcher()->vkWaitSemaphores(
+        static_cast<VkDevice>(*impl.device), &info, timeout_ns));
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Setup & teardown
+// -------------------------------------------------------------------------------------------------
+void init_commands(VulkanDevice::Impl& impl, uint32_t frames_in_flight) {
+    auto& ctx = impl.commands;
+    ctx.serial           = g_next_context_serial.fetch_add(1, std::memory_order_relaxed);
+    ctx.frames_in_flight = std::clamp(frames_in_flight, 1u, k_max_frames_in_flight);
+
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    uint32_t const families[k_queue_slot_count] = {
+        impl.queue_indices.graphics, impl.queue_indices.compute, impl.queue_indices.transfer};
+
+    for (uint32_t s = 0; s < k_queue_slot_count; ++s) {
+        ctx.families[s]      = families[s];
+        ctx.submit_target[s] = s;
+        for (uint32_t o = 0; o < s; ++o) {
+            if (families[o] == families[s]) {
+                ctx.submit_target[s] = o;
+                break;
+            }
+        }
+
+        // One queue is created per unique family (device.cpp step 7).
+        VkQueue queue = VK_NULL_HANDLE;
+        d->vkGetDeviceQueue(dev, families[s], 0, &queue);
+        ctx.queues[s] = vk::Queue{queue};
+
+        if (ctx.submit_target[s] == s) {
+            vk::StructureChain<vk::SemaphoreCreateInfo, vk::SemaphoreTypeCreateInfo> const info{
+                vk::SemaphoreCreateInfo{},
+                vk::SemaphoreTypeCreateInfo{vk::SemaphoreType::eTimeline, 0}};
+            ctx.timelines[s] =
+                vk::raii::Semaphore{impl.device, info.get<vk::SemaphoreCreateInfo>()}.release();
+        }
+    }
+    init_sparse(impl);
+}
+
+void release_commands(VulkanDevice::Impl& impl) noexcept {
+    auto& ctx      = impl.commands;
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    for (auto& frame : ctx.frames) {
+        for (auto& pools : frame.threads) {
+            if (!pools) continue;
+            for (auto const& q : pools->queues) {
+                // Destroying the pool frees its command buffers.
+                d->vkDestroyCommandPool(dev, static_cast<VkCommandPool>(q.pool), nullptr);
+            }
+            pools.reset();
+        }
+    }
+    for (auto& timeline : ctx.timelines) {
+        d->vkDestroySemaphore(dev, static_cast<VkSemaphore>(timeline), nullptr);
+        timeline = vk::Semaphore{};
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Frames
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::begin_frame() noexcept -> Status {
+    auto& ctx = impl_->commands;
+    if (ctx.in_frame)
+        return Status::InvalidArgument;
+
+    auto const* d  = impl_->device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl_->device);
+
+    uint32_t const slot  = static_cast<uint32_t>(ctx.frame_number % ctx.frames_in_flight);
+    auto&          frame = ctx.frames[slot];
+
+    // Throttle: the GPU must have retired what this slot submitted
+    // framesInFlight frames ago before its pools are reused.
+    if (Status s = wait_timelines(*impl_, frame.retire_values, UINT64_MAX); s != Status::Ok)
+        return s;
+
+    // Recycle every thread's pools for the slot. Command buffers stay
+    // allocated and are re-begun by their next owner.
+    uint32_t const threads = std::min(ctx.next_thread_slot.load(std::memory_order_acquire),
+                                      k_max_recording_threads);
+    for (uint32_t t = 0; t < threads; ++t) {
+        auto* pools = frame.threads[t].get();
+        if (!pools) continue;
+        for (auto& q : pools->queues) {
+            if (!q.pool) continue;
+            if (VkResult r = d->vkResetCommandPool(dev, static_cast<VkCommandPool>(q.pool), 0);
+                r != VK_SUCCESS)
+                return detail::to_status(r);
+            q.used[0] = q.used[1] = 0;
+        }
+    }
+
+    // Destroy whatever was released before work the GPU has now finished.
+    collect_deferred(*impl_);
+
+    ctx.frame_slot = slot;
+    ++ctx.frame_number;
+
+    // The slot's queries retired with its lists; read them back before reuse.
+    recycle_profile_slot(*impl_, slot, ctx.frame_number);
+    recycle_compaction_queries(impl_->raytracing, slot);
+
+    ctx.in_frame = true;
+    return Status::Ok;
+}
+
+auto VulkanDevice::end_frame() noexcept -> Status {
+    auto& ctx = impl_->commands;
+    if (!ctx.in_frame)
+        return Status::InvalidArgument;
+    ctx.in_frame = false;
+
+    auto const* d = impl_->device.getDispatcher();
+    auto&   frame = ctx.frames[ctx.frame_slot];
+    Status status = Status::Ok;
+
+    std::scoped_lock lock{ctx.pending_mutex};
+    for (uint32_t s = 0; s < k_queue_slot_count; ++s) {
+        // Recorded even for idle queues: waiting on a value already reached
+        // is free, and it keeps the slot's retire point exact.
+        frame.retire_values[s] = ctx.last_value[s];
+
+        auto& pending = ctx.pending[s];
+        if (pending.empty()) continue;
+
+        // submit() and bind_sparse() reserved the scratch capacity, so
+        // nothing allocates here.
+        ctx.submit_scratch.clear();
+        ctx.signal_scratch.clear();
+        for (PendingBatch const& b : pending.batches) {
+            ctx.signal_scratch.push_back(VkSemaphoreSubmitInfo{
+                .sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+                .pNext       = nullptr,
+                .semaphore   = static_cast<VkSemaphore>(ctx.timelines[s]),
+                .value       = b.signal,
+                .stageMask   = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                .deviceIndex = 0,
+            });
+        }
+
+        VkQueue const queue = static_cast<VkQueue>(ctx.queues[s]);
+        auto const submit_run = [&]() noexcept -> VkResult {
+            if (ctx.submit_scratch.empty())
+                return VK_SUCCESS;
+            VkResult const r = d->vkQueueSubmit2(queue, static_cast<uint32_t>(ctx.submit_scratch.size()),
+                                                 ctx.submit_scratch.data(), VK_NULL_HANDLE);
+            ctx.submit_scratch.clear();
+            return r;
+        };
+
+        // Runs of ordinary batches go out in one vkQueueSubmit2 each; a
+        // sparse batch ends the run and goes out on its own, in queue order.
+        VkResult r = VK_SUCCESS;
+        for (std::size_t i = 0; i < pending.batches.size() && r == VK_SUCCESS; ++i) {
+            PendingBatch const& b = pending.batches[i];
+            if (b.sparse) {
+                r = submit_run();
+                if (r == VK_SUCCESS)
+                    r = bind_sparse_batch(*impl_, s, b);
+                continue;
+            }
+            ctx.submit_scratch.push_back(VkSubmitInfo2{
+                .sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+                .pNext                    = nullptr,
+                .flags                    = 0,
+                .waitSemaphoreInfoCount   = b.wait_count,
+                .pWaitSemaphoreInfos      = b.wait_count ? pending.waits.data() + b.first_wait : nullptr,
+                .commandBufferInfoCount   = b.list_count,
+                .pCommandBufferInfos      = pending.lists.data() + b.first_list,
+                .signalSemaphoreInfoCount = 1,
+                .pSignalSemaphoreInfos    = &ctx.signal_scratch[i],
+            });
+        }
+        if (r == VK_SUCCESS)
+            r = submit_run();
+        ctx.submit_scratch.clear();
+        pending.clear();
+        if (r != VK_SUCCESS && status == Status::Ok) {
+            // The batch's timeline values will never be signalled; only a
+            // lost device fails here, and it cannot be recovered.
+            SPDLOG_ERROR("[wren/rhi/vulkan] Queue submission failed: {}", vk::to_string(static_cast<vk::Result>(r)));
+            status = detail::to_status(r);
+        }
+    }
+    return status;
+}
+
+auto VulkanDevice::frame_number() const noexcept -> uint64_t {
+    return impl_->commands.frame_number;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Command lists
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::begin_command_list(CommandListDesc const& desc,
+                                      CommandListHandle&     out) noexcept -> Status
+{
+    out = nullptr;
+
+    auto& impl = *impl_;
+    auto& ctx  = impl.commands;
+    if (!ctx.in_frame)
+        return Status::InvalidArgument;
+
+    RenderTargetLayout const* rt = desc.renderTargets;
+    if (rt && (desc.level != CommandListLevel::Secondary || rt->colorFormatCount > k_max_color_attachments))
+        return Status::InvalidArgument;
+
+    // A device group of one has the single mask 1. Groups hold up to
+    // VK_MAX_DEVICE_GROUP_SIZE (32) devices, where the shift would overflow.
+    uint32_t const device_count = impl.capabilities.limits.deviceCount;
+    uint32_t const all_devices  = device_count >= 32 ? ~0u : (1u << device_count) - 1;
+    if ((desc.deviceMask & ~all_devices) != 0)
+        return Status::InvalidArgument;
+    uint32_t const device_mask = desc.deviceMask != 0 ? desc.deviceMask : all_devices;
+
+    auto const thread = bind_thread(ctx);
+    if (!thread) {
+        SPDLOG_ERROR("[wren/rhi/vulkan] More than {} threads recorded command lists on one device.",
+                     k_max_recording_threads);
+        return Status::OutOfMemory;
+    }
+
+    auto const* d     = impl.device.getDispatcher();
+    auto const  dev   = static_cast<VkDevice>(*impl.device);
+    auto const  qs    = queue_slot(desc.queue);
+    auto const  level = static_cast<std::size_t>(desc.level);
+
+    try {
+        auto& pools = ctx.frames[ctx.frame_slot].threads[*thread];
+        if (!pools)
+            pools = std::make_unique<ThreadCommandPools>();
+
+        CommandPoolSlot& slot = pools->queues[qs];
+        if (!slot.pool) {
+            slot.pool = vk::raii::CommandPool{impl.device,
+                vk::CommandPoolCreateInfo{}
+                    .setFlags(vk::CommandPoolCreateFlagBits::eTransient)
+                    .setQueueFamilyIndex(ctx.families[qs])}.release();
+        }
+
+        auto& lists = slot.lists[level];
+        if (slot.used[level] == lists.size()) {
+            std::array<VkCommandBuffer, k_list_allocation_batch> buffers{};
+            VkCommandBufferAllocateInfo const alloc{
+                .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                .pNext              = nullptr,
+                .commandPool        = static_cast<VkCommandPool>(slot.pool),
+                .level              = static_cast<VkCommandBufferLevel>(detail::to_vk(desc.level)),
+                .commandBufferCount = k_list_allocation_batch,
+            };
+            if (VkResult r = d->vkAllocateCommandBuffers(dev, &alloc, buffers.data()); r != VK_SUCCESS)
+                return detail::to_status(r);
+            for (VkCommandBuffer cb : buffers) {
+                lists.push_back(CommandListState{
+                    .cmd      = cb,
+                    .dispatch = d,
+                    .device   = &impl,
+                    .level    = desc.level,
+                });
+            }
+        }
+
+        // Secondary lists declare the render pass they continue, if any.
+        std::array<VkFormat, k_max_color_attachments> color_formats{};
+        VkCommandBufferInheritanceRenderingInfo rendering{
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+        };
+        VkCommandBufferInheritanceInfo inheritance{
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+        };
+        VkDeviceGroupCommandBufferBeginInfo const group{
+            .sType      = VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO,
+            .pNext      = nullptr,
+            .deviceMask = device_mask,
+        };
+        VkCommandBufferBeginInfo begin{
+            .sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+            .pNext            = desc.level == CommandListLevel::Primary && all_devices != 1 ? &group : nullptr,
+            .flags            = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+            .pInheritanceInfo = nullptr,
+        };
+
+        if (desc.level == CommandListLevel::Secondary) {
+            if (rt) {
+                for (uint32_t i = 0; i < rt->colorFormatCount; ++i)
+                    color_formats[i] = static_cast<VkFormat>(detail::to_vk(rt->colorFormats[i]));
+
+                VkFormat const ds = rt->hasDepthStencil
+                    ? static_cast<VkFormat>(detail::to_vk(rt->depthStencilFormat))
+                    : VK_FORMAT_UNDEFINED;
+
+                rendering.colorAttachmentCount    = rt->colorFormatCount;
+                rendering.pColorAttachmentFormats = color_formats.data();
+                rendering.depthAttachmentFormat   = ds;
+                rendering.stencilAttachmentFormat =
+                    rt->hasDepthStencil && detail::has_stencil(rt->depthStencilFormat) ? ds : VK_FORMAT_UNDEFINED;
+                rendering.rasterizationSamples    =
+                    static_cast<VkSampleCountFlagBits>(detail::to_vk(rt->samples));
+
+                inheritance.pNext = &rendering;
+                begin.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+            }
+            begin.pInheritanceInfo = &inheritance;
+        }
+
+        CommandListState& list = lists[slot.used[level]];
+        if (VkResult r = d->vkBeginCommandBuffer(list.cmd, &begin); r != VK_SUCCESS)
+            return detail::to_status(r);
+
+        ++slot.used[level];
+        list.queue                    = desc.queue;
+        list.recording                = true;
+        list.device_mask              = device_mask;
+        list.profile_depth            = 0;
+        list.profile_statistics_level = UINT32_MAX;
+        cmd_bind_bindless_heap(list);
+        out = &list;
+        return Status::Ok;
+
+    } catch (vk::SystemError const& err) {
+        return detail::to_status(static_cast<vk::Result>(err.code().value()));
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+}
+
+auto VulkanDevice::end_command_list(CommandListHandle list) noexcept -> Status {
+    if (!list || !list->recording)
+        return Status::InvalidArgument;
+    while (list->profile_depth > 0)
+        cmd_end_profile_region(*list);
+    list->recording = false;
+    return detail::to_status(list->dispatch->vkEndCommandBuffer(list->cmd));
+}
+
+// -------------------------------------------------------------------------------------------------
+// Submission & timelines
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::submit(SubmitDesc const& desc, SyncPoint& out) noexcept -> Status {
+    out = {};
+
+    auto& ctx = impl_->commands;
+    if (!ctx.in_frame || desc.listCount == 0 || !desc.lists || (desc.waitCount > 0 && !desc.waits))
+        return Status::InvalidArgument;
+
+    std::span const lists{desc.lists, desc.listCount};
+    std::span const waits{desc.waits, desc.waitCount};
+
+    QueueType const queue  = lists.front() ? lists.front()->queue : QueueType::Graphics;
+    uint32_t  const target = ctx.submit_target[queue_slot(queue)];
+    for (CommandListHandle list : lists) {
+        if (!list || list->device != impl_.get() || list->recording ||
+            list->level != CommandListLevel::Primary ||
+            ctx.submit_target[queue_slot(list->queue)] != target)
+            return Status::InvalidArgument;
+    }
+
+    std::scoped_lock lock{ctx.pending_mutex};
+
+    // A wait on a value nobody has been handed yet could never complete.
+    for (SyncPoint const& w : waits) {
+        if (w.value > ctx.last_value[ctx.submit_target[queue_slot(w.queue)]])
+            return Status::InvalidArgument;
+    }
+
+    auto& pending = ctx.pending[target];
+    try {
+        pending.lists.reserve(pending.lists.size() + lists.size());
+        pending.waits.reserve(pending.waits.size() + waits.size() + 1);
+        pending.batches.reserve(pending.batches.size() + 1);
+        ctx.submit_scratch.reserve(pending.batches.size() + 1);
+        ctx.signal_scratch.reserve(pending.batches.size() + 1);
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+
+    auto const first_wait = static_cast<uint32_t>(pending.waits.size());
+    uint32_t const ordered = wait_for_sparse(ctx, target);
+    PendingBatch batch{
+        .first_list = static_cast<uint32_t>(pending.lists.size()),
+        .list_count = static_cast<uint32_t>(lists.size()),
+        .first_wait = first_wait,
+        .wait_count = ordered,
+        .signal     = ++ctx.last_value[target],
+    };
+    for (CommandListHandle list : lists) {
+        pending.lists.push_back(VkCommandBufferSubmitInfo{
+            .sType         = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+            .pNext         = nullptr,
+            .commandBuffer = list->cmd,
+            .deviceMask    = list->device_mask,
+        });
+    }
+    for (SyncPoint const& w : waits) {
+        if (w.value == 0) continue;
+        pending.waits.push_back(VkSemaphoreSubmitInfo{
+            .sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .pNext       = nullptr,
+            .semaphore   = static_cast<VkSemaphore>(ctx.timelines[ctx.submit_target[queue_slot(w.queue)]]),
+            .value       = w.value,
+            .stageMask   = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+            .deviceIndex = 0,
+        });
+        ++batch.wait_count;
+    }
+    pending.batches.push_back(batch);
+
+    out = {queue, batch.signal};
+    return Status::Ok;
+}
+
+auto VulkanDevice::wait(std::span<SyncPoint const> points, uint64_t timeout_ns) const noexcept -> Status {
+    auto const& ctx = impl_->commands;
+
+    // Only the latest point per timeline matters.
+    std::array<uint64_t, k_queue_slot_count> values{};
+    for (SyncPoint const& p : points) {
+        auto& v = values[ctx.submit_target[queue_slot(p.queue)]];
+        v = std::max(v, p.value);
+    }
+    return wait_timelines(*impl_, values, timeout_ns);
+}
+
+auto VulkanDevice::completed_value(QueueType queue) const noexcept -> uint64_t {
+    auto const& ctx = impl_->commands;
+    uint64_t value = 0;
+    impl_->device.getDispatcher()->vkGetSemaphoreCounterValue(
+        static_cast<VkDevice>(*impl_->device),
+        static_cast<VkSemaphore>(ctx.timelines[ctx.submit_target[queue_slot(queue)]]), &value);
+    return value;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Recording
+// -------------------------------------------------------------------------------------------------
+void cmd_barriers(CommandListState& list, std::span<TextureBarrier const> textures,
+                  std::span<BufferBarrier const> buffers) noexcept
+{
+    assert(list.recording);
+    auto& impl = *list.device;
+
+    std::array<vk::ImageMemoryBarrier2, k_barrier_batch>  images{};
+    std::array<vk::BufferMemoryBarrier2, k_barrier_batch> bufs{};
+    std::size_t ti = 0;
+    std::size_t bi = 0;
+
+    while (ti < textures.size() || bi < buffers.size()) {
+        uint32_t image_count  = 0;
+        uint32_t buffer_count = 0;
+
+        if (ti < textures.size()) {
+            std::shared_lock lock{impl.textures_mutex};
+            for (; ti < textures.size() && image_count < k_barrier_batch; ++ti) {
+                TextureBarrier const& b = textures[ti];
+                auto const* image = impl.textures.get<0>(b.texture);
+                assert(image && "barrier on a null or stale texture");
+                if (!image) continue;
+
+                auto       src = texture_scope(b.oldUsage, b.srcStages);
+                auto       dst = texture_scope(b.newUsage, b.dstStages);
+                auto const own = ownership(impl.commands, list.queue, b.srcQueue, b.dstQueue);
+                if (own.skip) continue;
+                apply_ownership(own, src, dst);
+                if (b.discard)
+                    src.layout = vk::ImageLayout::eUndefined;
+                images[image_count++] = vk::ImageMemoryBarrier2{}
+                    .setSrcStageMask(src.stages)
+                    .setSrcAccessMask(src.access)
+                    .setDstStageMask(dst.stages)
+                    .setDstAccessMask(dst.access)
+                    .setOldLayout(src.layout)
+                    .setNewLayout(dst.layout)
+                    .setSrcQueueFamilyIndex(own.src_family)
+                    .setDstQueueFamilyIndex(own.dst_family)
+                    .setImage(*image)
+                    .setSubresourceRange({detail::aspect_mask(impl.textures.get<3>(b.texture)->format),
+                                          0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS});
+            }
+        }
+
+        if (bi < buffers.size()) {
+            std::shared_lock lock{impl.buffers_mutex};
+            for (; bi < buffers.size() && buffer_count < k_barrier_batch; ++bi) {
+                BufferBarrier const& b = buffers[bi];
+                auto const* buffer = impl.buffers.get<0>(b.buffer);
+                assert(buffer && "barrier on a null or stale buffer");
+                if (!buffer) continue;
+
+                auto       src = buffer_scope(b.oldUsage, b.srcStages);
+                auto       dst = buffer_scope(b.newUsage, b.dstStages);
+                auto const own = ownership(impl.commands, list.queue, b.srcQueue, b.dstQueue);
+                if (own.skip) continue;
+                apply_ownership(own, src, dst);
+                bufs[buffer_count++] = vk::BufferMemoryBarrier2{}
+                    .setSrcStageMask(src.stages)
+                    .setSrcAccessMask(src.access)
+                    .setDstStageMask(dst.stages)
+                    .setDstAccessMask(dst.access)
+                    .setSrcQueueFamilyIndex(own.src_family)
+                    .setDstQueueFamilyIndex(own.dst_family)
+                    .setBuffer(*buffer)
+                    .setOffset(0)
+                    .setSize(VK_WHOLE_SIZE);
+            }
+        }
+
+        if (image_count == 0 && buffer_count == 0) continue;
+
+        VkDependencyInfo const dependency{
+            .sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+            .pNext                    = nullptr,
+            .dependencyFlags          = 0,
+            .memoryBarrierCount       = 0,
+            .pMemoryBarriers          = nullptr,
+            .bufferMemoryBarrierCount = buffer_count,
+            .pBufferMemoryBarriers    = reinterpret_cast<VkBufferMemoryBarrier2 const*>(bufs.data()),
+            .imageMemoryBarrierCount  = image_count,
+            .pImageMemoryBarriers     = reinterpret_cast<VkImageMemoryBarrier2 const*>(images.data()),
+        };
+        list.dispatch->vkCmdPipelineBarrier2(list.cmd, &dependency);
+    }
+}
+
+namespace {
+
+/// Makes copies into Readback memory visible to the host once the list's
+/// submission has signalled; a timeline wait alone does not.
+void host_read_barrier(CommandListState const& list) noexcept {
+    VkMemoryBarrier2 const barrier{
+        .sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2,
+        .pNext         = nullptr,
+        .srcStageMask  = VK_PIPELINE_STAGE_2_COPY_BIT,
+        .srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+        .dstStageMask  = VK_PIPELINE_STAGE_2_HOST_BIT,
+        .dstAccessMask = VK_ACCESS_2_HOST_READ_BIT,
+    };
+    VkDependencyInfo const info{
+        .sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+        .pNext                    = nullptr,
+        .dependencyFlags          = 0,
+        .memoryBarrierCount       = 1,
+        .pMemoryBarriers          = &barrier,
+        .bufferMemoryBarrierCount = 0,
+        .pBufferMemoryBarriers    = nullptr,
+        .imageMemoryBarrierCount  = 0,
+        .pImageMemoryBarriers     = nullptr,
+    };
+    list.dispatch->vkCmdPipelineBarrier2(list.cmd, &info);
+}
+
+/// Shared by both copy directions: resolves the handles once and forwards
+/// the regions in stack batches.
+void copy_buffer_texture(CommandListState& list, BufferHandle buffer_handle, TextureHandle texture_handle,
+                         std::span<BufferTextureCopy const> regions, bool to_buffer) noexcept
+{
+    assert(list.recording);
+    auto& impl = *list.device;
+
+    VkBuffer           buffer   = VK_NULL_HANDLE;
+    VkImage            image    = VK_NULL_HANDLE;
+    VkImageAspectFlags aspect   = VK_IMAGE_ASPECT_COLOR_BIT;
+    bool               readback = false;
+    {
+        std::shared_lock lock{impl.buffers_mutex};
+        if (auto const* b = impl.buffers.get<0>(buffer_handle)) {
+            buffer   = static_cast<VkBuffer>(*b);
+            readback = impl.buffers.get<4>(buffer_handle)->memory == MemoryUsage::Readback;
+        }
+    }
+    {
+        std::shared_lock lock{impl.textures_mutex};
+        if (auto const* i = impl.textures.get<0>(texture_handle)) {
+            image = static_cast<VkImage>(*i);
+            // Copies address one aspect; depth formats move depth data.
+            if (detail::is_depth_format(impl.textures.get<3>(texture_handle)->format))
+                aspect = VK_IMAGE_ASPECT_DEPTH_BIT;
+        }
+    }
+    assert(buffer && image && "copy between null or stale resources");
+    if (!buffer || !image) return;
+
+    std::array<VkBufferImageCopy, k_copy_region_batch> batch{};
+    for (std::size_t first = 0; first < regions.size(); first += k_copy_region_batch) {
+        auto const count = static_cast<uint32_t>(std::min<std::size_t>(k_copy_region_batch,
+                                                                       regions.size() - first));
+        for (uint32_t i = 0; i < count; ++i) {
+            BufferTextureCopy const& r = regions[first + i];
+            batch[i] = VkBufferImageCopy{
+                .bufferOffset      = r.bufferOffset,
+                .bufferRowLength   = r.bufferRowLength,
+                .bufferImageHeight = r.bufferImageHeight,
+                .imageSubresource  = {aspect, r.mipLevel, r.baseArrayLayer, r.layerCount},
+                .imageOffset       = {r.x, r.y, r.z},
+                .imageExtent       = {r.width, r.height, r.depth},
+            };
+        }
+        if (to_buffer)
+            list.dispatch->vkCmdCopyImageToBuffer(list.cmd, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                                  buffer, count, batch.data());
+        else
+            list.dispatch->vkCmdCopyBufferToImage(list.cmd, buffer, image,
+                                                  VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, count, batch.data());
+    }
+    if (to_buffer && readback)
+        host_read_barrier(list);
+}
+
+} // anonymous namespace
+
+void cmd_copy_buffer(CommandListState& list, BufferHandle src, BufferHandle dst,
+                     std::span<BufferCopy const> regions) noexcept
+{
+    assert(list.recording);
+    auto& impl = *list.device;
+
+    VkBuffer src_buffer = VK_NULL_HANDLE;
+    VkBuffer dst_buffer = VK_NULL_HANDLE;
+    bool     readback   = false;
+    {
+        std::shared_lock lock{impl.buffers_mutex};
+        if (auto const* b = impl.buffers.get<0>(src)) src_buffer = static_cast<VkBuffer>(*b);
+        if (auto const* b = impl.buffers.get<0>(dst)) {
+            dst_buffer = static_cast<VkBuffer>(*b);
+            readback   = impl.buffers.get<4>(dst)->memory == MemoryUsage::Readback;
+        }
+    }
+    assert(src_buffer && dst_buffer && "copy between null or stale buffers");
+    if (!src_buffer || !dst_buffer || regions.empty()) return;
+
+    list.dispatch->vkCmdCopyBuffer(list.cmd, src_buffer, dst_buffer,
+                                   static_cast<uint32_t>(regions.size()),
+                                   reinterpret_cast<VkBufferCopy const*>(regions.data()));
+    if (readback)
+        host_read_barrier(list);
+}
+
+void cmd_copy_buffer_to_texture(CommandListState& list, BufferHandle src, TextureHandle dst,
+                                std::span<BufferTextureCopy const> regions) noexcept
+{
+    copy_buffer_texture(list, src, dst, regions, false);
+}
+
+void cmd_copy_texture_to_buffer(CommandListState& list, TextureHandle src, BufferHandle dst,
+                                std::span<BufferTextureCopy const> regions) noexcept
+{
+    copy_buffer_texture(list, dst, src, regions, true);
+}
+
+void cmd_begin_rendering(CommandListState& list, RenderingDesc const& desc) noexcept {
+    assert(list.recording);
+    assert(desc.colorAttachmentCount <= k_max_color_attachments);
+    auto& impl = *list.device;
+    assert(has_any(impl.capabilities.features, Feature::DynamicRendering) &&
+           "render passes require Feature::DynamicRendering");
+
+    uint32_t const color_count = std::min(desc.colorAttachmentCount, k_max_color_attachments);
+    std::array<VkRenderingAttachmentInfo, k_max_color_attachments> colors{};
+    VkRenderingAttachmentInfo depth{};
+    VkRenderingAttachmentInfo stencil{};
+    bool has_depth   = false;
+    bool has_stencil = false;
+
+    {
+        std::shared_lock lock{impl.textures_mutex};
+        for (uint32_t i = 0; i < color_count; ++i) {
+            ColorAttachment const& a = desc.colorAttachments[i];
+            auto const* view = impl.textures.get<1>(a.texture);
+            assert(view && "color attachment is a null or stale texture");
+
+            colors[i] = VkRenderingAttachmentInfo{
+                .sType       = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+                .imageView   = view ? static_cast<VkImageView>(*view) : VK_NULL_HANDLE,
+                .imageLayout = VK_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL,
+                .resolveMode = VK_RESOLVE_MODE_NONE,
+                .loadOp      = static_cast<VkAttachmentLoadOp>(detail::to_vk(a.load)),
+                .storeOp     = static_cast<VkAttachmentStoreOp>(detail::to_vk(a.store)),
+            };
+            std::copy_n(a.clearColor, 4, colors[i].clearValue.color.float32);
+        }
+
+        if (DepthStencilAttachment const* ds = desc.depthStencil) {
+            auto const* view = impl.textures.get<1>(ds->texture);
+            assert(view && "depth attachment is a null or stale texture");
+            if (view) {
+                depth = VkRenderingAttachmentInfo{
+                    .sType       = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+                    .imageView   = static_cast<VkImageView>(*view),
+                    .imageLayout = VK_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL,
+                    .resolveMode = VK_RESOLVE_MODE_NONE,
+                    .loadOp      = static_cast<VkAttachmentLoadOp>(detail::to_vk(ds->depthLoad)),
+                    .storeOp     = static_cast<VkAttachmentStoreOp>(detail::to_vk(ds->depthStore)),
+                };
+                depth.clearValue.depthStencil = {ds->clearDepth, ds->clearStencil};
+                has_depth = true;
+
+                if (detail::has_stencil(impl.textures.get<3>(ds->texture)->format)) {
+                    stencil         = depth;
+                    stencil.loadOp  = static_cast<VkAttachmentLoadOp>(detail::to_vk(ds->stencilLoad));
+                    stencil.storeOp = static_cast<VkAttachmentStoreOp>(detail::to_vk(ds->stencilStore));
+                    has_stencil     = true;
+                }
+            }
+        }
+    }
+
+    VkRenderingInfo const info{
+        .sType                = VK_STRUCTURE_TYPE_RENDERING_INFO,
+        .pNext                = nullptr,
+        .flags                = desc.secondaryCommandLists
+                                    ? VkRenderingFlags{VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT}
+                                    : VkRenderingFlags{0},
+        .renderArea           = {{desc.x, desc.y}, {desc.width, desc.height}},
+        .layerCount           = 1,
+        .viewMask             = 0,
+        .colorAttachmentCount = color_count,
+        .pColorAttachments    = colors.data(),
+        .pDepthAttachment     = has_depth ? &depth : nullptr,
+        .pStencilAttachment   = has_stencil ? &stencil : nullptr,
+    };
+    list.dispatch->vkCmdBeginRendering(list.cmd, &info);
+}
+
+void cmd_end_rendering(CommandListState& list) noexcept {
+    assert(list.recording);
+    list.dispatch->vkCmdEndRendering(list.cmd);
+}
+
+void cmd_set_viewport(CommandListState& list, Viewport const& viewport) noexcept {
+    assert(list.recording);
+    VkViewport const vp{viewport.x, viewport.y, viewport.width, viewport.height,
+                        viewport.minDepth, viewport.maxDepth};
+    list.dispatch->vkCmdSetViewport(list.cmd, 0, 1, &vp);
+}
+
+void cmd_set_scissor(CommandListState& list, Scissor const& scissor) noexcept {
+    assert(list.recording);
+    VkRect2D const rect{{scissor.x, scissor.y}, {scissor.width, scissor.height}};
+    list.dispatch->vkCmdSetScissor(list.cmd, 0, 1, &rect);
+}
+
+void cmd_bind_vertex_buffers(CommandListState& list, uint32_t first_binding,
+                             std::span<BufferHandle const> buffers,
+                             std::span<uint64_t const> offsets) noexcept
+{
+    assert(list.recording);
+    assert(buffers.size() <= k_vertex_buffer_max && offsets.size() >= buffers.size());
+    auto& impl = *list.device;
+
+    auto const count = static_cast<uint32_t>(std::min<std::size_t>(buffers.size(), k_vertex_buffer_max));
+    std::array<VkBuffer, k_vertex_buffer_max> resolved{};
+    {
+        std::shared_lock lock{impl.buffers_mutex};
+        for (uint32_t i = 0; i < count; ++i) {
+            auto const* b = impl.buffers.get<0>(buffers[i]);
+            assert(b && "vertex buffer is null or stale");
+            resolved[i] = b ? static_cast<VkBuffer>(*b) : VK_NULL_HANDLE;
+        }
+    }
+    if (count == 0) return;
+    list.dispatch->vkCmdBindVertexBuffers(list.cmd, first_binding, count, resolved.data(), offsets.data());
+}
+
+void cmd_bind_index_buffer(CommandListState& list, BufferHandle buffer, uint64_t offset,
+                           IndexType type) noexcept
+{
+    assert(list.recording);
+    auto& impl = *list.device;
+
+    VkBuffer resolved = VK_NULL_HANDLE;
+    {
+        std::shared_lock lock{impl.buffers_mutex};
+        if (auto const* b = impl.buffers.get<0>(buffer)) resolved = static_cast<VkBuffer>(*b);
+    }
+    assert(resolved && "index buffer is null or stale");
+    if (!resolved) return;
+    list.dispatch->vkCmdBindIndexBuffer(list.cmd, resolved, offset,
+                                        static_cast<VkIndexType>(detail::to_vk(type)));
+}
+
+void cmd_execute_command_lists(CommandListState& list,
+                               std::span<CommandListHandle const> secondaries) noexcept
+{
+    assert(list.recording && list.level == CommandListLevel::Primary);
+
+    std::array<VkCommandBuffer, k_execute_batch> batch{};
+    for (std::size_t first = 0; first < secondaries.size(); first += k_execute_batch) {
+        auto const count = static_cast<uint32_t>(std::min<std::size_t>(k_execute_batch,
+                                                                       secondaries.size() - first));
+        for (uint32_t i = 0; i < count; ++i) {
+            CommandListHandle const s = secondaries[first + i];
+            assert(s && s->level == CommandListLevel::Secondary && !s->recording);
+            batch[i] = s->cmd;
+        }
+        list.dispatch->vkCmdExecuteCommands(list.cmd, count, batch.data());
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Indirect draws
+//
+// Without a count buffer the draw count is maxDrawCount; counts above one
+// need multiDrawIndirect. With one, vkCmdDraw*IndirectCount (drawIndirectCount,
+// Vulkan 1.2) reads the count on the GPU.
+// -------------------------------------------------------------------------------------------------
+void cmd_draw_indirect(CommandListState& list, IndirectDrawDesc const& desc, bool indexed) noexcept {
+    assert(list.recording);
+    auto& impl = *list.device;
+    assert((desc.argsOffset % 4) == 0 && (desc.countOffset % 4) == 0 && (desc.stride % 4) == 0);
+    assert((desc.maxDrawCount <= 1 && !desc.countBuffer) ||
+           has_any(impl.capabilities.features, Feature::MultiDrawIndirect));
+    assert(desc.maxDrawCount <= impl.capabilities.limits.maxDrawIndirectCount);
+
+    VkBuffer args  = VK_NULL_HANDLE;
+    VkBuffer count = VK_NULL_HANDLE;
+    {
+        std::shared_lock lock{impl.buffers_mutex};
+        if (auto const* b = impl.buffers.get<0>(desc.argsBuffer)) args = static_cast<VkBuffer>(*b);
+        if (desc.countBuffer) {
+            if (auto const* b = impl.buffers.get<0>(desc.countBuffer)) count = static_cast<VkBuffer>(*b);
+        }
+    }
+    assert(args && "indirect argument buffer is null or stale");
+    assert((count || !desc.countBuffer) && "indirect count buffer is stale");
+    if (!args || (desc.countBuffer && !count) || desc.maxDrawCount == 0) return;
+
+    uint32_t const stride = desc.stride != 0 ? desc.stride
+                          : indexed          ? uint32_t{sizeof(VkDrawIndexedIndirectCommand)}
+                                             : uint32_t{sizeof(VkDrawIndirectCommand)};
+    auto const* d = list.dispatch;
+    if (count) {
+        if (indexed)
+            d->vkCmdDrawIndexedIndirectCount(list.cmd, args, desc.argsOffset, count, desc.countOffset,
+                                             desc.maxDrawCount, stride);
+        else
+            d->vkCmdDrawIndirectCount(list.cmd, args, desc.argsOffset, count, desc.countOffset,
+                                      desc.maxDrawCount, stride);
+    } else if (indexed) {
+        d->vkCmdDrawIndexedIndirect(list.cmd, args, desc.argsOffset, desc.maxDrawCount, stride);
+    } else {
+        d->vkCmdDrawIndirect(list.cmd, args, desc.argsOffset, desc.maxDrawCount, stride);
+    }
+}
+
+void cmd_dispatch_indirect(CommandListState& list, BufferHandle buffer, uint64_t offset) noexcept {
+    assert(list.recording);
+    assert((offset % 4) == 0);
+    auto& impl = *list.device;
+
+    VkBuffer resolved = VK_NULL_HANDLE;
+    {
+        std::shared_lock lock{impl.buffers_mutex};
+        if (auto const* b = impl.buffers.get<0>(buffer)) resolved = static_cast<VkBuffer>(*b);
+    }
+    assert(resolved && "indirect dispatch buffer is null or stale");
+    if (!resolved) return;
+    list.dispatch->vkCmdDispatchIndirect(list.cmd, resolved, offset);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Command packets
+//
+// Buffer handles are resolved under one shared lock held across runs of
+// bind packets; it is dropped before BindPipeline, which may compile on
+// this thread. Vertex buffer packets with consecutive bindings are merged
+// into one vkCmdBindVertexBuffers call.
+// -------------------------------------------------------------------------------------------------
+void cmd_record_packets(CommandListState& list, std::span<CommandPacket const> packets) noexcept {
+    assert(list.recording);
+    auto& impl = *list.device;
+    auto const* d = list.dispatch;
+
+    std::shared_lock buffers_lock{impl.buffers_mutex, std::defer_lock};
+    auto resolve = [&](BufferHandle handle) noexcept -> VkBuffer {
+        if (!buffers_lock.owns_lock())
+            buffers_lock.lock();
+        auto const* b = impl.buffers.get<0>(handle);
+        assert(b && "bound buffer is null or stale");
+        return b ? static_cast<VkBuffer>(*b) : VK_NULL_HANDLE;
+    };
+
+    std::array<VkBuffer, k_vertex_buffer_max>     vertex_buffers{};
+    std::array<VkDeviceSize, k_vertex_buffer_max> vertex_offsets{};
+    uint32_t first_binding = 0;
+    uint32_t vertex_count  = 0;
+    auto flush_vertex_buffers = [&]() noexcept {
+        if (vertex_count == 0) return;
+        d->vkCmdBindVertexBuffers(list.cmd, first_binding, vertex_count,
+                                  vertex_buffers.data(), vertex_offsets.data());
+        vertex_count = 0;
+    };
+
+    for (CommandPacket const& p : packets) {
+        if (p.op != CommandOp::BindVertexBuffer)
+            flush_vertex_buffers();
+
+        switch (p.op) {
+            case CommandOp::Draw:
+                d->vkCmdDraw(list.cmd, p.draw.vertexCount, p.draw.instanceCount,
+                             p.draw.firstVertex, p.draw.firstInstance);
+                break;
+            case CommandOp::DrawIndexed:
+                d->vkCmdDrawIndexed(list.cmd, p.drawIndexed.indexCount, p.drawIndexed.instanceCount,
+                                    p.drawIndexed.firstIndex, p.drawIndexed.vertexOffset,
+                                    p.drawIndexed.firstInstance);
+                break;
+            case CommandOp::Dispatch:
+                d->vkCmdDispatch(list.cmd, p.dispatch.x, p.dispatch.y, p.dispatch.z);
+                break;
+            case CommandOp::BindPipeline:
+                if (buffers_lock.owns_lock())
+                    buffers_lock.unlock();
+                cmd_bind_pipeline(list, p.pipeline);
+                break;
+            case CommandOp::PushConstants:
+                assert(p.pushSize <= k_packet_push_constant_bytes);
+                cmd_push_constants(list, p.pushOffset, p.pushSize, p.push.data);
+                break;
+            case CommandOp::SetViewport:
+                cmd_set_viewport(list, p.viewport);
+                break;
+            case CommandOp::SetScissor:
+                cmd_set_scissor(list, p.scissor);
+                break;
+            case CommandOp::BindVertexBuffer:
+                if (vertex_count == k_vertex_buffer_max || p.binding != first_binding + vertex_count)
+                    flush_vertex_buffers();
+                if (vertex_count == 0)
+                    first_binding = p.binding;
+                vertex_buffers[vertex_count] = resolve(p.buffer.buffer);
+                vertex_offsets[vertex_count] = p.buffer.offset;
+                ++vertex_count;
+                break;
+            case CommandOp::BindIndexBuffer:
+                if (VkBuffer const buffer = resolve(p.buffer.buffer)) {
+                    d->vkCmdBindIndexBuffer(list.cmd, buffer, p.buffer.offset,
+                                            static_cast<VkIndexType>(detail::to_vk(p.indexType)));
+                }
+                break;
+            case CommandOp::SetDeviceMask:
+                assert(p.deviceMask != 0 && (p.deviceMask & ~list.device_mask) == 0);
+                d->vkCmdSetDeviceMask(list.cmd, p.deviceMask);
+                break;
+            default:
+                assert(false && "unknown CommandOp");
+                break;
+        }
+    }
+    flush_vertex_buffers();
+}
+
+} // namespace wren::rhi::vulkan
@@ -3,35 +3,22 @@
 #include <algorithm>
 #include <cstring>
 #include <format>
+#include <memory>
+#include <optional>
+#include <span>
 #include <vector>
 
 #include <spdlog/spdlog.h>
 #include <vulkan/vulkan_raii.hpp>
 
+#include "vk_adapter_cache.hpp"
 #include "vk_capabilities.hpp"
+#include "vk_device_impl.hpp"
 
 // The bitwise operators for wren::rhi flag enums are available via features.hpp.
 
 namespace wren::rhi::vulkan {
 
-// -------------------------------------------------------------------------------------------------
-// Impl
-// -------------------------------------------------------------------------------------------------
-struct VulkanDevice::Impl {
-    vk::raii::PhysicalDevice phys_device;
-    vk::raii::Device         device;
-    QueueFamilyIndices       queue_indices;
-    Capabilities             capabilities;
-
-    Impl(vk::raii::PhysicalDevice phys, vk::raii::Device dev,
-         QueueFamilyIndices qi, Capabilities caps)
-        : phys_device{std::move(phys)}
-        , device{std::move(dev)}
-        , queue_indices{qi}
-        , capabilities{std::move(caps)}
-    {}
-};
-
 // -------------------------------------------------------------------------------------------------
 // Internal helpers
 // -------------------------------------------------------------------------------------------------
@@ -41,9 +28,8 @@ namespace {
 // Queue family selection
 // -----------------------------------------------------------------
 [[nodiscard]] QueueFamilyIndices select_queue_families(
-    vk::raii::PhysicalDevice const& phys) noexcept
+    std::span<vk::QueueFamilyProperties const> families) noexcept
 {
-    auto const families = phys.getQueueFamilyProperties();
     QueueFamilyIndices result;
 
     // 1. Graphics queue (required).
@@ -98,9 +84,17 @@ namespace {
             out.push_back(name);
     };
 
-    // Swapchain: requested whenever Presentation is in the feature mask.
-    if (has_any(requested, Feature::Presentation))
+    // Swapchain: requested whenever Presentation is in the feature mask,
+    // with present id + present wait (informational, swapchain.cpp) when
+    // both are there.
+    if (has_any(requested, Feature::Presentation)) {
         try_add(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+        if (has_extension(avail_span, VK_KHR_PRESENT_ID_EXTENSION_NAME) &&
+            has_extension(avail_span, VK_KHR_PRESENT_WAIT_EXTENSION_NAME)) {
+            out.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+            out.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+        }
+    }
 
     // Mesh shaders.
     if (has_any(requested, Feature::MeshShader))
@@ -133,6 +127,20 @@ namespace {
     if (has_any(requested, Feature::DebugMarkers_Labels))
         try_add("VK_EXT_debug_utils");
 
+    // Memory budget: informational, enabled whenever present (memory.cpp).
+    try_add(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+
+    // Calibrated timestamps: informational, enabled whenever present (profiler.cpp).
+    try_add(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+
+    // Graphics pipeline libraries: informational, enabled whenever present
+    // (pipelines.cpp). The EXT builds on the KHR, so both or neither.
+    if (has_extension(avail_span, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+        has_extension(avail_span, VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME)) {
+        out.push_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+        out.push_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    }
+
     return out;
 }
 
@@ -141,11 +149,9 @@ namespace {
 // Used when preferredAdapterIndex is 0 (no explicit preference).
 // -----------------------------------------------------------------
 [[nodiscard]] int32_t score_physical_device(
-    vk::raii::PhysicalDevice const& phys,
-    Feature                         required_features)
+    AdapterInfo const& info,
+    Feature            required_features) noexcept
 {
-    auto const info = detail::make_adapter_info(0, phys);
-
     // Can it satisfy our hard requirements?
     if (!has_all(info.capabilities.features, required_features))
         return -1;
@@ -165,66 +171,17 @@ namespace {
 }
 
 // -----------------------------------------------------------------
-// Feature structures needed for device-level feature negotiation.
+// Feature chain for VkDeviceCreateInfo.
 // We enable only what the resolved feature mask requests.
 // -----------------------------------------------------------------
 
-// Flat aggregate holding the feature structs we pass to VkDeviceCreateInfo.
-// The pNext chain is fully wired in build_feature_chain() before the call.
-struct DeviceFeatureChain {
-    vk::PhysicalDeviceFeatures2          features2{};
-    vk::PhysicalDeviceVulkan11Features   vk11{};
-    vk::PhysicalDeviceVulkan12Features   vk12{};
-    vk::PhysicalDeviceVulkan13Features   vk13{};
-
-    // Extension features — enabled only when the matching extension is active.
-    vk::PhysicalDeviceMeshShaderFeaturesEXT              mesh_shader{};
-    vk::PhysicalDeviceRayTracingPipelineFeaturesKHR      ray_tracing{};
-    vk::PhysicalDeviceAccelerationStructureFeaturesKHR   accel_struct{};
-    vk::PhysicalDeviceDescriptorBufferFeaturesEXT        descriptor_buffer{};
-    vk::PhysicalDeviceFragmentShadingRateFeaturesKHR     fsr{};
-    vk::PhysicalDeviceFragmentShaderInterlockFeaturesEXT interlock{};
-};
-
-// Build the pNext feature query chain, query physical device, then mask
-// down to only what's in `resolved`.  Returns a chain ready for VkDeviceCreateInfo.
-[[nodiscard]] DeviceFeatureChain build_feature_chain(
-    vk::raii::PhysicalDevice const&  phys,
-    Feature                          resolved,
-    std::vector<const char*> const&  extensions)
+// Copy the adapter's supported features and mask them down to only what's
+// in `resolved`. Returned unlinked: link_feature_chain() the final object.
+[[nodiscard]] detail::DeviceFeatureChain build_feature_chain(
+    detail::AdapterQuery const& query,
+    Feature                     resolved) noexcept
 {
-    auto ext_active = [&](const char* name) noexcept {
-        return std::ranges::any_of(extensions, [name](const char* e) {
-            return std::strcmp(e, name) == 0;
-        });
-    };
-
-    DeviceFeatureChain c;
-
-    // Wire the base 1.1/1.2/1.3 chain (always present on Vulkan 1.3).
-    c.features2.pNext = &c.vk11;
-    c.vk11.pNext      = &c.vk12;
-    c.vk12.pNext      = &c.vk13;
-    void** tail = reinterpret_cast<void**>(&c.vk13.pNext);
-
-    // Append extension structs.
-    auto append = [&](auto* s) {
-        *tail = s;
-        tail  = reinterpret_cast<void**>(&s->pNext);
-    };
-
-    if (ext_active("VK_EXT_mesh_shader"))              append(&c.mesh_shader);
-    if (ext_active("VK_KHR_ray_tracing_pipeline")) {   append(&c.ray_tracing);
-                                                        append(&c.accel_struct); }
-    if (ext_active("VK_EXT_descriptor_buffer"))        append(&c.descriptor_buffer);
-    if (ext_active("VK_KHR_fragment_shading_rate"))    append(&c.fsr);
-    if (ext_active("VK_EXT_fragment_shader_interlock")) append(&c.interlock);
-    *tail = nullptr;
-
-    // Query all supported values at once.
-    phys.getDispatcher()->vkGetPhysicalDeviceFeatures2(
-        static_cast<VkPhysicalDevice>(*phys),
-        reinterpret_cast<VkPhysicalDeviceFeatures2*>(&c.features2));
+    detail::DeviceFeatureChain c = query.features;
 
     // Mask out features not in `resolved` so we don't enable what wasn't requested.
     auto& f   = c.features2.features;
@@ -240,16 +197,32 @@ struct DeviceFeatureChain {
     if (!has_any(resolved, Feature::DualSourceBlending))  f.dualSrcBlend       = VK_FALSE;
     if (!has_any(resolved, Feature::NonSolidFill))        f.fillModeNonSolid   = VK_FALSE;
     if (!has_any(resolved, Feature::DepthBoundsTest))     f.depthBounds        = VK_FALSE;
-    if (!has_any(resolved, Feature::SparseResources))     f.sparseBinding      = VK_FALSE;
     if (!has_any(resolved, Feature::ShaderInt64))         f.shaderInt64        = VK_FALSE;
 
+    if (!has_any(resolved, Feature::SparseResources)) {
+        f.sparseBinding            = VK_FALSE;
+        f.sparseResidencyBuffer    = VK_FALSE;
+        f.sparseResidencyImage2D   = VK_FALSE;
+        f.sparseResidencyImage3D   = VK_FALSE;
+        f.sparseResidency2Samples  = VK_FALSE;
+        f.sparseResidency4Samples  = VK_FALSE;
+        f.sparseResidency8Samples  = VK_FALSE;
+        f.sparseResidency16Samples = VK_FALSE;
+        f.sparseResidencyAliased   = VK_FALSE;
+    }
     if (!has_any(resolved, Feature::TimelineSemaphore))
         f12.timelineSemaphore = VK_FALSE;
     if (!has_any(resolved, Feature::BufferDeviceAddress))
         f12.bufferDeviceAddress = VK_FALSE;
+    if (!has_any(resolved, Feature::MultiDrawIndirect))
+        f12.drawIndirectCount = VK_FALSE;
     if (!has_any(resolved, Feature::DescriptorIndexing_Bindless)) {
-        f12.descriptorBindingPartiallyBound = VK_FALSE;
-        f12.runtimeDescriptorArray          = VK_FALSE;
+        f12.descriptorBindingPartiallyBound               = VK_FALSE;
+        f12.runtimeDescriptorArray                        = VK_FALSE;
+        f12.descriptorBindingSampledImageUpdateAfterBind  = VK_FALSE;
+        f12.descriptorBindingStorageImageUpdateAfterBind  = VK_FALSE;
+        f12.descriptorBindingStorageBufferUpdateAfterBind = VK_FALSE;
+        f12.descriptorBindingUpdateUnusedWhilePending     = VK_FALSE;
     }
     if (!has_any(resolved, Feature::ShaderFloat16_Int8)) {
         f12.shaderFloat16 = VK_FALSE;
@@ -261,6 +234,9 @@ struct DeviceFeatureChain {
     if (!has_any(resolved, Feature::DynamicRendering))
         f13.dynamicRendering = VK_FALSE;
 
+    if (!has_any(resolved, Feature::AccelerationStructureHostBuild))
+        c.accel_struct.accelerationStructureHostCommands = VK_FALSE;
+
     return c;
 }
 
@@ -305,8 +281,19 @@ auto VulkanDevice::create(vk::raii::Instance const& instance, DeviceDesc const&
                 Status::InternalError, "No Vulkan-capable physical devices found."}};
         }
 
-        Feature const required  = desc.featureRequest.required;
-        Feature const preferred = desc.featureRequest.preferred;
+        // The submission scheduler (commands.cpp) is built on timeline
+        // semaphores, which every Vulkan 1.2+ device supports. A headless
+        // device never presents, so VK_KHR_swapchain is not even asked for.
+        bool const headless = has_any(desc.flags, DeviceFlag::Headless);
+        if (headless && has_any(desc.featureRequest.required, Feature::Presentation)) {
+            return std::unexpected{DeviceCreateError{
+                Status::InvalidArgument, "A headless device cannot require Feature::Presentation."}};
+        }
+        Feature const required  = desc.featureRequest.required | Feature::TimelineSemaphore;
+        Feature const preferred = headless
+            ? static_cast<Feature>(static_cast<uint64_t>(desc.featureRequest.preferred) &
+                                   ~static_cast<uint64_t>(Feature::Presentation))
+            : desc.featureRequest.preferred;
 
         // ------------------------------------------------------------------
         // 2. Select physical device.
@@ -314,13 +301,29 @@ auto VulkanDevice::create(vk::raii::Instance const& instance, DeviceDesc const&
         //   Priority:
         //     a) desc.preferredAdapterIndex if it satisfies required features.
         //     b) Best-scored device that satisfies required features.
+        //
+        //   Each adapter is queried at most once, and only when looked at
+        //   (vk_adapter_cache.hpp).
         // ------------------------------------------------------------------
+        struct Candidate {
+            std::shared_ptr<detail::AdapterQuery const> query;
+            AdapterInfo                                 info;
+        };
+        std::vector<std::optional<Candidate>> candidates(phys_devices.size());
+        auto candidate = [&](uint32_t i) -> Candidate const& {
+            if (!candidates[i]) {
+                auto query = detail::query_adapter(phys_devices[i], desc.capabilityCacheDirectory);
+                auto info  = detail::make_adapter_info(i, *query);
+                candidates[i].emplace(Candidate{std::move(query), std::move(info)});
+            }
+            return *candidates[i];
+        };
+
         int32_t chosen_idx = -1;
 
         // (a) User-specified index.
         if (desc.preferredAdapterIndex < static_cast<uint32_t>(phys_devices.size())) {
-            auto const info = detail::make_adapter_info(
-                desc.preferredAdapterIndex, phys_devices[desc.preferredAdapterIndex]);
+            auto const& info = candidate(desc.preferredAdapterIndex).info;
             if (has_all(info.capabilities.features, required))
                 chosen_idx = static_cast<int32_t>(desc.preferredAdapterIndex);
         }
@@ -329,7 +332,7 @@ auto VulkanDevice::create(vk::raii::Instance const& instance, DeviceDesc const&
         if (chosen_idx < 0) {
             int32_t best_score = -1;
             for (uint32_t i = 0; i < static_cast<uint32_t>(phys_devices.size()); ++i) {
-                int32_t s = score_physical_device(phys_devices[i], required);
+                int32_t s = score_physical_device(candidate(i).info, required);
                 if (s > best_score) {
                     best_score = s;
                     chosen_idx = static_cast<int32_t>(i);
@@ -343,15 +346,56 @@ auto VulkanDevice::create(vk::raii::Instance const& instance, DeviceDesc const&
                 "No physical device satisfies the required feature set."}};
         }
 
-        auto const& phys = phys_devices[static_cast<uint32_t>(chosen_idx)];
-        auto const adapter_info = detail::make_adapter_info(
-            static_cast<uint32_t>(chosen_idx), phys);
+        auto const& phys         = phys_devices[static_cast<uint32_t>(chosen_idx)];
+        auto const& chosen       = candidate(static_cast<uint32_t>(chosen_idx));
+        auto const& query        = *chosen.query;
+        auto const& adapter_info = chosen.info;
+
+        // ------------------------------------------------------------------
+        // 2b. Device group. With DeviceFlag::DeviceGroup the device spans
+        //     every physical device grouped with the chosen one, in the
+        //     group's order: device index i is bit i of a device mask.
+        //     Drivers only group identical GPUs, so the chosen adapter's
+        //     queries stand for all of them.
+        // ------------------------------------------------------------------
+        std::vector<vk::PhysicalDevice> group;
+        if (has_any(desc.flags, DeviceFlag::DeviceGroup)) {
+            auto const index = static_cast<uint32_t>(chosen_idx);
+            for (auto const& members : detail::physical_device_groups(instance, phys_devices)) {
+                if (members.size() < 2 || std::ranges::find(members, index) == members.end())
+                    continue;
+                for (uint32_t m : members)
+                    group.push_back(*phys_devices[m]);
+            }
+        }
+        bool const grouped = group.size() > 1;
+
+        // Sparse binds and descriptor buffers would only reach device 0's
+        // instance of a resource, so a group goes without them; the bindless
+        // heap (bindless.cpp) falls back to a descriptor set.
+        Feature const group_unsupported = grouped
+            ? Feature::SparseResources | Feature::DescriptorBuffer
+            : Feature::None;
+        if (has_any(required, group_unsupported)) {
+            return std::unexpected{DeviceCreateError{
+                Status::MissingRequiredFeature,
+                "Sparse resources and descriptor buffers are unavailable on a device group."}};
+        }
 
         // ------------------------------------------------------------------
         // 3. Resolve feature set: required + available subset of preferred.
         // ------------------------------------------------------------------
-        Feature const available = adapter_info.capabilities.features;
-        Feature const resolved  = required | (preferred & available);
+        Feature const available = static_cast<Feature>(static_cast<uint64_t>(adapter_info.capabilities.features) &
+                                                       ~static_cast<uint64_t>(group_unsupported));
+        Feature       resolved  = required | (preferred & available);
+
+        // Host builds are acceleration structure builds, and every build
+        // reads its inputs through device addresses. The adapter offers
+        // neither without the features it depends on.
+        if (has_any(resolved, Feature::AccelerationStructureHostBuild))
+            resolved |= Feature::RayTracing;
+        if (has_any(resolved, Feature::RayTracing))
+            resolved |= Feature::BufferDeviceAddress;
 
         // Log downgraded preferred features (best-effort).
         // Compute which preferred features were unavailable.
@@ -367,7 +411,7 @@ auto VulkanDevice::create(vk::raii::Instance const& instance, DeviceDesc const&
         // ------------------------------------------------------------------
         // 4. Queue families.
         // ------------------------------------------------------------------
-        auto const qi = select_queue_families(phys);
+        auto const qi = select_queue_families(query.queue_families);
         if (!qi.is_complete()) {
             return std::unexpected{DeviceCreateError{
                 Status::UnsupportedQueueType,
@@ -378,13 +422,17 @@ auto VulkanDevice::create(vk::raii::Instance const& instance, DeviceDesc const&
         // ------------------------------------------------------------------
         // 5. Device extensions — resolved against the feature set.
         // ------------------------------------------------------------------
-        auto const avail_exts = phys.enumerateDeviceExtensionProperties();
-        auto const extensions = resolve_extensions(resolved, avail_exts);
+        auto const extensions = resolve_extensions(resolved, query.extensions);
 
         // ------------------------------------------------------------------
         // 6. Build the feature chain (enables only resolved features).
         // ------------------------------------------------------------------
-        auto feat_chain = build_feature_chain(phys, resolved, extensions);
+        auto feat_chain = build_feature_chain(query, resolved);
+        detail::link_feature_chain(feat_chain, [&](const char* name) noexcept {
+            return std::ranges::any_of(extensions, [name](const char* e) {
+                return std::strcmp(e, name) == 0;
+            });
+        });
 
         // ------------------------------------------------------------------
         // 7. Queue create infos.
@@ -414,8 +462,12 @@ auto VulkanDevice::create(vk::raii::Instance const& instance, DeviceDesc const&
         if (want_debug)
             layers.push_back("VK_LAYER_KHRONOS_validation");
 
-        auto device_ci = vk::DeviceCreateInfo{}
+        auto const group_ci = vk::DeviceGroupDeviceCreateInfo{}
             .setPNext(&feat_chain.features2)
+            .setPhysicalDevices(group);
+
+        auto device_ci = vk::DeviceCreateInfo{}
+            .setPNext(grouped ? static_cast<void const*>(&group_ci) : &feat_chain.features2)
             .setQueueCreateInfos(queue_cis)
             .setPEnabledLayerNames(layers)
             .setPEnabledExtensionNames(extensions);
@@ -429,15 +481,97 @@ auto VulkanDevice::create(vk::raii::Instance const& instance, DeviceDesc const&
         // ------------------------------------------------------------------
         Capabilities final_caps = adapter_info.capabilities;
         final_caps.features = resolved; // only what we actually enabled
+        // Informational bits are not negotiated: dedicated queue families,
+        // the memory budget extension, the profiling queries and present
+        // pacing are always used when present.
+        final_caps.features |= available & (Feature::AsyncCompute | Feature::AsyncTransfer |
+                                            Feature::MemoryBudget | Feature::GraphicsPipelineLibrary |
+                                            Feature::TimestampQueries | Feature::PipelineStatistics |
+                                            Feature::CalibratedTimestamps | Feature::PresentWait);
+
+        // Calibration needs timestamps and the host clock steady_clock reads
+        // among the calibrateable domains (vk_profiler.hpp).
+        if (has_any(final_caps.features, Feature::CalibratedTimestamps)) {
+            auto const& domains = query.time_domains;
+            auto const  has     = [&](VkTimeDomainEXT domain) {
+                return std::ranges::find(domains, static_cast<vk::TimeDomainEXT>(domain)) != domains.end();
+            };
+            if (!has_any(final_caps.features, Feature::TimestampQueries) ||
+                !has(VK_TIME_DOMAIN_DEVICE_EXT) || !has(k_host_time_domain))
+                final_caps.features = static_cast<Feature>(static_cast<uint64_t>(final_caps.features) &
+                                                           ~static_cast<uint64_t>(Feature::CalibratedTimestamps));
+        }
+
+        // Pipeline libraries only pay off when linking them is fast; without
+        // it pipelines.cpp builds monolithic pipelines instead.
+        if (has_any(final_caps.features, Feature::GraphicsPipelineLibrary)) {
+            bool const usable =
+                feat_chain.gpl.graphicsPipelineLibrary == VK_TRUE &&
+                query.properties.gpl.graphicsPipelineLibraryFastLinking == VK_TRUE;
+            if (!usable)
+                final_caps.features = static_cast<Feature>(static_cast<uint64_t>(final_caps.features) &
+                                                           ~static_cast<uint64_t>(Feature::GraphicsPipelineLibrary));
+        }
+
+        // Present pacing rides on the swapchain and needs both features;
+        // without it wait_for_present() waits on the GPU instead.
+        if (has_any(final_caps.features, Feature::PresentWait)) {
+            bool const usable =
+                has_any(resolved, Feature::Presentation) &&
+                feat_chain.present_id.presentId == VK_TRUE &&
+                feat_chain.present_wait.presentWait == VK_TRUE;
+            if (!usable)
+                final_caps.features = static_cast<Feature>(static_cast<uint64_t>(final_caps.features) &
+                                                           ~static_cast<uint64_t>(Feature::PresentWait));
+        }
+
+        // The extension alone does not promise the feature; without it the
+        // bindless heap (bindless.cpp) falls back to a descriptor set.
+        if (has_any(final_caps.features, Feature::DescriptorBuffer) &&
+            feat_chain.descriptor_buffer.descriptorBuffer != VK_TRUE)
+            final_caps.features = static_cast<Feature>(static_cast<uint64_t>(final_caps.features) &
+                                                       ~static_cast<uint64_t>(Feature::DescriptorBuffer));
+
+        // Single indirect draws are core; more per call need the feature.
+        if (!has_any(final_caps.features, Feature::MultiDrawIndirect))
+            final_caps.limits.maxDrawIndirectCount = 1;
+
+        if (!has_any(final_caps.features, Feature::RayTracing)) {
+            final_caps.limits.accelerationStructureScratchAlignment  = 0;
+            final_caps.limits.maxAccelerationStructureGeometryCount  = 0;
+            final_caps.limits.maxAccelerationStructureInstanceCount  = 0;
+            final_caps.limits.maxAccelerationStructurePrimitiveCount = 0;
+        }
+
+        if (grouped) {
+            final_caps.limits.deviceCount = static_cast<uint32_t>(group.size());
+            SPDLOG_INFO("[wren/rhi/vulkan] Device group of {} x '{}'.", group.size(), adapter_info.name);
+        }
 
         // ------------------------------------------------------------------
-        // 10. Construct and return.
+        // 10. Construct.
         // ------------------------------------------------------------------
         auto impl = std::make_unique<Impl>(
             phys,                // vk::raii::PhysicalDevice is copyable (ref-counted handle)
             std::move(vk_device),
             qi,
-            std::move(final_caps));
+            std::move(final_caps),
+            chosen.query);
+
+        // ------------------------------------------------------------------
+        // 11. Queues, timeline semaphores and command pool bookkeeping, the
+        //     profiling and compaction query pools, the memory allocator,
+        //     the pipeline cache, the bindless heap and the pipeline compile
+        //     queue. On failure the Impl destructor releases whatever was
+        //     created.
+        // ------------------------------------------------------------------
+        init_commands(*impl, desc.framesInFlight);
+        init_profiler(*impl);
+        init_acceleration_structures(*impl);
+        init_memory(*impl);
+        init_pipeline_cache(*impl, adapter_info, desc.pipelineCacheDirectory);
+        init_bindless(*impl);
+        init_pipelines(*impl, desc.jobSystem);
 
         return VulkanDevice{std::move(impl)};
 
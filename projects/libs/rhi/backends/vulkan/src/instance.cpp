@@ -9,7 +9,9 @@
 #include <spdlog/spdlog.h>
 #include <vulkan/vulkan_raii.hpp>
 
+#include "vk_adapter_cache.hpp"
 #include "vk_capabilities.hpp"
+#include "vk_surface.hpp"
 
 namespace wren::rhi::vulkan {
 
@@ -109,6 +111,22 @@ auto create_instance(vk::raii::Context& ctx, InstanceConfig const& cfg)
             debug_utils_available = true;
         }
 
+        // ------------------------------------------------------------------
+        // Extensions: window-system surfaces (optional, per platform).
+        // Without VK_KHR_surface the platform ones are unusable.
+        // ------------------------------------------------------------------
+        if (cfg.enable_presentation &&
+            instance_extension_available(available_exts, VK_KHR_SURFACE_EXTENSION_NAME))
+        {
+            for (const char* name : detail::surface_instance_extensions()) {
+                if (instance_extension_available(available_exts, name))
+                    extensions.push_back(name);
+            }
+        } else if (cfg.enable_presentation) {
+            SPDLOG_WARN("[wren/rhi/vulkan] '{}' not available; swapchains cannot be created.",
+                        VK_KHR_SURFACE_EXTENSION_NAME);
+        }
+
         // ------------------------------------------------------------------
         // Application info: request Vulkan 1.3 as the minimum API level.
         // ------------------------------------------------------------------
@@ -156,15 +174,19 @@ auto create_debug_messenger(vk::raii::Instance& instance)
 // -------------------------------------------------------------------------------------------------
 // enumerate_adapters
 // -------------------------------------------------------------------------------------------------
-auto enumerate_adapters(vk::raii::Instance const& instance) -> std::vector<AdapterInfo> {
+auto enumerate_adapters(vk::raii::Instance const& instance, const char* cache_directory)
+    -> std::vector<AdapterInfo>
+{
     try {
         auto const phys_devices = instance.enumeratePhysicalDevices();
         std::vector<AdapterInfo> result;
         result.reserve(phys_devices.size());
 
         for (uint32_t i = 0; i < static_cast<uint32_t>(phys_devices.size()); ++i) {
-            result.push_back(detail::make_adapter_info(i, phys_devices[i]));
+            auto const query = detail::query_adapter(phys_devices[i], cache_directory);
+            result.push_back(detail::make_adapter_info(i, *query));
         }
+        detail::assign_device_groups(result, detail::physical_device_groups(instance, phys_devices));
 
         return result;
     } catch (vk::SystemError const& err) {
@@ -0,0 +1,407 @@
+#include <wren/rhi/vulkan/device.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <expected>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <vulkan/vulkan_raii.hpp>
+
+#include "vk_convert.hpp"
+#include "vk_device_impl.hpp"
+#include "vk_memory.hpp"
+
+namespace wren::rhi::vulkan {
+
+namespace {
+
+// Block sizing follows the usual practice for desktop drivers: 256 MiB
+// blocks, or an eighth of heaps of 1 GiB and below. The first blocks of a
+// type are smaller and double up to the preferred size, so a type that only
+// ever holds a few small buffers does not pin a whole block.
+constexpr uint64_t k_large_block_size     = 256ull << 20;
+constexpr uint64_t k_small_heap_threshold = 1ull << 30;
+constexpr uint32_t k_block_growth_steps   = 3;
+
+// Without VK_EXT_memory_budget the process is assumed to get this share of a heap.
+constexpr uint64_t k_estimated_budget_percent = 80;
+
+// -----------------------------------------------------------------
+// Memory type selection
+//
+// Tries the property sets for @p usage from most to least preferred and
+// returns the first memory type allowed by @p type_bits that has them all.
+// On a device group, host-visible memory comes from heaps of one instance
+// where there are any: mapped memory must not have several.
+// -----------------------------------------------------------------
+[[nodiscard]] std::optional<uint32_t> find_memory_type(
+    vk::PhysicalDeviceMemoryProperties const& props,
+    uint32_t                                  type_bits,
+    MemoryUsage                               usage,
+    bool                                      grouped) noexcept
+{
+    using M = vk::MemoryPropertyFlagBits;
+
+    vk::MemoryPropertyFlags candidates[3]{};
+    switch (usage) {
+        case MemoryUsage::GpuOnly:
+            candidates[0] = M::eDeviceLocal;
+            break;
+        case MemoryUsage::Upload:
+            candidates[0] = M::eHostVisible | M::eHostCoherent;
+            break;
+        case MemoryUsage::Readback:
+            // Cached memory makes CPU reads fast. Mapped pointers are read
+            // without vkInvalidateMappedMemoryRanges, so it must be coherent.
+            candidates[0] = M::eHostVisible | M::eHostCached | M::eHostCoherent;
+            candidates[1] = M::eHostVisible | M::eHostCoherent;
+            break;
+    }
+
+    auto const multi_instance = [&](uint32_t type) {
+        return static_cast<bool>(props.memoryHeaps[props.memoryTypes[type].heapIndex].flags &
+                                 vk::MemoryHeapFlagBits::eMultiInstance);
+    };
+    for (bool const single_only : {grouped && usage != MemoryUsage::GpuOnly, false}) {
+        for (auto const want : candidates) {
+            if (!want) continue;
+            for (uint32_t i = 0; i < props.memoryTypeCount; ++i) {
+                if ((type_bits & (1u << i)) && (props.memoryTypes[i].propertyFlags & want) == want &&
+                    !(single_only && multi_instance(i)))
+                    return i;
+            }
+        }
+        if (!single_only) break;
+    }
+
+    // GPU-only resources still work from any heap (e.g. some software devices).
+    if (usage == MemoryUsage::GpuOnly && type_bits != 0)
+        return static_cast<uint32_t>(std::countr_zero(type_bits));
+
+    return std::nullopt;
+}
+
+[[nodiscard]] uint32_t heap_of(VulkanDevice::Impl const& impl, uint32_t type) noexcept {
+    return impl.memory_properties.memoryTypes[type].heapIndex;
+}
+
+/// Fills budget[] and usage[] per heap, from the driver when the extension
+/// is enabled and from our own block bytes otherwise.
+void query_heap_budgets(VulkanDevice::Impl const& impl,
+                        uint64_t (&budget)[VK_MAX_MEMORY_HEAPS],
+                        uint64_t (&usage)[VK_MAX_MEMORY_HEAPS]) noexcept
+{
+    auto const& ctx   = impl.memory;
+    auto const& props = impl.memory_properties;
+
+    if (ctx.budget_extension) {
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT budget_props{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT,
+        };
+        VkPhysicalDeviceMemoryProperties2 props2{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2,
+            .pNext = &budget_props,
+        };
+        impl.phys_device.getDispatcher()->vkGetPhysicalDeviceMemoryProperties2(
+            static_cast<VkPhysicalDevice>(*impl.phys_device), &props2);
+        for (uint32_t h = 0; h < props.memoryHeapCount; ++h) {
+            budget[h] = budget_props.heapBudget[h];
+            usage[h]  = budget_props.heapUsage[h];
+        }
+        return;
+    }
+
+    for (uint32_t h = 0; h < props.memoryHeapCount; ++h) {
+        budget[h] = props.memoryHeaps[h].size * k_estimated_budget_percent / 100;
+        usage[h]  = ctx.heap_block_bytes[h];
+    }
+}
+
+// -----------------------------------------------------------------
+// Raw device memory. Caller holds MemoryContext::mutex.
+// -----------------------------------------------------------------
+struct DeviceMemory {
+    vk::DeviceMemory memory;
+    void*            mapped = nullptr;
+};
+
+[[nodiscard]] auto allocate_device_memory(VulkanDevice::Impl& impl, uint64_t size, uint32_t type,
+                                          void const* dedicated_info) noexcept
+    -> std::expected<DeviceMemory, Status>
+{
+    auto& ctx = impl.memory;
+    if (ctx.device_memory_count >= ctx.max_allocation_count) {
+        SPDLOG_ERROR("[wren/rhi/vulkan] maxMemoryAllocationCount ({}) reached.",
+                     ctx.max_allocation_count);
+        return std::unexpected{Status::OutOfMemory};
+    }
+
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    // Without a mask, memory on a multi-instance heap is replicated on every
+    // device of a group; mappable memory is kept on device 0 instead, and the
+    // others reach it as peer memory.
+    using vk::MemoryHeapFlagBits, vk::MemoryPropertyFlagBits;
+    auto const& props      = impl.memory_properties;
+    bool const  host       = static_cast<bool>(props.memoryTypes[type].propertyFlags & MemoryPropertyFlagBits::eHostVisible);
+    bool const  on_device0 = host && ctx.device_count > 1 &&
+                             (props.memoryHeaps[heap_of(impl, type)].flags & MemoryHeapFlagBits::eMultiInstance);
+
+    VkMemoryAllocateFlags alloc_flags = ctx.device_address ? VkMemoryAllocateFlags{VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT} : 0u;
+    if (on_device0)
+        alloc_flags |= VK_MEMORY_ALLOCATE_DEVICE_MASK_BIT;
+    VkMemoryAllocateFlagsInfo const flags{
+        .sType      = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO,
+        .pNext      = dedicated_info,
+        .flags      = alloc_flags,
+        .deviceMask = on_device0 ? 1u : 0u,
+    };
+    VkMemoryAllocateInfo const info{
+        .sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .pNext           = &flags,
+        .allocationSize  = size,
+        .memoryTypeIndex = type,
+    };
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    if (VkResult r = d->vkAllocateMemory(dev, &info, nullptr, &memory); r != VK_SUCCESS)
+        return std::unexpected{detail::to_status(r)};
+
+    void* mapped = nullptr;
+    if (host) {
+        if (VkResult r = d->vkMapMemory(dev, memory, 0, VK_WHOLE_SIZE, 0, &mapped); r != VK_SUCCESS) {
+            d->vkFreeMemory(dev, memory, nullptr);
+            return std::unexpected{detail::to_status(r)};
+        }
+    }
+
+    ++ctx.device_memory_count;
+    ctx.heap_block_bytes[heap_of(impl, type)] += size;
+    return DeviceMemory{vk::DeviceMemory{memory}, mapped};
+}
+
+void free_device_memory(VulkanDevice::Impl& impl, vk::DeviceMemory memory, uint64_t size,
+                        uint32_t type) noexcept
+{
+    auto& ctx = impl.memory;
+    impl.device.getDispatcher()->vkFreeMemory(static_cast<VkDevice>(*impl.device),
+                                              static_cast<VkDeviceMemory>(memory), nullptr);  // implicitly unmaps
+    --ctx.device_memory_count;
+    ctx.heap_block_bytes[heap_of(impl, type)] -= size;
+}
+
+[[nodiscard]] bool tiling_compatible(MemoryContext const& ctx, MemoryBlock const& block,
+                                     ResourceTiling tiling) noexcept {
+    return ctx.granularity <= 1 || block.tiling == tiling;
+}
+
+/// Size of the next block of @p type: grows with the block count, covers
+/// @p min_size, and shrinks back towards it when the heap is near its budget.
+[[nodiscard]] uint64_t next_block_size(VulkanDevice::Impl const& impl, uint32_t type,
+                                       uint64_t min_size) noexcept
+{
+    auto const& pool  = impl.memory.types[type];
+    auto const  steps = static_cast<uint32_t>(std::min<std::size_t>(pool.blocks.size(), k_block_growth_steps));
+    uint64_t size = std::max(pool.preferred_block_size >> (k_block_growth_steps - steps), min_size);
+
+    uint64_t budget[VK_MAX_MEMORY_HEAPS]{};
+    uint64_t usage[VK_MAX_MEMORY_HEAPS]{};
+    query_heap_budgets(impl, budget, usage);
+    uint32_t const heap = heap_of(impl, type);
+    while (size > min_size && usage[heap] + size > budget[heap])
+        size = std::max(size / 2, min_size);
+    return size;
+}
+
+[[nodiscard]] MemoryAllocation take_from_block(VulkanDevice::Impl& impl, MemoryBlock& block,
+                                               foundation::memory::TlsfAllocator::Allocation a) noexcept
+{
+    auto& ctx = impl.memory;
+    ctx.heap_allocation_bytes[heap_of(impl, block.type)] += a.size;
+    ++ctx.allocation_count;
+    return MemoryAllocation{
+        .memory = block.memory,
+        .offset = a.offset,
+        .size   = a.size,
+        .mapped = block.mapped ? static_cast<std::byte*>(block.mapped) + a.offset : nullptr,
+        .block  = &block,
+        .node   = a.node,
+        .type   = block.type,
+    };
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Setup & teardown
+// -------------------------------------------------------------------------------------------------
+void init_memory(VulkanDevice::Impl& impl) noexcept {
+    auto& ctx         = impl.memory;
+    auto const& limits = impl.adapter->base().limits;
+
+    ctx.granularity          = limits.bufferImageGranularity;
+    ctx.max_allocation_count = limits.maxMemoryAllocationCount;
+    ctx.device_address       = has_any(impl.capabilities.features, Feature::BufferDeviceAddress);
+    ctx.budget_extension     = has_any(impl.capabilities.features, Feature::MemoryBudget);
+    ctx.device_count         = impl.capabilities.limits.deviceCount;
+
+    auto const& props = impl.memory_properties;
+    for (uint32_t t = 0; t < props.memoryTypeCount; ++t) {
+        uint64_t const heap_size = props.memoryHeaps[props.memoryTypes[t].heapIndex].size;
+        ctx.types[t].preferred_block_size =
+            heap_size <= k_small_heap_threshold ? heap_size / 8 : k_large_block_size;
+    }
+}
+
+void release_memory(VulkanDevice::Impl& impl) noexcept {
+    auto& ctx = impl.memory;
+    std::scoped_lock lock{ctx.mutex};
+    for (uint32_t t = 0; t < VK_MAX_MEMORY_TYPES; ++t) {
+        for (auto const& block : ctx.types[t].blocks)
+            free_device_memory(impl, block->memory, block->tlsf.capacity(), t);
+        ctx.types[t].blocks.clear();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Allocation
+// -------------------------------------------------------------------------------------------------
+auto allocate_memory(VulkanDevice::Impl& impl, MemoryRequest const& request) noexcept
+    -> std::expected<MemoryAllocation, Status>
+{
+    auto const& reqs = request.requirements;
+    auto const  type = find_memory_type(impl.memory_properties, reqs.memoryTypeBits, request.usage,
+                                         impl.memory.device_count > 1);
+    if (!type)
+        return std::unexpected{Status::OutOfMemory};
+
+    auto& ctx = impl.memory;
+    std::scoped_lock lock{ctx.mutex};
+    auto& pool = ctx.types[*type];
+
+    if (!request.dedicated && reqs.size <= pool.preferred_block_size / 2) {
+        for (auto const& block : pool.blocks) {
+            if (!tiling_compatible(ctx, *block, request.tiling)) continue;
+            if (auto a = allocate_in_block(impl, *block, reqs))
+                return *a;
+        }
+
+        // New block. If the driver cannot provide it, fall through to a
+        // dedicated allocation of just the requested size.
+        uint64_t const size = next_block_size(impl, *type, reqs.size);
+        if (auto memory = allocate_device_memory(impl, size, *type, nullptr)) {
+            try {
+                pool.blocks.push_back(std::make_unique<MemoryBlock>(MemoryBlock{
+                    .memory = memory->memory,
+                    .mapped = memory->mapped,
+                    .type   = *type,
+                    .tiling = request.tiling,
+                    .tlsf   = foundation::memory::TlsfAllocator{size},
+                }));
+            } catch (std::bad_alloc const&) {
+                free_device_memory(impl, memory->memory, size, *type);
+                return std::unexpected{Status::OutOfMemory};
+            }
+            if (auto a = allocate_in_block(impl, *pool.blocks.back(), reqs))
+                return *a;
+        }
+    }
+
+    VkMemoryDedicatedAllocateInfo const dedicated{
+        .sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO,
+        .pNext  = nullptr,
+        .image  = static_cast<VkImage>(request.dedicated_image),
+        .buffer = static_cast<VkBuffer>(request.dedicated_buffer),
+    };
+    auto memory = allocate_device_memory(impl, reqs.size, *type, &dedicated);
+    if (!memory)
+        return std::unexpected{memory.error()};
+
+    ctx.heap_allocation_bytes[heap_of(impl, *type)] += reqs.size;
+    ++ctx.allocation_count;
+    return MemoryAllocation{
+        .memory = memory->memory,
+        .size   = reqs.size,
+        .mapped = memory->mapped,
+        .type   = *type,
+    };
+}
+
+auto allocate_in_block(VulkanDevice::Impl& impl, MemoryBlock& block,
+                       vk::MemoryRequirements const& requirements) noexcept
+    -> std::optional<MemoryAllocation>
+{
+    if (!(requirements.memoryTypeBits & (1u << block.type)))
+        return std::nullopt;
+    auto const a = block.tlsf.allocate(requirements.size, requirements.alignment);
+    if (!a)
+        return std::nullopt;
+    return take_from_block(impl, block, *a);
+}
+
+void free_memory(VulkanDevice::Impl& impl, MemoryAllocation const& allocation) noexcept {
+    std::scoped_lock lock{impl.memory.mutex};
+    free_memory_locked(impl, allocation);
+}
+
+void free_memory_locked(VulkanDevice::Impl& impl, MemoryAllocation const& allocation) noexcept {
+    auto& ctx = impl.memory;
+    if (!allocation.memory || allocation.placed)
+        return;
+
+    ctx.heap_allocation_bytes[heap_of(impl, allocation.type)] -= allocation.size;
+    --ctx.allocation_count;
+
+    MemoryBlock* const block = allocation.block;
+    if (!block) {
+        free_device_memory(impl, allocation.memory, allocation.size, allocation.type);
+        return;
+    }
+
+    block->tlsf.free(allocation.node);
+    auto& blocks = ctx.types[allocation.type].blocks;
+    if (!block->tlsf.empty() || blocks.size() == 1)
+        return;
+
+    // Keep one empty block per type so a create / destroy cycle does not
+    // hit the driver every time.
+    free_device_memory(impl, block->memory, block->tlsf.capacity(), allocation.type);
+    std::erase_if(blocks, [block](auto const& b) { return b.get() == block; });
+}
+
+// -------------------------------------------------------------------------------------------------
+// Budget
+// -------------------------------------------------------------------------------------------------
+void VulkanDevice::memory_budget(MemoryBudget& out) const noexcept {
+    auto& impl        = *impl_;
+    auto const& props = impl.memory_properties;
+    out               = {};
+
+    uint64_t budget[VK_MAX_MEMORY_HEAPS]{};
+    uint64_t usage[VK_MAX_MEMORY_HEAPS]{};
+
+    std::scoped_lock lock{impl.memory.mutex};
+    query_heap_budgets(impl, budget, usage);
+
+    out.heapCount = std::min(props.memoryHeapCount, k_max_memory_heaps);
+    for (uint32_t h = 0; h < out.heapCount; ++h) {
+        out.heaps[h] = MemoryHeapBudget{
+            .size            = props.memoryHeaps[h].size,
+            .budget          = budget[h],
+            .usage           = usage[h],
+            .blockBytes      = impl.memory.heap_block_bytes[h],
+            .allocationBytes = impl.memory.heap_allocation_bytes[h],
+            .deviceLocal     = static_cast<bool>(props.memoryHeaps[h].flags & vk::MemoryHeapFlagBits::eDeviceLocal),
+        };
+    }
+    out.deviceMemoryCount    = impl.memory.device_memory_count;
+    out.maxDeviceMemoryCount = impl.memory.max_allocation_count;
+    out.resourceCount        = impl.memory.allocation_count;
+}
+
+} // namespace wren::rhi::vulkan
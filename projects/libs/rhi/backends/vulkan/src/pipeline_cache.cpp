@@ -0,0 +1,256 @@
+#include <wren/rhi/vulkan/device.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <format>
+#include <mutex>
+#include <new>
+#include <span>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/platform/mapped_file.hpp>
+
+#include "vk_cache_file.hpp"
+#include "vk_convert.hpp"
+#include "vk_device_impl.hpp"
+#include "vk_pipeline_cache.hpp"
+
+namespace wren::rhi::vulkan {
+
+namespace {
+
+// -----------------------------------------------------------------
+// File format
+//
+//   CacheFileHeader, then the vkGetPipelineCacheData() payload. Fields
+//   are in native byte order; a file from another machine fails the key
+//   check long before that matters.
+// -----------------------------------------------------------------
+constexpr uint32_t k_cache_file_magic   = 0x43505257;  // "WRPC"
+constexpr uint32_t k_cache_file_version = 1;
+
+struct CacheFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint32_t reserved;
+    uint8_t  uuid[VK_UUID_SIZE];
+    uint64_t data_size;
+    uint64_t data_hash;
+};
+static_assert(sizeof(CacheFileHeader) == 56);
+
+[[nodiscard]] CacheFileHeader make_header(PipelineCacheContext const& ctx,
+                                          std::span<std::byte const> payload) noexcept {
+    CacheFileHeader header{
+        .magic          = k_cache_file_magic,
+        .version        = k_cache_file_version,
+        .vendor_id      = ctx.vendor_id,
+        .device_id      = ctx.device_id,
+        .driver_version = ctx.driver_version,
+        .reserved       = 0,
+        .uuid           = {},
+        .data_size      = payload.size(),
+        .data_hash      = detail::hash_payload(payload),
+    };
+    std::ranges::copy(ctx.uuid, header.uuid);
+    return header;
+}
+
+/// Returns the payload of @p file when it belongs to this adapter and is
+/// intact, otherwise an empty span and the reason in @p reason.
+[[nodiscard]] std::span<std::byte const> validate(PipelineCacheContext const& ctx,
+                                                  std::span<std::byte const> file,
+                                                  const char*& reason) noexcept {
+    CacheFileHeader header{};
+    if (file.size() < sizeof header) {
+        reason = "truncated header";
+        return {};
+    }
+    std::memcpy(&header, file.data(), sizeof header);
+    auto const payload = file.subspan(sizeof header);
+
+    if (header.magic != k_cache_file_magic || header.version != k_cache_file_version) {
+        reason = "unknown format";
+        return {};
+    }
+    if (header.vendor_id != ctx.vendor_id || header.device_id != ctx.device_id ||
+        header.driver_version != ctx.driver_version ||
+        !std::ranges::equal(header.uuid, ctx.uuid)) {
+        reason = "different device or driver";
+        return {};
+    }
+    if (header.data_size != payload.size() || header.data_hash != detail::hash_payload(payload)) {
+        reason = "corrupt payload";
+        return {};
+    }
+
+    // The driver validates its own header as well, but some drivers crash
+    // on garbage instead of ignoring it.
+    VkPipelineCacheHeaderVersionOne driver{};
+    if (payload.size() < sizeof driver) {
+        reason = "truncated driver header";
+        return {};
+    }
+    std::memcpy(&driver, payload.data(), sizeof driver);
+    if (driver.headerSize < sizeof driver ||
+        driver.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+        driver.vendorID != ctx.vendor_id || driver.deviceID != ctx.device_id ||
+        !std::ranges::equal(driver.pipelineCacheUUID, ctx.uuid)) {
+        reason = "driver header mismatch";
+        return {};
+    }
+    return payload;
+}
+
+[[nodiscard]] VkPipelineCache create_cache(VulkanDevice::Impl const& impl,
+                                           std::span<std::byte const> initial) {
+    VkPipelineCacheCreateInfo const info{
+        .sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+        .pNext           = nullptr,
+        .flags           = 0,
+        .initialDataSize = initial.size(),
+        .pInitialData    = initial.data(),
+    };
+    VkPipelineCache cache = VK_NULL_HANDLE;
+    VkResult const  r     = impl.device.getDispatcher()->vkCreatePipelineCache(
+        static_cast<VkDevice>(*impl.device), &info, nullptr, &cache);
+    if (r != VK_SUCCESS)
+        throw vk::SystemError{vk::make_error_code(static_cast<vk::Result>(r)), "vkCreatePipelineCache"};
+    return cache;
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Setup & teardown
+// -------------------------------------------------------------------------------------------------
+void init_pipeline_cache(VulkanDevice::Impl& impl, AdapterInfo const& adapter, const char* directory) {
+    auto& ctx          = impl.pipeline_cache;
+    ctx.vendor_id      = adapter.vendor_id;
+    ctx.device_id      = adapter.device_id;
+    ctx.driver_version = adapter.driver_version;
+    ctx.uuid           = adapter.pipeline_cache_uuid;
+
+    if (!directory || !*directory) {
+        ctx.cache = vk::PipelineCache{create_cache(impl, {})};
+        return;
+    }
+    ctx.path = std::filesystem::path{directory} /
+               std::format("vulkan_{:04x}_{:04x}.wpc", adapter.vendor_id, adapter.device_id);
+
+    // The mapping only lives for the create call; the driver copies what
+    // it keeps.
+    auto const file = platform::mapped_file::open(ctx.path);
+    if (!file) {
+        SPDLOG_INFO("[wren/rhi/vulkan] No pipeline cache at '{}'; starting cold.", ctx.path.string());
+        ctx.cache = vk::PipelineCache{create_cache(impl, {})};
+        return;
+    }
+
+    const char* reason  = nullptr;
+    auto const  payload = validate(ctx, file->bytes(), reason);
+    if (payload.empty()) {
+        SPDLOG_WARN("[wren/rhi/vulkan] Ignoring pipeline cache '{}': {}.", ctx.path.string(), reason);
+        ctx.cache = vk::PipelineCache{create_cache(impl, {})};
+        return;
+    }
+
+    ctx.cache        = vk::PipelineCache{create_cache(impl, payload)};
+    ctx.loaded       = true;
+    ctx.loaded_bytes = payload.size();
+    ctx.saved_size   = payload.size();
+    SPDLOG_INFO("[wren/rhi/vulkan] Loaded {} bytes of pipeline cache from '{}'.",
+                payload.size(), ctx.path.string());
+}
+
+Status write_pipeline_cache(VulkanDevice::Impl& impl) noexcept {
+    auto& ctx = impl.pipeline_cache;
+    if (ctx.path.empty() || !ctx.cache)
+        return Status::Ok;
+
+    auto const* d     = impl.device.getDispatcher();
+    auto const  dev   = static_cast<VkDevice>(*impl.device);
+    auto const  cache = static_cast<VkPipelineCache>(ctx.cache);
+
+    std::scoped_lock lock{ctx.save_mutex};
+    std::size_t size = 0;
+    if (VkResult r = d->vkGetPipelineCacheData(dev, cache, &size, nullptr); r != VK_SUCCESS)
+        return detail::to_status(r);
+    if (size == ctx.saved_size)
+        return Status::Ok;
+
+    std::vector<std::byte> file;
+    try {
+        file.resize(sizeof(CacheFileHeader) + size);
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+    // The cache may have grown since the size query; VK_INCOMPLETE then
+    // still returns a consistent prefix, which is fine to persist.
+    VkResult const r = d->vkGetPipelineCacheData(dev, cache, &size, file.data() + sizeof(CacheFileHeader));
+    if (r != VK_SUCCESS && r != VK_INCOMPLETE)
+        return detail::to_status(r);
+    file.resize(sizeof(CacheFileHeader) + size);
+
+    auto const header = make_header(ctx, std::span{file}.subspan(sizeof(CacheFileHeader)));
+    std::memcpy(file.data(), &header, sizeof header);
+
+    if (auto const ec = platform::write_file_atomic(ctx.path, file)) {
+        SPDLOG_ERROR("[wren/rhi/vulkan] Failed to write pipeline cache '{}': {}",
+                     ctx.path.string(), ec.message());
+        return Status::IoError;
+    }
+    ctx.saved_size  = size;
+    ctx.saved_bytes = file.size();
+    return Status::Ok;
+}
+
+void release_pipeline_cache(VulkanDevice::Impl& impl) noexcept {
+    auto& ctx = impl.pipeline_cache;
+    if (!ctx.cache)
+        return;
+    (void)write_pipeline_cache(impl);
+    impl.device.getDispatcher()->vkDestroyPipelineCache(
+        static_cast<VkDevice>(*impl.device), static_cast<VkPipelineCache>(ctx.cache), nullptr);
+    ctx.cache = vk::PipelineCache{};
+}
+
+// -------------------------------------------------------------------------------------------------
+// VulkanDevice
+// -------------------------------------------------------------------------------------------------
+void VulkanDevice::pipeline_cache_stats(PipelineCacheStats& out) const noexcept {
+    {
+        auto& ctx = impl_->pipeline_cache;
+        std::scoped_lock lock{ctx.save_mutex};
+        out = PipelineCacheStats{
+            .hits        = ctx.hits.load(std::memory_order_relaxed),
+            .misses      = ctx.misses.load(std::memory_order_relaxed),
+            .loadedBytes = ctx.loaded_bytes,
+            .savedBytes  = ctx.saved_bytes,
+            .enabled     = !ctx.path.empty(),
+            .loaded      = ctx.loaded,
+        };
+    }
+
+    out.pipelineHits = impl_->pipelines.hits.load(std::memory_order_relaxed);
+
+    auto& shaders = impl_->shaders;
+    std::scoped_lock lock{shaders.mutex};
+    out.shaderModules = static_cast<uint64_t>(std::ranges::count_if(
+        shaders.by_hash, [](auto const& entry) { return !entry.second.expired(); }));
+    out.shaderModuleHits  = shaders.hits.load(std::memory_order_relaxed);
+    out.shaderModuleBytes = shaders.bytes.load(std::memory_order_relaxed);
+}
+
+auto VulkanDevice::save_pipeline_cache() noexcept -> Status {
+    return write_pipeline_cache(*impl_);
+}
+
+} // namespace wren::rhi::vulkan
@@ -0,0 +1,1249 @@
+#include <wren/rhi/vulkan/device.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/rhi/api/state_hash.hpp>
+
+#include "vk_commands.hpp"
+#include "vk_convert.hpp"
+#include "vk_deferred.hpp"
+#include "vk_device_impl.hpp"
+#include "vk_pipelines.hpp"
+#include "vk_shaders.hpp"
+
+namespace wren::rhi::vulkan {
+
+namespace {
+
+// Vertex or task + mesh, two tessellation stages, geometry, fragment.
+constexpr uint32_t k_max_graphics_stages = 6;
+
+constexpr ShaderStage k_graphics_stages = ShaderStage::Vertex | ShaderStage::TessControl |
+                                          ShaderStage::TessEval | ShaderStage::Geometry |
+                                          ShaderStage::Fragment | ShaderStage::Task |
+                                          ShaderStage::Mesh;
+
+[[nodiscard]] constexpr bool has(ShaderStage set, ShaderStage bits) noexcept {
+    return underlying(set & bits) != 0;
+}
+
+// -----------------------------------------------------------------
+// Validation — everything the driver would reject or the device
+// lacks is caught here, on the creating thread.
+// -----------------------------------------------------------------
+[[nodiscard]] Status validate_shader(ShaderStageDesc const& shader) noexcept {
+    if (!shader.entryPoint)
+        return Status::InvalidArgument;
+    if (!shader.module && (!shader.code || shader.codeSize == 0 || shader.codeSize % 4 != 0))
+        return Status::InvalidArgument;
+    return Status::Ok;
+}
+
+/// Checks what a module declares against the shared pipeline layout.
+[[nodiscard]] Status validate_reflection(VulkanDevice::Impl const& impl, ShaderReflection const& reflection,
+                                         ShaderStageDesc const& shader) noexcept
+{
+    auto const* const begin = reflection.entryPoints;
+    auto const* const end   = begin + reflection.entryPointCount;
+    bool const found = std::any_of(begin, end, [&shader](ShaderEntryPoint const& e) {
+        return e.stage == shader.stage && std::strcmp(e.name, shader.entryPoint) == 0;
+    });
+    // Past k_max_shader_entry_points the entry point may just not be listed.
+    if (!found && reflection.entryPointCount < k_max_shader_entry_points)
+        return Status::InvalidArgument;
+    if (reflection.pushConstantBytes > k_max_push_constant_bytes)
+        return Status::InvalidArgument;
+
+    // Set 0 is the bindless heap; there is no other set to bind.
+    if (reflection.bindingCount > 0 && !impl.bindless.enabled)
+        return Status::InvalidArgument;
+    uint32_t const listed = std::min(reflection.bindingCount, k_max_shader_bindings);
+    for (uint32_t i = 0; i < listed; ++i) {
+        if (reflection.bindings[i].set != 0)
+            return Status::InvalidArgument;
+    }
+    return Status::Ok;
+}
+
+[[nodiscard]] Status validate(Capabilities const& caps, GraphicsPipelineDesc const& desc) noexcept {
+    if (!desc.shaders || desc.shaderCount == 0 || desc.shaderCount > k_max_graphics_stages)
+        return Status::InvalidArgument;
+
+    ShaderStage stages = ShaderStage::None;
+    for (uint32_t i = 0; i < desc.shaderCount; ++i) {
+        ShaderStage const stage = desc.shaders[i].stage;
+        if (std::popcount(underlying(stage)) != 1 || !has(k_graphics_stages, stage) || has(stages, stage))
+            return Status::InvalidArgument;
+        if (Status s = validate_shader(desc.shaders[i]); s != Status::Ok)
+            return s;
+        stages |= stage;
+    }
+
+    bool const mesh = has(stages, ShaderStage::Mesh);
+    bool const tess = has(stages, ShaderStage::TessControl | ShaderStage::TessEval);
+    if (mesh == has(stages, ShaderStage::Vertex) || (has(stages, ShaderStage::Task) && !mesh) ||
+        (mesh && has(stages, ShaderStage::TessControl | ShaderStage::TessEval | ShaderStage::Geometry)))
+        return Status::InvalidArgument;
+    if (tess && !(has(stages, ShaderStage::TessControl) && has(stages, ShaderStage::TessEval)))
+        return Status::InvalidArgument;
+    if (tess != (desc.topology == PrimitiveTopology::PatchList) || (tess && desc.patchControlPoints == 0))
+        return Status::InvalidArgument;
+
+    auto const& vi = desc.vertexInput;
+    auto const& rt = desc.renderTargets;
+    if (vi.bindingCount > k_max_vertex_bindings || vi.attributeCount > k_max_vertex_attributes ||
+        rt.colorFormatCount > k_max_color_attachments)
+        return Status::InvalidArgument;
+    if (static_cast<uint32_t>(rt.samples) > caps.limits.maxMSAASamples)
+        return Status::UnsupportedSampleCount;
+
+    bool dual_source = false;
+    for (uint32_t i = 0; i < rt.colorFormatCount; ++i) {
+        auto const& b = desc.blend.attachments[i];
+        for (BlendFactor f : {b.srcColor, b.dstColor, b.srcAlpha, b.dstAlpha})
+            dual_source |= f >= BlendFactor::Src1Color;
+    }
+
+    auto const missing = [&caps](Feature feature) { return !has_all(caps.features, feature); };
+    if ((tess && missing(Feature::Tessellation)) ||
+        (has(stages, ShaderStage::Geometry) && missing(Feature::GeometryShader)) ||
+        (mesh && missing(Feature::MeshShader)) ||
+        (desc.rasterizer.fillMode == FillMode::Wireframe && missing(Feature::NonSolidFill)) ||
+        (desc.rasterizer.depthClamp && missing(Feature::DepthClamp)) ||
+        (dual_source && missing(Feature::DualSourceBlending)))
+        return Status::MissingRequiredFeature;
+    return Status::Ok;
+}
+
+[[nodiscard]] Status validate(Capabilities const& /*caps*/, ComputePipelineDesc const& desc) noexcept {
+    if (desc.shader.stage != ShaderStage::Compute)
+        return Status::InvalidArgument;
+    return validate_shader(desc.shader);
+}
+
+// -----------------------------------------------------------------
+// Records
+// -----------------------------------------------------------------
+
+/// Resolves the module of @p desc — by handle, or through the module cache
+/// for raw code — and checks it against the stage. Throws std::bad_alloc.
+[[nodiscard]] auto resolve_shader(VulkanDevice::Impl& impl, ShaderStageDesc const& desc)
+    -> std::expected<PipelineShader, Status>
+{
+    std::shared_ptr<ShaderModuleRecord const> module;
+    if (desc.module) {
+        module = find_shader_module(impl.shaders, desc.module);
+        if (!module)
+            return std::unexpected{Status::InvalidArgument};
+    } else {
+        auto interned = intern_shader_module(impl, desc.code, desc.codeSize, nullptr);
+        if (!interned)
+            return std::unexpected{interned.error()};
+        module = std::move(*interned);
+    }
+    if (Status s = validate_reflection(impl, module->reflection, desc); s != Status::Ok)
+        return std::unexpected{s};
+    return PipelineShader{.stage = desc.stage, .module = std::move(module), .entry_point = desc.entryPoint};
+}
+
+/// Identity of a pipeline for de-duplication: everything that reaches the
+/// driver, plus the fallback. Debug names are left out; a shared record
+/// keeps the first one.
+[[nodiscard]] uint64_t pipeline_key(PipelineRecord const& record) noexcept {
+    auto const& recipe = *record.recipe;
+    StateHasher h;
+    h.add(recipe.compute);
+    if (!recipe.compute)
+        hash_append(h, recipe.graphics);
+    for (auto const& shader : recipe.shaders) {
+        h.add(shader.stage);
+        h.add(shader.module->reflection.hash);
+        h.add(shader.entry_point.c_str());
+    }
+    h.add(record.fallback.value);
+    return h.value();
+}
+
+[[nodiscard]] auto make_record(VulkanDevice::Impl& impl, GraphicsPipelineDesc const& desc)
+    -> std::expected<std::shared_ptr<PipelineRecord>, Status>
+{
+    auto recipe = std::make_unique<PipelineRecipe>();
+    recipe->graphics             = desc;
+    recipe->graphics.shaders     = nullptr;
+    recipe->graphics.shaderCount = 0;
+    recipe->graphics.fallback    = {};
+    recipe->graphics.debugName   = nullptr;
+    for (uint32_t i = 0; i < desc.shaderCount; ++i) {
+        auto shader = resolve_shader(impl, desc.shaders[i]);
+        if (!shader)
+            return std::unexpected{shader.error()};
+        recipe->shaders.push_back(std::move(*shader));
+    }
+    std::ranges::stable_partition(recipe->shaders,
+                                  [](PipelineShader const& s) { return s.stage != ShaderStage::Fragment; });
+
+    auto record        = std::make_shared<PipelineRecord>();
+    record->bind_point = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    record->fallback   = desc.fallback;
+    record->debug_name = desc.debugName ? desc.debugName : "";
+    record->recipe     = std::move(recipe);
+    record->key        = pipeline_key(*record);
+    return record;
+}
+
+[[nodiscard]] auto make_record(VulkanDevice::Impl& impl, ComputePipelineDesc const& desc)
+    -> std::expected<std::shared_ptr<PipelineRecord>, Status>
+{
+    auto shader = resolve_shader(impl, desc.shader);
+    if (!shader)
+        return std::unexpected{shader.error()};
+    auto recipe     = std::make_unique<PipelineRecipe>();
+    recipe->compute = true;
+    recipe->shaders.push_back(std::move(*shader));
+
+    auto record        = std::make_shared<PipelineRecord>();
+    record->bind_point = VK_PIPELINE_BIND_POINT_COMPUTE;
+    record->fallback   = desc.fallback;
+    record->debug_name = desc.debugName ? desc.debugName : "";
+    record->recipe     = std::move(recipe);
+    record->key        = pipeline_key(*record);
+    return record;
+}
+
+/// Takes every pipeline a record owns for destruction. Caller holds
+/// PipelineContext::mutex or is the only thread left.
+void take_pipelines(PipelineRecord& record, std::vector<VkPipeline>& out) {
+    if (VkPipeline p = record.pipeline.exchange(VK_NULL_HANDLE, std::memory_order_acq_rel))
+        out.push_back(p);
+    if (VkPipeline p = std::exchange(record.fast_linked, VK_NULL_HANDLE))
+        out.push_back(p);
+}
+
+void destroy_pipelines(VulkanDevice::Impl const& impl, std::span<VkPipeline const> pipelines) noexcept {
+    auto const* d   = impl.device.getDispatcher();
+    auto const  dev = static_cast<VkDevice>(*impl.device);
+    for (VkPipeline p : pipelines)
+        d->vkDestroyPipeline(dev, p, nullptr);
+}
+
+/// Destroys @p pipelines once the GPU has finished the work submitted so
+/// far, for pipelines whose handle command lists may have bound.
+void retire_pipelines(VulkanDevice::Impl& impl, std::span<VkPipeline const> pipelines) noexcept {
+    for (VkPipeline p : pipelines)
+        defer_release(impl, vk::Pipeline{p});
+}
+
+/// Drops one handle's claim on @p record. The last one unregisters it and
+/// takes its pipelines, or, when a builder holds it, leaves them to the
+/// builder. Caller holds PipelineContext::mutex.
+void drop_handle(PipelineContext& ctx, std::shared_ptr<PipelineRecord> const& record,
+                 std::vector<VkPipeline>& garbage) {
+    if (--record->handles > 0)
+        return;
+    if (auto it = ctx.by_key.find(record->key); it != ctx.by_key.end() && it->second.lock() == record)
+        ctx.by_key.erase(it);
+    record->destroyed = true;
+    if (record->state.load(std::memory_order_relaxed) == PipelineState::Queued) {
+        // Never started; its queue entries are skipped from now on.
+        record->recipe.reset();
+        record->state.store(PipelineState::Failed, std::memory_order_release);
+    } else if (!record->busy) {
+        take_pipelines(*record, garbage);
+    }
+}
+
+// -----------------------------------------------------------------
+// Graphics state
+//
+// Every create-info a graphics pipeline needs, filled from a recipe.
+// The monolithic path passes all of them at once; the library path
+// hands each part its own subset.
+// -----------------------------------------------------------------
+struct GraphicsState {
+    VkPipelineShaderStageCreateInfo        stages[k_max_graphics_stages]{};
+    uint32_t                               stage_count      = 0;
+    uint32_t                               pre_raster_count = 0;  // the rest is the fragment shader
+    bool                                   mesh             = false;
+    bool                                   tessellated      = false;
+    VkVertexInputBindingDescription        bindings[k_max_vertex_bindings]{};
+    VkVertexInputAttributeDescription      attributes[k_max_vertex_attributes]{};
+    VkPipelineVertexInputStateCreateInfo   vertex_input{};
+    VkPipelineInputAssemblyStateCreateInfo input_assembly{};
+    VkPipelineTessellationStateCreateInfo  tessellation{};
+    VkPipelineViewportStateCreateInfo      viewport{};
+    VkPipelineRasterizationStateCreateInfo rasterization{};
+    VkPipelineMultisampleStateCreateInfo   multisample{};
+    VkPipelineDepthStencilStateCreateInfo  depth_stencil{};
+    VkPipelineColorBlendAttachmentState    blend[k_max_color_attachments]{};
+    VkPipelineColorBlendStateCreateInfo    color_blend{};
+    VkDynamicState                         dynamic_states[2]{VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+    VkPipelineDynamicStateCreateInfo       dynamic{};
+    VkFormat                               color_formats[k_max_color_attachments]{};
+    VkPipelineRenderingCreateInfo          rendering{};
+
+    GraphicsState() = default;
+    GraphicsState(GraphicsState const&)            = delete;  // self-referential
+    GraphicsState& operator=(GraphicsState const&) = delete;
+};
+
+[[nodiscard]] VkStencilOpState to_vk(StencilOpState const& s, DepthStencilStateDesc const& ds) noexcept {
+    return VkStencilOpState{
+        .failOp      = static_cast<VkStencilOp>(detail::to_vk(s.failOp)),
+        .passOp      = static_cast<VkStencilOp>(detail::to_vk(s.passOp)),
+        .depthFailOp = static_cast<VkStencilOp>(detail::to_vk(s.depthFailOp)),
+        .compareOp   = static_cast<VkCompareOp>(detail::to_vk(s.compareOp)),
+        .compareMask = ds.stencilReadMask,
+        .writeMask   = ds.stencilWriteMask,
+        .reference   = ds.stencilReference,
+    };
+}
+
+void fill_graphics_state(GraphicsState& s, PipelineRecipe const& recipe) noexcept {
+    auto const& g  = recipe.graphics;
+    auto const& vi = g.vertexInput;
+    auto const& rs = g.rasterizer;
+    auto const& ds = g.depthStencil;
+    auto const& rt = g.renderTargets;
+
+    s.stage_count = static_cast<uint32_t>(recipe.shaders.size());
+    for (uint32_t i = 0; i < s.stage_count; ++i) {
+        auto const& shader = recipe.shaders[i];
+        s.stages[i] = VkPipelineShaderStageCreateInfo{
+            .sType               = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+            .pNext               = nullptr,
+            .flags               = 0,
+            .stage               = static_cast<VkShaderStageFlagBits>(detail::to_vk_shader_stage(shader.stage)),
+            .module              = shader.module->module,
+            .pName               = shader.entry_point.c_str(),
+            .pSpecializationInfo = nullptr,
+        };
+        if (shader.stage != ShaderStage::Fragment) ++s.pre_raster_count;
+        s.mesh        |= shader.stage == ShaderStage::Mesh;
+        s.tessellated |= shader.stage == ShaderStage::TessControl;
+    }
+
+    for (uint32_t i = 0; i < vi.bindingCount; ++i) {
+        s.bindings[i] = VkVertexInputBindingDescription{
+            .binding   = vi.bindings[i].binding,
+            .stride    = vi.bindings[i].stride,
+            .inputRate = vi.bindings[i].perInstance ? VK_VERTEX_INPUT_RATE_INSTANCE : VK_VERTEX_INPUT_RATE_VERTEX,
+        };
+    }
+    for (uint32_t i = 0; i < vi.attributeCount; ++i) {
+        s.attributes[i] = VkVertexInputAttributeDescription{
+            .location = vi.attributes[i].location,
+            .binding  = vi.attributes[i].binding,
+            .format   = static_cast<VkFormat>(detail::to_vk(vi.attributes[i].format)),
+            .offset   = vi.attributes[i].offset,
+        };
+    }
+    s.vertex_input = VkPipelineVertexInputStateCreateInfo{
+        .sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+        .pNext                           = nullptr,
+        .flags                           = 0,
+        .vertexBindingDescriptionCount   = vi.bindingCount,
+        .pVertexBindingDescriptions      = s.bindings,
+        .vertexAttributeDescriptionCount = vi.attributeCount,
+        .pVertexAttributeDescriptions    = s.attributes,
+    };
+    s.input_assembly = VkPipelineInputAssemblyStateCreateInfo{
+        .sType                  = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+        .pNext                  = nullptr,
+        .flags                  = 0,
+        .topology               = static_cast<VkPrimitiveTopology>(detail::to_vk(g.topology)),
+        .primitiveRestartEnable = VK_FALSE,
+    };
+    s.tessellation = VkPipelineTessellationStateCreateInfo{
+        .sType              = VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO,
+        .pNext              = nullptr,
+        .flags              = 0,
+        .patchControlPoints = g.patchControlPoints,
+    };
+    s.viewport = VkPipelineViewportStateCreateInfo{
+        .sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+        .pNext         = nullptr,
+        .flags         = 0,
+        .viewportCount = 1,
+        .pViewports    = nullptr,  // dynamic
+        .scissorCount  = 1,
+        .pScissors     = nullptr,  // dynamic
+    };
+    s.rasterization = VkPipelineRasterizationStateCreateInfo{
+        .sType                   = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+        .pNext                   = nullptr,
+        .flags                   = 0,
+        .depthClampEnable        = rs.depthClamp ? VK_TRUE : VK_FALSE,
+        .rasterizerDiscardEnable = VK_FALSE,
+        .polygonMode             = static_cast<VkPolygonMode>(detail::to_vk(rs.fillMode)),
+        .cullMode                = static_cast<VkCullModeFlags>(detail::to_vk(rs.cullMode)),
+        .frontFace               = static_cast<VkFrontFace>(detail::to_vk(rs.frontFace)),
+        .depthBiasEnable         = (rs.depthBias != 0.0f || rs.slopeScaledDepthBias != 0.0f) ? VK_TRUE : VK_FALSE,
+        .depthBiasConstantFactor = rs.depthBias,
+        .depthBiasClamp          = rs.depthBiasClamp,
+        .depthBiasSlopeFactor    = rs.slopeScaledDepthBias,
+        .lineWidth               = 1.0f,
+    };
+    s.multisample = VkPipelineMultisampleStateCreateInfo{
+        .sType                 = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+        .pNext                 = nullptr,
+        .flags                 = 0,
+        .rasterizationSamples  = static_cast<VkSampleCountFlagBits>(detail::to_vk(rt.samples)),
+        .sampleShadingEnable   = VK_FALSE,
+        .minSampleShading      = 0.0f,
+        .pSampleMask           = nullptr,
+        .alphaToCoverageEnable = VK_FALSE,
+        .alphaToOneEnable      = VK_FALSE,
+    };
+    s.depth_stencil = VkPipelineDepthStencilStateCreateInfo{
+        .sType                 = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
+        .pNext                 = nullptr,
+        .flags                 = 0,
+        .depthTestEnable       = ds.depthTestEnable ? VK_TRUE : VK_FALSE,
+        .depthWriteEnable      = ds.depthWriteEnable ? VK_TRUE : VK_FALSE,
+        .depthCompareOp        = static_cast<VkCompareOp>(detail::to_vk(ds.depthCompareOp)),
+        .depthBoundsTestEnable = VK_FALSE,
+        .stencilTestEnable     = ds.stencilTestEnable ? VK_TRUE : VK_FALSE,
+        .front                 = to_vk(ds.front, ds),
+        .back                  = to_vk(ds.back, ds),
+        .minDepthBounds        = 0.0f,
+        .maxDepthBounds        = 1.0f,
+    };
+
+    for (uint32_t i = 0; i < rt.colorFormatCount; ++i) {
+        auto const& b = g.blend.attachments[i];
+        s.blend[i] = VkPipelineColorBlendAttachmentState{
+            .blendEnable         = b.blendEnable ? VK_TRUE : VK_FALSE,
+            .srcColorBlendFactor = static_cast<VkBlendFactor>(detail::to_vk(b.srcColor)),
+            .dstColorBlendFactor = static_cast<VkBlendFactor>(detail::to_vk(b.dstColor)),
+            .colorBlendOp        = static_cast<VkBlendOp>(detail::to_vk(b.colorOp)),
+            .srcAlphaBlendFactor = static_cast<VkBlendFactor>(detail::to_vk(b.srcAlpha)),
+            .dstAlphaBlendFactor = static_cast<VkBlendFactor>(detail::to_vk(b.dstAlpha)),
+            .alphaBlendOp        = static_cast<VkBlendOp>(detail::to_vk(b.alphaOp)),
+            .colorWriteMask      = static_cast<VkColorComponentFlags>(detail::to_vk(b.writeMask)),
+        };
+        s.color_formats[i] = static_cast<VkFormat>(detail::to_vk(rt.colorFormats[i]));
+    }
+    s.color_blend = VkPipelineColorBlendStateCreateInfo{
+        .sType           = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+        .pNext           = nullptr,
+        .flags           = 0,
+        .logicOpEnable   = VK_FALSE,
+        .logicOp         = VK_LOGIC_OP_COPY,
+        .attachmentCount = rt.colorFormatCount,
+        .pAttachments    = s.blend,
+        .blendConstants  = {0.0f, 0.0f, 0.0f, 0.0f},
+    };
+    s.dynamic = VkPipelineDynamicStateCreateInfo{
+        .sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+        .pNext             = nullptr,
+        .flags             = 0,
+        .dynamicStateCount = 2,
+        .pDynamicStates    = s.dynamic_states,
+    };
+
+    VkFormat const depth = rt.hasDepthStencil ? static_cast<VkFormat>(detail::to_vk(rt.depthStencilFormat))
+                                              : VK_FORMAT_UNDEFINED;
+    s.rendering = VkPipelineRenderingCreateInfo{
+        .sType                   = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+        .pNext                   = nullptr,
+        .viewMask                = 0,
+        .colorAttachmentCount    = rt.colorFormatCount,
+        .pColorAttachmentFormats = s.color_formats,
+        .depthAttachmentFormat   = depth,
+        .stencilAttachmentFormat = rt.hasDepthStencil && detail::has_stencil(rt.depthStencilFormat)
+                                       ? depth : VK_FORMAT_UNDEFINED,
+    };
+}
+
+// -----------------------------------------------------------------
+// Driver calls. Every creation goes through the pipeline cache and
+// reports its creation feedback to the cache counters.
+// -----------------------------------------------------------------
+[[nodiscard]] VkResult create_graphics_pipeline(VulkanDevice::Impl& impl, VkGraphicsPipelineCreateInfo info,
+                                                VkPipeline& out) noexcept
+{
+    VkPipelineCreationFeedback           feedback{};
+    VkPipelineCreationFeedbackCreateInfo feedback_info{
+        .sType                              = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO,
+        .pNext                              = info.pNext,
+        .pPipelineCreationFeedback          = &feedback,
+        .pipelineStageCreationFeedbackCount = 0,
+        .pPipelineStageCreationFeedbacks    = nullptr,
+    };
+    info.pNext  = &feedback_info;
+    info.flags |= impl.pipelines.create_flags;
+
+    VkResult const r = impl.device.getDispatcher()->vkCreateGraphicsPipelines(
+        static_cast<VkDevice>(*impl.device), static_cast<VkPipelineCache>(impl.pipeline_cache.cache),
+        1, &info, nullptr, &out);
+    if (r == VK_SUCCESS)
+        record_pipeline_feedback(impl.pipeline_cache, feedback);
+    return r;
+}
+
+[[nodiscard]] VkResult build_compute(VulkanDevice::Impl& impl, PipelineRecipe const& recipe,
+                                     VkPipeline& out) noexcept
+{
+    VkPipelineCreationFeedback                 feedback{};
+    VkPipelineCreationFeedbackCreateInfo const feedback_info{
+        .sType                              = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO,
+        .pNext                              = nullptr,
+        .pPipelineCreationFeedback          = &feedback,
+        .pipelineStageCreationFeedbackCount = 0,
+        .pPipelineStageCreationFeedbacks    = nullptr,
+    };
+    VkComputePipelineCreateInfo const info{
+        .sType  = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+        .pNext  = &feedback_info,
+        .flags  = impl.pipelines.create_flags,
+        .stage  = VkPipelineShaderStageCreateInfo{
+            .sType               = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+            .pNext               = nullptr,
+            .flags               = 0,
+            .stage               = VK_SHADER_STAGE_COMPUTE_BIT,
+            .module              = recipe.shaders[0].module->module,
+            .pName               = recipe.shaders[0].entry_point.c_str(),
+            .pSpecializationInfo = nullptr,
+        },
+        .layout             = impl.pipelines.layout,
+        .basePipelineHandle = VK_NULL_HANDLE,
+        .basePipelineIndex  = -1,
+    };
+
+    VkResult const r = impl.device.getDispatcher()->vkCreateComputePipelines(
+        static_cast<VkDevice>(*impl.device), static_cast<VkPipelineCache>(impl.pipeline_cache.cache),
+        1, &info, nullptr, &out);
+    if (r == VK_SUCCESS)
+        record_pipeline_feedback(impl.pipeline_cache, feedback);
+    return r;
+}
+
+[[nodiscard]] VkResult build_monolithic(VulkanDevice::Impl& impl, PipelineRecipe const& recipe,
+                                        VkPipeline& out) noexcept
+{
+    GraphicsState s;
+    fill_graphics_state(s, recipe);
+    VkGraphicsPipelineCreateInfo const info{
+        .sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext               = &s.rendering,
+        .flags               = 0,
+        .stageCount          = s.stage_count,
+        .pStages             = s.stages,
+        .pVertexInputState   = s.mesh ? nullptr : &s.vertex_input,
+        .pInputAssemblyState = s.mesh ? nullptr : &s.input_assembly,
+        .pTessellationState  = s.tessellated ? &s.tessellation : nullptr,
+        .pViewportState      = &s.viewport,
+        .pRasterizationState = &s.rasterization,
+        .pMultisampleState   = &s.multisample,
+        .pDepthStencilState  = &s.depth_stencil,
+        .pColorBlendState    = &s.color_blend,
+        .pDynamicState       = &s.dynamic,
+        .layout              = impl.pipelines.layout,
+        .renderPass          = VK_NULL_HANDLE,
+        .subpass             = 0,
+        .basePipelineHandle  = VK_NULL_HANDLE,
+        .basePipelineIndex   = -1,
+    };
+    return create_graphics_pipeline(impl, info, out);
+}
+
+// -----------------------------------------------------------------
+// Graphics pipeline libraries (VK_EXT_graphics_pipeline_library)
+//
+// A pipeline is split into its four parts. Each part is keyed by a
+// hash of the state it consumes and shared with every pipeline that
+// has the same key, so a new permutation only compiles the parts it
+// changes. Parts keep their link-time optimisation info: the first
+// link is fast and unoptimised, and a later job relinks with
+// optimisation and swaps the result in.
+// -----------------------------------------------------------------
+enum class LibraryPart : uint8_t { VertexInput, PreRasterization, FragmentShader, FragmentOutput };
+
+[[nodiscard]] constexpr VkGraphicsPipelineLibraryFlagsEXT to_vk(LibraryPart part) noexcept {
+    switch (part) {
+        case LibraryPart::VertexInput:      return VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+        case LibraryPart::PreRasterization: return VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+        case LibraryPart::FragmentShader:   return VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+        case LibraryPart::FragmentOutput:   return VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+    }
+    return 0;
+}
+
+/// Hash of the fields a part consumes.
+[[nodiscard]] uint64_t library_key(LibraryPart part, PipelineRecipe const& recipe) noexcept {
+    auto const& g = recipe.graphics;
+    StateHasher h;
+    h.add(part);
+
+    auto const add_shaders = [&](bool fragment) {
+        for (auto const& shader : recipe.shaders) {
+            if ((shader.stage == ShaderStage::Fragment) != fragment) continue;
+            h.add(shader.stage);
+            h.add(shader.module->reflection.hash);
+            h.add(shader.entry_point.c_str());
+        }
+    };
+
+    switch (part) {
+        case LibraryPart::VertexInput:
+            h.add(g.topology);
+            hash_append(h, g.vertexInput);
+            break;
+        case LibraryPart::PreRasterization:
+            add_shaders(false);
+            h.add(g.patchControlPoints);
+            hash_append(h, g.rasterizer);
+            break;
+        case LibraryPart::FragmentShader:
+            add_shaders(true);
+            hash_append(h, g.depthStencil);
+            h.add(g.renderTargets.samples);
+            break;
+        case LibraryPart::FragmentOutput:
+            hash_append(h, g.renderTargets);
+            for (uint32_t i = 0; i < g.renderTargets.colorFormatCount; ++i)
+                hash_append(h, g.blend.attachments[i]);
+            break;
+    }
+    return h.value();
+}
+
+[[nodiscard]] VkResult build_library(VulkanDevice::Impl& impl, GraphicsState& s, LibraryPart part,
+                                     VkPipeline& out) noexcept
+{
+    VkGraphicsPipelineLibraryCreateInfoEXT library_info{
+        .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+        .pNext = part == LibraryPart::VertexInput ? nullptr : &s.rendering,
+        .flags = to_vk(part),
+    };
+    VkGraphicsPipelineCreateInfo info{
+        .sType              = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext              = &library_info,
+        .flags              = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+                              VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT,
+        .layout             = VK_NULL_HANDLE,
+        .renderPass         = VK_NULL_HANDLE,
+        .basePipelineHandle = VK_NULL_HANDLE,
+        .basePipelineIndex  = -1,
+    };
+    switch (part) {
+        case LibraryPart::VertexInput:
+            info.pVertexInputState   = &s.vertex_input;
+            info.pInputAssemblyState = &s.input_assembly;
+            break;
+        case LibraryPart::PreRasterization:
+            info.stageCount          = s.pre_raster_count;
+            info.pStages             = s.stages;
+            info.pTessellationState  = s.tessellated ? &s.tessellation : nullptr;
+            info.pViewportState      = &s.viewport;
+            info.pRasterizationState = &s.rasterization;
+            info.pDynamicState       = &s.dynamic;
+            info.layout              = impl.pipelines.layout;
+            break;
+        case LibraryPart::FragmentShader:
+            info.stageCount         = s.stage_count - s.pre_raster_count;
+            info.pStages            = s.stages + s.pre_raster_count;
+            info.pMultisampleState  = &s.multisample;
+            info.pDepthStencilState = &s.depth_stencil;
+            info.layout             = impl.pipelines.layout;
+            break;
+        case LibraryPart::FragmentOutput:
+            info.pMultisampleState = &s.multisample;
+            info.pColorBlendState  = &s.color_blend;
+            break;
+    }
+    return create_graphics_pipeline(impl, info, out);
+}
+
+/// Finds or builds every part of @p recipe's pipeline.
+[[nodiscard]] VkResult acquire_libraries(VulkanDevice::Impl& impl, PipelineRecipe const& recipe,
+                                         PipelineLibraries& out) noexcept
+{
+    auto& ctx = impl.pipelines;
+    bool const mesh = std::ranges::any_of(recipe.shaders,
+                                          [](PipelineShader const& s) { return s.stage == ShaderStage::Mesh; });
+
+    LibraryPart parts[4]{};
+    uint32_t    count = 0;
+    if (!mesh) parts[count++] = LibraryPart::VertexInput;
+    parts[count++] = LibraryPart::PreRasterization;
+    parts[count++] = LibraryPart::FragmentShader;
+    parts[count++] = LibraryPart::FragmentOutput;
+
+    uint64_t   keys[4]{};
+    VkPipeline found[4]{};
+    {
+        std::lock_guard lock{ctx.mutex};
+        for (uint32_t i = 0; i < count; ++i) {
+            keys[i] = library_key(parts[i], recipe);
+            if (auto it = ctx.libraries.find(keys[i]); it != ctx.libraries.end())
+                found[i] = it->second;
+        }
+    }
+
+    // Parts are built outside the lock; a part another thread finished in
+    // the meantime wins and ours is dropped.
+    GraphicsState s;
+    fill_graphics_state(s, recipe);
+
+    VkPipeline built[4]{};
+    VkResult   result = VK_SUCCESS;
+    for (uint32_t i = 0; i < count && result == VK_SUCCESS; ++i) {
+        if (!found[i])
+            result = build_library(impl, s, parts[i], built[i]);
+    }
+
+    std::vector<VkPipeline> dropped;
+    {
+        std::lock_guard lock{ctx.mutex};
+        for (uint32_t i = 0; i < count; ++i) {
+            if (!built[i]) continue;
+            if (result != VK_SUCCESS) {
+                dropped.push_back(built[i]);
+                continue;
+            }
+            auto [it, inserted] = ctx.libraries.try_emplace(keys[i], built[i]);
+            if (!inserted) dropped.push_back(built[i]);
+            found[i] = it->second;
+        }
+    }
+    destroy_pipelines(impl, dropped);
+    if (result != VK_SUCCESS)
+        return result;
+
+    std::copy_n(found, count, out.parts);
+    out.count = count;
+    return VK_SUCCESS;
+}
+
+[[nodiscard]] VkResult link_libraries(VulkanDevice::Impl& impl, PipelineLibraries const& libraries,
+                                      bool optimize, VkPipeline& out) noexcept
+{
+    VkPipelineLibraryCreateInfoKHR const library_info{
+        .sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+        .pNext        = nullptr,
+        .libraryCount = libraries.count,
+        .pLibraries   = libraries.parts,
+    };
+    VkGraphicsPipelineCreateInfo const info{
+        .sType              = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext              = &library_info,
+        .flags              = optimize ? VkPipelineCreateFlags{VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT} : 0,
+        .layout             = impl.pipelines.layout,
+        .renderPass         = VK_NULL_HANDLE,
+        .basePipelineHandle = VK_NULL_HANDLE,
+        .basePipelineIndex  = -1,
+    };
+    return create_graphics_pipeline(impl, info, out);
+}
+
+// -----------------------------------------------------------------
+// Building
+// -----------------------------------------------------------------
+void spawn_build_jobs(VulkanDevice::Impl& impl, uint32_t count) noexcept;
+
+/// Claims a queued record for the calling thread. Caller holds
+/// PipelineContext::mutex. Returns null when the record is not queued.
+[[nodiscard]] std::unique_ptr<PipelineRecipe> claim(PipelineRecord& record) noexcept {
+    if (record.destroyed || record.state.load(std::memory_order_relaxed) != PipelineState::Queued)
+        return nullptr;
+    record.busy = true;
+    record.state.store(PipelineState::Compiling, std::memory_order_relaxed);
+    return std::move(record.recipe);
+}
+
+/// Builds a claimed record on the calling thread and publishes the result.
+/// With graphics pipeline libraries and a job system, the pipeline is fast-
+/// linked and an optimised relink is queued behind all pending builds.
+void build(VulkanDevice::Impl& impl, std::shared_ptr<PipelineRecord> const& record,
+           std::unique_ptr<PipelineRecipe> recipe) noexcept
+{
+    auto& ctx = impl.pipelines;
+
+    VkPipeline        pipeline = VK_NULL_HANDLE;
+    PipelineLibraries libraries{};
+    VkResult          r        = VK_SUCCESS;
+    if (recipe->compute) {
+        r = build_compute(impl, *recipe, pipeline);
+    } else if (ctx.graphics_pipeline_library) {
+        r = acquire_libraries(impl, *recipe, libraries);
+        if (r == VK_SUCCESS)
+            r = link_libraries(impl, libraries, /*optimize=*/!ctx.jobs, pipeline);
+    } else {
+        r = build_monolithic(impl, *recipe, pipeline);
+    }
+    recipe.reset();
+
+    if (r != VK_SUCCESS) {
+        SPDLOG_ERROR("[wren/rhi/vulkan] Pipeline '{}' failed to compile: {}",
+                     record->debug_name, vk::to_string(static_cast<vk::Result>(r)));
+    } else {
+        set_debug_name(impl, vk::ObjectType::ePipeline, reinterpret_cast<uint64_t>(pipeline),
+                       record->debug_name.empty() ? nullptr : record->debug_name.c_str());
+    }
+
+    bool       relink = false;
+    VkPipeline orphan = VK_NULL_HANDLE;
+    {
+        std::lock_guard lock{ctx.mutex};
+        record->busy = false;
+        if (record->destroyed) {
+            orphan = pipeline;
+        } else if (r == VK_SUCCESS) {
+            record->pipeline.store(pipeline, std::memory_order_release);
+            record->libraries = libraries;
+            relink = ctx.jobs && libraries.count > 0 && !ctx.shutting_down;
+            if (relink) ctx.relink_queue.push_back(record);
+        }
+        record->state.store(r == VK_SUCCESS && !record->destroyed ? PipelineState::Ready : PipelineState::Failed,
+                            std::memory_order_release);
+    }
+    record->state.notify_all();
+
+    if (orphan) destroy_pipelines(impl, {&orphan, 1});
+    if (relink) spawn_build_jobs(impl, 1);
+}
+
+/// Replaces a fast-linked pipeline with an optimised link of the same parts.
+/// The fast one stays alive until the handle is destroyed, since command
+/// lists recorded earlier may still use it.
+void relink(VulkanDevice::Impl& impl, std::shared_ptr<PipelineRecord> const& record) noexcept {
+    auto& ctx = impl.pipelines;
+
+    PipelineLibraries libraries;
+    {
+        std::lock_guard lock{ctx.mutex};
+        libraries = record->libraries;
+    }
+    VkPipeline optimized = VK_NULL_HANDLE;
+    if (VkResult r = link_libraries(impl, libraries, /*optimize=*/true, optimized); r != VK_SUCCESS) {
+        SPDLOG_WARN("[wren/rhi/vulkan] Optimised relink of pipeline '{}' failed ({}); "
+                    "keeping the fast-linked one.",
+                    record->debug_name, vk::to_string(static_cast<vk::Result>(r)));
+    } else {
+        set_debug_name(impl, vk::ObjectType::ePipeline, reinterpret_cast<uint64_t>(optimized),
+                       record->debug_name.empty() ? nullptr : record->debug_name.c_str());
+    }
+
+    std::vector<VkPipeline> garbage;
+    {
+        std::lock_guard lock{ctx.mutex};
+        record->busy = false;
+        if (record->destroyed) {
+            take_pipelines(*record, garbage);
+            if (optimized) garbage.push_back(optimized);
+        } else if (optimized) {
+            record->fast_linked = record->pipeline.exchange(optimized, std::memory_order_acq_rel);
+        }
+    }
+    retire_pipelines(impl, garbage);
+}
+
+/// Body of a compile job: builds the most urgent queued record, or relinks
+/// one when nothing is queued.
+void run_build_job(VulkanDevice::Impl& impl) noexcept {
+    auto& ctx = impl.pipelines;
+
+    std::shared_ptr<PipelineRecord> record;
+    std::unique_ptr<PipelineRecipe> recipe;
+    bool                            relink_instead = false;
+    {
+        std::lock_guard lock{ctx.mutex};
+        while (!recipe && !ctx.queue.empty()) {
+            record = std::move(ctx.queue.front());
+            ctx.queue.pop_front();
+            recipe = claim(*record);
+        }
+        while (!recipe && !relink_instead && !ctx.relink_queue.empty()) {
+            record = std::move(ctx.relink_queue.front());
+            ctx.relink_queue.pop_front();
+            relink_instead = !record->destroyed && !record->busy;
+            record->busy  |= relink_instead;
+        }
+    }
+    if (recipe)
+        build(impl, record, std::move(recipe));
+    else if (relink_instead)
+        relink(impl, record);
+}
+
+void spawn_build_jobs(VulkanDevice::Impl& impl, uint32_t count) noexcept {
+    auto& ctx = impl.pipelines;
+
+    // Spawned without holding the mutex: a job may run inline.
+    std::vector<foundation::jobs::JobHandle> spawned;
+    try {
+        spawned.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+            spawned.push_back(ctx.jobs->spawn([&impl] { run_build_job(impl); }));
+    } catch (std::bad_alloc const&) {
+        // The records stay queued; bind or wait_pipelines() compile them inline.
+        SPDLOG_ERROR("[wren/rhi/vulkan] Out of memory spawning pipeline compile jobs.");
+    }
+
+    std::lock_guard lock{ctx.mutex};
+    std::erase_if(ctx.in_flight, [](foundation::jobs::JobHandle const& job) { return job.is_done(); });
+    for (auto& job : spawned)
+        ctx.in_flight.push_back(std::move(job));
+}
+
+/// Returns once @p record is no longer pending, building it here when it is
+/// still queued.
+void ensure_built(VulkanDevice::Impl& impl, std::shared_ptr<PipelineRecord> const& record) noexcept {
+    std::unique_ptr<PipelineRecipe> recipe;
+    {
+        std::lock_guard lock{impl.pipelines.mutex};
+        recipe = claim(*record);
+    }
+    if (recipe) {
+        build(impl, record, std::move(recipe));
+        return;
+    }
+    for (auto s = record->state.load(std::memory_order_acquire); s == PipelineState::Compiling;
+         s = record->state.load(std::memory_order_acquire))
+        record->state.wait(s, std::memory_order_acquire);
+}
+
+/// Moves a queued record to the front of the compile queue, once.
+void promote(PipelineContext& ctx, std::shared_ptr<PipelineRecord> const& record) {
+    if (record->promoted.exchange(true, std::memory_order_relaxed))
+        return;
+    std::lock_guard lock{ctx.mutex};
+    if (!record->destroyed && record->state.load(std::memory_order_relaxed) == PipelineState::Queued)
+        ctx.queue.push_front(record);
+}
+
+[[nodiscard]] std::shared_ptr<PipelineRecord> find_record(PipelineContext const& ctx,
+                                                          PipelineHandle         handle) noexcept
+{
+    std::shared_lock lock{ctx.pool_mutex};
+    auto const* record = ctx.pool.get<0>(handle);
+    return record ? *record : nullptr;
+}
+
+/// Swaps each record in @p records for a live one with the same key and
+/// counts the extra handle; registers the others and appends them to
+/// @p fresh, which has room for all of them. A record the key table has no
+/// memory for is built unshared.
+void share_records(PipelineContext& ctx, std::span<std::shared_ptr<PipelineRecord>> records,
+                   std::vector<std::shared_ptr<PipelineRecord>>& fresh) noexcept
+{
+    std::lock_guard lock{ctx.mutex};
+    for (auto& record : records) {
+        if (auto it = ctx.by_key.find(record->key); it != ctx.by_key.end()) {
+            if (auto existing = it->second.lock(); existing && !existing->destroyed) {
+                ++existing->handles;
+                record = std::move(existing);
+                ctx.hits.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            it->second = record;
+        } else {
+            try {
+                ctx.by_key.emplace(record->key, record);
+            } catch (std::bad_alloc const&) {
+                // Not shareable; still correct.
+            }
+        }
+        fresh.push_back(record);
+    }
+}
+
+template<typename Desc>
+[[nodiscard]] Status create_pipelines(VulkanDevice::Impl& impl, std::span<Desc const> descs,
+                                      std::span<PipelineHandle> out) noexcept
+{
+    auto& ctx = impl.pipelines;
+    std::ranges::fill(out.first(descs.size()), PipelineHandle{});
+
+    for (Desc const& desc : descs) {
+        if (Status s = validate(impl.capabilities, desc); s != Status::Ok)
+            return s;
+    }
+
+    std::vector<std::shared_ptr<PipelineRecord>> records;
+    std::vector<std::shared_ptr<PipelineRecord>> fresh;  // not shared with a live pipeline
+    try {
+        records.reserve(descs.size());
+        fresh.reserve(descs.size());
+        for (Desc const& desc : descs) {
+            auto record = make_record(impl, desc);
+            if (!record)
+                return record.error();
+            records.push_back(std::move(*record));
+        }
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+    share_records(ctx, records, fresh);
+
+    // Without a job system the pipelines are built right here, one by one.
+    if (!ctx.jobs) {
+        for (auto const& record : fresh) {
+            std::unique_ptr<PipelineRecipe> recipe;
+            {
+                std::lock_guard lock{ctx.mutex};
+                recipe = claim(*record);
+            }
+            build(impl, record, std::move(recipe));
+        }
+    }
+
+    Status status = Status::Ok;
+    {
+        std::unique_lock lock{ctx.pool_mutex};
+        bool             full = false;
+        try {
+            for (size_t i = 0; i < records.size() && !full; ++i) {
+                out[i] = ctx.pool.insert(records[i]);
+                full   = !out[i];
+            }
+        } catch (std::bad_alloc const&) {
+            full = true;
+        }
+        if (full) {
+            // A record shared with a live pipeline may have been bound, and a
+            // fresh one may have been shared by a concurrent call meanwhile.
+            std::vector<VkPipeline> garbage;
+            {
+                std::lock_guard ctx_lock{ctx.mutex};
+                for (size_t i = 0; i < records.size(); ++i) {
+                    ctx.pool.erase(out[i]);
+                    out[i] = {};
+                    drop_handle(ctx, records[i], garbage);
+                }
+                std::erase_if(fresh, [](auto const& record) { return record->destroyed; });
+            }
+            lock.unlock();
+            retire_pipelines(impl, garbage);
+            status = Status::OutOfMemory;
+        }
+    }
+
+    if (ctx.jobs && !fresh.empty()) {
+        {
+            std::lock_guard lock{ctx.mutex};
+            for (auto& record : fresh)
+                ctx.queue.push_back(std::move(record));
+        }
+        spawn_build_jobs(impl, static_cast<uint32_t>(fresh.size()));
+    }
+    return status;
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Lifecycle
+// -------------------------------------------------------------------------------------------------
+void init_pipelines(VulkanDevice::Impl& impl, foundation::jobs::JobSystem* jobs) {
+    auto& ctx = impl.pipelines;
+    ctx.jobs                      = jobs;
+    ctx.graphics_pipeline_library = has_any(impl.capabilities.features, Feature::GraphicsPipelineLibrary);
+
+    // Every pipeline shares one layout, so binding a pipeline never
+    // disturbs the heap or the push constants bound to the command list.
+    VkPushConstantRange const push_constants{
+        .stageFlags = VK_SHADER_STAGE_ALL,
+        .offset     = 0,
+        .size       = k_max_push_constant_bytes,
+    };
+    VkPipelineLayoutCreateInfo const info{
+        .sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+        .pNext                  = nullptr,
+        .flags                  = 0,
+        .setLayoutCount         = impl.bindless.enabled ? 1u : 0u,
+        .pSetLayouts            = &impl.bindless.set_layout,
+        .pushConstantRangeCount = 1,
+        .pPushConstantRanges    = &push_constants,
+    };
+    if (impl.bindless.descriptor_buffer)
+        ctx.create_flags = VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    VkResult const r = impl.device.getDispatcher()->vkCreatePipelineLayout(
+        static_cast<VkDevice>(*impl.device), &info, nullptr, &ctx.layout);
+    if (r != VK_SUCCESS)
+        throw vk::SystemError{vk::make_error_code(static_cast<vk::Result>(r)), "vkCreatePipelineLayout"};
+}
+
+void release_pipelines(VulkanDevice::Impl& impl) noexcept {
+    auto& ctx = impl.pipelines;
+    {
+        std::lock_guard lock{ctx.mutex};
+        ctx.shutting_down = true;
+        ctx.queue.clear();
+        ctx.relink_queue.clear();
+    }
+
+    // Jobs still queued in the job system find nothing left to do. A
+    // finishing build may spawn once more before it sees shutting_down.
+    for (;;) {
+        std::vector<foundation::jobs::JobHandle> jobs;
+        {
+            std::lock_guard lock{ctx.mutex};
+            jobs.swap(ctx.in_flight);
+        }
+        if (jobs.empty()) break;
+        for (auto const& job : jobs)
+            ctx.jobs->wait(job);
+    }
+
+    if (!ctx.pool.empty()) {
+        SPDLOG_WARN("[wren/rhi/vulkan] Device destroyed with {} pipeline(s) alive.", ctx.pool.size());
+    }
+    std::vector<VkPipeline> garbage;
+    for (auto& record : ctx.pool.column<0>())
+        take_pipelines(*record, garbage);
+    ctx.pool.clear();
+    ctx.by_key.clear();
+    for (auto const& [key, library] : ctx.libraries)
+        garbage.push_back(library);
+    ctx.libraries.clear();
+    destroy_pipelines(impl, garbage);
+
+    if (ctx.layout) {
+        impl.device.getDispatcher()->vkDestroyPipelineLayout(static_cast<VkDevice>(*impl.device),
+                                                             ctx.layout, nullptr);
+        ctx.layout = VK_NULL_HANDLE;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// VulkanDevice — pipelines
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::create_graphics_pipelines(std::span<GraphicsPipelineDesc const> descs,
+                                             std::span<PipelineHandle>             out) noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    return create_pipelines(*impl_, descs, out);
+}
+
+auto VulkanDevice::create_compute_pipelines(std::span<ComputePipelineDesc const> descs,
+                                            std::span<PipelineHandle>            out) noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    return create_pipelines(*impl_, descs, out);
+}
+
+void VulkanDevice::destroy_pipelines(std::span<PipelineHandle const> handles) noexcept {
+    auto& ctx = impl_->pipelines;
+
+    std::vector<VkPipeline> garbage;
+    {
+        std::unique_lock pool_lock{ctx.pool_mutex};
+        std::lock_guard  lock{ctx.mutex};
+        for (PipelineHandle h : handles) {
+            if (auto row = ctx.pool.extract(h))
+                drop_handle(ctx, std::get<0>(*row), garbage);
+        }
+    }
+    retire_pipelines(*impl_, garbage);
+}
+
+auto VulkanDevice::pipeline_status(PipelineHandle handle) const noexcept -> PipelineStatus {
+    auto const& ctx = impl_->pipelines;
+    std::shared_lock lock{ctx.pool_mutex};
+    auto const* record = ctx.pool.get<0>(handle);
+    if (!record) return PipelineStatus::Failed;
+    switch ((*record)->state.load(std::memory_order_acquire)) {
+        case PipelineState::Queued:
+        case PipelineState::Compiling: return PipelineStatus::Pending;
+        case PipelineState::Ready:     return PipelineStatus::Ready;
+        case PipelineState::Failed:    break;
+    }
+    return PipelineStatus::Failed;
+}
+
+void VulkanDevice::prioritize_pipelines(std::span<PipelineHandle const> handles) noexcept {
+    // Last handle first, so the first handle ends up at the very front.
+    try {
+        for (auto it = handles.rbegin(); it != handles.rend(); ++it) {
+            if (auto record = find_record(impl_->pipelines, *it))
+                promote(impl_->pipelines, record);
+        }
+    } catch (std::bad_alloc const&) {
+        // Priorities are a hint; the pipelines still compile in order.
+    }
+}
+
+auto VulkanDevice::wait_pipelines(std::span<PipelineHandle const> handles) noexcept -> Status {
+    bool failed = false;
+    for (PipelineHandle h : handles) {
+        auto record = find_record(impl_->pipelines, h);
+        if (!record) {
+            failed = true;
+            continue;
+        }
+        ensure_built(*impl_, record);
+        failed |= record->state.load(std::memory_order_acquire) != PipelineState::Ready;
+    }
+    return failed ? Status::InternalError : Status::Ok;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Recording
+// -------------------------------------------------------------------------------------------------
+void cmd_bind_pipeline(CommandListState& list, PipelineHandle pipeline) noexcept {
+    assert(list.recording);
+    auto& impl = *list.device;
+    auto& ctx  = impl.pipelines;
+
+    PipelineRecord* record = nullptr;
+    {
+        std::shared_lock lock{ctx.pool_mutex};
+        if (auto const* r = ctx.pool.get<0>(pipeline)) record = r->get();
+    }
+    assert(record && "pipeline is null or stale");
+    if (!record) return;
+
+    // Slow path: the pipeline is still compiling. Draw with its fallback if
+    // that is ready and pull the pipeline forward; otherwise build or wait.
+    PipelineRecord* bound = record;
+    if (record->state.load(std::memory_order_acquire) != PipelineState::Ready) {
+        auto const owner    = find_record(ctx, pipeline);
+        auto const fallback = find_record(ctx, record->fallback);
+        if (fallback && fallback->state.load(std::memory_order_acquire) == PipelineState::Ready) {
+            try {
+                if (owner) promote(ctx, owner);
+            } catch (std::bad_alloc const&) {
+                // Only the priority is lost; the fallback still draws.
+            }
+            bound = fallback.get();
+        } else if (owner) {
+            ensure_built(impl, owner);
+        }
+    }
+
+    VkPipeline const vk_pipeline = bound->pipeline.load(std::memory_order_acquire);
+    assert(vk_pipeline && "pipeline failed to compile and has no ready fallback");
+    if (!vk_pipeline) return;
+    list.dispatch->vkCmdBindPipeline(list.cmd, bound->bind_point, vk_pipeline);
+}
+
+void cmd_push_constants(CommandListState& list, uint32_t offset, uint32_t size, void const* data) noexcept {
+    assert(list.recording);
+    bool const valid = data && size > 0 && offset % 4 == 0 && size % 4 == 0 &&
+                       size <= k_max_push_constant_bytes && offset <= k_max_push_constant_bytes - size;
+    assert(valid && "push constants must be 4-byte aligned and within k_max_push_constant_bytes");
+    if (!valid) return;
+    list.dispatch->vkCmdPushConstants(list.cmd, list.device->pipelines.layout, VK_SHADER_STAGE_ALL,
+                                      offset, size, data);
+}
+
+} // namespace wren::rhi::vulkan
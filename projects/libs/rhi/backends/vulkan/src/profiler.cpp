@@ -0,0 +1,358 @@
+#include <wren/rhi/vulkan/device.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/foundation/system/platform.hpp>
+
+#ifdef WREN_PLATFORM_WINDOWS
+#  define WIN32_LEAN_AND_MEAN
+#  define NOMINMAX
+#  include <windows.h>
+#endif
+
+#include "vk_commands.hpp"
+#include "vk_device_impl.hpp"
+#include "vk_profiler.hpp"
+
+namespace wren::rhi::vulkan {
+
+namespace {
+
+// Counters of a statistics query, in the order Vulkan writes them (bit
+// order), which is also the field order of PipelineStatistics.
+constexpr VkQueryPipelineStatisticFlags k_statistics =
+    VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
+constexpr uint32_t k_statistic_count = 7;
+
+static_assert(sizeof(PipelineStatistics) == k_statistic_count * sizeof(uint64_t),
+              "PipelineStatistics is copied from the query results as-is");
+
+// Result layouts with VK_QUERY_RESULT_WITH_AVAILABILITY_BIT: the values,
+// then one availability word.
+constexpr uint32_t k_timestamp_words  = 2;
+constexpr uint32_t k_statistics_words = k_statistic_count + 1;
+
+[[nodiscard]] constexpr uint64_t valid_bits_mask(uint32_t bits) noexcept {
+    return bits >= 64 ? ~uint64_t{0} : (uint64_t{1} << bits) - 1;
+}
+
+/// Signed tick distance from @p from to @p to on a counter that wraps at
+/// @p mask.
+[[nodiscard]] int64_t tick_delta(uint64_t to, uint64_t from, uint64_t mask) noexcept {
+    uint64_t const delta = (to - from) & mask;
+    if (mask == ~uint64_t{0})
+        return static_cast<int64_t>(delta);
+    return delta > (mask >> 1) ? static_cast<int64_t>(delta) - static_cast<int64_t>(mask) - 1
+                               : static_cast<int64_t>(delta);
+}
+
+[[nodiscard]] uint64_t offset_ns(uint64_t base_ns, double delta_ns) noexcept {
+    double const t = static_cast<double>(base_ns) + delta_ns;
+    return t > 0.0 ? static_cast<uint64_t>(t) : 0;
+}
+
+// -----------------------------------------------------------------
+// Calibration
+//
+// One device / host timestamp pair per read-back maps every region of the
+// frame onto the host clock. The slot's regions are at most a few frames
+// old, so drift between the two clocks does not matter.
+// -----------------------------------------------------------------
+struct Calibration {
+    uint64_t device_ticks = 0;
+    uint64_t host_ns      = 0;
+    bool     valid        = false;
+};
+
+[[nodiscard]] Calibration calibrate(VulkanDevice::Impl const& impl) noexcept {
+    auto const& prof = impl.profiler;
+    auto const* d    = impl.device.getDispatcher();
+    if (!prof.calibrated || !d->vkGetCalibratedTimestampsEXT)
+        return {};
+
+    VkCalibratedTimestampInfoEXT const infos[2] = {
+        {VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT, nullptr, VK_TIME_DOMAIN_DEVICE_EXT},
+        {VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT, nullptr, k_host_time_domain},
+    };
+    uint64_t stamps[2]{};
+    uint64_t max_deviation = 0;
+    if (d->vkGetCalibratedTimestampsEXT(static_cast<VkDevice>(*impl.device), 2, infos, stamps,
+                                        &max_deviation) != VK_SUCCESS)
+        return {};
+
+    // Both host domains tick in integers; QPC at its own frequency.
+    uint64_t const per_second = prof.host_ticks_per_second;
+    uint64_t const host_ns    = per_second == 1'000'000'000
+        ? stamps[1]
+        : stamps[1] / per_second * 1'000'000'000 + stamps[1] % per_second * 1'000'000'000 / per_second;
+    return {stamps[0], host_ns, true};
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Setup & teardown
+// -------------------------------------------------------------------------------------------------
+void init_profiler(VulkanDevice::Impl& impl) {
+    auto&       prof = impl.profiler;
+    auto const& caps = impl.capabilities;
+    if (!has_any(caps.features, Feature::TimestampQueries))
+        return;
+
+    prof.statistics = has_any(caps.features, Feature::PipelineStatistics);
+    prof.calibrated = has_any(caps.features, Feature::CalibratedTimestamps);
+    prof.period_ns  = static_cast<double>(caps.limits.timestampPeriod);
+
+#ifdef WREN_PLATFORM_WINDOWS
+    LARGE_INTEGER frequency{};
+    QueryPerformanceFrequency(&frequency);
+    prof.host_ticks_per_second = static_cast<uint64_t>(frequency.QuadPart);
+#endif
+
+    auto const& families = impl.adapter->queue_families;
+    for (uint32_t s = 0; s < k_queue_slot_count; ++s)
+        prof.timestamp_mask[s] = valid_bits_mask(families[impl.commands.families[s]].timestampValidBits);
+
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    for (uint32_t i = 0; i < impl.commands.frames_in_flight; ++i) {
+        auto& slot = prof.slots[i];
+        slot.records = std::make_unique<ProfileRecord[]>(k_max_profile_regions);
+
+        slot.timestamps = static_cast<VkQueryPool>(vk::raii::QueryPool{impl.device,
+            vk::QueryPoolCreateInfo{}
+                .setQueryType(vk::QueryType::eTimestamp)
+                .setQueryCount(2 * k_max_profile_regions)}.release());
+        d->vkResetQueryPool(dev, slot.timestamps, 0, 2 * k_max_profile_regions);
+
+        if (prof.statistics) {
+            slot.statistics = static_cast<VkQueryPool>(vk::raii::QueryPool{impl.device,
+                vk::QueryPoolCreateInfo{}
+                    .setQueryType(vk::QueryType::ePipelineStatistics)
+                    .setQueryCount(k_max_profile_statistics_regions)
+                    .setPipelineStatistics(vk::QueryPipelineStatisticFlags{k_statistics})}.release());
+            d->vkResetQueryPool(dev, slot.statistics, 0, k_max_profile_statistics_regions);
+        }
+    }
+
+    prof.resolved.reserve(k_max_profile_regions);
+    prof.resolved_names.resize(k_max_profile_regions);
+    prof.timestamp_scratch.resize(2 * k_max_profile_regions * k_timestamp_words);
+    prof.statistics_scratch.resize(k_max_profile_statistics_regions * k_statistics_words);
+    prof.enabled = true;
+}
+
+void release_profiler(VulkanDevice::Impl& impl) noexcept {
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+    for (auto& slot : impl.profiler.slots) {
+        d->vkDestroyQueryPool(dev, slot.timestamps, nullptr);
+        d->vkDestroyQueryPool(dev, slot.statistics, nullptr);
+        slot.timestamps = VK_NULL_HANDLE;
+        slot.statistics = VK_NULL_HANDLE;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Read-back
+// -------------------------------------------------------------------------------------------------
+void recycle_profile_slot(VulkanDevice::Impl& impl, uint32_t slot_index, uint64_t frame_number) noexcept {
+    auto& prof = impl.profiler;
+    if (!prof.enabled)
+        return;
+
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+    auto&     slot = prof.slots[slot_index];
+
+    uint32_t const issued  = slot.regions.load(std::memory_order_relaxed);
+    uint32_t const count   = std::min(issued, k_max_profile_regions);
+    uint32_t const queries = std::min(slot.statistics_used.load(std::memory_order_relaxed),
+                                      k_max_profile_statistics_regions);
+
+    if (slot.frame_number != 0) {
+        prof.resolved.clear();
+        prof.resolved_frame   = slot.frame_number;
+        prof.resolved_dropped = issued - count + slot.untimed.load(std::memory_order_relaxed);
+
+        // No wait flag: the slot has retired, and regions of lists that were
+        // never submitted stay unavailable (VK_NOT_READY) and are dropped.
+        if (count > 0) {
+            (void)d->vkGetQueryPoolResults(dev, slot.timestamps, 0, 2 * count,
+                                           2 * count * k_timestamp_words * sizeof(uint64_t),
+                                           prof.timestamp_scratch.data(),
+                                           k_timestamp_words * sizeof(uint64_t),
+                                           VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+        }
+        if (queries > 0) {
+            (void)d->vkGetQueryPoolResults(dev, slot.statistics, 0, queries,
+                                           queries * k_statistics_words * sizeof(uint64_t),
+                                           prof.statistics_scratch.data(),
+                                           k_statistics_words * sizeof(uint64_t),
+                                           VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+        }
+
+        Calibration const cal = count > 0 ? calibrate(impl) : Calibration{};
+        for (uint32_t i = 0; i < count; ++i) {
+            ProfileRecord const& rec   = slot.records[i];
+            uint64_t const*      begin = &prof.timestamp_scratch[(2 * i) * k_timestamp_words];
+            uint64_t const*      end   = begin + k_timestamp_words;
+            if (begin[1] == 0 || end[1] == 0) {
+                ++prof.resolved_dropped;
+                continue;
+            }
+
+            uint64_t const mask  = prof.timestamp_mask[queue_slot(rec.queue)];
+            double const   ticks = static_cast<double>(tick_delta(end[0], begin[0], mask));
+
+            auto& name = prof.resolved_names[prof.resolved.size()];
+            std::memcpy(name.data(), rec.name, name.size());
+
+            ProfileRegion region{
+                .name       = name.data(),
+                .queue      = rec.queue,
+                .depth      = rec.depth,
+                .gpuBeginNs = static_cast<uint64_t>(static_cast<double>(begin[0] & mask) * prof.period_ns),
+            };
+            region.gpuEndNs = region.gpuBeginNs + static_cast<uint64_t>(std::max(ticks, 0.0) * prof.period_ns);
+
+            if (cal.valid) {
+                double const from_cal = static_cast<double>(tick_delta(begin[0], cal.device_ticks, mask));
+                region.cpuBeginNs = offset_ns(cal.host_ns, from_cal * prof.period_ns);
+                region.cpuEndNs   = region.cpuBeginNs + (region.gpuEndNs - region.gpuBeginNs);
+            }
+
+            if (rec.statistics < queries) {
+                uint64_t const* stats = &prof.statistics_scratch[rec.statistics * k_statistics_words];
+                if (stats[k_statistic_count] != 0) {
+                    region.hasStatistics = true;
+                    std::memcpy(&region.statistics, stats, sizeof(PipelineStatistics));
+                }
+            }
+            prof.resolved.push_back(region);
+        }
+
+        // Names stay with their records; sorting only moves the pointers.
+        std::ranges::sort(prof.resolved, [](ProfileRegion const& a, ProfileRegion const& b) {
+            if (a.queue != b.queue)
+                return queue_slot(a.queue) < queue_slot(b.queue);
+            return a.gpuBeginNs < b.gpuBeginNs;
+        });
+    }
+
+    // Host reset (Vulkan 1.2 hostQueryReset) of the queries the slot used,
+    // so recording never has to reset them in a list.
+    if (count > 0)
+        d->vkResetQueryPool(dev, slot.timestamps, 0, 2 * count);
+    if (queries > 0)
+        d->vkResetQueryPool(dev, slot.statistics, 0, queries);
+
+    slot.regions.store(0, std::memory_order_relaxed);
+    slot.statistics_used.store(0, std::memory_order_relaxed);
+    slot.untimed.store(0, std::memory_order_relaxed);
+    slot.frame_number = frame_number;
+}
+
+void VulkanDevice::profile_frame(ProfileFrame& out) const noexcept {
+    auto const& prof = impl_->profiler;
+    out = ProfileFrame{
+        .frameNumber    = prof.resolved_frame,
+        .regions        = prof.resolved.data(),
+        .regionCount    = static_cast<uint32_t>(prof.resolved.size()),
+        .droppedRegions = prof.resolved_dropped,
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+// Recording
+// -------------------------------------------------------------------------------------------------
+void cmd_begin_profile_region(CommandListState& list, ProfileRegionDesc const& desc) noexcept {
+    assert(list.recording && desc.name && "profiling region without a name");
+    uint32_t const level = list.profile_depth++;
+    if (level >= k_max_profile_region_depth)
+        return;
+
+    // Resolved only when VK_EXT_debug_utils is enabled on the instance.
+    auto const* d = list.dispatch;
+    if (d->vkCmdBeginDebugUtilsLabelEXT) {
+        VkDebugUtilsLabelEXT const label{
+            .sType      = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT,
+            .pNext      = nullptr,
+            .pLabelName = desc.name,
+            .color      = {},
+        };
+        d->vkCmdBeginDebugUtilsLabelEXT(list.cmd, &label);
+    }
+
+    list.profile_regions[level] = UINT32_MAX;
+    auto& prof = list.device->profiler;
+    if (!prof.enabled)
+        return;
+
+    auto& slot = prof.slots[list.device->commands.frame_slot];
+    if (prof.timestamp_mask[queue_slot(list.queue)] == 0) {
+        slot.untimed.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    uint32_t const index = slot.regions.fetch_add(1, std::memory_order_relaxed);
+    if (index >= k_max_profile_regions)
+        return;
+
+    ProfileRecord& rec = slot.records[index];
+    std::strncpy(rec.name, desc.name, k_max_profile_region_name - 1);
+    rec.name[k_max_profile_region_name - 1] = '\0';
+    rec.queue      = list.queue;
+    rec.depth      = level;
+    rec.statistics = UINT32_MAX;
+
+    d->vkCmdWriteTimestamp2(list.cmd, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT, slot.timestamps, 2 * index);
+
+    // Statistics queries cannot nest, and graphics counters need a
+    // graphics queue.
+    if (desc.pipelineStatistics && prof.statistics && list.profile_statistics_level == UINT32_MAX &&
+        list.level == CommandListLevel::Primary && queue_slot(list.queue) == 0) {
+        uint32_t const query = slot.statistics_used.fetch_add(1, std::memory_order_relaxed);
+        if (query < k_max_profile_statistics_regions) {
+            rec.statistics = query;
+            d->vkCmdBeginQuery(list.cmd, slot.statistics, query, 0);
+            list.profile_statistics_level = level;
+        }
+    }
+    list.profile_regions[level] = index;
+}
+
+void cmd_end_profile_region(CommandListState& list) noexcept {
+    assert(list.profile_depth > 0 && "cmd_end_profile_region without a matching begin");
+    if (list.profile_depth == 0)
+        return;
+    uint32_t const level = --list.profile_depth;
+    if (level >= k_max_profile_region_depth)
+        return;
+
+    auto const*    d     = list.dispatch;
+    uint32_t const index = list.profile_regions[level];
+    if (index != UINT32_MAX) {
+        auto& slot = list.device->profiler.slots[list.device->commands.frame_slot];
+        if (list.profile_statistics_level == level) {
+            d->vkCmdEndQuery(list.cmd, slot.statistics, slot.records[index].statistics);
+            list.profile_statistics_level = UINT32_MAX;
+        }
+        d->vkCmdWriteTimestamp2(list.cmd, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, slot.timestamps,
+                                2 * index + 1);
+    }
+    if (d->vkCmdEndDebugUtilsLabelEXT)
+        d->vkCmdEndDebugUtilsLabelEXT(list.cmd);
+}
+
+} // namespace wren::rhi::vulkan
@@ -0,0 +1,1066 @@
+#include <wren/rhi/vulkan/device.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <expected>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <vulkan/vulkan_raii.hpp>
+
+#include "vk_bindless.hpp"
+#include "vk_convert.hpp"
+#include "vk_device_impl.hpp"
+#include "vk_memory.hpp"
+
+namespace wren::rhi::vulkan {
+
+namespace {
+
+// Attachments at least this large get their own VkDeviceMemory: render
+// targets are long-lived, and keeping them out of the blocks stops a resize
+// from fragmenting them.
+constexpr uint64_t k_dedicated_attachment_size = 8ull << 20;
+
+// -----------------------------------------------------------------
+// Error mapping
+// -----------------------------------------------------------------
+[[nodiscard]] Status to_status(vk::SystemError const& err) noexcept {
+    return detail::to_status(static_cast<vk::Result>(err.code().value()));
+}
+
+[[nodiscard]] bool wants_device_address(VulkanDevice::Impl const& impl) noexcept {
+    return has_any(impl.capabilities.features, Feature::BufferDeviceAddress);
+}
+
+// -----------------------------------------------------------------
+// Raw object teardown
+//
+// Pool rows hold plain Vulkan handles (the raii wrappers would add two
+// pointers per column entry), so they are released through the device
+// dispatcher directly.
+// -----------------------------------------------------------------
+void release_buffer(VulkanDevice::Impl& impl, BufferRow const& row) noexcept {
+    release_bindless_buffer(impl, std::get<3>(row));
+    impl.device.getDispatcher()->vkDestroyBuffer(static_cast<VkDevice>(*impl.device),
+                                                 static_cast<VkBuffer>(std::get<0>(row)), nullptr);
+    free_memory(impl, std::get<2>(row));
+}
+
+void release_texture(VulkanDevice::Impl& impl, TextureRow const& row) noexcept {
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+    release_bindless_texture(impl, std::get<3>(row));
+    d->vkDestroyImageView(dev, static_cast<VkImageView>(std::get<1>(row)), nullptr);
+    // Rows without memory are swapchain images (swapchain.cpp), which the
+    // swapchain owns, or sparse textures, whose pages belong to heaps.
+    if (!std::get<2>(row).memory && !std::get<4>(row).sparse)
+        return;
+    d->vkDestroyImage(dev, static_cast<VkImage>(std::get<0>(row)), nullptr);
+    free_memory(impl, std::get<2>(row));
+}
+
+void release_heap(VulkanDevice::Impl& impl, HeapRow const& row) noexcept {
+    free_memory(impl, std::get<0>(row));
+}
+
+void release_acceleration_structure(VulkanDevice::Impl& impl, AccelerationStructureRow const& row) noexcept {
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+    d->vkDestroyAccelerationStructureKHR(dev, static_cast<VkAccelerationStructureKHR>(std::get<0>(row)), nullptr);
+    d->vkDestroyBuffer(dev, static_cast<VkBuffer>(std::get<2>(row)), nullptr);
+    free_memory(impl, std::get<3>(row));
+}
+
+/// Destroys what @p object holds, the way its destroy_* entry point would.
+void release_object(VulkanDevice::Impl& impl, DeferredObject const& object) noexcept {
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+    if (auto const* buffer = std::get_if<BufferRow>(&object))
+        release_buffer(impl, *buffer);
+    else if (auto const* texture = std::get_if<TextureRow>(&object))
+        release_texture(impl, *texture);
+    else if (auto const* heap = std::get_if<HeapRow>(&object))
+        release_heap(impl, *heap);
+    else if (auto const* structure = std::get_if<AccelerationStructureRow>(&object))
+        release_acceleration_structure(impl, *structure);
+    else if (auto const* pipeline = std::get_if<vk::Pipeline>(&object))
+        d->vkDestroyPipeline(dev, static_cast<VkPipeline>(*pipeline), nullptr);
+    else if (auto const* semaphore = std::get_if<vk::Semaphore>(&object))
+        d->vkDestroySemaphore(dev, static_cast<VkSemaphore>(*semaphore), nullptr);
+    else if (auto const* swapchain = std::get_if<vk::SwapchainKHR>(&object))
+        d->vkDestroySwapchainKHR(dev, static_cast<VkSwapchainKHR>(*swapchain), nullptr);
+}
+
+/// Moves everything pushed since the last call onto the pending list, in
+/// release order, then destroys the pending nodes whose values completed[]
+/// has reached on every queue.
+void reclaim_deferred(VulkanDevice::Impl& impl,
+                      std::span<uint64_t const, k_queue_slot_count> completed) noexcept
+{
+    auto& ctx = impl.deferred;
+
+    // The stack hands the newest node out first; reversing it makes the
+    // first node taken the new tail.
+    DeferredNode* incoming = ctx.incoming.exchange(nullptr, std::memory_order_acquire);
+    if (incoming) {
+        DeferredNode* const tail   = incoming;
+        DeferredNode*       oldest = nullptr;
+        while (incoming) {
+            DeferredNode* const next = incoming->next;
+            incoming->next = oldest;
+            oldest         = incoming;
+            incoming       = next;
+        }
+        if (ctx.pending_tail)
+            ctx.pending_tail->next = oldest;
+        else
+            ctx.pending_head = oldest;
+        ctx.pending_tail = tail;
+    }
+
+    DeferredNode** link = &ctx.pending_head;
+    DeferredNode*  last = nullptr;
+    while (DeferredNode* const node = *link) {
+        bool retired = true;
+        for (uint32_t s = 0; s < k_queue_slot_count; ++s)
+            retired = retired && node->values[s] <= completed[s];
+        if (!retired) {
+            last = node;
+            link = &node->next;
+            continue;
+        }
+        *link = node->next;
+        release_object(impl, node->object);
+        delete node;
+    }
+    ctx.pending_tail = last;
+}
+
+// -----------------------------------------------------------------
+// Single-object creation. Throws vk::SystemError on API failure; the raii
+// temporaries roll back partially created objects.
+// -----------------------------------------------------------------
+/// Creates the VkBuffer for @p desc. GPU-only buffers can always be copied
+/// so defragment_memory() can move them.
+[[nodiscard]] vk::raii::Buffer make_vk_buffer(VulkanDevice::Impl const& impl, BufferDesc const& desc) {
+    vk::BufferUsageFlags usage = detail::to_vk(desc.usage);
+    if (wants_device_address(impl))
+        usage |= vk::BufferUsageFlagBits::eShaderDeviceAddress;
+    if (desc.memory == MemoryUsage::GpuOnly)
+        usage |= vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst;
+
+    return impl.device.createBuffer(
+        vk::BufferCreateInfo{}
+            .setSize(desc.size)
+            .setUsage(usage)
+            .setSharingMode(vk::SharingMode::eExclusive));
+}
+
+/// Allocates and binds memory for @p buffer. The caller owns the returned
+/// allocation; on failure nothing is left allocated.
+[[nodiscard]] auto bind_buffer_memory(VulkanDevice::Impl& impl, vk::raii::Buffer const& buffer,
+                                      MemoryUsage usage) -> std::expected<MemoryAllocation, Status>
+{
+    auto const chain = impl.device.getBufferMemoryRequirements2<vk::MemoryRequirements2,
+                                                                vk::MemoryDedicatedRequirements>(
+        vk::BufferMemoryRequirementsInfo2{}.setBuffer(*buffer));
+    auto const& dedicated = chain.get<vk::MemoryDedicatedRequirements>();
+
+    auto alloc = allocate_memory(impl, MemoryRequest{
+        .requirements     = chain.get<vk::MemoryRequirements2>().memoryRequirements,
+        .usage            = usage,
+        .tiling           = ResourceTiling::Linear,
+        .dedicated        = dedicated.prefersDedicatedAllocation || dedicated.requiresDedicatedAllocation,
+        .dedicated_buffer = *buffer,
+    });
+    if (!alloc)
+        return alloc;
+
+    try {
+        buffer.bindMemory(alloc->memory, alloc->offset);
+    } catch (...) {
+        free_memory(impl, *alloc);
+        throw;
+    }
+    return alloc;
+}
+
+// -----------------------------------------------------------------
+// Single-object creation. Throws vk::SystemError on API failure; the raii
+// temporaries roll back partially created objects.
+// -----------------------------------------------------------------
+[[nodiscard]] auto make_buffer(VulkanDevice::Impl& impl, BufferDesc const& desc)
+    -> std::expected<BufferRow, Status>
+{
+    if (desc.size == 0 || desc.usage == BufferUsage::None)
+        return std::unexpected{Status::InvalidArgument};
+
+    vk::raii::Buffer buffer = make_vk_buffer(impl, desc);
+    auto const alloc = bind_buffer_memory(impl, buffer, desc.memory);
+    if (!alloc)
+        return std::unexpected{alloc.error()};
+
+    void* mapped = desc.memory != MemoryUsage::GpuOnly ? alloc->mapped : nullptr;
+
+    std::expected<uint32_t, Status> slot = k_invalid_bindless_index;
+    if (underlying(desc.usage & BufferUsage::Storage) != 0)
+        slot = acquire_bindless_buffer(impl, *buffer, desc.size);
+    if (!slot) {
+        free_memory(impl, *alloc);
+        return std::unexpected{slot.error()};
+    }
+
+    set_debug_name(impl, vk::ObjectType::eBuffer,
+                   reinterpret_cast<uint64_t>(static_cast<VkBuffer>(*buffer)), desc.debugName);
+
+    BufferDesc stored = desc;
+    stored.debugName  = nullptr; // caller-owned; never dereferenced after creation
+    return BufferRow{buffer.release(), mapped, *alloc, *slot, stored};
+}
+
+[[nodiscard]] Status validate(TextureDesc const& desc, DeviceLimits const& limits) noexcept {
+    if (desc.width == 0 || desc.height == 0 || desc.depth == 0 ||
+        desc.mipLevels == 0 || desc.arrayLayers == 0 || desc.usage == TextureUsage::None)
+        return Status::InvalidArgument;
+
+    uint32_t max_dim = 0;
+    switch (desc.dimension) {
+        case TextureDimension::Tex1D:
+            if (desc.height != 1 || desc.depth != 1) return Status::InvalidArgument;
+            max_dim = limits.maxImageDimension1D;
+            break;
+        case TextureDimension::Tex2D:
+            if (desc.depth != 1) return Status::InvalidArgument;
+            max_dim = limits.maxImageDimension2D;
+            break;
+        case TextureDimension::Tex3D:
+            if (desc.arrayLayers != 1) return Status::InvalidArgument;
+            max_dim = limits.maxImageDimension3D;
+            break;
+        case TextureDimension::Cube:
+            if (desc.width != desc.height || desc.depth != 1 || desc.arrayLayers % 6 != 0)
+                return Status::InvalidArgument;
+            max_dim = limits.maxCubeDimension;
+            break;
+    }
+
+    uint32_t const largest = std::max({desc.width, desc.height, desc.depth});
+    if (largest > max_dim || desc.arrayLayers > limits.maxArrayLayers)
+        return Status::UnsupportedLimit;
+    if (desc.mipLevels > static_cast<uint32_t>(std::bit_width(largest)))
+        return Status::InvalidArgument;
+
+    if (desc.samples != SampleCount::C1) {
+        if (desc.dimension != TextureDimension::Tex2D || desc.mipLevels != 1)
+            return Status::InvalidArgument;
+        if (static_cast<uint32_t>(desc.samples) > limits.maxMSAASamples)
+            return Status::UnsupportedSampleCount;
+    }
+
+    return Status::Ok;
+}
+
+/// Validated VkImageCreateInfo for @p desc, shared by creation and the
+/// memory requirements query. Throws FormatNotSupportedError for
+/// unsupported format/usage combinations.
+[[nodiscard]] auto image_info(VulkanDevice::Impl const& impl, TextureDesc const& desc)
+    -> std::expected<vk::ImageCreateInfo, Status>
+{
+    if (Status s = validate(desc, impl.capabilities.limits); s != Status::Ok)
+        return std::unexpected{s};
+
+    vk::Format const          format  = detail::to_vk(desc.format);
+    vk::ImageType const       type    = detail::to_vk(desc.dimension);
+    vk::ImageUsageFlags const usage   = detail::to_vk(desc.usage);
+    vk::ImageCreateFlags      flags   = desc.dimension == TextureDimension::Cube
+                                      ? vk::ImageCreateFlagBits::eCubeCompatible
+                                      : vk::ImageCreateFlags{};
+
+    // Sparse textures page single-sample 2D colour images only
+    // (sparseResidencyImage2D); sparse.cpp binds their pages.
+    if (desc.sparse) {
+        if (!has_any(impl.capabilities.features, Feature::SparseResources))
+            return std::unexpected{Status::MissingRequiredFeature};
+        if (desc.dimension != TextureDimension::Tex2D || desc.samples != SampleCount::C1 || desc.heap ||
+            detail::is_depth_format(desc.format))
+            return std::unexpected{Status::InvalidArgument};
+        if (impl.phys_device.getSparseImageFormatProperties(format, type, vk::SampleCountFlagBits::e1,
+                                                            usage, vk::ImageTiling::eOptimal).empty())
+            return std::unexpected{Status::UnsupportedFormat};
+        flags |= vk::ImageCreateFlagBits::eSparseBinding | vk::ImageCreateFlagBits::eSparseResidency;
+    }
+
+    auto const fmt_props = impl.phys_device.getImageFormatProperties(
+        format, type, vk::ImageTiling::eOptimal, usage, flags);
+    if (!(fmt_props.sampleCounts & detail::to_vk(desc.samples)))
+        return std::unexpected{Status::UnsupportedSampleCount};
+
+    return vk::ImageCreateInfo{}
+        .setFlags(flags)
+        .setImageType(type)
+        .setFormat(format)
+        .setExtent({desc.width, desc.height, desc.depth})
+        .setMipLevels(desc.mipLevels)
+        .setArrayLayers(desc.arrayLayers)
+        .setSamples(detail::to_vk(desc.samples))
+        .setTiling(vk::ImageTiling::eOptimal)
+        .setUsage(usage)
+        .setSharingMode(vk::SharingMode::eExclusive)
+        .setInitialLayout(vk::ImageLayout::eUndefined);
+}
+
+/// Placed allocation at desc.heapOffset inside desc.heap. InvalidArgument
+/// when the heap is stale, of an incompatible memory type or too small, or
+/// the offset is misaligned.
+[[nodiscard]] auto place_in_heap(VulkanDevice::Impl const& impl, TextureDesc const& desc,
+                                 vk::MemoryRequirements const& reqs) noexcept
+    -> std::expected<MemoryAllocation, Status>
+{
+    std::shared_lock lock{impl.heaps_mutex};
+    auto const* heap = impl.heaps.get<0>(desc.heap);
+    if (!heap || !(reqs.memoryTypeBits & (1u << heap->type)) || desc.heapOffset % reqs.alignment != 0 ||
+        desc.heapOffset > heap->size || reqs.size > heap->size - desc.heapOffset)
+        return std::unexpected{Status::InvalidArgument};
+
+    return MemoryAllocation{
+        .memory = heap->memory,
+        .offset = heap->offset + desc.heapOffset,
+        .size   = reqs.size,
+        .type   = heap->type,
+        .placed = true,
+    };
+}
+
+[[nodiscard]] auto make_texture(VulkanDevice::Impl& impl, TextureDesc const& desc)
+    -> std::expected<TextureRow, Status>
+{
+    auto const info = image_info(impl, desc);
+    if (!info)
+        return std::unexpected{info.error()};
+
+    vk::raii::Image image = impl.device.createImage(*info);
+
+    auto const chain = impl.device.getImageMemoryRequirements2<vk::MemoryRequirements2,
+                                                               vk::MemoryDedicatedRequirements>(
+        vk::ImageMemoryRequirementsInfo2{}.setImage(*image));
+    auto const& reqs      = chain.get<vk::MemoryRequirements2>().memoryRequirements;
+    auto const& dedicated = chain.get<vk::MemoryDedicatedRequirements>();
+    bool const attachment = underlying(desc.usage & (TextureUsage::ColorAttachment |
+                                                     TextureUsage::DepthStencilAtt)) != 0;
+
+    // Placed textures ignore the dedicated preference; drivers only require
+    // dedicated memory for external and similar special images. Sparse
+    // textures start with no memory at all.
+    auto const alloc = desc.sparse ? std::expected<MemoryAllocation, Status>{}
+                     : desc.heap   ? place_in_heap(impl, desc, reqs)
+                     : allocate_memory(impl, MemoryRequest{
+        .requirements    = reqs,
+        .usage           = MemoryUsage::GpuOnly,
+        .tiling          = ResourceTiling::Optimal,
+        .dedicated       = dedicated.prefersDedicatedAllocation || dedicated.requiresDedicatedAllocation ||
+                           (attachment && reqs.size >= k_dedicated_attachment_size),
+        .dedicated_image = *image,
+    });
+    if (!alloc)
+        return std::unexpected{alloc.error()};
+
+    // A view that is sampled may only select one aspect of a depth/stencil
+    // image; attachment-only views keep both.
+    vk::ImageAspectFlags aspect = vk::ImageAspectFlagBits::eColor;
+    if (detail::is_depth_format(desc.format)) {
+        aspect = vk::ImageAspectFlagBits::eDepth;
+        bool const sampled = underlying(desc.usage & (TextureUsage::Sampled | TextureUsage::Storage)) != 0;
+        if (detail::has_stencil(desc.format) && !sampled)
+            aspect |= vk::ImageAspectFlagBits::eStencil;
+    }
+
+    vk::raii::ImageView view{nullptr};
+    try {
+        if (!desc.sparse)
+            image.bindMemory(alloc->memory, alloc->offset);
+        view = impl.device.createImageView(
+            vk::ImageViewCreateInfo{}
+                .setImage(*image)
+                .setViewType(detail::to_vk_view_type(desc.dimension, desc.arrayLayers))
+                .setFormat(info->format)
+                .setSubresourceRange(vk::ImageSubresourceRange{}
+                    .setAspectMask(aspect)
+                    .setBaseMipLevel(0)
+                    .setLevelCount(desc.mipLevels)
+                    .setBaseArrayLayer(0)
+                    .setLayerCount(desc.arrayLayers)));
+    } catch (...) {
+        free_memory(impl, *alloc);
+        throw;
+    }
+
+    auto const slots = acquire_bindless_texture(impl, *view, desc.usage);
+    if (!slots) {
+        free_memory(impl, *alloc);
+        return std::unexpected{slots.error()};
+    }
+
+    set_debug_name(impl, vk::ObjectType::eImage,
+                   reinterpret_cast<uint64_t>(static_cast<VkImage>(*image)), desc.debugName);
+
+    TextureDesc stored = desc;
+    stored.debugName   = nullptr;
+    return TextureRow{image.release(), view.release(), *alloc, *slots, stored};
+}
+
+/// One dedicated allocation of the requested size. Both handles of the
+/// dedicated-allocation info stay null, so the memory is not tied to a resource.
+[[nodiscard]] auto make_heap(VulkanDevice::Impl& impl, MemoryHeapDesc const& desc)
+    -> std::expected<HeapRow, Status>
+{
+    if (desc.size == 0 || desc.compatibility == 0)
+        return std::unexpected{Status::InvalidArgument};
+
+    auto const alloc = allocate_memory(impl, MemoryRequest{
+        .requirements = vk::MemoryRequirements{desc.size, 1, desc.compatibility},
+        .usage        = MemoryUsage::GpuOnly,
+        .tiling       = ResourceTiling::Optimal,
+        .dedicated    = true,
+    });
+    if (!alloc)
+        return std::unexpected{alloc.error()};
+
+    set_debug_name(impl, vk::ObjectType::eDeviceMemory,
+                   reinterpret_cast<uint64_t>(static_cast<VkDeviceMemory>(alloc->memory)), desc.debugName);
+
+    MemoryHeapDesc stored = desc;
+    stored.debugName      = nullptr;
+    return HeapRow{*alloc, stored};
+}
+
+/// The structure and the buffer it lives in. Upload structures are built
+/// by the host, which reads and writes their memory directly.
+[[nodiscard]] auto make_acceleration_structure(VulkanDevice::Impl& impl, AccelerationStructureDesc const& desc)
+    -> std::expected<AccelerationStructureRow, Status>
+{
+    if (!impl.raytracing.enabled)
+        return std::unexpected{Status::MissingRequiredFeature};
+    if (desc.size == 0 || desc.memory == MemoryUsage::Readback)
+        return std::unexpected{Status::InvalidArgument};
+    bool const host = desc.memory == MemoryUsage::Upload;
+    if (host && !impl.raytracing.host_build)
+        return std::unexpected{Status::MissingRequiredFeature};
+
+    vk::raii::Buffer buffer = impl.device.createBuffer(
+        vk::BufferCreateInfo{}
+            .setSize(desc.size)
+            .setUsage(vk::BufferUsageFlagBits::eAccelerationStructureStorageKHR |
+                      vk::BufferUsageFlagBits::eShaderDeviceAddress)
+            .setSharingMode(vk::SharingMode::eExclusive));
+    auto const alloc = bind_buffer_memory(impl, buffer, desc.memory);
+    if (!alloc)
+        return std::unexpected{alloc.error()};
+
+    vk::AccelerationStructureKHR structure;
+    uint64_t                     reference = 0;
+    try {
+        vk::raii::AccelerationStructureKHR created{impl.device,
+            vk::AccelerationStructureCreateInfoKHR{}
+                .setBuffer(*buffer)
+                .setOffset(0)
+                .setSize(desc.size)
+                .setType(desc.type == AccelerationStructureType::TopLevel
+                             ? vk::AccelerationStructureTypeKHR::eTopLevel
+                             : vk::AccelerationStructureTypeKHR::eBottomLevel)};
+        auto const handle = static_cast<VkAccelerationStructureKHR>(*created);
+        if (host) {
+            // Host-built TLASes name their instances by handle, not by address.
+            reference = reinterpret_cast<uint64_t>(handle);
+        } else {
+            VkAccelerationStructureDeviceAddressInfoKHR const info{
+                .sType                 = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR,
+                .pNext                 = nullptr,
+                .accelerationStructure = handle,
+            };
+            reference = impl.device.getDispatcher()->vkGetAccelerationStructureDeviceAddressKHR(
+                static_cast<VkDevice>(*impl.device), &info);
+        }
+        set_debug_name(impl, vk::ObjectType::eAccelerationStructureKHR,
+                       reinterpret_cast<uint64_t>(handle), desc.debugName);
+        structure = created.release();
+    } catch (...) {
+        free_memory(impl, *alloc);
+        throw;
+    }
+
+    AccelerationStructureDesc stored = desc;
+    stored.debugName = nullptr;
+    return AccelerationStructureRow{structure, reference, buffer.release(), *alloc, stored};
+}
+
+// -----------------------------------------------------------------
+// Batched creation
+//
+// Builds every Vulkan object first without holding the pool lock, then
+// publishes the whole batch under a single exclusive lock. Any failure
+// unwinds the batch so callers never see a partially created set.
+// -----------------------------------------------------------------
+template<typename Pool, typename Row, typename Desc, typename Handle, typename Make, typename Release>
+[[nodiscard]] Status create_batch(VulkanDevice::Impl&  impl,
+                                  Pool&                pool,
+                                  std::shared_mutex&   mutex,
+                                  std::span<Desc const> descs,
+                                  std::span<Handle>    out,
+                                  Make&&               make,
+                                  Release&&            release) noexcept
+{
+    std::ranges::fill(out.first(descs.size()), Handle{});
+
+    std::vector<Row> rows;
+    Status status = Status::Ok;
+    try {
+        rows.reserve(descs.size());
+        for (Desc const& desc : descs) {
+            auto row = make(impl, desc);
+            if (!row) {
+                status = row.error();
+                break;
+            }
+            rows.push_back(*row);
+        }
+    } catch (vk::SystemError const& err) {
+        SPDLOG_ERROR("[wren/rhi/vulkan] Resource creation failed: {}", err.what());
+        status = to_status(err);
+    } catch (std::bad_alloc const&) {
+        status = Status::OutOfMemory;
+    } catch (...) {
+        status = Status::InternalError;
+    }
+
+    if (status == Status::Ok) {
+        std::unique_lock lock{mutex};
+        std::size_t published = 0;
+        try {
+            for (; published < rows.size(); ++published) {
+                out[published] = std::apply([&pool](auto const&... col) { return pool.insert(col...); },
+                                            rows[published]);
+                if (!out[published]) break; // every slot is in use
+            }
+        } catch (std::bad_alloc const&) {}
+
+        if (published == rows.size())
+            return Status::Ok;
+
+        for (std::size_t i = 0; i < published; ++i) {
+            pool.erase(out[i]);
+            out[i] = Handle{};
+        }
+        status = Status::OutOfMemory;
+    }
+
+    for (Row const& row : rows)
+        release(impl, row);
+    return status;
+}
+
+// -----------------------------------------------------------------
+// Defragmentation
+//
+// One planned move of a GPU-only buffer into a denser block. The new buffer
+// and allocation are committed to the pool only once the copy completed.
+// -----------------------------------------------------------------
+struct BufferMove {
+    BufferHandle     handle;
+    vk::Buffer       new_buffer;
+    MemoryAllocation new_alloc;
+    uint64_t         size = 0;
+};
+
+void discard_moves(VulkanDevice::Impl& impl, std::span<BufferMove const> moves) noexcept {
+    auto const* d = impl.device.getDispatcher();
+    for (BufferMove const& m : moves) {
+        d->vkDestroyBuffer(static_cast<VkDevice>(*impl.device), static_cast<VkBuffer>(m.new_buffer), nullptr);
+        free_memory_locked(impl, m.new_alloc);
+    }
+}
+
+/// Plans moves for every buffer in blocks that can be emptied, sparsest
+/// block first. A block is only drained when all of its allocations are
+/// GPU-only buffers and all of them fit elsewhere; otherwise it is left as is.
+/// Caller holds buffers_mutex and MemoryContext::mutex exclusively.
+/// Throws vk::SystemError and std::bad_alloc; @p moves keeps what was planned.
+void plan_moves(VulkanDevice::Impl& impl, DefragmentDesc const& desc, std::vector<BufferMove>& moves) {
+    auto& ctx  = impl.memory;
+    auto& pool = impl.buffers;
+
+    // Movable buffers, grouped by block once sorted.
+    struct Candidate {
+        MemoryBlock const* block;
+        BufferHandle       handle;
+    };
+    std::vector<Candidate> candidates;
+    auto const handles = pool.handles();
+    auto const allocs  = pool.column<2>();
+    auto const descs   = pool.column<4>();
+    for (std::size_t i = 0; i < handles.size(); ++i) {
+        if (allocs[i].block && descs[i].memory == MemoryUsage::GpuOnly)
+            candidates.push_back({allocs[i].block, handles[i]});
+    }
+    std::ranges::sort(candidates, std::less{}, &Candidate::block);
+
+    uint64_t bytes = 0;
+    for (auto& type : ctx.types) {
+        if (type.blocks.size() < 2) continue;
+
+        std::vector<MemoryBlock*> order;
+        order.reserve(type.blocks.size());
+        for (auto const& b : type.blocks) order.push_back(b.get());
+        std::ranges::sort(order, std::less{}, [](MemoryBlock const* b) { return b->tlsf.used(); });
+
+        std::vector<MemoryBlock const*> targets;  // received moves; never drained
+        for (std::size_t src = 0; src + 1 < order.size(); ++src) {
+            MemoryBlock const& block = *order[src];
+            if (block.tlsf.empty() || std::ranges::find(targets, &block) != targets.end()) continue;
+
+            auto const [first, last] = std::ranges::equal_range(candidates, &block, std::less{}, &Candidate::block);
+            auto const count = static_cast<uint32_t>(last - first);
+            if (count != block.tlsf.allocation_count()) continue;  // holds textures or host-visible buffers
+            if (moves.size() + count > desc.maxAllocationsToMove || bytes + block.tlsf.used() > desc.maxBytesToMove)
+                break;
+
+            std::size_t const planned = moves.size();
+            for (auto it = first; it != last; ++it) {
+                BufferDesc const& bdesc = *pool.get<4>(it->handle);
+                vk::raii::Buffer buffer = make_vk_buffer(impl, bdesc);
+                auto const reqs = buffer.getMemoryRequirements();
+
+                std::optional<MemoryAllocation> alloc;
+                for (std::size_t dst = order.size(); dst-- > src + 1 && !alloc;) {
+                    if (ctx.granularity > 1 && order[dst]->tiling != ResourceTiling::Linear) continue;
+                    alloc = allocate_in_block(impl, *order[dst], reqs);
+                }
+                if (!alloc) break;
+
+                try {
+                    buffer.bindMemory(alloc->memory, alloc->offset);
+                    moves.push_back({it->handle, buffer.release(), *alloc, bdesc.size});
+                } catch (...) {
+                    free_memory_locked(impl, *alloc);
+                    throw;
+                }
+            }
+
+            if (moves.size() - planned != count) {
+                discard_moves(impl, std::span{moves}.subspan(planned));
+                moves.resize(planned);
+                continue;
+            }
+            bytes += block.tlsf.used();
+            for (std::size_t i = planned; i < moves.size(); ++i) {
+                if (std::ranges::find(targets, moves[i].new_alloc.block) == targets.end())
+                    targets.push_back(moves[i].new_alloc.block);
+            }
+        }
+    }
+}
+
+/// Records and runs the copies on the graphics queue, blocking until they
+/// are done. Throws vk::SystemError.
+void copy_moves(VulkanDevice::Impl& impl, std::span<BufferMove const> moves) {
+    auto& ctx = impl.commands;
+
+    vk::raii::CommandPool cmd_pool = impl.device.createCommandPool(
+        vk::CommandPoolCreateInfo{}
+            .setFlags(vk::CommandPoolCreateFlagBits::eTransient)
+            .setQueueFamilyIndex(ctx.families[queue_slot(QueueType::Graphics)]));
+    vk::raii::CommandBuffers cmds{impl.device, vk::CommandBufferAllocateInfo{}
+        .setCommandPool(*cmd_pool)
+        .setLevel(vk::CommandBufferLevel::ePrimary)
+        .setCommandBufferCount(1)};
+    vk::raii::CommandBuffer const& cmd = cmds.front();
+
+    cmd.begin(vk::CommandBufferBeginInfo{}.setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+    for (BufferMove const& m : moves) {
+        vk::Buffer const src = *impl.buffers.get<0>(m.handle);
+        cmd.copyBuffer(src, m.new_buffer, vk::BufferCopy{0, 0, m.size});
+    }
+    // Later work sees the new contents without knowing the buffers moved.
+    auto const barrier = vk::MemoryBarrier2{}
+        .setSrcStageMask(vk::PipelineStageFlagBits2::eCopy)
+        .setSrcAccessMask(vk::AccessFlagBits2::eTransferWrite)
+        .setDstStageMask(vk::PipelineStageFlagBits2::eAllCommands)
+        .setDstAccessMask(vk::AccessFlagBits2::eMemoryRead | vk::AccessFlagBits2::eMemoryWrite);
+    cmd.pipelineBarrier2(vk::DependencyInfo{}.setMemoryBarriers(barrier));
+    cmd.end();
+
+    auto const cmd_info = vk::CommandBufferSubmitInfo{}.setCommandBuffer(*cmd);
+    vk::Queue const queue = ctx.queues[queue_slot(QueueType::Graphics)];
+
+    // Nothing else is submitted outside a frame; the lock only keeps the
+    // queue externally synchronised against a misbehaving caller.
+    std::scoped_lock lock{ctx.pending_mutex};
+    auto const* d = impl.device.getDispatcher();
+    VkSubmitInfo2 const submit = vk::SubmitInfo2{}.setCommandBufferInfos(cmd_info);
+    if (VkResult r = d->vkQueueSubmit2(static_cast<VkQueue>(queue), 1, &submit, VK_NULL_HANDLE); r != VK_SUCCESS)
+        throw vk::SystemError{vk::make_error_code(static_cast<vk::Result>(r)), "vkQueueSubmit2"};
+    if (VkResult r = d->vkQueueWaitIdle(static_cast<VkQueue>(queue)); r != VK_SUCCESS)
+        throw vk::SystemError{vk::make_error_code(static_cast<vk::Result>(r)), "vkQueueWaitIdle"};
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Debug names
+// -------------------------------------------------------------------------------------------------
+void set_debug_name(VulkanDevice::Impl const& impl, vk::ObjectType type,
+                    uint64_t object, const char* name) noexcept
+{
+    // Resolved only when VK_EXT_debug_utils is enabled on the instance.
+    auto const* d = impl.device.getDispatcher();
+    if (!name || !d->vkSetDebugUtilsObjectNameEXT) return;
+
+    VkDebugUtilsObjectNameInfoEXT const info{
+        .sType        = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT,
+        .pNext        = nullptr,
+        .objectType   = static_cast<VkObjectType>(type),
+        .objectHandle = object,
+        .pObjectName  = name,
+    };
+    d->vkSetDebugUtilsObjectNameEXT(static_cast<VkDevice>(*impl.device), &info);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Deferred destruction
+// -------------------------------------------------------------------------------------------------
+void defer_release(VulkanDevice::Impl& impl, DeferredObject object) noexcept {
+    auto* const node = new (std::nothrow) DeferredNode{
+        .next   = nullptr,
+        .values = {},
+        .object = std::move(object),
+    };
+    if (!node) {
+        // Waiting here could stall on work the frame thread has not
+        // flushed yet; losing the object is the lesser evil.
+        SPDLOG_ERROR("[wren/rhi/vulkan] Out of memory queueing a deferred destruction; the object leaks.");
+        return;
+    }
+
+    // The caller orders its last submit() before the release, so relaxed
+    // loads see that submission's value.
+    auto const& commands = impl.commands;
+    for (uint32_t s = 0; s < k_queue_slot_count; ++s)
+        node->values[s] = commands.last_value[s].load(std::memory_order_relaxed);
+
+    auto& ctx  = impl.deferred;
+    node->next = ctx.incoming.load(std::memory_order_relaxed);
+    while (!ctx.incoming.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+    }
+}
+
+void collect_deferred(VulkanDevice::Impl& impl) noexcept {
+    auto& ctx = impl.deferred;
+    if (!ctx.pending_head && !ctx.incoming.load(std::memory_order_relaxed))
+        return;
+
+    // One counter read per timeline covers the whole batch. Slots that are
+    // not submit targets never hand out values, so zero passes them.
+    auto const& commands = impl.commands;
+    auto const* d        = impl.device.getDispatcher();
+    uint64_t completed[k_queue_slot_count]{};
+    for (uint32_t s = 0; s < k_queue_slot_count; ++s) {
+        if (commands.submit_target[s] != s) continue;
+        if (d->vkGetSemaphoreCounterValue(static_cast<VkDevice>(*impl.device),
+                                          static_cast<VkSemaphore>(commands.timelines[s]),
+                                          &completed[s]) != VK_SUCCESS)
+            return;
+    }
+    reclaim_deferred(impl, completed);
+}
+
+void release_deferred(VulkanDevice::Impl& impl) noexcept {
+    std::array<uint64_t, k_queue_slot_count> everything;
+    everything.fill(UINT64_MAX);
+    reclaim_deferred(impl, everything);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Impl teardown
+// -------------------------------------------------------------------------------------------------
+VulkanDevice::Impl::~Impl() {
+    if (*device) {
+        try {
+            device.waitIdle();
+        } catch (vk::SystemError const& err) {
+            SPDLOG_ERROR("[wren/rhi/vulkan] vkDeviceWaitIdle failed during teardown: {}", err.what());
+        }
+        // After the compile jobs drain: a relink finishing for a destroyed
+        // pipeline still defers its objects.
+        release_pipelines(*this);
+        release_shader_modules(*this);
+        release_deferred(*this);
+        release_commands(*this);
+        release_profiler(*this);
+        release_acceleration_structures(*this);
+        release_pipeline_cache(*this);
+    }
+    if (!buffers.empty() || !textures.empty()) {
+        SPDLOG_WARN("[wren/rhi/vulkan] Device destroyed with {} buffer(s) and {} texture(s) alive.",
+                    buffers.size(), textures.size());
+    }
+    while (!buffers.empty()) {
+        if (auto row = buffers.extract(buffers.handles().back()))
+            release_buffer(*this, *row);
+    }
+    while (!textures.empty()) {
+        if (auto row = textures.extract(textures.handles().back()))
+            release_texture(*this, *row);
+    }
+    while (!acceleration_structures.empty()) {
+        if (auto row = acceleration_structures.extract(acceleration_structures.handles().back()))
+            release_acceleration_structure(*this, *row);
+    }
+    while (!heaps.empty()) {
+        if (auto row = heaps.extract(heaps.handles().back()))
+            release_heap(*this, *row);
+    }
+    if (*device) {
+        release_bindless(*this);
+        release_memory(*this);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Buffers
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::create_buffers(std::span<BufferDesc const> descs,
+                                  std::span<BufferHandle>     out) noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    return create_batch<BufferPool, BufferRow>(*impl_, impl_->buffers, impl_->buffers_mutex,
+                                               descs, out, make_buffer, release_buffer);
+}
+
+void VulkanDevice::destroy_buffers(std::span<BufferHandle const> handles) noexcept {
+    std::unique_lock lock{impl_->buffers_mutex};
+    for (BufferHandle h : handles) {
+        if (auto row = impl_->buffers.extract(h))
+            defer_release(*impl_, std::move(*row));
+    }
+}
+
+auto VulkanDevice::buffer(BufferHandle handle) const noexcept -> vk::Buffer {
+    std::shared_lock lock{impl_->buffers_mutex};
+    auto const* b = impl_->buffers.get<0>(handle);
+    return b ? *b : vk::Buffer{};
+}
+
+auto VulkanDevice::buffer_mapping(BufferHandle handle) const noexcept -> void* {
+    std::shared_lock lock{impl_->buffers_mutex};
+    auto const* p = impl_->buffers.get<1>(handle);
+    return p ? *p : nullptr;
+}
+
+auto VulkanDevice::buffer_device_address(BufferHandle handle) const noexcept -> uint64_t {
+    if (!wants_device_address(*impl_))
+        return 0;
+    // Held across the query so that defragment_memory() cannot swap the
+    // buffer out from under it.
+    std::shared_lock lock{impl_->buffers_mutex};
+    auto const* b = impl_->buffers.get<0>(handle);
+    if (!b)
+        return 0;
+    VkBufferDeviceAddressInfo const info{
+        .sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+        .buffer = static_cast<VkBuffer>(*b),
+    };
+    return impl_->device.getDispatcher()->vkGetBufferDeviceAddress(
+        static_cast<VkDevice>(*impl_->device), &info);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Textures
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::create_textures(std::span<TextureDesc const> descs,
+                                   std::span<TextureHandle>     out) noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    return create_batch<TexturePool, TextureRow>(*impl_, impl_->textures, impl_->textures_mutex,
+                                                 descs, out, make_texture, release_texture);
+}
+
+void VulkanDevice::destroy_textures(std::span<TextureHandle const> handles) noexcept {
+    std::unique_lock lock{impl_->textures_mutex};
+    for (TextureHandle h : handles) {
+        if (auto row = impl_->textures.extract(h))
+            defer_release(*impl_, std::move(*row));
+    }
+}
+
+auto VulkanDevice::image(TextureHandle handle) const noexcept -> vk::Image {
+    std::shared_lock lock{impl_->textures_mutex};
+    auto const* i = impl_->textures.get<0>(handle);
+    return i ? *i : vk::Image{};
+}
+
+auto VulkanDevice::image_view(TextureHandle handle) const noexcept -> vk::ImageView {
+    std::shared_lock lock{impl_->textures_mutex};
+    auto const* v = impl_->textures.get<1>(handle);
+    return v ? *v : vk::ImageView{};
+}
+
+// -------------------------------------------------------------------------------------------------
+// Memory heaps
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::texture_memory_requirements(std::span<TextureDesc const> descs,
+                                               std::span<MemoryRequirements> out) const noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    std::ranges::fill(out.first(descs.size()), MemoryRequirements{});
+
+    try {
+        for (std::size_t i = 0; i < descs.size(); ++i) {
+            auto const info = image_info(*impl_, descs[i]);
+            if (!info)
+                return info.error();
+            auto const reqs = impl_->device.getImageMemoryRequirements(
+                vk::DeviceImageMemoryRequirements{}.setPCreateInfo(&*info)).memoryRequirements;
+            out[i] = MemoryRequirements{
+                .size          = reqs.size,
+                .alignment     = reqs.alignment,
+                .compatibility = reqs.memoryTypeBits,
+            };
+        }
+    } catch (vk::SystemError const& err) {
+        return to_status(err);
+    }
+    return Status::Ok;
+}
+
+auto VulkanDevice::create_memory_heaps(std::span<MemoryHeapDesc const> descs,
+                                       std::span<HeapHandle>           out) noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    return create_batch<HeapPool, HeapRow>(*impl_, impl_->heaps, impl_->heaps_mutex,
+                                           descs, out, make_heap, release_heap);
+}
+
+void VulkanDevice::destroy_memory_heaps(std::span<HeapHandle const> handles) noexcept {
+    std::unique_lock lock{impl_->heaps_mutex};
+    for (HeapHandle h : handles) {
+        if (auto row = impl_->heaps.extract(h))
+            defer_release(*impl_, std::move(*row));
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Acceleration structures
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::create_acceleration_structures(std::span<AccelerationStructureDesc const> descs,
+                                                  std::span<AccelerationStructureHandle>     out) noexcept
+    -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    return create_batch<AccelerationStructurePool, AccelerationStructureRow>(
+        *impl_, impl_->acceleration_structures, impl_->acceleration_structures_mutex,
+        descs, out, make_acceleration_structure, release_acceleration_structure);
+}
+
+void VulkanDevice::destroy_acceleration_structures(std::span<AccelerationStructureHandle const> handles) noexcept {
+    std::unique_lock lock{impl_->acceleration_structures_mutex};
+    for (AccelerationStructureHandle h : handles) {
+        if (auto row = impl_->acceleration_structures.extract(h))
+            defer_release(*impl_, std::move(*row));
+    }
+}
+
+auto VulkanDevice::acceleration_structure(AccelerationStructureHandle handle) const noexcept
+    -> vk::AccelerationStructureKHR
+{
+    std::shared_lock lock{impl_->acceleration_structures_mutex};
+    auto const* s = impl_->acceleration_structures.get<0>(handle);
+    return s ? *s : vk::AccelerationStructureKHR{};
+}
+
+auto VulkanDevice::acceleration_structure_reference(AccelerationStructureHandle handle) const noexcept
+    -> uint64_t
+{
+    std::shared_lock lock{impl_->acceleration_structures_mutex};
+    auto const* r = impl_->acceleration_structures.get<1>(handle);
+    return r ? *r : 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Defragmentation
+//
+// Stop-the-world: with the device idle, GPU-only buffers are copied out of
+// the sparsest blocks into denser ones of the same type, the pool rows are
+// repointed and the emptied blocks return to the driver. Handles and heap
+// indices stay valid; the VkBuffer behind a moved handle and its device
+// address change, its heap descriptor is rewritten, and its debug name is
+// lost. Textures are never moved, since the backend does not track their
+// layouts.
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::defragment_memory(DefragmentDesc const& desc, DefragmentStats& out) noexcept -> Status {
+    auto& impl = *impl_;
+    out        = {};
+    if (impl.commands.in_frame)
+        return Status::InvalidArgument;
+
+    std::unique_lock buffers_lock{impl.buffers_mutex};
+    std::scoped_lock memory_lock{impl.memory.mutex};
+    auto& ctx = impl.memory;
+
+    auto const block_bytes = [&ctx] {
+        uint64_t total = 0;
+        for (uint64_t const b : ctx.heap_block_bytes) total += b;
+        return total;
+    };
+    uint64_t const bytes_before  = block_bytes();
+    uint32_t const memory_before = ctx.device_memory_count;
+
+    std::vector<BufferMove> moves;
+    try {
+        impl.device.waitIdle();
+        plan_moves(impl, desc, moves);
+        if (moves.empty())
+            return Status::Ok;
+        copy_moves(impl, moves);
+    } catch (vk::SystemError const& err) {
+        SPDLOG_ERROR("[wren/rhi/vulkan] Defragmentation failed: {}", err.what());
+        discard_moves(impl, moves);
+        return to_status(err);
+    } catch (std::bad_alloc const&) {
+        discard_moves(impl, moves);
+        return Status::OutOfMemory;
+    }
+
+    auto const* d = impl.device.getDispatcher();
+    for (BufferMove const& m : moves) {
+        vk::Buffer&       buffer = *impl.buffers.get<0>(m.handle);
+        MemoryAllocation& alloc  = *impl.buffers.get<2>(m.handle);
+        d->vkDestroyBuffer(static_cast<VkDevice>(*impl.device), static_cast<VkBuffer>(buffer), nullptr);
+        free_memory_locked(impl, alloc);
+        buffer = m.new_buffer;
+        alloc  = m.new_alloc;
+        if (uint32_t const slot = *impl.buffers.get<3>(m.handle); slot != k_invalid_bindless_index)
+            rewrite_bindless_buffer(impl, slot, buffer, m.size);
+        out.bytesMoved += m.size;
+    }
+    out.allocationsMoved = static_cast<uint32_t>(moves.size());
+    out.bytesReleased    = bytes_before - block_bytes();
+    out.blocksReleased   = memory_before - ctx.device_memory_count;
+    return Status::Ok;
+}
+
+} // namespace wren::rhi::vulkan
@@ -0,0 +1,207 @@
+#include <wren/rhi/vulkan/device.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <vulkan/vulkan_raii.hpp>
+
+#include "vk_convert.hpp"
+#include "vk_device_impl.hpp"
+#include "vk_shaders.hpp"
+#include "vk_spirv.hpp"
+
+namespace wren::rhi::vulkan {
+
+ShaderModuleRecord::~ShaderModuleRecord() {
+    if (module) {
+        owner->device.getDispatcher()->vkDestroyShaderModule(static_cast<VkDevice>(*owner->device),
+                                                             module, nullptr);
+    }
+}
+
+namespace {
+
+/// Keeps the published record for a hash when two threads created the same
+/// module at once; ours is dropped by the caller.
+[[nodiscard]] std::shared_ptr<ShaderModuleRecord const> publish(
+    ShaderModuleContext& ctx, std::shared_ptr<ShaderModuleRecord const> record)
+{
+    std::lock_guard lock{ctx.mutex};
+    auto& slot = ctx.by_hash[record->reflection.hash];
+    if (auto existing = slot.lock(); existing && existing->size == record->size) {
+        ctx.hits.fetch_add(1, std::memory_order_relaxed);
+        return existing;
+    }
+    slot = record;
+    if (ctx.by_hash.size() >= ctx.sweep_at) {
+        std::erase_if(ctx.by_hash, [](auto const& entry) { return entry.second.expired(); });
+        ctx.sweep_at = std::max<std::size_t>(64, ctx.by_hash.size() * 2);
+    }
+    ctx.bytes.fetch_add(record->size, std::memory_order_relaxed);
+    return record;
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Cache
+// -------------------------------------------------------------------------------------------------
+auto intern_shader_module(VulkanDevice::Impl& impl, void const* code, std::size_t size,
+                          const char* debug_name) noexcept
+    -> std::expected<std::shared_ptr<ShaderModuleRecord const>, Status>
+{
+    if (!code || size == 0 || size % sizeof(uint32_t) != 0)
+        return std::unexpected{Status::InvalidArgument};
+
+    auto& ctx = impl.shaders;
+    try {
+        std::vector<uint32_t>     aligned;
+        std::span<uint32_t const> words;
+        if (reinterpret_cast<std::uintptr_t>(code) % alignof(uint32_t) == 0) {
+            words = {static_cast<uint32_t const*>(code), size / sizeof(uint32_t)};
+        } else {
+            aligned.resize(size / sizeof(uint32_t));
+            std::memcpy(aligned.data(), code, size);
+            words = aligned;
+        }
+
+        uint64_t const hash = detail::hash_spirv(words);
+        {
+            std::lock_guard lock{ctx.mutex};
+            if (auto it = ctx.by_hash.find(hash); it != ctx.by_hash.end()) {
+                if (auto existing = it->second.lock(); existing && existing->size == size) {
+                    ctx.hits.fetch_add(1, std::memory_order_relaxed);
+                    return existing;
+                }
+            }
+        }
+
+        // Parsed and created outside the lock: the driver call dominates and
+        // permutations arrive from many loading threads at once.
+        auto record   = std::make_shared<ShaderModuleRecord>();
+        record->owner = &impl;
+        record->size  = size;
+        record->reflection.hash = hash;
+        if (Status s = detail::reflect_spirv(words, record->reflection); s != Status::Ok)
+            return std::unexpected{s};
+
+        VkShaderModuleCreateInfo const info{
+            .sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+            .pNext    = nullptr,
+            .flags    = 0,
+            .codeSize = size,
+            .pCode    = words.data(),
+        };
+        if (VkResult r = impl.device.getDispatcher()->vkCreateShaderModule(
+                static_cast<VkDevice>(*impl.device), &info, nullptr, &record->module);
+            r != VK_SUCCESS)
+        {
+            record->module = VK_NULL_HANDLE;
+            return std::unexpected{detail::to_status(r)};
+        }
+        set_debug_name(impl, vk::ObjectType::eShaderModule, reinterpret_cast<uint64_t>(record->module),
+                       debug_name);
+        return publish(ctx, std::move(record));
+    } catch (std::bad_alloc const&) {
+        return std::unexpected{Status::OutOfMemory};
+    }
+}
+
+std::shared_ptr<ShaderModuleRecord const> find_shader_module(ShaderModuleContext const& ctx,
+                                                             ShaderModuleHandle         handle) noexcept
+{
+    std::shared_lock lock{ctx.pool_mutex};
+    auto const* record = ctx.pool.get<0>(handle);
+    return record ? *record : nullptr;
+}
+
+void release_shader_modules(VulkanDevice::Impl& impl) noexcept {
+    auto& ctx = impl.shaders;
+    if (!ctx.pool.empty())
+        SPDLOG_WARN("[wren/rhi/vulkan] Device destroyed with {} shader module(s) alive.", ctx.pool.size());
+    ctx.pool.clear();
+    ctx.by_hash.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+// VulkanDevice — shader modules
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::create_shader_modules(std::span<ShaderModuleDesc const> descs,
+                                         std::span<ShaderModuleHandle>     out) noexcept -> Status
+{
+    if (out.size() < descs.size())
+        return Status::InvalidArgument;
+    std::ranges::fill(out.first(descs.size()), ShaderModuleHandle{});
+
+    std::vector<std::shared_ptr<ShaderModuleRecord const>> records;
+    try {
+        records.reserve(descs.size());
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+    for (ShaderModuleDesc const& desc : descs) {
+        auto record = intern_shader_module(*impl_, desc.code, desc.codeSize, desc.debugName);
+        if (!record)
+            return record.error();
+        records.push_back(std::move(*record));
+    }
+
+    auto&            ctx = impl_->shaders;
+    std::unique_lock lock{ctx.pool_mutex};
+    bool             full = false;
+    try {
+        for (size_t i = 0; i < records.size() && !full; ++i) {
+            out[i] = ctx.pool.insert(records[i]);
+            full   = !out[i];
+        }
+    } catch (std::bad_alloc const&) {
+        full = true;
+    }
+    if (full) {
+        for (size_t i = 0; i < records.size(); ++i) {
+            ctx.pool.erase(out[i]);
+            out[i] = {};
+        }
+        return Status::OutOfMemory;
+    }
+    return Status::Ok;
+}
+
+void VulkanDevice::destroy_shader_modules(std::span<ShaderModuleHandle const> handles) noexcept {
+    auto& ctx = impl_->shaders;
+    std::vector<std::shared_ptr<ShaderModuleRecord const>> dropped;
+    {
+        std::unique_lock lock{ctx.pool_mutex};
+        for (ShaderModuleHandle handle : handles) {
+            auto row = ctx.pool.extract(handle);
+            if (!row) continue;
+            try {
+                dropped.push_back(std::move(std::get<0>(*row)));
+            } catch (std::bad_alloc const&) {
+                // Destroyed under the lock instead.
+            }
+        }
+    }
+    // The last owners destroy their driver modules here, outside the lock.
+}
+
+auto VulkanDevice::shader_module_reflection(ShaderModuleHandle handle, ShaderReflection& out) const noexcept
+    -> Status
+{
+    auto record = find_shader_module(impl_->shaders, handle);
+    if (!record)
+        return Status::InvalidArgument;
+    out = record->reflection;
+    return Status::Ok;
+}
+
+} // namespace wren::rhi::vulkan
@@ -0,0 +1,379 @@
+#include <wren/rhi/vulkan/device.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <utility>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "vk_commands.hpp"
+#include "vk_convert.hpp"
+#include "vk_device_impl.hpp"
+
+namespace wren::rhi::vulkan {
+
+namespace {
+
+// -----------------------------------------------------------------
+// Page layout
+//
+// Queried from the driver on every use rather than stored in the texture
+// pool: both queries are cheap, and TextureRow stays the same for every
+// texture.
+// -----------------------------------------------------------------
+struct SparseLayout {
+    VkExtent3D granularity{};       // page size in texels
+    uint64_t   page_bytes   = 0;    // sparse block size; the image's memory alignment
+    uint32_t   memory_types = 0;
+    uint32_t   tail_first   = 0;    // first mip in the tail; mipLevels when there is none
+    uint64_t   tail_size    = 0;
+    uint64_t   tail_offset  = 0;    // opaque resource offset of layer 0's tail
+    uint64_t   tail_stride  = 0;
+    bool       single_tail  = false;
+};
+
+[[nodiscard]] std::optional<SparseLayout> sparse_layout(VulkanDevice::Impl const& impl, VkImage image,
+                                                        uint32_t mip_levels) noexcept
+{
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    VkMemoryRequirements reqs{};
+    d->vkGetImageMemoryRequirements(dev, image, &reqs);
+
+    // Colour images report exactly one aspect; the array leaves room for
+    // drivers that list metadata too.
+    std::array<VkSparseImageMemoryRequirements, 4> sparse{};
+    auto count = static_cast<uint32_t>(sparse.size());
+    d->vkGetImageSparseMemoryRequirements(dev, image, &count, sparse.data());
+
+    for (uint32_t i = 0; i < count; ++i) {
+        VkSparseImageMemoryRequirements const& r = sparse[i];
+        if (!(r.formatProperties.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT))
+            continue;
+        bool const has_tail = r.imageMipTailFirstLod < mip_levels && r.imageMipTailSize > 0;
+        return SparseLayout{
+            .granularity  = r.formatProperties.imageGranularity,
+            .page_bytes   = reqs.alignment,
+            .memory_types = reqs.memoryTypeBits,
+            .tail_first   = has_tail ? r.imageMipTailFirstLod : mip_levels,
+            .tail_size    = has_tail ? r.imageMipTailSize : 0,
+            .tail_offset  = r.imageMipTailOffset,
+            .tail_stride  = r.imageMipTailStride,
+            .single_tail  = (r.formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0,
+        };
+    }
+    return std::nullopt;
+}
+
+/// Heap memory for one bind; VK_NULL_HANDLE memory for unbinds. Caller
+/// holds heaps_mutex.
+[[nodiscard]] std::optional<std::pair<VkDeviceMemory, uint64_t>> resolve_memory(
+    VulkanDevice::Impl const& impl, SparsePageBind const& bind, SparseLayout const& layout,
+    uint64_t size) noexcept
+{
+    if (!bind.heap)
+        return std::pair<VkDeviceMemory, uint64_t>{VK_NULL_HANDLE, 0};
+    auto const* heap = impl.heaps.get<0>(bind.heap);
+    if (!heap || !(layout.memory_types & (1u << heap->type)) || bind.heapOffset % layout.page_bytes != 0 ||
+        bind.heapOffset > heap->size || size > heap->size - bind.heapOffset)
+        return std::nullopt;
+    return std::pair{static_cast<VkDeviceMemory>(heap->memory), heap->offset + bind.heapOffset};
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Setup
+// -------------------------------------------------------------------------------------------------
+void init_sparse(VulkanDevice::Impl& impl) noexcept {
+    auto& ctx = impl.commands;
+    ctx.sparse_target = UINT32_MAX;
+    if (!has_any(impl.capabilities.features, Feature::SparseResources))
+        return;
+
+    // Off the graphics queue when a copy or compute family can bind, so
+    // page updates never queue behind rendering.
+    constexpr QueueType k_preference[] = {QueueType::Transfer, QueueType::Compute, QueueType::Graphics};
+    auto const& families = impl.adapter->queue_families;
+    for (QueueType const type : k_preference) {
+        uint32_t const slot   = queue_slot(type);
+        uint32_t const family = ctx.families[slot];
+        if (family < families.size() && (families[family].queueFlags & vk::QueueFlagBits::eSparseBinding)) {
+            ctx.sparse_target = ctx.submit_target[slot];
+            ctx.sparse_queue  = type;
+            return;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Queries
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::sparse_texture_info(TextureHandle texture, SparseTextureInfo& out) const noexcept -> Status {
+    out = {};
+
+    std::shared_lock lock{impl_->textures_mutex};
+    auto const* image = impl_->textures.get<0>(texture);
+    auto const* desc  = impl_->textures.get<4>(texture);
+    if (!image || !desc->sparse)
+        return Status::InvalidArgument;
+
+    auto const layout = sparse_layout(*impl_, static_cast<VkImage>(*image), desc->mipLevels);
+    if (!layout)
+        return Status::InternalError;
+
+    out = SparseTextureInfo{
+        .pageWidth     = layout->granularity.width,
+        .pageHeight    = layout->granularity.height,
+        .pageBytes     = layout->page_bytes,
+        .compatibility = layout->memory_types,
+        .mipTailFirst  = layout->tail_first,
+        .mipTailBytes  = layout->tail_size,
+        .singleMipTail = layout->single_tail,
+    };
+    return Status::Ok;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Binding
+//
+// Binds are resolved and validated straight into the queue's pending
+// arrays, under the texture and heap locks and then pending_mutex (the
+// documented lock order); a bad entry truncates the arrays back and fails
+// the whole batch.
+// -------------------------------------------------------------------------------------------------
+auto VulkanDevice::bind_sparse(SparseBindDesc const& desc, SyncPoint& out) noexcept -> Status {
+    out = {};
+
+    auto& impl = *impl_;
+    auto& ctx  = impl.commands;
+    if (!ctx.in_frame || desc.bindCount == 0 || !desc.binds || (desc.waitCount > 0 && !desc.waits))
+        return Status::InvalidArgument;
+    if (ctx.sparse_target == UINT32_MAX)
+        return Status::MissingRequiredFeature;
+
+    std::span const binds{desc.binds, desc.bindCount};
+    std::span const waits{desc.waits, desc.waitCount};
+    uint32_t const  target = ctx.sparse_target;
+
+    std::shared_lock textures_lock{impl.textures_mutex};
+    std::shared_lock heaps_lock{impl.heaps_mutex};
+    std::scoped_lock pending_lock{ctx.pending_mutex};
+
+    for (SyncPoint const& w : waits) {
+        if (w.value > ctx.last_value[ctx.submit_target[queue_slot(w.queue)]])
+            return Status::InvalidArgument;
+    }
+
+    auto& pending = ctx.pending[target];
+    try {
+        pending.batches.reserve(pending.batches.size() + 1);
+        pending.waits.reserve(pending.waits.size() + waits.size() + 1);
+        pending.sparse_images.reserve(pending.sparse_images.size() + binds.size());
+        pending.page_binds.reserve(pending.page_binds.size() + binds.size());
+        pending.tail_binds.reserve(pending.tail_binds.size() + binds.size());
+        ctx.submit_scratch.reserve(pending.batches.size() + 1);
+        ctx.signal_scratch.reserve(pending.batches.size() + 1);
+        ctx.sparse_page_scratch.reserve(pending.sparse_images.size() + binds.size());
+        ctx.sparse_tail_scratch.reserve(pending.sparse_images.size() + binds.size());
+        ctx.sparse_semaphore_scratch.reserve(pending.waits.size() + waits.size() + 1);
+        ctx.sparse_value_scratch.reserve(pending.waits.size() + waits.size() + 1);
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+
+    auto const first_image = static_cast<uint32_t>(pending.sparse_images.size());
+    auto const first_page  = pending.page_binds.size();
+    auto const first_tail  = pending.tail_binds.size();
+    auto const fail = [&]() noexcept {
+        pending.sparse_images.resize(first_image);
+        pending.page_binds.resize(first_page);
+        pending.tail_binds.resize(first_tail);
+        return Status::InvalidArgument;
+    };
+
+    TextureHandle               last_texture{};
+    VkImage                     image = VK_NULL_HANDLE;
+    TextureDesc const*          texture_desc = nullptr;
+    std::optional<SparseLayout> layout;
+    for (SparsePageBind const& b : binds) {
+        if (!last_texture || b.texture != last_texture) {
+            auto const* i = impl.textures.get<0>(b.texture);
+            auto const* t = impl.textures.get<4>(b.texture);
+            if (!i || !t->sparse)
+                return fail();
+            image        = static_cast<VkImage>(*i);
+            texture_desc = t;
+            layout       = sparse_layout(impl, image, t->mipLevels);
+            if (!layout)
+                return fail();
+            last_texture = b.texture;
+        }
+        if (b.arrayLayer >= texture_desc->arrayLayers)
+            return fail();
+
+        // One run per image and kind; consecutive binds extend it.
+        auto const extend = [&](bool tail, std::size_t index) {
+            if (pending.sparse_images.size() > first_image) {
+                PendingSparseImage& run = pending.sparse_images.back();
+                if (run.image == image && run.tail == tail) {
+                    ++run.bind_count;
+                    return;
+                }
+            }
+            pending.sparse_images.push_back(PendingSparseImage{
+                .image      = image,
+                .first_bind = static_cast<uint32_t>(index),
+                .bind_count = 1,
+                .tail       = tail,
+            });
+        };
+
+        if (b.mipTail) {
+            if (layout->tail_size == 0 || (layout->single_tail && b.arrayLayer != 0))
+                return fail();
+            auto const memory = resolve_memory(impl, b, *layout, layout->tail_size);
+            if (!memory)
+                return fail();
+            extend(true, pending.tail_binds.size());
+            pending.tail_binds.push_back(VkSparseMemoryBind{
+                .resourceOffset = layout->tail_offset + b.arrayLayer * layout->tail_stride,
+                .size           = layout->tail_size,
+                .memory         = memory->first,
+                .memoryOffset   = memory->second,
+                .flags          = 0,
+            });
+            continue;
+        }
+
+        uint32_t const mip_width  = std::max(texture_desc->width >> b.mipLevel, 1u);
+        uint32_t const mip_height = std::max(texture_desc->height >> b.mipLevel, 1u);
+        uint32_t const px         = b.x * layout->granularity.width;
+        uint32_t const py         = b.y * layout->granularity.height;
+        if (b.mipLevel >= layout->tail_first || px >= mip_width || py >= mip_height)
+            return fail();
+        auto const memory = resolve_memory(impl, b, *layout, layout->page_bytes);
+        if (!memory)
+            return fail();
+
+        // Pages at the right and bottom edges are clipped to the mip.
+        extend(false, pending.page_binds.size());
+        pending.page_binds.push_back(VkSparseImageMemoryBind{
+            .subresource  = {VK_IMAGE_ASPECT_COLOR_BIT, b.mipLevel, b.arrayLayer},
+            .offset       = {static_cast<int32_t>(px), static_cast<int32_t>(py), 0},
+            .extent       = {std::min(layout->granularity.width, mip_width - px),
+                             std::min(layout->granularity.height, mip_height - py), 1},
+            .memory       = memory->first,
+            .memoryOffset = memory->second,
+            .flags        = 0,
+        });
+    }
+
+    // Ordered after everything queued on the binding queue before it.
+    PendingBatch batch{
+        .first_list  = static_cast<uint32_t>(pending.lists.size()),
+        .list_count  = 0,
+        .first_wait  = static_cast<uint32_t>(pending.waits.size()),
+        .wait_count  = 0,
+        .signal      = 0,
+        .first_image = first_image,
+        .image_count = static_cast<uint32_t>(pending.sparse_images.size()) - first_image,
+        .sparse      = true,
+    };
+    if (uint64_t const previous = ctx.last_value[target]; previous != 0) {
+        pending.waits.push_back(VkSemaphoreSubmitInfo{
+            .sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .pNext       = nullptr,
+            .semaphore   = static_cast<VkSemaphore>(ctx.timelines[target]),
+            .value       = previous,
+            .stageMask   = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+            .deviceIndex = 0,
+        });
+        ++batch.wait_count;
+    }
+    for (SyncPoint const& w : waits) {
+        if (w.value == 0) continue;
+        pending.waits.push_back(VkSemaphoreSubmitInfo{
+            .sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .pNext       = nullptr,
+            .semaphore   = static_cast<VkSemaphore>(ctx.timelines[ctx.submit_target[queue_slot(w.queue)]]),
+            .value       = w.value,
+            .stageMask   = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+            .deviceIndex = 0,
+        });
+        ++batch.wait_count;
+    }
+    batch.signal = ++ctx.last_value[target];
+    ctx.sparse_value[target] = batch.signal;
+    pending.batches.push_back(batch);
+
+    out = {ctx.sparse_queue, batch.signal};
+    return Status::Ok;
+}
+
+VkResult bind_sparse_batch(VulkanDevice::Impl& impl, uint32_t slot, PendingBatch const& batch) noexcept {
+    auto& ctx           = impl.commands;
+    auto const& pending = ctx.pending[slot];
+
+    ctx.sparse_page_scratch.clear();
+    ctx.sparse_tail_scratch.clear();
+    ctx.sparse_semaphore_scratch.clear();
+    ctx.sparse_value_scratch.clear();
+
+    for (uint32_t i = 0; i < batch.image_count; ++i) {
+        PendingSparseImage const& run = pending.sparse_images[batch.first_image + i];
+        if (run.tail) {
+            ctx.sparse_tail_scratch.push_back(VkSparseImageOpaqueMemoryBindInfo{
+                .image     = run.image,
+                .bindCount = run.bind_count,
+                .pBinds    = pending.tail_binds.data() + run.first_bind,
+            });
+        } else {
+            ctx.sparse_page_scratch.push_back(VkSparseImageMemoryBindInfo{
+                .image     = run.image,
+                .bindCount = run.bind_count,
+                .pBinds    = pending.page_binds.data() + run.first_bind,
+            });
+        }
+    }
+    for (uint32_t i = 0; i < batch.wait_count; ++i) {
+        VkSemaphoreSubmitInfo const& w = pending.waits[batch.first_wait + i];
+        ctx.sparse_semaphore_scratch.push_back(w.semaphore);
+        ctx.sparse_value_scratch.push_back(w.value);
+    }
+
+    VkSemaphore const timeline = static_cast<VkSemaphore>(ctx.timelines[slot]);
+    VkTimelineSemaphoreSubmitInfo const values{
+        .sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+        .pNext                     = nullptr,
+        .waitSemaphoreValueCount   = batch.wait_count,
+        .pWaitSemaphoreValues      = ctx.sparse_value_scratch.data(),
+        .signalSemaphoreValueCount = 1,
+        .pSignalSemaphoreValues    = &batch.signal,
+    };
+    VkBindSparseInfo const info{
+        .sType                = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO,
+        .pNext                = &values,
+        .waitSemaphoreCount   = batch.wait_count,
+        .pWaitSemaphores      = ctx.sparse_semaphore_scratch.data(),
+        .bufferBindCount      = 0,
+        .pBufferBinds         = nullptr,
+        .imageOpaqueBindCount = static_cast<uint32_t>(ctx.sparse_tail_scratch.size()),
+        .pImageOpaqueBinds    = ctx.sparse_tail_scratch.data(),
+        .imageBindCount       = static_cast<uint32_t>(ctx.sparse_page_scratch.size()),
+        .pImageBinds          = ctx.sparse_page_scratch.data(),
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores    = &timeline,
+    };
+    return impl.device.getDispatcher()->vkQueueBindSparse(static_cast<VkQueue>(ctx.queues[slot]), 1, &info,
+                                                          VK_NULL_HANDLE);
+}
+
+} // namespace wren::rhi::vulkan
@@ -0,0 +1,413 @@
+#include "vk_spirv.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <wren/rhi/api/features.hpp>
+
+// -------------------------------------------------------------------------------------------------
+// SPIR-V reflection
+//
+// One pass over the instruction stream records, per result id, the word at
+// which it is defined and the decorations it carries; a second step walks
+// the global variables through their pointer types. Only the handful of
+// opcodes that declare interfaces are looked at, so the numbers below are
+// taken straight from the SPIR-V specification instead of pulling in
+// spirv.h.
+// -------------------------------------------------------------------------------------------------
+
+namespace wren::rhi::vulkan::detail {
+
+namespace {
+
+constexpr uint32_t k_magic       = 0x07230203;
+constexpr uint32_t k_header_size = 5;
+constexpr uint32_t k_max_id      = 1u << 22;  // far above what compilers emit
+constexpr uint32_t k_max_depth   = 16;        // type nesting walked for sizes
+
+namespace op {
+constexpr uint32_t EntryPoint                = 15;
+constexpr uint32_t ExecutionMode             = 16;
+constexpr uint32_t TypeBool                  = 20;
+constexpr uint32_t TypeInt                   = 21;
+constexpr uint32_t TypeFloat                 = 22;
+constexpr uint32_t TypeVector                = 23;
+constexpr uint32_t TypeMatrix                = 24;
+constexpr uint32_t TypeImage                 = 25;
+constexpr uint32_t TypeSampler               = 26;
+constexpr uint32_t TypeSampledImage          = 27;
+constexpr uint32_t TypeArray                 = 28;
+constexpr uint32_t TypeRuntimeArray          = 29;
+constexpr uint32_t TypeStruct                = 30;
+constexpr uint32_t TypePointer               = 32;
+constexpr uint32_t Constant                  = 43;
+constexpr uint32_t SpecConstant              = 50;
+constexpr uint32_t Variable                  = 59;
+constexpr uint32_t Decorate                  = 71;
+constexpr uint32_t MemberDecorate            = 72;
+constexpr uint32_t ExecutionModeId           = 331;
+constexpr uint32_t TypeAccelerationStructure = 5341;
+} // namespace op
+
+namespace decoration {
+constexpr uint32_t BufferBlock   = 3;
+constexpr uint32_t ArrayStride   = 6;
+constexpr uint32_t MatrixStride  = 7;
+constexpr uint32_t BuiltIn       = 11;
+constexpr uint32_t Location      = 30;
+constexpr uint32_t Binding       = 33;
+constexpr uint32_t DescriptorSet = 34;
+constexpr uint32_t Offset        = 35;
+} // namespace decoration
+
+namespace storage {
+constexpr uint32_t UniformConstant = 0;
+constexpr uint32_t Input           = 1;
+constexpr uint32_t Uniform         = 2;
+constexpr uint32_t PushConstant    = 9;
+constexpr uint32_t StorageBuffer   = 12;
+} // namespace storage
+
+constexpr uint32_t k_mode_local_size    = 17;
+constexpr uint32_t k_mode_local_size_id = 38;
+constexpr uint32_t k_image_storage      = 2;  // OpTypeImage "Sampled" operand
+
+[[nodiscard]] ShaderStage stage_of(uint32_t model) noexcept {
+    switch (model) {
+        case 0:    return ShaderStage::Vertex;
+        case 1:    return ShaderStage::TessControl;
+        case 2:    return ShaderStage::TessEval;
+        case 3:    return ShaderStage::Geometry;
+        case 4:    return ShaderStage::Fragment;
+        case 5:    return ShaderStage::Compute;
+        case 5267:
+        case 5364: return ShaderStage::Task;
+        case 5268:
+        case 5365: return ShaderStage::Mesh;
+        case 5313: return ShaderStage::RayGen;
+        case 5314: return ShaderStage::Intersection;
+        case 5315: return ShaderStage::AnyHit;
+        case 5316: return ShaderStage::ClosestHit;
+        case 5317: return ShaderStage::Miss;
+        case 5318: return ShaderStage::Callable;
+        default:   return ShaderStage::None;
+    }
+}
+
+constexpr uint32_t k_none = ~0u;
+
+struct IdInfo {
+    uint32_t def           = 0;  // word offset of the defining instruction; 0 if none
+    uint32_t set           = k_none;
+    uint32_t binding       = k_none;
+    uint32_t location      = k_none;
+    uint32_t array_stride  = 0;
+    bool     builtin       = false;
+    bool     buffer_block  = false;
+};
+
+struct MemberInfo {
+    uint32_t offset        = 0;
+    uint32_t matrix_stride = 0;
+};
+
+[[nodiscard]] constexpr uint64_t member_key(uint32_t type, uint32_t index) noexcept {
+    return (uint64_t{type} << 32) | index;
+}
+
+struct ModeId {
+    uint32_t entry = 0;  // function id
+    uint32_t ids[3]{};
+};
+
+class Parser {
+public:
+    Parser(std::span<uint32_t const> code, ShaderReflection& out) : code_{code}, out_{out} {}
+
+    [[nodiscard]] Status run() {
+        if (code_.size() < k_header_size || code_[0] != k_magic)
+            return Status::InvalidArgument;
+        uint32_t const bound = code_[3];
+        if (bound == 0 || bound > k_max_id)
+            return Status::InvalidArgument;
+        ids_.resize(bound);
+
+        for (uint32_t at = k_header_size; at < code_.size();) {
+            uint32_t const count = code_[at] >> 16;
+            if (count == 0 || count > code_.size() - at)
+                return Status::InvalidArgument;
+            if (Status s = record(at, count); s != Status::Ok)
+                return s;
+            at += count;
+        }
+
+        for (ModeId const& mode : mode_ids_) {
+            if (ShaderEntryPoint* entry = find_entry(mode.entry)) {
+                for (uint32_t i = 0; i < 3; ++i)
+                    entry->localSize[i] = constant(mode.ids[i]).value_or(0);
+            }
+        }
+        for (uint32_t id : variables_) {
+            if (Status s = reflect_variable(id); s != Status::Ok)
+                return s;
+        }
+        return Status::Ok;
+    }
+
+private:
+    [[nodiscard]] Status record(uint32_t at, uint32_t count) {
+        uint32_t const opcode = code_[at] & 0xffffu;
+        auto const     word   = [&](uint32_t i) { return i < count ? code_[at + i] : 0u; };
+
+        switch (opcode) {
+            case op::EntryPoint: {
+                if (count < 4) return Status::InvalidArgument;
+                ShaderStage const stage = stage_of(word(1));
+                if (stage == ShaderStage::None) return Status::InvalidArgument;
+                out_.stages |= stage;
+                if (out_.entryPointCount == k_max_shader_entry_points) break;
+
+                ShaderEntryPoint& entry = out_.entryPoints[out_.entryPointCount++];
+                entry.stage = stage;
+                entry_ids_[out_.entryPointCount - 1] = word(2);
+                auto const* chars = reinterpret_cast<char const*>(code_.data() + at + 3);
+                std::size_t const max = std::size_t{count - 3} * sizeof(uint32_t);
+                std::size_t const len = std::find(chars, chars + max, '\0') - chars;
+                if (len == max || len >= k_max_entry_point_name_size) return Status::InvalidArgument;
+                std::copy_n(chars, len, entry.name);
+                break;
+            }
+            case op::ExecutionMode:
+                if (word(2) == k_mode_local_size && count >= 6) {
+                    if (ShaderEntryPoint* entry = find_entry(word(1))) {
+                        for (uint32_t i = 0; i < 3; ++i)
+                            entry->localSize[i] = word(3 + i);
+                    }
+                }
+                break;
+            case op::ExecutionModeId:
+                if (word(2) == k_mode_local_size_id && count >= 6)
+                    mode_ids_.push_back(ModeId{.entry = word(1), .ids = {word(3), word(4), word(5)}});
+                break;
+            case op::Decorate: {
+                if (count < 3) return Status::InvalidArgument;
+                IdInfo* info = id(word(1));
+                if (!info) return Status::InvalidArgument;
+                switch (word(2)) {
+                    case decoration::BufferBlock:   info->buffer_block = true; break;
+                    case decoration::ArrayStride:   info->array_stride = word(3); break;
+                    case decoration::BuiltIn:       info->builtin      = true; break;
+                    case decoration::Location:      info->location     = word(3); break;
+                    case decoration::Binding:       info->binding      = word(3); break;
+                    case decoration::DescriptorSet: info->set          = word(3); break;
+                    default: break;
+                }
+                break;
+            }
+            case op::MemberDecorate:
+                if (count < 4) return Status::InvalidArgument;
+                if (word(3) == decoration::Offset || word(3) == decoration::MatrixStride) {
+                    MemberInfo& m = members_[member_key(word(1), word(2))];
+                    (word(3) == decoration::Offset ? m.offset : m.matrix_stride) = word(4);
+                }
+                break;
+            case op::TypeBool:
+            case op::TypeInt:
+            case op::TypeFloat:
+            case op::TypeVector:
+            case op::TypeMatrix:
+            case op::TypeImage:
+            case op::TypeSampler:
+            case op::TypeSampledImage:
+            case op::TypeArray:
+            case op::TypeRuntimeArray:
+            case op::TypeStruct:
+            case op::TypePointer:
+            case op::TypeAccelerationStructure:
+                if (Status s = define(word(1), at, count); s != Status::Ok) return s;
+                break;
+            case op::Constant:
+            case op::SpecConstant:
+            case op::Variable:
+                if (Status s = define(word(2), at, count); s != Status::Ok) return s;
+                if (opcode == op::Variable) variables_.push_back(word(2));
+                break;
+            default:
+                break;
+        }
+        return Status::Ok;
+    }
+
+    [[nodiscard]] Status define(uint32_t result, uint32_t at, uint32_t count) noexcept {
+        IdInfo* info = id(result);
+        if (!info || info->def != 0 || count < 2) return Status::InvalidArgument;
+        info->def = at;
+        return Status::Ok;
+    }
+
+    [[nodiscard]] Status reflect_variable(uint32_t var) {
+        uint32_t const at = ids_[var].def;
+        if (code_[at] >> 16 < 4) return Status::InvalidArgument;
+        uint32_t const storage_class = code_[at + 3];
+        uint32_t const pointee       = pointee_of(code_[at + 1]);
+
+        switch (storage_class) {
+            case storage::PushConstant:
+                out_.pushConstantBytes = std::max(out_.pushConstantBytes, size_of(pointee, 0));
+                return Status::Ok;
+            case storage::Input:
+                if (!ids_[var].builtin && ids_[var].location < 32)
+                    out_.inputLocations |= 1u << ids_[var].location;
+                return Status::Ok;
+            case storage::UniformConstant:
+            case storage::Uniform:
+            case storage::StorageBuffer:
+                break;
+            default:
+                return Status::Ok;
+        }
+        if (ids_[var].binding == k_none)
+            return Status::Ok;
+
+        ShaderResourceBinding binding{
+            .set     = ids_[var].set == k_none ? 0 : ids_[var].set,
+            .binding = ids_[var].binding,
+            .count   = 1,
+            .kind    = ShaderResourceKind::UniformBuffer,
+        };
+        uint32_t type = pointee;
+        if (opcode_of(type) == op::TypeArray) {
+            binding.count = constant(operand(type, 3)).value_or(1);
+            type = operand(type, 2);
+        } else if (opcode_of(type) == op::TypeRuntimeArray) {
+            binding.count = 0;
+            type = operand(type, 2);
+        }
+        switch (opcode_of(type)) {
+            case op::TypeStruct:
+                binding.kind = storage_class == storage::StorageBuffer || ids_[type].buffer_block
+                    ? ShaderResourceKind::StorageBuffer : ShaderResourceKind::UniformBuffer;
+                break;
+            case op::TypeImage:
+                binding.kind = operand(type, 7) == k_image_storage ? ShaderResourceKind::StorageImage
+                                                                   : ShaderResourceKind::SampledImage;
+                break;
+            case op::TypeSampler:               binding.kind = ShaderResourceKind::Sampler; break;
+            case op::TypeSampledImage:          binding.kind = ShaderResourceKind::CombinedImageSampler; break;
+            case op::TypeAccelerationStructure: binding.kind = ShaderResourceKind::AccelerationStructure; break;
+            default: return Status::InvalidArgument;
+        }
+        if (out_.bindingCount < k_max_shader_bindings)
+            out_.bindings[out_.bindingCount] = binding;
+        ++out_.bindingCount;
+        return Status::Ok;
+    }
+
+    /// Bytes @p type occupies in an explicitly laid out block.
+    [[nodiscard]] uint32_t size_of(uint32_t type, uint32_t depth, uint32_t matrix_stride = 0) const noexcept {
+        if (depth > k_max_depth) return 0;
+        switch (opcode_of(type)) {
+            case op::TypeBool:    return 4;
+            case op::TypeInt:
+            case op::TypeFloat:   return operand(type, 2) / 8;
+            case op::TypeVector:  return operand(type, 3) * size_of(operand(type, 2), depth + 1);
+            case op::TypeMatrix:
+                return operand(type, 3) * (matrix_stride ? matrix_stride : size_of(operand(type, 2), depth + 1));
+            case op::TypePointer: return 8;  // buffer device address
+            case op::TypeArray: {
+                uint32_t const length = constant(operand(type, 3)).value_or(0);
+                uint32_t const stride = ids_[type].array_stride;
+                return length * (stride ? stride : size_of(operand(type, 2), depth + 1, matrix_stride));
+            }
+            case op::TypeStruct: {
+                uint32_t const at      = ids_[type].def;
+                uint32_t const members = (code_[at] >> 16) - 2;
+                uint32_t       size    = 0;
+                for (uint32_t i = 0; i < members; ++i) {
+                    MemberInfo const* m   = find_member(type, i);
+                    uint32_t const    end = (m ? m->offset : size) +
+                                            size_of(code_[at + 2 + i], depth + 1, m ? m->matrix_stride : 0);
+                    size = std::max(size, end);
+                }
+                return size;
+            }
+            default: return 0;
+        }
+    }
+
+    [[nodiscard]] IdInfo* id(uint32_t value) noexcept {
+        return value < ids_.size() ? &ids_[value] : nullptr;
+    }
+
+    [[nodiscard]] uint32_t opcode_of(uint32_t value) const noexcept {
+        return value < ids_.size() && ids_[value].def ? code_[ids_[value].def] & 0xffffu : 0;
+    }
+
+    /// Word @p index of the instruction defining @p value; 0 past its end.
+    [[nodiscard]] uint32_t operand(uint32_t value, uint32_t index) const noexcept {
+        if (value >= ids_.size() || !ids_[value].def) return 0;
+        uint32_t const at = ids_[value].def;
+        return index < (code_[at] >> 16) ? code_[at + index] : 0;
+    }
+
+    [[nodiscard]] uint32_t pointee_of(uint32_t pointer) const noexcept {
+        return opcode_of(pointer) == op::TypePointer ? operand(pointer, 3) : 0;
+    }
+
+    [[nodiscard]] std::optional<uint32_t> constant(uint32_t value) const noexcept {
+        uint32_t const opcode = opcode_of(value);
+        if ((opcode != op::Constant && opcode != op::SpecConstant) || (code_[ids_[value].def] >> 16) < 4)
+            return std::nullopt;
+        return operand(value, 3);
+    }
+
+    [[nodiscard]] ShaderEntryPoint* find_entry(uint32_t function) noexcept {
+        for (uint32_t i = 0; i < out_.entryPointCount; ++i) {
+            if (entry_ids_[i] == function) return &out_.entryPoints[i];
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] MemberInfo const* find_member(uint32_t type, uint32_t index) const noexcept {
+        auto const it = members_.find(member_key(type, index));
+        return it != members_.end() ? &it->second : nullptr;
+    }
+
+    std::span<uint32_t const> code_;
+    ShaderReflection&         out_;
+    std::vector<IdInfo>       ids_;
+    std::unordered_map<uint64_t, MemberInfo> members_;
+    std::vector<ModeId>       mode_ids_;
+    std::vector<uint32_t>     variables_;
+    uint32_t                  entry_ids_[k_max_shader_entry_points]{};
+};
+
+} // anonymous namespace
+
+Status reflect_spirv(std::span<uint32_t const> code, ShaderReflection& out) noexcept {
+    uint64_t const hash = out.hash;
+    out      = ShaderReflection{};
+    out.hash = hash;
+    try {
+        Parser parser{code, out};
+        if (Status s = parser.run(); s != Status::Ok) {
+            out      = ShaderReflection{};
+            out.hash = hash;
+            return s;
+        }
+    } catch (std::bad_alloc const&) {
+        out      = ShaderReflection{};
+        out.hash = hash;
+        return Status::OutOfMemory;
+    }
+    if (out.entryPointCount == 0)
+        return Status::InvalidArgument;
+    return Status::Ok;
+}
+
+} // namespace wren::rhi::vulkan::detail
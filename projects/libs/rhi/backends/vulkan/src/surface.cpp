@@ -0,0 +1,114 @@
+// Internal — not part of the public API.
+// Window-system surface creation. The VK_USE_PLATFORM_* defines are set for
+// this file only (see the backend's CMakeLists.txt), so the wren headers are
+// included before vulkan.h brings in the platform headers.
+
+#include "vk_surface.hpp"
+
+#include <array>
+#include <cstdint>
+
+#include <vulkan/vulkan.h>
+
+namespace wren::rhi::vulkan::detail {
+
+namespace {
+
+constexpr std::array k_surface_extensions{
+    VK_KHR_SURFACE_EXTENSION_NAME,
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    VK_KHR_WIN32_SURFACE_EXTENSION_NAME,
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    VK_KHR_XLIB_SURFACE_EXTENSION_NAME,
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME,
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+    VK_EXT_METAL_SURFACE_EXTENSION_NAME,
+#endif
+};
+
+/// The entry point @p name of @p instance as @p Fn; null when its extension
+/// is not enabled.
+template<class Fn>
+[[nodiscard]] Fn load(VkInstance instance, PFN_vkGetInstanceProcAddr get_proc, const char* name) noexcept {
+    return reinterpret_cast<Fn>(get_proc(instance, name));
+}
+
+} // anonymous namespace
+
+std::span<const char* const> surface_instance_extensions() noexcept {
+    return k_surface_extensions;
+}
+
+VkResult create_surface(VkInstance                instance,
+                        PFN_vkGetInstanceProcAddr get_proc,
+                        NativeWindow const&       window,
+                        VkSurfaceKHR*             out) noexcept
+{
+    *out = VK_NULL_HANDLE;
+    switch (window.system) {
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case WindowSystem::Win32: {
+            auto const create = load<PFN_vkCreateWin32SurfaceKHR>(instance, get_proc, "vkCreateWin32SurfaceKHR");
+            if (!create) break;
+            VkWin32SurfaceCreateInfoKHR const info{
+                .sType     = VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR,
+                .pNext     = nullptr,
+                .flags     = 0,
+                .hinstance = static_cast<HINSTANCE>(window.display),
+                .hwnd      = static_cast<HWND>(window.window),
+            };
+            return create(instance, &info, nullptr, out);
+        }
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+        case WindowSystem::Xlib: {
+            auto const create = load<PFN_vkCreateXlibSurfaceKHR>(instance, get_proc, "vkCreateXlibSurfaceKHR");
+            if (!create) break;
+            VkXlibSurfaceCreateInfoKHR const info{
+                .sType  = VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR,
+                .pNext  = nullptr,
+                .flags  = 0,
+                .dpy    = static_cast<Display*>(window.display),
+                .window = static_cast<Window>(reinterpret_cast<std::uintptr_t>(window.window)),
+            };
+            return create(instance, &info, nullptr, out);
+        }
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+        case WindowSystem::Wayland: {
+            auto const create = load<PFN_vkCreateWaylandSurfaceKHR>(instance, get_proc, "vkCreateWaylandSurfaceKHR");
+            if (!create) break;
+            VkWaylandSurfaceCreateInfoKHR const info{
+                .sType   = VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR,
+                .pNext   = nullptr,
+                .flags   = 0,
+                .display = static_cast<wl_display*>(window.display),
+                .surface = static_cast<wl_surface*>(window.window),
+            };
+            return create(instance, &info, nullptr, out);
+        }
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case WindowSystem::Metal: {
+            auto const create = load<PFN_vkCreateMetalSurfaceEXT>(instance, get_proc, "vkCreateMetalSurfaceEXT");
+            if (!create) break;
+            VkMetalSurfaceCreateInfoEXT const info{
+                .sType  = VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT,
+                .pNext  = nullptr,
+                .flags  = 0,
+                .pLayer = static_cast<CAMetalLayer const*>(window.window),
+            };
+            return create(instance, &info, nullptr, out);
+        }
+#endif
+        default:
+            break;
+    }
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+} // namespace wren::rhi::vulkan::detail
@@ -0,0 +1,622 @@
+#include <wren/rhi/vulkan/device.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <expected>
+#include <format>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <vulkan/vulkan_raii.hpp>
+
+#include "vk_bindless.hpp"
+#include "vk_commands.hpp"
+#include "vk_convert.hpp"
+#include "vk_deferred.hpp"
+#include "vk_device_impl.hpp"
+#include "vk_surface.hpp"
+#include "vk_swapchain.hpp"
+
+namespace wren::rhi::vulkan {
+
+namespace {
+
+// Formats tried after SwapchainDesc::format, in order; the first the surface
+// offers with the sRGB non-linear colour space wins.
+constexpr TextureFormat k_fallback_formats[] = {
+    TextureFormat::BGRA8_sRGB,
+    TextureFormat::RGBA8_sRGB,
+    TextureFormat::BGRA8_UNorm,
+    TextureFormat::RGBA8_UNorm,
+};
+
+[[nodiscard]] constexpr VkPresentModeKHR to_vk(PresentMode mode) noexcept {
+    switch (mode) {
+        case PresentMode::FifoRelaxed: return VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+        case PresentMode::Mailbox:     return VK_PRESENT_MODE_MAILBOX_KHR;
+        case PresentMode::Immediate:   return VK_PRESENT_MODE_IMMEDIATE_KHR;
+        case PresentMode::Fifo:        break;
+    }
+    return VK_PRESENT_MODE_FIFO_KHR;
+}
+
+[[nodiscard]] uint32_t graphics_target(VulkanDevice::Impl const& impl) noexcept {
+    return impl.commands.submit_target[queue_slot(QueueType::Graphics)];
+}
+
+// -----------------------------------------------------------------
+// Surface queries
+// -----------------------------------------------------------------
+
+/// The first of desc.format and k_fallback_formats the surface supports.
+/// UnsupportedFormat when it supports none of them.
+[[nodiscard]] Status choose_format(VulkanDevice::Impl const& impl, SwapchainState& sc) noexcept {
+    auto const* d   = sc.instance_dispatch;
+    auto const phys = static_cast<VkPhysicalDevice>(*impl.phys_device);
+
+    uint32_t count = 0;
+    if (VkResult r = d->vkGetPhysicalDeviceSurfaceFormatsKHR(phys, sc.surface, &count, nullptr); r != VK_SUCCESS)
+        return detail::to_status(r);
+    std::vector<VkSurfaceFormatKHR> formats;
+    try {
+        formats.resize(count);
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+    if (VkResult r = d->vkGetPhysicalDeviceSurfaceFormatsKHR(phys, sc.surface, &count, formats.data());
+        r != VK_SUCCESS && r != VK_INCOMPLETE)
+        return detail::to_status(r);
+
+    auto const offered = [&](TextureFormat f) {
+        auto const vk_format = static_cast<VkFormat>(detail::to_vk(f));
+        return std::ranges::any_of(formats, [&](VkSurfaceFormatKHR const& s) {
+            return s.format == vk_format && s.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+        });
+    };
+    TextureFormat chosen = sc.desc.format;
+    if (!offered(chosen)) {
+        auto const it = std::ranges::find_if(k_fallback_formats, offered);
+        if (it == std::ranges::end(k_fallback_formats))
+            return Status::UnsupportedFormat;
+        chosen = *it;
+    }
+    sc.texture_format = chosen;
+    sc.format         = static_cast<VkFormat>(detail::to_vk(chosen));
+    sc.color_space    = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+    return Status::Ok;
+}
+
+/// desc.presentMode, or its documented fallback (wren/rhi/api/swapchain.hpp).
+[[nodiscard]] Status choose_present_mode(VulkanDevice::Impl const& impl, SwapchainState& sc) noexcept {
+    auto const* d   = sc.instance_dispatch;
+    auto const phys = static_cast<VkPhysicalDevice>(*impl.phys_device);
+
+    VkPresentModeKHR modes[16]{};
+    uint32_t count = std::size(modes);
+    if (VkResult r = d->vkGetPhysicalDeviceSurfacePresentModesKHR(phys, sc.surface, &count, modes);
+        r != VK_SUCCESS && r != VK_INCOMPLETE)
+        return detail::to_status(r);
+
+    auto const offered = [&](PresentMode m) {
+        return std::find(modes, modes + count, to_vk(m)) != modes + count;
+    };
+    PresentMode fallback = PresentMode::Fifo;
+    switch (sc.desc.presentMode) {
+        case PresentMode::Mailbox:   fallback = PresentMode::Immediate; break;
+        case PresentMode::Immediate: fallback = PresentMode::Mailbox;   break;
+        default:                     break;
+    }
+    sc.mode = offered(sc.desc.presentMode) ? sc.desc.presentMode
+            : offered(fallback)            ? fallback
+                                           : PresentMode::Fifo;
+    return Status::Ok;
+}
+
+// -----------------------------------------------------------------
+// Images
+// -----------------------------------------------------------------
+
+/// Removes the image rows from the texture pool and releases their views and
+/// heap slots. The images themselves go with the swapchain.
+void release_images(VulkanDevice::Impl& impl, SwapchainState& sc) noexcept {
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    std::unique_lock lock{impl.textures_mutex};
+    for (TextureHandle h : sc.textures) {
+        if (auto row = impl.textures.extract(h)) {
+            release_bindless_texture(impl, std::get<3>(*row));
+            d->vkDestroyImageView(dev, static_cast<VkImageView>(std::get<1>(*row)), nullptr);
+        }
+    }
+    sc.textures.clear();
+    sc.images.clear();
+}
+
+/// Like release_images(), but queues the views, heap slots and present
+/// semaphores for deferred destruction, since the images may still be in
+/// flight or queued for display.
+void retire_images(VulkanDevice::Impl& impl, SwapchainState& sc) noexcept {
+    {
+        std::unique_lock lock{impl.textures_mutex};
+        for (TextureHandle h : sc.textures) {
+            if (auto row = impl.textures.extract(h))
+                defer_release(impl, std::move(*row));
+        }
+    }
+    for (VkSemaphore s : sc.present_semaphores)
+        defer_release(impl, vk::Semaphore{s});
+    sc.textures.clear();
+    sc.images.clear();
+    sc.present_semaphores.clear();
+}
+
+/// One texture row per swapchain image, plus the present semaphores.
+[[nodiscard]] Status adopt_images(VulkanDevice::Impl& impl, SwapchainState& sc) noexcept {
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    uint32_t count = 0;
+    if (VkResult r = d->vkGetSwapchainImagesKHR(dev, sc.swapchain, &count, nullptr); r != VK_SUCCESS)
+        return detail::to_status(r);
+    try {
+        sc.images.resize(count);
+        sc.textures.reserve(count);
+        sc.present_semaphores.reserve(count);
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+    if (VkResult r = d->vkGetSwapchainImagesKHR(dev, sc.swapchain, &count, sc.images.data()); r != VK_SUCCESS)
+        return detail::to_status(r);
+
+    TextureDesc const desc{
+        .format = sc.texture_format,
+        .usage  = sc.desc.usage | TextureUsage::Present,
+        .width  = sc.extent.width,
+        .height = sc.extent.height,
+    };
+    for (VkImage image : sc.images) {
+        VkImageViewCreateInfo const view_info{
+            .sType            = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+            .pNext            = nullptr,
+            .flags            = 0,
+            .image            = image,
+            .viewType         = VK_IMAGE_VIEW_TYPE_2D,
+            .format           = sc.format,
+            .components       = {},
+            .subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1},
+        };
+        VkImageView view = VK_NULL_HANDLE;
+        if (VkResult r = d->vkCreateImageView(dev, &view_info, nullptr, &view); r != VK_SUCCESS)
+            return detail::to_status(r);
+
+        auto const slots = acquire_bindless_texture(impl, vk::ImageView{view}, desc.usage);
+        if (!slots) {
+            d->vkDestroyImageView(dev, view, nullptr);
+            return slots.error();
+        }
+        try {
+            std::unique_lock lock{impl.textures_mutex};
+            sc.textures.push_back(impl.textures.insert(vk::Image{image}, vk::ImageView{view},
+                                                       MemoryAllocation{}, *slots, desc));
+        } catch (std::bad_alloc const&) {
+            release_bindless_texture(impl, *slots);
+            d->vkDestroyImageView(dev, view, nullptr);
+            return Status::OutOfMemory;
+        }
+        set_debug_name(impl, vk::ObjectType::eImage, reinterpret_cast<uint64_t>(image), sc.desc.debugName);
+    }
+
+    VkSemaphoreCreateInfo const semaphore_info{VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, nullptr, 0};
+    while (sc.present_semaphores.size() < count) {
+        VkSemaphore semaphore = VK_NULL_HANDLE;
+        if (VkResult r = d->vkCreateSemaphore(dev, &semaphore_info, nullptr, &semaphore); r != VK_SUCCESS)
+            return detail::to_status(r);
+        sc.present_semaphores.push_back(semaphore);
+    }
+    return Status::Ok;
+}
+
+// -----------------------------------------------------------------
+// (Re)creation
+// -----------------------------------------------------------------
+
+/// Creates the VkSwapchainKHR for the current surface state, retiring the
+/// previous one and deferring its destruction, and adopts its images.
+/// OutOfDate, with no swapchain left, while the surface has a zero extent
+/// (a minimised window).
+[[nodiscard]] Status build_swapchain(VulkanDevice::Impl& impl, SwapchainState& sc,
+                                     uint32_t width, uint32_t height) noexcept
+{
+    auto const* d   = impl.device.getDispatcher();
+    auto const dev  = static_cast<VkDevice>(*impl.device);
+    auto const phys = static_cast<VkPhysicalDevice>(*impl.phys_device);
+
+    VkSurfaceCapabilitiesKHR caps{};
+    if (VkResult r = sc.instance_dispatch->vkGetPhysicalDeviceSurfaceCapabilitiesKHR(phys, sc.surface, &caps);
+        r != VK_SUCCESS)
+        return detail::to_status(r);
+
+    // A current extent of 0xFFFFFFFF lets the swapchain pick its size.
+    VkExtent2D extent = caps.currentExtent;
+    if (extent.width == UINT32_MAX) {
+        extent.width  = std::clamp(width, caps.minImageExtent.width, caps.maxImageExtent.width);
+        extent.height = std::clamp(height, caps.minImageExtent.height, caps.maxImageExtent.height);
+    }
+
+    VkImageUsageFlags const usage = static_cast<VkImageUsageFlags>(detail::to_vk(sc.desc.usage));
+    if ((usage & ~caps.supportedUsageFlags) != 0)
+        return Status::InvalidArgument;
+
+    uint32_t images = sc.desc.imageCount ? sc.desc.imageCount : caps.minImageCount + 1;
+    images = std::max(images, caps.minImageCount);
+    if (caps.maxImageCount != 0)
+        images = std::min(images, caps.maxImageCount);
+
+    VkCompositeAlphaFlagBitsKHR alpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    if (!(caps.supportedCompositeAlpha & alpha))
+        alpha = static_cast<VkCompositeAlphaFlagBitsKHR>(caps.supportedCompositeAlpha &
+                                                         -caps.supportedCompositeAlpha);  // lowest set bit
+
+    VkSwapchainKHR const old = sc.swapchain;
+    sc.swapchain = VK_NULL_HANDLE;
+    sc.extent    = extent;
+
+    VkResult result = VK_ERROR_OUT_OF_DATE_KHR;
+    if (extent.width != 0 && extent.height != 0) {
+        VkSwapchainCreateInfoKHR const info{
+            .sType                 = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+            .pNext                 = nullptr,
+            .flags                 = 0,
+            .surface               = sc.surface,
+            .minImageCount         = images,
+            .imageFormat           = sc.format,
+            .imageColorSpace       = sc.color_space,
+            .imageExtent           = extent,
+            .imageArrayLayers      = 1,
+            .imageUsage            = usage,
+            .imageSharingMode      = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices   = nullptr,
+            .preTransform          = caps.currentTransform,
+            .compositeAlpha        = alpha,
+            .presentMode           = to_vk(sc.mode),
+            .clipped               = VK_TRUE,
+            .oldSwapchain          = old,
+        };
+        result = d->vkCreateSwapchainKHR(dev, &info, nullptr, &sc.swapchain);
+    }
+    // The old swapchain is retired even when creation fails.
+    if (old)
+        defer_release(impl, vk::SwapchainKHR{old});
+    if (result != VK_SUCCESS) {
+        sc.swapchain = VK_NULL_HANDLE;
+        return detail::to_status(result);
+    }
+
+    set_debug_name(impl, vk::ObjectType::eSwapchainKHR, reinterpret_cast<uint64_t>(sc.swapchain),
+                   sc.desc.debugName);
+    return adopt_images(impl, sc);
+}
+
+/// Everything create_swapchain() may have built, in reverse.
+void release_swapchain(VulkanDevice::Impl& impl, SwapchainState* sc) noexcept {
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    release_images(impl, *sc);
+    for (VkSemaphore s : sc->present_semaphores)
+        d->vkDestroySemaphore(dev, s, nullptr);
+    for (VkSemaphore s : sc->acquire_semaphores)
+        d->vkDestroySemaphore(dev, s, nullptr);
+    if (sc->swapchain)
+        d->vkDestroySwapchainKHR(dev, sc->swapchain, nullptr);
+    if (sc->surface)
+        sc->instance_dispatch->vkDestroySurfaceKHR(sc->instance, sc->surface, nullptr);
+    delete sc; // NOLINT
+}
+
+/// vkDeviceWaitIdle rather than a graphics queue wait: swapchains retired
+/// by resize_swapchain() sit in the deferred queue tagged with every
+/// queue's values, and all of them must go before the surface does.
+void wait_device_idle(VulkanDevice::Impl& impl) noexcept {
+    if (VkResult r = impl.device.getDispatcher()->vkDeviceWaitIdle(static_cast<VkDevice>(*impl.device));
+        r != VK_SUCCESS)
+        SPDLOG_ERROR("[wren/rhi/vulkan] vkDeviceWaitIdle failed: {}", vk::to_string(static_cast<vk::Result>(r)));
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Lifetime
+// -------------------------------------------------------------------------------------------------
+auto create_swapchain(VulkanDevice::Impl& impl, vk::raii::Instance const& instance,
+                      SwapchainDesc const& desc) noexcept -> std::expected<SwapchainState*, std::string>
+try {
+    if (!has_any(impl.capabilities.features, Feature::Presentation))
+        return std::unexpected{std::string{"the device was created without Feature::Presentation"}};
+    if (desc.window.system == WindowSystem::None || !desc.window.window)
+        return std::unexpected{std::string{"SwapchainDesc::window is empty"}};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto* sc = new SwapchainState{};
+    sc->instance          = static_cast<VkInstance>(*instance);
+    sc->instance_dispatch = instance.getDispatcher();
+    sc->desc              = desc;
+    sc->present_wait      = has_any(impl.capabilities.features, Feature::PresentWait);
+    sc->max_frame_latency = std::clamp(desc.maxFrameLatency, 1u, k_present_history);
+
+    auto const fail = [&](std::string message) -> std::expected<SwapchainState*, std::string> {
+        release_swapchain(impl, sc);
+        return std::unexpected{std::move(message)};
+    };
+
+    if (VkResult r = detail::create_surface(sc->instance, sc->instance_dispatch->vkGetInstanceProcAddr,
+                                            desc.window, &sc->surface);
+        r != VK_SUCCESS) {
+        sc->surface = VK_NULL_HANDLE;
+        return fail(std::format("surface creation failed: {} (is the window system's surface "
+                                "extension enabled on the instance?)",
+                                vk::to_string(static_cast<vk::Result>(r))));
+    }
+
+    // Present goes to the graphics queue; a family that cannot present to
+    // this surface would need a queue of its own.
+    VkBool32 supported = VK_FALSE;
+    sc->instance_dispatch->vkGetPhysicalDeviceSurfaceSupportKHR(
+        static_cast<VkPhysicalDevice>(*impl.phys_device), impl.queue_indices.graphics, sc->surface, &supported);
+    if (!supported)
+        return fail("the graphics queue family cannot present to this surface");
+
+    if (Status s = choose_format(impl, *sc); s != Status::Ok)
+        return fail(std::format("no usable surface format: {}", to_string(s)));
+    if (Status s = choose_present_mode(impl, *sc); s != Status::Ok)
+        return fail(std::format("present mode query failed: {}", to_string(s)));
+
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+    VkSemaphoreCreateInfo const semaphore_info{VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, nullptr, 0};
+    for (VkSemaphore& s : sc->acquire_semaphores) {
+        if (VkResult r = d->vkCreateSemaphore(dev, &semaphore_info, nullptr, &s); r != VK_SUCCESS)
+            return fail(std::format("vkCreateSemaphore failed: {}", vk::to_string(static_cast<vk::Result>(r))));
+    }
+
+    // A minimised window has no extent yet: the swapchain starts empty and
+    // acquire() reports OutOfDate until the first resize().
+    if (Status s = build_swapchain(impl, *sc, desc.width, desc.height); s != Status::Ok && s != Status::OutOfDate)
+        return fail(std::format("swapchain creation failed: {}", to_string(s)));
+
+    // The caller's string does not outlive this call; recreated swapchains
+    // stay unnamed.
+    sc->desc.debugName = nullptr;
+    return sc;
+} catch (std::bad_alloc const&) {
+    return std::unexpected{std::string{"out of memory"}};
+}
+
+void destroy_swapchain(VulkanDevice::Impl& impl, SwapchainState* swapchain) noexcept {
+    if (!swapchain) return;
+    wait_device_idle(impl);
+    collect_deferred(impl);
+    release_swapchain(impl, swapchain);
+}
+
+auto resize_swapchain(VulkanDevice::Impl& impl, SwapchainState& sc, uint32_t width, uint32_t height) noexcept
+    -> Status
+{
+    if (impl.commands.in_frame)
+        return Status::InvalidArgument;
+
+    // Nothing waits: the old images, their semaphores and the retired
+    // swapchain go once the graphics queue gets past the last present.
+    retire_images(impl, sc);
+    sc.acquired         = false;
+    sc.first_present_id = sc.present_count + 1;
+    return build_swapchain(impl, sc, width, height);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Frames
+// -------------------------------------------------------------------------------------------------
+auto acquire_swapchain_image(VulkanDevice::Impl& impl, SwapchainState& sc, uint64_t timeout_ns,
+                             SwapchainImage& out) noexcept -> Status
+{
+    out = {};
+    auto& ctx = impl.commands;
+    if (!ctx.in_frame || sc.acquired)
+        return Status::InvalidArgument;
+    if (!sc.swapchain)
+        return Status::OutOfDate;
+
+    auto const* d  = impl.device.getDispatcher();
+    auto const dev = static_cast<VkDevice>(*impl.device);
+
+    // One batch without command buffers on the graphics queue turns the
+    // binary acquire semaphore into a timeline value submissions can wait
+    // on. The lock is held across the acquire so that, once an image is
+    // acquired, queuing its batch cannot fail and strand the semaphore; with
+    // wait_for_present() pacing an image is free by the time acquire runs.
+    uint32_t const target = graphics_target(impl);
+    std::scoped_lock lock{ctx.pending_mutex};
+    auto& pending = ctx.pending[target];
+    try {
+        pending.waits.reserve(pending.waits.size() + 2);
+        pending.batches.reserve(pending.batches.size() + 1);
+        ctx.submit_scratch.reserve(pending.batches.size() + 1);
+        ctx.signal_scratch.reserve(pending.batches.size() + 1);
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+
+    VkSemaphore const semaphore = sc.acquire_semaphores[ctx.frame_slot];
+    uint32_t          index     = 0;
+    VkResult const    r = d->vkAcquireNextImageKHR(dev, sc.swapchain, timeout_ns, semaphore, VK_NULL_HANDLE, &index);
+    // Suboptimal still acquired an image and signals the semaphore; present()
+    // reports it.
+    if (r != VK_SUCCESS && r != VK_SUBOPTIMAL_KHR)
+        return r == VK_NOT_READY ? Status::Timeout : detail::to_status(r);
+
+    auto const first_wait  = static_cast<uint32_t>(pending.waits.size());
+    uint32_t const ordered = wait_for_sparse(ctx, target);
+    PendingBatch const batch{
+        .first_list = static_cast<uint32_t>(pending.lists.size()),
+        .list_count = 0,
+        .first_wait = first_wait,
+        .wait_count = ordered + 1,
+        .signal     = ++ctx.last_value[target],
+    };
+    pending.waits.push_back(VkSemaphoreSubmitInfo{
+        .sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+        .pNext       = nullptr,
+        .semaphore   = semaphore,
+        .value       = 0,
+        .stageMask   = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+        .deviceIndex = 0,
+    });
+    pending.batches.push_back(batch);
+
+    sc.image_index   = index;
+    sc.acquired      = true;
+    sc.acquire_frame = ctx.frame_number;
+    out = {sc.textures[index], index, SyncPoint{QueueType::Graphics, batch.signal}};
+    return Status::Ok;
+}
+
+auto present_swapchain(VulkanDevice::Impl& impl, SwapchainState& sc) noexcept -> Status {
+    auto& ctx = impl.commands;
+    if (ctx.in_frame || !sc.acquired)
+        return Status::InvalidArgument;
+    sc.acquired = false;
+
+    auto const* d         = impl.device.getDispatcher();
+    uint32_t const target = graphics_target(impl);
+    VkQueue const queue   = static_cast<VkQueue>(ctx.queues[target]);
+
+    // end_frame() has submitted everything up to last_value: once the
+    // timeline reaches it, the image is rendered and in the Present state.
+    // The bridge submit below signals the next value, so deferred releases
+    // made after the present know when its semaphore has been signalled.
+    uint64_t value  = 0;
+    uint64_t bridge = 0;
+    {
+        std::scoped_lock lock{ctx.pending_mutex};
+        value  = ctx.last_value[target];
+        bridge = ++ctx.last_value[target];
+    }
+    VkSemaphore const rendered = sc.present_semaphores[sc.image_index];
+    VkSemaphoreSubmitInfo const wait{
+        .sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+        .pNext       = nullptr,
+        .semaphore   = static_cast<VkSemaphore>(ctx.timelines[target]),
+        .value       = value,
+        .stageMask   = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+        .deviceIndex = 0,
+    };
+    VkSemaphoreSubmitInfo const signals[] = {
+        {
+            .sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .pNext       = nullptr,
+            .semaphore   = rendered,
+            .value       = 0,
+            .stageMask   = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+            .deviceIndex = 0,
+        },
+        {
+            .sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .pNext       = nullptr,
+            .semaphore   = static_cast<VkSemaphore>(ctx.timelines[target]),
+            .value       = bridge,
+            .stageMask   = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+            .deviceIndex = 0,
+        },
+    };
+    VkSubmitInfo2 const submit{
+        .sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+        .pNext                    = nullptr,
+        .flags                    = 0,
+        .waitSemaphoreInfoCount   = 1,
+        .pWaitSemaphoreInfos      = &wait,
+        .commandBufferInfoCount   = 0,
+        .pCommandBufferInfos      = nullptr,
+        .signalSemaphoreInfoCount = 2,
+        .pSignalSemaphoreInfos    = signals,
+    };
+    if (VkResult r = d->vkQueueSubmit2(queue, 1, &submit, VK_NULL_HANDLE); r != VK_SUCCESS)
+        return detail::to_status(r);
+
+    uint64_t const id = ++sc.present_count;
+    sc.present_values[id % k_present_history] = value;
+
+    VkPresentIdKHR const present_id{
+        .sType          = VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+        .pNext          = nullptr,
+        .swapchainCount = 1,
+        .pPresentIds    = &id,
+    };
+    VkPresentInfoKHR const info{
+        .sType              = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+        .pNext              = sc.present_wait ? &present_id : nullptr,
+        .waitSemaphoreCount = 1,
+        .pWaitSemaphores    = &rendered,
+        .swapchainCount     = 1,
+        .pSwapchains        = &sc.swapchain,
+        .pImageIndices      = &sc.image_index,
+        .pResults           = nullptr,
+    };
+    return detail::to_status(d->vkQueuePresentKHR(queue, &info));
+}
+
+auto wait_for_present(VulkanDevice::Impl& impl, SwapchainState& sc, uint64_t timeout_ns) noexcept -> Status {
+    sc.wait_ns = 0;
+    if (sc.present_count < sc.max_frame_latency)
+        return Status::Ok;
+
+    // Present `target` being on screen leaves maxFrameLatency - 1 queued.
+    uint64_t const target = sc.present_count + 1 - sc.max_frame_latency;
+    auto const*    d      = impl.device.getDispatcher();
+    auto const     dev    = static_cast<VkDevice>(*impl.device);
+    auto const     start  = std::chrono::steady_clock::now();
+
+    VkResult r = VK_SUCCESS;
+    if (sc.present_wait && sc.swapchain && target >= sc.first_present_id) {
+        r = d->vkWaitForPresentKHR(dev, sc.swapchain, target, timeout_ns);
+    } else {
+        // Without present wait (or across a resize), the GPU finishing the
+        // frame is the closest point the device can observe.
+        VkSemaphore const timeline = static_cast<VkSemaphore>(impl.commands.timelines[graphics_target(impl)]);
+        uint64_t const    value    = sc.present_values[target % k_present_history];
+        VkSemaphoreWaitInfo const info{
+            .sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+            .pNext          = nullptr,
+            .flags          = 0,
+            .semaphoreCount = 1,
+            .pSemaphores    = &timeline,
+            .pValues        = &value,
+        };
+        r = d->vkWaitSemaphores(dev, &info, timeout_ns);
+    }
+    sc.wait_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                           std::chrono::steady_clock::now() - start).count());
+    return detail::to_status(r);
+}
+
+void query_swapchain(SwapchainState const& sc, SwapchainInfo& out) noexcept {
+    out = SwapchainInfo{
+        .width        = sc.extent.width,
+        .height       = sc.extent.height,
+        .format       = sc.texture_format,
+        .presentMode  = sc.mode,
+        .imageCount   = static_cast<uint32_t>(sc.images.size()),
+        .presentWait  = sc.present_wait,
+        .presentCount = sc.present_count,
+        .waitNs       = sc.wait_ns,
+    };
+}
+
+} // namespace wren::rhi::vulkan
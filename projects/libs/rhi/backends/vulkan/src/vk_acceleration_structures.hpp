@@ -0,0 +1,75 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Compaction queries and recording behind BackendVTable's acceleration
+// structure entry points (acceleration_structures.cpp). The structures
+// themselves live in the pool of vk_device_impl.hpp.
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <span>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/vulkan/device.hpp>
+
+#include "vk_commands.hpp"
+
+namespace wren::rhi::vulkan {
+
+/// Compacted-size queries one frame slot can hand out.
+inline constexpr uint32_t k_max_compaction_queries = 4096;
+
+// -------------------------------------------------------------------------------------------------
+// Compaction queries
+//
+// A list that writes compacted sizes takes the next range of its frame
+// slot's pool with one atomic increment, resets it, writes it and copies it
+// into the caller's buffer, all in the list itself; no list reads it back
+// later, so the slot only needs its counter cleared when it is reused.
+// -------------------------------------------------------------------------------------------------
+struct CompactionQuerySlot {
+    VkQueryPool           pool = VK_NULL_HANDLE;
+    std::atomic<uint32_t> used{0};  // queries handed out, may exceed the capacity
+};
+
+// -------------------------------------------------------------------------------------------------
+// AccelerationStructureContext — member of VulkanDevice::Impl
+//
+// Disabled (no pools) without Feature::RayTracing.
+// -------------------------------------------------------------------------------------------------
+struct AccelerationStructureContext {
+    bool     enabled           = false;
+    bool     host_build        = false;  // Feature::AccelerationStructureHostBuild
+    uint64_t scratch_alignment = 1;      // minAccelerationStructureScratchOffsetAlignment
+
+    std::array<CompactionQuerySlot, k_max_frames_in_flight> slots;
+};
+
+/// Creates the compaction query pool of every frame slot when
+/// Feature::RayTracing is enabled. Call after init_commands().
+/// Throws vk::SystemError.
+void init_acceleration_structures(VulkanDevice::Impl& impl);
+
+/// Destroys the query pools. The device must be idle.
+void release_acceleration_structures(VulkanDevice::Impl& impl) noexcept;
+
+/// Hands @p slot's compaction queries to a new frame. The GPU work of the
+/// slot must be complete (begin_frame()).
+inline void recycle_compaction_queries(AccelerationStructureContext& ctx, uint32_t slot) noexcept {
+    ctx.slots[slot].used.store(0, std::memory_order_relaxed);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Recording — implementations of the BackendVTable acceleration structure entry points.
+// -------------------------------------------------------------------------------------------------
+void cmd_build_acceleration_structures(CommandListState& list,
+                                       std::span<AccelerationStructureBuild const> builds) noexcept;
+void cmd_write_compacted_sizes(CommandListState& list, std::span<AccelerationStructureHandle const> structures,
+                               BufferHandle dst, uint64_t offset) noexcept;
+void cmd_copy_acceleration_structure(CommandListState& list, AccelerationStructureHandle src,
+                                     AccelerationStructureHandle dst, AccelerationStructureCopyMode mode) noexcept;
+
+} // namespace wren::rhi::vulkan
@@ -0,0 +1,39 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Physical device queries, made once per GPU and driver and shared by
+// enumerate_adapters() and every VulkanDevice::create() (adapter_cache.cpp).
+
+#include <memory>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "vk_capabilities.hpp"
+
+namespace wren::rhi::vulkan::detail {
+
+// -------------------------------------------------------------------------------------------------
+// query_adapter
+//
+// Looks the queries of @p phys up in three places, keyed by vendor ID,
+// device ID, driver version, API version and pipelineCacheUUID — the base
+// properties, the one query always made:
+//
+//   1. the process-wide cache, filled by every earlier lookup;
+//   2. with @p cache_directory set, the file vulkan_<vendor>_<device>.wac
+//      in it, rejected when its key, Vulkan header version or payload hash
+//      does not match;
+//   3. the driver: one vkGetPhysicalDeviceFeatures2 and one
+//      vkGetPhysicalDeviceProperties2 with the full chains, plus the
+//      extension, memory, queue family and time domain lists. The result
+//      is written back to @p cache_directory.
+//
+// A driver update changes the key, so stale entries are never used; a file
+// that cannot be written is logged and otherwise ignored.
+// Thread-safe. Throws vk::SystemError when a driver query fails.
+// -------------------------------------------------------------------------------------------------
+[[nodiscard]] std::shared_ptr<AdapterQuery const> query_adapter(
+    vk::raii::PhysicalDevice const& phys,
+    const char*                      cache_directory);
+
+} // namespace wren::rhi::vulkan::detail
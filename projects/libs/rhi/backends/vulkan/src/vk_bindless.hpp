@@ -0,0 +1,128 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// The global bindless descriptor heap behind the BackendVTable bindless
+// queries, the pipeline layout's set 0 and the heap bind at the start of
+// every command list (bindless.cpp).
+
+#include <cstdint>
+#include <expected>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/resources.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/vulkan/device.hpp>
+
+#include "vk_memory.hpp"
+
+namespace wren::rhi::vulkan {
+
+// -------------------------------------------------------------------------------------------------
+// Slots
+//
+// Each descriptor array hands out indices from a free list, falling back to
+// the high-water mark. The free list is reserved for the whole capacity at
+// init, so releasing a slot never allocates.
+// -------------------------------------------------------------------------------------------------
+struct BindlessSlotAllocator {
+    uint32_t              capacity = 0;
+    uint32_t              next     = 0;  // first index never handed out
+    uint32_t              used     = 0;
+    std::vector<uint32_t> free;
+};
+
+/// Heap indices of one texture; k_invalid_bindless_index where it has none.
+/// Buffers only ever hold a StorageBuffer slot.
+struct BindlessSlots {
+    uint32_t sampled = k_invalid_bindless_index;
+    uint32_t storage = k_invalid_bindless_index;
+};
+
+// -------------------------------------------------------------------------------------------------
+// BindlessContext — member of VulkanDevice::Impl
+//
+// Descriptor-set mode: one update-after-bind set allocated from its own
+// pool. Descriptor-buffer mode (VK_EXT_descriptor_buffer): the same layout
+// written straight into a persistently mapped buffer with
+// vkGetDescriptorEXT. Either way the heap is written under `mutex` only
+// while a resource is created, destroyed or moved; the GPU ignores slots
+// no shader indexes.
+//
+// Samplers are a cache rather than a slot allocator: the static table
+// comes first, later samplers are appended on first request and kept for
+// the device's lifetime, so an index never changes meaning.
+// -------------------------------------------------------------------------------------------------
+struct BindlessContext {
+    bool enabled           = false;
+    bool descriptor_buffer = false;
+
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+    uint64_t              max_storage_range = 0;  // maxStorageBufferRange
+
+    // Descriptor-set mode.
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    VkDescriptorSet  set  = VK_NULL_HANDLE;
+
+    // Descriptor-buffer mode.
+    VkBuffer           buffer = VK_NULL_HANDLE;
+    MemoryAllocation   memory;
+    VkDeviceAddress    address      = 0;
+    VkBufferUsageFlags buffer_usage = 0;
+    uint64_t           binding_offsets[k_bindless_class_count]{};
+    uint64_t           descriptor_sizes[k_bindless_class_count]{};
+
+    // Guards the slot allocators and every descriptor write. Lock order:
+    // buffers_mutex / textures_mutex and MemoryContext::mutex first, then this.
+    mutable std::mutex    mutex;
+    BindlessSlotAllocator slots[k_bindless_class_count - 1];  // Sampler has no allocator
+
+    // Sampler cache. Lookups take `sampler_mutex` shared; a new sampler
+    // takes it exclusively, then `mutex` for its descriptor write.
+    mutable std::shared_mutex              sampler_mutex;
+    uint32_t                               sampler_capacity = 0;  // Sampler array length
+    uint32_t                               sampler_count    = 0;
+    VkSampler                              samplers[k_max_samplers]{};
+    SamplerDesc                            sampler_descs[k_max_samplers]{};
+    std::unordered_map<uint64_t, uint32_t> sampler_index;  // hash_state(desc) -> index
+};
+
+/// Creates the heap when Feature::DescriptorIndexing_Bindless is enabled,
+/// using a descriptor buffer when Feature::DescriptorBuffer and
+/// BufferDeviceAddress are as well. Call before init_pipelines().
+/// Throws vk::SystemError and std::bad_alloc.
+void init_bindless(VulkanDevice::Impl& impl);
+
+/// Destroys the heap. Every resource must have been released.
+void release_bindless(VulkanDevice::Impl& impl) noexcept;
+
+/// Adds a storage buffer to the heap and returns its index;
+/// k_invalid_bindless_index when the heap is disabled, OutOfMemory when the
+/// StorageBuffer array is full.
+[[nodiscard]] auto acquire_bindless_buffer(VulkanDevice::Impl& impl, vk::Buffer buffer,
+                                           uint64_t size) noexcept -> std::expected<uint32_t, Status>;
+
+/// Adds @p view to the SampledTexture and / or StorageTexture arrays as
+/// @p usage asks. OutOfMemory, with nothing acquired, when an array is full.
+[[nodiscard]] auto acquire_bindless_texture(VulkanDevice::Impl& impl, vk::ImageView view,
+                                            TextureUsage usage) noexcept
+    -> std::expected<BindlessSlots, Status>;
+
+/// Returns slots to their free lists; invalid indices are skipped.
+void release_bindless_buffer(VulkanDevice::Impl& impl, uint32_t index) noexcept;
+void release_bindless_texture(VulkanDevice::Impl& impl, BindlessSlots slots) noexcept;
+
+/// Points StorageBuffer slot @p index at @p buffer (defragment_memory()).
+void rewrite_bindless_buffer(VulkanDevice::Impl& impl, uint32_t index, vk::Buffer buffer,
+                             uint64_t size) noexcept;
+
+/// Binds the heap to set 0 of every bind point @p list's queue supports.
+/// Called by begin_command_list() right after vkBeginCommandBuffer.
+void cmd_bind_bindless_heap(CommandListState& list) noexcept;
+
+} // namespace wren::rhi::vulkan
@@ -0,0 +1,33 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Helpers shared by the on-disk caches (pipeline_cache.cpp,
+// adapter_cache.cpp).
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace wren::rhi::vulkan::detail {
+
+/// FNV-1a over 64-bit words; payloads are only checked for corruption,
+/// and word steps keep a cache of tens of MiB well under a millisecond.
+[[nodiscard]] inline uint64_t hash_payload(std::span<std::byte const> data) noexcept {
+    constexpr uint64_t k_prime = 0x100000001b3ull;
+    uint64_t h = 0xcbf29ce484222325ull;
+    std::size_t i = 0;
+    for (; i + 8 <= data.size(); i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data.data() + i, 8);
+        h = (h ^ word) * k_prime;
+    }
+    if (i < data.size()) {
+        uint64_t word = 0;
+        std::memcpy(&word, data.data() + i, data.size() - i);
+        h = (h ^ word) * k_prime;
+    }
+    return (h ^ data.size()) * k_prime;
+}
+
+} // namespace wren::rhi::vulkan::detail
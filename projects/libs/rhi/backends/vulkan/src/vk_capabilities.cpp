@@ -74,6 +74,11 @@ DeviceLimits extract_limits(vk::PhysicalDeviceLimits const& lim) noexcept {
     out.maxComputeWorkGroupSizeZ        = lim.maxComputeWorkGroupSize[2];
     out.maxComputeWorkGroupInvocations  = lim.maxComputeWorkGroupInvocations;
 
+    out.maxDrawIndirectCount = lim.maxDrawIndirectCount;
+
+    // Device creation raises it for a device group.
+    out.deviceCount = 1;
+
     // Vulkan timestamp precision is reported as timestampPeriod (nanoseconds per tick).
     // Convert to ticks/second: freq = 1e9 / period.
     out.timelineTickFrequency =
@@ -81,6 +86,9 @@ DeviceLimits extract_limits(vk::PhysicalDeviceLimits const& lim) noexcept {
             ? static_cast<uint64_t>(1'000'000'000.0 / static_cast<double>(lim.timestampPeriod))
             : 0u;
 
+    // Only graphics and compute queues are promised timestamps.
+    out.timestampPeriod = lim.timestampComputeAndGraphics == VK_TRUE ? lim.timestampPeriod : 0.0f;
+
     return out;
 }
 
@@ -109,16 +117,22 @@ Feature extract_features(
     set(Feature::TimelineSemaphore, feats12.timelineSemaphore == VK_TRUE);
 
     // --- Resource binding -------------------------------------------------------
-    // Bindless: needs both partial binding and runtime-sized arrays.
+    // Bindless: partial binding, runtime-sized arrays, and updates to the
+    // heap's unused slots while lists that bind it are pending (bindless.cpp).
     set(Feature::DescriptorIndexing_Bindless,
-        feats12.descriptorBindingPartiallyBound  == VK_TRUE &&
-        feats12.runtimeDescriptorArray           == VK_TRUE);
+        feats12.descriptorBindingPartiallyBound               == VK_TRUE &&
+        feats12.runtimeDescriptorArray                        == VK_TRUE &&
+        feats12.descriptorBindingSampledImageUpdateAfterBind  == VK_TRUE &&
+        feats12.descriptorBindingStorageImageUpdateAfterBind  == VK_TRUE &&
+        feats12.descriptorBindingStorageBufferUpdateAfterBind == VK_TRUE &&
+        feats12.descriptorBindingUpdateUnusedWhilePending     == VK_TRUE);
     set(Feature::DescriptorBuffer,   has_extension(exts, "VK_EXT_descriptor_buffer"));
     set(Feature::BufferDeviceAddress, feats12.bufferDeviceAddress == VK_TRUE);
 
     // --- Draw / dispatch --------------------------------------------------------
+    // Multi-draw plus the GPU-side count (vkCmdDraw*IndirectCount, 1.2 core).
     set(Feature::MultiDrawIndirect,
-        feats.multiDrawIndirect == VK_TRUE);
+        feats.multiDrawIndirect == VK_TRUE && feats12.drawIndirectCount == VK_TRUE);
 
     // --- Shader capabilities ----------------------------------------------------
     // Subgroup (wave ops): always present in Vulkan 1.1+ (we require 1.3).
@@ -152,7 +166,9 @@ Feature extract_features(
     // Persistent mapped buffers: always available via HOST_COHERENT + HOST_VISIBLE heaps.
     caps = caps | Feature::PersistentMappedBuffers;
 
-    set(Feature::SparseResources, feats.sparseBinding == VK_TRUE);
+    // Sparse textures page 2D images; buffers and 3D residency are unused.
+    set(Feature::SparseResources,
+        feats.sparseBinding == VK_TRUE && feats.sparseResidencyImage2D == VK_TRUE);
 
     // --- Dynamic rendering ------------------------------------------------------
     // Core in Vulkan 1.3 (feats13.dynamicRendering).
@@ -161,6 +177,10 @@ Feature extract_features(
     // --- Presentation -----------------------------------------------------------
     // VK_KHR_swapchain must be available (checked at device extension level).
     set(Feature::Presentation, has_extension(exts, "VK_KHR_swapchain"));
+    // Present pacing (informational; the feature bits are checked at device creation).
+    set(Feature::PresentWait,
+        has_extension(exts, VK_KHR_PRESENT_ID_EXTENSION_NAME) &&
+        has_extension(exts, VK_KHR_PRESENT_WAIT_EXTENSION_NAME));
 
     // --- Texture compression ----------------------------------------------------
     set(Feature::TexCompression_BC,       feats.textureCompressionBC       == VK_TRUE);
@@ -170,51 +190,129 @@ Feature extract_features(
     // --- Debug ------------------------------------------------------------------
     set(Feature::DebugMarkers_Labels, has_extension(exts, "VK_EXT_debug_utils"));
 
+    // --- Profiling (informational) ----------------------------------------------
+    // TimestampQueries also depends on a limit; make_adapter_info() adds it.
+    set(Feature::PipelineStatistics,   feats.pipelineStatisticsQuery == VK_TRUE);
+    set(Feature::CalibratedTimestamps, has_extension(exts, VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME));
+
+    // --- Memory budget (informational) ------------------------------------------
+    set(Feature::MemoryBudget, has_extension(exts, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME));
+
+    // --- Pipeline libraries (informational; fast linking checked at device creation)
+    set(Feature::GraphicsPipelineLibrary,
+        has_extension(exts, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+        has_extension(exts, VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME));
+
+    return caps;
+}
+
+// -------------------------------------------------------------------------------------------------
+Feature extract_queue_features(std::span<vk::QueueFamilyProperties const> families) noexcept {
+    using Q = vk::QueueFlagBits;
+    Feature caps = Feature::None;
+    for (auto const& family : families) {
+        if ((family.queueFlags & Q::eCompute) && !(family.queueFlags & Q::eGraphics))
+            caps = caps | Feature::AsyncCompute;
+        if ((family.queueFlags & Q::eTransfer) &&
+            !(family.queueFlags & (Q::eGraphics | Q::eCompute)))
+            caps = caps | Feature::AsyncTransfer;
+    }
     return caps;
 }
 
 // -------------------------------------------------------------------------------------------------
-AdapterInfo make_adapter_info(uint32_t index, vk::raii::PhysicalDevice const& phys) {
-    // Properties chain: base + driver properties.
-    auto props_chain = phys.getProperties2<
-        vk::PhysicalDeviceProperties2,
-        vk::PhysicalDeviceDriverProperties>();
-    auto const& props   = props_chain.get<vk::PhysicalDeviceProperties2>().properties;
-
-    // Features chain: base + Vulkan 1.2 + 1.3 promoted features.
-    auto feats_chain = phys.getFeatures2<
-        vk::PhysicalDeviceFeatures2,
-        vk::PhysicalDeviceVulkan12Features,
-        vk::PhysicalDeviceVulkan13Features>();
-    auto const& feats   = feats_chain.get<vk::PhysicalDeviceFeatures2>().features;
-    auto const& feats12 = feats_chain.get<vk::PhysicalDeviceVulkan12Features>();
-    auto const& feats13 = feats_chain.get<vk::PhysicalDeviceVulkan13Features>();
-
-    // Extension list.
-    auto const extensions = phys.enumerateDeviceExtensionProperties();
-
-    // Memory info for VRAM estimate.
-    auto const mem_props = phys.getMemoryProperties();
+AdapterInfo make_adapter_info(uint32_t index, AdapterQuery const& query) {
+    auto const& props   = query.base();
+    auto const& feats   = query.features.features2.features;
+    auto const& feats12 = query.features.vk12;
+    auto const& feats13 = query.features.vk13;
 
     // Build capabilities.
     Capabilities caps{};
     caps.backend         = wren::rhi::Backend::Vulkan;
     caps.apiVersionMajor = VK_API_VERSION_MAJOR(props.apiVersion);
     caps.apiVersionMinor = VK_API_VERSION_MINOR(props.apiVersion);
-    caps.features        = extract_features(feats, feats12, feats13, extensions);
+    caps.features        = extract_features(feats, feats12, feats13, query.extensions) |
+                           extract_queue_features(query.queue_families);
     caps.limits          = extract_limits(props.limits);
 
+    // Profiling writes timestamps on graphics and compute queues and resets
+    // the queries from the host.
+    if (caps.limits.timestampPeriod > 0.0f && feats12.hostQueryReset == VK_TRUE)
+        caps.features = caps.features | Feature::TimestampQueries;
+    else
+        caps.limits.timestampPeriod = 0.0f;
+
+    // Acceleration structure builds read their inputs through device
+    // addresses. Host builds also need the deferred operations extension,
+    // which acceleration_structures.cpp joins from the job system.
+    auto const& accel = query.features.accel_struct;
+    if (has_any(caps.features, Feature::RayTracing)) {
+        if (accel.accelerationStructure == VK_TRUE && feats12.bufferDeviceAddress == VK_TRUE) {
+            auto const& as_props = query.properties.accel_struct;
+            caps.limits.accelerationStructureScratchAlignment =
+                as_props.minAccelerationStructureScratchOffsetAlignment;
+            caps.limits.maxAccelerationStructureGeometryCount  = static_cast<uint32_t>(as_props.maxGeometryCount);
+            caps.limits.maxAccelerationStructureInstanceCount  = as_props.maxInstanceCount;
+            caps.limits.maxAccelerationStructurePrimitiveCount = as_props.maxPrimitiveCount;
+            if (accel.accelerationStructureHostCommands == VK_TRUE &&
+                has_extension(query.extensions, VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME))
+                caps.features = caps.features | Feature::AccelerationStructureHostBuild;
+        } else {
+            caps.features = static_cast<Feature>(static_cast<uint64_t>(caps.features) &
+                                                 ~static_cast<uint64_t>(Feature::RayTracing));
+        }
+    }
+
     AdapterInfo info{};
     info.index              = index;
     info.name               = std::string{props.deviceName.data()};
     info.kind               = to_adapter_kind(props.deviceType);
-    info.video_memory_bytes = device_local_heap_bytes(mem_props);
+    info.video_memory_bytes = device_local_heap_bytes(query.memory);
+    info.vendor_id          = props.vendorID;
+    info.device_id          = props.deviceID;
     info.driver_version     = props.driverVersion;
+    std::ranges::copy(props.pipelineCacheUUID, info.pipeline_cache_uuid.begin());
     info.api_version_major  = caps.apiVersionMajor;
     info.api_version_minor  = caps.apiVersionMinor;
+    info.device_group       = index;
+    info.device_group_size  = 1;
     info.capabilities       = std::move(caps);
 
     return info;
 }
 
+// -------------------------------------------------------------------------------------------------
+std::vector<std::vector<uint32_t>> physical_device_groups(
+    vk::raii::Instance const&                 instance,
+    std::span<vk::raii::PhysicalDevice const> devices)
+{
+    std::vector<std::vector<uint32_t>> groups;
+    for (auto const& group : instance.enumeratePhysicalDeviceGroups()) {
+        std::vector<uint32_t> members;
+        for (uint32_t m = 0; m < group.physicalDeviceCount; ++m) {
+            auto const it = std::ranges::find_if(devices, [&](vk::raii::PhysicalDevice const& d) {
+                return *d == group.physicalDevices[m];
+            });
+            if (it != devices.end())
+                members.push_back(static_cast<uint32_t>(it - devices.begin()));
+        }
+        if (!members.empty())
+            groups.push_back(std::move(members));
+    }
+    return groups;
+}
+
+// -------------------------------------------------------------------------------------------------
+void assign_device_groups(std::span<AdapterInfo>                 adapters,
+                          std::span<std::vector<uint32_t> const> groups) noexcept {
+    for (uint32_t g = 0; g < static_cast<uint32_t>(groups.size()); ++g) {
+        for (uint32_t member : groups[g]) {
+            if (member >= adapters.size()) continue;
+            adapters[member].device_group      = g;
+            adapters[member].device_group_size = static_cast<uint32_t>(groups[g].size());
+        }
+    }
+}
+
 } // namespace wren::rhi::vulkan::detail
@@ -6,6 +6,7 @@
 
 #include <span>
 #include <string_view>
+#include <vector>
 
 #include <vulkan/vulkan_raii.hpp>
 
@@ -14,6 +15,85 @@
 
 namespace wren::rhi::vulkan::detail {
 
+// -------------------------------------------------------------------------------------------------
+// Physical device queries
+//
+// Everything adapter enumeration and device creation read from a
+// VkPhysicalDevice, gathered once per device by query_adapter()
+// (vk_adapter_cache.hpp) and shared from there. Plain data, so the on-disk
+// capability cache stores it as bytes.
+// -------------------------------------------------------------------------------------------------
+
+/// Core and extension feature structs. Filled with the supported values by
+/// vkGetPhysicalDeviceFeatures2, then masked and passed to VkDeviceCreateInfo.
+/// Stored unlinked; link_feature_chain() wires pNext on a copy.
+struct DeviceFeatureChain {
+    vk::PhysicalDeviceFeatures2          features2{};
+    vk::PhysicalDeviceVulkan11Features   vk11{};
+    vk::PhysicalDeviceVulkan12Features   vk12{};
+    vk::PhysicalDeviceVulkan13Features   vk13{};
+
+    // Extension features — chained only when the matching extension is present.
+    vk::PhysicalDeviceMeshShaderFeaturesEXT              mesh_shader{};
+    vk::PhysicalDeviceRayTracingPipelineFeaturesKHR      ray_tracing{};
+    vk::PhysicalDeviceAccelerationStructureFeaturesKHR   accel_struct{};
+    vk::PhysicalDeviceDescriptorBufferFeaturesEXT        descriptor_buffer{};
+    vk::PhysicalDeviceFragmentShadingRateFeaturesKHR     fsr{};
+    vk::PhysicalDeviceFragmentShaderInterlockFeaturesEXT interlock{};
+    vk::PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT gpl{};
+    vk::PhysicalDevicePresentIdFeaturesKHR               present_id{};
+    vk::PhysicalDevicePresentWaitFeaturesKHR             present_wait{};
+};
+
+/// Property structs read beyond VkPhysicalDeviceProperties. The extension
+/// structs stay zero when their extension is absent.
+struct DevicePropertyChain {
+    vk::PhysicalDeviceProperties2                          properties2{};
+    vk::PhysicalDeviceVulkan12Properties                   vk12{};
+    vk::PhysicalDeviceDescriptorBufferPropertiesEXT        descriptor_buffer{};
+    vk::PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT gpl{};
+    vk::PhysicalDeviceAccelerationStructurePropertiesKHR   accel_struct{};
+};
+
+struct AdapterQuery {
+    DeviceFeatureChain                     features;        ///< Supported values, unlinked.
+    DevicePropertyChain                    properties;      ///< Unlinked.
+    vk::PhysicalDeviceMemoryProperties     memory{};
+    std::vector<vk::ExtensionProperties>   extensions;
+    std::vector<vk::QueueFamilyProperties> queue_families;
+    std::vector<vk::TimeDomainEXT>         time_domains;    ///< Empty without VK_EXT_calibrated_timestamps.
+
+    [[nodiscard]] vk::PhysicalDeviceProperties const& base() const noexcept {
+        return properties.properties2.properties;
+    }
+};
+
+/// Wires @p c's pNext for vkGetPhysicalDeviceFeatures2 / vkCreateDevice:
+/// the core structs, then the struct of each extension @p active accepts.
+/// Every pointer refers into @p c, so link again after copying it.
+template<class Active>
+void link_feature_chain(DeviceFeatureChain& c, Active const& active) noexcept {
+    c.features2.pNext = &c.vk11;
+    c.vk11.pNext      = &c.vk12;
+    c.vk12.pNext      = &c.vk13;
+    void** tail = &c.vk13.pNext;
+
+    auto append = [&](auto* s) {
+        *tail = s;
+        tail  = &s->pNext;
+    };
+    if (active("VK_EXT_mesh_shader"))               append(&c.mesh_shader);
+    if (active("VK_KHR_ray_tracing_pipeline")) {    append(&c.ray_tracing);
+                                                    append(&c.accel_struct); }
+    if (active("VK_EXT_descriptor_buffer"))         append(&c.descriptor_buffer);
+    if (active("VK_KHR_fragment_shading_rate"))     append(&c.fsr);
+    if (active("VK_EXT_fragment_shader_interlock")) append(&c.interlock);
+    if (active(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME)) append(&c.gpl);
+    if (active(VK_KHR_PRESENT_ID_EXTENSION_NAME))   append(&c.present_id);
+    if (active(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)) append(&c.present_wait);
+    *tail = nullptr;
+}
+
 // -------------------------------------------------------------------------------------------------
 // Extension helpers
 // -------------------------------------------------------------------------------------------------
@@ -52,6 +132,11 @@ namespace wren::rhi::vulkan::detail {
     vk::PhysicalDeviceVulkan13Features       const& feats13,
     std::span<vk::ExtensionProperties const>        extensions) noexcept;
 
+/// Reports Feature::AsyncCompute / AsyncTransfer when the adapter exposes
+/// the dedicated queue families select_queue_families() (device.cpp) picks.
+[[nodiscard]] Feature extract_queue_features(
+    std::span<vk::QueueFamilyProperties const> families) noexcept;
+
 /// Fills a DeviceLimits struct from a VkPhysicalDeviceLimits (part of
 /// VkPhysicalDeviceProperties).
 [[nodiscard]] DeviceLimits extract_limits(
@@ -65,10 +150,20 @@ namespace wren::rhi::vulkan::detail {
 /// Converts VkPhysicalDeviceType to AdapterKind.
 [[nodiscard]] AdapterKind to_adapter_kind(vk::PhysicalDeviceType type) noexcept;
 
-/// Builds a complete AdapterInfo from a physical device. Queries all
-/// relevant properties chain in a single vkGetPhysicalDeviceProperties2 call.
-[[nodiscard]] AdapterInfo make_adapter_info(
-    uint32_t                     index,
-    vk::raii::PhysicalDevice const& phys_device);
+/// Derives the AdapterInfo of physical device @p index from its queries,
+/// as a device group of one; assign_device_groups() corrects that.
+[[nodiscard]] AdapterInfo make_adapter_info(uint32_t index, AdapterQuery const& query);
+
+/// The physical device groups of @p instance, each as indices into @p devices
+/// in the group's own order, which is the device index order of a device
+/// created on the group.
+[[nodiscard]] std::vector<std::vector<uint32_t>> physical_device_groups(
+    vk::raii::Instance const&                 instance,
+    std::span<vk::raii::PhysicalDevice const> devices);
+
+/// Sets device_group and device_group_size of @p adapters, indexed like the
+/// devices physical_device_groups() was given.
+void assign_device_groups(std::span<AdapterInfo>                 adapters,
+                          std::span<std::vector<uint32_t> const> groups) noexcept;
 
 } // namespace wren::rhi::vulkan::detail
@@ -0,0 +1,285 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Per-frame, per-thread command pools and the timeline-semaphore submission
+// scheduler behind BackendVTable's frame, command-list and timeline entry
+// points (commands.cpp).
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/vulkan/device.hpp>
+
+namespace wren::rhi::vulkan {
+
+inline constexpr uint32_t k_max_frames_in_flight = 3;
+
+/// Queue slots: Graphics, Compute, Transfer. Present work goes to Graphics.
+inline constexpr uint32_t k_queue_slot_count = 3;
+
+[[nodiscard]] constexpr uint32_t queue_slot(QueueType type) noexcept {
+    switch (type) {
+        case QueueType::Compute:  return 1;
+        case QueueType::Transfer: return 2;
+        case QueueType::Graphics:
+        case QueueType::Present:  return 0;
+    }
+    return 0;
+}
+
+} // namespace wren::rhi::vulkan
+
+// -------------------------------------------------------------------------------------------------
+// Command list state
+//
+// Named CommandListState to match the forward declaration behind
+// wren::rhi::CommandListHandle. The dispatcher is cached so recording calls
+// reach the driver without touching the device.
+//
+// Open profiling regions (profiler.cpp) keep their record index per nesting
+// level, UINT32_MAX for regions that only carry a label; levels beyond
+// k_max_profile_region_depth are counted but not recorded.
+// -------------------------------------------------------------------------------------------------
+struct wren::rhi::CommandListState {
+    VkCommandBuffer                         cmd      = VK_NULL_HANDLE;
+    vk::raii::DeviceDispatcher const*       dispatch = nullptr;
+    wren::rhi::vulkan::VulkanDevice::Impl*  device   = nullptr;
+    wren::rhi::QueueType                    queue    = wren::rhi::QueueType::Graphics;
+    wren::rhi::CommandListLevel             level    = wren::rhi::CommandListLevel::Primary;
+    bool                                    recording = false;
+    uint32_t                                device_mask = 1;  // devices of the group it runs on
+
+    uint32_t profile_regions[wren::rhi::k_max_profile_region_depth]{};
+    uint32_t profile_depth            = 0;
+    uint32_t profile_statistics_level = UINT32_MAX;  // level of the open statistics query
+};
+
+namespace wren::rhi::vulkan {
+
+// -------------------------------------------------------------------------------------------------
+// Pools
+//
+// One VkCommandPool per (frame slot, recording thread, queue slot). Between
+// two begin_frame() calls only the thread bound to a pool touches it, so
+// begin_command_list() allocates without locking. Lists and their command
+// buffers survive the pool reset and are handed out again, so steady-state
+// frames allocate nothing.
+// -------------------------------------------------------------------------------------------------
+struct CommandPoolSlot {
+    vk::CommandPool              pool;
+    std::deque<CommandListState> lists[2];  // indexed by CommandListLevel; deque keeps addresses stable
+    uint32_t                     used[2]{};
+};
+
+struct ThreadCommandPools {
+    CommandPoolSlot queues[k_queue_slot_count];
+};
+
+struct FrameCommands {
+    // Allocated by each recording thread on its first list in this slot.
+    std::array<std::unique_ptr<ThreadCommandPools>, k_max_recording_threads> threads;
+
+    // Timeline value of each submit-target queue when the slot last ended;
+    // begin_frame() waits for all of them before recycling the pools.
+    uint64_t retire_values[k_queue_slot_count]{};
+};
+
+// -------------------------------------------------------------------------------------------------
+// Scheduler
+//
+// submit() appends one batch per call to its queue's pending arrays and
+// hands out the batch's signal value immediately; end_frame() turns the
+// batches into VkSubmitInfo2s pointing into those arrays. Timeline waits may
+// precede the matching signal, so the per-queue submit order in end_frame()
+// does not matter.
+//
+// bind_sparse() batches (sparse.cpp) share the queue's timeline but become
+// vkQueueBindSparse calls, which nothing orders against the queue's other
+// batches. The values a timeline is signalled with must rise in execution
+// order, so a bind waits for the value before its own, and the batch queued
+// right after a bind waits for the bind (wait_for_sparse()).
+// -------------------------------------------------------------------------------------------------
+struct PendingBatch {
+    uint32_t first_list  = 0;
+    uint32_t list_count  = 0;
+    uint32_t first_wait  = 0;
+    uint32_t wait_count  = 0;
+    uint64_t signal      = 0;
+    uint32_t first_image = 0;      // sparse batches: runs in PendingQueue::sparse_images
+    uint32_t image_count = 0;
+    bool     sparse      = false;
+};
+
+/// Consecutive binds of one image in a sparse batch, indexing page_binds,
+/// or tail_binds for mip tails.
+struct PendingSparseImage {
+    VkImage  image      = VK_NULL_HANDLE;
+    uint32_t first_bind = 0;
+    uint32_t bind_count = 0;
+    bool     tail       = false;
+};
+
+struct PendingQueue {
+    std::vector<PendingBatch>              batches;
+    std::vector<VkCommandBufferSubmitInfo> lists;
+    std::vector<VkSemaphoreSubmitInfo>     waits;
+
+    std::vector<PendingSparseImage>      sparse_images;
+    std::vector<VkSparseImageMemoryBind> page_binds;
+    std::vector<VkSparseMemoryBind>      tail_binds;
+
+    [[nodiscard]] bool empty() const noexcept { return batches.empty(); }
+    void clear() noexcept {
+        batches.clear();
+        lists.clear();
+        waits.clear();
+        sparse_images.clear();
+        page_binds.clear();
+        tail_binds.clear();
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+// CommandContext — member of VulkanDevice::Impl
+//
+// Frame fields are written by begin_frame() / end_frame() on the frame thread
+// and read by recording threads; the caller orders the two (a frame's jobs are
+// started after begin_frame() and joined before end_frame()).
+// -------------------------------------------------------------------------------------------------
+struct CommandContext {
+    uint64_t serial           = 0;   // process-unique; keys the thread-local pool bindings
+    uint32_t frames_in_flight = 2;
+    uint32_t frame_slot       = 0;
+    uint64_t frame_number     = 0;
+    bool     in_frame         = false;
+
+    std::atomic<uint32_t>                             next_thread_slot{0};
+    std::array<FrameCommands, k_max_frames_in_flight> frames;
+
+    // Queues by slot. Slots whose family fell back to another slot's family
+    // share its VkQueue, timeline and submissions: submit_target[s] is the
+    // lowest slot with the same family. Only target slots own a timeline.
+    vk::Queue     queues[k_queue_slot_count];
+    vk::Semaphore timelines[k_queue_slot_count];
+    uint32_t      families[k_queue_slot_count]{};
+    uint32_t      submit_target[k_queue_slot_count]{};
+
+    // Guarded by pending_mutex. last_value[s] is the value handed to the most
+    // recent submission on s; values are handed out in submission order.
+    // Written under the lock only; atomic so defer_release() can read it
+    // without taking it.
+    std::mutex            pending_mutex;
+    std::atomic<uint64_t> last_value[k_queue_slot_count]{};
+    PendingQueue          pending[k_queue_slot_count];
+
+    // Sparse binding queue: the submit-target slot binds go to, UINT32_MAX
+    // when no family of ours supports sparse binding, and the QueueType its
+    // SyncPoints name. sparse_value[s] is the value of the most recent bind
+    // on s; guarded by pending_mutex.
+    uint32_t  sparse_target = UINT32_MAX;
+    QueueType sparse_queue  = QueueType::Graphics;
+    uint64_t  sparse_value[k_queue_slot_count]{};
+
+    // end_frame() only.
+    std::vector<VkSubmitInfo2>         submit_scratch;
+    std::vector<VkSemaphoreSubmitInfo> signal_scratch;
+
+    // end_frame() only; bind_sparse() reserves them.
+    std::vector<VkSparseImageMemoryBindInfo>       sparse_page_scratch;
+    std::vector<VkSparseImageOpaqueMemoryBindInfo> sparse_tail_scratch;
+    std::vector<VkSemaphore>                       sparse_semaphore_scratch;
+    std::vector<uint64_t>                          sparse_value_scratch;
+};
+
+/// Appends to ctx.pending[target].waits the wait that orders a batch about
+/// to be queued on @p target after the bind it directly follows, if any.
+/// Returns the number of waits added. Caller holds pending_mutex and has
+/// reserved room for one more wait.
+[[nodiscard]] inline uint32_t wait_for_sparse(CommandContext& ctx, uint32_t target) noexcept {
+    uint64_t const value = ctx.sparse_value[target];
+    if (value == 0 || value != ctx.last_value[target])
+        return 0;
+    ctx.pending[target].waits.push_back(VkSemaphoreSubmitInfo{
+        .sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+        .pNext       = nullptr,
+        .semaphore   = static_cast<VkSemaphore>(ctx.timelines[target]),
+        .value       = value,
+        .stageMask   = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+        .deviceIndex = 0,
+    });
+    return 1;
+}
+
+/// Picks the sparse binding queue: Transfer, then Compute, then Graphics,
+/// whichever family first supports sparse binding (sparse.cpp). Called by
+/// init_commands() once the queues are known.
+void init_sparse(VulkanDevice::Impl& impl) noexcept;
+
+/// Issues one sparse batch of ctx.pending[slot] as a vkQueueBindSparse
+/// call (sparse.cpp). end_frame() only, under pending_mutex.
+[[nodiscard]] VkResult bind_sparse_batch(VulkanDevice::Impl& impl, uint32_t slot,
+                                         PendingBatch const& batch) noexcept;
+
+/// Fetches the queues and creates one timeline semaphore per queue.
+/// Throws vk::SystemError.
+void init_commands(VulkanDevice::Impl& impl, uint32_t frames_in_flight);
+
+/// Destroys every pool and timeline. The device must be idle.
+void release_commands(VulkanDevice::Impl& impl) noexcept;
+
+// -------------------------------------------------------------------------------------------------
+// Recording — implementations of the BackendVTable cmd_* entry points.
+// -------------------------------------------------------------------------------------------------
+void cmd_barriers(CommandListState& list, std::span<TextureBarrier const> textures,
+                  std::span<BufferBarrier const> buffers) noexcept;
+void cmd_copy_buffer(CommandListState& list, BufferHandle src, BufferHandle dst,
+                     std::span<BufferCopy const> regions) noexcept;
+void cmd_copy_buffer_to_texture(CommandListState& list, BufferHandle src, TextureHandle dst,
+                                std::span<BufferTextureCopy const> regions) noexcept;
+void cmd_copy_texture_to_buffer(CommandListState& list, TextureHandle src, BufferHandle dst,
+                                std::span<BufferTextureCopy const> regions) noexcept;
+void cmd_begin_rendering(CommandListState& list, RenderingDesc const& desc) noexcept;
+void cmd_end_rendering(CommandListState& list) noexcept;
+void cmd_set_viewport(CommandListState& list, Viewport const& viewport) noexcept;
+void cmd_set_scissor(CommandListState& list, Scissor const& scissor) noexcept;
+void cmd_bind_pipeline(CommandListState& list, PipelineHandle pipeline) noexcept;  // pipelines.cpp
+void cmd_push_constants(CommandListState& list, uint32_t offset, uint32_t size,
+                        void const* data) noexcept;                               // pipelines.cpp
+void cmd_bind_vertex_buffers(CommandListState& list, uint32_t first_binding,
+                             std::span<BufferHandle const> buffers,
+                             std::span<uint64_t const> offsets) noexcept;
+void cmd_bind_index_buffer(CommandListState& list, BufferHandle buffer, uint64_t offset,
+                           IndexType type) noexcept;
+void cmd_execute_command_lists(CommandListState& list,
+                               std::span<CommandListHandle const> secondaries) noexcept;
+void cmd_record_packets(CommandListState& list, std::span<CommandPacket const> packets) noexcept;
+void cmd_draw_indirect(CommandListState& list, IndirectDrawDesc const& desc, bool indexed) noexcept;
+void cmd_dispatch_indirect(CommandListState& list, BufferHandle buffer, uint64_t offset) noexcept;
+
+// Draws and dispatches resolve nothing, so they are forwarded inline.
+inline void cmd_draw(CommandListState const& list, uint32_t vertex_count, uint32_t instance_count,
+                     uint32_t first_vertex, uint32_t first_instance) noexcept {
+    list.dispatch->vkCmdDraw(list.cmd, vertex_count, instance_count, first_vertex, first_instance);
+}
+
+inline void cmd_draw_indexed(CommandListState const& list, uint32_t index_count,
+                             uint32_t instance_count, uint32_t first_index, int32_t vertex_offset,
+                             uint32_t first_instance) noexcept {
+    list.dispatch->vkCmdDrawIndexed(list.cmd, index_count, instance_count, first_index,
+                                    vertex_offset, first_instance);
+}
+
+inline void cmd_dispatch(CommandListState const& list, uint32_t x, uint32_t y, uint32_t z) noexcept {
+    list.dispatch->vkCmdDispatch(list.cmd, x, y, z);
+}
+
+} // namespace wren::rhi::vulkan
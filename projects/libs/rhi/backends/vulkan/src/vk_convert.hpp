@@ -0,0 +1,311 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Translates wren::rhi enums into their Vulkan equivalents. The mapping
+// tables live next to each enumerator in wren/rhi/api/enums.hpp.
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/features.hpp>
+#include <wren/rhi/api/status.hpp>
+
+namespace wren::rhi::vulkan::detail {
+
+[[nodiscard]] constexpr Status to_status(vk::Result result) noexcept {
+    switch (result) {
+        case vk::Result::eSuccess:                 return Status::Ok;
+        case vk::Result::eTimeout:                 return Status::Timeout;
+        case vk::Result::eErrorOutOfHostMemory:
+        case vk::Result::eErrorOutOfDeviceMemory:  return Status::OutOfMemory;
+        case vk::Result::eErrorFormatNotSupported: return Status::UnsupportedFormat;
+        case vk::Result::eSuboptimalKHR:
+        case vk::Result::eErrorOutOfDateKHR:       return Status::OutOfDate;
+        default:                                   return Status::InternalError;
+    }
+}
+
+[[nodiscard]] constexpr Status to_status(VkResult result) noexcept {
+    return to_status(static_cast<vk::Result>(result));
+}
+
+[[nodiscard]] constexpr vk::Format to_vk(TextureFormat format) noexcept {
+    switch (format) {
+        case TextureFormat::RGBA8_UNorm:     return vk::Format::eR8G8B8A8Unorm;
+        case TextureFormat::BGRA8_UNorm:     return vk::Format::eB8G8R8A8Unorm;
+        case TextureFormat::RGBA8_sRGB:      return vk::Format::eR8G8B8A8Srgb;
+        case TextureFormat::BGRA8_sRGB:      return vk::Format::eB8G8R8A8Srgb;
+        case TextureFormat::RG16_Float:      return vk::Format::eR16G16Sfloat;
+        case TextureFormat::RGBA16_Float:    return vk::Format::eR16G16B16A16Sfloat;
+        case TextureFormat::RGBA32_Float:    return vk::Format::eR32G32B32A32Sfloat;
+        case TextureFormat::R11G11B10_Float: return vk::Format::eB10G11R11UfloatPack32;
+        case TextureFormat::RGB10A2_UNorm:   return vk::Format::eA2B10G10R10UnormPack32;
+        case TextureFormat::D24S8:           return vk::Format::eD24UnormS8Uint;
+        case TextureFormat::D32:             return vk::Format::eD32Sfloat;
+        case TextureFormat::D32S8:           return vk::Format::eD32SfloatS8Uint;
+    }
+    return vk::Format::eUndefined;
+}
+
+[[nodiscard]] constexpr bool is_depth_format(TextureFormat format) noexcept {
+    return format == TextureFormat::D24S8 || format == TextureFormat::D32 || format == TextureFormat::D32S8;
+}
+
+[[nodiscard]] constexpr bool has_stencil(TextureFormat format) noexcept {
+    return format == TextureFormat::D24S8 || format == TextureFormat::D32S8;
+}
+
+[[nodiscard]] constexpr vk::SampleCountFlagBits to_vk(SampleCount samples) noexcept {
+    // SampleCount enumerators carry the sample count, which is also the
+    // VkSampleCountFlagBits bit value.
+    return static_cast<vk::SampleCountFlagBits>(static_cast<uint32_t>(samples));
+}
+
+[[nodiscard]] inline vk::BufferUsageFlags to_vk(BufferUsage usage) noexcept {
+    using B = vk::BufferUsageFlagBits;
+    auto const has = [usage](BufferUsage bit) { return underlying(usage & bit) != 0; };
+
+    vk::BufferUsageFlags out{};
+    if (has(BufferUsage::Vertex))      out |= B::eVertexBuffer;
+    if (has(BufferUsage::Index))       out |= B::eIndexBuffer;
+    if (has(BufferUsage::Uniform))     out |= B::eUniformBuffer;
+    if (has(BufferUsage::Storage))     out |= B::eStorageBuffer;
+    if (has(BufferUsage::Indirect))    out |= B::eIndirectBuffer;
+    if (has(BufferUsage::TransferSrc)) out |= B::eTransferSrc;
+    if (has(BufferUsage::TransferDst)) out |= B::eTransferDst;
+    if (has(BufferUsage::AccelerationStructureInput))
+        out |= B::eAccelerationStructureBuildInputReadOnlyKHR;
+    return out;
+}
+
+[[nodiscard]] constexpr vk::BuildAccelerationStructureFlagsKHR to_vk(AccelerationStructureFlags flags) noexcept {
+    // AllowUpdate .. PreferFastBuild share the VkBuildAccelerationStructureFlagBitsKHR bit positions.
+    return static_cast<vk::BuildAccelerationStructureFlagsKHR>(static_cast<uint32_t>(flags));
+}
+
+[[nodiscard]] inline vk::ImageUsageFlags to_vk(TextureUsage usage) noexcept {
+    using I = vk::ImageUsageFlagBits;
+    auto const has = [usage](TextureUsage bit) { return underlying(usage & bit) != 0; };
+
+    vk::ImageUsageFlags out{};
+    if (has(TextureUsage::Sampled))         out |= I::eSampled;
+    if (has(TextureUsage::Storage))         out |= I::eStorage;
+    if (has(TextureUsage::ColorAttachment)) out |= I::eColorAttachment;
+    if (has(TextureUsage::DepthStencilAtt)) out |= I::eDepthStencilAttachment;
+    if (has(TextureUsage::TransferSrc))     out |= I::eTransferSrc;
+    if (has(TextureUsage::TransferDst))     out |= I::eTransferDst;
+    return out;
+}
+
+[[nodiscard]] constexpr vk::ImageType to_vk(TextureDimension dimension) noexcept {
+    switch (dimension) {
+        case TextureDimension::Tex1D: return vk::ImageType::e1D;
+        case TextureDimension::Tex3D: return vk::ImageType::e3D;
+        case TextureDimension::Tex2D:
+        case TextureDimension::Cube:  return vk::ImageType::e2D;
+    }
+    return vk::ImageType::e2D;
+}
+
+[[nodiscard]] constexpr vk::ImageViewType to_vk_view_type(TextureDimension dimension,
+                                                          uint32_t         array_layers) noexcept {
+    switch (dimension) {
+        case TextureDimension::Tex1D: return array_layers > 1 ? vk::ImageViewType::e1DArray : vk::ImageViewType::e1D;
+        case TextureDimension::Tex2D: return array_layers > 1 ? vk::ImageViewType::e2DArray : vk::ImageViewType::e2D;
+        case TextureDimension::Tex3D: return vk::ImageViewType::e3D;
+        case TextureDimension::Cube:  return array_layers > 6 ? vk::ImageViewType::eCubeArray : vk::ImageViewType::eCube;
+    }
+    return vk::ImageViewType::e2D;
+}
+
+[[nodiscard]] constexpr vk::ImageAspectFlags aspect_mask(TextureFormat format) noexcept {
+    if (!is_depth_format(format))
+        return vk::ImageAspectFlagBits::eColor;
+    return has_stencil(format) ? vk::ImageAspectFlagBits::eDepth | vk::ImageAspectFlagBits::eStencil
+                               : vk::ImageAspectFlagBits::eDepth;
+}
+
+[[nodiscard]] constexpr vk::IndexType to_vk(IndexType type) noexcept {
+    switch (type) {
+        case IndexType::Uint16: return vk::IndexType::eUint16;
+        case IndexType::Uint32: return vk::IndexType::eUint32;
+        case IndexType::Uint8:  return vk::IndexType::eUint8EXT;
+    }
+    return vk::IndexType::eUint32;
+}
+
+// -----------------------------------------------------------------
+// Pipeline state
+// -----------------------------------------------------------------
+
+[[nodiscard]] constexpr vk::Format to_vk(VertexFormat format) noexcept {
+    switch (format) {
+        case VertexFormat::R32_Float:       return vk::Format::eR32Sfloat;
+        case VertexFormat::RG32_Float:      return vk::Format::eR32G32Sfloat;
+        case VertexFormat::RGB32_Float:     return vk::Format::eR32G32B32Sfloat;
+        case VertexFormat::RGBA32_Float:    return vk::Format::eR32G32B32A32Sfloat;
+        case VertexFormat::R8_UNorm:        return vk::Format::eR8Unorm;
+        case VertexFormat::RG8_UNorm:       return vk::Format::eR8G8Unorm;
+        case VertexFormat::RGBA8_UNorm:     return vk::Format::eR8G8B8A8Unorm;
+        case VertexFormat::BGRA8_UNorm:     return vk::Format::eB8G8R8A8Unorm;
+        case VertexFormat::RGBA8_SNorm:     return vk::Format::eR8G8B8A8Snorm;
+        case VertexFormat::RGB10A2_UNorm:   return vk::Format::eA2B10G10R10UnormPack32;
+        case VertexFormat::R11G11B10_Float: return vk::Format::eB10G11R11UfloatPack32;
+        case VertexFormat::R16_UInt:        return vk::Format::eR16Uint;
+        case VertexFormat::RG16_UInt:       return vk::Format::eR16G16Uint;
+        case VertexFormat::RGBA16_UInt:     return vk::Format::eR16G16B16A16Uint;
+        case VertexFormat::R32_UInt:        return vk::Format::eR32Uint;
+        case VertexFormat::RG32_UInt:       return vk::Format::eR32G32Uint;
+        case VertexFormat::RGBA32_UInt:     return vk::Format::eR32G32B32A32Uint;
+        case VertexFormat::R32_SInt:        return vk::Format::eR32Sint;
+        case VertexFormat::RG32_SInt:       return vk::Format::eR32G32Sint;
+        case VertexFormat::RGBA32_SInt:     return vk::Format::eR32G32B32A32Sint;
+    }
+    return vk::Format::eUndefined;
+}
+
+[[nodiscard]] constexpr vk::PrimitiveTopology to_vk(PrimitiveTopology topology) noexcept {
+    switch (topology) {
+        case PrimitiveTopology::PointList:     return vk::PrimitiveTopology::ePointList;
+        case PrimitiveTopology::LineList:      return vk::PrimitiveTopology::eLineList;
+        case PrimitiveTopology::LineStrip:     return vk::PrimitiveTopology::eLineStrip;
+        case PrimitiveTopology::TriangleList:  return vk::PrimitiveTopology::eTriangleList;
+        case PrimitiveTopology::TriangleStrip: return vk::PrimitiveTopology::eTriangleStrip;
+        case PrimitiveTopology::TriangleFan:   return vk::PrimitiveTopology::eTriangleFan;
+        case PrimitiveTopology::PatchList:     return vk::PrimitiveTopology::ePatchList;
+    }
+    return vk::PrimitiveTopology::eTriangleList;
+}
+
+[[nodiscard]] constexpr vk::CullModeFlags to_vk(CullMode mode) noexcept {
+    switch (mode) {
+        case CullMode::None:         return vk::CullModeFlagBits::eNone;
+        case CullMode::Front:        return vk::CullModeFlagBits::eFront;
+        case CullMode::Back:         return vk::CullModeFlagBits::eBack;
+        case CullMode::FrontAndBack: return vk::CullModeFlagBits::eFrontAndBack;
+    }
+    return vk::CullModeFlagBits::eNone;
+}
+
+[[nodiscard]] constexpr vk::FrontFace to_vk(FrontFace face) noexcept {
+    return face == FrontFace::CW ? vk::FrontFace::eClockwise : vk::FrontFace::eCounterClockwise;
+}
+
+[[nodiscard]] constexpr vk::PolygonMode to_vk(FillMode mode) noexcept {
+    return mode == FillMode::Wireframe ? vk::PolygonMode::eLine : vk::PolygonMode::eFill;
+}
+
+[[nodiscard]] constexpr vk::CompareOp to_vk(CompareOp op) noexcept {
+    // Same order as VkCompareOp.
+    return static_cast<vk::CompareOp>(static_cast<uint32_t>(op));
+}
+
+[[nodiscard]] constexpr vk::StencilOp to_vk(StencilOp op) noexcept {
+    // Same order as VkStencilOp.
+    return static_cast<vk::StencilOp>(static_cast<uint32_t>(op));
+}
+
+[[nodiscard]] constexpr vk::BlendFactor to_vk(BlendFactor factor) noexcept {
+    // Same order as VkBlendFactor.
+    return static_cast<vk::BlendFactor>(static_cast<uint32_t>(factor));
+}
+
+[[nodiscard]] constexpr vk::BlendOp to_vk(BlendOp op) noexcept {
+    // Same order as the core VkBlendOp values.
+    return static_cast<vk::BlendOp>(static_cast<uint32_t>(op));
+}
+
+[[nodiscard]] constexpr vk::ColorComponentFlags to_vk(ColorWriteMask mask) noexcept {
+    // R, G, B, A share the VkColorComponentFlagBits bit positions.
+    return static_cast<vk::ColorComponentFlags>(static_cast<uint32_t>(mask));
+}
+
+[[nodiscard]] constexpr vk::Filter to_vk(Filter filter) noexcept {
+    return filter == Filter::Linear ? vk::Filter::eLinear : vk::Filter::eNearest;
+}
+
+[[nodiscard]] constexpr vk::SamplerMipmapMode to_vk(MipmapMode mode) noexcept {
+    return mode == MipmapMode::Linear ? vk::SamplerMipmapMode::eLinear : vk::SamplerMipmapMode::eNearest;
+}
+
+[[nodiscard]] constexpr vk::SamplerAddressMode to_vk(AddressMode mode) noexcept {
+    // Same order as VkSamplerAddressMode.
+    return static_cast<vk::SamplerAddressMode>(static_cast<uint32_t>(mode));
+}
+
+[[nodiscard]] constexpr vk::BorderColor to_vk(BorderColor color) noexcept {
+    switch (color) {
+        case BorderColor::TransparentBlack: return vk::BorderColor::eFloatTransparentBlack;
+        case BorderColor::OpaqueBlack:      return vk::BorderColor::eFloatOpaqueBlack;
+        case BorderColor::OpaqueWhite:      return vk::BorderColor::eFloatOpaqueWhite;
+    }
+    return vk::BorderColor::eFloatTransparentBlack;
+}
+
+/// Translates a single ShaderStage bit.
+[[nodiscard]] constexpr vk::ShaderStageFlagBits to_vk_shader_stage(ShaderStage stage) noexcept {
+    using S = vk::ShaderStageFlagBits;
+    switch (stage) {
+        case ShaderStage::Vertex:       return S::eVertex;
+        case ShaderStage::TessControl:  return S::eTessellationControl;
+        case ShaderStage::TessEval:     return S::eTessellationEvaluation;
+        case ShaderStage::Geometry:     return S::eGeometry;
+        case ShaderStage::Fragment:     return S::eFragment;
+        case ShaderStage::Compute:      return S::eCompute;
+        case ShaderStage::Task:         return S::eTaskEXT;
+        case ShaderStage::Mesh:         return S::eMeshEXT;
+        case ShaderStage::RayGen:       return S::eRaygenKHR;
+        case ShaderStage::AnyHit:       return S::eAnyHitKHR;
+        case ShaderStage::ClosestHit:   return S::eClosestHitKHR;
+        case ShaderStage::Miss:         return S::eMissKHR;
+        case ShaderStage::Intersection: return S::eIntersectionKHR;
+        case ShaderStage::Callable:     return S::eCallableKHR;
+        default:                        break;
+    }
+    return S::eAll;
+}
+
+[[nodiscard]] constexpr vk::AttachmentLoadOp to_vk(LoadOp op) noexcept {
+    switch (op) {
+        case LoadOp::Load:     return vk::AttachmentLoadOp::eLoad;
+        case LoadOp::Clear:    return vk::AttachmentLoadOp::eClear;
+        case LoadOp::DontCare: return vk::AttachmentLoadOp::eDontCare;
+    }
+    return vk::AttachmentLoadOp::eLoad;
+}
+
+[[nodiscard]] constexpr vk::AttachmentStoreOp to_vk(StoreOp op) noexcept {
+    switch (op) {
+        case StoreOp::Store:    return vk::AttachmentStoreOp::eStore;
+        case StoreOp::DontCare: return vk::AttachmentStoreOp::eDontCare;
+    }
+    return vk::AttachmentStoreOp::eStore;
+}
+
+[[nodiscard]] constexpr vk::CommandBufferLevel to_vk(CommandListLevel level) noexcept {
+    return level == CommandListLevel::Secondary ? vk::CommandBufferLevel::eSecondary
+                                                : vk::CommandBufferLevel::ePrimary;
+}
+
+/// Pipeline stages that execute the shader stages in @p stages.
+[[nodiscard]] inline vk::PipelineStageFlags2 to_vk_pipeline_stages(ShaderStage stages) noexcept {
+    using P = vk::PipelineStageFlagBits2;
+    auto const has = [stages](ShaderStage bit) { return underlying(stages & bit) != 0; };
+
+    vk::PipelineStageFlags2 out{};
+    if (has(ShaderStage::Vertex))      out |= P::eVertexShader;
+    if (has(ShaderStage::TessControl)) out |= P::eTessellationControlShader;
+    if (has(ShaderStage::TessEval))    out |= P::eTessellationEvaluationShader;
+    if (has(ShaderStage::Geometry))    out |= P::eGeometryShader;
+    if (has(ShaderStage::Fragment))    out |= P::eFragmentShader;
+    if (has(ShaderStage::Compute))     out |= P::eComputeShader;
+    if (has(ShaderStage::Task))        out |= P::eTaskShaderEXT;
+    if (has(ShaderStage::Mesh))        out |= P::eMeshShaderEXT;
+    if (has(ShaderStage::RayGen | ShaderStage::AnyHit | ShaderStage::ClosestHit |
+            ShaderStage::Miss | ShaderStage::Intersection | ShaderStage::Callable))
+        out |= P::eRayTracingShaderKHR;
+    return out;
+}
+
+} // namespace wren::rhi::vulkan::detail
@@ -0,0 +1,84 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Deferred destruction: objects released while the GPU may still use them
+// wait here until every queue has passed the work submitted before the
+// release (resources.cpp).
+
+#include <atomic>
+#include <cstdint>
+#include <tuple>
+#include <variant>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/rhi/api/resources.hpp>
+#include <wren/rhi/vulkan/device.hpp>
+
+#include "vk_bindless.hpp"
+#include "vk_commands.hpp"
+#include "vk_memory.hpp"
+
+namespace wren::rhi::vulkan {
+
+// -------------------------------------------------------------------------------------------------
+// Released objects
+//
+// Pool rows as extract() returns them from the pools in vk_device_impl.hpp;
+// a deferred row is torn down exactly like an immediate one. Objects with no
+// pool row (pipelines, retired swapchains and their present semaphores)
+// travel as their plain handle.
+// -------------------------------------------------------------------------------------------------
+using BufferRow  = std::tuple<vk::Buffer, void*, MemoryAllocation, uint32_t, BufferDesc>;
+using TextureRow = std::tuple<vk::Image, vk::ImageView, MemoryAllocation, BindlessSlots, TextureDesc>;
+using HeapRow    = std::tuple<MemoryAllocation, MemoryHeapDesc>;
+
+using AccelerationStructureRow =
+    std::tuple<vk::AccelerationStructureKHR, uint64_t, vk::Buffer, MemoryAllocation, AccelerationStructureDesc>;
+
+using DeferredObject = std::variant<BufferRow, TextureRow, HeapRow, AccelerationStructureRow,
+                                    vk::Pipeline, vk::Semaphore, vk::SwapchainKHR>;
+
+/// values[s] is the submit-target timeline value last handed out on queue
+/// slot s when the object was released; zero for slots that are not targets.
+struct DeferredNode {
+    DeferredNode*  next = nullptr;
+    uint64_t       values[k_queue_slot_count]{};
+    DeferredObject object;
+};
+
+// -------------------------------------------------------------------------------------------------
+// DeferredContext — member of VulkanDevice::Impl
+//
+// Releasing threads push onto an intrusive stack with one compare-exchange;
+// only the frame thread pops. The stack is the only lock-free part of a
+// release: destroy_*() first extracts the rows from their pool under the
+// pool's exclusive lock. collect_deferred() takes the whole stack at
+// once, restores release order and appends it to the pending list, which
+// the frame thread alone walks. Release order matters where one object
+// depends on another: a heap is released after the textures placed in it,
+// a swapchain after its image views.
+// -------------------------------------------------------------------------------------------------
+struct DeferredContext {
+    std::atomic<DeferredNode*> incoming{nullptr};
+
+    // Frame thread only; oldest first.
+    DeferredNode* pending_head = nullptr;
+    DeferredNode* pending_tail = nullptr;
+};
+
+/// Queues @p object for destruction once every queue has passed the work
+/// submitted so far. Lock-free; any thread. Callers remove @p object from
+/// its pool first, under the pool's lock. If the node cannot be allocated
+/// the object is logged and leaked: waiting for the device here could stall
+/// on work the frame thread has not flushed yet.
+void defer_release(VulkanDevice::Impl& impl, DeferredObject object) noexcept;
+
+/// Destroys every queued object whose timeline values have been reached.
+/// Frame thread only; begin_frame() calls it once per frame.
+void collect_deferred(VulkanDevice::Impl& impl) noexcept;
+
+/// Destroys every queued object. The device must be idle.
+void release_deferred(VulkanDevice::Impl& impl) noexcept;
+
+} // namespace wren::rhi::vulkan
@@ -0,0 +1,158 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Definition of VulkanDevice::Impl, shared by the translation units that
+// implement VulkanDevice (device.cpp, resources.cpp, commands.cpp, memory.cpp,
+// pipeline_cache.cpp, pipelines.cpp, shaders.cpp, bindless.cpp, profiler.cpp,
+// swapchain.cpp, sparse.cpp, acceleration_structures.cpp).
+
+#include <memory>
+#include <shared_mutex>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/foundation/containers/slot_map.hpp>
+#include <wren/rhi/api/resources.hpp>
+#include <wren/rhi/vulkan/device.hpp>
+
+#include "vk_acceleration_structures.hpp"
+#include "vk_bindless.hpp"
+#include "vk_capabilities.hpp"
+#include "vk_commands.hpp"
+#include "vk_deferred.hpp"
+#include "vk_memory.hpp"
+#include "vk_pipeline_cache.hpp"
+#include "vk_pipelines.hpp"
+#include "vk_profiler.hpp"
+#include "vk_shaders.hpp"
+
+namespace wren::rhi::vulkan {
+
+// -------------------------------------------------------------------------------------------------
+// Resource pools
+//
+// One slot map per resource type. Columns are ordered hot to cold: the raw
+// Vulkan handle that command recording resolves comes first, the creation
+// descriptor (kept for validation and debugging) last. Memory comes from the
+// sub-allocator in memory.cpp, heap slots from bindless.cpp. extract()
+// yields the BufferRow / TextureRow / HeapRow / AccelerationStructureRow
+// tuples of vk_deferred.hpp.
+// -------------------------------------------------------------------------------------------------
+using BufferPool = foundation::containers::SlotMap<
+    BufferHandle,
+    vk::Buffer,        // 0: buffer
+    void*,             // 1: persistent mapping (Upload / Readback only)
+    MemoryAllocation,  // 2: backing memory
+    uint32_t,          // 3: StorageBuffer heap index (k_invalid_bindless_index if none)
+    BufferDesc>;       // 4: creation parameters (debugName cleared)
+
+using TexturePool = foundation::containers::SlotMap<
+    TextureHandle,
+    vk::Image,         // 0: image
+    vk::ImageView,     // 1: default view covering every mip and layer
+    MemoryAllocation,  // 2: backing memory
+    BindlessSlots,     // 3: heap indices of the default view
+    TextureDesc>;      // 4: creation parameters (debugName cleared)
+
+/// Aliasing heaps textures are placed into (TextureDesc::heap). Each is a
+/// dedicated allocation; the textures' rows hold placed allocations into it.
+using HeapPool = foundation::containers::SlotMap<
+    HeapHandle,
+    MemoryAllocation,  // 0: the heap's device memory
+    MemoryHeapDesc>;   // 1: creation parameters (debugName cleared)
+
+/// Acceleration structures, each at offset 0 of a buffer of its own that
+/// lives outside BufferPool, so defragment_memory() never moves it.
+using AccelerationStructurePool = foundation::containers::SlotMap<
+    AccelerationStructureHandle,
+    vk::AccelerationStructureKHR,  // 0: structure
+    uint64_t,                      // 1: instance reference (device address, or handle for Upload)
+    vk::Buffer,                    // 2: backing buffer
+    MemoryAllocation,              // 3: backing memory
+    AccelerationStructureDesc>;    // 4: creation parameters (debugName cleared)
+
+// -------------------------------------------------------------------------------------------------
+// Impl
+// -------------------------------------------------------------------------------------------------
+struct VulkanDevice::Impl {
+    vk::raii::PhysicalDevice           phys_device;
+    vk::raii::Device                   device;
+    QueueFamilyIndices                 queue_indices;
+    Capabilities                       capabilities;
+
+    // Physical device queries shared with every other device on this GPU
+    // (vk_adapter_cache.hpp); read them here instead of asking the driver.
+    std::shared_ptr<detail::AdapterQuery const> adapter;
+    vk::PhysicalDeviceMemoryProperties const&   memory_properties;
+
+    // Pools take an exclusive lock to insert / erase and a shared lock for
+    // lookups, so handle resolution on recording threads never serialises.
+    // Acceleration structure builds hold buffers_mutex while they take
+    // acceleration_structures_mutex.
+    mutable std::shared_mutex buffers_mutex;
+    BufferPool                buffers;
+    mutable std::shared_mutex textures_mutex;
+    TexturePool               textures;
+    mutable std::shared_mutex heaps_mutex;
+    HeapPool                  heaps;
+    mutable std::shared_mutex acceleration_structures_mutex;
+    AccelerationStructurePool acceleration_structures;
+
+    // Frames in flight, per-thread command pools and queued submissions.
+    CommandContext commands;
+
+    // Objects destroyed while the GPU may still use them.
+    DeferredContext deferred;
+
+    // Device memory blocks behind the pools above. Lock order when both are
+    // needed: buffers_mutex / textures_mutex / heaps_mutex first, then
+    // memory.mutex.
+    MemoryContext memory;
+
+    // Driver pipeline cache, persisted per GPU.
+    PipelineCacheContext pipeline_cache;
+
+    // Bindless descriptor heap; set 0 of the shared pipeline layout.
+    BindlessContext bindless;
+
+    // Pipeline objects and their background compile queue.
+    PipelineContext pipelines;
+
+    // Shader modules, one per distinct SPIR-V.
+    ShaderModuleContext shaders;
+
+    // Timestamp and pipeline-statistics query ring, one slot per frame in flight.
+    ProfilerContext profiler;
+
+    // Compacted-size query pools, one per frame in flight.
+    AccelerationStructureContext raytracing;
+
+    Impl(vk::raii::PhysicalDevice phys, vk::raii::Device dev,
+         QueueFamilyIndices qi, Capabilities caps,
+         std::shared_ptr<detail::AdapterQuery const> query)
+        : phys_device{std::move(phys)}
+        , device{std::move(dev)}
+        , queue_indices{qi}
+        , capabilities{std::move(caps)}
+        , adapter{std::move(query)}
+        , memory_properties{adapter->memory}
+    {}
+
+    /// Waits for the GPU, then drains the pipeline compile jobs and destroys
+    /// the pipelines, the shader modules and every deferred release, releases
+    /// the command and query pools, saves and destroys the pipeline cache,
+    /// and releases every resource, acceleration structure and memory heap
+    /// still alive in the pools, the bindless heap and the memory blocks
+    /// (resources.cpp).
+    ~Impl();
+
+    Impl(Impl const&)            = delete;
+    Impl& operator=(Impl const&) = delete;
+};
+
+/// Names @p object for debuggers and validation messages; a no-op without
+/// VK_EXT_debug_utils or when @p name is null (resources.cpp).
+void set_debug_name(VulkanDevice::Impl const& impl, vk::ObjectType type,
+                    uint64_t object, const char* name) noexcept;
+
+} // namespace wren::rhi::vulkan
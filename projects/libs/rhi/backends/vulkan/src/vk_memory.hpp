@@ -0,0 +1,124 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Device memory sub-allocator behind buffer and texture creation
+// (memory.cpp) and the bookkeeping defragment_memory() works on
+// (resources.cpp).
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/foundation/memory/tlsf_allocator.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/vulkan/device.hpp>
+
+namespace wren::rhi::vulkan {
+
+// -------------------------------------------------------------------------------------------------
+// Blocks
+//
+// Each memory type owns a list of large VkDeviceMemory blocks, sub-allocated
+// with TLSF. Host-visible blocks are mapped once for their whole lifetime.
+// When bufferImageGranularity is above 1, linear resources (buffers) and
+// optimal-tiling images never share a block, so no allocation has to be
+// padded to the granularity.
+//
+// Resources above half the preferred block size, and those the driver asks
+// to be dedicated, get a VkDeviceMemory of their own.
+// -------------------------------------------------------------------------------------------------
+enum class ResourceTiling : uint8_t { Linear, Optimal };
+
+struct MemoryBlock {
+    vk::DeviceMemory                  memory;
+    void*                             mapped = nullptr;
+    uint32_t                          type   = 0;
+    ResourceTiling                    tiling = ResourceTiling::Linear;
+    foundation::memory::TlsfAllocator tlsf;
+};
+
+struct MemoryTypeBlocks {
+    std::vector<std::unique_ptr<MemoryBlock>> blocks;
+    uint64_t                                  preferred_block_size = 0;
+};
+
+/// Memory backing one resource. Dedicated allocations own `memory` and have
+/// no block. Placed allocations point into a memory heap (HeapPool), which
+/// owns the memory; freeing them is a no-op.
+struct MemoryAllocation {
+    vk::DeviceMemory memory;
+    uint64_t         offset = 0;
+    uint64_t         size   = 0;
+    void*            mapped = nullptr;  // host-visible types only
+    MemoryBlock*     block  = nullptr;
+    uint32_t         node   = 0;        // TLSF node inside the block
+    uint32_t         type   = 0;
+    bool             placed = false;
+};
+
+struct MemoryRequest {
+    vk::MemoryRequirements requirements;
+    MemoryUsage            usage  = MemoryUsage::GpuOnly;
+    ResourceTiling         tiling = ResourceTiling::Linear;
+
+    /// Set when the driver prefers or requires a dedicated allocation, or the
+    /// resource is a large render target. The handle goes into
+    /// VkMemoryDedicatedAllocateInfo.
+    bool       dedicated = false;
+    vk::Buffer dedicated_buffer;
+    vk::Image  dedicated_image;
+};
+
+// -------------------------------------------------------------------------------------------------
+// MemoryContext — member of VulkanDevice::Impl
+// -------------------------------------------------------------------------------------------------
+struct MemoryContext {
+    uint64_t granularity          = 1;      // bufferImageGranularity
+    uint32_t max_allocation_count = 0;      // maxMemoryAllocationCount
+    bool     device_address       = false;  // allocate with VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT
+    bool     budget_extension     = false;  // VK_EXT_memory_budget is enabled
+    uint32_t device_count         = 1;      // physical devices of the device group
+
+    // Guards everything below.
+    std::mutex       mutex;
+    MemoryTypeBlocks types[VK_MAX_MEMORY_TYPES];
+    uint64_t         heap_block_bytes[VK_MAX_MEMORY_HEAPS]{};       // all VkDeviceMemory
+    uint64_t         heap_allocation_bytes[VK_MAX_MEMORY_HEAPS]{};  // held by resources
+    uint32_t         device_memory_count = 0;
+    uint32_t         allocation_count    = 0;
+};
+
+/// Reads the limits and picks per-type block sizes. Call once the
+/// capabilities are final.
+void init_memory(VulkanDevice::Impl& impl) noexcept;
+
+/// Frees every block. All resources must have been released.
+void release_memory(VulkanDevice::Impl& impl) noexcept;
+
+/// Sub-allocates or creates dedicated memory for @p request. Thread-safe.
+[[nodiscard]] auto allocate_memory(VulkanDevice::Impl& impl, MemoryRequest const& request) noexcept
+    -> std::expected<MemoryAllocation, Status>;
+
+/// Returns @p allocation. Empty blocks are released, except the last one of
+/// each type. Thread-safe.
+void free_memory(VulkanDevice::Impl& impl, MemoryAllocation const& allocation) noexcept;
+
+// -------------------------------------------------------------------------------------------------
+// Defragmentation support. The caller holds MemoryContext::mutex.
+// -------------------------------------------------------------------------------------------------
+
+/// Sub-allocates from @p block only; never creates device memory.
+[[nodiscard]] auto allocate_in_block(VulkanDevice::Impl& impl, MemoryBlock& block,
+                                     vk::MemoryRequirements const& requirements) noexcept
+    -> std::optional<MemoryAllocation>;
+
+/// free_memory() without taking the lock.
+void free_memory_locked(VulkanDevice::Impl& impl, MemoryAllocation const& allocation) noexcept;
+
+} // namespace wren::rhi::vulkan
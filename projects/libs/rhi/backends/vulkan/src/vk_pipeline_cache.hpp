@@ -0,0 +1,71 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// The VkPipelineCache every pipeline is created through, loaded from and
+// saved to DeviceDesc::pipelineCacheDirectory (pipeline_cache.cpp).
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/rhi/api/pipelines.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/vulkan/adapter.hpp>
+#include <wren/rhi/vulkan/device.hpp>
+
+namespace wren::rhi::vulkan {
+
+// -------------------------------------------------------------------------------------------------
+// PipelineCacheContext — member of VulkanDevice::Impl
+//
+// One file per GPU. Its header repeats the adapter key (vendor, device,
+// driver version, pipelineCacheUUID) and a hash of the payload; a file whose
+// key or hash does not match is ignored and overwritten on the next save.
+// -------------------------------------------------------------------------------------------------
+struct PipelineCacheContext {
+    vk::PipelineCache     cache;  // always valid; empty when nothing was loaded
+    std::filesystem::path path;   // empty when persistence is disabled
+
+    uint32_t                vendor_id      = 0;
+    uint32_t                device_id      = 0;
+    uint32_t                driver_version = 0;
+    std::array<uint8_t, 16> uuid{};
+
+    bool     loaded       = false;
+    uint64_t loaded_bytes = 0;
+
+    // Serialises saves. saved_size is the payload size of the file on disk,
+    // used to skip saves when no pipeline was added since.
+    std::mutex save_mutex;
+    uint64_t   saved_size  = 0;
+    uint64_t   saved_bytes = 0;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+};
+
+/// Creates the cache, seeded from @p directory's file for @p adapter when it
+/// is valid. @p directory may be null. Throws vk::SystemError.
+void init_pipeline_cache(VulkanDevice::Impl& impl, AdapterInfo const& adapter, const char* directory);
+
+/// Writes the cache file if persistence is enabled and the cache grew.
+[[nodiscard]] Status write_pipeline_cache(VulkanDevice::Impl& impl) noexcept;
+
+/// Writes the cache file, then destroys the cache.
+void release_pipeline_cache(VulkanDevice::Impl& impl) noexcept;
+
+/// Counts one pipeline creation from its creation feedback (core 1.3):
+/// a hit when the driver found the pipeline in the cache.
+inline void record_pipeline_feedback(PipelineCacheContext& ctx,
+                                     VkPipelineCreationFeedback const& feedback) noexcept {
+    if (!(feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT))
+        return;
+    bool const hit = feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT;
+    (hit ? ctx.hits : ctx.misses).fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace wren::rhi::vulkan
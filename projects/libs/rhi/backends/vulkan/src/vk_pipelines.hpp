@@ -0,0 +1,120 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Pipeline objects and the background compile queue behind BackendVTable's
+// pipeline entry points and cmd_bind_pipeline (pipelines.cpp).
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/foundation/containers/slot_map.hpp>
+#include <wren/foundation/jobs/job_system.hpp>
+#include <wren/rhi/api/pipelines.hpp>
+#include <wren/rhi/vulkan/device.hpp>
+
+#include "vk_shaders.hpp"
+
+namespace wren::rhi::vulkan {
+
+// -------------------------------------------------------------------------------------------------
+// Records
+//
+// A record is created with its handle and owns the pipeline for the handle's
+// lifetime. Creating a pipeline whose state equals a live one's hands out
+// another handle to the same record, so materials asking for the same few
+// hundred states compile each once. `state` and `pipeline` are read
+// lock-free on recording threads; every other field is guarded by
+// PipelineContext::mutex.
+// -------------------------------------------------------------------------------------------------
+enum class PipelineState : uint8_t { Queued, Compiling, Ready, Failed };
+
+struct PipelineShader {
+    ShaderStage                               stage = ShaderStage::None;
+    std::shared_ptr<ShaderModuleRecord const> module;  // kept alive until the pipeline is built
+    std::string                               entry_point;
+};
+
+/// Deep copy of a create descriptor, dropped once the pipeline is built.
+/// For graphics pipelines the fragment shader, if any, comes last.
+struct PipelineRecipe {
+    bool                        compute = false;
+    GraphicsPipelineDesc        graphics{};  // shaders / fallback / debugName cleared
+    std::vector<PipelineShader> shaders;
+};
+
+/// Parts a graphics pipeline was fast-linked from, kept for the optimised
+/// relink. Owned by PipelineContext::libraries, not by the record.
+struct PipelineLibraries {
+    VkPipeline parts[4]{};
+    uint32_t   count = 0;
+};
+
+struct PipelineRecord {
+    std::atomic<PipelineState> state{PipelineState::Queued};
+    std::atomic<VkPipeline>    pipeline{VK_NULL_HANDLE};
+    VkPipelineBindPoint        bind_point = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    PipelineHandle             fallback;
+    std::atomic<bool>          promoted{false};  // already moved to the queue front
+    std::string                debug_name;       // immutable after creation
+
+    std::unique_ptr<PipelineRecipe> recipe;
+    PipelineLibraries               libraries;
+    VkPipeline                      fast_linked = VK_NULL_HANDLE;  // replaced, kept until destroy
+    bool                            busy        = false;  // a thread is building it
+    bool                            destroyed   = false;  // last handle gone; the builder cleans up
+    uint64_t                        key         = 0;      // PipelineContext::by_key, immutable
+    uint32_t                        handles     = 1;      // pool rows sharing the record
+};
+
+using PipelinePool = foundation::containers::SlotMap<
+    PipelineHandle,
+    std::shared_ptr<PipelineRecord>>;  // 0: record; queue entries share it
+
+// -------------------------------------------------------------------------------------------------
+// Compile queue
+//
+// One job is spawned per queued build. A job does not compile the record it
+// was spawned for but the most urgent one left: the front of `queue`, or,
+// when that is empty, an optimised relink from `relink_queue`. Records moved
+// to the front leave a stale entry behind that later jobs skip, so the
+// queues may hold more entries than there are jobs, never fewer.
+// -------------------------------------------------------------------------------------------------
+struct PipelineContext {
+    VkPipelineLayout             layout = VK_NULL_HANDLE;  // shared by every pipeline
+    VkPipelineCreateFlags        create_flags = 0;         // added to every create info
+    foundation::jobs::JobSystem* jobs   = nullptr;
+    bool                         graphics_pipeline_library = false;
+
+    mutable std::shared_mutex pool_mutex;
+    PipelinePool              pool;
+
+    // Guards everything below and the guarded record fields.
+    std::mutex                                   mutex;
+    std::deque<std::shared_ptr<PipelineRecord>>  queue;
+    std::deque<std::shared_ptr<PipelineRecord>>  relink_queue;
+    std::vector<foundation::jobs::JobHandle>     in_flight;
+    std::unordered_map<uint64_t, VkPipeline>     libraries;  // keyed by part + state hash
+    std::unordered_map<uint64_t, std::weak_ptr<PipelineRecord>> by_key;  // live records, for sharing
+    bool                                         shutting_down = false;
+
+    std::atomic<uint64_t> hits{0};  // creations served by a live record
+};
+
+/// Creates the shared pipeline layout over the bindless heap and the push
+/// constant range, and reads whether graphics pipeline libraries are
+/// enabled. Call after init_bindless(). Throws vk::SystemError.
+void init_pipelines(VulkanDevice::Impl& impl, foundation::jobs::JobSystem* jobs);
+
+/// Waits for every compile job, then destroys all pipelines and libraries.
+void release_pipelines(VulkanDevice::Impl& impl) noexcept;
+
+} // namespace wren::rhi::vulkan
@@ -0,0 +1,105 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Timestamp and pipeline-statistics query ring behind BackendVTable's
+// profiling entry points (profiler.cpp).
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/foundation/system/platform.hpp>
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/vulkan/device.hpp>
+
+#include "vk_commands.hpp"
+
+namespace wren::rhi::vulkan {
+
+/// Host clock that calibrated timestamps are correlated with; it is the one
+/// std::chrono::steady_clock reads on each platform.
+#ifdef WREN_PLATFORM_WINDOWS
+inline constexpr VkTimeDomainEXT k_host_time_domain = VK_TIME_DOMAIN_QUERY_PERFORMANCE_COUNTER_EXT;
+#else
+inline constexpr VkTimeDomainEXT k_host_time_domain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT;
+#endif
+
+// -------------------------------------------------------------------------------------------------
+// Records
+//
+// A region takes the next record of its frame slot with one atomic
+// increment; its two timestamps are queries 2i and 2i + 1 of the slot's
+// pool. The record is written by the recording thread before the list is
+// submitted and read by begin_frame() once the slot has retired.
+// -------------------------------------------------------------------------------------------------
+struct ProfileRecord {
+    char      name[k_max_profile_region_name]{};
+    QueueType queue      = QueueType::Graphics;
+    uint32_t  depth      = 0;
+    uint32_t  statistics = UINT32_MAX;  // query in the statistics pool, if any
+};
+
+struct ProfileSlot {
+    VkQueryPool timestamps = VK_NULL_HANDLE;  // 2 × k_max_profile_regions
+    VkQueryPool statistics = VK_NULL_HANDLE;  // k_max_profile_statistics_regions
+
+    std::atomic<uint32_t> regions{0};          // records handed out, may exceed the capacity
+    std::atomic<uint32_t> statistics_used{0};
+    std::atomic<uint32_t> untimed{0};          // regions on queues without timestamps
+    uint64_t              frame_number = 0;    // frame that recorded into the slot; 0: none
+
+    std::unique_ptr<ProfileRecord[]> records;
+};
+
+// -------------------------------------------------------------------------------------------------
+// ProfilerContext — member of VulkanDevice::Impl
+//
+// Disabled (no pools, labels only) without Feature::TimestampQueries. The
+// resolved arrays are reserved at creation so a steady-state frame
+// allocates nothing; they are written by begin_frame() and read by
+// profile_frame(), both on the frame thread.
+// -------------------------------------------------------------------------------------------------
+struct ProfilerContext {
+    bool     enabled    = false;
+    bool     statistics = false;  // Feature::PipelineStatistics
+    bool     calibrated = false;  // Feature::CalibratedTimestamps
+    double   period_ns  = 0.0;    // DeviceLimits::timestampPeriod
+    uint64_t host_ticks_per_second = 1'000'000'000;  // of k_host_time_domain
+
+    // Valid timestamp bits per queue slot as a mask; 0 for queues without timestamps.
+    uint64_t timestamp_mask[k_queue_slot_count]{};
+
+    std::array<ProfileSlot, k_max_frames_in_flight> slots;
+
+    uint64_t                                                 resolved_frame   = 0;
+    uint32_t                                                 resolved_dropped = 0;
+    std::vector<ProfileRegion>                               resolved;
+    std::vector<std::array<char, k_max_profile_region_name>> resolved_names;  // behind ProfileRegion::name
+    std::vector<uint64_t>                                    timestamp_scratch;
+    std::vector<uint64_t>                                    statistics_scratch;
+};
+
+/// Creates and host-resets the query pools of every frame slot when
+/// Feature::TimestampQueries is enabled. Call after init_commands().
+/// Throws vk::SystemError and std::bad_alloc.
+void init_profiler(VulkanDevice::Impl& impl);
+
+/// Destroys the query pools. The device must be idle.
+void release_profiler(VulkanDevice::Impl& impl) noexcept;
+
+/// Reads back what @p slot recorded framesInFlight frames ago, resets its
+/// queries and hands it to the frame @p frame_number. The GPU work of the
+/// slot must be complete (begin_frame()).
+void recycle_profile_slot(VulkanDevice::Impl& impl, uint32_t slot, uint64_t frame_number) noexcept;
+
+// -------------------------------------------------------------------------------------------------
+// Recording — implementations of the BackendVTable profiling entry points.
+// -------------------------------------------------------------------------------------------------
+void cmd_begin_profile_region(CommandListState& list, ProfileRegionDesc const& desc) noexcept;
+void cmd_end_profile_region(CommandListState& list) noexcept;
+
+} // namespace wren::rhi::vulkan
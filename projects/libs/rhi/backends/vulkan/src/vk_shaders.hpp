@@ -0,0 +1,84 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Shader module cache behind BackendVTable's shader module entry points and
+// pipeline creation (shaders.cpp).
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/foundation/containers/slot_map.hpp>
+#include <wren/rhi/api/pipelines.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/vulkan/device.hpp>
+
+namespace wren::rhi::vulkan {
+
+// -------------------------------------------------------------------------------------------------
+// Records
+//
+// One record per distinct SPIR-V, immutable once published. Handles and
+// pipeline recipes share it; the driver module goes with the last owner.
+// Destroying a module never waits for the GPU: pipelines keep no reference
+// to the modules they were built from.
+// -------------------------------------------------------------------------------------------------
+struct ShaderModuleRecord {
+    VulkanDevice::Impl const* owner  = nullptr;
+    VkShaderModule            module = VK_NULL_HANDLE;
+    std::size_t               size   = 0;  // SPIR-V bytes
+    ShaderReflection          reflection{};
+
+    ShaderModuleRecord() = default;
+    ShaderModuleRecord(ShaderModuleRecord const&)            = delete;
+    ShaderModuleRecord& operator=(ShaderModuleRecord const&) = delete;
+    ~ShaderModuleRecord();
+};
+
+using ShaderModulePool = foundation::containers::SlotMap<
+    ShaderModuleHandle,
+    std::shared_ptr<ShaderModuleRecord const>>;  // 0: record
+
+// -------------------------------------------------------------------------------------------------
+// Context
+//
+// `by_hash` only observes records, so a module nothing uses any more is
+// destroyed at once; expired entries are swept when the map has doubled.
+// -------------------------------------------------------------------------------------------------
+struct ShaderModuleContext {
+    mutable std::shared_mutex pool_mutex;
+    ShaderModulePool          pool;
+
+    // Guards everything below.
+    mutable std::mutex                                                 mutex;
+    std::unordered_map<uint64_t, std::weak_ptr<ShaderModuleRecord const>> by_hash;
+    std::size_t                                                        sweep_at = 64;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> bytes{0};
+};
+
+/// Returns the record for @p code, reflecting it and creating its driver
+/// module unless identical code is already loaded. Status::InvalidArgument
+/// for code that is null, not a multiple of 4 bytes or not SPIR-V.
+/// Misaligned code is copied once; aligned code is read in place.
+[[nodiscard]] auto intern_shader_module(VulkanDevice::Impl& impl, void const* code, std::size_t size,
+                                        const char* debug_name) noexcept
+    -> std::expected<std::shared_ptr<ShaderModuleRecord const>, Status>;
+
+/// The record behind @p handle; null for a null or stale handle.
+[[nodiscard]] std::shared_ptr<ShaderModuleRecord const> find_shader_module(
+    ShaderModuleContext const& ctx, ShaderModuleHandle handle) noexcept;
+
+/// Drops every handle still alive. Call after release_pipelines(), which
+/// drops the recipes holding the rest.
+void release_shader_modules(VulkanDevice::Impl& impl) noexcept;
+
+} // namespace wren::rhi::vulkan
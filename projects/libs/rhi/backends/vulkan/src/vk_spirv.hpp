@@ -0,0 +1,76 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// SPIR-V content hashing and reflection behind the shader module cache
+// (spirv.cpp, shaders.cpp).
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include <wren/rhi/api/pipelines.hpp>
+#include <wren/rhi/api/status.hpp>
+
+namespace wren::rhi::vulkan::detail {
+
+/// 64-bit content hash the module cache keys on: four xxHash64-style lanes
+/// over 32 bytes a step, so hashing a level's worth of SPIR-V costs far less
+/// than reading it. Unlike hash_payload (vk_cache_file.hpp), collisions
+/// matter here — equal hashes share a module — so every word is mixed
+/// through a multiply-rotate round and the result through an avalanche.
+[[nodiscard]] inline uint64_t hash_spirv(std::span<uint32_t const> code) noexcept {
+    constexpr uint64_t k_p1 = 0x9e3779b185ebca87ull;
+    constexpr uint64_t k_p2 = 0xc2b2ae3d27d4eb4full;
+    constexpr uint64_t k_p3 = 0x165667b19e3779f9ull;
+    constexpr uint64_t k_p4 = 0x85ebca77c2b2ae63ull;
+    constexpr uint64_t k_p5 = 0x27d4eb2f165667c5ull;
+
+    auto const round = [](uint64_t acc, uint64_t lane) noexcept {
+        return std::rotl(acc + lane * k_p2, 31) * k_p1;
+    };
+    auto const merge = [&round](uint64_t h, uint64_t acc) noexcept {
+        return (h ^ round(0, acc)) * k_p1 + k_p4;
+    };
+    auto const load = [&code](std::size_t word) noexcept {
+        uint64_t lane;
+        std::memcpy(&lane, code.data() + word, sizeof(lane));
+        return lane;
+    };
+
+    std::size_t const words = code.size();
+    std::size_t       i     = 0;
+    uint64_t          h;
+    if (words >= 8) {
+        uint64_t v[4]{k_p1 + k_p2, k_p2, 0, 0 - k_p1};
+        for (; i + 8 <= words; i += 8) {
+            for (uint32_t l = 0; l < 4; ++l)
+                v[l] = round(v[l], load(i + 2 * l));
+        }
+        h = std::rotl(v[0], 1) + std::rotl(v[1], 7) + std::rotl(v[2], 12) + std::rotl(v[3], 18);
+        for (uint64_t lane : v)
+            h = merge(h, lane);
+    } else {
+        h = k_p5;
+    }
+    h += static_cast<uint64_t>(words) * sizeof(uint32_t);
+
+    for (; i + 2 <= words; i += 2)
+        h = std::rotl(h ^ round(0, load(i)), 27) * k_p1 + k_p4;
+    if (i < words)
+        h = std::rotl(h ^ (code[i] * k_p1), 23) * k_p2 + k_p3;
+
+    h ^= h >> 33;
+    h *= k_p2;
+    h ^= h >> 29;
+    h *= k_p3;
+    h ^= h >> 32;
+    return h;
+}
+
+/// Parses the entry points, descriptor bindings, push constant block and
+/// stage inputs @p code declares into @p out; `out.hash` is left alone.
+/// Status::InvalidArgument when @p code is not well-formed SPIR-V.
+[[nodiscard]] Status reflect_spirv(std::span<uint32_t const> code, ShaderReflection& out) noexcept;
+
+} // namespace wren::rhi::vulkan::detail
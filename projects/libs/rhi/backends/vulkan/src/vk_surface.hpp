@@ -0,0 +1,29 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Window-system surfaces (surface.cpp), the only translation unit built with
+// the VK_USE_PLATFORM_* defines. Their platform headers — Xlib above all —
+// define macros such as None, Bool and Status that clash with wren::rhi
+// names, so nothing here pulls them in.
+
+#include <span>
+
+#include <vulkan/vulkan_core.h>
+
+#include <wren/rhi/api/swapchain.hpp>
+
+namespace wren::rhi::vulkan::detail {
+
+/// VK_KHR_surface followed by the surface extension of every window system
+/// this build supports. create_instance() enables those available.
+[[nodiscard]] std::span<const char* const> surface_instance_extensions() noexcept;
+
+/// Creates a surface for @p window through the instance-level entry point
+/// @p get_proc resolves. VK_ERROR_EXTENSION_NOT_PRESENT when the build does
+/// not support the window system or its extension is not enabled.
+[[nodiscard]] VkResult create_surface(VkInstance                instance,
+                                      PFN_vkGetInstanceProcAddr get_proc,
+                                      NativeWindow const&       window,
+                                      VkSurfaceKHR*             out) noexcept;
+
+} // namespace wren::rhi::vulkan::detail
@@ -0,0 +1,110 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Swapchains behind BackendVTable's presentation entry points
+// (swapchain.cpp). Frame thread only, like begin_frame() / end_frame().
+
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/api/swapchain.hpp>
+#include <wren/rhi/vulkan/device.hpp>
+
+#include "vk_commands.hpp"
+
+namespace wren::rhi::vulkan {
+
+/// Presents whose graphics timeline value is kept for the GPU-side
+/// fallback of wait_for_present(); bounds SwapchainDesc::maxFrameLatency.
+inline constexpr uint32_t k_present_history = 8;
+
+} // namespace wren::rhi::vulkan
+
+// -------------------------------------------------------------------------------------------------
+// Swapchain state
+//
+// Named SwapchainState to match the forward declaration behind
+// wren::rhi::SwapchainHandle.
+//
+// Each image is a row of the device's texture pool with no memory of its
+// own (release_texture() leaves the image to the swapchain). Acquire
+// semaphores are per frame slot: begin_frame() has waited for the batch that
+// consumed a slot's semaphore before the slot acquires again. Present
+// semaphores are per image, since an image is only re-acquired once the
+// presentation engine is done with its previous present.
+// -------------------------------------------------------------------------------------------------
+struct wren::rhi::SwapchainState {
+    VkInstance                          instance = VK_NULL_HANDLE;
+    vk::raii::InstanceDispatcher const* instance_dispatch = nullptr;
+    VkSurfaceKHR                        surface   = VK_NULL_HANDLE;
+    VkSwapchainKHR                      swapchain = VK_NULL_HANDLE;
+
+    wren::rhi::SwapchainDesc desc{};          // creation parameters (debugName cleared)
+    VkFormat                 format      = VK_FORMAT_UNDEFINED;
+    VkColorSpaceKHR          color_space = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+    wren::rhi::TextureFormat texture_format = wren::rhi::TextureFormat::BGRA8_sRGB;
+    wren::rhi::PresentMode   mode        = wren::rhi::PresentMode::Fifo;   // after fallback
+    VkExtent2D               extent{};
+
+    std::vector<VkImage>                  images;
+    std::vector<wren::rhi::TextureHandle> textures;
+    std::vector<VkSemaphore>              present_semaphores;  // per image
+    VkSemaphore acquire_semaphores[wren::rhi::vulkan::k_max_frames_in_flight]{};
+
+    uint32_t image_index   = 0;
+    bool     acquired      = false;  // acquire() handed out image_index, present() not called yet
+    uint64_t acquire_frame = 0;      // frame_number of the last acquire
+
+    // Present ids are the present count: present n carries id n. Ids from
+    // before the last resize belong to a retired swapchain, which rules
+    // them out for vkWaitForPresentKHR.
+    bool     present_wait     = false;
+    uint64_t first_present_id = 1;
+    uint64_t present_count    = 0;
+    uint64_t present_values[wren::rhi::vulkan::k_present_history]{};  // graphics timeline, by id % history
+
+    uint32_t max_frame_latency = 1;
+    uint64_t wait_ns           = 0;
+};
+
+namespace wren::rhi::vulkan {
+
+/// Creates the surface, the swapchain and its texture rows. The error names
+/// what failed; @p instance must outlive the swapchain.
+[[nodiscard]] auto create_swapchain(VulkanDevice::Impl& impl, vk::raii::Instance const& instance,
+                                    SwapchainDesc const& desc) noexcept
+    -> std::expected<SwapchainState*, std::string>;
+
+/// Waits for the device and collects the deferred releases, then releases
+/// the texture rows, the semaphores, the swapchain and the surface.
+void destroy_swapchain(VulkanDevice::Impl& impl, SwapchainState* swapchain) noexcept;
+
+/// Recreates the swapchain at the new size without waiting for the GPU; the
+/// old one, its image rows and semaphores are deferred releases. Outside a
+/// frame only; the old image handles become stale.
+[[nodiscard]] Status resize_swapchain(VulkanDevice::Impl& impl, SwapchainState& swapchain,
+                                      uint32_t width, uint32_t height) noexcept;
+
+/// Acquires the next image within begin_frame() / end_frame(), at most once
+/// per frame, and queues the graphics batch @p out.ready stands for.
+[[nodiscard]] Status acquire_swapchain_image(VulkanDevice::Impl& impl, SwapchainState& swapchain,
+                                             uint64_t timeout_ns, SwapchainImage& out) noexcept;
+
+/// Presents the acquired image after everything submitted to the graphics
+/// queue so far. After end_frame() only.
+[[nodiscard]] Status present_swapchain(VulkanDevice::Impl& impl, SwapchainState& swapchain) noexcept;
+
+/// Blocks until at most maxFrameLatency - 1 presented frames are still
+/// queued for display.
+[[nodiscard]] Status wait_for_present(VulkanDevice::Impl& impl, SwapchainState& swapchain,
+                                      uint64_t timeout_ns) noexcept;
+
+void query_swapchain(SwapchainState const& swapchain, SwapchainInfo& out) noexcept;
+
+} // namespace wren::rhi::vulkan
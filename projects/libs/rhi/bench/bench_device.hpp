@@ -0,0 +1,79 @@
+#pragma once
+
+// Shared headless device for the RHI benchmarks. Loading a backend and
+// creating a device cost milliseconds; frame and resource benchmarks reuse
+// one per backend instead of paying that per benchmark.
+
+#include <wren/rhi/loader.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <optional>
+#include <string>
+
+namespace wren::rhi::bench {
+
+struct BenchDevice {
+    std::optional<BackendLibrary> library;
+    std::optional<BackendDevice>  device;   ///< Declared after library: destroyed first.
+    std::string                   error;    ///< Why device is empty.
+};
+
+/// True once any benchmark has opened the shared device; the cold-start
+/// benchmarks must be the first to touch a backend to measure anything.
+[[nodiscard]] inline bool& shared_device_opened() noexcept {
+    static bool opened = false;
+    return opened;
+}
+
+[[nodiscard]] inline DeviceDesc headless_desc() noexcept {
+    DeviceDesc desc{};
+    desc.flags          = DeviceFlag::Headless;
+    desc.framesInFlight = 2;
+    return desc;
+}
+
+/// Lazily loads @p backend and creates a headless device on first use.
+[[nodiscard]] inline BenchDevice& bench_device(Backend backend) {
+    static std::array<std::optional<BenchDevice>, static_cast<std::size_t>(Backend::None)> devices;
+    auto& slot = devices[static_cast<std::size_t>(backend)];
+    if (!slot) {
+        shared_device_opened() = true;
+        slot.emplace();
+        auto library = BackendLibrary::load(backend);
+        if (!library) {
+            slot->error = "load failed: " + library.error();
+            return *slot;
+        }
+        slot->library.emplace(std::move(*library));
+        auto device = slot->library->create_device(headless_desc());
+        if (!device) {
+            slot->error = "create_device failed: " + device.error();
+            return *slot;
+        }
+        slot->device.emplace(std::move(*device));
+    }
+    return *slot;
+}
+
+/// The shared device of @p backend, or null after skipping @p state.
+[[nodiscard]] inline BackendDevice* device_or_skip(benchmark::State& state, Backend backend) {
+    BenchDevice& bench = bench_device(backend);
+    if (!bench.device) {
+        state.SkipWithError(bench.error.c_str());
+        return nullptr;
+    }
+    return &*bench.device;
+}
+
+/// Skips @p state on a failed call; true when the benchmark should stop.
+[[nodiscard]] inline bool failed(benchmark::State& state, Status status, const char* what) {
+    if (status == Status::Ok) {
+        return false;
+    }
+    state.SkipWithError(what);
+    return true;
+}
+
+} // namespace wren::rhi::bench
@@ -0,0 +1,282 @@
+// Per-frame costs on a headless device: command recording and submission,
+// upload bandwidth through UploadQueue, and bindless descriptor writes.
+//
+// Each iteration is one begin_frame() / end_frame(), so frames-in-flight
+// back-pressure is part of the measurement exactly as in the renderer.
+
+#include "bench_device.hpp"
+
+#include <wren/rhi/transfer/upload_queue.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using namespace wren::rhi;
+using wren::rhi::bench::device_or_skip;
+using wren::rhi::bench::failed;
+
+/// What a draw records besides the draw itself: the per-object constants
+/// (bindless indices and a transform) and, every 64 draws, dynamic state.
+struct DrawConstants {
+    std::uint32_t indices[4];
+    float         transform[12];
+};
+static_assert(sizeof(DrawConstants) <= 128, "must fit the guaranteed push-constant range");
+
+// -------------------------------------------------------------------------------------------------
+// Command recording
+// -------------------------------------------------------------------------------------------------
+
+/// range(0) draws' worth of state recorded into one graphics list per frame.
+/// Draws themselves need a pipeline, hence shaders, which this suite does
+/// not build; the state path is where the per-draw CPU cost of this RHI is.
+void BM_RecordDrawState(benchmark::State& state, Backend backend) {
+    BackendDevice* device = device_or_skip(state, backend);
+    if (!device) {
+        return;
+    }
+    auto const     draws = static_cast<std::uint32_t>(state.range(0));
+    Viewport const viewport{.width = 1920.0f, .height = 1080.0f};
+    Scissor const  scissor{.width = 1920, .height = 1080};
+    DrawConstants  constants{};
+
+    for (auto _ : state) {
+        if (failed(state, device->begin_frame(), "begin_frame failed")) {
+            break;
+        }
+        auto list = device->begin_command_list();
+        if (!list) {
+            state.SkipWithError("begin_command_list failed");
+            break;
+        }
+        for (std::uint32_t i = 0; i < draws; ++i) {
+            if (i % 64 == 0) {
+                list->set_viewport(viewport);
+                list->set_scissor(scissor);
+            }
+            constants.indices[0] = i;
+            list->push_constants(constants);
+        }
+        CommandListHandle const handle = list->handle();
+        if (failed(state, list->end(), "end failed") || !device->submit({&handle, 1})
+            || failed(state, device->end_frame(), "end_frame failed")) {
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * draws));
+}
+BENCHMARK_CAPTURE(BM_RecordDrawState, vulkan, Backend::Vulkan)->ArgName("draws")->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK_CAPTURE(BM_RecordDrawState, opengl, Backend::OpenGL)->ArgName("draws")->RangeMultiplier(8)->Range(64, 32768);
+
+/// The per-object constants that fit a CommandPacket: bindless indices only.
+struct PacketConstants {
+    std::uint32_t indices[4];
+};
+
+/// BM_RecordDrawState with PacketConstants, once as one backend call per
+/// command and once as packets through CommandPacketBatch: the difference
+/// is the per-call cost of crossing the backend ABI.
+void BM_RecordPacketState(benchmark::State& state, Backend backend, bool packets) {
+    BackendDevice* device = device_or_skip(state, backend);
+    if (!device) {
+        return;
+    }
+    auto const      draws = static_cast<std::uint32_t>(state.range(0));
+    Viewport const  viewport{.width = 1920.0f, .height = 1080.0f};
+    Scissor const   scissor{.width = 1920, .height = 1080};
+    PacketConstants constants{};
+
+    for (auto _ : state) {
+        if (failed(state, device->begin_frame(), "begin_frame failed")) {
+            break;
+        }
+        auto list = device->begin_command_list();
+        if (!list) {
+            state.SkipWithError("begin_command_list failed");
+            break;
+        }
+        if (packets) {
+            CommandPacketBatch batch{*list};
+            for (std::uint32_t i = 0; i < draws; ++i) {
+                if (i % 64 == 0) {
+                    batch.push(viewport_packet(viewport));
+                    batch.push(scissor_packet(scissor));
+                }
+                constants.indices[0] = i;
+                batch.push(push_constants_packet(constants));
+            }
+        } else {
+            for (std::uint32_t i = 0; i < draws; ++i) {
+                if (i % 64 == 0) {
+                    list->set_viewport(viewport);
+                    list->set_scissor(scissor);
+                }
+                constants.indices[0] = i;
+                list->push_constants(constants);
+            }
+        }
+        CommandListHandle const handle = list->handle();
+        if (failed(state, list->end(), "end failed") || !device->submit({&handle, 1})
+            || failed(state, device->end_frame(), "end_frame failed")) {
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * draws));
+}
+BENCHMARK_CAPTURE(BM_RecordPacketState, vulkan_calls, Backend::Vulkan, false)->ArgName("draws")->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK_CAPTURE(BM_RecordPacketState, vulkan_packets, Backend::Vulkan, true)->ArgName("draws")->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK_CAPTURE(BM_RecordPacketState, opengl_calls, Backend::OpenGL, false)->ArgName("draws")->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK_CAPTURE(BM_RecordPacketState, opengl_packets, Backend::OpenGL, true)->ArgName("draws")->RangeMultiplier(8)->Range(64, 32768);
+
+/// range(0) empty lists per frame in one submit: pool reset, begin/end and
+/// the per-list share of the queue submit.
+void BM_SubmitCommandLists(benchmark::State& state, Backend backend) {
+    BackendDevice* device = device_or_skip(state, backend);
+    if (!device) {
+        return;
+    }
+    auto const lists = static_cast<std::size_t>(state.range(0));
+    std::vector<CommandListHandle> handles(lists);
+
+    for (auto _ : state) {
+        if (failed(state, device->begin_frame(), "begin_frame failed")) {
+            break;
+        }
+        bool ok = true;
+        for (std::size_t i = 0; i < lists && ok; ++i) {
+            auto list = device->begin_command_list();
+            ok = list && list->end() == Status::Ok;
+            if (ok) {
+                handles[i] = list->handle();
+            }
+        }
+        if (!ok || !device->submit(handles)) {
+            state.SkipWithError("command list recording failed");
+            break;
+        }
+        if (failed(state, device->end_frame(), "end_frame failed")) {
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * lists));
+}
+BENCHMARK_CAPTURE(BM_SubmitCommandLists, vulkan, Backend::Vulkan)->ArgName("lists")->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_CAPTURE(BM_SubmitCommandLists, opengl, Backend::OpenGL)->ArgName("lists")->Arg(1)->Arg(8)->Arg(64);
+
+// -------------------------------------------------------------------------------------------------
+// Upload bandwidth
+// -------------------------------------------------------------------------------------------------
+
+/// One range(0)-byte buffer upload per frame through the transfer queue.
+/// Bytes/s is staging memcpy plus GPU copy throughput: when staging runs
+/// out the benchmark waits for the copies, as a streaming thread would.
+void BM_UploadBuffer(benchmark::State& state, Backend backend) {
+    BackendDevice* device = device_or_skip(state, backend);
+    if (!device) {
+        return;
+    }
+    auto const bytes = static_cast<std::uint64_t>(state.range(0));
+
+    auto uploads = UploadQueue::create(*device, {.stagingBytes = 4 * bytes, .consumer = QueueType::Transfer});
+    auto buffer  = device->create_buffer({
+        .size      = bytes,
+        .usage     = BufferUsage::TransferDst | BufferUsage::Storage,
+        .memory    = MemoryUsage::GpuOnly,
+        .debugName = "bench upload target",
+    });
+    if (!uploads || !buffer) {
+        state.SkipWithError("upload setup failed");
+        if (buffer) {
+            device->destroy_buffer(*buffer);
+        }
+        return;
+    }
+    std::vector<std::byte> const data(bytes, std::byte{0x5a});
+    BufferUpload const upload{
+        .buffer      = *buffer,
+        .data        = data,
+        .finalUsage  = BufferUsage::Storage,
+        .finalStages = ShaderStage::Compute,
+    };
+
+    for (auto _ : state) {
+        if (failed(state, device->begin_frame(), "begin_frame failed")) {
+            break;
+        }
+        Status status = uploads->enqueue(upload);
+        if (status == Status::OutOfMemory) {
+            status = uploads->wait_idle() == Status::Ok ? uploads->enqueue(upload) : Status::InternalError;
+        }
+        if (failed(state, status, "enqueue failed") || !uploads->flush()
+            || failed(state, device->end_frame(), "end_frame failed")) {
+            break;
+        }
+    }
+    (void)uploads->wait_idle();
+    device->destroy_buffer(*buffer);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+BENCHMARK_CAPTURE(BM_UploadBuffer, vulkan, Backend::Vulkan)->ArgName("bytes")->RangeMultiplier(16)->Range(4 << 10, 16 << 20)->UseRealTime();
+BENCHMARK_CAPTURE(BM_UploadBuffer, opengl, Backend::OpenGL)->ArgName("bytes")->RangeMultiplier(16)->Range(4 << 10, 16 << 20)->UseRealTime();
+
+// -------------------------------------------------------------------------------------------------
+// Bindless descriptor updates
+// -------------------------------------------------------------------------------------------------
+
+/// Create + destroy of range(0) storage buffers in one batch: each writes
+/// and retires one slot of the global descriptor heap.
+void BM_BindlessBufferChurn(benchmark::State& state, Backend backend) {
+    BackendDevice* device = device_or_skip(state, backend);
+    if (!device) {
+        return;
+    }
+    auto const count = static_cast<std::size_t>(state.range(0));
+    std::vector<BufferDesc> const descs(count, BufferDesc{
+        .size   = 256,
+        .usage  = BufferUsage::Storage,
+        .memory = MemoryUsage::GpuOnly,
+    });
+    std::vector<BufferHandle> handles(count);
+
+    for (auto _ : state) {
+        if (failed(state, device->create_buffers(descs, handles), "create_buffers failed")) {
+            break;
+        }
+        benchmark::DoNotOptimize(device->bindless_index(handles.back()));
+        device->destroy_buffers(handles);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+BENCHMARK_CAPTURE(BM_BindlessBufferChurn, vulkan, Backend::Vulkan)->ArgName("buffers")->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK_CAPTURE(BM_BindlessBufferChurn, opengl, Backend::OpenGL)->ArgName("buffers")->Arg(16)->Arg(256)->Arg(4096);
+
+/// The same for small sampled textures, which also allocate image memory.
+void BM_BindlessTextureChurn(benchmark::State& state, Backend backend) {
+    BackendDevice* device = device_or_skip(state, backend);
+    if (!device) {
+        return;
+    }
+    auto const count = static_cast<std::size_t>(state.range(0));
+    std::vector<TextureDesc> const descs(count, TextureDesc{
+        .usage  = TextureUsage::Sampled | TextureUsage::TransferDst,
+        .width  = 64,
+        .height = 64,
+    });
+    std::vector<TextureHandle> handles(count);
+
+    for (auto _ : state) {
+        if (failed(state, device->create_textures(descs, handles), "create_textures failed")) {
+            break;
+        }
+        device->destroy_textures(handles);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+BENCHMARK_CAPTURE(BM_BindlessTextureChurn, vulkan, Backend::Vulkan)->ArgName("textures")->Arg(16)->Arg(256)->Arg(1024);
+BENCHMARK_CAPTURE(BM_BindlessTextureChurn, opengl, Backend::OpenGL)->ArgName("textures")->Arg(16)->Arg(256)->Arg(1024);
+
+} // anonymous namespace
@@ -0,0 +1,145 @@
+// Start-up latency: BackendLibrary::load() and create_device(), cold (first
+// use in the process: DLL mapping, driver initialisation, instance creation)
+// and warm (the same again once the driver is resident).
+//
+// The cold variants run one iteration each. Run them on their own for
+// meaningful numbers, e.g. --benchmark_filter=Cold, and repeat the process
+// rather than the benchmark: only the first load of a process is cold.
+
+#include "bench_device.hpp"
+
+namespace {
+
+using namespace wren::rhi;
+using wren::rhi::bench::headless_desc;
+using wren::rhi::bench::shared_device_opened;
+
+bool skip_if_warm(benchmark::State& state) {
+    if (shared_device_opened()) {
+        state.SkipWithError("backend already loaded in this process; run cold benchmarks first");
+        return true;
+    }
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+// BackendLibrary::load
+// -------------------------------------------------------------------------------------------------
+void BM_BackendLoadCold(benchmark::State& state, Backend backend) {
+    if (skip_if_warm(state)) {
+        return;
+    }
+    for (auto _ : state) {
+        auto library = BackendLibrary::load(backend);
+        if (!library) {
+            state.SkipWithError(library.error().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(library->backend_id());
+    }
+}
+BENCHMARK_CAPTURE(BM_BackendLoadCold, vulkan, Backend::Vulkan)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_BackendLoadCold, opengl, Backend::OpenGL)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+/// Load + unload cycles; the dynamic loader keeps nothing mapped in between.
+void BM_BackendLoadWarm(benchmark::State& state, Backend backend) {
+    for (auto _ : state) {
+        auto library = BackendLibrary::load(backend);
+        if (!library) {
+            state.SkipWithError(library.error().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(library->backend_id());
+    }
+}
+BENCHMARK_CAPTURE(BM_BackendLoadWarm, vulkan, Backend::Vulkan)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_BackendLoadWarm, opengl, Backend::OpenGL)->Unit(benchmark::kMicrosecond);
+
+// -------------------------------------------------------------------------------------------------
+// BackendLibrary::create_device
+// -------------------------------------------------------------------------------------------------
+
+/// Device creation and destruction with the library already loaded.
+void create_devices(benchmark::State& state, Backend backend) {
+    auto library = BackendLibrary::load(backend);
+    if (!library) {
+        state.SkipWithError(library.error().c_str());
+        return;
+    }
+    DeviceDesc const desc = headless_desc();
+    for (auto _ : state) {
+        auto device = library->create_device(desc);
+        if (!device) {
+            state.SkipWithError(device.error().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(device->handle());
+    }
+}
+
+void BM_CreateDeviceCold(benchmark::State& state, Backend backend) {
+    if (skip_if_warm(state)) {
+        return;
+    }
+    create_devices(state, backend);
+}
+BENCHMARK_CAPTURE(BM_CreateDeviceCold, vulkan, Backend::Vulkan)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CreateDeviceCold, opengl, Backend::OpenGL)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+void BM_CreateDeviceWarm(benchmark::State& state, Backend backend) {
+    create_devices(state, backend);
+}
+BENCHMARK_CAPTURE(BM_CreateDeviceWarm, vulkan, Backend::Vulkan)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CreateDeviceWarm, opengl, Backend::OpenGL)->Unit(benchmark::kMillisecond);
+
+/// Device creation on one shared BackendInstance: what is left once the
+/// instance start-up is paid only once per process.
+void BM_CreateDeviceSharedInstance(benchmark::State& state, Backend backend) {
+    auto library = BackendLibrary::load(backend);
+    if (!library) {
+        state.SkipWithError(library.error().c_str());
+        return;
+    }
+    auto instance = library->create_instance();
+    if (!instance) {
+        state.SkipWithError(instance.error().c_str());
+        return;
+    }
+    DeviceDesc const desc = headless_desc();
+    for (auto _ : state) {
+        auto device = instance->create_device(desc);
+        if (!device) {
+            state.SkipWithError(device.error().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(device->handle());
+    }
+}
+BENCHMARK_CAPTURE(BM_CreateDeviceSharedInstance, vulkan, Backend::Vulkan)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CreateDeviceSharedInstance, opengl, Backend::OpenGL)->Unit(benchmark::kMillisecond);
+
+// -------------------------------------------------------------------------------------------------
+// BackendInstance::adapters
+// -------------------------------------------------------------------------------------------------
+
+/// Adapter enumeration on a live instance; the queries behind it are cached
+/// per process, so this is the conversion and ABI crossing.
+void BM_EnumerateAdapters(benchmark::State& state, Backend backend) {
+    auto library = BackendLibrary::load(backend);
+    if (!library) {
+        state.SkipWithError(library.error().c_str());
+        return;
+    }
+    auto instance = library->create_instance();
+    if (!instance) {
+        state.SkipWithError(instance.error().c_str());
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(instance->adapters());
+    }
+}
+BENCHMARK_CAPTURE(BM_EnumerateAdapters, vulkan, Backend::Vulkan)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EnumerateAdapters, opengl, Backend::OpenGL)->Unit(benchmark::kMicrosecond);
+
+} // anonymous namespace
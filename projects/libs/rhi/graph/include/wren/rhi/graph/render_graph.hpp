@@ -0,0 +1,253 @@
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <span>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/resources.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/loader.hpp>
+
+namespace wren::rhi {
+
+// -------------------------------------------------------------------------------------------------
+// RenderGraph — frame-level pass scheduler above the RHI (ARCHITECTURE.md §4.14).
+//
+// Each frame the renderer declares passes and the resources they read and
+// write, then compiles and executes the graph:
+//
+//     graph.reset();
+//     auto scene = graph.import_texture({.texture = target, .finalUsage = TextureUsage::Sampled});
+//     auto depth = graph.create_texture({.format = TextureFormat::D32, .width = w, .height = h});
+//     graph.add_pass("opaque", QueueType::Graphics, [&](RenderGraphContext& ctx) { ... })
+//          .write(depth, TextureUsage::DepthStencilAtt)
+//          .write(scene, TextureUsage::ColorAttachment);
+//     if (graph.compile() == Status::Ok)
+//         auto result = graph.execute();
+//
+// compile():
+//   - Culls passes whose results nothing consumes. Roots are passes that
+//     write an imported resource or are marked side_effects(); a pass stays
+//     when a kept pass later accesses anything it writes.
+//   - Keeps the remaining passes in declaration order and groups consecutive
+//     passes of a queue into submissions, split only where another queue
+//     waits on them. Compute and Transfer passes go to the async queues when
+//     the device has them and run on Graphics otherwise.
+//   - Derives every state transition from the declared uses and merges all
+//     of them at a pass boundary into one barrier call; consecutive reads in
+//     the same state share one transition. Resources crossing queues get
+//     the release / acquire pair and the submission wait.
+//   - Places transient textures in aliasing heaps (resources.hpp): textures
+//     whose lifetimes are ordered — on one queue, or across queues through a
+//     submission wait — share memory. Without heap support every transient
+//     texture gets memory of its own.
+//
+// Transient resources are created on the first compile() that needs them
+// and reused while later frames declare the same set, so a steady-state
+// frame creates nothing. A changed set is rebuilt; the old resources are
+// destroyed once the GPU has finished the frames that used them.
+//
+// Declarations are noexcept: a failed or invalid declaration returns a null
+// reference and compile() reports the first error.
+//
+// Thread-safety: one graph belongs to the frame thread. execute() runs the
+// pass callbacks there, between begin_frame() and end_frame(). The device
+// must outlive the graph and must not be moved while it exists.
+// -------------------------------------------------------------------------------------------------
+
+/// Index of a texture declared in the current frame; only valid until reset().
+struct GraphTexture {
+    uint32_t index = UINT32_MAX;
+    [[nodiscard]] explicit operator bool() const noexcept { return index != UINT32_MAX; }
+};
+
+/// Index of a buffer declared in the current frame; only valid until reset().
+struct GraphBuffer {
+    uint32_t index = UINT32_MAX;
+    [[nodiscard]] explicit operator bool() const noexcept { return index != UINT32_MAX; }
+};
+
+struct RenderGraphDesc {
+    bool aliasing       = true;  ///< Share memory between transient textures through aliasing heaps.
+    bool asyncQueues    = true;  ///< Run Compute / Transfer passes on their own queues when available.
+    bool profileRegions = true;  ///< Wrap each pass, barriers included, in a profiling region named after it.
+};
+
+/// A texture the graph does not own, such as a swap-chain image or a
+/// history buffer. Its state at import and the state the graph leaves it in
+/// are the caller's; the graph transitions it in between.
+struct ImportedTexture {
+    TextureHandle texture;
+    TextureUsage  initialUsage  = TextureUsage::None;   ///< None discards the contents.
+    ShaderStage   initialStages = ShaderStage::None;
+    QueueType     initialQueue  = QueueType::Graphics;  ///< Queue that owns it at import.
+    TextureUsage  finalUsage    = TextureUsage::None;   ///< None leaves it as the last pass used it.
+    ShaderStage   finalStages   = ShaderStage::None;
+    QueueType     finalQueue    = QueueType::Graphics;  ///< Queue that owns it afterwards.
+};
+
+struct ImportedBuffer {
+    BufferHandle buffer;
+    BufferUsage  initialUsage  = BufferUsage::None;
+    ShaderStage  initialStages = ShaderStage::None;
+    QueueType    initialQueue  = QueueType::Graphics;
+    BufferUsage  finalUsage    = BufferUsage::None;
+    ShaderStage  finalStages   = ShaderStage::None;
+    QueueType    finalQueue    = QueueType::Graphics;
+};
+
+/// Result of RenderGraph::execute(). The spans stay valid until the next execute().
+struct RenderGraphResult {
+    /// Last SyncPoint signalled on each queue that received work.
+    std::span<SyncPoint const> signals;
+
+    /// Acquire halves for imported resources whose finalQueue differs from
+    /// the queue that last used them. Record them on finalQueue and wait on
+    /// `signals` before use.
+    std::span<TextureBarrier const> textureAcquires;
+    std::span<BufferBarrier const>  bufferAcquires;
+};
+
+/// Figures of the last compile().
+struct RenderGraphStats {
+    uint32_t passes          = 0;  ///< Declared.
+    uint32_t culledPasses    = 0;
+    uint32_t submissions     = 0;  ///< Command lists, one submit each.
+    uint32_t barrierCalls    = 0;  ///< One per pass boundary that needs any barrier.
+    uint32_t textureBarriers = 0;
+    uint32_t bufferBarriers  = 0;
+    uint32_t transientTextures = 0;
+    uint32_t transientBuffers  = 0;
+    uint64_t transientTextureBytes = 0;  ///< Sum of the transient textures' sizes.
+    uint64_t heapBytes             = 0;  ///< Memory they occupy after aliasing.
+};
+
+class RenderGraph;
+
+/// Handed to a pass callback while the graph records it.
+class RenderGraphContext {
+public:
+    [[nodiscard]] CommandList const& list() const noexcept { return list_; }
+    [[nodiscard]] QueueType queue() const noexcept { return queue_; }
+
+    /// Backend handles behind the graph's references.
+    [[nodiscard]] TextureHandle texture(GraphTexture texture) const noexcept;
+    [[nodiscard]] BufferHandle  buffer(GraphBuffer buffer) const noexcept;
+
+private:
+    friend class RenderGraph;
+    RenderGraphContext(RenderGraph const& graph, CommandList list, QueueType queue) noexcept
+        : graph_{&graph}, list_{list}, queue_{queue} {}
+
+    RenderGraph const* graph_;
+    CommandList        list_;
+    QueueType          queue_;
+};
+
+using RenderGraphExecute = std::move_only_function<void(RenderGraphContext&)>;
+
+/// Declares the resource uses of one pass; returned by RenderGraph::add_pass().
+/// Usages are the states of commands.hpp; stages only matter for the
+/// shader-visible ones. Each resource may appear once per pass.
+class RenderGraphPass {
+public:
+    RenderGraphPass& read(GraphTexture texture, TextureUsage usage = TextureUsage::Sampled,
+                          ShaderStage stages = ShaderStage::None) noexcept;
+    RenderGraphPass& write(GraphTexture texture, TextureUsage usage = TextureUsage::ColorAttachment,
+                           ShaderStage stages = ShaderStage::None) noexcept;
+    RenderGraphPass& read(GraphBuffer buffer, BufferUsage usage,
+                          ShaderStage stages = ShaderStage::None) noexcept;
+    RenderGraphPass& write(GraphBuffer buffer, BufferUsage usage,
+                           ShaderStage stages = ShaderStage::None) noexcept;
+
+    /// Keeps the pass even when nothing consumes its writes (readbacks,
+    /// queries, debug output).
+    RenderGraphPass& side_effects() noexcept;
+
+private:
+    friend class RenderGraph;
+    RenderGraphPass(RenderGraph& graph, uint32_t pass) noexcept : graph_{&graph}, pass_{pass} {}
+
+    RenderGraph* graph_;
+    uint32_t     pass_;
+};
+
+class RenderGraph {
+public:
+    [[nodiscard]] static auto create(BackendDevice& device, RenderGraphDesc const& desc = {}) noexcept
+        -> std::expected<RenderGraph, Status>;
+
+    /// Waits for the GPU to finish with the transient resources, then destroys them.
+    ~RenderGraph();
+
+    RenderGraph(RenderGraph&&) noexcept;
+    RenderGraph& operator=(RenderGraph&&) noexcept;
+
+    RenderGraph(RenderGraph const&)            = delete;
+    RenderGraph& operator=(RenderGraph const&) = delete;
+
+    // -----------------------------------------------------------------
+    // Declaration (after reset(), before compile())
+    // -----------------------------------------------------------------
+
+    /// Drops the previous frame's declarations; transient resources stay
+    /// cached for the next compile().
+    void reset() noexcept;
+
+    [[nodiscard]] GraphTexture import_texture(ImportedTexture const& texture) noexcept;
+    [[nodiscard]] GraphBuffer  import_buffer(ImportedBuffer const& buffer) noexcept;
+
+    /// Transient resources: created, and for textures aliased, by the graph.
+    /// The usage of @p desc is extended with every declared use; the heap
+    /// fields of a TextureDesc are ignored. Contents never survive a frame.
+    [[nodiscard]] GraphTexture create_texture(TextureDesc const& desc) noexcept;
+    [[nodiscard]] GraphBuffer  create_buffer(BufferDesc const& desc) noexcept;
+
+    /// Adds a pass on @p queue (Graphics, Compute or Transfer). @p execute
+    /// records it; the graph has already issued the barriers it needs.
+    [[nodiscard]] RenderGraphPass add_pass(const char* name, QueueType queue,
+                                           RenderGraphExecute execute) noexcept;
+
+    // -----------------------------------------------------------------
+    // Compilation & execution (frame thread)
+    // -----------------------------------------------------------------
+
+    /// Culls, schedules and computes barriers and memory placement; creates
+    /// transient resources when the set changed. Reports the first
+    /// declaration error.
+    [[nodiscard]] Status compile() noexcept;
+
+    /// Records every kept pass into one command list per submission and
+    /// submits them, each waiting on the submissions it depends on and the
+    /// first of each queue also on @p waits (e.g. swap-chain acquire or an
+    /// UploadBatch). Between begin_frame() and end_frame().
+    [[nodiscard]] auto execute(std::span<SyncPoint const> waits = {}) noexcept
+        -> std::expected<RenderGraphResult, Status>;
+
+    /// Backend handles behind the references; valid from compile() to reset().
+    [[nodiscard]] TextureHandle texture(GraphTexture texture) const noexcept;
+    [[nodiscard]] BufferHandle  buffer(GraphBuffer buffer) const noexcept;
+
+    [[nodiscard]] RenderGraphStats const& stats() const noexcept;
+
+private:
+    friend class RenderGraphPass;
+    struct Impl;
+    explicit RenderGraph(std::unique_ptr<Impl> impl) noexcept;
+    std::unique_ptr<Impl> impl_;
+};
+
+inline TextureHandle RenderGraphContext::texture(GraphTexture texture) const noexcept {
+    return graph_->texture(texture);
+}
+
+inline BufferHandle RenderGraphContext::buffer(GraphBuffer buffer) const noexcept {
+    return graph_->buffer(buffer);
+}
+
+} // namespace wren::rhi
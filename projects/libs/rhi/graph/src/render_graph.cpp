@@ -0,0 +1,1317 @@
+#include <wren/rhi/graph/render_graph.hpp>
+
+#include <wren/foundation/diag/profiler.hpp>
+#include <wren/foundation/memory/align.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <deque>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace wren::rhi {
+
+namespace {
+
+constexpr uint32_t k_queue_count = 3;  // Graphics, Compute, Transfer
+constexpr uint32_t k_none        = UINT32_MAX;
+
+// Every ShaderStage bit. A stage mask of None means "any stage" to the
+// backends, so merges normalise it to this and emit None again.
+constexpr auto k_all_stages = static_cast<ShaderStage>((1u << 14) - 1);
+
+// Usages a pass cannot write through; a resource already in one of these
+// states needs no barrier before another read of it.
+constexpr uint32_t k_read_only_texture_usage =
+    underlying(TextureUsage::Sampled | TextureUsage::TransferSrc);
+constexpr uint32_t k_read_only_buffer_usage =
+    underlying(BufferUsage::Vertex | BufferUsage::Index | BufferUsage::Uniform |
+               BufferUsage::Indirect | BufferUsage::TransferSrc);
+
+[[nodiscard]] uint32_t queue_index(QueueType queue) noexcept {
+    return static_cast<uint32_t>(queue);
+}
+
+[[nodiscard]] ShaderStage widen(ShaderStage stages) noexcept {
+    return stages == ShaderStage::None ? k_all_stages : stages;
+}
+
+[[nodiscard]] ShaderStage narrow(ShaderStage stages) noexcept {
+    return stages == k_all_stages ? ShaderStage::None : stages;
+}
+
+/// A resource state as the barrier structs describe it; `usage` holds
+/// TextureUsage or BufferUsage bits.
+struct State {
+    uint32_t    usage  = 0;
+    ShaderStage stages = ShaderStage::None;
+    QueueType   queue  = QueueType::Graphics;
+};
+
+/// True when a resource in @p from may be read as @p to without a barrier.
+[[nodiscard]] bool covers(State const& from, State const& to, bool write, uint32_t read_only) noexcept {
+    if (write || from.usage != to.usage || from.queue != to.queue || (from.usage & ~read_only) != 0)
+        return false;
+    ShaderStage const have = widen(from.stages);
+    return underlying(widen(to.stages) & have) == underlying(widen(to.stages));
+}
+
+// -----------------------------------------------------------------
+// Declarations
+// -----------------------------------------------------------------
+struct Resource {
+    bool          texture  = true;
+    bool          imported = false;
+    TextureDesc   texture_desc{};    // transient textures; usage extended at compile
+    BufferDesc    buffer_desc{};     // transient buffers
+    std::string   name{};            // transient debug name
+    TextureHandle texture_handle{};  // imported, or resolved at compile
+    BufferHandle  buffer_handle{};
+    State         initial{};         // imported only
+    State         final{};           // imported only; usage 0 keeps the last state
+
+    // compile()
+    uint32_t first_segment = 0;
+    uint32_t segment_count = 0;
+    uint32_t physical      = k_none;  // index into the transient layout
+};
+
+struct Access {
+    uint32_t    pass     = 0;
+    uint32_t    resource = 0;
+    uint32_t    usage    = 0;
+    ShaderStage stages   = ShaderStage::None;
+    bool        write    = false;
+};
+
+struct Pass {
+    const char*        name = nullptr;
+    QueueType          queue = QueueType::Graphics;
+    RenderGraphExecute execute;
+    bool               side_effects = false;
+
+    // compile()
+    uint32_t first_access         = 0;
+    uint32_t access_count         = 0;
+    bool     kept                 = false;
+    uint32_t batch                = k_none;
+    uint32_t first_texture_barrier = 0;
+    uint32_t texture_barrier_count = 0;
+    uint32_t first_buffer_barrier  = 0;
+    uint32_t buffer_barrier_count  = 0;
+};
+
+// -----------------------------------------------------------------
+// Schedule
+// -----------------------------------------------------------------
+
+/// Consecutive uses of one resource in one state on one queue. Reads of
+/// the same usage merge; every write starts a segment of its own.
+/// Positions index RenderGraph::Impl::order.
+struct Segment {
+    uint32_t resource = 0;
+    State    state;
+    bool     write = false;
+    uint32_t first = 0;
+    uint32_t last  = 0;
+};
+
+/// A cross-queue dependency: the pass at `to` waits for `from`, a position
+/// in the order or k_none for the import prologue of `prologue_queue`.
+struct Edge {
+    uint32_t  to   = 0;
+    uint32_t  from = k_none;
+    QueueType prologue_queue = QueueType::Graphics;
+};
+
+/// One command list and one submission.
+struct Batch {
+    QueueType queue      = QueueType::Graphics;
+    uint32_t  first_pass = 0;  // into batch_passes
+    uint32_t  pass_count = 0;
+    uint32_t  first_wait = 0;  // into batch_waits
+    uint32_t  wait_count = 0;
+    bool      first_of_queue = false;  // also waits on execute()'s waits
+    uint32_t  previous_frame_waits = 0;  // queue bits; waits on the last execute()'s signals
+    uint32_t  first_texture_release = 0;
+    uint32_t  texture_release_count = 0;
+    uint32_t  first_buffer_release  = 0;
+    uint32_t  buffer_release_count  = 0;
+};
+
+template<typename Barrier>
+struct Keyed {
+    uint32_t key = 0;  // pass index for pass barriers, batch index for releases
+    Barrier  barrier{};
+};
+
+// -----------------------------------------------------------------
+// Transient layout
+//
+// The physical side of the transient resources: what compile() creates and
+// what later frames reuse while it compares equal.
+// -----------------------------------------------------------------
+struct Layout {
+    std::vector<TextureDesc>    textures;       // heap cleared; heapOffset set
+    std::vector<uint32_t>       texture_heaps;  // index into heaps, k_none when unplaced
+    std::vector<MemoryHeapDesc> heaps;
+    std::vector<BufferDesc>     buffers;
+
+    void clear() noexcept {
+        textures.clear();
+        texture_heaps.clear();
+        heaps.clear();
+        buffers.clear();
+    }
+};
+
+[[nodiscard]] bool same_texture(TextureDesc const& a, TextureDesc const& b) noexcept {
+    return a.dimension == b.dimension && a.format == b.format && a.usage == b.usage &&
+           a.samples == b.samples && a.width == b.width && a.height == b.height &&
+           a.depth == b.depth && a.mipLevels == b.mipLevels && a.arrayLayers == b.arrayLayers &&
+           a.heapOffset == b.heapOffset;
+}
+
+[[nodiscard]] bool same_layout(Layout const& a, Layout const& b) noexcept {
+    return std::ranges::equal(a.textures, b.textures, same_texture) &&
+           a.texture_heaps == b.texture_heaps &&
+           std::ranges::equal(a.heaps, b.heaps, [](MemoryHeapDesc const& x, MemoryHeapDesc const& y) {
+               return x.size == y.size && x.compatibility == y.compatibility;
+           }) &&
+           std::ranges::equal(a.buffers, b.buffers, [](BufferDesc const& x, BufferDesc const& y) {
+               return x.size == y.size && x.usage == y.usage && x.memory == y.memory;
+           });
+}
+
+/// Backend objects of a layout, with the state each resource was last used
+/// in by execute() (usage 0 until then).
+struct Realized {
+    std::vector<HeapHandle>    heaps;
+    std::vector<TextureHandle> textures;
+    std::vector<BufferHandle>  buffers;
+    std::vector<State>         texture_states;
+    std::vector<State>         buffer_states;
+};
+
+/// Resources of a replaced layout, destroyed once every queue passed `points`.
+struct Retired {
+    Realized  objects;
+    SyncPoint points[k_queue_count]{};
+};
+
+/// One transient texture while placing: its lifetime in the order and the
+/// memory it needs.
+struct Placement {
+    uint32_t           resource = 0;
+    uint32_t           first = 0;
+    uint32_t           last  = 0;
+    QueueType          first_queue = QueueType::Graphics;
+    QueueType          last_queue  = QueueType::Graphics;
+    MemoryRequirements requirements{};
+    uint32_t           heap   = k_none;
+    uint64_t           offset = 0;
+};
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Impl
+// -------------------------------------------------------------------------------------------------
+struct RenderGraph::Impl {
+    BackendDevice*  device;
+    RenderGraphDesc desc;
+    bool            async_compute  = false;
+    bool            async_transfer = false;
+
+    // Declarations; cleared by reset().
+    Status                error = Status::Ok;
+    std::vector<Resource> resources;
+    std::vector<Pass>     passes;
+    std::vector<Access>   accesses;
+    bool                  compiled = false;
+
+    // compile()
+    std::vector<uint32_t>                order;          // kept passes, declaration order
+    std::vector<Segment>                 segments;
+    std::vector<Edge>                    edges;
+    std::vector<Batch>                   batches;
+    std::vector<uint32_t>                batch_passes;
+    std::vector<uint32_t>                batch_waits;    // batch indices
+    std::array<uint32_t, k_queue_count>  prologue{};     // import release batch per queue, or k_none
+    std::vector<Keyed<TextureBarrier>>   texture_barriers;
+    std::vector<Keyed<BufferBarrier>>    buffer_barriers;
+    std::vector<TextureBarrier>          flat_texture_barriers;
+    std::vector<BufferBarrier>           flat_buffer_barriers;
+    std::vector<Placement>               placements;
+    std::vector<TextureBarrier>          texture_acquires;  // for the caller
+    std::vector<BufferBarrier>           buffer_acquires;
+    std::vector<State>                   next_texture_states;  // per physical texture after execute()
+    std::vector<State>                   next_buffer_states;
+    RenderGraphStats                     stats;
+
+    // Transient resources, kept across frames.
+    Layout              layout;
+    Layout              candidate;
+    Realized            realized;
+    std::deque<Retired> retired;
+
+    // execute()
+    std::vector<SyncPoint> batch_signals;
+    std::vector<SyncPoint> submit_waits;
+    std::vector<SyncPoint> result_signals;
+    SyncPoint              last_signals[k_queue_count]{};
+
+    Impl(BackendDevice& dev, RenderGraphDesc const& d) noexcept
+        : device{&dev}
+        , desc{d}
+    {
+        Feature const features = dev.capabilities().features;
+        async_compute  = d.asyncQueues && has_any(features, Feature::AsyncCompute);
+        async_transfer = d.asyncQueues && has_any(features, Feature::AsyncTransfer);
+    }
+
+    /// Queue a pass declared for @p queue runs on.
+    [[nodiscard]] QueueType schedule_queue(QueueType queue) const noexcept {
+        if (queue == QueueType::Compute && !async_compute)
+            return QueueType::Graphics;
+        if (queue == QueueType::Transfer && !async_transfer)
+            return QueueType::Graphics;
+        return queue;
+    }
+
+    void fail(Status s) noexcept {
+        if (error == Status::Ok)
+            error = s;
+    }
+
+    [[nodiscard]] std::span<Segment const> segments_of(Resource const& r) const noexcept {
+        return std::span{segments}.subspan(r.first_segment, r.segment_count);
+    }
+
+    void compile();
+    void cull();
+    void build_segments();
+    void build_batches();
+    [[nodiscard]] bool ordered(Placement const& a, Placement const& b) const noexcept;
+    [[nodiscard]] Status place_transients();
+    [[nodiscard]] Status realize_layout();
+    void build_barriers();
+    void finish_barriers();
+
+    [[nodiscard]] State discard_source(Resource const& r, Segment const& head);
+    void add_transition(Resource const& r, State from, State const& to, bool discard,
+                        uint32_t release_key, uint32_t acquire_key);
+
+    void declare(uint32_t pass, uint32_t resource, bool texture, uint32_t usage,
+                 ShaderStage stages, bool write) noexcept;
+
+    void destroy(Realized& objects) noexcept;
+    void wait_for(SyncPoint const (&points)[k_queue_count]) noexcept;
+    void retire_layout() noexcept;
+    void collect_retired(bool wait) noexcept;
+};
+
+// -------------------------------------------------------------------------------------------------
+// Lifecycle
+// -------------------------------------------------------------------------------------------------
+auto RenderGraph::create(BackendDevice& device, RenderGraphDesc const& desc) noexcept
+    -> std::expected<RenderGraph, Status>
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    std::unique_ptr<Impl> impl{new (std::nothrow) Impl{device, desc}};
+    if (!impl)
+        return std::unexpected{Status::OutOfMemory};
+    return RenderGraph{std::move(impl)};
+}
+
+RenderGraph::RenderGraph(std::unique_ptr<Impl> impl) noexcept
+    : impl_{std::move(impl)}
+{}
+
+RenderGraph::RenderGraph(RenderGraph&&) noexcept            = default;
+RenderGraph& RenderGraph::operator=(RenderGraph&&) noexcept = default;
+
+RenderGraph::~RenderGraph() {
+    if (!impl_)
+        return;
+    impl_->retire_layout();
+    impl_->collect_retired(true);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Declaration
+// -------------------------------------------------------------------------------------------------
+void RenderGraph::reset() noexcept {
+    auto& impl = *impl_;
+    impl.error    = Status::Ok;
+    impl.compiled = false;
+    impl.resources.clear();
+    impl.passes.clear();
+    impl.accesses.clear();
+}
+
+GraphTexture RenderGraph::import_texture(ImportedTexture const& texture) noexcept {
+    auto& impl = *impl_;
+    if (!texture.texture || texture.initialQueue == QueueType::Present || texture.finalQueue == QueueType::Present) {
+        impl.fail(Status::InvalidArgument);
+        return {};
+    }
+    try {
+        impl.resources.push_back(Resource{
+            .texture        = true,
+            .imported       = true,
+            .texture_handle = texture.texture,
+            .initial        = {underlying(texture.initialUsage), texture.initialStages,
+                               impl.schedule_queue(texture.initialQueue)},
+            .final          = {underlying(texture.finalUsage), texture.finalStages,
+                               impl.schedule_queue(texture.finalQueue)},
+        });
+    } catch (std::bad_alloc const&) {
+        impl.fail(Status::OutOfMemory);
+        return {};
+    }
+    return GraphTexture{static_cast<uint32_t>(impl.resources.size() - 1)};
+}
+
+GraphBuffer RenderGraph::import_buffer(ImportedBuffer const& buffer) noexcept {
+    auto& impl = *impl_;
+    if (!buffer.buffer || buffer.initialQueue == QueueType::Present || buffer.finalQueue == QueueType::Present) {
+        impl.fail(Status::InvalidArgument);
+        return {};
+    }
+    try {
+        impl.resources.push_back(Resource{
+            .texture       = false,
+            .imported      = true,
+            .buffer_handle = buffer.buffer,
+            .initial       = {underlying(buffer.initialUsage), buffer.initialStages,
+                              impl.schedule_queue(buffer.initialQueue)},
+            .final         = {underlying(buffer.finalUsage), buffer.finalStages,
+                              impl.schedule_queue(buffer.finalQueue)},
+        });
+    } catch (std::bad_alloc const&) {
+        impl.fail(Status::OutOfMemory);
+        return {};
+    }
+    return GraphBuffer{static_cast<uint32_t>(impl.resources.size() - 1)};
+}
+
+GraphTexture RenderGraph::create_texture(TextureDesc const& desc) noexcept {
+    auto& impl = *impl_;
+    try {
+        Resource r{.texture = true, .texture_desc = desc};
+        r.texture_desc.heap       = {};
+        r.texture_desc.heapOffset = 0;
+        r.texture_desc.debugName  = nullptr;
+        if (desc.debugName)
+            r.name = desc.debugName;
+        impl.resources.push_back(std::move(r));
+    } catch (std::bad_alloc const&) {
+        impl.fail(Status::OutOfMemory);
+        return {};
+    }
+    return GraphTexture{static_cast<uint32_t>(impl.resources.size() - 1)};
+}
+
+GraphBuffer RenderGraph::create_buffer(BufferDesc const& desc) noexcept {
+    auto& impl = *impl_;
+    if (desc.size == 0) {
+        impl.fail(Status::InvalidArgument);
+        return {};
+    }
+    try {
+        Resource r{.texture = false, .buffer_desc = desc};
+        r.buffer_desc.debugName = nullptr;
+        if (desc.debugName)
+            r.name = desc.debugName;
+        impl.resources.push_back(std::move(r));
+    } catch (std::bad_alloc const&) {
+        impl.fail(Status::OutOfMemory);
+        return {};
+    }
+    return GraphBuffer{static_cast<uint32_t>(impl.resources.size() - 1)};
+}
+
+RenderGraphPass RenderGraph::add_pass(const char* name, QueueType queue,
+                                      RenderGraphExecute execute) noexcept
+{
+    auto& impl = *impl_;
+    if (queue == QueueType::Present) {
+        impl.fail(Status::InvalidArgument);
+        return RenderGraphPass{*this, k_none};
+    }
+    try {
+        impl.passes.push_back(Pass{
+            .name    = name,
+            .queue   = impl.schedule_queue(queue),
+            .execute = std::move(execute),
+        });
+    } catch (std::bad_alloc const&) {
+        impl.fail(Status::OutOfMemory);
+        return RenderGraphPass{*this, k_none};
+    }
+    return RenderGraphPass{*this, static_cast<uint32_t>(impl.passes.size() - 1)};
+}
+
+void RenderGraph::Impl::declare(uint32_t pass, uint32_t resource, bool texture, uint32_t usage,
+                                ShaderStage stages, bool write) noexcept
+{
+    if (pass == k_none)
+        return;  // add_pass() already failed
+    if (resource >= resources.size() || resources[resource].texture != texture || usage == 0) {
+        fail(Status::InvalidArgument);
+        return;
+    }
+    try {
+        accesses.push_back(Access{
+            .pass     = pass,
+            .resource = resource,
+            .usage    = usage,
+            .stages   = stages,
+            .write    = write,
+        });
+    } catch (std::bad_alloc const&) {
+        fail(Status::OutOfMemory);
+    }
+}
+
+RenderGraphPass& RenderGraphPass::read(GraphTexture texture, TextureUsage usage, ShaderStage stages) noexcept {
+    graph_->impl_->declare(pass_, texture.index, true, underlying(usage), stages, false);
+    return *this;
+}
+
+RenderGraphPass& RenderGraphPass::write(GraphTexture texture, TextureUsage usage, ShaderStage stages) noexcept {
+    graph_->impl_->declare(pass_, texture.index, true, underlying(usage), stages, true);
+    return *this;
+}
+
+RenderGraphPass& RenderGraphPass::read(GraphBuffer buffer, BufferUsage usage, ShaderStage stages) noexcept {
+    graph_->impl_->declare(pass_, buffer.index, false, underlying(usage), stages, false);
+    return *this;
+}
+
+RenderGraphPass& RenderGraphPass::write(GraphBuffer buffer, BufferUsage usage, ShaderStage stages) noexcept {
+    graph_->impl_->declare(pass_, buffer.index, false, underlying(usage), stages, true);
+    return *this;
+}
+
+RenderGraphPass& RenderGraphPass::side_effects() noexcept {
+    if (pass_ != k_none)
+        graph_->impl_->passes[pass_].side_effects = true;
+    return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Compilation
+// -------------------------------------------------------------------------------------------------
+Status RenderGraph::compile() noexcept {
+    WREN_PROFILE_ZONE("RenderGraph::compile");
+    auto& impl = *impl_;
+    impl.compiled = false;
+    if (impl.error != Status::Ok)
+        return impl.error;
+
+    impl.collect_retired(false);
+    try {
+        impl.compile();
+        if (Status s = impl.place_transients(); s != Status::Ok)
+            return s;
+        if (Status s = impl.realize_layout(); s != Status::Ok)
+            return s;
+        impl.build_barriers();
+        impl.finish_barriers();
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+    impl.compiled = true;
+    return impl.error;
+}
+
+void RenderGraph::Impl::compile() {
+    // Group the accesses by pass, keeping declaration order within a pass.
+    std::ranges::stable_sort(accesses, std::less{}, &Access::pass);
+    for (Pass& p : passes) {
+        p.first_access = 0;
+        p.access_count = 0;
+        p.kept         = false;
+        p.batch        = k_none;
+    }
+    for (uint32_t i = 0; i < accesses.size(); ++i) {
+        Pass& p = passes[accesses[i].pass];
+        if (p.access_count == 0)
+            p.first_access = i;
+        ++p.access_count;
+    }
+    for (Pass const& p : passes) {
+        auto const list = std::span{accesses}.subspan(p.first_access, p.access_count);
+        for (std::size_t i = 0; i < list.size(); ++i) {
+            for (std::size_t j = i + 1; j < list.size(); ++j) {
+                if (list[i].resource == list[j].resource)
+                    fail(Status::InvalidArgument);
+            }
+        }
+    }
+
+    cull();
+    build_segments();
+    build_batches();
+
+    stats = RenderGraphStats{
+        .passes       = static_cast<uint32_t>(passes.size()),
+        .culledPasses = static_cast<uint32_t>(passes.size() - order.size()),
+        .submissions  = static_cast<uint32_t>(batches.size()),
+    };
+}
+
+/// Walks the passes backwards: a pass is kept when it has side effects or
+/// writes something that is imported or that a kept pass accesses later.
+/// Writes count as accesses, since a pass may load what it overwrites.
+void RenderGraph::Impl::cull() {
+    std::vector<bool> needed(resources.size(), false);
+    for (uint32_t i = static_cast<uint32_t>(passes.size()); i-- > 0;) {
+        Pass& p = passes[i];
+        auto const list = std::span{accesses}.subspan(p.first_access, p.access_count);
+        p.kept = p.side_effects || std::ranges::any_of(list, [&](Access const& a) {
+            return a.write && (resources[a.resource].imported || needed[a.resource]);
+        });
+        if (!p.kept)
+            continue;
+        for (Access const& a : list)
+            needed[a.resource] = true;
+    }
+
+    order.clear();
+    for (uint32_t i = 0; i < passes.size(); ++i) {
+        if (passes[i].kept)
+            order.push_back(i);
+    }
+}
+
+/// Splits each resource's uses into segments and records a cross-queue
+/// edge wherever consecutive segments, or an import and its first
+/// segment, are on different queues.
+void RenderGraph::Impl::build_segments() {
+    segments.clear();
+    edges.clear();
+
+    std::vector<uint32_t> open(resources.size(), k_none);
+    for (uint32_t pos = 0; pos < order.size(); ++pos) {
+        Pass const& p = passes[order[pos]];
+        for (Access const& a : std::span{accesses}.subspan(p.first_access, p.access_count)) {
+            uint32_t const s = open[a.resource];
+            if (s != k_none && !segments[s].write && !a.write &&
+                segments[s].state.usage == a.usage && segments[s].state.queue == p.queue) {
+                segments[s].state.stages = segments[s].state.stages == ShaderStage::None || a.stages == ShaderStage::None
+                    ? ShaderStage::None
+                    : segments[s].state.stages | a.stages;
+                segments[s].last = pos;
+                continue;
+            }
+            open[a.resource] = static_cast<uint32_t>(segments.size());
+            segments.push_back(Segment{
+                .resource = a.resource,
+                .state    = {a.usage, a.stages, p.queue},
+                .write    = a.write,
+                .first    = pos,
+                .last     = pos,
+            });
+        }
+    }
+
+    std::ranges::stable_sort(segments, std::less{}, &Segment::resource);
+    for (Resource& r : resources) {
+        r.first_segment = 0;
+        r.segment_count = 0;
+    }
+    for (uint32_t i = 0; i < segments.size(); ++i) {
+        Resource& r = resources[segments[i].resource];
+        if (r.segment_count == 0)
+            r.first_segment = i;
+        ++r.segment_count;
+    }
+
+    for (Resource const& r : resources) {
+        auto const list = segments_of(r);
+        if (list.empty())
+            continue;
+        if (r.imported && r.initial.usage != 0 && r.initial.queue != list.front().state.queue)
+            edges.push_back({.to = list.front().first, .from = k_none, .prologue_queue = r.initial.queue});
+        for (std::size_t i = 1; i < list.size(); ++i) {
+            if (list[i - 1].state.queue != list[i].state.queue)
+                edges.push_back({.to = list[i].first, .from = list[i - 1].last});
+        }
+    }
+    std::ranges::stable_sort(edges, std::less{}, &Edge::to);
+}
+
+/// Assigns passes to submissions in order. A pass that waits on another
+/// queue closes the batches it waits on and starts a new one, so every
+/// wait names an earlier submission and the waited-on work is not held
+/// back by passes appended after it.
+void RenderGraph::Impl::build_batches() {
+    batches.clear();
+    batch_passes.clear();
+    batch_waits.clear();
+    prologue.fill(k_none);
+
+    std::array<uint32_t, k_queue_count> open{k_none, k_none, k_none};
+    std::array<bool, k_queue_count>     used{};
+    auto const open_batch = [&](QueueType queue) {
+        uint32_t const q = queue_index(queue);
+        batches.push_back(Batch{.queue = queue, .first_of_queue = !used[q]});
+        used[q] = true;
+        return static_cast<uint32_t>(batches.size() - 1);
+    };
+
+    std::vector<uint32_t> pass_batch(order.size(), k_none);
+    std::vector<uint32_t> waits;
+    std::size_t           e = 0;
+    for (uint32_t pos = 0; pos < order.size(); ++pos) {
+        QueueType const queue = passes[order[pos]].queue;
+        uint32_t const  q     = queue_index(queue);
+
+        waits.clear();
+        for (; e < edges.size() && edges[e].to == pos; ++e) {
+            Edge const& edge = edges[e];
+            uint32_t source = k_none;
+            if (edge.from == k_none) {
+                uint32_t& pro = prologue[queue_index(edge.prologue_queue)];
+                if (pro == k_none)
+                    pro = open_batch(edge.prologue_queue);
+                source = pro;
+            } else {
+                source = pass_batch[edge.from];
+            }
+            uint32_t const sq = queue_index(batches[source].queue);
+            if (open[sq] == source)
+                open[sq] = k_none;
+            waits.push_back(source);
+        }
+
+        if (!waits.empty()) {
+            open[q] = open_batch(queue);
+            // Timelines are cumulative: only the latest batch per queue matters.
+            std::array<uint32_t, k_queue_count> latest{k_none, k_none, k_none};
+            for (uint32_t w : waits) {
+                uint32_t& l = latest[queue_index(batches[w].queue)];
+                if (l == k_none || w > l)
+                    l = w;
+            }
+            Batch& b     = batches[open[q]];
+            b.first_wait = static_cast<uint32_t>(batch_waits.size());
+            for (uint32_t l : latest) {
+                if (l != k_none && batches[l].queue != queue)
+                    batch_waits.push_back(l);
+            }
+            b.wait_count = static_cast<uint32_t>(batch_waits.size()) - b.first_wait;
+        } else if (open[q] == k_none) {
+            open[q] = open_batch(queue);
+        }
+        pass_batch[pos]           = open[q];
+        passes[order[pos]].batch  = open[q];
+    }
+
+    // Flatten the passes per batch; positions are already in order.
+    std::vector<uint32_t> positions(order.size());
+    for (uint32_t pos = 0; pos < order.size(); ++pos)
+        positions[pos] = pos;
+    std::ranges::stable_sort(positions, std::less{}, [&](uint32_t pos) { return pass_batch[pos]; });
+    for (uint32_t pos : positions) {
+        Batch& b = batches[pass_batch[pos]];
+        if (b.pass_count == 0)
+            b.first_pass = static_cast<uint32_t>(batch_passes.size());
+        ++b.pass_count;
+        batch_passes.push_back(order[pos]);
+    }
+}
+
+// -----------------------------------------------------------------
+// Transient placement
+// -----------------------------------------------------------------
+
+/// True when the GPU is guaranteed to finish @p a's last use before @p b's
+/// first: earlier on the same queue (the graph puts a barrier in between),
+/// or on another queue that b's submission waits on at or after a's.
+bool RenderGraph::Impl::ordered(Placement const& a, Placement const& b) const noexcept {
+    if (a.last >= b.first)
+        return false;
+    if (a.last_queue == b.first_queue)
+        return true;
+    uint32_t const a_batch = passes[order[a.last]].batch;
+    Batch const&   waiter  = batches[passes[order[b.first]].batch];
+    for (uint32_t w : std::span{batch_waits}.subspan(waiter.first_wait, waiter.wait_count)) {
+        if (batches[w].queue == a.last_queue && w >= a_batch)
+            return true;
+    }
+    return false;
+}
+
+/// Builds the candidate layout: every live transient resource with its
+/// usage extended, and with aliasing textures placed first-fit, largest
+/// first, at the lowest offset that overlaps no texture whose lifetime
+/// overlaps its own.
+Status RenderGraph::Impl::place_transients() {
+    candidate.clear();
+    placements.clear();
+    for (Resource& r : resources)
+        r.physical = k_none;
+
+    std::vector<TextureDesc> descs;
+    for (uint32_t i = 0; i < resources.size(); ++i) {
+        Resource& r = resources[i];
+        auto const list = segments_of(r);
+        if (r.imported || list.empty())
+            continue;
+
+        uint32_t usage = 0;
+        for (Segment const& s : list)
+            usage |= s.state.usage;
+
+        if (r.texture) {
+            r.physical = static_cast<uint32_t>(candidate.textures.size());
+            TextureDesc d = r.texture_desc;
+            d.usage      = d.usage | static_cast<TextureUsage>(usage);
+            candidate.textures.push_back(d);
+            candidate.texture_heaps.push_back(k_none);
+            placements.push_back(Placement{
+                .resource    = i,
+                .first       = list.front().first,
+                .last        = list.back().last,
+                .first_queue = list.front().state.queue,
+                .last_queue  = list.back().state.queue,
+            });
+        } else {
+            r.physical = static_cast<uint32_t>(candidate.buffers.size());
+            BufferDesc d = r.buffer_desc;
+            d.usage      = d.usage | static_cast<BufferUsage>(usage);
+            candidate.buffers.push_back(d);
+        }
+    }
+    stats.transientTextures = static_cast<uint32_t>(candidate.textures.size());
+    stats.transientBuffers  = static_cast<uint32_t>(candidate.buffers.size());
+    if (placements.empty())
+        return Status::Ok;
+
+    // Backends without aliasing heaps report an error here; every texture
+    // then gets memory of its own.
+    std::vector<MemoryRequirements> reqs(candidate.textures.size());
+    if (!desc.aliasing || device->texture_memory_requirements(candidate.textures, reqs) != Status::Ok)
+        return Status::Ok;
+    for (Placement& p : placements) {
+        p.requirements = reqs[resources[p.resource].physical];
+        stats.transientTextureBytes += p.requirements.size;
+    }
+
+    std::vector<uint32_t> by_size(placements.size());
+    for (uint32_t i = 0; i < by_size.size(); ++i)
+        by_size[i] = i;
+    std::ranges::stable_sort(by_size, std::greater{}, [&](uint32_t i) { return placements[i].requirements.size; });
+
+    struct Range {
+        uint64_t begin = 0;
+        uint64_t end   = 0;
+    };
+    std::vector<Range> taken;
+    for (uint32_t const i : by_size) {
+        Placement& p = placements[i];
+        uint32_t   best_heap   = k_none;
+        uint64_t   best_offset = 0;
+        uint64_t   best_growth = UINT64_MAX;
+
+        for (uint32_t h = 0; h < candidate.heaps.size(); ++h) {
+            MemoryHeapDesc const& heap = candidate.heaps[h];
+            if ((heap.compatibility & p.requirements.compatibility) == 0)
+                continue;
+
+            taken.clear();
+            for (Placement const& other : placements) {
+                if (other.heap != h || ordered(other, p) || ordered(p, other))
+                    continue;
+                taken.push_back({other.offset, other.offset + other.requirements.size});
+            }
+            std::ranges::sort(taken, std::less{}, &Range::begin);
+
+            uint64_t offset = 0;
+            for (Range const& t : taken) {
+                if (foundation::memory::align_up(offset, p.requirements.alignment) + p.requirements.size <= t.begin)
+                    break;
+                offset = std::max(offset, t.end);
+            }
+            offset = foundation::memory::align_up(offset, p.requirements.alignment);
+
+            uint64_t const end    = offset + p.requirements.size;
+            uint64_t const growth = end > heap.size ? end - heap.size : 0;
+            if (growth < best_growth) {
+                best_heap   = h;
+                best_offset = offset;
+                best_growth = growth;
+            }
+        }
+
+        if (best_heap == k_none) {
+            best_heap   = static_cast<uint32_t>(candidate.heaps.size());
+            best_offset = 0;
+            candidate.heaps.push_back(MemoryHeapDesc{.compatibility = p.requirements.compatibility});
+        }
+
+        MemoryHeapDesc& heap = candidate.heaps[best_heap];
+        heap.size          = std::max(heap.size, best_offset + p.requirements.size);
+        heap.compatibility &= p.requirements.compatibility;
+        p.heap   = best_heap;
+        p.offset = best_offset;
+
+        uint32_t const physical = resources[p.resource].physical;
+        candidate.texture_heaps[physical]       = best_heap;
+        candidate.textures[physical].heapOffset = best_offset;
+    }
+
+    for (MemoryHeapDesc const& heap : candidate.heaps)
+        stats.heapBytes += heap.size;
+    return Status::Ok;
+}
+
+/// Keeps the realized resources when the candidate layout equals the
+/// current one; otherwise retires them and creates the candidate's.
+Status RenderGraph::Impl::realize_layout() {
+    bool const have = realized.textures.size() == layout.textures.size() &&
+                      realized.buffers.size() == layout.buffers.size() &&
+                      realized.heaps.size() == layout.heaps.size();
+    if (have && same_layout(layout, candidate)) {
+        for (Resource& r : resources) {
+            if (r.physical == k_none) continue;
+            if (r.texture) r.texture_handle = realized.textures[r.physical];
+            else           r.buffer_handle  = realized.buffers[r.physical];
+        }
+        return Status::Ok;
+    }
+
+    retire_layout();
+    layout.clear();
+
+    Realized next;
+    next.heaps.reserve(candidate.heaps.size());
+    next.textures.reserve(candidate.textures.size());
+    next.buffers.reserve(candidate.buffers.size());
+    next.texture_states.assign(candidate.textures.size(), State{});
+    next.buffer_states.assign(candidate.buffers.size(), State{});
+
+    auto const rollback = [&](Status s) {
+        device->destroy_textures(next.textures);
+        device->destroy_buffers(next.buffers);
+        for (HeapHandle h : next.heaps)
+            device->destroy_memory_heap(h);
+        return s;
+    };
+
+    for (MemoryHeapDesc const& h : candidate.heaps) {
+        auto heap = device->create_memory_heap(MemoryHeapDesc{
+            .size          = h.size,
+            .compatibility = h.compatibility,
+            .debugName     = "wren.render_graph.heap",
+        });
+        if (!heap)
+            return rollback(heap.error());
+        next.heaps.push_back(*heap);
+    }
+
+    std::vector<const char*> names(candidate.textures.size() + candidate.buffers.size(), nullptr);
+    for (Resource const& r : resources) {
+        if (r.physical == k_none || r.name.empty()) continue;
+        names[r.texture ? r.physical : candidate.textures.size() + r.physical] = r.name.c_str();
+    }
+
+    for (uint32_t i = 0; i < candidate.textures.size(); ++i) {
+        TextureDesc d = candidate.textures[i];
+        d.debugName   = names[i];
+        if (candidate.texture_heaps[i] != k_none)
+            d.heap = next.heaps[candidate.texture_heaps[i]];
+        auto texture = device->create_texture(d);
+        if (!texture)
+            return rollback(texture.error());
+        next.textures.push_back(*texture);
+    }
+    for (uint32_t i = 0; i < candidate.buffers.size(); ++i) {
+        BufferDesc d = candidate.buffers[i];
+        d.debugName  = names[candidate.textures.size() + i];
+        auto buffer = device->create_buffer(d);
+        if (!buffer)
+            return rollback(buffer.error());
+        next.buffers.push_back(*buffer);
+    }
+
+    std::swap(layout, candidate);
+    realized = std::move(next);
+    for (Resource& r : resources) {
+        if (r.physical == k_none) continue;
+        if (r.texture) r.texture_handle = realized.textures[r.physical];
+        else           r.buffer_handle  = realized.buffers[r.physical];
+    }
+    return Status::Ok;
+}
+
+
+// -----------------------------------------------------------------
+// Barriers
+//
+// Barriers are keyed by where they are recorded: a pass index for the
+// barriers before that pass, k_epilogue | batch for the end of a
+// submission, k_none for the acquires handed back to the caller.
+// -----------------------------------------------------------------
+namespace {
+
+constexpr uint32_t k_epilogue = 0x8000'0000u;
+
+/// Union of two stage masks where None stands for every stage.
+[[nodiscard]] ShaderStage merge_stages(ShaderStage a, ShaderStage b) noexcept {
+    return narrow(widen(a) | widen(b));
+}
+
+} // anonymous namespace
+
+/// Records the barrier(s) taking @p r from @p from to @p to. Across queues
+/// the release goes to @p release_key and the acquire to @p acquire_key;
+/// on one queue, or when the contents are discarded, only the latter.
+void RenderGraph::Impl::add_transition(Resource const& r, State from, State const& to, bool discard,
+                                       uint32_t release_key, uint32_t acquire_key)
+{
+    bool const transfer = !discard && from.usage != 0 && from.queue != to.queue;
+    if (!transfer)
+        from.queue = to.queue;
+
+    if (r.texture) {
+        TextureBarrier const b{
+            .texture   = r.texture_handle,
+            .oldUsage  = static_cast<TextureUsage>(from.usage),
+            .newUsage  = static_cast<TextureUsage>(to.usage),
+            .srcStages = from.stages,
+            .dstStages = to.stages,
+            .srcQueue  = from.queue,
+            .dstQueue  = to.queue,
+            .discard   = discard,
+        };
+        if (transfer)
+            texture_barriers.push_back({release_key, b});
+        if (acquire_key == k_none)
+            texture_acquires.push_back(b);
+        else
+            texture_barriers.push_back({acquire_key, b});
+    } else {
+        BufferBarrier const b{
+            .buffer    = r.buffer_handle,
+            .oldUsage  = static_cast<BufferUsage>(from.usage),
+            .newUsage  = static_cast<BufferUsage>(to.usage),
+            .srcStages = from.stages,
+            .dstStages = to.stages,
+            .srcQueue  = from.queue,
+            .dstQueue  = to.queue,
+        };
+        if (transfer)
+            buffer_barriers.push_back({release_key, b});
+        if (acquire_key == k_none)
+            buffer_acquires.push_back(b);
+        else
+            buffer_barriers.push_back({acquire_key, b});
+    }
+}
+
+/// State a transient resource's memory may still be in when @p head first
+/// uses it: the previous frame's last use of it and of anything aliasing
+/// it, and this frame's earlier uses of its aliases on the same queue.
+/// Uses on other queues become a submission wait instead.
+State RenderGraph::Impl::discard_source(Resource const& r, Segment const& head) {
+    State src{0, ShaderStage::None, head.state.queue};
+    Batch& batch = batches[passes[order[head.first]].batch];
+    auto const merge = [&](State const& s) {
+        if (s.usage == 0)
+            return;
+        if (s.queue != head.state.queue) {
+            batch.previous_frame_waits |= 1u << queue_index(s.queue);
+            return;
+        }
+        src.stages = src.usage == 0 ? s.stages : merge_stages(src.stages, s.stages);
+        src.usage |= s.usage;
+    };
+
+    if (!r.texture) {
+        merge(realized.buffer_states[r.physical]);
+        return src;
+    }
+
+    Placement const& self = placements[r.physical];
+    for (uint32_t i = 0; i < placements.size(); ++i) {
+        Placement const& other = placements[i];
+        bool const overlaps = i == r.physical ||
+            (self.heap != k_none && other.heap == self.heap &&
+             other.offset < self.offset + self.requirements.size &&
+             self.offset < other.offset + other.requirements.size);
+        if (!overlaps)
+            continue;
+        merge(realized.texture_states[i]);
+        if (i != r.physical && other.last < self.first && other.last_queue == head.state.queue) {
+            Resource const& alias = resources[other.resource];
+            State const last = segments_of(alias).back().state;
+            src.stages = src.usage == 0 ? last.stages : merge_stages(src.stages, last.stages);
+            src.usage |= last.usage;
+        }
+    }
+    return src;
+}
+
+/// Derives every transition from the segments: into the first use, between
+/// consecutive uses, and for imports out of the last use into the final
+/// state. Records each transient resource's state after this frame.
+void RenderGraph::Impl::build_barriers() {
+    texture_barriers.clear();
+    buffer_barriers.clear();
+    texture_acquires.clear();
+    buffer_acquires.clear();
+    next_texture_states = realized.texture_states;
+    next_buffer_states  = realized.buffer_states;
+
+    for (Resource const& r : resources) {
+        auto const list = segments_of(r);
+        if (list.empty())
+            continue;
+        uint32_t const read_only = r.texture ? k_read_only_texture_usage : k_read_only_buffer_usage;
+
+        Segment const& head      = list.front();
+        uint32_t const head_pass = order[head.first];
+        if (!r.imported) {
+            add_transition(r, discard_source(r, head), head.state, true, k_none, head_pass);
+        } else if (r.initial.usage == 0) {
+            add_transition(r, State{}, head.state, true, k_none, head_pass);
+        } else if (r.initial.queue != head.state.queue) {
+            add_transition(r, r.initial, head.state, false,
+                           k_epilogue | prologue[queue_index(r.initial.queue)], head_pass);
+        } else if (!covers(r.initial, head.state, head.write, read_only)) {
+            add_transition(r, r.initial, head.state, false, k_none, head_pass);
+        }
+
+        for (std::size_t i = 1; i < list.size(); ++i) {
+            Segment const& prev = list[i - 1];
+            Segment const& cur  = list[i];
+            add_transition(r, prev.state, cur.state, false,
+                           k_epilogue | passes[order[prev.last]].batch, order[cur.first]);
+        }
+
+        Segment const& tail = list.back();
+        if (!r.imported) {
+            (r.texture ? next_texture_states : next_buffer_states)[r.physical] = tail.state;
+            continue;
+        }
+        if (r.final.usage == 0 || covers(tail.state, r.final, false, read_only))
+            continue;
+        uint32_t const tail_batch = k_epilogue | passes[order[tail.last]].batch;
+        if (r.final.queue == tail.state.queue)
+            add_transition(r, tail.state, r.final, false, k_none, tail_batch);
+        else
+            add_transition(r, tail.state, r.final, false, tail_batch, k_none);
+    }
+}
+
+/// Orders the barriers by where they are recorded and hands each pass and
+/// submission its range, so each boundary is one barrier call.
+void RenderGraph::Impl::finish_barriers() {
+    std::ranges::stable_sort(texture_barriers, std::less{}, &Keyed<TextureBarrier>::key);
+    std::ranges::stable_sort(buffer_barriers, std::less{}, &Keyed<BufferBarrier>::key);
+
+    for (Pass& p : passes) {
+        p.first_texture_barrier = p.texture_barrier_count = 0;
+        p.first_buffer_barrier  = p.buffer_barrier_count  = 0;
+    }
+
+    flat_texture_barriers.clear();
+    for (auto const& [key, barrier] : texture_barriers) {
+        auto const index = static_cast<uint32_t>(flat_texture_barriers.size());
+        flat_texture_barriers.push_back(barrier);
+        if (key & k_epilogue) {
+            Batch& b = batches[key & ~k_epilogue];
+            if (b.texture_release_count++ == 0)
+                b.first_texture_release = index;
+        } else {
+            Pass& p = passes[key];
+            if (p.texture_barrier_count++ == 0)
+                p.first_texture_barrier = index;
+        }
+    }
+
+    flat_buffer_barriers.clear();
+    for (auto const& [key, barrier] : buffer_barriers) {
+        auto const index = static_cast<uint32_t>(flat_buffer_barriers.size());
+        flat_buffer_barriers.push_back(barrier);
+        if (key & k_epilogue) {
+            Batch& b = batches[key & ~k_epilogue];
+            if (b.buffer_release_count++ == 0)
+                b.first_buffer_release = index;
+        } else {
+            Pass& p = passes[key];
+            if (p.buffer_barrier_count++ == 0)
+                p.first_buffer_barrier = index;
+        }
+    }
+
+    stats.textureBarriers = static_cast<uint32_t>(flat_texture_barriers.size());
+    stats.bufferBarriers  = static_cast<uint32_t>(flat_buffer_barriers.size());
+    stats.barrierCalls    = 0;
+    for (uint32_t pass : order)
+        stats.barrierCalls += passes[pass].texture_barrier_count + passes[pass].buffer_barrier_count > 0;
+    for (Batch const& b : batches)
+        stats.barrierCalls += b.texture_release_count + b.buffer_release_count > 0;
+}
+
+// -----------------------------------------------------------------
+// Transient lifetime
+// -----------------------------------------------------------------
+void RenderGraph::Impl::destroy(Realized& objects) noexcept {
+    device->destroy_textures(objects.textures);
+    device->destroy_buffers(objects.buffers);
+    for (HeapHandle heap : objects.heaps)
+        device->destroy_memory_heap(heap);
+    objects = {};
+}
+
+void RenderGraph::Impl::wait_for(SyncPoint const (&points)[k_queue_count]) noexcept {
+    SyncPoint pending[k_queue_count]{};
+    std::size_t count = 0;
+    for (SyncPoint const& p : points) {
+        if (p.value != 0)
+            pending[count++] = p;
+    }
+    if (count > 0)
+        (void)device->wait(std::span{pending, count});
+}
+
+/// Hands the realized resources to the retire queue with the last signals
+/// of every queue; destroys them after a wait when the queue cannot grow.
+void RenderGraph::Impl::retire_layout() noexcept {
+    if (realized.heaps.empty() && realized.textures.empty() && realized.buffers.empty())
+        return;
+    try {
+        Retired& slot = retired.emplace_back();
+        slot.objects  = std::move(realized);
+        std::ranges::copy(last_signals, slot.points);
+    } catch (std::bad_alloc const&) {
+        wait_for(last_signals);
+        destroy(realized);
+    }
+    realized = {};
+}
+
+void RenderGraph::Impl::collect_retired(bool wait) noexcept {
+    while (!retired.empty()) {
+        Retired& front = retired.front();
+        if (wait)
+            wait_for(front.points);
+        else if (!std::ranges::all_of(front.points, [&](SyncPoint p) { return device->is_complete(p); }))
+            break;
+        destroy(front.objects);
+        retired.pop_front();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Execution
+// -------------------------------------------------------------------------------------------------
+auto RenderGraph::execute(std::span<SyncPoint const> waits) noexcept
+    -> std::expected<RenderGraphResult, Status>
+{
+    WREN_PROFILE_ZONE("RenderGraph::execute");
+    auto& impl = *impl_;
+    if (!impl.compiled)
+        return std::unexpected{Status::InvalidArgument};
+    impl.compiled = false;
+
+    try {
+        impl.batch_signals.clear();
+        for (Batch const& b : impl.batches) {
+            auto list = impl.device->begin_command_list({.queue = b.queue});
+            if (!list)
+                return std::unexpected{list.error()};
+
+            for (uint32_t const index : std::span{impl.batch_passes}.subspan(b.first_pass, b.pass_count)) {
+                Pass& p = impl.passes[index];
+                bool const region = impl.desc.profileRegions && p.name;
+                if (region)
+                    list->begin_region(p.name);
+                if (p.texture_barrier_count + p.buffer_barrier_count > 0) {
+                    list->barriers(
+                        std::span{impl.flat_texture_barriers}.subspan(p.first_texture_barrier, p.texture_barrier_count),
+                        std::span{impl.flat_buffer_barriers}.subspan(p.first_buffer_barrier, p.buffer_barrier_count));
+                }
+                if (p.execute) {
+                    RenderGraphContext context{*this, *list, b.queue};
+                    p.execute(context);
+                }
+                if (region)
+                    list->end_region();
+            }
+            if (b.texture_release_count + b.buffer_release_count > 0) {
+                list->barriers(
+                    std::span{impl.flat_texture_barriers}.subspan(b.first_texture_release, b.texture_release_count),
+                    std::span{impl.flat_buffer_barriers}.subspan(b.first_buffer_release, b.buffer_release_count));
+            }
+            if (Status s = list->end(); s != Status::Ok)
+                return std::unexpected{s};
+
+            impl.submit_waits.clear();
+            for (uint32_t const w : std::span{impl.batch_waits}.subspan(b.first_wait, b.wait_count))
+                impl.submit_waits.push_back(impl.batch_signals[w]);
+            if (b.first_of_queue)
+                impl.submit_waits.insert(impl.submit_waits.end(), waits.begin(), waits.end());
+            for (uint32_t q = 0; q < k_queue_count; ++q) {
+                if ((b.previous_frame_waits & (1u << q)) && impl.last_signals[q].value != 0)
+                    impl.submit_waits.push_back(impl.last_signals[q]);
+            }
+
+            CommandListHandle const handle = list->handle();
+            auto point = impl.device->submit({&handle, 1}, impl.submit_waits);
+            if (!point)
+                return std::unexpected{point.error()};
+            impl.batch_signals.push_back(*point);
+        }
+
+        impl.result_signals.clear();
+        SyncPoint latest[k_queue_count]{};
+        for (SyncPoint const& s : impl.batch_signals)
+            latest[queue_index(s.queue)] = s;
+        for (SyncPoint const& s : latest) {
+            if (s.value == 0)
+                continue;
+            impl.last_signals[queue_index(s.queue)] = s;
+            impl.result_signals.push_back(s);
+        }
+    } catch (std::bad_alloc const&) {
+        return std::unexpected{Status::OutOfMemory};
+    }
+
+    impl.realized.texture_states = std::move(impl.next_texture_states);
+    impl.realized.buffer_states  = std::move(impl.next_buffer_states);
+    return RenderGraphResult{
+        .signals         = impl.result_signals,
+        .textureAcquires = impl.texture_acquires,
+        .bufferAcquires  = impl.buffer_acquires,
+    };
+}
+
+TextureHandle RenderGraph::texture(GraphTexture texture) const noexcept {
+    auto const& resources = impl_->resources;
+    if (texture.index >= resources.size() || !resources[texture.index].texture)
+        return {};
+    return resources[texture.index].texture_handle;
+}
+
+BufferHandle RenderGraph::buffer(GraphBuffer buffer) const noexcept {
+    auto const& resources = impl_->resources;
+    if (buffer.index >= resources.size() || resources[buffer.index].texture)
+        return {};
+    return resources[buffer.index].buffer_handle;
+}
+
+RenderGraphStats const& RenderGraph::stats() const noexcept {
+    return impl_->stats;
+}
+
+} // namespace wren::rhi
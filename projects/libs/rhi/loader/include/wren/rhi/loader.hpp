@@ -1,14 +1,320 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <expected>
+#include <span>
 #include <string>
+#include <type_traits>
+#include <vector>
 
+#include <wren/foundation/diag/profiler.hpp>
+#include <wren/rhi/api/commands.hpp>
 #include <wren/rhi/api/enums.hpp>
 #include <wren/rhi/api/features.hpp>
+#include <wren/rhi/api/pipelines.hpp>
+#include <wren/rhi/api/resources.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/api/swapchain.hpp>
 #include <wren/rhi/backend.hpp>
+#include <wren/rhi/static_backend.hpp>
 
 namespace wren::rhi {
 
+// -------------------------------------------------------------------------------------------------
+// CommandList — non-owning view of a backend command list.
+//
+// Obtained from BackendDevice::begin_command_list(). Trivially copyable; the
+// list itself is recycled by the backend (see wren/rhi/api/commands.hpp), so
+// nothing happens on destruction. Recording calls are inline and go straight
+// to the backend vtable.
+// -------------------------------------------------------------------------------------------------
+class CommandList {
+public:
+    CommandList() noexcept = default;
+
+    [[nodiscard]] CommandListHandle handle() const noexcept { return handle_; }
+    [[nodiscard]] bool is_valid() const noexcept { return handle_ != nullptr; }
+
+    [[nodiscard]] Status end() const noexcept { return recording()->end_command_list(handle_); }
+
+    void barriers(std::span<TextureBarrier const> textures,
+                  std::span<BufferBarrier const>  buffers = {}) const noexcept {
+        recording()->cmd_barriers(handle_,
+                                  textures.data(), static_cast<uint32_t>(textures.size()),
+                                  buffers.data(),  static_cast<uint32_t>(buffers.size()));
+    }
+    void barriers(std::span<BufferBarrier const> buffers) const noexcept {
+        recording()->cmd_barriers(handle_, nullptr, 0,
+                                  buffers.data(), static_cast<uint32_t>(buffers.size()));
+    }
+
+    void copy_buffer(BufferHandle src, BufferHandle dst,
+                     std::span<BufferCopy const> regions) const noexcept {
+        recording()->cmd_copy_buffer(handle_, src, dst,
+                                     regions.data(), static_cast<uint32_t>(regions.size()));
+    }
+    void copy_buffer_to_texture(BufferHandle src, TextureHandle dst,
+                                std::span<BufferTextureCopy const> regions) const noexcept {
+        recording()->cmd_copy_buffer_to_texture(handle_, src, dst,
+                                                regions.data(), static_cast<uint32_t>(regions.size()));
+    }
+    void copy_texture_to_buffer(TextureHandle src, BufferHandle dst,
+                                std::span<BufferTextureCopy const> regions) const noexcept {
+        recording()->cmd_copy_texture_to_buffer(handle_, src, dst,
+                                                regions.data(), static_cast<uint32_t>(regions.size()));
+    }
+
+    void begin_rendering(RenderingDesc const& desc) const noexcept {
+        recording()->cmd_begin_rendering(handle_, &desc);
+    }
+    void end_rendering() const noexcept { recording()->cmd_end_rendering(handle_); }
+
+    void set_viewport(Viewport const& viewport) const noexcept {
+        recording()->cmd_set_viewport(handle_, &viewport);
+    }
+    void set_scissor(Scissor const& scissor) const noexcept {
+        recording()->cmd_set_scissor(handle_, &scissor);
+    }
+
+    /// Binds @p pipeline, or its fallback while it compiles (see
+    /// BackendVTable::cmd_bind_pipeline).
+    void bind_pipeline(PipelineHandle pipeline) const noexcept {
+        recording()->cmd_bind_pipeline(handle_, pipeline);
+    }
+
+    /// Writes @p data at byte @p offset of the push constant range.
+    void push_constants(uint32_t offset, std::span<std::byte const> data) const noexcept {
+        recording()->cmd_push_constants(handle_, offset, static_cast<uint32_t>(data.size()), data.data());
+    }
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    void push_constants(T const& value, uint32_t offset = 0) const noexcept {
+        push_constants(offset, std::as_bytes(std::span{&value, 1}));
+    }
+
+    /// @p offsets must be as long as @p buffers.
+    void bind_vertex_buffers(uint32_t first_binding, std::span<BufferHandle const> buffers,
+                             std::span<uint64_t const> offsets) const noexcept {
+        recording()->cmd_bind_vertex_buffers(handle_, first_binding, buffers.data(), offsets.data(),
+                                             static_cast<uint32_t>(buffers.size()));
+    }
+    void bind_index_buffer(BufferHandle buffer, uint64_t offset, IndexType type) const noexcept {
+        recording()->cmd_bind_index_buffer(handle_, buffer, offset, type);
+    }
+
+    void draw(uint32_t vertex_count, uint32_t instance_count = 1,
+              uint32_t first_vertex = 0, uint32_t first_instance = 0) const noexcept {
+        recording()->cmd_draw(handle_, vertex_count, instance_count, first_vertex, first_instance);
+    }
+    void draw_indexed(uint32_t index_count, uint32_t instance_count = 1, uint32_t first_index = 0,
+                      int32_t vertex_offset = 0, uint32_t first_instance = 0) const noexcept {
+        recording()->cmd_draw_indexed(handle_, index_count, instance_count, first_index,
+                                      vertex_offset, first_instance);
+    }
+    void dispatch(uint32_t x, uint32_t y = 1, uint32_t z = 1) const noexcept {
+        recording()->cmd_dispatch(handle_, x, y, z);
+    }
+
+    /// GPU-driven draws: arguments, and optionally the draw count, come from
+    /// buffers (see IndirectDrawDesc).
+    void draw_indirect(IndirectDrawDesc const& desc) const noexcept {
+        recording()->cmd_draw_indirect(handle_, &desc);
+    }
+    void draw_indexed_indirect(IndirectDrawDesc const& desc) const noexcept {
+        recording()->cmd_draw_indexed_indirect(handle_, &desc);
+    }
+    /// Dispatches the DispatchIndirectCommand at @p offset of @p buffer.
+    void dispatch_indirect(BufferHandle buffer, uint64_t offset = 0) const noexcept {
+        recording()->cmd_dispatch_indirect(handle_, buffer, offset);
+    }
+
+    /// Builds @p builds in one batch (see AccelerationStructureBuild). Not
+    /// on the per-draw path, so it always goes through the vtable.
+    void build_acceleration_structures(std::span<AccelerationStructureBuild const> builds) const noexcept {
+        backend_->cmd_build_acceleration_structures(handle_, builds.data(), static_cast<uint32_t>(builds.size()));
+    }
+    /// Writes one uint64 compacted size per structure at @p offset of @p dst.
+    void write_compacted_sizes(std::span<AccelerationStructureHandle const> structures,
+                               BufferHandle dst, uint64_t offset = 0) const noexcept {
+        backend_->cmd_write_compacted_sizes(handle_, structures.data(), static_cast<uint32_t>(structures.size()),
+                                            dst, offset);
+    }
+    void copy_acceleration_structure(AccelerationStructureHandle src, AccelerationStructureHandle dst,
+                                     AccelerationStructureCopyMode mode) const noexcept {
+        backend_->cmd_copy_acceleration_structure(handle_, src, dst, mode);
+    }
+
+    /// Records @p packets in order in one backend call; the cheap way to
+    /// record many draws (see CommandPacket, CommandPacketBatch).
+    void record(std::span<CommandPacket const> packets) const noexcept {
+        recording()->cmd_record_packets(handle_, packets.data(), static_cast<uint32_t>(packets.size()));
+    }
+
+    /// Replays ended secondary lists, in order.
+    void execute(std::span<CommandListHandle const> secondaries) const noexcept {
+        recording()->cmd_execute_command_lists(handle_, secondaries.data(),
+                                               static_cast<uint32_t>(secondaries.size()));
+    }
+
+    /// Opens a GPU profiling region; pair with end_region() or use
+    /// ProfileRegionScope.
+    void begin_region(ProfileRegionDesc const& desc) const noexcept {
+        recording()->cmd_begin_profile_region(handle_, &desc);
+    }
+    void begin_region(const char* name) const noexcept { begin_region({.name = name}); }
+    void end_region() const noexcept { recording()->cmd_end_profile_region(handle_); }
+
+private:
+    friend class BackendDevice;
+    CommandList(BackendVTable const* backend, CommandListHandle handle) noexcept
+        : backend_(backend), handle_(handle) {}
+
+    /// Where recording calls go: the backend's vtable, or the functions of a
+    /// statically linked backend called directly (wren/rhi/static_backend.hpp).
+#if WREN_RHI_STATIC_BACKEND
+    [[nodiscard]] static constexpr static_backend::RecordingTable const* recording() noexcept {
+        return &static_backend::k_recording;
+    }
+#else
+    [[nodiscard]] BackendVTable const* recording() const noexcept { return backend_; }
+#endif
+
+    BackendVTable const* backend_ = nullptr;
+    CommandListHandle    handle_  = nullptr;
+};
+
+// -------------------------------------------------------------------------------------------------
+// ProfileRegionScope — closes a CommandList profiling region at scope exit.
+//
+//   ProfileRegionScope region{list, "shadows"};
+// -------------------------------------------------------------------------------------------------
+class ProfileRegionScope {
+public:
+    ProfileRegionScope(CommandList const& list, ProfileRegionDesc const& desc) noexcept : list_(list) {
+        list_.begin_region(desc);
+    }
+    ProfileRegionScope(CommandList const& list, const char* name) noexcept
+        : ProfileRegionScope(list, ProfileRegionDesc{.name = name}) {}
+    ~ProfileRegionScope() { list_.end_region(); }
+
+    ProfileRegionScope(ProfileRegionScope const&)            = delete;
+    ProfileRegionScope& operator=(ProfileRegionScope const&) = delete;
+
+private:
+    CommandList list_;
+};
+
+// -------------------------------------------------------------------------------------------------
+// CommandPacketBatch — packets gathered on the stack, recorded N at a time.
+//
+//   CommandPacketBatch batch{list};
+//   for (auto const& item : items) {
+//       batch.push(push_constants_packet(item.indices));
+//       batch.push(draw_indexed_packet(item.index_count));
+//   }
+//   // records the remainder at scope exit, or call flush()
+//
+// One backend call per N packets; N = 128 is 4 KiB of stack.
+// -------------------------------------------------------------------------------------------------
+template<std::size_t N = 128>
+class CommandPacketBatch {
+public:
+    explicit CommandPacketBatch(CommandList const& list) noexcept : list_(list) {}
+    ~CommandPacketBatch() { flush(); }
+
+    CommandPacketBatch(CommandPacketBatch const&)            = delete;
+    CommandPacketBatch& operator=(CommandPacketBatch const&) = delete;
+
+    void push(CommandPacket const& packet) noexcept {
+        if (count_ == N) {
+            flush();
+        }
+        packets_[count_++] = packet;
+    }
+
+    /// Records the gathered packets now.
+    void flush() noexcept {
+        if (count_ > 0) {
+            list_.record({packets_, count_});
+            count_ = 0;
+        }
+    }
+
+private:
+    CommandList   list_;
+    std::size_t   count_ = 0;
+    CommandPacket packets_[N];
+};
+
+// -------------------------------------------------------------------------------------------------
+// Swapchain — RAII owner of a backend swapchain.
+//
+// Obtained from BackendDevice::create_swapchain(); see
+// wren/rhi/api/swapchain.hpp for the frame order:
+//
+//   (void)swapchain->wait_for_present();
+//   window.poll_events();
+//   (void)device->begin_frame();
+//   auto image = swapchain->acquire();
+//   /* record into image->texture, submit waiting on image->ready */
+//   (void)device->end_frame();
+//   if (swapchain->present() == Status::OutOfDate) { /* resize */ }
+//
+// Frame thread only. Move-only; destroy it before its device.
+// -------------------------------------------------------------------------------------------------
+class Swapchain {
+public:
+    [[nodiscard]] SwapchainHandle handle() const noexcept { return handle_; }
+
+    /// Acquires the image to render this frame, between begin_frame() and
+    /// end_frame(). Status::OutOfDate asks for resize().
+    [[nodiscard]] auto acquire(uint64_t timeout_ns = UINT64_MAX) noexcept
+        -> std::expected<SwapchainImage, Status>;
+
+    /// Presents the acquired image after end_frame().
+    [[nodiscard]] Status present() noexcept {
+        WREN_PROFILE_ZONE("rhi::present");
+        return backend_->present_swapchain(device_, handle_);
+    }
+
+    /// Frame pacing: blocks until the frames queued for display have
+    /// dropped below SwapchainDesc::maxFrameLatency. Call it right before
+    /// sampling input so the frame starts as late as the display allows.
+    [[nodiscard]] Status wait_for_present(uint64_t timeout_ns = UINT64_MAX) noexcept {
+        WREN_PROFILE_ZONE("rhi::wait_for_present");
+        return backend_->wait_for_present(device_, handle_, timeout_ns);
+    }
+
+    /// Recreates the images at a new framebuffer size, outside a frame.
+    [[nodiscard]] Status resize(uint32_t width, uint32_t height) noexcept {
+        WREN_PROFILE_ZONE("rhi::resize_swapchain");
+        return backend_->resize_swapchain(device_, handle_, width, height);
+    }
+
+    [[nodiscard]] SwapchainInfo info() const noexcept {
+        SwapchainInfo out{};
+        backend_->query_swapchain(device_, handle_, &out);
+        return out;
+    }
+
+    Swapchain(Swapchain&& other) noexcept;
+    Swapchain& operator=(Swapchain&& other) noexcept;
+    ~Swapchain();
+
+    Swapchain(Swapchain const&)            = delete;
+    Swapchain& operator=(Swapchain const&) = delete;
+
+private:
+    friend class BackendDevice;
+    Swapchain(BackendVTable* backend, DeviceHandle device, SwapchainHandle handle) noexcept
+        : backend_(backend), device_(device), handle_(handle) {}
+
+    BackendVTable*  backend_ = nullptr;
+    DeviceHandle    device_  = nullptr;
+    SwapchainHandle handle_  = nullptr;
+};
+
 // -------------------------------------------------------------------------------------------------
 // BackendDevice — RAII owner of a live device created inside a backend DLL.
 //
@@ -27,6 +333,265 @@ public:
     /// call additional backend entry points).
     [[nodiscard]] DeviceHandle handle() const noexcept { return handle_; }
 
+    // -----------------------------------------------------------------
+    // Resources
+    //
+    // The span overloads forward to the backend in a single call; prefer
+    // them when creating or destroying many resources at once.
+    // -----------------------------------------------------------------
+
+    /// Creates one buffer per descriptor. @p out must be as long as @p descs.
+    [[nodiscard]] Status create_buffers(std::span<BufferDesc const> descs,
+                                        std::span<BufferHandle> out) noexcept;
+    [[nodiscard]] auto   create_buffer(BufferDesc const& desc) noexcept
+        -> std::expected<BufferHandle, Status>;
+    void destroy_buffers(std::span<BufferHandle const> handles) noexcept;
+    void destroy_buffer(BufferHandle handle) noexcept { destroy_buffers({&handle, 1}); }
+
+    /// Creates one texture per descriptor. @p out must be as long as @p descs.
+    [[nodiscard]] Status create_textures(std::span<TextureDesc const> descs,
+                                         std::span<TextureHandle> out) noexcept;
+    [[nodiscard]] auto   create_texture(TextureDesc const& desc) noexcept
+        -> std::expected<TextureHandle, Status>;
+    void destroy_textures(std::span<TextureHandle const> handles) noexcept;
+    void destroy_texture(TextureHandle handle) noexcept { destroy_textures({&handle, 1}); }
+
+    /// Persistent CPU pointer of an Upload / Readback buffer; nullptr otherwise.
+    [[nodiscard]] void* map_buffer(BufferHandle buffer) const noexcept;
+
+    /// GPU address of @p buffer for shaders that read it through a pointer;
+    /// 0 without Feature::BufferDeviceAddress. Changes with defragment_memory().
+    [[nodiscard]] uint64_t device_address(BufferHandle buffer) const noexcept {
+        return backend_->buffer_device_address(handle_, buffer);
+    }
+
+    /// Heap indices assigned at creation (see BindlessHeapInfo); shaders
+    /// receive them through push constants or buffers.
+    [[nodiscard]] uint32_t bindless_index(BufferHandle buffer) const noexcept {
+        return backend_->buffer_bindless_index(handle_, buffer);
+    }
+    [[nodiscard]] uint32_t bindless_index(TextureHandle texture,
+                                          BindlessClass cls = BindlessClass::SampledTexture) const noexcept {
+        return backend_->texture_bindless_index(handle_, texture, cls);
+    }
+
+    /// Mode, capacity and occupancy of the bindless heap.
+    [[nodiscard]] BindlessHeapInfo bindless_heap() const noexcept;
+
+    /// Sampler-array indices of samplers matching @p descs, created on
+    /// first use and shared by equal descriptors. @p out must be as long as
+    /// @p descs. Cheap enough to call per material per frame.
+    [[nodiscard]] Status find_samplers(std::span<SamplerDesc const> descs, std::span<uint32_t> out) const noexcept;
+    [[nodiscard]] auto   find_sampler(SamplerDesc const& desc) const noexcept -> std::expected<uint32_t, Status>;
+
+    /// Per-heap budget and usage; cheap enough to poll once per frame to
+    /// drive streaming decisions.
+    [[nodiscard]] MemoryBudget memory_budget() const noexcept;
+
+    /// Moves GpuOnly buffers out of sparsely used memory blocks and releases
+    /// the blocks that end up empty. Blocks until the GPU is idle; call
+    /// outside begin_frame() / end_frame(), e.g. behind a loading screen.
+    [[nodiscard]] auto defragment(DefragmentDesc const& desc = {}) noexcept
+        -> std::expected<DefragmentStats, Status>;
+
+    /// Size, alignment and heap compatibility of each texture in @p descs,
+    /// for placing them in aliasing heaps. @p out must be as long as @p descs.
+    [[nodiscard]] Status texture_memory_requirements(std::span<TextureDesc const> descs,
+                                                     std::span<MemoryRequirements> out) const noexcept;
+
+    /// Aliasing heap that textures are placed into through TextureDesc::heap.
+    [[nodiscard]] auto create_memory_heap(MemoryHeapDesc const& desc) noexcept
+        -> std::expected<HeapHandle, Status>;
+    void destroy_memory_heap(HeapHandle handle) noexcept {
+        backend_->destroy_memory_heaps(handle_, &handle, 1);
+    }
+
+    /// Page layout of a sparse texture (TextureDesc::sparse).
+    [[nodiscard]] auto sparse_texture_info(TextureHandle texture) const noexcept
+        -> std::expected<SparseTextureInfo, Status>;
+
+    /// Queues one batch of sparse page binds for this frame on the sparse
+    /// binding queue; like submit(), between begin_frame() and end_frame().
+    /// @returns The SyncPoint that uses of the newly bound pages wait on.
+    [[nodiscard]] auto bind_sparse(std::span<SparsePageBind const> binds,
+                                   std::span<SyncPoint const>      waits = {}) noexcept
+        -> std::expected<SyncPoint, Status>;
+
+    // -----------------------------------------------------------------
+    // Acceleration structures (Feature::RayTracing)
+    //
+    // Batched GPU builds are recorded on a CommandList; see
+    // wren/rhi/raytracing for a manager that batches, compacts and refits.
+    // -----------------------------------------------------------------
+
+    /// Structure and scratch sizes for builds of @p inputs' type and counts.
+    [[nodiscard]] auto acceleration_structure_sizes(AccelerationStructureInputs const& inputs) const noexcept
+        -> std::expected<AccelerationStructureSizes, Status>;
+
+    /// Creates one structure per descriptor. @p out must be as long as @p descs.
+    [[nodiscard]] Status create_acceleration_structures(std::span<AccelerationStructureDesc const> descs,
+                                                        std::span<AccelerationStructureHandle> out) noexcept;
+    [[nodiscard]] auto   create_acceleration_structure(AccelerationStructureDesc const& desc) noexcept
+        -> std::expected<AccelerationStructureHandle, Status>;
+    void destroy_acceleration_structures(std::span<AccelerationStructureHandle const> handles) noexcept {
+        backend_->destroy_acceleration_structures(handle_, handles.data(), static_cast<uint32_t>(handles.size()));
+    }
+    void destroy_acceleration_structure(AccelerationStructureHandle handle) noexcept {
+        destroy_acceleration_structures({&handle, 1});
+    }
+
+    /// Value for AccelerationStructureInstance::accelerationStructure.
+    [[nodiscard]] uint64_t acceleration_structure_reference(AccelerationStructureHandle structure) const noexcept {
+        return backend_->acceleration_structure_reference(handle_, structure);
+    }
+
+    /// Builds into Upload structures on the CPU, spread over the device's
+    /// job system; blocks until done (Feature::AccelerationStructureHostBuild).
+    [[nodiscard]] Status build_acceleration_structures_on_host(
+        std::span<AccelerationStructureBuild const> builds) noexcept;
+
+    // -----------------------------------------------------------------
+    // Shader modules
+    //
+    // Identical SPIR-V shares one driver module and one reflection, so
+    // loading every permutation of a level stays proportional to the
+    // distinct code it contains.
+    // -----------------------------------------------------------------
+
+    /// Creates one module per descriptor. @p out must be as long as @p descs.
+    [[nodiscard]] Status create_shader_modules(std::span<ShaderModuleDesc const> descs,
+                                               std::span<ShaderModuleHandle> out) noexcept;
+    [[nodiscard]] auto   create_shader_module(ShaderModuleDesc const& desc) noexcept
+        -> std::expected<ShaderModuleHandle, Status>;
+    void destroy_shader_modules(std::span<ShaderModuleHandle const> handles) noexcept {
+        backend_->destroy_shader_modules(handle_, handles.data(), static_cast<uint32_t>(handles.size()));
+    }
+    void destroy_shader_module(ShaderModuleHandle handle) noexcept { destroy_shader_modules({&handle, 1}); }
+
+    /// Entry points, push constant size and bindings of @p module.
+    [[nodiscard]] auto shader_reflection(ShaderModuleHandle module) const noexcept
+        -> std::expected<ShaderReflection, Status>;
+
+    /// Hit / miss counters of the pipeline cache and whether a file was
+    /// loaded, plus the shader module cache counters.
+    [[nodiscard]] PipelineCacheStats pipeline_cache_stats() const noexcept;
+
+    /// Persists the pipeline cache now instead of only at destruction.
+    [[nodiscard]] Status save_pipeline_cache() noexcept;
+
+    // -----------------------------------------------------------------
+    // Pipelines
+    //
+    // Handles come back immediately; pipelines compile in the background
+    // when DeviceDesc::jobSystem is set. Poll pipeline_status(), give each
+    // one a fallback, or wait_pipelines() behind a loading screen.
+    // -----------------------------------------------------------------
+
+    /// Creates one pipeline per descriptor. @p out must be as long as @p descs.
+    [[nodiscard]] Status create_graphics_pipelines(std::span<GraphicsPipelineDesc const> descs,
+                                                   std::span<PipelineHandle> out) noexcept;
+    [[nodiscard]] auto   create_graphics_pipeline(GraphicsPipelineDesc const& desc) noexcept
+        -> std::expected<PipelineHandle, Status>;
+    [[nodiscard]] Status create_compute_pipelines(std::span<ComputePipelineDesc const> descs,
+                                                  std::span<PipelineHandle> out) noexcept;
+    [[nodiscard]] auto   create_compute_pipeline(ComputePipelineDesc const& desc) noexcept
+        -> std::expected<PipelineHandle, Status>;
+    void destroy_pipelines(std::span<PipelineHandle const> handles) noexcept;
+    void destroy_pipeline(PipelineHandle handle) noexcept { destroy_pipelines({&handle, 1}); }
+
+    [[nodiscard]] PipelineStatus pipeline_status(PipelineHandle pipeline) const noexcept {
+        return backend_->pipeline_status(handle_, pipeline);
+    }
+
+    /// Moves still-queued pipelines to the front of the compile queue.
+    void prioritize_pipelines(std::span<PipelineHandle const> handles) noexcept;
+
+    /// Blocks until none of @p handles is pending; Status::InternalError when
+    /// any failed to compile.
+    [[nodiscard]] Status wait_pipelines(std::span<PipelineHandle const> handles) noexcept;
+
+    // -----------------------------------------------------------------
+    // Frames & command lists
+    //
+    // begin_frame() / end_frame() bracket a frame on the frame thread.
+    // In between, any thread may begin and record command lists; queued
+    // submissions are flushed with one queue submit per queue at end_frame().
+    // -----------------------------------------------------------------
+
+    [[nodiscard]] Status begin_frame() noexcept {
+        WREN_PROFILE_ZONE("rhi::begin_frame");
+        return backend_->begin_frame(handle_);
+    }
+    [[nodiscard]] Status end_frame() noexcept {
+        WREN_PROFILE_ZONE("rhi::end_frame");
+        return backend_->end_frame(handle_);
+    }
+
+    /// GPU profiling regions of the newest frame read back so far,
+    /// framesInFlight frames behind the current one. Frame thread only; the
+    /// regions stay valid until the next begin_frame().
+    [[nodiscard]] ProfileFrame profile_frame() const noexcept;
+
+    /// Begins a command list from the calling thread's pool.
+    [[nodiscard]] auto begin_command_list(CommandListDesc const& desc = {}) noexcept
+        -> std::expected<CommandList, Status>;
+
+    /// Queues one submission of ended primary lists for this frame.
+    /// @returns The SyncPoint the submission signals on its queue.
+    [[nodiscard]] auto submit(std::span<CommandListHandle const> lists,
+                              std::span<SyncPoint const>         waits = {}) noexcept
+        -> std::expected<SyncPoint, Status>
+    {
+        WREN_PROFILE_ZONE("rhi::submit");
+        SubmitDesc const desc{
+            .lists     = lists.data(),
+            .listCount = static_cast<uint32_t>(lists.size()),
+            .waits     = waits.data(),
+            .waitCount = static_cast<uint32_t>(waits.size()),
+        };
+        SyncPoint point{};
+        if (Status s = backend_->submit_command_lists(handle_, &desc, &point); s != Status::Ok) {
+            return std::unexpected{s};
+        }
+        return point;
+    }
+
+    // -----------------------------------------------------------------
+    // Timelines
+    // -----------------------------------------------------------------
+
+    /// Blocks until every point is reached; Status::Timeout when
+    /// @p timeout_ns elapses first.
+    [[nodiscard]] Status wait(std::span<SyncPoint const> points,
+                              uint64_t timeout_ns = UINT64_MAX) noexcept {
+        WREN_PROFILE_ZONE("rhi::wait");
+        return backend_->wait_sync_points(handle_, points.data(),
+                                          static_cast<uint32_t>(points.size()), timeout_ns);
+    }
+
+    [[nodiscard]] Status wait(SyncPoint point, uint64_t timeout_ns = UINT64_MAX) noexcept {
+        return wait({&point, 1}, timeout_ns);
+    }
+
+    /// Last value the GPU has reached on @p queue's timeline.
+    [[nodiscard]] uint64_t completed_value(QueueType queue) const noexcept {
+        return backend_->completed_value(handle_, queue);
+    }
+
+    /// True when the GPU has reached @p point (non-blocking).
+    [[nodiscard]] bool is_complete(SyncPoint point) const noexcept {
+        return point.value <= completed_value(point.queue);
+    }
+
+    // -----------------------------------------------------------------
+    // Presentation
+    // -----------------------------------------------------------------
+
+    /// Creates a swapchain for a window. Needs Feature::Presentation.
+    /// Returns an error string if creation fails.
+    [[nodiscard]] auto create_swapchain(SwapchainDesc const& desc)
+        -> std::expected<Swapchain, std::string>;
+
     BackendDevice(BackendDevice&& other) noexcept;
     BackendDevice& operator=(BackendDevice&& other) noexcept;
     ~BackendDevice();
@@ -35,17 +600,78 @@ public:
     BackendDevice& operator=(BackendDevice const&) = delete;
 
 private:
+    friend class BackendInstance;
     friend class BackendLibrary;
     explicit BackendDevice(BackendVTable* backend,
                            DeviceHandle handle,
                            Capabilities caps) noexcept
         : backend_(backend), handle_(handle), capabilities_(caps) {}
 
+    /// Shared by BackendLibrary and BackendInstance; null @p instance asks
+    /// the backend for a private one.
+    [[nodiscard]] static auto create(BackendVTable* backend, InstanceHandle instance,
+                                     DeviceDesc const& desc)
+        -> std::expected<BackendDevice, std::string>;
+
     BackendVTable* backend_      = nullptr;
     DeviceHandle   handle_       = nullptr;
     Capabilities        capabilities_ = {};
 };
 
+// -------------------------------------------------------------------------------------------------
+// trace_profile_frame — GPU regions on the CPU profiler's timeline.
+//
+// Copies the regions of a ProfileFrame into the CPU profiler
+// (wren/foundation/diag/profiler.hpp), one track per queue, so its Chrome
+// trace shows them next to the zones of the threads that recorded them.
+// Regions are placed by their host times and are skipped without
+// Feature::CalibratedTimestamps. Call once per frame after profile_frame().
+// -------------------------------------------------------------------------------------------------
+void trace_profile_frame(ProfileFrame const& frame) noexcept;
+
+// -------------------------------------------------------------------------------------------------
+// BackendInstance — RAII owner of a shared backend instance.
+//
+// Obtained from BackendLibrary::create_instance(). Every device created
+// from it shares one driver instance, so loader, driver and layer start-up
+// is paid once instead of once per device:
+//
+//   auto instance = lib->create_instance({.debug = true});
+//   for (AdapterDesc const& adapter : instance->adapters()) { /* pick one */ }
+//   auto device = instance->create_device({.preferredAdapterIndex = picked.index});
+//
+// Devices hold a reference to the instance, so it may be destroyed before
+// them; the backend DLL must outlive both. Move-only.
+// -------------------------------------------------------------------------------------------------
+class BackendInstance {
+public:
+    /// Raw opaque handle.
+    [[nodiscard]] InstanceHandle handle() const noexcept { return handle_; }
+
+    /// One snapshot per adapter, indexed as DeviceDesc::preferredAdapterIndex.
+    [[nodiscard]] std::vector<AdapterDesc> adapters() const;
+
+    /// Creates a logical device on this instance.
+    /// Returns an error string if device creation fails.
+    [[nodiscard]] auto create_device(DeviceDesc const& desc)
+        -> std::expected<BackendDevice, std::string>;
+
+    BackendInstance(BackendInstance&& other) noexcept;
+    BackendInstance& operator=(BackendInstance&& other) noexcept;
+    ~BackendInstance();
+
+    BackendInstance(BackendInstance const&)            = delete;
+    BackendInstance& operator=(BackendInstance const&) = delete;
+
+private:
+    friend class BackendLibrary;
+    explicit BackendInstance(BackendVTable* backend, InstanceHandle handle) noexcept
+        : backend_(backend), handle_(handle) {}
+
+    BackendVTable* backend_ = nullptr;
+    InstanceHandle handle_  = nullptr;
+};
+
 // -------------------------------------------------------------------------------------------------
 // BackendLibrary — RAII owner of a loaded backend DLL.
 //
@@ -57,14 +683,17 @@ private:
 //   if (!device) { /* device.error() */ }
 //
 // The DLL is unloaded when the BackendLibrary is destroyed.
-// All BackendDevice instances obtained from a library must be destroyed
-// before the BackendLibrary itself is destroyed.
+// All BackendInstance and BackendDevice objects obtained from a library
+// must be destroyed before the BackendLibrary itself is destroyed.
 // BackendLibrary is move-only; do not copy.
 //
 // DLL naming convention (resolved relative to the executable):
 //   Windows  : wren_rhi_<backend>[d].dll
 //   Linux    : libwren_rhi_<backend>[d].so
 //   macOS    : libwren_rhi_<backend>[d].dylib
+//
+// With WREN_RHI_STATIC_BACKEND set, the one backend linked in is loaded
+// without a DLL and every other Backend value fails to load.
 // -------------------------------------------------------------------------------------------------
 class BackendLibrary {
 public:
@@ -73,7 +702,12 @@ public:
     [[nodiscard]] static auto load(Backend which)
         -> std::expected<BackendLibrary, std::string>;
 
-    /// Creates a logical device satisfying @p desc.
+    /// Creates a shared instance for several devices and adapter selection.
+    /// Returns an error string if instance creation fails.
+    [[nodiscard]] auto create_instance(InstanceDesc const& desc = {})
+        -> std::expected<BackendInstance, std::string>;
+
+    /// Creates a logical device satisfying @p desc on a private instance.
     /// Returns an error string if device creation fails.
     [[nodiscard]] auto create_device(DeviceDesc const& desc)
         -> std::expected<BackendDevice, std::string>;
@@ -10,8 +10,10 @@
 #  include <dlfcn.h>
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <iterator>
 
 namespace wren::rhi {
 
@@ -19,7 +21,7 @@ namespace wren::rhi {
 // Platform helpers
 // -------------------------------------------------------------------------------------------------
 
-static void* platform_load(const char* name) noexcept {
+[[maybe_unused]] static void* platform_load(const char* name) noexcept {
 #ifdef WREN_PLATFORM_WINDOWS
     return static_cast<void*>(LoadLibraryA(name));
 #else
@@ -35,7 +37,7 @@ static void platform_unload(void* handle) noexcept {
 #endif
 }
 
-static void* platform_symbol(void* handle, const char* name) noexcept {
+[[maybe_unused]] static void* platform_symbol(void* handle, const char* name) noexcept {
 #ifdef WREN_PLATFORM_WINDOWS
     return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(handle), name));
 #else
@@ -43,7 +45,7 @@ static void* platform_symbol(void* handle, const char* name) noexcept {
 #endif
 }
 
-static std::string platform_last_error() {
+[[maybe_unused]] static std::string platform_last_error() {
 #ifdef WREN_PLATFORM_WINDOWS
     DWORD code = GetLastError();
     char buf[256]{};
@@ -87,11 +89,116 @@ static std::string dll_name(Backend b) {
 #endif
 }
 
+// -------------------------------------------------------------------------------------------------
+// Vtable validation
+// -------------------------------------------------------------------------------------------------
+
+/// Why @p backend (from '@p name') cannot be used, or an empty string when it can.
+static std::string validate_backend(BackendVTable const* backend, std::string const& name) {
+    if (backend->abi_version != wren::rhi::k_backend_abi_version) {
+        return "ABI version mismatch for '" + name + "': "
+               "expected " + std::to_string(wren::rhi::k_backend_abi_version) +
+               ", got "    + std::to_string(backend->abi_version);
+    }
+
+    if (!backend->backend_id) {
+        return "Backend '" + name + "' has null backend_id function pointer";
+    }
+
+    if (!backend->create_instance || !backend->destroy_instance || !backend->enumerate_adapters) {
+        return "Backend '" + name + "' has null instance function pointer(s)";
+    }
+
+    if (!backend->create_device || !backend->destroy_device || !backend->get_capabilities) {
+        return "Backend '" + name + "' has null device function pointer(s)";
+    }
+
+    if (!backend->create_buffers  || !backend->destroy_buffers  ||
+        !backend->create_textures || !backend->destroy_textures || !backend->map_buffer ||
+        !backend->buffer_device_address ||
+        !backend->query_bindless_heap || !backend->buffer_bindless_index ||
+        !backend->texture_bindless_index || !backend->find_samplers ||
+        !backend->query_memory_budget || !backend->defragment_memory ||
+        !backend->texture_memory_requirements || !backend->create_memory_heaps ||
+        !backend->destroy_memory_heaps || !backend->sparse_texture_info ||
+        !backend->acceleration_structure_sizes || !backend->create_acceleration_structures ||
+        !backend->destroy_acceleration_structures || !backend->acceleration_structure_reference ||
+        !backend->build_acceleration_structures_on_host ||
+        !backend->create_shader_modules || !backend->destroy_shader_modules ||
+        !backend->shader_module_reflection ||
+        !backend->query_pipeline_cache || !backend->save_pipeline_cache ||
+        !backend->create_graphics_pipelines || !backend->create_compute_pipelines ||
+        !backend->destroy_pipelines || !backend->pipeline_status ||
+        !backend->prioritize_pipelines || !backend->wait_pipelines) {
+        return "Backend '" + name + "' has null resource function pointer(s)";
+    }
+
+    if (!backend->begin_frame || !backend->end_frame || !backend->read_profile_frame ||
+        !backend->begin_command_list ||
+        !backend->end_command_list || !backend->submit_command_lists || !backend->bind_sparse ||
+        !backend->wait_sync_points || !backend->completed_value) {
+        return "Backend '" + name + "' has null command list function pointer(s)";
+    }
+
+    if (!backend->create_swapchain || !backend->destroy_swapchain || !backend->resize_swapchain ||
+        !backend->acquire_swapchain_image || !backend->present_swapchain ||
+        !backend->wait_for_present || !backend->query_swapchain) {
+        return "Backend '" + name + "' has null presentation function pointer(s)";
+    }
+
+    if (!backend->cmd_barriers || !backend->cmd_copy_buffer || !backend->cmd_copy_buffer_to_texture ||
+        !backend->cmd_copy_texture_to_buffer ||
+        !backend->cmd_begin_rendering || !backend->cmd_end_rendering ||
+        !backend->cmd_set_viewport || !backend->cmd_set_scissor || !backend->cmd_bind_pipeline ||
+        !backend->cmd_push_constants ||
+        !backend->cmd_bind_vertex_buffers || !backend->cmd_bind_index_buffer ||
+        !backend->cmd_draw || !backend->cmd_draw_indexed || !backend->cmd_dispatch ||
+        !backend->cmd_draw_indirect || !backend->cmd_draw_indexed_indirect ||
+        !backend->cmd_dispatch_indirect ||
+        !backend->cmd_build_acceleration_structures || !backend->cmd_write_compacted_sizes ||
+        !backend->cmd_copy_acceleration_structure ||
+        !backend->cmd_record_packets || !backend->cmd_execute_command_lists ||
+        !backend->cmd_begin_profile_region || !backend->cmd_end_profile_region) {
+        return "Backend '" + name + "' has null recording function pointer(s)";
+    }
+
+    return {};
+}
+
 // -------------------------------------------------------------------------------------------------
 // BackendLibrary — static members
 // -------------------------------------------------------------------------------------------------
 
+#if WREN_RHI_STATIC_BACKEND
+
+// Defined by the backend linked in (see wren/rhi/static_backend.hpp).
+extern "C" BackendVTable* wren_rhi_create();
+
+auto BackendLibrary::load(Backend which) -> std::expected<BackendLibrary, std::string> {
+    WREN_PROFILE_ZONE("rhi::load_backend");
+    if (which == Backend::None) {
+        return std::unexpected{"Backend::None cannot be loaded"};
+    }
+    const auto name = dll_name(which);
+    if (which != Backend::WREN_RHI_STATIC_BACKEND_ID) {
+        return std::unexpected{"'" + name + "' is not available: this build links the " +
+                               dll_name(Backend::WREN_RHI_STATIC_BACKEND_ID) + " backend statically"};
+    }
+
+    BackendVTable* backend = wren_rhi_create();
+    if (!backend) {
+        return std::unexpected{"wren_rhi_create() returned null for '" + name + "'"};
+    }
+    if (auto error = validate_backend(backend, name); !error.empty()) {
+        return std::unexpected{std::move(error)};
+    }
+    return BackendLibrary{backend, nullptr};
+}
+
+#else
+
 auto BackendLibrary::load(Backend which) -> std::expected<BackendLibrary, std::string> {
+    WREN_PROFILE_ZONE("rhi::load_backend");
     const auto name = dll_name(which);
     if (name.empty()) {
         return std::unexpected{"Backend::None cannot be loaded"};
@@ -114,28 +221,16 @@ auto BackendLibrary::load(Backend which) -> std::expected<BackendLibrary, std::s
         return std::unexpected{"wren_rhi_create() returned null for '" + name + "'"};
     }
 
-    if (backend->abi_version != wren::rhi::k_backend_abi_version) {
-        platform_unload(handle);
-        return std::unexpected{
-            "ABI version mismatch for '" + name + "': "
-            "expected " + std::to_string(wren::rhi::k_backend_abi_version) +
-            ", got "    + std::to_string(backend->abi_version)
-        };
-    }
-
-    if (!backend->backend_id) {
-        platform_unload(handle);
-        return std::unexpected{"Backend '" + name + "' has null backend_id function pointer"};
-    }
-
-    if (!backend->create_device || !backend->destroy_device || !backend->get_capabilities) {
+    if (auto error = validate_backend(backend, name); !error.empty()) {
         platform_unload(handle);
-        return std::unexpected{"Backend '" + name + "' has null device function pointer(s)"};
+        return std::unexpected{std::move(error)};
     }
 
     return BackendLibrary{backend, handle};
 }
 
+#endif
+
 // -------------------------------------------------------------------------------------------------
 // BackendLibrary — special members
 // -------------------------------------------------------------------------------------------------
@@ -165,15 +260,84 @@ BackendLibrary::~BackendLibrary() {
 }
 
 // -------------------------------------------------------------------------------------------------
-// BackendLibrary — device creation
+// BackendLibrary — instance and device creation
 // -------------------------------------------------------------------------------------------------
 
+auto BackendLibrary::create_instance(InstanceDesc const& desc)
+    -> std::expected<BackendInstance, std::string>
+{
+    WREN_PROFILE_ZONE("rhi::create_instance");
+    char err_buf[512]{};
+    InstanceHandle handle =
+        backend_->create_instance(&desc, err_buf, sizeof(err_buf));
+
+    if (!handle) {
+        return std::unexpected{
+            err_buf[0] != '\0' ? std::string{err_buf} : std::string{"create_instance returned null"}
+        };
+    }
+    return BackendInstance{backend_, handle};
+}
+
 auto BackendLibrary::create_device(DeviceDesc const& desc)
     -> std::expected<BackendDevice, std::string>
 {
+    return BackendDevice::create(backend_, nullptr, desc);
+}
+
+// -------------------------------------------------------------------------------------------------
+// BackendInstance
+// -------------------------------------------------------------------------------------------------
+
+BackendInstance::BackendInstance(BackendInstance&& other) noexcept
+    : backend_(other.backend_), handle_(other.handle_) {
+    other.backend_ = nullptr;
+    other.handle_  = nullptr;
+}
+
+BackendInstance& BackendInstance::operator=(BackendInstance&& other) noexcept {
+    if (this != &other) {
+        this->~BackendInstance();
+        backend_       = other.backend_;
+        handle_        = other.handle_;
+        other.backend_ = nullptr;
+        other.handle_  = nullptr;
+    }
+    return *this;
+}
+
+BackendInstance::~BackendInstance() {
+    if (!handle_) return;
+    backend_->destroy_instance(handle_);
+    handle_  = nullptr;
+    backend_ = nullptr;
+}
+
+std::vector<AdapterDesc> BackendInstance::adapters() const {
+    WREN_PROFILE_ZONE("rhi::enumerate_adapters");
+    std::vector<AdapterDesc> out(backend_->enumerate_adapters(handle_, nullptr, 0));
+    uint32_t const count = backend_->enumerate_adapters(handle_, out.data(), static_cast<uint32_t>(out.size()));
+    out.resize(std::min<std::size_t>(count, out.size()));  // an adapter may vanish in between
+    return out;
+}
+
+auto BackendInstance::create_device(DeviceDesc const& desc)
+    -> std::expected<BackendDevice, std::string>
+{
+    return BackendDevice::create(backend_, handle_, desc);
+}
+
+// -------------------------------------------------------------------------------------------------
+// BackendDevice — creation
+// -------------------------------------------------------------------------------------------------
+
+auto BackendDevice::create(BackendVTable* backend, InstanceHandle instance, DeviceDesc const& desc)
+    -> std::expected<BackendDevice, std::string>
+{
+    WREN_PROFILE_ZONE("rhi::create_device");
     char err_buf[512]{};
     DeviceHandle handle =
-        backend_->create_device(&desc, err_buf, sizeof(err_buf));
+        backend->create_device(instance, &desc, err_buf, sizeof(err_buf));
 
     if (!handle) {
         return std::unexpected{
@@ -182,8 +346,8 @@ auto BackendLibrary::create_device(DeviceDesc const& desc)
     }
 
     Capabilities caps{};
-    backend_->get_capabilities(handle, &caps);
-    return BackendDevice{backend_, handle, caps};
+    backend->get_capabilities(handle, &caps);
+    return BackendDevice{backend, handle, caps};
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -213,9 +377,398 @@ BackendDevice& BackendDevice::operator=(BackendDevice&& other) noexcept {
 
 BackendDevice::~BackendDevice() {
     if (!handle_) return;
+    WREN_PROFILE_ZONE("rhi::destroy_device");
     backend_->destroy_device(handle_);
     handle_  = nullptr;
     backend_ = nullptr;
 }
 
+// -------------------------------------------------------------------------------------------------
+// BackendDevice — resources
+// -------------------------------------------------------------------------------------------------
+
+Status BackendDevice::create_buffers(std::span<BufferDesc const> descs,
+                                     std::span<BufferHandle> out) noexcept
+{
+    if (out.size() < descs.size()) {
+        return Status::InvalidArgument;
+    }
+    return backend_->create_buffers(handle_, descs.data(),
+                                    static_cast<uint32_t>(descs.size()), out.data());
+}
+
+auto BackendDevice::create_buffer(BufferDesc const& desc) noexcept
+    -> std::expected<BufferHandle, Status>
+{
+    BufferHandle out{};
+    if (Status s = backend_->create_buffers(handle_, &desc, 1, &out); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return out;
+}
+
+void BackendDevice::destroy_buffers(std::span<BufferHandle const> handles) noexcept {
+    backend_->destroy_buffers(handle_, handles.data(), static_cast<uint32_t>(handles.size()));
+}
+
+Status BackendDevice::create_textures(std::span<TextureDesc const> descs,
+                                      std::span<TextureHandle> out) noexcept
+{
+    if (out.size() < descs.size()) {
+        return Status::InvalidArgument;
+    }
+    return backend_->create_textures(handle_, descs.data(),
+                                     static_cast<uint32_t>(descs.size()), out.data());
+}
+
+auto BackendDevice::create_texture(TextureDesc const& desc) noexcept
+    -> std::expected<TextureHandle, Status>
+{
+    TextureHandle out{};
+    if (Status s = backend_->create_textures(handle_, &desc, 1, &out); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return out;
+}
+
+void BackendDevice::destroy_textures(std::span<TextureHandle const> handles) noexcept {
+    backend_->destroy_textures(handle_, handles.data(), static_cast<uint32_t>(handles.size()));
+}
+
+void* BackendDevice::map_buffer(BufferHandle buffer) const noexcept {
+    return backend_->map_buffer(handle_, buffer);
+}
+
+BindlessHeapInfo BackendDevice::bindless_heap() const noexcept {
+    BindlessHeapInfo out{};
+    backend_->query_bindless_heap(handle_, &out);
+    return out;
+}
+
+Status BackendDevice::find_samplers(std::span<SamplerDesc const> descs, std::span<uint32_t> out) const noexcept {
+    if (out.size() < descs.size()) {
+        return Status::InvalidArgument;
+    }
+    return backend_->find_samplers(handle_, descs.data(), static_cast<uint32_t>(descs.size()), out.data());
+}
+
+auto BackendDevice::find_sampler(SamplerDesc const& desc) const noexcept -> std::expected<uint32_t, Status> {
+    uint32_t out = k_invalid_bindless_index;
+    if (Status s = backend_->find_samplers(handle_, &desc, 1, &out); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return out;
+}
+
+MemoryBudget BackendDevice::memory_budget() const noexcept {
+    MemoryBudget out{};
+    backend_->query_memory_budget(handle_, &out);
+    return out;
+}
+
+auto BackendDevice::defragment(DefragmentDesc const& desc) noexcept
+    -> std::expected<DefragmentStats, Status>
+{
+    WREN_PROFILE_ZONE("rhi::defragment");
+    DefragmentStats stats{};
+    if (Status s = backend_->defragment_memory(handle_, &desc, &stats); s != Status::Ok)
+        return std::unexpected{s};
+    return stats;
+}
+
+Status BackendDevice::texture_memory_requirements(std::span<TextureDesc const> descs,
+                                                  std::span<MemoryRequirements> out) const noexcept
+{
+    if (out.size() < descs.size()) {
+        return Status::InvalidArgument;
+    }
+    return backend_->texture_memory_requirements(handle_, descs.data(),
+                                                 static_cast<uint32_t>(descs.size()), out.data());
+}
+
+auto BackendDevice::create_memory_heap(MemoryHeapDesc const& desc) noexcept
+    -> std::expected<HeapHandle, Status>
+{
+    HeapHandle out{};
+    if (Status s = backend_->create_memory_heaps(handle_, &desc, 1, &out); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return out;
+}
+
+auto BackendDevice::sparse_texture_info(TextureHandle texture) const noexcept
+    -> std::expected<SparseTextureInfo, Status>
+{
+    SparseTextureInfo out{};
+    if (Status s = backend_->sparse_texture_info(handle_, texture, &out); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return out;
+}
+
+auto BackendDevice::bind_sparse(std::span<SparsePageBind const> binds,
+                                std::span<SyncPoint const>      waits) noexcept
+    -> std::expected<SyncPoint, Status>
+{
+    WREN_PROFILE_ZONE("rhi::bind_sparse");
+    SparseBindDesc const desc{
+        .binds     = binds.data(),
+        .bindCount = static_cast<uint32_t>(binds.size()),
+        .waits     = waits.data(),
+        .waitCount = static_cast<uint32_t>(waits.size()),
+    };
+    SyncPoint point{};
+    if (Status s = backend_->bind_sparse(handle_, &desc, &point); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return point;
+}
+
+// -------------------------------------------------------------------------------------------------
+// BackendDevice — acceleration structures
+// -------------------------------------------------------------------------------------------------
+
+auto BackendDevice::acceleration_structure_sizes(AccelerationStructureInputs const& inputs) const noexcept
+    -> std::expected<AccelerationStructureSizes, Status>
+{
+    AccelerationStructureSizes out{};
+    if (Status s = backend_->acceleration_structure_sizes(handle_, &inputs, &out); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return out;
+}
+
+Status BackendDevice::create_acceleration_structures(std::span<AccelerationStructureDesc const> descs,
+                                                     std::span<AccelerationStructureHandle> out) noexcept
+{
+    if (out.size() < descs.size()) {
+        return Status::InvalidArgument;
+    }
+    WREN_PROFILE_ZONE("rhi::create_acceleration_structures");
+    return backend_->create_acceleration_structures(handle_, descs.data(),
+                                                    static_cast<uint32_t>(descs.size()), out.data());
+}
+
+auto BackendDevice::create_acceleration_structure(AccelerationStructureDesc const& desc) noexcept
+    -> std::expected<AccelerationStructureHandle, Status>
+{
+    AccelerationStructureHandle out{};
+    if (Status s = backend_->create_acceleration_structures(handle_, &desc, 1, &out); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return out;
+}
+
+Status BackendDevice::build_acceleration_structures_on_host(
+    std::span<AccelerationStructureBuild const> builds) noexcept
+{
+    WREN_PROFILE_ZONE("rhi::build_acceleration_structures_on_host");
+    return backend_->build_acceleration_structures_on_host(handle_, builds.data(),
+                                                           static_cast<uint32_t>(builds.size()));
+}
+
+// -------------------------------------------------------------------------------------------------
+// BackendDevice — shader modules
+// -------------------------------------------------------------------------------------------------
+
+Status BackendDevice::create_shader_modules(std::span<ShaderModuleDesc const> descs,
+                                            std::span<ShaderModuleHandle> out) noexcept
+{
+    if (out.size() < descs.size()) {
+        return Status::InvalidArgument;
+    }
+    WREN_PROFILE_ZONE("rhi::create_shader_modules");
+    return backend_->create_shader_modules(handle_, descs.data(),
+                                           static_cast<uint32_t>(descs.size()), out.data());
+}
+
+auto BackendDevice::create_shader_module(ShaderModuleDesc const& desc) noexcept
+    -> std::expected<ShaderModuleHandle, Status>
+{
+    ShaderModuleHandle out{};
+    if (Status s = backend_->create_shader_modules(handle_, &desc, 1, &out); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return out;
+}
+
+auto BackendDevice::shader_reflection(ShaderModuleHandle module) const noexcept
+    -> std::expected<ShaderReflection, Status>
+{
+    ShaderReflection out{};
+    if (Status s = backend_->shader_module_reflection(handle_, module, &out); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return out;
+}
+
+PipelineCacheStats BackendDevice::pipeline_cache_stats() const noexcept {
+    PipelineCacheStats out{};
+    backend_->query_pipeline_cache(handle_, &out);
+    return out;
+}
+
+Status BackendDevice::save_pipeline_cache() noexcept {
+    WREN_PROFILE_ZONE("rhi::save_pipeline_cache");
+    return backend_->save_pipeline_cache(handle_);
+}
+
+// -------------------------------------------------------------------------------------------------
+// BackendDevice — pipelines
+// -------------------------------------------------------------------------------------------------
+
+Status BackendDevice::create_graphics_pipelines(std::span<GraphicsPipelineDesc const> descs,
+                                                std::span<PipelineHandle> out) noexcept
+{
+    if (out.size() < descs.size()) {
+        return Status::InvalidArgument;
+    }
+    return backend_->create_graphics_pipelines(handle_, descs.data(),
+                                               static_cast<uint32_t>(descs.size()), out.data());
+}
+
+auto BackendDevice::create_graphics_pipeline(GraphicsPipelineDesc const& desc) noexcept
+    -> std::expected<PipelineHandle, Status>
+{
+    PipelineHandle out{};
+    if (Status s = backend_->create_graphics_pipelines(handle_, &desc, 1, &out); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return out;
+}
+
+Status BackendDevice::create_compute_pipelines(std::span<ComputePipelineDesc const> descs,
+                                               std::span<PipelineHandle> out) noexcept
+{
+    if (out.size() < descs.size()) {
+        return Status::InvalidArgument;
+    }
+    return backend_->create_compute_pipelines(handle_, descs.data(),
+                                              static_cast<uint32_t>(descs.size()), out.data());
+}
+
+auto BackendDevice::create_compute_pipeline(ComputePipelineDesc const& desc) noexcept
+    -> std::expected<PipelineHandle, Status>
+{
+    PipelineHandle out{};
+    if (Status s = backend_->create_compute_pipelines(handle_, &desc, 1, &out); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return out;
+}
+
+void BackendDevice::destroy_pipelines(std::span<PipelineHandle const> handles) noexcept {
+    backend_->destroy_pipelines(handle_, handles.data(), static_cast<uint32_t>(handles.size()));
+}
+
+void BackendDevice::prioritize_pipelines(std::span<PipelineHandle const> handles) noexcept {
+    backend_->prioritize_pipelines(handle_, handles.data(), static_cast<uint32_t>(handles.size()));
+}
+
+Status BackendDevice::wait_pipelines(std::span<PipelineHandle const> handles) noexcept {
+    WREN_PROFILE_ZONE("rhi::wait_pipelines");
+    return backend_->wait_pipelines(handle_, handles.data(), static_cast<uint32_t>(handles.size()));
+}
+
+// -------------------------------------------------------------------------------------------------
+// BackendDevice — command lists
+// -------------------------------------------------------------------------------------------------
+
+ProfileFrame BackendDevice::profile_frame() const noexcept {
+    ProfileFrame out{};
+    backend_->read_profile_frame(handle_, &out);
+    return out;
+}
+
+void trace_profile_frame(ProfileFrame const& frame) noexcept {
+    namespace diag = foundation::diag;
+
+    // Indexed by QueueType.
+    static std::uint32_t const tracks[] = {
+        diag::add_track("GPU Graphics"),
+        diag::add_track("GPU Compute"),
+        diag::add_track("GPU Transfer"),
+        diag::add_track("GPU Present"),
+    };
+
+    for (uint32_t i = 0; i < frame.regionCount; ++i) {
+        ProfileRegion const& region = frame.regions[i];
+        auto const queue = static_cast<std::size_t>(region.queue);
+        if (region.cpuBeginNs == 0 || queue >= std::size(tracks)) {
+            continue;
+        }
+        diag::add_track_span(tracks[queue], region.name ? region.name : "",
+                             region.cpuBeginNs, region.cpuEndNs);
+    }
+}
+
+auto BackendDevice::begin_command_list(CommandListDesc const& desc) noexcept
+    -> std::expected<CommandList, Status>
+{
+    CommandListHandle list = nullptr;
+    if (Status s = backend_->begin_command_list(handle_, &desc, &list); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return CommandList{backend_, list};
+}
+
+// -------------------------------------------------------------------------------------------------
+// BackendDevice — presentation
+// -------------------------------------------------------------------------------------------------
+
+auto BackendDevice::create_swapchain(SwapchainDesc const& desc)
+    -> std::expected<Swapchain, std::string>
+{
+    WREN_PROFILE_ZONE("rhi::create_swapchain");
+    char err_buf[512]{};
+    SwapchainHandle swapchain = backend_->create_swapchain(handle_, &desc, err_buf, sizeof(err_buf));
+    if (!swapchain) {
+        return std::unexpected{
+            err_buf[0] != '\0' ? std::string{err_buf} : std::string{"create_swapchain returned null"}
+        };
+    }
+    return Swapchain{backend_, handle_, swapchain};
+}
+
+Swapchain::Swapchain(Swapchain&& other) noexcept
+    : backend_(other.backend_)
+    , device_(other.device_)
+    , handle_(other.handle_)
+{
+    other.backend_ = nullptr;
+    other.device_  = nullptr;
+    other.handle_  = nullptr;
+}
+
+Swapchain& Swapchain::operator=(Swapchain&& other) noexcept {
+    if (this != &other) {
+        this->~Swapchain();
+        backend_ = other.backend_;
+        device_  = other.device_;
+        handle_  = other.handle_;
+        other.backend_ = nullptr;
+        other.device_  = nullptr;
+        other.handle_  = nullptr;
+    }
+    return *this;
+}
+
+Swapchain::~Swapchain() {
+    if (!handle_) return;
+    WREN_PROFILE_ZONE("rhi::destroy_swapchain");
+    backend_->destroy_swapchain(device_, handle_);
+    handle_  = nullptr;
+    device_  = nullptr;
+    backend_ = nullptr;
+}
+
+auto Swapchain::acquire(uint64_t timeout_ns) noexcept -> std::expected<SwapchainImage, Status> {
+    WREN_PROFILE_ZONE("rhi::acquire");
+    SwapchainImage image{};
+    if (Status s = backend_->acquire_swapchain_image(device_, handle_, timeout_ns, &image); s != Status::Ok) {
+        return std::unexpected{s};
+    }
+    return image;
+}
+
 } // namespace wren::rhi
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <span>
+
+#include <wren/foundation/containers/handle.hpp>
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/resources.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/loader.hpp>
+
+namespace wren::rhi {
+
+// -------------------------------------------------------------------------------------------------
+// AccelerationStructureManager — owns the BLASes and TLASes of a scene and
+// builds them in batches (ARCHITECTURE.md §4.15).
+//
+// Geometry is added, moved and removed at any point of the frame; nothing
+// reaches the GPU until flush() records every outstanding build into one
+// list. Builds share one scratch buffer: each takes an aligned range of it
+// and, once the next would not fit, the batch so far is issued and the
+// ranges start over behind its barrier. Bottom-level builds all precede
+// the top-level ones, so a TLAS always sees this flush's BLASes:
+//
+//     auto rock = accels.add_blas({.geometry = {&rock_triangles, 1}});
+//     auto scene = accels.add_tlas({.maxInstances = 4096});
+//     accels.update_tlas(*scene, instances);
+//     auto built = accels.flush();
+//     device.submit({&gfx_handle, 1}, {&*built, 1});  // ray queries read accels.structure(*scene)
+//
+// Per-BLAS policies:
+//   - Static: built once with AllowCompaction. Its compacted size is written
+//     back in the build's list; a later flush that finds the list complete
+//     copies the structure into one of exactly that size and frees the
+//     original, typically halving its memory.
+//   - Refit: built with AllowUpdate; update_blas() refits it in place after
+//     its vertices move, which is several times cheaper than a build. As
+//     refits degrade trace quality, every refitsPerRebuild-th update is a
+//     full rebuild.
+//   - Rebuild: built for build speed; every update_blas() builds it anew.
+// TLAS policies read the same, without compaction: a Refit TLAS refits
+// while its instance count stays the same.
+//
+// A compacted BLAS moves, so a flush that compacts one also rebuilds every
+// TLAS from its latest instances; removing a BLAS needs the caller to drop
+// its instances, or they build as inactive. Input buffers (vertices,
+// indices, transforms) must be in the AccelerationStructureInput state on
+// the manager's queue whenever a flush builds from them.
+//
+// Thread-safety: none. Every call belongs to the frame thread, flush()
+// between begin_frame() and end_frame(). The device must outlive the
+// manager and must not be moved while it exists.
+// -------------------------------------------------------------------------------------------------
+
+struct BlasTag;
+struct TlasTag;
+
+using BlasHandle = wren::foundation::containers::Handle<BlasTag>;
+using TlasHandle = wren::foundation::containers::Handle<TlasTag>;
+
+enum class BuildPolicy : std::uint8_t {
+    Static,   ///< Built once, then compacted.
+    Refit,    ///< Updated in place, rebuilt every refitsPerRebuild updates.
+    Rebuild   ///< Built anew on every update, for build speed.
+};
+
+struct AccelerationStructureManagerDesc {
+    uint64_t  scratchBytes     = 32ull << 20;          ///< Shared build scratch; grows for a build that needs more.
+    QueueType queue            = QueueType::Graphics;  ///< Queue the builds and compaction copies run on.
+    uint32_t  refitsPerRebuild = 16;                   ///< Refit policy: updates between full rebuilds.
+};
+
+struct BlasDesc {
+    std::span<AccelerationStructureTriangles const> geometry;  ///< Copied; the buffers are read at each build.
+    BuildPolicy                                     policy    = BuildPolicy::Static;
+    const char*                                     debugName = nullptr;
+};
+
+struct TlasDesc {
+    uint32_t    maxInstances = 0;  ///< Capacity; the structure and instance buffer are sized for it.
+    BuildPolicy policy       = BuildPolicy::Rebuild;
+    const char* debugName    = nullptr;
+};
+
+/// One instance of update_tlas(). The BLAS is resolved at flush(), so the
+/// instance follows it through compaction.
+struct TlasInstance {
+    BlasHandle                         blas;
+    float                              transform[3][4] = {{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}};  ///< Row-major object-to-world.
+    uint32_t                           customIndex              = 0;     ///< 24 bits; InstanceCustomIndex in shaders.
+    uint8_t                            mask                     = 0xFF;
+    uint32_t                           shaderBindingTableOffset = 0;     ///< 24 bits.
+    AccelerationStructureInstanceFlags flags                    = AccelerationStructureInstanceFlags::None;
+};
+
+struct AccelerationStructureManagerStats {
+    uint32_t blasCount          = 0;
+    uint32_t tlasCount          = 0;
+    uint32_t pendingCompactions = 0;  ///< Static BLASes whose compacted size is still on the GPU.
+    uint64_t structureBytes     = 0;  ///< Live structures, at their compacted sizes where compacted.
+    uint64_t compactedBytes     = 0;  ///< Memory given back by compaction so far.
+    uint64_t scratchBytes       = 0;  ///< Current size of the shared scratch buffer.
+    uint64_t builds             = 0;  ///< Full builds recorded so far, BLAS and TLAS.
+    uint64_t refits             = 0;  ///< Updates recorded so far.
+    uint64_t compactions        = 0;  ///< Compaction copies recorded so far.
+};
+
+class AccelerationStructureManager {
+public:
+    /// Creates the scratch buffer and the compacted-size readback ring.
+    /// Status::MissingRequiredFeature without Feature::RayTracing.
+    [[nodiscard]] static auto create(BackendDevice& device, AccelerationStructureManagerDesc const& desc = {}) noexcept
+        -> std::expected<AccelerationStructureManager, Status>;
+
+    /// Waits for every flush, then destroys every structure and buffer.
+    ~AccelerationStructureManager();
+
+    AccelerationStructureManager(AccelerationStructureManager&&) noexcept;
+    AccelerationStructureManager& operator=(AccelerationStructureManager&&) noexcept;
+
+    AccelerationStructureManager(AccelerationStructureManager const&)            = delete;
+    AccelerationStructureManager& operator=(AccelerationStructureManager const&) = delete;
+
+    /// Creates a BLAS over @p desc.geometry and queues its build.
+    [[nodiscard]] auto add_blas(BlasDesc const& desc) noexcept -> std::expected<BlasHandle, Status>;
+
+    /// Queues a refit or rebuild after the geometry's vertices moved in
+    /// place; counts and buffers stay those of add_blas(). InvalidArgument
+    /// for Static BLASes and stale handles.
+    [[nodiscard]] Status update_blas(BlasHandle blas) noexcept;
+
+    /// Destroys the BLAS once the GPU is done with it; stale handles are ignored.
+    void remove_blas(BlasHandle blas) noexcept;
+
+    /// Creates an empty TLAS with an instance buffer for desc.maxInstances.
+    [[nodiscard]] auto add_tlas(TlasDesc const& desc) noexcept -> std::expected<TlasHandle, Status>;
+
+    /// Replaces the instances of @p tlas and queues its build. InvalidArgument
+    /// for stale handles or more than maxInstances instances.
+    [[nodiscard]] Status update_tlas(TlasHandle tlas, std::span<TlasInstance const> instances) noexcept;
+
+    /// Destroys the TLAS once the GPU is done with it; stale handles are ignored.
+    void remove_tlas(TlasHandle tlas) noexcept;
+
+    /// The structure to bind or reference; it changes when a BLAS is
+    /// compacted. Null for stale handles.
+    [[nodiscard]] AccelerationStructureHandle structure(BlasHandle blas) const noexcept;
+    [[nodiscard]] AccelerationStructureHandle structure(TlasHandle tlas) const noexcept;
+
+    /// Compacts the BLASes whose sizes have come back, records every queued
+    /// build and submits them after @p waits. Blocks only when the GPU is
+    /// k_ring_depth flushes behind. A null SyncPoint when there was nothing
+    /// to do.
+    [[nodiscard]] auto flush(std::span<SyncPoint const> waits = {}) noexcept -> std::expected<SyncPoint, Status>;
+
+    /// Blocks until every flush has completed.
+    [[nodiscard]] Status wait_idle() noexcept;
+
+    [[nodiscard]] AccelerationStructureManagerStats stats() const noexcept;
+
+    /// Flushes in flight that instance and compacted-size memory is kept for.
+    static constexpr uint32_t k_ring_depth = 3;
+
+private:
+    struct Impl;
+    explicit AccelerationStructureManager(std::unique_ptr<Impl> impl) noexcept;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace wren::rhi
@@ -0,0 +1,709 @@
+#include <wren/rhi/raytracing/acceleration_structure_manager.hpp>
+
+#include <wren/foundation/containers/slot_map.hpp>
+#include <wren/foundation/memory/align.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <deque>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace wren::rhi {
+
+namespace {
+
+/// Compacted sizes read back per flush; further Static BLASes wait for the next one.
+constexpr uint32_t k_max_compactions_per_flush = 1024;
+
+/// Scratch grows in steps of this, so a slowly growing scene reallocates rarely.
+constexpr uint64_t k_scratch_granularity = 1ull << 20;
+
+struct Blas {
+    AccelerationStructureHandle                 structure;
+    std::vector<AccelerationStructureTriangles> geometry;
+    AccelerationStructureSizes                  sizes;
+    uint64_t                                    bytes  = 0;  // sizes.size, or the compacted size
+    BuildPolicy                                 policy = BuildPolicy::Static;
+    uint32_t                                    refits = 0;  // since the last full build
+    bool                                        dirty  = true;
+    bool                                        built  = false;
+    std::string                                 name;
+};
+
+struct Tlas {
+    AccelerationStructureHandle    structure;
+    BufferHandle                   instances;  // k_ring_depth ranges of max_instances records
+    AccelerationStructureInstance* mapped        = nullptr;
+    uint32_t                       max_instances = 0;
+    AccelerationStructureSizes     sizes;
+    BuildPolicy                    policy      = BuildPolicy::Rebuild;
+    std::vector<TlasInstance>      latest;
+    uint32_t                       built_count = 0;  // instances of the last build
+    uint32_t                       refits      = 0;
+    bool                           dirty       = false;
+    bool                           built       = false;
+};
+
+/// A compacted size on its way back: `slot` indexes the readback ring.
+struct PendingCompaction {
+    BlasHandle                  blas;
+    AccelerationStructureHandle structure;  // the structure measured
+    uint64_t                    value = 0;  // flush that measured it
+    uint32_t                    slot  = 0;
+};
+
+/// A compaction recorded this flush.
+struct CompactionCopy {
+    BlasHandle                  blas;
+    AccelerationStructureHandle source;
+    AccelerationStructureHandle destination;
+    uint64_t                    size = 0;
+};
+
+[[nodiscard]] constexpr AccelerationStructureFlags build_flags(BuildPolicy policy, bool bottom) noexcept {
+    switch (policy) {
+        case BuildPolicy::Static:
+            return bottom ? AccelerationStructureFlags::PreferFastTrace | AccelerationStructureFlags::AllowCompaction
+                          : AccelerationStructureFlags::PreferFastTrace;
+        case BuildPolicy::Refit:
+            return AccelerationStructureFlags::PreferFastTrace | AccelerationStructureFlags::AllowUpdate;
+        case BuildPolicy::Rebuild:
+            return AccelerationStructureFlags::PreferFastBuild;
+    }
+    return AccelerationStructureFlags::None;
+}
+
+[[nodiscard]] AccelerationStructureInputs blas_inputs(Blas const& b) noexcept {
+    return AccelerationStructureInputs{
+        .type          = AccelerationStructureType::BottomLevel,
+        .flags         = build_flags(b.policy, true),
+        .triangles     = b.geometry.data(),
+        .triangleCount = static_cast<uint32_t>(b.geometry.size()),
+    };
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Impl
+// -------------------------------------------------------------------------------------------------
+struct AccelerationStructureManager::Impl {
+    BackendDevice*                   device;
+    AccelerationStructureManagerDesc desc;
+    uint64_t                         alignment;
+    BufferHandle                     scratch;
+    uint64_t                         scratch_bytes;
+    BufferHandle                     sizes;  // k_ring_depth ranges of k_max_compactions_per_flush uint64s
+    uint64_t const*                  sizes_mapped;
+
+    foundation::containers::SlotMap<BlasHandle, Blas> blases;
+    foundation::containers::SlotMap<TlasHandle, Tlas> tlases;
+
+    std::deque<BlasHandle>        unmeasured;   // Static BLASes built but not yet measured
+    std::deque<PendingCompaction> compactions;  // in flush order
+    std::array<uint64_t, k_ring_depth> ring_values{};  // last flush that used each ring range
+    uint32_t ring       = 0;
+    uint64_t last_value = 0;
+
+    uint64_t structure_bytes = 0;
+    uint64_t compacted_bytes = 0;
+    uint64_t build_count     = 0;
+    uint64_t refit_count     = 0;
+    uint64_t copy_count      = 0;
+
+    // Flush scratch, reused.
+    std::vector<AccelerationStructureBuild>  blas_builds;
+    std::vector<AccelerationStructureBuild>  tlas_builds;
+    std::vector<BlasHandle>                  built_blases;
+    std::vector<TlasHandle>                  built_tlases;
+    std::vector<CompactionCopy>              copies;
+    std::vector<AccelerationStructureHandle> measured;
+    std::vector<BlasHandle>                  measured_blases;  // parallels `measured`
+    std::vector<BlasHandle>                  overflow;         // built now, measured by a later flush
+    std::size_t                              examined = 0;     // front of `unmeasured` this flush went through
+
+    Impl(BackendDevice& dev, AccelerationStructureManagerDesc const& d, BufferHandle scratch_buffer,
+         BufferHandle sizes_buffer, void const* sizes_ptr) noexcept
+        : device{&dev}
+        , desc{d}
+        , alignment{std::max<uint64_t>(1, dev.capabilities().limits.accelerationStructureScratchAlignment)}
+        , scratch{scratch_buffer}
+        , scratch_bytes{d.scratchBytes}
+        , sizes{sizes_buffer}
+        , sizes_mapped{static_cast<uint64_t const*>(sizes_ptr)}
+    {}
+
+    [[nodiscard]] uint64_t scratch_need(AccelerationStructureBuild const& b, AccelerationStructureSizes const& s) const
+        noexcept
+    {
+        return b.mode == AccelerationStructureBuildMode::Update ? s.updateScratchSize : s.buildScratchSize;
+    }
+
+    /// Replaces the scratch buffer with one of at least @p need bytes. The
+    /// old one is destroyed behind the GPU work already submitted.
+    [[nodiscard]] Status grow_scratch(uint64_t need) noexcept {
+        if (need <= scratch_bytes)
+            return Status::Ok;
+        uint64_t const bytes = foundation::memory::align_up(need, k_scratch_granularity);
+        auto buffer = device->create_buffer(BufferDesc{
+            .size      = bytes,
+            .usage     = BufferUsage::Storage,
+            .memory    = MemoryUsage::GpuOnly,
+            .debugName = "wren.acceleration_structures.scratch",
+        });
+        if (!buffer)
+            return buffer.error();
+        device->destroy_buffer(scratch);
+        scratch       = *buffer;
+        scratch_bytes = bytes;
+        return Status::Ok;
+    }
+
+    /// Gives each build an aligned scratch range and records them in as few
+    /// calls as the scratch allows; each call's barrier frees the ranges for
+    /// the next. @p needs parallels @p builds.
+    void record(CommandList& list, std::span<AccelerationStructureBuild> builds,
+                std::span<uint64_t const> needs) const noexcept
+    {
+        std::size_t first  = 0;
+        uint64_t    cursor = 0;
+        for (std::size_t i = 0; i < builds.size(); ++i) {
+            uint64_t offset = foundation::memory::align_up(cursor, alignment);
+            if (offset + needs[i] > scratch_bytes) {
+                list.build_acceleration_structures(builds.subspan(first, i - first));
+                first  = i;
+                offset = 0;
+            }
+            builds[i].scratch       = scratch;
+            builds[i].scratchOffset = offset;
+            cursor                  = offset + needs[i];
+        }
+        if (first < builds.size())
+            list.build_acceleration_structures(builds.subspan(first));
+    }
+
+    /// Turns the compacted sizes that have come back into compaction copies
+    /// for this flush. A BLAS that compacts no smaller, or whose smaller
+    /// structure cannot be created, stays as it is.
+    void collect_compactions(uint64_t completed) {
+        while (!compactions.empty() && compactions.front().value <= completed) {
+            PendingCompaction const pending = compactions.front();
+            compactions.pop_front();
+
+            Blas* const b = blases.get<0>(pending.blas);
+            if (!b || b->structure != pending.structure)
+                continue;
+            uint64_t const size = sizes_mapped[pending.slot];
+            if (size == 0 || size >= b->bytes)
+                continue;
+
+            auto compact = device->create_acceleration_structure(AccelerationStructureDesc{
+                .type      = AccelerationStructureType::BottomLevel,
+                .size      = size,
+                .memory    = MemoryUsage::GpuOnly,
+                .debugName = b->name.empty() ? nullptr : b->name.c_str(),
+            });
+            if (!compact)
+                continue;
+            try {
+                copies.push_back({pending.blas, b->structure, *compact, size});
+            } catch (std::bad_alloc const&) {
+                device->destroy_acceleration_structure(*compact);
+                throw;
+            }
+            // Swapped now so this flush's instances already reference it.
+            b->structure = *compact;
+        }
+    }
+
+    /// Queues the BLAS builds of this flush; @p needs receives their scratch sizes.
+    void collect_blas_builds(std::vector<uint64_t>& needs) {
+        auto const handles = blases.handles();
+        auto const rows    = blases.column<0>();
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            Blas& b = rows[i];
+            if (!b.dirty)
+                continue;
+            bool const refit = b.policy == BuildPolicy::Refit && b.built && b.refits < desc.refitsPerRebuild;
+            AccelerationStructureBuild build{
+                .inputs      = blas_inputs(b),
+                .mode        = refit ? AccelerationStructureBuildMode::Update : AccelerationStructureBuildMode::Build,
+                .destination = b.structure,
+                .source      = refit ? b.structure : AccelerationStructureHandle{},
+            };
+            needs.push_back(scratch_need(build, b.sizes));
+            blas_builds.push_back(build);
+            built_blases.push_back(handles[i]);
+        }
+    }
+
+    /// Writes the instances of every dirty TLAS into this flush's ring range
+    /// and queues their builds.
+    void collect_tlas_builds(std::vector<uint64_t>& needs) {
+        auto const handles = tlases.handles();
+        auto const rows    = tlases.column<0>();
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            Tlas& t = rows[i];
+            if (!t.dirty)
+                continue;
+
+            auto const count  = static_cast<uint32_t>(t.latest.size());
+            uint64_t const first = uint64_t{ring} * t.max_instances;
+            for (uint32_t n = 0; n < count; ++n) {
+                TlasInstance const& in = t.latest[n];
+                Blas const* const   b  = blases.get<0>(in.blas);
+
+                AccelerationStructureInstance record{};
+                std::memcpy(record.transform, in.transform, sizeof(record.transform));
+                record.instanceCustomIndex      = in.customIndex & 0xFFFFFFu;
+                record.mask                     = in.mask;
+                record.shaderBindingTableOffset = in.shaderBindingTableOffset & 0xFFFFFFu;
+                record.flags                    = static_cast<uint32_t>(in.flags);
+                // A removed BLAS leaves an inactive instance (reference 0).
+                record.accelerationStructure = b ? device->acceleration_structure_reference(b->structure) : 0;
+                t.mapped[first + n] = record;
+            }
+
+            bool const refit = t.policy == BuildPolicy::Refit && t.built && t.built_count == count &&
+                               t.refits < desc.refitsPerRebuild;
+            AccelerationStructureBuild build{
+                .inputs      = {
+                    .type           = AccelerationStructureType::TopLevel,
+                    .flags          = build_flags(t.policy, false),
+                    .instanceBuffer = t.instances,
+                    .instanceOffset = first * sizeof(AccelerationStructureInstance),
+                    .instanceCount  = count,
+                },
+                .mode        = refit ? AccelerationStructureBuildMode::Update : AccelerationStructureBuildMode::Build,
+                .destination = t.structure,
+                .source      = refit ? t.structure : AccelerationStructureHandle{},
+            };
+            needs.push_back(scratch_need(build, t.sizes));
+            tlas_builds.push_back(build);
+            built_tlases.push_back(handles[i]);
+        }
+    }
+
+    void clear_flush() noexcept {
+        blas_builds.clear();
+        tlas_builds.clear();
+        built_blases.clear();
+        built_tlases.clear();
+        copies.clear();
+        measured.clear();
+        measured_blases.clear();
+        overflow.clear();
+        examined = 0;
+    }
+
+    /// Picks the Static BLASes this flush measures, oldest first, up to
+    /// k_max_compactions_per_flush.
+    void collect_measurements() {
+        for (BlasHandle const h : unmeasured) {
+            if (measured.size() == k_max_compactions_per_flush)
+                break;
+            ++examined;
+            if (Blas const* const b = blases.get<0>(h)) {
+                measured.push_back(b->structure);
+                measured_blases.push_back(h);
+            }
+        }
+        for (BlasHandle const h : built_blases) {
+            if (blases.get<0>(h)->policy != BuildPolicy::Static)
+                continue;
+            if (measured.size() == k_max_compactions_per_flush) {
+                overflow.push_back(h);
+                continue;
+            }
+            measured.push_back(blases.get<0>(h)->structure);
+            measured_blases.push_back(h);
+        }
+    }
+
+    /// Drops this flush's compaction copies after a failure: their smaller
+    /// structures were never written, so the originals stay.
+    void abandon_flush() noexcept {
+        for (CompactionCopy const& c : copies) {
+            blases.get<0>(c.blas)->structure = c.source;
+            device->destroy_acceleration_structure(c.destination);
+        }
+        clear_flush();
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+// Lifecycle
+// -------------------------------------------------------------------------------------------------
+auto AccelerationStructureManager::create(BackendDevice& device, AccelerationStructureManagerDesc const& desc) noexcept
+    -> std::expected<AccelerationStructureManager, Status>
+{
+    if (!has_any(device.capabilities().features, Feature::RayTracing))
+        return std::unexpected{Status::MissingRequiredFeature};
+    if (desc.scratchBytes == 0)
+        return std::unexpected{Status::InvalidArgument};
+
+    auto scratch = device.create_buffer(BufferDesc{
+        .size      = desc.scratchBytes,
+        .usage     = BufferUsage::Storage,
+        .memory    = MemoryUsage::GpuOnly,
+        .debugName = "wren.acceleration_structures.scratch",
+    });
+    if (!scratch)
+        return std::unexpected{scratch.error()};
+
+    auto sizes = device.create_buffer(BufferDesc{
+        .size      = uint64_t{k_ring_depth} * k_max_compactions_per_flush * sizeof(uint64_t),
+        .usage     = BufferUsage::TransferDst,
+        .memory    = MemoryUsage::Readback,
+        .debugName = "wren.acceleration_structures.compacted_sizes",
+    });
+    if (!sizes) {
+        device.destroy_buffer(*scratch);
+        return std::unexpected{sizes.error()};
+    }
+
+    void const* mapped = device.map_buffer(*sizes);
+    if (!mapped) {
+        device.destroy_buffer(*sizes);
+        device.destroy_buffer(*scratch);
+        return std::unexpected{Status::InternalError};
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    std::unique_ptr<Impl> impl{new (std::nothrow) Impl{device, desc, *scratch, *sizes, mapped}};
+    if (!impl) {
+        device.destroy_buffer(*sizes);
+        device.destroy_buffer(*scratch);
+        return std::unexpected{Status::OutOfMemory};
+    }
+    return AccelerationStructureManager{std::move(impl)};
+}
+
+AccelerationStructureManager::AccelerationStructureManager(std::unique_ptr<Impl> impl) noexcept
+    : impl_{std::move(impl)}
+{}
+
+AccelerationStructureManager::AccelerationStructureManager(AccelerationStructureManager&&) noexcept = default;
+AccelerationStructureManager& AccelerationStructureManager::operator=(AccelerationStructureManager&&) noexcept =
+    default;
+
+AccelerationStructureManager::~AccelerationStructureManager() {
+    if (!impl_)
+        return;
+    auto& impl = *impl_;
+    (void)wait_idle();
+    for (Blas const& b : impl.blases.column<0>())
+        impl.device->destroy_acceleration_structure(b.structure);
+    for (Tlas const& t : impl.tlases.column<0>()) {
+        impl.device->destroy_acceleration_structure(t.structure);
+        impl.device->destroy_buffer(t.instances);
+    }
+    impl.device->destroy_buffer(impl.sizes);
+    impl.device->destroy_buffer(impl.scratch);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Bottom level
+// -------------------------------------------------------------------------------------------------
+auto AccelerationStructureManager::add_blas(BlasDesc const& desc) noexcept -> std::expected<BlasHandle, Status> {
+    if (desc.geometry.empty())
+        return std::unexpected{Status::InvalidArgument};
+
+    auto& impl = *impl_;
+    try {
+        Blas b{
+            .structure = {},
+            .geometry  = {desc.geometry.begin(), desc.geometry.end()},
+            .sizes     = {},
+            .policy    = desc.policy,
+            .name      = desc.debugName ? desc.debugName : "",
+        };
+        auto sizes = impl.device->acceleration_structure_sizes(blas_inputs(b));
+        if (!sizes)
+            return std::unexpected{sizes.error()};
+        auto structure = impl.device->create_acceleration_structure(AccelerationStructureDesc{
+            .type      = AccelerationStructureType::BottomLevel,
+            .size      = sizes->size,
+            .memory    = MemoryUsage::GpuOnly,
+            .debugName = desc.debugName,
+        });
+        if (!structure)
+            return std::unexpected{structure.error()};
+
+        b.structure = *structure;
+        b.sizes     = *sizes;
+        b.bytes     = sizes->size;
+        try {
+            BlasHandle const handle = impl.blases.insert(std::move(b));
+            impl.structure_bytes += sizes->size;
+            return handle;
+        } catch (std::bad_alloc const&) {
+            impl.device->destroy_acceleration_structure(*structure);
+            throw;
+        }
+    } catch (std::bad_alloc const&) {
+        return std::unexpected{Status::OutOfMemory};
+    }
+}
+
+Status AccelerationStructureManager::update_blas(BlasHandle blas) noexcept {
+    Blas* const b = impl_->blases.get<0>(blas);
+    if (!b || b->policy == BuildPolicy::Static)
+        return Status::InvalidArgument;
+    b->dirty = true;
+    return Status::Ok;
+}
+
+void AccelerationStructureManager::remove_blas(BlasHandle blas) noexcept {
+    auto& impl = *impl_;
+    Blas const* const b = impl.blases.get<0>(blas);
+    if (!b)
+        return;
+    // Destruction is deferred past the frames that may still trace it.
+    impl.device->destroy_acceleration_structure(b->structure);
+    impl.structure_bytes -= b->bytes;
+    impl.blases.erase(blas);
+}
+
+AccelerationStructureHandle AccelerationStructureManager::structure(BlasHandle blas) const noexcept {
+    Blas const* const b = impl_->blases.get<0>(blas);
+    return b ? b->structure : AccelerationStructureHandle{};
+}
+
+// -------------------------------------------------------------------------------------------------
+// Top level
+// -------------------------------------------------------------------------------------------------
+auto AccelerationStructureManager::add_tlas(TlasDesc const& desc) noexcept -> std::expected<TlasHandle, Status> {
+    if (desc.maxInstances == 0)
+        return std::unexpected{Status::InvalidArgument};
+
+    auto& impl = *impl_;
+    auto sizes = impl.device->acceleration_structure_sizes(AccelerationStructureInputs{
+        .type          = AccelerationStructureType::TopLevel,
+        .flags         = build_flags(desc.policy, false),
+        .instanceCount = desc.maxInstances,
+    });
+    if (!sizes)
+        return std::unexpected{sizes.error()};
+
+    auto instances = impl.device->create_buffer(BufferDesc{
+        .size      = uint64_t{k_ring_depth} * desc.maxInstances * sizeof(AccelerationStructureInstance),
+        .usage     = BufferUsage::AccelerationStructureInput,
+        .memory    = MemoryUsage::Upload,
+        .debugName = desc.debugName,
+    });
+    if (!instances)
+        return std::unexpected{instances.error()};
+    void* const mapped = impl.device->map_buffer(*instances);
+    auto structure = impl.device->create_acceleration_structure(AccelerationStructureDesc{
+        .type      = AccelerationStructureType::TopLevel,
+        .size      = sizes->size,
+        .memory    = MemoryUsage::GpuOnly,
+        .debugName = desc.debugName,
+    });
+    if (!mapped || !structure) {
+        if (structure)
+            impl.device->destroy_acceleration_structure(*structure);
+        impl.device->destroy_buffer(*instances);
+        return std::unexpected{structure ? Status::InternalError : structure.error()};
+    }
+
+    try {
+        TlasHandle const handle = impl.tlases.insert(Tlas{
+            .structure     = *structure,
+            .instances     = *instances,
+            .mapped        = static_cast<AccelerationStructureInstance*>(mapped),
+            .max_instances = desc.maxInstances,
+            .sizes         = *sizes,
+            .policy        = desc.policy,
+            .latest        = {},
+        });
+        impl.structure_bytes += sizes->size;
+        return handle;
+    } catch (std::bad_alloc const&) {
+        impl.device->destroy_acceleration_structure(*structure);
+        impl.device->destroy_buffer(*instances);
+        return std::unexpected{Status::OutOfMemory};
+    }
+}
+
+Status AccelerationStructureManager::update_tlas(TlasHandle tlas, std::span<TlasInstance const> instances) noexcept {
+    Tlas* const t = impl_->tlases.get<0>(tlas);
+    if (!t || instances.size() > t->max_instances)
+        return Status::InvalidArgument;
+    try {
+        t->latest.assign(instances.begin(), instances.end());
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+    t->dirty = true;
+    return Status::Ok;
+}
+
+void AccelerationStructureManager::remove_tlas(TlasHandle tlas) noexcept {
+    auto& impl = *impl_;
+    Tlas const* const t = impl.tlases.get<0>(tlas);
+    if (!t)
+        return;
+    impl.device->destroy_acceleration_structure(t->structure);
+    impl.device->destroy_buffer(t->instances);
+    impl.structure_bytes -= t->sizes.size;
+    impl.tlases.erase(tlas);
+}
+
+AccelerationStructureHandle AccelerationStructureManager::structure(TlasHandle tlas) const noexcept {
+    Tlas const* const t = impl_->tlases.get<0>(tlas);
+    return t ? t->structure : AccelerationStructureHandle{};
+}
+
+// -------------------------------------------------------------------------------------------------
+// Flush
+//
+// One list, in order: compaction copies, BLAS builds, compacted-size
+// writes for the Static BLASes built so far, TLAS builds. Every build and
+// copy call ends with a barrier, so each step sees the previous one's
+// structures. Bookkeeping is committed only once the submission succeeds.
+// -------------------------------------------------------------------------------------------------
+auto AccelerationStructureManager::flush(std::span<SyncPoint const> waits) noexcept
+    -> std::expected<SyncPoint, Status>
+{
+    auto&           impl  = *impl_;
+    QueueType const queue = impl.desc.queue;
+    uint32_t const  ring  = impl.ring;
+
+    // This flush's instance and size ranges were last used k_ring_depth flushes ago.
+    if (uint64_t const reused = impl.ring_values[ring]; reused != 0) {
+        if (Status s = impl.device->wait(SyncPoint{queue, reused}); s != Status::Ok)
+            return std::unexpected{s};
+    }
+
+    impl.clear_flush();
+    std::vector<uint64_t> blas_needs;
+    std::vector<uint64_t> tlas_needs;
+    try {
+        impl.collect_compactions(impl.device->completed_value(queue));
+        impl.collect_blas_builds(blas_needs);
+
+        // A compacted BLAS moves: every TLAS built over the old address rebuilds.
+        if (!impl.copies.empty()) {
+            for (Tlas& t : impl.tlases.column<0>())
+                t.dirty = t.dirty || t.built;
+        }
+        impl.collect_tlas_builds(tlas_needs);
+        impl.collect_measurements();
+    } catch (std::bad_alloc const&) {
+        impl.abandon_flush();
+        return std::unexpected{Status::OutOfMemory};
+    }
+
+    if (impl.copies.empty() && impl.blas_builds.empty() && impl.tlas_builds.empty() && impl.measured.empty())
+        return SyncPoint{};
+
+    uint64_t need = 0;
+    for (uint64_t const n : blas_needs) need = std::max(need, n);
+    for (uint64_t const n : tlas_needs) need = std::max(need, n);
+    if (Status s = impl.grow_scratch(need); s != Status::Ok) {
+        impl.abandon_flush();
+        return std::unexpected{s};
+    }
+
+    auto list = impl.device->begin_command_list({.queue = queue});
+    if (!list) {
+        impl.abandon_flush();
+        return std::unexpected{list.error()};
+    }
+
+    for (CompactionCopy const& c : impl.copies)
+        list->copy_acceleration_structure(c.source, c.destination, AccelerationStructureCopyMode::Compact);
+    impl.record(*list, impl.blas_builds, blas_needs);
+    uint64_t const size_offset = uint64_t{ring} * k_max_compactions_per_flush * sizeof(uint64_t);
+    if (!impl.measured.empty())
+        list->write_compacted_sizes(impl.measured, impl.sizes, size_offset);
+    impl.record(*list, impl.tlas_builds, tlas_needs);
+
+    Status const ended = list->end();
+    if (ended != Status::Ok) {
+        impl.abandon_flush();
+        return std::unexpected{ended};
+    }
+    CommandListHandle const handle = list->handle();
+    auto point = impl.device->submit({&handle, 1}, waits);
+    if (!point) {
+        impl.abandon_flush();
+        return std::unexpected{point.error()};
+    }
+
+    // Commit.
+    impl.ring_values[ring] = point->value;
+    impl.ring              = (ring + 1) % k_ring_depth;
+    impl.last_value        = point->value;
+
+    for (CompactionCopy const& c : impl.copies) {
+        Blas* const b = impl.blases.get<0>(c.blas);
+        impl.device->destroy_acceleration_structure(c.source);
+        impl.structure_bytes -= b->bytes - c.size;
+        impl.compacted_bytes += b->bytes - c.size;
+        b->bytes = c.size;
+        ++impl.copy_count;
+    }
+    for (std::size_t i = 0; i < impl.built_blases.size(); ++i) {
+        Blas* const b = impl.blases.get<0>(impl.built_blases[i]);
+        bool const refit = impl.blas_builds[i].mode == AccelerationStructureBuildMode::Update;
+        b->refits = refit ? b->refits + 1 : 0;
+        b->dirty  = false;
+        b->built  = true;
+        ++(refit ? impl.refit_count : impl.build_count);
+    }
+    for (std::size_t i = 0; i < impl.built_tlases.size(); ++i) {
+        Tlas* const t = impl.tlases.get<0>(impl.built_tlases[i]);
+        bool const refit = impl.tlas_builds[i].mode == AccelerationStructureBuildMode::Update;
+        t->refits      = refit ? t->refits + 1 : 0;
+        t->built_count = impl.tlas_builds[i].inputs.instanceCount;
+        t->dirty       = false;
+        t->built       = true;
+        ++(refit ? impl.refit_count : impl.build_count);
+    }
+
+    // Losing measurements to an allocation failure only costs their compaction.
+    impl.unmeasured.erase(impl.unmeasured.begin(),
+                          impl.unmeasured.begin() + static_cast<std::ptrdiff_t>(impl.examined));
+    try {
+        for (std::size_t i = 0; i < impl.measured.size(); ++i) {
+            impl.compactions.push_back({impl.measured_blases[i], impl.measured[i], point->value,
+                                        ring * k_max_compactions_per_flush + static_cast<uint32_t>(i)});
+        }
+        impl.unmeasured.insert(impl.unmeasured.end(), impl.overflow.begin(), impl.overflow.end());
+    } catch (std::bad_alloc const&) {
+    }
+
+    impl.clear_flush();
+    return *point;
+}
+
+Status AccelerationStructureManager::wait_idle() noexcept {
+    auto& impl = *impl_;
+    if (impl.last_value == 0)
+        return Status::Ok;
+    return impl.device->wait(SyncPoint{impl.desc.queue, impl.last_value});
+}
+
+AccelerationStructureManagerStats AccelerationStructureManager::stats() const noexcept {
+    auto const& impl = *impl_;
+    return AccelerationStructureManagerStats{
+        .blasCount          = static_cast<uint32_t>(impl.blases.size()),
+        .tlasCount          = static_cast<uint32_t>(impl.tlases.size()),
+        .pendingCompactions = static_cast<uint32_t>(impl.compactions.size() + impl.unmeasured.size()),
+        .structureBytes     = impl.structure_bytes,
+        .compactedBytes     = impl.compacted_bytes,
+        .scratchBytes       = impl.scratch_bytes,
+        .builds             = impl.build_count,
+        .refits             = impl.refit_count,
+        .compactions        = impl.copy_count,
+    };
+}
+
+} // namespace wren::rhi
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <span>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/loader.hpp>
+#include <wren/rhi/transfer/upload_queue.hpp>
+
+namespace wren::rhi {
+
+// -------------------------------------------------------------------------------------------------
+// PeerCopyQueue — copies buffers and textures from one device to another.
+//
+// Explicit multi-adapter devices share no memory, so a copy goes through
+// the host: a ReadbackQueue on the source reads it into mapped memory and,
+// as soon as it lands, an UploadQueue on the destination stages it for the
+// destination's transfer queue. Neither device waits for the other; each
+// side is flushed from its own frame:
+//
+//     peers.enqueue(TexturePeerCopy{.source = shadow_atlas, .destination = remote_atlas, ...});
+//     auto sent = peers.flush_source({&rendered, 1});           // source frame thread
+//     ...
+//     auto batch = peers.flush_destination();                   // destination frame thread
+//     gfx.barriers(batch->textureAcquires, batch->bufferAcquires);
+//
+// A copy reaches the destination in the first flush_destination() after
+// the flush_source() that finds it read back, typically one source frame
+// after the one that sent it. Copies that arrive while the destination's
+// staging is full wait in a backlog and are staged again, in order, by
+// later flush_source() calls. Copies initialise their destination as
+// UploadQueue uploads do: a texture's previous contents are discarded.
+//
+// Devices of one device group (DeviceFlag::DeviceGroup) need none of this:
+// every physical device there has its own instance of each resource.
+//
+// Thread-safety: enqueue() may be called from any thread. flush_source()
+// belongs to the source's frame thread, flush_destination() to the
+// destination's; wait_idle() needs both idle. Both devices must outlive the
+// queue and must not be moved while it exists.
+// -------------------------------------------------------------------------------------------------
+
+struct PeerCopyQueueDesc {
+    uint64_t  ringBytes        = 64ull << 20;          ///< Readback ring and staging budget, each; a multiple of 256.
+    QueueType sourceQueue      = QueueType::Graphics;  ///< Source queue the read-backs run on.
+    QueueType destinationQueue = QueueType::Transfer;  ///< Destination queue the uploads run on.
+    QueueType consumer         = QueueType::Graphics;  ///< Destination queue that acquires the copies.
+};
+
+struct BufferPeerCopy {
+    BufferHandle source;
+    uint64_t     sourceOffset = 0;
+    BufferUsage  sourceUsage  = BufferUsage::Storage;  ///< Source state before and after the copy.
+    ShaderStage  sourceStages = ShaderStage::Compute;
+    BufferHandle destination;
+    uint64_t     destinationOffset = 0;
+    uint64_t     size              = 0;
+    BufferUsage  finalUsage        = BufferUsage::Storage;  ///< Destination state after the copy.
+    ShaderStage  finalStages       = ShaderStage::Compute;
+};
+
+/// A region of one mip level and array layer, at the same place in both textures.
+struct TexturePeerCopy {
+    TextureHandle source;
+    TextureFormat format       = TextureFormat::RGBA8_UNorm;     ///< Format of both textures.
+    TextureUsage  sourceUsage  = TextureUsage::ColorAttachment;  ///< Source state before and after the copy.
+    ShaderStage   sourceStages = ShaderStage::None;
+    TextureHandle destination;
+    uint32_t      mipLevel   = 0;
+    uint32_t      arrayLayer = 0;
+    int32_t       x = 0, y = 0;
+    uint32_t      width = 0, height = 0;
+    TextureUsage  finalUsage  = TextureUsage::Sampled;  ///< Destination state after the copy.
+    ShaderStage   finalStages = ShaderStage::Fragment;
+};
+
+class PeerCopyQueue {
+public:
+    /// Creates the readback ring on @p source and the staging buffer on
+    /// @p destination.
+    [[nodiscard]] static auto create(BackendDevice& source, BackendDevice& destination,
+                                     PeerCopyQueueDesc const& desc = {}) noexcept
+        -> std::expected<PeerCopyQueue, Status>;
+
+    /// Waits for every flushed read-back; copies not yet staged are dropped.
+    ~PeerCopyQueue();
+
+    PeerCopyQueue(PeerCopyQueue&&) noexcept;
+    PeerCopyQueue& operator=(PeerCopyQueue&&) noexcept;
+
+    PeerCopyQueue(PeerCopyQueue const&)            = delete;
+    PeerCopyQueue& operator=(PeerCopyQueue const&) = delete;
+
+    /// Reserves read-back space for @p copy and queues it for the next
+    /// flush_source(). Status::OutOfMemory when the ring is full: nothing
+    /// is queued and the caller retries after a later flush_source().
+    [[nodiscard]] Status enqueue(BufferPeerCopy const& copy) noexcept;
+    [[nodiscard]] Status enqueue(TexturePeerCopy const& copy) noexcept;
+
+    /// Stages the copies read back since the last call for the destination,
+    /// backlog first, then submits the queued read-backs after @p waits.
+    /// Source frame thread only, between begin_frame() and end_frame(). A
+    /// null SyncPoint when nothing was queued; Status::OutOfMemory, once,
+    /// when a copy had to be dropped for want of backlog memory.
+    [[nodiscard]] auto flush_source(std::span<SyncPoint const> waits = {}) noexcept
+        -> std::expected<SyncPoint, Status>;
+
+    /// Submits the staged copies on the destination after @p waits.
+    /// Destination frame thread only, between begin_frame() and end_frame().
+    [[nodiscard]] auto flush_destination(std::span<SyncPoint const> waits = {}) noexcept
+        -> std::expected<UploadBatch, Status>;
+
+    /// Blocks until every flushed read-back has been staged or backlogged
+    /// and every flush_destination() has completed.
+    [[nodiscard]] Status wait_idle() noexcept;
+
+    /// Copies read back but waiting for destination staging.
+    [[nodiscard]] uint32_t backlog() const noexcept;
+
+private:
+    struct Impl;
+    explicit PeerCopyQueue(std::unique_ptr<Impl> impl) noexcept;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace wren::rhi
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <span>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/loader.hpp>
+
+namespace wren::rhi {
+
+// -------------------------------------------------------------------------------------------------
+// ReadbackQueue — copies buffer and texture data back to the CPU without waiting for the GPU.
+//
+// The copies land in one persistently mapped Readback buffer used as a ring
+// (ARCHITECTURE.md §8), so the readback budget is fixed at creation. Ring
+// space is reserved when a readback is enqueued. Once per frame flush()
+// records every queued copy into a single list, each source moved to
+// TransferSrc and back, and submits it after the work that produced the
+// data.
+//
+//     readbacks.enqueue(TextureReadback{.texture = frame, .format = fmt, ...,
+//                                       .onReady = [](ReadbackResult const& r) { save(r); }});
+//     device.submit({&gfx_handle, 1});
+//     auto done = readbacks.flush();
+//     ...
+//     readbacks.poll();  // next frame: runs the callbacks whose copies finished
+//
+// poll() reads the queue's timeline once and runs, in enqueue order, the
+// callback of every readback whose flush has completed; the ring space goes
+// back once the callback returns. Nothing blocks unless wait_idle() is
+// called.
+//
+// Texture rows are padded to k_readback_row_alignment bytes, as D3D12
+// requires and most Vulkan drivers copy fastest; ReadbackResult::rowPitch
+// gives the stride.
+//
+// Thread-safety: enqueue() may be called from any thread. flush(), poll()
+// and wait_idle() belong to the frame thread, and the callbacks run on it.
+// The device must outlive the queue and must not be moved while it exists.
+// -------------------------------------------------------------------------------------------------
+
+inline constexpr uint64_t k_readback_row_alignment = 256;
+
+struct ReadbackQueueDesc {
+    uint64_t  ringBytes = 64ull << 20;          ///< Fixed readback budget; a multiple of 256.
+    QueueType queue     = QueueType::Graphics;  ///< Queue the copies run on.
+};
+
+/// A finished readback. The bytes are mapped ring memory, valid only for the
+/// duration of the callback.
+struct ReadbackResult {
+    std::span<std::byte const> data;          ///< rowPitch * (height - 1) + width * texel bytes for textures.
+    uint64_t                   rowPitch = 0;  ///< Bytes between texture rows; the size for buffers.
+    uint32_t                   width    = 0;  ///< Texels; 0 for buffers.
+    uint32_t                   height   = 0;
+    SyncPoint                  point;         ///< The flush the copy was part of.
+};
+
+using ReadbackCallback = std::move_only_function<void(ReadbackResult const&)>;
+
+/// A region of one mip level and array layer of a texture.
+struct TextureReadback {
+    TextureHandle    texture;
+    TextureFormat    format     = TextureFormat::RGBA8_UNorm;     ///< The texture's format.
+    TextureUsage     usage      = TextureUsage::ColorAttachment;  ///< State before and after the copy.
+    ShaderStage      stages     = ShaderStage::None;              ///< Stages that use it in that state.
+    uint32_t         mipLevel   = 0;
+    uint32_t         arrayLayer = 0;
+    int32_t          x = 0, y = 0;
+    uint32_t         width = 0, height = 0;
+    ReadbackCallback onReady;                                     ///< Must not throw.
+};
+
+struct BufferReadback {
+    BufferHandle     buffer;
+    uint64_t         offset = 0;
+    uint64_t         size   = 0;
+    BufferUsage      usage  = BufferUsage::Storage;  ///< State before and after the copy.
+    ShaderStage      stages = ShaderStage::Compute;
+    ReadbackCallback onReady;  ///< Must not throw.
+};
+
+class ReadbackQueue {
+public:
+    /// Creates the readback ring and maps it.
+    [[nodiscard]] static auto create(BackendDevice& device, ReadbackQueueDesc const& desc = {}) noexcept
+        -> std::expected<ReadbackQueue, Status>;
+
+    /// Waits for every flushed readback and runs its callback; readbacks
+    /// that were never flushed are dropped.
+    ~ReadbackQueue();
+
+    ReadbackQueue(ReadbackQueue&&) noexcept;
+    ReadbackQueue& operator=(ReadbackQueue&&) noexcept;
+
+    ReadbackQueue(ReadbackQueue const&)            = delete;
+    ReadbackQueue& operator=(ReadbackQueue const&) = delete;
+
+    /// Reserves ring space for @p readback and queues it for the next
+    /// flush(). Status::OutOfMemory when the ring is full: nothing is queued
+    /// and the caller retries after a later poll().
+    [[nodiscard]] Status enqueue(TextureReadback&& readback) noexcept;
+    [[nodiscard]] Status enqueue(BufferReadback&& readback) noexcept;
+
+    /// Records and submits every queued copy after @p waits and everything
+    /// already submitted to the queue. Frame thread only, between
+    /// begin_frame() and end_frame(). A null SyncPoint when nothing was queued.
+    [[nodiscard]] auto flush(std::span<SyncPoint const> waits = {}) noexcept
+        -> std::expected<SyncPoint, Status>;
+
+    /// Runs the callbacks of every readback the GPU has finished and frees
+    /// their ring space. Returns how many ran. Frame thread only.
+    uint32_t poll() noexcept;
+
+    /// Blocks until every flushed readback has finished, then poll()s.
+    [[nodiscard]] Status wait_idle() noexcept;
+
+    /// Bytes of the ring currently reserved (approximate while readbacks are enqueued).
+    [[nodiscard]] uint64_t ring_used() const noexcept;
+    [[nodiscard]] uint64_t ring_capacity() const noexcept;
+
+private:
+    struct Impl;
+    explicit ReadbackQueue(std::unique_ptr<Impl> impl) noexcept;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace wren::rhi
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include <wren/platform/mapped_file.hpp>
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/loader.hpp>
+
+namespace wren::rhi {
+
+// -------------------------------------------------------------------------------------------------
+// ShaderPack — a read-only archive of named SPIR-V blobs, memory-mapped.
+//
+// A build step packs a level's shader permutations into one file
+// (write_shader_pack); at load time the file is mapped and its code handed
+// to create_shader_modules straight from the mapping, so nothing is read
+// or copied before the driver asks for it:
+//
+//     auto pack = ShaderPack::open("shaders/level3.wspk");
+//     std::vector<ShaderModuleHandle> modules(pack->size());
+//     if (Status s = pack->create_modules(device, modules); s != Status::Ok) ...
+//     ShaderModuleHandle lit = modules[*pack->find("lit.frag")];
+//
+// Layout, little-endian: a 16-byte header ("WSPK", version, entry count,
+// 0), the entry table sorted by name ({nameOffset, nameSize, codeOffset,
+// codeSize} as 32, 32, 64 and 64 bits), the NUL-terminated names, then
+// the code blobs, each 16-byte aligned. Offsets are from the file start.
+//
+// Thread-safety: immutable after open(); any thread.
+// -------------------------------------------------------------------------------------------------
+
+struct ShaderPackEntry {
+    std::string_view           name;  ///< Unique within a pack.
+    std::span<std::byte const> code;  ///< SPIR-V; a multiple of 4 bytes.
+};
+
+class ShaderPack {
+public:
+    static constexpr uint32_t k_version = 1;
+
+    /// Maps @p path and checks its table. Status::IoError when the file
+    /// cannot be mapped, Status::InvalidArgument when it is not a pack of
+    /// this version or an entry lies outside the file.
+    [[nodiscard]] static auto open(std::filesystem::path const& path) noexcept
+        -> std::expected<ShaderPack, Status>;
+
+    ShaderPack() noexcept = default;
+
+    [[nodiscard]] uint32_t size() const noexcept { return count_; }
+
+    /// Entry @p index, in name order; its views point into the mapping.
+    [[nodiscard]] ShaderPackEntry entry(uint32_t index) const noexcept;
+
+    /// Index of the entry called @p name.
+    [[nodiscard]] std::optional<uint32_t> find(std::string_view name) const noexcept;
+
+    /// Creates a module per entry into @p out, which must be size() long,
+    /// in one create_shader_modules call named after the entries. The
+    /// pack may be closed once the call returns.
+    [[nodiscard]] Status create_modules(BackendDevice& device, std::span<ShaderModuleHandle> out) const noexcept;
+
+private:
+    explicit ShaderPack(platform::mapped_file file, uint32_t count) noexcept;
+
+    platform::mapped_file file_;
+    uint32_t              count_ = 0;
+};
+
+/// Writes @p entries to @p path as a pack, replacing it atomically.
+/// Status::InvalidArgument for duplicate names or code that is empty or
+/// not a multiple of 4 bytes, Status::IoError when the file cannot be
+/// written.
+[[nodiscard]] Status write_shader_pack(std::filesystem::path const& path,
+                                       std::span<ShaderPackEntry const> entries) noexcept;
+
+} // namespace wren::rhi
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <span>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/loader.hpp>
+
+namespace wren::rhi {
+
+// -------------------------------------------------------------------------------------------------
+// UploadQueue — streams buffer and texture data to the GPU on the transfer queue.
+//
+// Data is copied into one persistently mapped Upload buffer used as a ring
+// (ARCHITECTURE.md §8), so the staging budget is fixed at creation. Once per
+// frame flush() records every queued copy into a single transfer list — all
+// regions of a texture in one copy call — and submits it on its own queue,
+// off the graphics critical path.
+//
+// Handoff: flush() returns the SyncPoint of the copies plus the acquire
+// barriers the consumer queue must record before touching the resources.
+//
+//     auto batch = uploads.flush();
+//     gfx.barriers(batch->textureAcquires, batch->bufferAcquires);
+//     ...
+//     device.submit({&gfx_handle, 1}, {&batch->ready, 1});
+//
+// Staging space is reclaimed once the GPU passes a flush's SyncPoint; only
+// the transfer queue's timeline is polled, nothing waits.
+//
+// Uploads initialise resources by default: a texture's previous contents
+// are discarded, and the destination range of a buffer must not be in use
+// by the GPU. Setting initialUsage instead updates a live resource in
+// place, ordered after its earlier uses; the queue must then be its
+// consumer, as resources in use cannot change queues mid-frame.
+//
+// Thread-safety: enqueue() may be called from any thread; the staging copy
+// happens under the queue's lock, so feed it from a few streaming threads.
+// flush() belongs to the frame thread, between begin_frame() and end_frame().
+// The device must outlive the queue and must not be moved while it exists.
+// -------------------------------------------------------------------------------------------------
+
+struct UploadQueueDesc {
+    uint64_t  stagingBytes = 64ull << 20;          ///< Fixed staging budget.
+    QueueType queue        = QueueType::Transfer;  ///< Queue the copies run on.
+    QueueType consumer     = QueueType::Graphics;  ///< Queue that acquires the uploaded resources.
+};
+
+/// One texture upload. The regions index into @c data: each region's
+/// bufferOffset is relative to the start of @c data.
+struct TextureUpload {
+    TextureHandle                      texture;
+    std::span<std::byte const>         data;
+    std::span<BufferTextureCopy const> regions;
+    TextureUsage                       finalUsage    = TextureUsage::Sampled;  ///< State after the upload.
+    ShaderStage                        finalStages   = ShaderStage::Fragment;
+    TextureUsage                       initialUsage  = TextureUsage::None;     ///< State before; None discards.
+    ShaderStage                        initialStages = ShaderStage::None;
+};
+
+struct BufferUpload {
+    BufferHandle               buffer;
+    uint64_t                   offset = 0;  ///< Destination offset in bytes.
+    std::span<std::byte const> data;
+    BufferUsage                finalUsage    = BufferUsage::Vertex;  ///< State after the upload.
+    ShaderStage                finalStages   = ShaderStage::None;
+    BufferUsage                initialUsage  = BufferUsage::None;    ///< State before; None if unused.
+    ShaderStage                initialStages = ShaderStage::None;
+};
+
+/// Result of UploadQueue::flush(). The spans stay valid until the next flush().
+struct UploadBatch {
+    SyncPoint                       ready;            ///< Null when nothing was flushed.
+    std::span<TextureBarrier const> textureAcquires;  ///< Record on the consumer queue.
+    std::span<BufferBarrier const>  bufferAcquires;
+};
+
+class UploadQueue {
+public:
+    /// Creates the staging buffer and maps it.
+    [[nodiscard]] static auto create(BackendDevice& device, UploadQueueDesc const& desc = {}) noexcept
+        -> std::expected<UploadQueue, Status>;
+
+    ~UploadQueue();
+
+    UploadQueue(UploadQueue&&) noexcept;
+    UploadQueue& operator=(UploadQueue&&) noexcept;
+
+    UploadQueue(UploadQueue const&)            = delete;
+    UploadQueue& operator=(UploadQueue const&) = delete;
+
+    /// Copies @p upload's data into staging memory and queues it for the next
+    /// flush(). Status::OutOfMemory when the staging budget is exhausted:
+    /// nothing is queued and the caller retries after a later flush().
+    /// Status::InvalidArgument for an initialUsage when queue != consumer.
+    [[nodiscard]] Status enqueue(TextureUpload const& upload) noexcept;
+    [[nodiscard]] Status enqueue(BufferUpload const& upload) noexcept;
+
+    /// Records and submits every queued upload after @p waits. Frame thread
+    /// only.
+    [[nodiscard]] auto flush(std::span<SyncPoint const> waits = {}) noexcept
+        -> std::expected<UploadBatch, Status>;
+
+    /// Blocks until every flushed upload has completed and reclaims all
+    /// staging space.
+    [[nodiscard]] Status wait_idle() noexcept;
+
+    /// Bytes of staging memory currently in use (approximate while uploads are enqueued).
+    [[nodiscard]] uint64_t staging_used() const noexcept;
+    [[nodiscard]] uint64_t staging_capacity() const noexcept;
+
+private:
+    struct Impl;
+    explicit UploadQueue(std::unique_ptr<Impl> impl) noexcept;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace wren::rhi
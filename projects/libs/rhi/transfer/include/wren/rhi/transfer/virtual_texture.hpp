@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <span>
+
+#include <wren/rhi/api/commands.hpp>
+#include <wren/rhi/api/enums.hpp>
+#include <wren/rhi/api/handles.hpp>
+#include <wren/rhi/api/resources.hpp>
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/loader.hpp>
+
+namespace wren::rhi {
+
+// -------------------------------------------------------------------------------------------------
+// VirtualTexture — streams a large texture through a fixed VRAM budget of sparse pages.
+//
+// The texture is sparse (ARCHITECTURE.md §8): the mip tail is bound once and
+// stays resident, every other page is bound on demand into one heap of
+// `budgetPages` pages, which works as an LRU page cache. Shaders report the
+// pages they need through a feedback buffer and clamp their LOD through a
+// residency buffer:
+//
+//     // per frame, on the frame thread, between begin_frame() and end_frame()
+//     auto ready = vt.update({&last_frame, 1});        // evict, bind, upload
+//     ... record passes that sample vt.texture() with vt.frame_stamp() in push constants ...
+//     auto frame = device.submit({&gfx_handle, 1}, {&*ready, 1});
+//     (void)vt.request_feedback({&*frame, 1});
+//
+// Feedback: one uint32 per page of the non-tail mips, laid out mip by mip
+// (feedback_layout()). A shader sampling page (mip, x, y) writes the
+// current frame_stamp() to entry firstEntry[mip] + y * pagesX[mip] + x; the
+// stamp grows every update(), so the buffer never needs clearing.
+// request_feedback() reads it back asynchronously and the next update()
+// after the copy completes acts on it.
+//
+// Residency: one uint32 per page of mip 0, holding the finest mip level from
+// which every coarser level covering that page is resident — the LOD to
+// clamp to. update() refreshes it whenever pages come or go.
+//
+// Pages are loaded coarse mips first and a requested page pulls in its
+// coarser parents, so the clamp moves only towards finer levels. A page is
+// evicted once the budget is full and no feedback requested it for
+// `retainFrames` updates.
+//
+// Thread-safety: frame thread only. The page source runs inside update().
+// The device must outlive the texture and must not be moved while it exists.
+// -------------------------------------------------------------------------------------------------
+
+/// Texel region of one page (or, for the mip tail, one whole mip level) to
+/// fill; width and height are clipped at the edge of the mip level.
+struct PageRequest {
+    uint32_t mipLevel = 0;
+    uint32_t x = 0, y = 0;           ///< Texel origin inside the mip level.
+    uint32_t width = 0, height = 0;
+};
+
+/// Returns the tightly packed texels of @p request, or an empty span when
+/// they are not available yet — the page is requested again on a later
+/// update(). The bytes only need to stay valid until the call returns.
+using PageSource = std::move_only_function<std::span<std::byte const>(PageRequest const&)>;
+
+struct VirtualTextureDesc {
+    TextureFormat format             = TextureFormat::RGBA8_UNorm;  ///< A colour format.
+    uint32_t      width              = 0;
+    uint32_t      height             = 0;
+    uint32_t      mipLevels          = 1;     ///< Must reach the mip tail (SparseTextureInfo::mipTailFirst).
+    uint32_t      budgetPages        = 1024;  ///< Resident pages outside the mip tail.
+    uint32_t      maxUploadsPerFrame = 32;    ///< Pages bound per update().
+    uint32_t      retainFrames       = 8;     ///< Updates a request protects a page from eviction.
+    uint64_t      stagingBytes       = 16ull << 20;  ///< Upload budget; holds a frame's pages.
+    ShaderStage   stages             = ShaderStage::Fragment;  ///< Stages that sample the texture.
+    PageSource    source;                     ///< Required. Must not throw.
+    const char*   debugName          = nullptr;
+};
+
+/// Where each mip level's pages live in the feedback buffer; only the first
+/// mipTailFirst entries are meaningful.
+struct VirtualTextureLayout {
+    static constexpr uint32_t k_max_mips = 16;
+
+    SparseTextureInfo page;                  ///< Page size and mip tail.
+    uint32_t          pagesX[k_max_mips]     = {};
+    uint32_t          pagesY[k_max_mips]     = {};
+    uint32_t          firstEntry[k_max_mips] = {};
+    uint32_t          entryCount             = 0;  ///< Total feedback entries.
+};
+
+/// Counters of the last update().
+struct VirtualTextureStats {
+    uint32_t residentPages  = 0;  ///< Out of VirtualTextureDesc::budgetPages.
+    uint32_t requestedPages = 0;  ///< Requested but not resident.
+    uint32_t boundPages     = 0;  ///< Bound and uploaded by the last update().
+    uint32_t evictedPages   = 0;
+};
+
+class VirtualTexture {
+public:
+    /// Creates the sparse texture, its page heap and the feedback and
+    /// residency buffers. Status::MissingRequiredFeature without
+    /// Feature::SparseResources; nothing is bound until the first update().
+    [[nodiscard]] static auto create(BackendDevice& device, VirtualTextureDesc&& desc) noexcept
+        -> std::expected<VirtualTexture, Status>;
+
+    /// Waits for the pending feedback and uploads, then destroys the resources.
+    ~VirtualTexture();
+
+    VirtualTexture(VirtualTexture&&) noexcept;
+    VirtualTexture& operator=(VirtualTexture&&) noexcept;
+
+    VirtualTexture(VirtualTexture const&)            = delete;
+    VirtualTexture& operator=(VirtualTexture const&) = delete;
+
+    /// Acts on the feedback that has arrived: unbinds stale pages after
+    /// @p waits — the submitted work that may still sample them — and binds
+    /// and uploads the missing ones. Frame thread, between begin_frame() and
+    /// end_frame(). @returns The SyncPoint that work sampling the texture
+    /// this frame waits on; null when nothing changed.
+    [[nodiscard]] auto update(std::span<SyncPoint const> waits = {}) noexcept
+        -> std::expected<SyncPoint, Status>;
+
+    /// Reads the feedback buffer back after @p waits, the work that wrote
+    /// it. Skipped (Status::Ok) while earlier readbacks fill the ring.
+    [[nodiscard]] Status request_feedback(std::span<SyncPoint const> waits) noexcept;
+
+    /// Sampled in VirtualTextureDesc::stages with TextureUsage::Sampled.
+    [[nodiscard]] TextureHandle texture() const noexcept;
+
+    /// Storage buffers, in BufferUsage::Storage for VirtualTextureDesc::stages.
+    [[nodiscard]] BufferHandle feedback_buffer() const noexcept;
+    [[nodiscard]] BufferHandle residency_buffer() const noexcept;
+
+    /// Value shaders write to the feedback buffer in the work after update().
+    [[nodiscard]] uint32_t frame_stamp() const noexcept;
+
+    [[nodiscard]] VirtualTextureLayout const& feedback_layout() const noexcept;
+    [[nodiscard]] VirtualTextureStats stats() const noexcept;
+
+private:
+    struct Impl;
+    explicit VirtualTexture(std::unique_ptr<Impl> impl) noexcept;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace wren::rhi
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+
+#include <wren/rhi/api/status.hpp>
+#include <wren/rhi/loader.hpp>
+
+namespace wren::rhi {
+
+// -------------------------------------------------------------------------------------------------
+// WorkDistributor — spreads a run of independent jobs over several devices.
+//
+// Explicit multi-adapter (ARCHITECTURE.md §4.4): one BackendDevice per
+// GPU, each driven by a thread of its own, as a device's frame functions
+// belong to one thread. run() starts those threads and each claims job
+// indices from one shared counter whenever it has room for another job, so
+// a faster GPU simply claims more and none idles while jobs remain:
+//
+//     WorkDistributor work{frame_count};
+//     Status s = work.run(devices, [&](uint32_t index, BackendDevice& device) {
+//         while (auto frame = work.claim(index))
+//             render(device, *frame);
+//         return Status::Ok;
+//     });
+//
+// The devices share nothing but the counter, so throughput grows with the
+// GPU count for as long as the jobs are GPU-bound and every device thread
+// has a core. A device that fails stops claiming and leaves the jobs it
+// never claimed to the others; those it had claimed are its to report.
+//
+// Thread-safety: claim() and claimed() from any thread; run() from one
+// thread at a time.
+// -------------------------------------------------------------------------------------------------
+
+/// Work for one device: runs on the device's thread, concurrently with the
+/// other devices', and receives the device's index in run()'s span.
+using DeviceWork = std::function<Status(uint32_t index, BackendDevice& device)>;
+
+class WorkDistributor {
+public:
+    static constexpr uint32_t k_max_devices = 16;
+
+    /// Jobs 0 .. @p job_count - 1, none claimed yet.
+    explicit WorkDistributor(uint64_t job_count) noexcept : job_count_{job_count} {}
+
+    WorkDistributor(WorkDistributor const&)            = delete;
+    WorkDistributor& operator=(WorkDistributor const&) = delete;
+
+    /// The next unclaimed job, counted against @p device, or nullopt once
+    /// every job has been claimed. Lock-free.
+    [[nodiscard]] std::optional<uint64_t> claim(uint32_t device) noexcept;
+
+    /// Jobs claimed by @p device so far.
+    [[nodiscard]] uint64_t claimed(uint32_t device) const noexcept;
+
+    [[nodiscard]] uint64_t job_count() const noexcept { return job_count_; }
+
+    /// Runs @p work once per device, each call on a new thread named
+    /// "wren-gpu<index>", and returns once all of them have: Status::Ok, or
+    /// the first failure in device order. Status::InvalidArgument for no
+    /// devices, more than k_max_devices or a null one; Status::OutOfMemory
+    /// when a thread cannot be started, after the started ones have returned.
+    [[nodiscard]] Status run(std::span<BackendDevice* const> devices, DeviceWork const& work);
+
+private:
+    uint64_t                                          job_count_;
+    std::atomic<uint64_t>                             next_{0};
+    std::array<std::atomic<uint64_t>, k_max_devices> claimed_;  // value-initialised by std::atomic
+};
+
+} // namespace wren::rhi
@@ -0,0 +1,239 @@
+#include <wren/rhi/transfer/peer_copy_queue.hpp>
+
+#include <wren/rhi/transfer/readback_queue.hpp>
+
+#include "texel.hpp"
+
+#include <wren/foundation/memory/align.hpp>
+
+#include <deque>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace wren::rhi {
+
+namespace {
+
+/// Where a read-back copy goes on the destination: a buffer range, or a
+/// texture region whose bufferOffset is relative to the read-back data.
+struct Delivery {
+    TextureHandle     texture;  // null for buffer copies
+    BufferHandle      buffer;
+    uint64_t          offset = 0;
+    BufferTextureCopy region;
+    TextureUsage      texture_usage = TextureUsage::None;
+    BufferUsage       buffer_usage  = BufferUsage::None;
+    ShaderStage       stages        = ShaderStage::None;
+};
+
+/// A copy that arrived while the destination's staging was full.
+struct Backlogged {
+    Delivery               delivery;
+    std::vector<std::byte> data;
+};
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Impl
+//
+// Declared so that the read-back queue is destroyed first: its destructor
+// runs the outstanding callbacks, which stage into `uploads` or `backlog`.
+// -------------------------------------------------------------------------------------------------
+struct PeerCopyQueue::Impl {
+    UploadQueue uploads;
+
+    mutable std::mutex     mutex;  // guards `backlog` and `dropped`
+    std::deque<Backlogged> backlog;
+    bool                   dropped = false;
+
+    ReadbackQueue readbacks;
+
+    Impl(UploadQueue up, ReadbackQueue down) noexcept
+        : uploads{std::move(up)}
+        , readbacks{std::move(down)}
+    {}
+
+    [[nodiscard]] Status stage(Delivery const& d, std::span<std::byte const> data) noexcept {
+        if (d.texture) {
+            return uploads.enqueue(TextureUpload{
+                .texture     = d.texture,
+                .data        = data,
+                .regions     = {&d.region, 1},
+                .finalUsage  = d.texture_usage,
+                .finalStages = d.stages,
+            });
+        }
+        return uploads.enqueue(BufferUpload{
+            .buffer      = d.buffer,
+            .offset      = d.offset,
+            .data        = data,
+            .finalUsage  = d.buffer_usage,
+            .finalStages = d.stages,
+        });
+    }
+
+    /// Read-back callback: stages @p data now unless older copies are still
+    /// in the backlog or staging is full, in which case it joins them.
+    void arrive(Delivery const& d, std::span<std::byte const> data) noexcept {
+        std::scoped_lock lock{mutex};
+        if (backlog.empty() && stage(d, data) == Status::Ok)
+            return;
+        try {
+            backlog.push_back(Backlogged{d, {data.begin(), data.end()}});
+        } catch (std::bad_alloc const&) {
+            dropped = true;
+        }
+    }
+
+    /// Stages backlogged copies, oldest first, until staging is full again.
+    void drain() noexcept {
+        std::scoped_lock lock{mutex};
+        while (!backlog.empty() && stage(backlog.front().delivery, backlog.front().data) == Status::Ok)
+            backlog.pop_front();
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+// Lifecycle
+// -------------------------------------------------------------------------------------------------
+auto PeerCopyQueue::create(BackendDevice& source, BackendDevice& destination,
+                           PeerCopyQueueDesc const& desc) noexcept
+    -> std::expected<PeerCopyQueue, Status>
+{
+    if (&source == &destination)
+        return std::unexpected{Status::InvalidArgument};
+
+    auto readbacks = ReadbackQueue::create(source, {.ringBytes = desc.ringBytes, .queue = desc.sourceQueue});
+    if (!readbacks)
+        return std::unexpected{readbacks.error()};
+    auto uploads = UploadQueue::create(destination, {
+        .stagingBytes = desc.ringBytes,
+        .queue        = desc.destinationQueue,
+        .consumer     = desc.consumer,
+    });
+    if (!uploads)
+        return std::unexpected{uploads.error()};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    std::unique_ptr<Impl> impl{new (std::nothrow) Impl{std::move(*uploads), std::move(*readbacks)}};
+    if (!impl)
+        return std::unexpected{Status::OutOfMemory};
+    return PeerCopyQueue{std::move(impl)};
+}
+
+PeerCopyQueue::PeerCopyQueue(std::unique_ptr<Impl> impl) noexcept
+    : impl_{std::move(impl)}
+{}
+
+PeerCopyQueue::PeerCopyQueue(PeerCopyQueue&&) noexcept            = default;
+PeerCopyQueue& PeerCopyQueue::operator=(PeerCopyQueue&&) noexcept = default;
+PeerCopyQueue::~PeerCopyQueue()                                    = default;
+
+// -------------------------------------------------------------------------------------------------
+// Enqueue
+// -------------------------------------------------------------------------------------------------
+Status PeerCopyQueue::enqueue(BufferPeerCopy const& copy) noexcept {
+    if (!copy.destination)
+        return Status::InvalidArgument;
+
+    Impl* const impl = impl_.get();
+    Delivery const delivery{
+        .texture      = {},
+        .buffer       = copy.destination,
+        .offset       = copy.destinationOffset,
+        .region       = {},
+        .buffer_usage = copy.finalUsage,
+        .stages       = copy.finalStages,
+    };
+    return impl->readbacks.enqueue(BufferReadback{
+        .buffer  = copy.source,
+        .offset  = copy.sourceOffset,
+        .size    = copy.size,
+        .usage   = copy.sourceUsage,
+        .stages  = copy.sourceStages,
+        .onReady = [impl, delivery](ReadbackResult const& r) { impl->arrive(delivery, r.data); },
+    });
+}
+
+Status PeerCopyQueue::enqueue(TexturePeerCopy const& copy) noexcept {
+    if (!copy.destination)
+        return Status::InvalidArgument;
+
+    // The read-back's padded rows become the upload's row length.
+    uint64_t const texel     = copy_texel_size(copy.format);
+    uint64_t const row_pitch = foundation::memory::align_up(copy.width * texel, k_readback_row_alignment);
+
+    Impl* const impl = impl_.get();
+    Delivery const delivery{
+        .texture       = copy.destination,
+        .buffer        = {},
+        .offset        = 0,
+        .region        = {
+            .bufferOffset      = 0,
+            .bufferRowLength   = static_cast<uint32_t>(row_pitch / texel),
+            .bufferImageHeight = copy.height,
+            .mipLevel          = copy.mipLevel,
+            .baseArrayLayer    = copy.arrayLayer,
+            .layerCount        = 1,
+            .x                 = copy.x,
+            .y                 = copy.y,
+            .z                 = 0,
+            .width             = copy.width,
+            .height            = copy.height,
+            .depth             = 1,
+        },
+        .texture_usage = copy.finalUsage,
+        .stages        = copy.finalStages,
+    };
+    return impl->readbacks.enqueue(TextureReadback{
+        .texture    = copy.source,
+        .format     = copy.format,
+        .usage      = copy.sourceUsage,
+        .stages     = copy.sourceStages,
+        .mipLevel   = copy.mipLevel,
+        .arrayLayer = copy.arrayLayer,
+        .x          = copy.x,
+        .y          = copy.y,
+        .width      = copy.width,
+        .height     = copy.height,
+        .onReady    = [impl, delivery](ReadbackResult const& r) { impl->arrive(delivery, r.data); },
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+// Flush
+// -------------------------------------------------------------------------------------------------
+auto PeerCopyQueue::flush_source(std::span<SyncPoint const> waits) noexcept -> std::expected<SyncPoint, Status> {
+    auto& impl = *impl_;
+    impl.drain();
+    auto point = impl.readbacks.flush(waits);  // polls first: finished read-backs arrive here
+
+    std::scoped_lock lock{impl.mutex};
+    if (std::exchange(impl.dropped, false))
+        return std::unexpected{Status::OutOfMemory};
+    return point;
+}
+
+auto PeerCopyQueue::flush_destination(std::span<SyncPoint const> waits) noexcept
+    -> std::expected<UploadBatch, Status>
+{
+    return impl_->uploads.flush(waits);
+}
+
+Status PeerCopyQueue::wait_idle() noexcept {
+    auto& impl = *impl_;
+    if (Status s = impl.readbacks.wait_idle(); s != Status::Ok)
+        return s;
+    impl.drain();
+    return impl.uploads.wait_idle();
+}
+
+uint32_t PeerCopyQueue::backlog() const noexcept {
+    std::scoped_lock lock{impl_->mutex};
+    return static_cast<uint32_t>(impl_->backlog.size());
+}
+
+} // namespace wren::rhi
@@ -0,0 +1,403 @@
+#include <wren/rhi/transfer/readback_queue.hpp>
+
+#include "texel.hpp"
+
+#include <wren/foundation/memory/align.hpp>
+#include <wren/foundation/memory/ring_allocator.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace wren::rhi {
+
+namespace {
+
+// k_readback_row_alignment is a multiple of every copy_texel_size(), so
+// rebased ring offsets stay valid copy offsets.
+static_assert(k_readback_row_alignment % 16 == 0);
+
+/// A queued readback. `result.data` already points at its ring range;
+/// flush() fills in `result.point`.
+struct PendingReadback {
+    TextureHandle     texture;             // null for buffer readbacks
+    BufferHandle      buffer;
+    TextureUsage      texture_usage = TextureUsage::None;
+    BufferUsage       buffer_usage  = BufferUsage::None;
+    ShaderStage       stages        = ShaderStage::None;
+    BufferTextureCopy region;              // textures; bufferOffset is the ring offset
+    BufferCopy        copy;                // buffers; dstOffset is the ring offset
+    ReadbackResult    result;
+    ReadbackCallback  on_ready;
+};
+
+/// A submitted flush: its `count` readbacks are the oldest in `completing`.
+/// Their ring range is free once their callbacks have run.
+struct InFlight {
+    uint64_t value    = 0;
+    uint64_t ring_end = 0;
+    uint32_t count    = 0;
+};
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Impl
+// -------------------------------------------------------------------------------------------------
+struct ReadbackQueue::Impl {
+    BackendDevice*                    device;
+    ReadbackQueueDesc                 desc;
+    BufferHandle                      ring_buffer;
+    std::byte*                        mapped;
+    foundation::memory::RingAllocator ring;
+
+    std::mutex                   mutex;    // guards `pending` and ring allocation
+    std::vector<PendingReadback> pending;
+
+    // Frame thread only.
+    std::vector<PendingReadback> flushing;
+    std::vector<TextureBarrier>  texture_transitions;  // into TransferSrc before the copies
+    std::vector<TextureBarrier>  texture_restores;     // back to each source's state after
+    std::vector<BufferBarrier>   buffer_transitions;
+    std::vector<BufferBarrier>   buffer_restores;
+    std::deque<PendingReadback>  completing;
+    std::deque<InFlight>         in_flight;
+
+    Impl(BackendDevice& dev, ReadbackQueueDesc const& d, BufferHandle buffer, void* ptr) noexcept
+        : device{&dev}
+        , desc{d}
+        , ring_buffer{buffer}
+        , mapped{static_cast<std::byte*>(ptr)}
+        , ring{d.ringBytes}
+    {}
+
+    /// Reserves @p size ring bytes for a readback. Caller holds `mutex`.
+    [[nodiscard]] std::optional<uint64_t> reserve(uint64_t size) noexcept {
+        auto const alloc = ring.allocate(size, k_readback_row_alignment);
+        if (!alloc)
+            return std::nullopt;
+        return alloc->offset;
+    }
+
+    /// Runs the callbacks of every flush whose value @p completed has
+    /// reached, oldest first, and frees their ring ranges.
+    uint32_t complete(uint64_t completed) noexcept {
+        uint32_t ran = 0;
+        uint64_t release_to = 0;
+        while (!in_flight.empty() && in_flight.front().value <= completed) {
+            InFlight const flight = in_flight.front();
+            in_flight.pop_front();
+            for (uint32_t i = 0; i < flight.count && !completing.empty(); ++i) {
+                PendingReadback readback = std::move(completing.front());
+                completing.pop_front();
+                readback.on_ready(readback.result);
+                ++ran;
+            }
+            release_to = flight.ring_end;
+        }
+        if (release_to != 0)
+            ring.release(release_to);
+        return ran;
+    }
+
+    /// Barriers for one source, once per flush however often it is read.
+    void add_barriers(PendingReadback const& r) {
+        QueueType const queue = desc.queue;
+        if (r.texture) {
+            auto const same = [&](TextureBarrier const& b) { return b.texture == r.texture; };
+            if (std::ranges::any_of(texture_transitions, same))
+                return;
+            texture_transitions.push_back(TextureBarrier{
+                .texture   = r.texture,
+                .oldUsage  = r.texture_usage,
+                .newUsage  = TextureUsage::TransferSrc,
+                .srcStages = r.stages,
+                .dstStages = ShaderStage::None,
+                .srcQueue  = queue,
+                .dstQueue  = queue,
+            });
+            texture_restores.push_back(TextureBarrier{
+                .texture   = r.texture,
+                .oldUsage  = TextureUsage::TransferSrc,
+                .newUsage  = r.texture_usage,
+                .srcStages = ShaderStage::None,
+                .dstStages = r.stages,
+                .srcQueue  = queue,
+                .dstQueue  = queue,
+            });
+            return;
+        }
+        auto const same = [&](BufferBarrier const& b) { return b.buffer == r.buffer; };
+        if (std::ranges::any_of(buffer_transitions, same))
+            return;
+        buffer_transitions.push_back(BufferBarrier{
+            .buffer    = r.buffer,
+            .oldUsage  = r.buffer_usage,
+            .newUsage  = BufferUsage::TransferSrc,
+            .srcStages = r.stages,
+            .dstStages = ShaderStage::None,
+            .srcQueue  = queue,
+            .dstQueue  = queue,
+        });
+        buffer_restores.push_back(BufferBarrier{
+            .buffer    = r.buffer,
+            .oldUsage  = BufferUsage::TransferSrc,
+            .newUsage  = r.buffer_usage,
+            .srcStages = ShaderStage::None,
+            .dstStages = r.stages,
+            .srcQueue  = queue,
+            .dstQueue  = queue,
+        });
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+// Lifecycle
+// -------------------------------------------------------------------------------------------------
+auto ReadbackQueue::create(BackendDevice& device, ReadbackQueueDesc const& desc) noexcept
+    -> std::expected<ReadbackQueue, Status>
+{
+    if (desc.ringBytes == 0 || desc.ringBytes % k_readback_row_alignment != 0)
+        return std::unexpected{Status::InvalidArgument};
+
+    auto buffer = device.create_buffer(BufferDesc{
+        .size      = desc.ringBytes,
+        .usage     = BufferUsage::TransferDst,
+        .memory    = MemoryUsage::Readback,
+        .debugName = "wren.readback_queue.ring",
+    });
+    if (!buffer)
+        return std::unexpected{buffer.error()};
+
+    void* mapped = device.map_buffer(*buffer);
+    if (!mapped) {
+        device.destroy_buffer(*buffer);
+        return std::unexpected{Status::InternalError};
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    std::unique_ptr<Impl> impl{new (std::nothrow) Impl{device, desc, *buffer, mapped}};
+    if (!impl) {
+        device.destroy_buffer(*buffer);
+        return std::unexpected{Status::OutOfMemory};
+    }
+    return ReadbackQueue{std::move(impl)};
+}
+
+ReadbackQueue::ReadbackQueue(std::unique_ptr<Impl> impl) noexcept
+    : impl_{std::move(impl)}
+{}
+
+ReadbackQueue::ReadbackQueue(ReadbackQueue&&) noexcept            = default;
+ReadbackQueue& ReadbackQueue::operator=(ReadbackQueue&&) noexcept = default;
+
+ReadbackQueue::~ReadbackQueue() {
+    if (!impl_)
+        return;
+    (void)wait_idle();
+    impl_->device->destroy_buffer(impl_->ring_buffer);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Enqueue
+// -------------------------------------------------------------------------------------------------
+Status ReadbackQueue::enqueue(TextureReadback&& readback) noexcept {
+    if (!readback.texture || readback.width == 0 || readback.height == 0 || !readback.onReady)
+        return Status::InvalidArgument;
+
+    uint64_t const texel     = copy_texel_size(readback.format);
+    uint64_t const row_bytes = readback.width * texel;
+    uint64_t const row_pitch = foundation::memory::align_up(row_bytes, k_readback_row_alignment);
+    uint64_t const size      = row_pitch * (readback.height - 1) + row_bytes;
+
+    auto& impl = *impl_;
+    std::scoped_lock lock{impl.mutex};
+    try {
+        impl.pending.reserve(impl.pending.size() + 1);
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+
+    auto const offset = impl.reserve(size);
+    if (!offset)
+        return Status::OutOfMemory;
+
+    impl.pending.push_back(PendingReadback{
+        .texture       = readback.texture,
+        .buffer        = {},
+        .texture_usage = readback.usage,
+        .buffer_usage  = BufferUsage::None,
+        .stages        = readback.stages,
+        .region        = {
+            .bufferOffset      = *offset,
+            .bufferRowLength   = static_cast<uint32_t>(row_pitch / texel),
+            .bufferImageHeight = readback.height,
+            .mipLevel          = readback.mipLevel,
+            .baseArrayLayer    = readback.arrayLayer,
+            .layerCount        = 1,
+            .x                 = readback.x,
+            .y                 = readback.y,
+            .z                 = 0,
+            .width             = readback.width,
+            .height            = readback.height,
+            .depth             = 1,
+        },
+        .copy          = {},
+        .result        = {
+            .data     = {impl.mapped + *offset, size},
+            .rowPitch = row_pitch,
+            .width    = readback.width,
+            .height   = readback.height,
+            .point    = {},
+        },
+        .on_ready      = std::move(readback.onReady),
+    });
+    return Status::Ok;
+}
+
+Status ReadbackQueue::enqueue(BufferReadback&& readback) noexcept {
+    if (!readback.buffer || readback.size == 0 || !readback.onReady)
+        return Status::InvalidArgument;
+
+    auto& impl = *impl_;
+    std::scoped_lock lock{impl.mutex};
+    try {
+        impl.pending.reserve(impl.pending.size() + 1);
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+
+    auto const offset = impl.reserve(readback.size);
+    if (!offset)
+        return Status::OutOfMemory;
+
+    impl.pending.push_back(PendingReadback{
+        .texture       = {},
+        .buffer        = readback.buffer,
+        .texture_usage = TextureUsage::None,
+        .buffer_usage  = readback.usage,
+        .stages        = readback.stages,
+        .region        = {},
+        .copy          = {readback.offset, *offset, readback.size},
+        .result        = {
+            .data     = {impl.mapped + *offset, readback.size},
+            .rowPitch = readback.size,
+            .width    = 0,
+            .height   = 0,
+            .point    = {},
+        },
+        .on_ready      = std::move(readback.onReady),
+    });
+    return Status::Ok;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Flush & completion
+// -------------------------------------------------------------------------------------------------
+auto ReadbackQueue::flush(std::span<SyncPoint const> waits) noexcept -> std::expected<SyncPoint, Status> {
+    auto& impl = *impl_;
+    (void)poll();
+
+    // Everything reserved so far is in `pending`, so the ring head is
+    // exactly the end of this flush's range.
+    uint64_t ring_end = 0;
+    impl.flushing.clear();
+    {
+        std::scoped_lock lock{impl.mutex};
+        std::swap(impl.flushing, impl.pending);
+        ring_end = impl.ring.head();
+    }
+    if (impl.flushing.empty())
+        return SyncPoint{};
+
+    // Dropped readbacks still hold ring space; the next tracked flush's
+    // release point frees it.
+    impl.texture_transitions.clear();
+    impl.texture_restores.clear();
+    impl.buffer_transitions.clear();
+    impl.buffer_restores.clear();
+    try {
+        for (PendingReadback const& r : impl.flushing)
+            impl.add_barriers(r);
+    } catch (std::bad_alloc const&) {
+        return std::unexpected{Status::OutOfMemory};
+    }
+
+    auto list = impl.device->begin_command_list({.queue = impl.desc.queue});
+    if (!list)
+        return std::unexpected{list.error()};
+
+    list->barriers(impl.texture_transitions, impl.buffer_transitions);
+    for (PendingReadback const& r : impl.flushing) {
+        if (r.texture)
+            list->copy_texture_to_buffer(r.texture, impl.ring_buffer, {&r.region, 1});
+        else
+            list->copy_buffer(r.buffer, impl.ring_buffer, {&r.copy, 1});
+    }
+    list->barriers(impl.texture_restores, impl.buffer_restores);
+
+    if (Status s = list->end(); s != Status::Ok)
+        return std::unexpected{s};
+
+    // The flight record exists before the copies are submitted, so a
+    // submitted flush is always tracked under its own timeline value.
+    try {
+        impl.in_flight.push_back({UINT64_MAX, ring_end, 0});
+    } catch (std::bad_alloc const&) {
+        return std::unexpected{Status::OutOfMemory};
+    }
+
+    CommandListHandle const handle = list->handle();
+    auto point = impl.device->submit({&handle, 1}, waits);
+    if (!point) {
+        impl.in_flight.pop_back();
+        return std::unexpected{point.error()};
+    }
+
+    InFlight& flight = impl.in_flight.back();
+    flight.value = point->value;
+    try {
+        for (PendingReadback& r : impl.flushing) {
+            r.result.point = *point;
+            impl.completing.push_back(std::move(r));
+            ++flight.count;
+        }
+    } catch (std::bad_alloc const&) {
+        // The readbacks queued so far complete with this flush; the rest
+        // are dropped and their range is freed with it.
+    }
+    impl.flushing.clear();
+    return *point;
+}
+
+uint32_t ReadbackQueue::poll() noexcept {
+    auto& impl = *impl_;
+    if (impl.in_flight.empty())
+        return 0;
+    return impl.complete(impl.device->completed_value(impl.desc.queue));
+}
+
+Status ReadbackQueue::wait_idle() noexcept {
+    auto& impl = *impl_;
+    if (impl.in_flight.empty())
+        return Status::Ok;
+
+    uint64_t const last = impl.in_flight.back().value;
+    if (Status s = impl.device->wait(SyncPoint{impl.desc.queue, last}); s != Status::Ok)
+        return s;
+    impl.complete(last);
+    return Status::Ok;
+}
+
+uint64_t ReadbackQueue::ring_used() const noexcept {
+    return impl_->ring.used();
+}
+
+uint64_t ReadbackQueue::ring_capacity() const noexcept {
+    return impl_->ring.capacity();
+}
+
+} // namespace wren::rhi
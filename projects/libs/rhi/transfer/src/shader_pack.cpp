@@ -0,0 +1,194 @@
+#include <wren/rhi/transfer/shader_pack.hpp>
+
+#include <wren/foundation/memory/align.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace wren::rhi {
+
+namespace {
+
+constexpr uint32_t k_magic          = 0x4b505357;  // "WSPK"
+constexpr uint64_t k_code_alignment = 16;
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t reserved;
+};
+
+struct TableEntry {
+    uint32_t name_offset;
+    uint32_t name_size;  // without the terminator
+    uint64_t code_offset;
+    uint64_t code_size;
+};
+
+static_assert(sizeof(Header) == 16 && sizeof(TableEntry) == 24);
+
+[[nodiscard]] TableEntry table_entry(std::span<std::byte const> file, uint32_t index) noexcept {
+    TableEntry entry;
+    std::memcpy(&entry, file.data() + sizeof(Header) + std::size_t{index} * sizeof(TableEntry), sizeof entry);
+    return entry;
+}
+
+[[nodiscard]] std::string_view entry_name(std::span<std::byte const> file, TableEntry const& entry) noexcept {
+    return {reinterpret_cast<char const*>(file.data() + entry.name_offset), entry.name_size};
+}
+
+/// Every entry lies inside the file, is NUL-terminated where a name should
+/// be, carries word-aligned code, and the names are strictly ascending.
+[[nodiscard]] bool valid_table(std::span<std::byte const> file, uint32_t count) noexcept {
+    uint64_t const size = file.size();
+    if (sizeof(Header) + uint64_t{count} * sizeof(TableEntry) > size)
+        return false;
+
+    std::string_view previous;
+    for (uint32_t i = 0; i < count; ++i) {
+        TableEntry const e = table_entry(file, i);
+        if (uint64_t{e.name_offset} + e.name_size >= size || file[e.name_offset + e.name_size] != std::byte{0})
+            return false;
+        if (e.code_size == 0 || e.code_size % 4 != 0 || e.code_offset % 4 != 0 ||
+            e.code_offset > size || e.code_size > size - e.code_offset)
+            return false;
+        std::string_view const name = entry_name(file, e);
+        if (i > 0 && !(previous < name))
+            return false;
+        previous = name;
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// ShaderPack
+// -------------------------------------------------------------------------------------------------
+ShaderPack::ShaderPack(platform::mapped_file file, uint32_t count) noexcept
+    : file_{std::move(file)}, count_{count} {}
+
+auto ShaderPack::open(std::filesystem::path const& path) noexcept -> std::expected<ShaderPack, Status> {
+    auto file = platform::mapped_file::open(path);
+    if (!file)
+        return std::unexpected{Status::IoError};
+
+    auto const bytes = file->bytes();
+    Header     header{};
+    if (bytes.size() < sizeof header)
+        return std::unexpected{Status::InvalidArgument};
+    std::memcpy(&header, bytes.data(), sizeof header);
+    if (header.magic != k_magic || header.version != k_version || !valid_table(bytes, header.count))
+        return std::unexpected{Status::InvalidArgument};
+    return ShaderPack{std::move(*file), header.count};
+}
+
+ShaderPackEntry ShaderPack::entry(uint32_t index) const noexcept {
+    if (index >= count_)
+        return {};
+    auto const       file = file_.bytes();
+    TableEntry const e    = table_entry(file, index);
+    return ShaderPackEntry{
+        .name = entry_name(file, e),
+        .code = file.subspan(e.code_offset, e.code_size),
+    };
+}
+
+std::optional<uint32_t> ShaderPack::find(std::string_view name) const noexcept {
+    auto const file = file_.bytes();
+    uint32_t   lo = 0, hi = count_;
+    while (lo < hi) {
+        uint32_t const         mid     = lo + (hi - lo) / 2;
+        std::string_view const current = entry_name(file, table_entry(file, mid));
+        if (current == name)
+            return mid;
+        if (current < name)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return std::nullopt;
+}
+
+Status ShaderPack::create_modules(BackendDevice& device, std::span<ShaderModuleHandle> out) const noexcept {
+    if (out.size() != count_)
+        return Status::InvalidArgument;
+    try {
+        std::vector<ShaderModuleDesc> descs(count_);
+        for (uint32_t i = 0; i < count_; ++i) {
+            ShaderPackEntry const e = entry(i);
+            descs[i] = ShaderModuleDesc{
+                .code      = e.code.data(),
+                .codeSize  = e.code.size(),
+                .debugName = e.name.data(),  // NUL-terminated in the file
+            };
+        }
+        return device.create_shader_modules(descs, out);
+    } catch (std::bad_alloc const&) {
+        std::ranges::fill(out, ShaderModuleHandle{});
+        return Status::OutOfMemory;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Writing
+// -------------------------------------------------------------------------------------------------
+Status write_shader_pack(std::filesystem::path const& path, std::span<ShaderPackEntry const> entries) noexcept {
+    using foundation::memory::align_up;
+
+    if (entries.size() > UINT32_MAX)
+        return Status::InvalidArgument;
+    try {
+        std::vector<ShaderPackEntry const*> sorted;
+        sorted.reserve(entries.size());
+        for (ShaderPackEntry const& e : entries) {
+            if (e.code.empty() || e.code.size() % 4 != 0)
+                return Status::InvalidArgument;
+            sorted.push_back(&e);
+        }
+        std::ranges::sort(sorted, {}, &ShaderPackEntry::name);
+        if (std::ranges::adjacent_find(sorted, {}, &ShaderPackEntry::name) != sorted.end())
+            return Status::InvalidArgument;
+
+        auto const count = static_cast<uint32_t>(sorted.size());
+        uint64_t   names = sizeof(Header) + uint64_t{count} * sizeof(TableEntry);
+        uint64_t   code  = names;
+        for (ShaderPackEntry const* e : sorted)
+            code += e->name.size() + 1;
+        if (code > UINT32_MAX)
+            return Status::InvalidArgument;
+
+        std::vector<TableEntry> table;
+        table.reserve(count);
+        uint64_t end = align_up(code, k_code_alignment);
+        for (ShaderPackEntry const* e : sorted) {
+            table.push_back(TableEntry{
+                .name_offset = static_cast<uint32_t>(names),
+                .name_size   = static_cast<uint32_t>(e->name.size()),
+                .code_offset = end,
+                .code_size   = e->code.size(),
+            });
+            names += e->name.size() + 1;
+            end    = align_up(end + e->code.size(), k_code_alignment);
+        }
+
+        std::vector<std::byte> file(end);
+        Header const header{.magic = k_magic, .version = ShaderPack::k_version, .count = count, .reserved = 0};
+        std::memcpy(file.data(), &header, sizeof header);
+        if (count > 0)
+            std::memcpy(file.data() + sizeof header, table.data(), table.size() * sizeof(TableEntry));
+        for (uint32_t i = 0; i < count; ++i) {
+            std::ranges::copy(std::as_bytes(std::span{sorted[i]->name}), file.begin() + table[i].name_offset);
+            std::ranges::copy(sorted[i]->code, file.begin() + static_cast<std::ptrdiff_t>(table[i].code_offset));
+        }
+        return platform::write_file_atomic(path, file) ? Status::IoError : Status::Ok;
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+}
+
+} // namespace wren::rhi
@@ -0,0 +1,32 @@
+#pragma once
+
+// Internal header — not installed, not part of the public API.
+// Texel sizes shared by the queues' buffer-texture copies.
+
+#include <cstdint>
+
+#include <wren/rhi/api/enums.hpp>
+
+namespace wren::rhi {
+
+/// Bytes one texel takes in a buffer-texture copy. Depth formats copy their
+/// depth aspect alone, which Vulkan packs into 4 bytes for every format here.
+[[nodiscard]] inline constexpr uint32_t copy_texel_size(TextureFormat format) noexcept {
+    switch (format) {
+        case TextureFormat::RGBA16_Float: return 8;
+        case TextureFormat::RGBA32_Float: return 16;
+        case TextureFormat::RGBA8_UNorm:
+        case TextureFormat::BGRA8_UNorm:
+        case TextureFormat::RGBA8_sRGB:
+        case TextureFormat::BGRA8_sRGB:
+        case TextureFormat::RG16_Float:
+        case TextureFormat::R11G11B10_Float:
+        case TextureFormat::RGB10A2_UNorm:
+        case TextureFormat::D24S8:
+        case TextureFormat::D32:
+        case TextureFormat::D32S8:        return 4;
+    }
+    return 4;
+}
+
+} // namespace wren::rhi
@@ -0,0 +1,380 @@
+#include <wren/rhi/transfer/upload_queue.hpp>
+
+#include <wren/foundation/memory/ring_allocator.hpp>
+
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace wren::rhi {
+
+namespace {
+
+// Staging offsets are aligned to 16 bytes: a multiple of 4 and of every
+// TextureFormat's texel size, as buffer-to-image copies require.
+constexpr uint64_t k_staging_alignment = 16;
+
+struct PendingTexture {
+    TextureHandle texture;
+    uint32_t      first_region   = 0;
+    uint32_t      region_count   = 0;
+    TextureUsage  final_usage    = TextureUsage::None;
+    ShaderStage   final_stages   = ShaderStage::None;
+    TextureUsage  initial_usage  = TextureUsage::None;
+    ShaderStage   initial_stages = ShaderStage::None;
+};
+
+struct PendingBuffer {
+    BufferHandle buffer;
+    BufferCopy   copy;
+    BufferUsage  final_usage    = BufferUsage::None;
+    ShaderStage  final_stages   = ShaderStage::None;
+    BufferUsage  initial_usage  = BufferUsage::None;
+    ShaderStage  initial_stages = ShaderStage::None;
+};
+
+/// Queued uploads. Swapped wholesale between the enqueue side and flush().
+struct PendingUploads {
+    std::vector<PendingTexture>    textures;
+    std::vector<BufferTextureCopy> regions;   // bufferOffset rebased into the staging buffer
+    std::vector<PendingBuffer>     buffers;
+
+    [[nodiscard]] bool empty() const noexcept { return textures.empty() && buffers.empty(); }
+    void clear() noexcept {
+        textures.clear();
+        regions.clear();
+        buffers.clear();
+    }
+};
+
+/// A submitted flush: its staging range is free once the queue's timeline
+/// reaches @c value.
+struct InFlight {
+    uint64_t value    = 0;
+    uint64_t ring_end = 0;
+};
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Impl
+// -------------------------------------------------------------------------------------------------
+struct UploadQueue::Impl {
+    BackendDevice*                        device;
+    UploadQueueDesc                       desc;
+    BufferHandle                          staging;
+    std::byte*                            mapped;
+    foundation::memory::RingAllocator     ring;
+
+    std::mutex     mutex;     // guards `pending` and ring allocation
+    PendingUploads pending;
+
+    // Frame thread only.
+    PendingUploads              flushing;
+    std::vector<TextureBarrier> texture_transitions;  // initial state → TransferDst before the copies
+    std::vector<TextureBarrier> texture_releases;     // after the copies; returned as acquires
+    std::vector<BufferBarrier>  buffer_transitions;   // live buffers only
+    std::vector<BufferBarrier>  buffer_releases;
+    std::deque<InFlight>        in_flight;
+
+    Impl(BackendDevice& dev, UploadQueueDesc const& d, BufferHandle buffer, void* ptr) noexcept
+        : device{&dev}
+        , desc{d}
+        , staging{buffer}
+        , mapped{static_cast<std::byte*>(ptr)}
+        , ring{d.stagingBytes}
+    {}
+
+    /// Frees the staging space of every flush the GPU has finished.
+    void retire() noexcept {
+        if (in_flight.empty())
+            return;
+        uint64_t const completed = device->completed_value(desc.queue);
+        uint64_t release_to = 0;
+        while (!in_flight.empty() && in_flight.front().value <= completed) {
+            release_to = in_flight.front().ring_end;
+            in_flight.pop_front();
+        }
+        if (release_to != 0)
+            ring.release(release_to);
+    }
+
+    /// Reserves @p size staging bytes and copies @p data into them.
+    /// Caller holds `mutex`.
+    [[nodiscard]] std::optional<uint64_t> stage(std::span<std::byte const> data) noexcept {
+        auto const alloc = ring.allocate(data.size(), k_staging_alignment);
+        if (!alloc)
+            return std::nullopt;
+        std::memcpy(mapped + alloc->offset, data.data(), data.size());
+        return alloc->offset;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+// Lifecycle
+// -------------------------------------------------------------------------------------------------
+auto UploadQueue::create(BackendDevice& device, UploadQueueDesc const& desc) noexcept
+    -> std::expected<UploadQueue, Status>
+{
+    if (desc.stagingBytes == 0 || desc.stagingBytes % k_staging_alignment != 0)
+        return std::unexpected{Status::InvalidArgument};
+
+    auto buffer = device.create_buffer(BufferDesc{
+        .size      = desc.stagingBytes,
+        .usage     = BufferUsage::TransferSrc,
+        .memory    = MemoryUsage::Upload,
+        .debugName = "wren.upload_queue.staging",
+    });
+    if (!buffer)
+        return std::unexpected{buffer.error()};
+
+    void* mapped = device.map_buffer(*buffer);
+    if (!mapped) {
+        device.destroy_buffer(*buffer);
+        return std::unexpected{Status::InternalError};
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    std::unique_ptr<Impl> impl{new (std::nothrow) Impl{device, desc, *buffer, mapped}};
+    if (!impl) {
+        device.destroy_buffer(*buffer);
+        return std::unexpected{Status::OutOfMemory};
+    }
+    return UploadQueue{std::move(impl)};
+}
+
+UploadQueue::UploadQueue(std::unique_ptr<Impl> impl) noexcept
+    : impl_{std::move(impl)}
+{}
+
+UploadQueue::UploadQueue(UploadQueue&&) noexcept            = default;
+UploadQueue& UploadQueue::operator=(UploadQueue&&) noexcept = default;
+
+UploadQueue::~UploadQueue() {
+    if (!impl_)
+        return;
+    // The staging buffer may only go once the GPU has read it.
+    (void)wait_idle();
+    impl_->device->destroy_buffer(impl_->staging);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Enqueue
+// -------------------------------------------------------------------------------------------------
+Status UploadQueue::enqueue(TextureUpload const& upload) noexcept {
+    if (!upload.texture || upload.data.empty() || upload.regions.empty())
+        return Status::InvalidArgument;
+    if (upload.initialUsage != TextureUsage::None && impl_->desc.queue != impl_->desc.consumer)
+        return Status::InvalidArgument;
+    for (BufferTextureCopy const& r : upload.regions) {
+        if (r.bufferOffset >= upload.data.size())
+            return Status::InvalidArgument;
+    }
+
+    auto& impl = *impl_;
+    std::scoped_lock lock{impl.mutex};
+    auto& pending = impl.pending;
+    try {
+        pending.textures.reserve(pending.textures.size() + 1);
+        pending.regions.reserve(pending.regions.size() + upload.regions.size());
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+
+    auto const offset = impl.stage(upload.data);
+    if (!offset)
+        return Status::OutOfMemory;
+
+    pending.textures.push_back(PendingTexture{
+        .texture        = upload.texture,
+        .first_region   = static_cast<uint32_t>(pending.regions.size()),
+        .region_count   = static_cast<uint32_t>(upload.regions.size()),
+        .final_usage    = upload.finalUsage,
+        .final_stages   = upload.finalStages,
+        .initial_usage  = upload.initialUsage,
+        .initial_stages = upload.initialStages,
+    });
+    for (BufferTextureCopy region : upload.regions) {
+        region.bufferOffset += *offset;
+        pending.regions.push_back(region);
+    }
+    return Status::Ok;
+}
+
+Status UploadQueue::enqueue(BufferUpload const& upload) noexcept {
+    if (!upload.buffer || upload.data.empty())
+        return Status::InvalidArgument;
+    if (upload.initialUsage != BufferUsage::None && impl_->desc.queue != impl_->desc.consumer)
+        return Status::InvalidArgument;
+
+    auto& impl = *impl_;
+    std::scoped_lock lock{impl.mutex};
+    auto& pending = impl.pending;
+    try {
+        pending.buffers.reserve(pending.buffers.size() + 1);
+    } catch (std::bad_alloc const&) {
+        return Status::OutOfMemory;
+    }
+
+    auto const offset = impl.stage(upload.data);
+    if (!offset)
+        return Status::OutOfMemory;
+
+    pending.buffers.push_back(PendingBuffer{
+        .buffer         = upload.buffer,
+        .copy           = {*offset, upload.offset, upload.data.size()},
+        .final_usage    = upload.finalUsage,
+        .final_stages   = upload.finalStages,
+        .initial_usage  = upload.initialUsage,
+        .initial_stages = upload.initialStages,
+    });
+    return Status::Ok;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Flush
+// -------------------------------------------------------------------------------------------------
+auto UploadQueue::flush(std::span<SyncPoint const> waits) noexcept -> std::expected<UploadBatch, Status> {
+    auto& impl = *impl_;
+    impl.retire();
+
+    // Everything staged so far is in `pending`, so the ring head is exactly
+    // the end of this flush's staging range.
+    uint64_t ring_end = 0;
+    impl.flushing.clear();
+    {
+        std::scoped_lock lock{impl.mutex};
+        std::swap(impl.flushing, impl.pending);
+        ring_end = impl.ring.head();
+    }
+
+    impl.texture_transitions.clear();
+    impl.texture_releases.clear();
+    impl.buffer_transitions.clear();
+    impl.buffer_releases.clear();
+
+    auto const& work = impl.flushing;
+    if (work.empty())
+        return UploadBatch{};
+
+    // Dropped uploads still hold staging space; the next flush's release
+    // point frees it.
+    try {
+        impl.texture_transitions.reserve(work.textures.size());
+        impl.texture_releases.reserve(work.textures.size());
+        impl.buffer_transitions.reserve(work.buffers.size());
+        impl.buffer_releases.reserve(work.buffers.size());
+    } catch (std::bad_alloc const&) {
+        return std::unexpected{Status::OutOfMemory};
+    }
+
+    auto list = impl.device->begin_command_list({.queue = impl.desc.queue});
+    if (!list)
+        return std::unexpected{list.error()};
+
+    QueueType const queue    = impl.desc.queue;
+    QueueType const consumer = impl.desc.consumer;
+
+    for (PendingTexture const& t : work.textures) {
+        impl.texture_transitions.push_back(TextureBarrier{
+            .texture   = t.texture,
+            .oldUsage  = t.initial_usage,
+            .newUsage  = TextureUsage::TransferDst,
+            .srcStages = t.initial_stages,
+            .dstStages = ShaderStage::None,
+            .srcQueue  = queue,
+            .dstQueue  = queue,
+        });
+        impl.texture_releases.push_back(TextureBarrier{
+            .texture   = t.texture,
+            .oldUsage  = TextureUsage::TransferDst,
+            .newUsage  = t.final_usage,
+            .srcStages = ShaderStage::None,
+            .dstStages = t.final_stages,
+            .srcQueue  = queue,
+            .dstQueue  = consumer,
+        });
+    }
+    for (PendingBuffer const& b : work.buffers) {
+        if (b.initial_usage != BufferUsage::None &&
+            (impl.buffer_transitions.empty() || impl.buffer_transitions.back().buffer != b.buffer)) {
+            impl.buffer_transitions.push_back(BufferBarrier{
+                .buffer    = b.buffer,
+                .oldUsage  = b.initial_usage,
+                .newUsage  = BufferUsage::TransferDst,
+                .srcStages = b.initial_stages,
+                .dstStages = ShaderStage::None,
+                .srcQueue  = queue,
+                .dstQueue  = queue,
+            });
+        }
+        // Several uploads into one buffer share its release barrier.
+        if (!impl.buffer_releases.empty() && impl.buffer_releases.back().buffer == b.buffer &&
+            impl.buffer_releases.back().newUsage == b.final_usage)
+            continue;
+        impl.buffer_releases.push_back(BufferBarrier{
+            .buffer    = b.buffer,
+            .oldUsage  = BufferUsage::TransferDst,
+            .newUsage  = b.final_usage,
+            .srcStages = ShaderStage::None,
+            .dstStages = b.final_stages,
+            .srcQueue  = queue,
+            .dstQueue  = consumer,
+        });
+    }
+
+    list->barriers(impl.texture_transitions, impl.buffer_transitions);
+    for (PendingTexture const& t : work.textures) {
+        list->copy_buffer_to_texture(impl.staging, t.texture,
+                                     std::span{work.regions}.subspan(t.first_region, t.region_count));
+    }
+    for (PendingBuffer const& b : work.buffers)
+        list->copy_buffer(impl.staging, b.buffer, {&b.copy, 1});
+    list->barriers(impl.texture_releases, impl.buffer_releases);
+
+    if (Status s = list->end(); s != Status::Ok)
+        return std::unexpected{s};
+
+    CommandListHandle const handle = list->handle();
+    auto point = impl.device->submit({&handle, 1}, waits);
+    if (!point)
+        return std::unexpected{point.error()};
+
+    try {
+        impl.in_flight.push_back({point->value, ring_end});
+    } catch (std::bad_alloc const&) {
+        // Untracked, the range is freed by the next flush that is tracked.
+    }
+
+    return UploadBatch{
+        .ready           = *point,
+        .textureAcquires = impl.texture_releases,
+        .bufferAcquires  = impl.buffer_releases,
+    };
+}
+
+Status UploadQueue::wait_idle() noexcept {
+    auto& impl = *impl_;
+    if (impl.in_flight.empty())
+        return Status::Ok;
+
+    InFlight const last = impl.in_flight.back();
+    if (Status s = impl.device->wait(SyncPoint{impl.desc.queue, last.value}); s != Status::Ok)
+        return s;
+    impl.in_flight.clear();
+    impl.ring.release(last.ring_end);
+    return Status::Ok;
+}
+
+uint64_t UploadQueue::staging_used() const noexcept {
+    return impl_->ring.used();
+}
+
+uint64_t UploadQueue::staging_capacity() const noexcept {
+    return impl_->ring.capacity();
+}
+
+} // namespace wren::rhi
@@ -0,0 +1,653 @@
+#include <wren/rhi/transfer/virtual_texture.hpp>
+
+#include "texel.hpp"
+
+#include <wren/rhi/transfer/readback_queue.hpp>
+#include <wren/rhi/transfer/upload_queue.hpp>
+
+#include <wren/foundation/memory/align.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace wren::rhi {
+
+namespace {
+
+constexpr uint32_t k_no_slot  = UINT32_MAX;
+constexpr uint32_t k_no_entry = UINT32_MAX;
+
+// Feedback readbacks in flight before request_feedback() starts skipping
+// frames; enough to cover the usual frames-in-flight latency.
+constexpr uint64_t k_feedback_readbacks = 3;
+
+/// State of one page outside the mip tail, indexed like the feedback buffer.
+struct Page {
+    uint32_t slot      = k_no_slot;  // heap slot while resident
+    uint32_t requested = 0;          // latest frame stamp that asked for it
+    bool     queued    = false;      // in Impl::wanted
+};
+
+/// One page of heap memory. Resident slots form the LRU list, most
+/// recently requested first.
+struct Slot {
+    uint32_t entry = k_no_entry;
+    uint32_t prev  = k_no_slot;
+    uint32_t next  = k_no_slot;
+};
+
+/// A page that update() binds, and the page whose slot it takes over.
+struct Placement {
+    uint32_t entry   = 0;
+    uint32_t slot    = 0;
+    uint32_t evicted = k_no_entry;
+};
+
+struct PageCoord {
+    uint32_t mip = 0;
+    uint32_t x   = 0;
+    uint32_t y   = 0;
+};
+
+[[nodiscard]] constexpr uint32_t mip_extent(uint32_t extent, uint32_t mip) noexcept {
+    return std::max(extent >> mip, 1u);
+}
+
+[[nodiscard]] constexpr uint32_t div_up(uint32_t value, uint32_t divisor) noexcept {
+    return (value + divisor - 1) / divisor;
+}
+
+} // anonymous namespace
+
+// -------------------------------------------------------------------------------------------------
+// Impl
+// -------------------------------------------------------------------------------------------------
+struct VirtualTexture::Impl {
+    BackendDevice*       device;
+    VirtualTextureDesc   desc;
+    VirtualTextureLayout layout;
+    uint32_t             texel;
+    TextureHandle        texture;
+    HeapHandle           heap;
+    BufferHandle         feedback;
+    BufferHandle         residency;
+
+    std::vector<Page>     pages;
+    std::vector<Slot>     slots;
+    std::vector<uint32_t> free_slots;
+    uint32_t              lru_head = k_no_slot;
+    uint32_t              lru_tail = k_no_slot;
+    std::vector<uint32_t> wanted;          // entries requested and not resident
+    std::vector<uint32_t> residency_data;  // mirror of `residency`
+    std::vector<bool>     tail_loaded;     // per mip-tail level
+    uint32_t              stamp   = 0;
+    bool                  started = false;  // tail bound, buffers initialised
+    VirtualTextureStats   stats;
+
+    // update() scratch.
+    std::vector<Placement>         placements;
+    std::vector<SparsePageBind>    binds;
+    std::vector<BufferTextureCopy> regions;
+    std::vector<std::byte>         texels;
+
+    UploadQueue uploads;
+    // Last, so it is destroyed first: its callbacks use the members above.
+    ReadbackQueue readbacks;
+
+    Impl(BackendDevice& dev, VirtualTextureDesc&& d, VirtualTextureLayout const& l,
+         UploadQueue&& up, ReadbackQueue&& rb) noexcept
+        : device{&dev}
+        , desc{std::move(d)}
+        , layout{l}
+        , texel{copy_texel_size(desc.format)}
+        , uploads{std::move(up)}
+        , readbacks{std::move(rb)}
+    {}
+
+    [[nodiscard]] uint32_t tail_first() const noexcept { return layout.page.mipTailFirst; }
+
+    [[nodiscard]] uint32_t entry(uint32_t mip, uint32_t x, uint32_t y) const noexcept {
+        return layout.firstEntry[mip] + y * layout.pagesX[mip] + x;
+    }
+
+    [[nodiscard]] PageCoord locate(uint32_t e) const noexcept {
+        uint32_t mip = 0;
+        while (mip + 1 < tail_first() && e >= layout.firstEntry[mip + 1])
+            ++mip;
+        uint32_t const local = e - layout.firstEntry[mip];
+        return {mip, local % layout.pagesX[mip], local / layout.pagesX[mip]};
+    }
+
+    [[nodiscard]] bool stale(uint32_t e) const noexcept {
+        return stamp - pages[e].requested > desc.retainFrames;
+    }
+
+    // --- LRU -------------------------------------------------------
+
+    void unlink(uint32_t s) noexcept {
+        Slot& slot = slots[s];
+        (slot.prev != k_no_slot ? slots[slot.prev].next : lru_head) = slot.next;
+        (slot.next != k_no_slot ? slots[slot.next].prev : lru_tail) = slot.prev;
+        slot.prev = slot.next = k_no_slot;
+    }
+
+    void push_front(uint32_t s) noexcept {
+        slots[s].next = lru_head;
+        if (lru_head != k_no_slot)
+            slots[lru_head].prev = s;
+        lru_head = s;
+        if (lru_tail == k_no_slot)
+            lru_tail = s;
+    }
+
+    // --- Feedback --------------------------------------------------
+
+    /// Records one request for page @p e and its coarser parents. Resident
+    /// pages move to the front of the LRU list, missing ones into `wanted`.
+    void request(uint32_t e, uint32_t value) noexcept {
+        PageCoord c = locate(e);
+        for (;;) {
+            Page& page = pages[e];
+            if (page.requested >= value)
+                return;  // so are its parents
+            page.requested = value;
+            if (page.slot != k_no_slot) {
+                unlink(page.slot);
+                push_front(page.slot);
+            } else if (!page.queued) {
+                try {
+                    wanted.push_back(e);
+                    page.queued = true;
+                } catch (std::bad_alloc const&) {
+                    // Requested again by later feedback.
+                }
+            }
+            if (++c.mip >= tail_first())
+                return;
+            c.x = std::min(c.x >> 1, layout.pagesX[c.mip] - 1);
+            c.y = std::min(c.y >> 1, layout.pagesY[c.mip] - 1);
+            e   = entry(c.mip, c.x, c.y);
+        }
+    }
+
+    void on_feedback(std::span<std::byte const> data) noexcept {
+        uint32_t const count = static_cast<uint32_t>(data.size() / sizeof(uint32_t));
+        for (uint32_t e = 0; e < count; ++e) {
+            uint32_t value = 0;
+            std::memcpy(&value, data.data() + e * sizeof(uint32_t), sizeof(uint32_t));
+            if (value != 0)
+                request(e, std::min(value, stamp));
+        }
+    }
+
+    // --- Residency -------------------------------------------------
+
+    /// Rebuilds `residency_data`; true when it changed.
+    bool refresh_residency() noexcept {
+        bool changed = false;
+        uint32_t const width = tail_first() > 0 ? layout.pagesX[0] : 1;
+        for (uint32_t i = 0; i < residency_data.size(); ++i) {
+            uint32_t const x0 = i % width;
+            uint32_t const y0 = i / width;
+            uint32_t finest = tail_first();
+            for (uint32_t mip = tail_first(); mip-- > 0;) {
+                uint32_t const x = std::min(x0 >> mip, layout.pagesX[mip] - 1);
+                uint32_t const y = std::min(y0 >> mip, layout.pagesY[mip] - 1);
+                if (pages[entry(mip, x, y)].slot == k_no_slot)
+                    break;
+                finest = mip;
+            }
+            changed |= residency_data[i] != finest;
+            residency_data[i] = finest;
+        }
+        return changed;
+    }
+
+    // --- Update ----------------------------------------------------
+
+    /// Appends the texels of @p request to `texels` and a copy of them to
+    /// `regions`. False when the source has nothing yet.
+    [[nodiscard]] bool fetch(PageRequest const& request) {
+        std::span<std::byte const> const data = desc.source(request);
+        uint64_t const size = uint64_t{request.width} * request.height * texel;
+        if (data.size() != size)
+            return false;
+        regions.push_back(BufferTextureCopy{
+            .bufferOffset      = texels.size(),
+            .bufferRowLength   = request.width,
+            .bufferImageHeight = request.height,
+            .mipLevel          = request.mipLevel,
+            .baseArrayLayer    = 0,
+            .layerCount        = 1,
+            .x                 = static_cast<int32_t>(request.x),
+            .y                 = static_cast<int32_t>(request.y),
+            .z                 = 0,
+            .width             = request.width,
+            .height            = request.height,
+            .depth             = 1,
+        });
+        texels.insert(texels.end(), data.begin(), data.end());
+        return true;
+    }
+
+    /// Queues the mip-tail levels not loaded yet; returns the mask of levels
+    /// fetched. The first time, a level the source cannot provide is
+    /// uploaded as zeros so that the whole texture leaves its undefined state.
+    [[nodiscard]] uint32_t fetch_tail() {
+        uint32_t fetched = 0;
+        for (uint32_t mip = tail_first(); mip < desc.mipLevels; ++mip) {
+            uint32_t const level = mip - tail_first();
+            if (tail_loaded[level])
+                continue;
+            PageRequest const request{
+                .mipLevel = mip,
+                .x        = 0,
+                .y        = 0,
+                .width    = mip_extent(desc.width, mip),
+                .height   = mip_extent(desc.height, mip),
+            };
+            if (fetch(request)) {
+                fetched |= 1u << level;
+            } else if (!started) {
+                regions.push_back(BufferTextureCopy{
+                    .bufferOffset      = texels.size(),
+                    .bufferRowLength   = request.width,
+                    .bufferImageHeight = request.height,
+                    .mipLevel          = mip,
+                    .width             = request.width,
+                    .height            = request.height,
+                });
+                texels.resize(texels.size() + uint64_t{request.width} * request.height * texel);
+            }
+        }
+        return fetched;
+    }
+
+    /// Picks the slot for the next placement: a free one, else the least
+    /// recently requested page once it is stale. @p free_used and
+    /// @p cursor walk both without changing them until the bind succeeds.
+    [[nodiscard]] bool place(uint32_t e, uint32_t& free_used, uint32_t& cursor) {
+        if (free_used < free_slots.size()) {
+            placements.push_back({e, free_slots[free_slots.size() - 1 - free_used], k_no_entry});
+            ++free_used;
+            return true;
+        }
+        if (cursor == k_no_slot || !stale(slots[cursor].entry))
+            return false;
+        placements.push_back({e, cursor, slots[cursor].entry});
+        cursor = slots[cursor].prev;
+        return true;
+    }
+
+    /// Plans this update's page loads into `placements`, `regions` and
+    /// `texels`, coarse levels first.
+    void plan() {
+        std::erase_if(wanted, [&](uint32_t e) {
+            bool const drop = pages[e].slot != k_no_slot || stale(e);
+            pages[e].queued = !drop;
+            return drop;
+        });
+        std::ranges::sort(wanted, [&](uint32_t a, uint32_t b) {
+            if (a == b)
+                return false;
+            PageCoord const ca = locate(a);
+            PageCoord const cb = locate(b);
+            if (ca.mip != cb.mip)
+                return ca.mip > cb.mip;
+            return pages[a].requested > pages[b].requested;
+        });
+
+        uint32_t free_used = 0;
+        uint32_t cursor    = lru_tail;
+        for (uint32_t e : wanted) {
+            if (placements.size() >= desc.maxUploadsPerFrame)
+                break;
+            PageCoord const c = locate(e);
+            uint32_t const  x = c.x * layout.page.pageWidth;
+            uint32_t const  y = c.y * layout.page.pageHeight;
+            PageRequest const request{
+                .mipLevel = c.mip,
+                .x        = x,
+                .y        = y,
+                .width    = std::min(layout.page.pageWidth, mip_extent(desc.width, c.mip) - x),
+                .height   = std::min(layout.page.pageHeight, mip_extent(desc.height, c.mip) - y),
+            };
+            // Place first so a full budget does not call the source.
+            uint32_t const free_before   = free_used;
+            uint32_t const cursor_before = cursor;
+            if (!place(e, free_used, cursor))
+                break;
+            if (!fetch(request)) {
+                placements.pop_back();
+                free_used = free_before;
+                cursor    = cursor_before;
+            }
+        }
+    }
+
+    /// Applies `placements` once their binds are queued.
+    void commit() noexcept {
+        for (Placement const& p : placements) {
+            if (p.evicted != k_no_entry) {
+                pages[p.evicted].slot = k_no_slot;
+                unlink(p.slot);
+                ++stats.evictedPages;
+            } else {
+                free_slots.pop_back();  // place() took them from the back, in order
+            }
+            slots[p.slot].entry = p.entry;
+            push_front(p.slot);
+            pages[p.entry].slot   = p.slot;
+            pages[p.entry].queued = false;
+        }
+        std::erase_if(wanted, [&](uint32_t e) { return pages[e].slot != k_no_slot; });
+        stats.boundPages = static_cast<uint32_t>(placements.size());
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+// Lifecycle
+// -------------------------------------------------------------------------------------------------
+auto VirtualTexture::create(BackendDevice& device, VirtualTextureDesc&& desc) noexcept
+    -> std::expected<VirtualTexture, Status>
+{
+    if (!has_all(device.capabilities().features, Feature::SparseResources))
+        return std::unexpected{Status::MissingRequiredFeature};
+    if (!desc.source || desc.width == 0 || desc.height == 0 || desc.budgetPages == 0 ||
+        desc.mipLevels == 0 || desc.mipLevels > VirtualTextureLayout::k_max_mips)
+        return std::unexpected{Status::InvalidArgument};
+
+    auto texture = device.create_texture(TextureDesc{
+        .dimension = TextureDimension::Tex2D,
+        .format    = desc.format,
+        .usage     = TextureUsage::Sampled | TextureUsage::TransferDst,
+        .width     = desc.width,
+        .height    = desc.height,
+        .mipLevels = desc.mipLevels,
+        .sparse    = true,
+        .debugName = desc.debugName,
+    });
+    if (!texture)
+        return std::unexpected{texture.error()};
+
+    VirtualTextureLayout layout;
+    if (auto info = device.sparse_texture_info(*texture))
+        layout.page = *info;
+    else {
+        device.destroy_texture(*texture);
+        return std::unexpected{info.error()};
+    }
+    // The mip tail is the fallback every lookup ends in; without one the
+    // coarsest level could be evicted.
+    if (layout.page.mipTailFirst >= desc.mipLevels) {
+        device.destroy_texture(*texture);
+        return std::unexpected{Status::InvalidArgument};
+    }
+    for (uint32_t mip = 0; mip < layout.page.mipTailFirst; ++mip) {
+        layout.pagesX[mip]     = div_up(mip_extent(desc.width, mip), layout.page.pageWidth);
+        layout.pagesY[mip]     = div_up(mip_extent(desc.height, mip), layout.page.pageHeight);
+        layout.firstEntry[mip] = layout.entryCount;
+        layout.entryCount     += layout.pagesX[mip] * layout.pagesY[mip];
+    }
+    uint64_t const feedback_bytes = uint64_t{std::max(layout.entryCount, 1u)} * sizeof(uint32_t);
+    uint64_t const residency_bytes =
+        uint64_t{layout.page.mipTailFirst > 0 ? layout.pagesX[0] * layout.pagesY[0] : 1} * sizeof(uint32_t);
+
+    HeapHandle                  heap;
+    std::array<BufferHandle, 2> buffers{};
+    auto const fail = [&](Status s) {
+        device.destroy_buffers(buffers);
+        if (heap)
+            device.destroy_memory_heap(heap);
+        device.destroy_texture(*texture);
+        return std::unexpected{s};
+    };
+
+    auto created_heap = device.create_memory_heap(MemoryHeapDesc{
+        .size          = uint64_t{desc.budgetPages} * layout.page.pageBytes + layout.page.mipTailBytes,
+        .compatibility = layout.page.compatibility,
+        .debugName     = desc.debugName,
+    });
+    if (!created_heap)
+        return fail(created_heap.error());
+    heap = *created_heap;
+
+    BufferDesc const buffer_descs[] = {
+        {.size = feedback_bytes, .usage = BufferUsage::Storage | BufferUsage::TransferSrc | BufferUsage::TransferDst,
+         .memory = MemoryUsage::GpuOnly, .debugName = "wren.virtual_texture.feedback"},
+        {.size = residency_bytes, .usage = BufferUsage::Storage | BufferUsage::TransferDst,
+         .memory = MemoryUsage::GpuOnly, .debugName = "wren.virtual_texture.residency"},
+    };
+    if (Status s = device.create_buffers(buffer_descs, buffers); s != Status::Ok)
+        return fail(s);
+
+    auto uploads = UploadQueue::create(device, {
+        .stagingBytes = foundation::memory::align_up(desc.stagingBytes, 16),
+        .queue        = QueueType::Graphics,
+        .consumer     = QueueType::Graphics,
+    });
+    if (!uploads)
+        return fail(uploads.error());
+    auto readbacks = ReadbackQueue::create(device, {
+        .ringBytes = foundation::memory::align_up(feedback_bytes, k_readback_row_alignment) * k_feedback_readbacks,
+        .queue     = QueueType::Graphics,
+    });
+    if (!readbacks)
+        return fail(readbacks.error());
+
+    uint32_t const budget = desc.budgetPages;
+    uint32_t const tail_levels = desc.mipLevels - layout.page.mipTailFirst;
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    std::unique_ptr<Impl> impl{new (std::nothrow) Impl{device, std::move(desc), layout,
+                                                       std::move(*uploads), std::move(*readbacks)}};
+    if (!impl)
+        return fail(Status::OutOfMemory);
+    impl->texture   = *texture;
+    impl->heap      = heap;
+    impl->feedback  = buffers[0];
+    impl->residency = buffers[1];
+    try {
+        impl->pages.resize(layout.entryCount);
+        impl->slots.resize(budget);
+        impl->free_slots.resize(budget);
+        impl->residency_data.assign(residency_bytes / sizeof(uint32_t), layout.page.mipTailFirst);
+        impl->tail_loaded.assign(tail_levels, false);
+    } catch (std::bad_alloc const&) {
+        impl.reset();  // waits for nothing: no work was queued
+        return fail(Status::OutOfMemory);
+    }
+    // Lowest slots first, taken from the back.
+    for (uint32_t s = 0; s < budget; ++s)
+        impl->free_slots[s] = budget - 1 - s;
+    return VirtualTexture{std::move(impl)};
+}
+
+VirtualTexture::VirtualTexture(std::unique_ptr<Impl> impl) noexcept
+    : impl_{std::move(impl)}
+{}
+
+VirtualTexture::VirtualTexture(VirtualTexture&&) noexcept            = default;
+VirtualTexture& VirtualTexture::operator=(VirtualTexture&&) noexcept = default;
+
+VirtualTexture::~VirtualTexture() {
+    if (!impl_)
+        return;
+    auto& impl = *impl_;
+    (void)impl.readbacks.wait_idle();
+    (void)impl.uploads.wait_idle();
+    BufferHandle const buffers[] = {impl.feedback, impl.residency};
+    impl.device->destroy_buffers(buffers);
+    impl.device->destroy_texture(impl.texture);
+    impl.device->destroy_memory_heap(impl.heap);
+}
+
+// -------------------------------------------------------------------------------------------------
+// Streaming
+// -------------------------------------------------------------------------------------------------
+auto VirtualTexture::update(std::span<SyncPoint const> waits) noexcept -> std::expected<SyncPoint, Status> {
+    auto& impl = *impl_;
+    (void)impl.readbacks.poll();
+    ++impl.stamp;
+
+    impl.stats.evictedPages = 0;
+    impl.stats.boundPages   = 0;
+    impl.placements.clear();
+    impl.binds.clear();
+    impl.regions.clear();
+    impl.texels.clear();
+
+    uint32_t tail_fetched = 0;
+    try {
+        tail_fetched = impl.fetch_tail();
+        impl.plan();
+        impl.binds.reserve(impl.placements.size() * 2 + 1);
+    } catch (std::bad_alloc const&) {
+        return std::unexpected{Status::OutOfMemory};
+    }
+
+    SparseTextureInfo const& page = impl.layout.page;
+    if (!impl.started) {
+        impl.binds.push_back(SparsePageBind{
+            .texture    = impl.texture,
+            .mipTail    = true,
+            .heap       = impl.heap,
+            .heapOffset = uint64_t{impl.desc.budgetPages} * page.pageBytes,
+        });
+    }
+    for (Placement const& p : impl.placements) {
+        PageCoord const c = impl.locate(p.entry);
+        if (p.evicted != k_no_entry) {
+            PageCoord const old = impl.locate(p.evicted);
+            impl.binds.push_back(SparsePageBind{
+                .texture  = impl.texture,
+                .mipLevel = old.mip,
+                .x        = old.x,
+                .y        = old.y,
+                .heap     = {},
+            });
+        }
+        impl.binds.push_back(SparsePageBind{
+            .texture    = impl.texture,
+            .mipLevel   = c.mip,
+            .x          = c.x,
+            .y          = c.y,
+            .heap       = impl.heap,
+            .heapOffset = uint64_t{p.slot} * page.pageBytes,
+        });
+    }
+
+    // Staged before binding: when the staging budget is short nothing
+    // changes and the pages are tried again next update.
+    ShaderStage const stages = impl.desc.stages;
+    if (!impl.regions.empty()) {
+        Status const s = impl.uploads.enqueue(TextureUpload{
+            .texture       = impl.texture,
+            .data          = impl.texels,
+            .regions       = impl.regions,
+            .finalUsage    = TextureUsage::Sampled,
+            .finalStages   = stages,
+            .initialUsage  = impl.started ? TextureUsage::Sampled : TextureUsage::None,
+            .initialStages = impl.started ? stages : ShaderStage::None,
+        });
+        if (s == Status::OutOfMemory && impl.started)
+            return SyncPoint{};
+        if (s != Status::Ok)
+            return std::unexpected{s};
+    }
+
+    for (uint32_t level = 0; level < impl.tail_loaded.size(); ++level) {
+        if (tail_fetched & (1u << level))
+            impl.tail_loaded[level] = true;
+    }
+
+    SyncPoint bound;
+    if (!impl.binds.empty()) {
+        auto point = impl.device->bind_sparse(impl.binds, waits);
+        if (!point)
+            return std::unexpected{point.error()};
+        bound = *point;
+    }
+    impl.commit();
+
+    if (!impl.started) {
+        std::vector<std::byte> zeros;
+        try {
+            zeros.resize(impl.pages.empty() ? sizeof(uint32_t) : impl.pages.size() * sizeof(uint32_t));
+        } catch (std::bad_alloc const&) {
+            return std::unexpected{Status::OutOfMemory};
+        }
+        Status const s = impl.uploads.enqueue(BufferUpload{
+            .buffer      = impl.feedback,
+            .data        = zeros,
+            .finalUsage  = BufferUsage::Storage,
+            .finalStages = stages,
+        });
+        if (s != Status::Ok)
+            return std::unexpected{s};
+    }
+    if (impl.refresh_residency() || !impl.started) {
+        Status const s = impl.uploads.enqueue(BufferUpload{
+            .buffer        = impl.residency,
+            .data          = std::as_bytes(std::span{impl.residency_data}),
+            .finalUsage    = BufferUsage::Storage,
+            .finalStages   = stages,
+            .initialUsage  = impl.started ? BufferUsage::Storage : BufferUsage::None,
+            .initialStages = impl.started ? stages : ShaderStage::None,
+        });
+        if (s != Status::Ok)
+            return std::unexpected{s};
+    }
+    impl.started = true;
+
+    impl.stats.residentPages  = impl.desc.budgetPages - static_cast<uint32_t>(impl.free_slots.size());
+    impl.stats.requestedPages = static_cast<uint32_t>(impl.wanted.size());
+
+    // The copies into newly bound pages wait for the bind.
+    auto batch = impl.uploads.flush(bound.value != 0 ? std::span{&bound, 1} : std::span<SyncPoint>{});
+    if (!batch)
+        return std::unexpected{batch.error()};
+    return batch->ready;
+}
+
+Status VirtualTexture::request_feedback(std::span<SyncPoint const> waits) noexcept {
+    auto& impl = *impl_;
+    if (!impl.started || impl.pages.empty())
+        return Status::Ok;
+
+    Impl* const self = &impl;
+    Status const s = impl.readbacks.enqueue(BufferReadback{
+        .buffer  = impl.feedback,
+        .offset  = 0,
+        .size    = impl.pages.size() * sizeof(uint32_t),
+        .usage   = BufferUsage::Storage,
+        .stages  = impl.desc.stages,
+        .onReady = [self](ReadbackResult const& r) { self->on_feedback(r.data); },
+    });
+    if (s == Status::OutOfMemory)
+        return Status::Ok;
+    if (s != Status::Ok)
+        return s;
+    auto point = impl.readbacks.flush(waits);
+    return point ? Status::Ok : point.error();
+}
+
+// -------------------------------------------------------------------------------------------------
+// Queries
+// -------------------------------------------------------------------------------------------------
+TextureHandle VirtualTexture::texture() const noexcept { return impl_->texture; }
+
+BufferHandle VirtualTexture::feedback_buffer() const noexcept { return impl_->feedback; }
+
+BufferHandle VirtualTexture::residency_buffer() const noexcept { return impl_->residency; }
+
+uint32_t VirtualTexture::frame_stamp() const noexcept { return impl_->stamp; }
+
+VirtualTextureLayout const& VirtualTexture::feedback_layout() const noexcept { return impl_->layout; }
+
+VirtualTextureStats VirtualTexture::stats() const noexcept { return impl_->stats; }
+
+} // namespace wren::rhi
@@ -0,0 +1,63 @@
+#include <wren/rhi/transfer/work_distributor.hpp>
+
+#include <wren/platform/thread.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <format>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace wren::rhi {
+
+std::optional<uint64_t> WorkDistributor::claim(uint32_t device) noexcept {
+    // The index is all a claim hands over; the work itself is ordered by
+    // the device's own timelines.
+    uint64_t const job = next_.fetch_add(1, std::memory_order_relaxed);
+    if (job >= job_count_)
+        return std::nullopt;
+    if (device < k_max_devices)
+        claimed_[device].fetch_add(1, std::memory_order_relaxed);
+    return job;
+}
+
+uint64_t WorkDistributor::claimed(uint32_t device) const noexcept {
+    return device < k_max_devices ? claimed_[device].load(std::memory_order_relaxed) : 0;
+}
+
+Status WorkDistributor::run(std::span<BackendDevice* const> devices, DeviceWork const& work) {
+    if (devices.empty() || devices.size() > k_max_devices || !work ||
+        std::ranges::any_of(devices, [](BackendDevice const* d) { return d == nullptr; }))
+        return Status::InvalidArgument;
+
+    auto const count = static_cast<uint32_t>(devices.size());
+    std::vector<Status> results(count, Status::Ok);
+    Status start = Status::Ok;
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(count);
+        try {
+            for (uint32_t i = 0; i < count; ++i) {
+                threads.emplace_back([&work, &results, device = devices[i], i] {
+                    try {
+                        platform::set_current_thread_name(std::format("wren-gpu{}", i));
+                        results[i] = work(i, *device);
+                    } catch (std::exception const&) {
+                        results[i] = Status::InternalError;
+                    }
+                });
+            }
+        } catch (std::system_error const&) {
+            start = Status::OutOfMemory;
+        }
+    }  // joins
+
+    for (Status const s : results) {
+        if (s != Status::Ok)
+            return s;
+    }
+    return start;
+}
+
+} // namespace wren::rhi
@@ -14,9 +14,53 @@ function(add_benchmark_subdirectory dir)
   endif()
 endfunction()
 
+# --------------------------------------------------------------
+# This function wraps the add_executable function for Google Benchmark suites.
+# Each suite links benchmark::benchmark_main and gets a `<target>.json` target
+# that runs it and writes the results to ${CMAKE_BINARY_DIR}/benchmarks/<target>.json,
+# the format compare.py (tools/compare.py in Google Benchmark) diffs between releases.
+# The `wren.benchmarks` target runs every suite.
+function(add_benchmark_executable target_name)
+  if(NOT ARGN)
+    message(FATAL_ERROR "add_benchmark_executable requires at least one source file.")
+  endif()
+  if(NOT TARGET benchmark::benchmark_main)
+    message(WARNING "Google Benchmark not found; skipping benchmark executable ${target_name}")
+    return()
+  endif()
+
+  message(STATUS "Adding benchmark executable ${target_name}")
+  add_executable(${target_name} ${ARGN})
+  target_compile_features(${target_name} PRIVATE cxx_std_23)
+  target_link_libraries(${target_name} PRIVATE benchmark::benchmark_main)
+
+  set(results_dir "${CMAKE_BINARY_DIR}/benchmarks")
+  add_custom_target(${target_name}.json
+    COMMAND ${CMAKE_COMMAND} -E make_directory "${results_dir}"
+    COMMAND $<TARGET_FILE:${target_name}>
+            --benchmark_out=${results_dir}/${target_name}.json
+            --benchmark_out_format=json
+            --benchmark_repetitions=5
+            --benchmark_report_aggregates_only=true
+    DEPENDS ${target_name}
+    WORKING_DIRECTORY "$<TARGET_FILE_DIR:${target_name}>"
+    USES_TERMINAL
+    COMMENT "Running ${target_name}"
+  )
+  if(NOT TARGET wren.benchmarks)
+    add_custom_target(wren.benchmarks)
+  endif()
+  add_dependencies(wren.benchmarks ${target_name}.json)
+endfunction()
+
 # --------------------------------------------------------------
 # This function wraps the add_executable function to add additional test functionality such as code coverage
 function(add_test_executable target_name)
+  if(NOT TARGET GTest::gtest_main)
+    message(WARNING "GoogleTest not found; skipping test executable ${target_name}")
+    return()
+  endif()
+
   set(prefix "ARG")
   set(noValues WIN32 MACOSX_BUNDLE EXCLUDE_FROM_ALL)
   set(singleVaulues)
@@ -52,8 +96,9 @@ function(add_test_executable target_name)
   # Create our executable
   add_executable(${target_name} ${win32} ${macosx_bundle} ${exclude_from_all} ${ARG_UNPARSED_ARGUMENTS})
 
-  # Catch2 management
-  include(Catch)
-  target_link_libraries(${target_name} PRIVATE Catch2::Catch2WithMain)
-  catch_discover_tests(${target_name})
+  # GoogleTest management
+  include(GoogleTest)
+  target_compile_features(${target_name} PRIVATE cxx_std_23)
+  target_link_libraries(${target_name} PRIVATE GTest::gtest_main)
+  gtest_discover_tests(${target_name})
 endfunction()